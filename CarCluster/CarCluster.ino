@@ -5,7 +5,7 @@
 // Enhanced project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
 // Better_CAN protocol: https://github.com/JackieZ123430/Better_CAN
 //
-// Retained inputs: Better_CAN/BeamNG UDP, Forza UDP, SimHub serial JSON, Wi-Fi dashboard.
+// Retained inputs: Better_CAN/BeamNG UDP, Forza UDP, SimHub serial JSON or binary frames, Wi-Fi dashboard.
 // Other vehicle implementations have been removed from this build.
 //
 // ####################################################################################################################
@@ -21,15 +21,42 @@
 #define MINIMUM_COOLANT_TEMPERATURE 50
 #define MAXIMUM_COOLANT_TEMPERATURE 150
 
+#ifndef WIFI_ENABLED
 #define WIFI_ENABLED 1
-#define WIFI_WEB_DASHBOARD_UPDATE_INTERVAL 1000
+#endif
+// Websocket clients on /websocket get the dashboard fields that changed at this interval (50 ms = 20 Hz).
+#define WIFI_WEB_DASHBOARD_UPDATE_INTERVAL 50
 #define WIFI_CONFIG_PORTAL_ACCESS_POINT_NAME "CarCluster-F10"
 #define WIFI_CONFIG_PORTAL_ACCESS_POINT_PASSWORD "carcluster"
 #define WIFI_CONFIG_PORTAL_TIMEOUT 180
 
+// A game that stops sending for this long drops out; the cluster falls back to the next fresh source or parks.
+#define TELEMETRY_SOURCE_TIMEOUT_MS 1000
+
 #define MAX_SERIAL_MESSAGE_LENGTH 250
 #define SERIAL_BAUD_RATE 921600
 
+// On the ESP32 the CAN side runs in its own high-priority task on the application core, away from the Wi-Fi stack,
+// and mongoose/Wi-Fi housekeeping runs in a task on the protocol core. They share state only through
+// GameStateSnapshot. With 0 everything runs in loop() one after the other, as on the host build.
+#ifndef RTOS_TASKS_ENABLED
+#define RTOS_TASKS_ENABLED 1
+#endif
+#define CAN_TASK_CORE 1
+#define CAN_TASK_PRIORITY 5
+#define CAN_TASK_STACK_SIZE 8192
+#define NETWORK_TASK_CORE 0
+#define NETWORK_TASK_PRIORITY 1
+#define NETWORK_TASK_STACK_SIZE 8192
+
+// Longest idle sleep of the CAN side. At 921600 baud about 92 bytes arrive per millisecond, so this keeps the 256-byte
+// UART RX buffer from overflowing while it waits for the next scheduled CAN frame.
+#define LOOP_MAXIMUM_SLEEP_MS 2
+
+// Sleep while frames only wait for a free TX buffer. One tick: the three MCP2515 buffers drain in under a millisecond
+// at 500 kbit/s, and with no ACK on the bus they never drain, so the pinned CAN task must not spin on them.
+#define LOOP_TX_QUEUE_SLEEP_MS 1
+
 #define WIFI_FORZA_UDP_PORT 1101
 #define WIFI_BEAM_UDP_PORT 4444
 #define WIFI_WEB_DASHBOARD_PORT 80
@@ -40,11 +67,25 @@
 #include "src/Libs/ArduinoJson/ArduinoJson.h"
 #include "src/Libs/MCP_CAN/mcp_can.h"
 #include "src/Games/GameSimulation.h"
+#include "src/Games/SerialFrameProtocol.h"
 #include "src/Games/SimhubGame.h"
+#include "src/Games/TelemetryArbiter.h"
+#include "src/Clusters/BMW_F/BMWFClusterFeedback.h"
 #include "src/Clusters/BMW_F/BMWFSeriesCluster.h"
+#include "src/Other/CanBusMonitor.h"
+#include "src/Other/CanFrameTiming.h"
+#include "src/Other/CanPassthroughQueue.h"
+#include "src/Other/CanReceiver.h"
+#include "src/Other/CanRxDispatcher.h"
 
 MCP_CAN CAN(SPI_CS_PIN);
 BMWFSeriesCluster cluster(CAN);
+CanPassthroughQueue canPassthroughQueue(CAN);
+CanReceiver canReceiver(CAN, CAN_INT);
+CanBusMonitor canBusMonitor(CAN);
+#if CAN_FRAME_TIMING
+CanFrameTiming canFrameTiming(CAN);
+#endif
 
 ClusterConfiguration defaultClusterConfig = BMWFSeriesCluster::clusterConfig();
 ClusterConfiguration clusterConfig = ClusterConfiguration::updatedFromDefaults(
@@ -57,7 +98,9 @@ ClusterConfiguration clusterConfig = ClusterConfiguration::updatedFromDefaults(
     MAXIMUM_COOLANT_TEMPERATURE);
 
 GameState game(clusterConfig);
-SimhubGame simhubGame(game);
+TelemetryArbiter telemetryArbiter(clusterConfig, TELEMETRY_SOURCE_TIMEOUT_MS);
+SimhubGame simhubGame(telemetryArbiter.source(TelemetrySource_Simhub));
+CanRxDispatcher canRxDispatcher(canReceiver, game);
 
 #if WIFI_ENABLED == 1
 #include "src/Other/WifiFunctions.h"
@@ -66,11 +109,17 @@ SimhubGame simhubGame(game);
 #include "src/Other/mongoose/mongoose_glue.h"
 #include "src/Games/ForzaHorizonGame.h"
 #include "src/Games/BeamNGGame.h"
+#include "src/Games/TelemetryRecorder.h"
+#include "src/Games/TelemetryReplayGame.h"
+#include <LittleFS.h>
 
 WifiFunctions wifiFunctions;
-WebDashboard webDashboard(game, WIFI_WEB_DASHBOARD_UPDATE_INTERVAL);
-ForzaHorizonGame forzaHorizonGame(game, WIFI_FORZA_UDP_PORT);
-BeamNGGame beamNGGame(game, WIFI_BEAM_UDP_PORT);
+WebDashboard webDashboard(
+    game, telemetryArbiter.source(TelemetrySource_Dashboard), canBusMonitor, WIFI_WEB_DASHBOARD_UPDATE_INTERVAL);
+ForzaHorizonGame forzaHorizonGame(telemetryArbiter.source(TelemetrySource_Forza), WIFI_FORZA_UDP_PORT);
+BeamNGGame beamNGGame(telemetryArbiter.source(TelemetrySource_BetterCAN), WIFI_BEAM_UDP_PORT);
+TelemetryRecorder telemetryRecorder(LittleFS);
+TelemetryReplayGame telemetryReplayGame(telemetryArbiter.source(TelemetrySource_Replay), LittleFS);
 
 void webDashboardGetState(struct state* data) {
   webDashboard.getState(data);
@@ -81,27 +130,57 @@ void webDashBoardSetState(struct state* data) {
 }
 
 bool webDashboardCheckSteeringButtonPressed(void) {
-  return false;
+  return webDashboard.steeringWheelActionPending();
 }
 
 void webDashboardSetSteeringButtonPressed(struct mg_str params) {
   webDashboard.steeringWheelAction(params);
 }
+
+void webDashboardBusReply(struct mg_connection* connection, struct mg_http_message* message) {
+  webDashboard.busReply(connection, message);
+}
+
+#if CAN_FRAME_TIMING
+void webDashboardTimingReply(struct mg_connection* connection, struct mg_http_message* message) {
+  webDashboard.timingReply(connection, message, canFrameTiming);
+}
+#endif
+
+void webDashboardTelemetryReply(struct mg_connection* connection, struct mg_http_message* message) {
+  webDashboard.telemetryReply(connection, message, telemetryRecorder, telemetryReplayGame);
+}
 #endif
 
 JsonDocument serialDocument;
+SerialFrameDecoder serialFrameDecoder;
 
 void initializeCan();
-void readSerialJson();
-void drainCanReceiveBuffer();
+void serviceCan();
+unsigned long canIdleTime();
+#if RTOS_TASKS_ENABLED == 1
+void startTasks();
+#endif
+void readSerialInput();
+void handleSerialFrame();
 
 void initializeCan() {
-  while (CAN.begin(MCP_ANY, CAN_500KBPS, MCP_8MHZ) != CAN_OK) {
+  // MCP_STDEXT applies the masks and filters programmed by canReceiver.begin(); MCP_ANY would bypass them.
+  while (CAN.begin(MCP_STDEXT, CAN_500KBPS, MCP_8MHZ) != CAN_OK) {
     Serial.println("[CAN] MCP2515 initialization failed; retrying");
     delay(250);
   }
 
   CAN.setMode(MCP_NORMAL);
+  canReceiver.begin();
+
+  // Frames are queued in RAM and fed to the three MCP2515 TX buffers as they free up, so loop() never waits for
+  // the bus. serviceTxQueue() below keeps the hardware buffers topped up between cluster updates.
+  CAN.enableTxQueue(1);
+  canBusMonitor.begin();
+#if CAN_FRAME_TIMING
+  canFrameTiming.begin();
+#endif
   Serial.println("[CAN] MCP2515 ready at 500 kbit/s");
 }
 
@@ -113,6 +192,10 @@ void setup() {
   delay(300);
   Serial.println("Starting CarCluster-F10-Enhanced optimized build");
 
+  // Dashboard edits hold until a game takes over instead of timing out.
+  telemetryArbiter.setTimeout(TelemetrySource_Dashboard, 0);
+
+  registerBMWFClusterFeedback(canRxDispatcher);
   initializeCan();
   simhubGame.begin();
 
@@ -129,19 +212,69 @@ void setup() {
       "steering_button_pressed",
       webDashboardCheckSteeringButtonPressed,
       webDashboardSetSteeringButtonPressed);
+  mongoose_set_http_handlers("bus", webDashboardBusReply);
+#if CAN_FRAME_TIMING
+  mongoose_set_http_handlers("timing", webDashboardTimingReply);
+#endif
+  mongoose_set_http_handlers("telemetry", webDashboardTelemetryReply);
+
+  // Telemetry logs live on the data partition; format it on first boot.
+  if (!LittleFS.begin(true)) Serial.println("[Telemetry] LittleFS mount failed");
 
   forzaHorizonGame.begin();
   beamNGGame.begin();
 #endif
+
+#if RTOS_TASKS_ENABLED == 1
+  startTasks();
+#endif
 }
 
-void loop() {
+// One pass of the CAN side: merge the inputs, encode the frames that are due and move frames through the MCP2515.
+// The serial port stays here because passthrough frames go straight to MCP_CAN.
+void serviceCan() {
+  const unsigned long now = millis();
+#if WIFI_ENABLED == 1
+  // Pick up the latest consistent state published by the AsyncUDP handlers and the dashboard.
+  if (forzaHorizonGame.update()) telemetryArbiter.markFresh(TelemetrySource_Forza, now);
+  if (beamNGGame.update()) telemetryArbiter.markFresh(TelemetrySource_BetterCAN, now);
+  if (telemetryReplayGame.update()) telemetryArbiter.markFresh(TelemetrySource_Replay, now);
+  if (webDashboard.exchangeGameState()) telemetryArbiter.markFresh(TelemetrySource_Dashboard, now);
+#endif
+  telemetryArbiter.arbitrate(now);
+#if WIFI_ENABLED == 1
+  // Recorded before smoothing, so a replay feeds the filters the same samples again.
+  telemetryRecorder.capture(telemetryArbiter.arbitrated(), now);
+#endif
+  telemetryArbiter.apply(game, now);
+
   cluster.updateWithGame(game);
-  readSerialJson();
-  drainCanReceiveBuffer();
+  canPassthroughQueue.service();
+  CAN.serviceTxQueue();
+  readSerialInput();
+  canReceiver.service();
+  canRxDispatcher.dispatch();
+  canBusMonitor.update();
+#if CAN_FRAME_TIMING
+  canFrameTiming.update();
+#endif
+}
+
+// Time until the next cluster or passthrough frame is due, shortened to LOOP_TX_QUEUE_SLEEP_MS while frames wait for
+// a TX buffer. Never 0 for queued frames alone: delay(0) does not yield to lower-priority tasks on the pinned core.
+unsigned long canIdleTime() {
+  unsigned long idleTime = cluster.millisUntilNextFrame();
+  if (CAN.txQueuePending() > 0 && idleTime > LOOP_TX_QUEUE_SLEEP_MS) idleTime = LOOP_TX_QUEUE_SLEEP_MS;
+  if (canPassthroughQueue.millisUntilNextFrame() < idleTime) idleTime = canPassthroughQueue.millisUntilNextFrame();
+  if (idleTime > LOOP_MAXIMUM_SLEEP_MS) idleTime = LOOP_MAXIMUM_SLEEP_MS;
+  return idleTime;
+}
 
 #if WIFI_ENABLED == 1
+void serviceNetwork() {
   webDashboard.update();
+  telemetryRecorder.service();
+  telemetryReplayGame.service();
   mongoose_poll();
 
   static unsigned long lastWifiReconnectAttempt = 0;
@@ -149,13 +282,51 @@ void loop() {
     lastWifiReconnectAttempt = millis();
     WiFi.reconnect();
   }
+}
+#endif
+
+#if RTOS_TASKS_ENABLED == 1
+void canTask(void* parameter) {
+  (void)parameter;
+  for (;;) {
+    serviceCan();
+    CAN.serviceTxQueue();
+    delay(canIdleTime());
+  }
+}
+
+#if WIFI_ENABLED == 1
+void networkTask(void* parameter) {
+  (void)parameter;
+  // mongoose_poll() waits for socket activity for up to 10 ms, which paces this loop.
+  for (;;) serviceNetwork();
+}
+#endif
+
+void startTasks() {
+  xTaskCreatePinnedToCore(canTask, "can", CAN_TASK_STACK_SIZE, NULL, CAN_TASK_PRIORITY, NULL, CAN_TASK_CORE);
+#if WIFI_ENABLED == 1
+  xTaskCreatePinnedToCore(
+      networkTask, "network", NETWORK_TASK_STACK_SIZE, NULL, NETWORK_TASK_PRIORITY, NULL, NETWORK_TASK_CORE);
+#endif
+}
 #endif
 
-  // Yield to the ESP32 Wi-Fi/UDP tasks and avoid a 100% busy loop.
-  delay(1);
+void loop() {
+#if RTOS_TASKS_ENABLED == 1
+  // canTask and networkTask do all the work; the Arduino loop task is no longer needed.
+  vTaskDelete(NULL);
+#else
+  serviceCan();
+#if WIFI_ENABLED == 1
+  serviceNetwork();
+#endif
+  CAN.serviceTxQueue();
+  delay(canIdleTime());
+#endif
 }
 
-void readSerialJson() {
+void readSerialInput() {
   static char message[MAX_SERIAL_MESSAGE_LENGTH];
   static size_t messagePosition = 0;
   static bool droppingOversizeMessage = false;
@@ -163,6 +334,16 @@ void readSerialJson() {
   while (Serial.available() > 0) {
     const char incoming = static_cast<char>(Serial.read());
 
+    // A zero byte never occurs in JSON text and starts a binary frame; see SerialFrameProtocol.h.
+    if (incoming == '\0' || serialFrameDecoder.active()) {
+      if (incoming == '\0') {
+        messagePosition = 0;
+        droppingOversizeMessage = false;
+      }
+      if (serialFrameDecoder.push(static_cast<uint8_t>(incoming))) handleSerialFrame();
+      continue;
+    }
+
     if (incoming == '\r') continue;
 
     if (incoming != '\n') {
@@ -215,19 +396,36 @@ void readSerialJson() {
       CAN.sendMsgBuf(address, 0, 8, payload);
     } else if (action == 10) {
       simhubGame.decodeSerialData(serialDocument);
+      telemetryArbiter.markFresh(TelemetrySource_Simhub, millis());
+#if CAN_FRAME_TIMING
+    } else if (action == 20) {
+      // {"action":20} prints the send timing histograms; add "reset":1 to start a new measurement afterwards.
+      canFrameTiming.printReport();
+      if (serialDocument["reset"] | 0) canFrameTiming.reset();
+#endif
     }
   }
 }
 
-void drainCanReceiveBuffer() {
-  // This F10-only build does not use inbound CAN data, but the MCP2515 RX buffers
-  // still need to be drained to avoid overflow and a permanently asserted INT pin.
-  uint8_t drained = 0;
-  while (!digitalRead(CAN_INT) && drained < 8) {
-    unsigned long rxId = 0;
-    uint8_t length = 0;
-    uint8_t payload[8] = {};
-    CAN.readMsgBuf(&rxId, &length, payload);
-    drained++;
+void handleSerialFrame() {
+  const uint8_t* payload = serialFrameDecoder.payload();
+  const uint8_t length = serialFrameDecoder.payloadLength();
+
+  if (serialFrameDecoder.type() == SerialFrameType_CanPassthrough) {
+    if (length < 2 || length > sizeof(SerialCanPassthroughPayload)) return;
+
+    const uint16_t address = static_cast<uint16_t>(payload[0] | (payload[1] << 8));
+    if (address > 0x7FF) {
+      Serial.println("[Serial] ignored invalid standard CAN ID");
+      return;
+    }
+
+    uint8_t data[8] = {};
+    memcpy(data, &payload[2], length - 2);
+    CAN.sendMsgBuf(address, 0, length - 2, data);
+  } else if (serialFrameDecoder.type() == SerialFrameType_CanBatch) {
+    if (!canPassthroughQueue.enqueueBatch(payload, length)) Serial.println("[Serial] ignored malformed CAN batch");
+  } else if (serialFrameDecoder.type() == SerialFrameType_SimhubTelemetry) {
+    if (simhubGame.decodeBinaryData(payload, length)) telemetryArbiter.markFresh(TelemetrySource_Simhub, millis());
   }
 }
@@ -0,0 +1,31 @@
+// ####################################################################################################################
+// BMW F10 cluster feedback decoding
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "BMWFClusterFeedback.h"
+
+namespace {
+
+// Mileage: bytes 0-2 odometer in km (little endian), byte 3 tank level, bytes 6-7 remaining range in km / 16.
+const uint16_t kMileageFrameId = 0x330;
+
+void decodeMileage(const CanFrame& frame, GameState& game) {
+  game.clusterLastSeenTime = millis();
+  if (frame.length < 8) return;
+
+  game.clusterOdometer = static_cast<uint32_t>(frame.data[0]) |
+                         (static_cast<uint32_t>(frame.data[1]) << 8) |
+                         (static_cast<uint32_t>(frame.data[2]) << 16);
+  game.clusterRange = static_cast<uint16_t>((frame.data[6] | (frame.data[7] << 8)) / 16);
+}
+
+}  // namespace
+
+void registerBMWFClusterFeedback(CanRxDispatcher& dispatcher) {
+  dispatcher.on(kMileageFrameId, decodeMileage);
+}
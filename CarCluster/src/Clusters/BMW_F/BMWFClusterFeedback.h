@@ -0,0 +1,21 @@
+// ####################################################################################################################
+// BMW F10 cluster feedback decoding
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Frames the KOMBI transmits on its own. Their handlers copy the values into the cluster* fields of GameState,
+// where the web dashboard reads them. Any routed frame also counts as a sign that the cluster is awake.
+// ####################################################################################################################
+
+#ifndef BMW_F10_CLUSTER_FEEDBACK_H
+#define BMW_F10_CLUSTER_FEEDBACK_H
+
+#include "../../Other/CanRxDispatcher.h"
+
+// Routes the known KOMBI frames. Call before CanReceiver::begin().
+void registerBMWFClusterFeedback(CanRxDispatcher& dispatcher);
+
+#endif
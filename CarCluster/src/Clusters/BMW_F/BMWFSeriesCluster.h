@@ -17,6 +17,9 @@
 #include "../../Libs/MultiMap/MultiMap.h"
 #include "../../Libs/MCP_CAN/mcp_can.h"
 #include "CRC8.h"
+#include "CheckControlManager.h"
+#include "SteeringButtonSequencer.h"
+#include "FrameTemplate.h"
 #include "../Cluster.h"
 
 #define lo8(x) (uint8_t)((x) & 0xFF)
@@ -36,25 +39,92 @@ class BMWFSeriesCluster : public Cluster {
   explicit BMWFSeriesCluster(MCP_CAN& CAN);
   void updateWithGame(GameState& game) override;
   void updateLanguageAndUnits();
+  unsigned long millisUntilNextFrame();
 
  private:
+  // Periodic frame groups. Each group is one row of the frame schedule and owns its own alive counters.
+  enum FrameTask : uint8_t {
+    FrameTask_Ignition,
+    FrameTask_Speed,
+    FrameTask_RPM,
+    FrameTask_BodyKeepAlive,
+    FrameTask_DriveInfo,
+    FrameTask_Gateway,
+    FrameTask_Chassis,
+    FrameTask_Transmission,
+    FrameTask_FuelAndParkBrake,
+    FrameTask_Distance,
+    FrameTask_Alerts,
+    FrameTask_Tpms,
+    FrameTask_Lights,
+    FrameTask_Blinkers,
+    FrameTask_Backlight,
+    FrameTask_DriveMode,
+    FrameTask_OutsideTemperature,
+    FrameTask_Time,
+    FrameTask_LanguageAndUnits,
+    FrameTask_Count
+  };
+
+  struct ScheduledFrame {
+    uint16_t periodMs;
+    uint16_t phaseMs;
+    unsigned long dueTime;
+    uint8_t counter4Bit;
+    uint8_t count;
+    uint16_t dirtyGroups;
+  };
+
   MCP_CAN& CAN;
-  CRC8 crc8Calculator;
+  CheckControlManager checkControl;
+  SteeringButtonSequencer steeringButtons;
+
+  // Persistent CRC-protected frames; only the counter and changed value bytes are patched per send.
+  FrameTemplate ignitionFrame;
+  FrameTemplate speedFrame;
+  FrameTemplate rpmOffsetFrame;
+  FrameTemplate rpmFrame;
+  FrameTemplate transmissionFrame;
+  FrameTemplate neutralFrame;
+  FrameTemplate abs1Frame;
+  FrameTemplate steeringColumnFrame;
+  FrameTemplate restraintFrame;
+  FrameTemplate restraint2Frame;
+  FrameTemplate oilFrame;
+  FrameTemplate parkBrakeFrame;
+  FrameTemplate mpgFrame;
+  FrameTemplate mpg2Frame;
+  FrameTemplate driveModeFrame;
+  FrameTemplate tpmsFrame;
 
-  unsigned long dashboardUpdateTimeFast = 20;
-  unsigned long dashboardUpdateTimeLights = 100;
-  unsigned long dashboardUpdateTimeSlow = 1000;
-  unsigned long lastDashboardUpdateTime = 0;
-  unsigned long lastDashboardUpdateTimeLights = 0;
-  unsigned long lastDashboardUpdateTime1000ms = 0;
+  ScheduledFrame frameSchedule[FrameTask_Count];
+  unsigned long nextFrameDueTime = 0;
+  bool frameScheduleStarted = false;
 
+  // Alive counters of the frame group currently being sent; loaded from and stored back to its schedule row.
   uint8_t counter4Bit = 0;
   uint8_t count = 0;
+  // GameStateGroup bits changed since the group currently being sent was last encoded.
+  uint16_t frameDirtyGroups = GameStateGroup_All;
+
+  bool lastIgnition = false;
+  unsigned long ignitionOnTime = 0;
+  unsigned long engineStableSince = 0;
+  unsigned long zeroSpeedStartTime = 0;
+  bool engineStable = false;
   uint16_t distanceTravelledCounter = 0;
 
   uint8_t inFuelRange[3] = {0, 50, 100};
   uint8_t outFuelRange[3] = {37, 18, 4};
 
+  void scheduleFrame(FrameTask task, uint16_t periodMs, uint16_t phaseMs);
+  void startFrameSchedule(unsigned long now);
+  void sendScheduledFrame(FrameTask task, GameState& game);
+
+  void initializeFrameTemplates();
+  void sendFrame(FrameTemplate& frame);
+  void resendFrame(FrameTemplate& frame);
+
   void sendIgnitionStatus(bool ignition);
   void sendSpeed(int speed);
   void sendRPM(int rpm, int manualGear);
@@ -67,7 +137,6 @@ class BMWFSeriesCluster : public Cluster {
   void sendLights(bool mainLights, bool highBeam, bool rearFogLight, bool frontFogLight);
   void sendBacklightBrightness(uint8_t brightness);
   void sendAlerts(GameState& game, bool stabilityIntervention);
-  void sendSteeringWheelButton(int buttonEvent);
   void sendDriveMode(uint8_t driveMode);
   void sendOutsideTemperature(int temperature);
   void sendTime(uint8_t hours, uint8_t minutes);
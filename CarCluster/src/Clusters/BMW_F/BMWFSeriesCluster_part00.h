@@ -13,17 +13,120 @@
 // CAN-bus and instrument-cluster experiments can damage hardware when wired or powered incorrectly; use at your own risk.
 //
 // Runtime notes
-// - CC-ID 67 is sent once after ignition has remained on for five seconds.
+// - Check-Control warnings (CC-IDs on 0x5C0) are only declared with checkControl.set(); CheckControlManager sends
+//   the changes, rate-limited, and refreshes the managed CC-IDs slowly in the background.
+// - CC-ID 67 is active once ignition has remained on for five seconds.
 // - CC-ID 78 follows the speed threshold state and is active above 160 km/h.
-// - Warning messages use state caching where possible to avoid repeated activation/clear frames.
-// - The steering-wheel output accepts the BC/menu action only.
+// - The steering-wheel output accepts the BC/menu action only, as a press, hold or long press. Actions are queued and
+//   played by SteeringButtonSequencer without blocking the frame schedule.
+// - Periodic frames are sent from a deadline schedule (see the constructor) with per-group phase offsets and alive
+//   counters instead of fixed 20/100/1000 ms bursts.
 //
 // ####################################################################################################################
 
 #include "BMWFSeriesCluster.h"
 
-BMWFSeriesCluster::BMWFSeriesCluster(MCP_CAN& CAN) : CAN(CAN) {
-  crc8Calculator.begin();
+BMWFSeriesCluster::BMWFSeriesCluster(MCP_CAN& CAN) : CAN(CAN), checkControl(CAN), steeringButtons(CAN) {
+  initializeFrameTemplates();
+
+  // Period and phase offset (ms) of every periodic frame group. The 20 ms groups are spread over the whole period
+  // so only one or two frames are handed to the MCP2515 at a time instead of one 30-frame burst per tick.
+  scheduleFrame(FrameTask_Ignition, 20, 0);
+  scheduleFrame(FrameTask_Speed, 20, 1);
+  scheduleFrame(FrameTask_RPM, 20, 11);
+  scheduleFrame(FrameTask_BodyKeepAlive, 20, 3);
+  scheduleFrame(FrameTask_DriveInfo, 20, 5);
+  scheduleFrame(FrameTask_Gateway, 20, 7);
+  scheduleFrame(FrameTask_Chassis, 20, 9);
+  scheduleFrame(FrameTask_Transmission, 20, 13);
+  scheduleFrame(FrameTask_FuelAndParkBrake, 20, 15);
+  scheduleFrame(FrameTask_Distance, 20, 17);
+  scheduleFrame(FrameTask_Alerts, 20, 19);
+  scheduleFrame(FrameTask_Tpms, 20, 2);
+  scheduleFrame(FrameTask_Lights, 100, 4);
+  scheduleFrame(FrameTask_Blinkers, 100, 54);
+  scheduleFrame(FrameTask_Backlight, 1000, 6);
+  scheduleFrame(FrameTask_DriveMode, 1000, 206);
+  scheduleFrame(FrameTask_OutsideTemperature, 1000, 406);
+  scheduleFrame(FrameTask_Time, 1000, 606);
+  scheduleFrame(FrameTask_LanguageAndUnits, 1000, 806);
+}
+
+void BMWFSeriesCluster::scheduleFrame(FrameTask task, uint16_t periodMs, uint16_t phaseMs) {
+  ScheduledFrame& frame = frameSchedule[task];
+  frame.periodMs = periodMs;
+  frame.phaseMs = phaseMs;
+  frame.dueTime = 0;
+  frame.counter4Bit = 0;
+  frame.count = 0;
+  frame.dirtyGroups = GameStateGroup_All;
+}
+
+void BMWFSeriesCluster::startFrameSchedule(unsigned long now) {
+  nextFrameDueTime = now;
+  for (uint8_t i = 0; i < FrameTask_Count; i++) {
+    frameSchedule[i].dueTime = now + frameSchedule[i].phaseMs;
+  }
+  frameScheduleStarted = true;
+}
+
+void BMWFSeriesCluster::initializeFrameTemplates() {
+  // Bytes 1..n-1 of each frame as first sent; byte 0 (CRC) is filled in by the template.
+  const uint8_t ignition[] = {0x80, 0x08, 0xDD, 0xF1, 0x01, 0x30, 0x06};
+  const uint8_t speed[] = {0xC0, 0x00, 0x00, 0x81};
+  const uint8_t rpm[] = {0x00, 0x00, 0xC0, 0xF0, 0x00, 0xFF, 0xFF};
+  const uint8_t transmission[] = {0x00, 0x00, 0xFC, 0xFF};
+  const uint8_t neutral[] = {0xF0, 0x60, 0xFC, 0xFF};
+  const uint8_t abs1[] = {0xF0, 0xFE, 0xFF, 0x14};
+  const uint8_t steeringColumn[] = {0xF0, 0xFE, 0xFF, 0x14};
+  const uint8_t restraint[] = {0x40, 0x40, 0x55, 0xFD, 0xFF, 0xFF, 0xFF};
+  const uint8_t restraint2[] = {0xE0, 0xF1, 0xF0, 0xF2, 0xF2, 0xFE};
+  const uint8_t oil[] = {0x10, 0x82, 0x4E, 0x7E, 0x00, 0x05, 0x89};
+  const uint8_t parkBrake[] = {0xF0, 0x38, 0x00, 0x14};
+  const uint8_t mpg[] = {0x00, 0xFF, 0x64, 0x64, 0x64, 0x01, 0xF1};
+  const uint8_t mpg2[] = {0xF0, 0x00, 0x00, 0xF2};
+  const uint8_t driveMode[] = {0xF0, 0x00, 0x00, 0x02, 0x11, 0xC0};
+  const uint8_t tpms[] = {0xF0, 0xA2, 0xA0, 0xA0};
+
+  ignitionFrame.begin<8, 0x44>(0x12F, ignition);
+  speedFrame.begin<5, 0xA9>(0x1A1, speed);
+  rpmOffsetFrame.begin<8, 0x7A>(0x0F3, rpm);
+  rpmFrame.begin<8, 0x7A>(0x0F3, rpm);
+  transmissionFrame.begin<5, 0xD6>(0x3FD, transmission);
+  neutralFrame.begin<5, 0x5A>(0x178, neutral);
+  abs1Frame.begin<5, 0xD8>(0x36E, abs1);
+  steeringColumnFrame.begin<5, 0x9E>(0x2A7, steeringColumn);
+  restraintFrame.begin<8, 0xFF>(0x19B, restraint);
+  restraint2Frame.begin<7, 0x28>(0x297, restraint2);
+  oilFrame.begin<8, 0xF1>(0x3F9, oil);
+  parkBrakeFrame.begin<5, 0x17>(0x36F, parkBrake);
+  mpgFrame.begin<8, 0xC6>(0x2C4, mpg);
+  mpg2Frame.begin<5, 0xDE>(0x2BB, mpg2);
+  driveModeFrame.begin<7, 0x4A>(0x3A7, driveMode);
+  tpmsFrame.begin<5, 0xC5>(0x369, tpms);
+}
+
+void BMWFSeriesCluster::sendFrame(FrameTemplate& frame) {
+  CAN.sendMsgBuf(frame.id(), 0, frame.length(), const_cast<uint8_t*>(frame.frame()));
+}
+
+// Sends the previous payload again with only the alive counter advanced; used when the inputs are unchanged.
+void BMWFSeriesCluster::resendFrame(FrameTemplate& frame) {
+  frame.setCounter(counter4Bit);
+  sendFrame(frame);
+}
+
+unsigned long BMWFSeriesCluster::millisUntilNextFrame() {
+  if (!frameScheduleStarted) return 0;
+  const unsigned long now = millis();
+  const long remaining = static_cast<long>(nextFrameDueTime - now);
+  const unsigned long frameWait = remaining > 0 ? static_cast<unsigned long>(remaining) : 0;
+  unsigned long wait = frameWait;
+  const unsigned long checkControlWait = checkControl.millisUntilNextFrame(now);
+  if (checkControlWait < wait) wait = checkControlWait;
+  const unsigned long steeringButtonWait = steeringButtons.millisUntilNextFrame(now);
+  if (steeringButtonWait < wait) wait = steeringButtonWait;
+  return wait;
 }
 
 uint8_t BMWFSeriesCluster::mapGenericGearToLocalGear(GearState inputGear) {
@@ -78,124 +181,149 @@ int BMWFSeriesCluster::mapCoolantTemperature(GameState& game) {
 
 void BMWFSeriesCluster::updateWithGame(GameState& game) {
   if (game.buttonEventToProcess != 0) {
-    sendSteeringWheelButton(game.buttonEventToProcess);
+    steeringButtons.queue(game.buttonEventToProcess);
     game.buttonEventToProcess = 0;
   }
+  steeringButtons.service(millis());
 
-  static bool lastIgnition = false;
-  static unsigned long ignitionOnTime = 0;
-  static bool cc67Sent = false;
+  if (game.ignition && !lastIgnition) ignitionOnTime = millis();
+  lastIgnition = game.ignition;
 
-  if (game.ignition && !lastIgnition) {
-    ignitionOnTime = millis();
-    cc67Sent = false;
+  // Manual CC-ID injection for bench testing; overrides the state the cluster code declares.
+  if (game.alertStart) {
+    checkControl.inject(game.alertId, true);
+    game.alertStart = false;
   }
 
-  if (!game.ignition && lastIgnition) {
-    if (cc67Sent) {
-      uint8_t msg67_off[] = {0x40, 67, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF};
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg67_off);
-    }
-    cc67Sent = false;
+  if (game.alertClear) {
+    checkControl.inject(game.alertId, false);
+    game.alertClear = false;
   }
 
-  lastIgnition = game.ignition;
+  // Hand the groups changed by the game sources to every schedule row; each row clears them once it re-encodes.
+  const uint16_t changedGroups = game.takeDirtyGroups();
+  if (changedGroups != 0) {
+    for (uint8_t i = 0; i < FrameTask_Count; i++) frameSchedule[i].dirtyGroups |= changedGroups;
+  }
 
-  if (millis() - lastDashboardUpdateTime >= dashboardUpdateTimeFast) {
-    sendIgnitionStatus(game.ignition);
+  const unsigned long now = millis();
+  if (!frameScheduleStarted) startFrameSchedule(now);
+  if (static_cast<long>(now - nextFrameDueTime) < 0) {
+    checkControl.service(now);
+    return;
+  }
 
-    // CC-ID 58 parking-brake indication after two seconds at zero speed.
-    static unsigned long zeroSpeedStartTime = 0;
-    static bool autoHoldActive = false;
-    bool wantAutoHold = false;
+  // Send every group whose deadline has passed, then advance its deadline by whole periods so the phase offsets are
+  // kept. A group that missed several periods (e.g. during Wi-Fi setup) is sent once rather than in a catch-up burst.
+  unsigned long nextDue = now + 0xFFFF;
+  for (uint8_t i = 0; i < FrameTask_Count; i++) {
+    ScheduledFrame& frame = frameSchedule[i];
 
-    if (game.ignition && game.speed == 0) {
-      if (zeroSpeedStartTime == 0) zeroSpeedStartTime = millis();
-      if (millis() - zeroSpeedStartTime >= 2000) wantAutoHold = true;
-    } else {
-      zeroSpeedStartTime = 0;
-    }
+    if (static_cast<long>(now - frame.dueTime) >= 0) {
+      counter4Bit = frame.counter4Bit;
+      count = frame.count;
+      frameDirtyGroups = frame.dirtyGroups;
+      frame.dirtyGroups = 0;
 
-    if (wantAutoHold) {
-      uint8_t msg58_on[] = {0x40, 58, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xFF};
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg58_on);
-      autoHoldActive = true;
-    } else if (autoHoldActive) {
-      uint8_t msg58_off[] = {0x40, 58, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF};
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg58_off);
-      autoHoldActive = false;
-    }
+      sendScheduledFrame(static_cast<FrameTask>(i), game);
 
-    // Automatic high-beam keep-alive.
-    {
-      uint8_t ahbFrame[8];
-      const uint8_t ahbVal = game.highBeam ? 0x02 : 0x01;
-      for (uint8_t i = 0; i < 8; i++) ahbFrame[i] = ahbVal;
-      CAN.sendMsgBuf(0x36A, 0, 8, ahbFrame);
-    }
+      frame.counter4Bit = counter4Bit >= 14 ? 0 : counter4Bit + 1;
+      frame.count = count >= 253 ? 0 : count + 1;
 
-    // Automatic start/stop keep-alive.
-    {
-      uint8_t assFrame[8];
-      const uint8_t assVal = game.ignition ? 0x1A : 0xE6;
-      for (uint8_t i = 0; i < 8; i++) assFrame[i] = assVal;
-      CAN.sendMsgBuf(0x30B, 0, 8, assFrame);
+      do {
+        frame.dueTime += frame.periodMs;
+      } while (static_cast<long>(now - frame.dueTime) >= 0);
     }
 
-    // CC-ID 67: Remote Control/Key Battery Discharged.
-    if (game.ignition && !cc67Sent && millis() - ignitionOnTime >= 5000) {
-      uint8_t msg67_on[] = {0x40, 67, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xFF};
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg67_on);
-      cc67Sent = true;
-    }
+    if (static_cast<long>(frame.dueTime - nextDue) < 0) nextDue = frame.dueTime;
+  }
+  nextFrameDueTime = nextDue;
 
-    // CC-ID 40: Press Brake to Start.
-    static bool lastPressBrakeState = false;
-    const bool pressBrakeState = game.ignition && game.rpm < 10;
-    if (pressBrakeState != lastPressBrakeState) {
-      uint8_t msg40[] = {
-        0x40, 40, 0x00, static_cast<uint8_t>(pressBrakeState ? 0x29 : 0x28),
-        0xFF, 0xFF, 0xFF, 0xFF
-      };
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg40);
-      lastPressBrakeState = pressBrakeState;
-    }
+  // Queue the CC-ID changes declared by the groups just sent.
+  checkControl.service(now);
+}
+
+void BMWFSeriesCluster::sendScheduledFrame(FrameTask task, GameState& game) {
+  switch (task) {
+    case FrameTask_Ignition: {
+      sendIgnitionStatus(game.ignition);
 
-    // Engine-stopped warning state with hysteresis.
-    static bool lastEngineStoppedState = false;
-    bool engineStoppedNow = false;
+      // CC-ID 58 parking-brake indication after two seconds at zero speed.
+      bool wantAutoHold = false;
 
-    if (game.ignition) {
-      if (game.rpm < 50) {
-        engineStoppedNow = true;
-      } else if (game.rpm > 150) {
-        engineStoppedNow = false;
+      if (game.ignition && game.speed == 0) {
+        if (zeroSpeedStartTime == 0) zeroSpeedStartTime = millis();
+        if (millis() - zeroSpeedStartTime >= 2000) wantAutoHold = true;
       } else {
-        engineStoppedNow = lastEngineStoppedState;
+        zeroSpeedStartTime = 0;
       }
+
+      checkControl.set(58, wantAutoHold);
+
+      // CC-ID 67: Remote Control/Key Battery Discharged.
+      checkControl.set(67, game.ignition && millis() - ignitionOnTime >= 5000);
+
+      // CC-ID 40: Press Brake to Start.
+      checkControl.set(40, game.ignition && game.rpm < 10);
+
+      // CC-IDs 21 and 30: engine stopped, with hysteresis.
+      bool engineStopped = false;
+      if (game.ignition) {
+        if (game.rpm < 50) {
+          engineStopped = true;
+        } else if (game.rpm > 150) {
+          engineStopped = false;
+        } else {
+          engineStopped = checkControl.isActive(21);
+        }
+      }
+      checkControl.set(21, engineStopped);
+      checkControl.set(30, engineStopped);
+
+      if (game.ignition && millis() - ignitionOnTime < 3000) {
+        updateLanguageAndUnits();
+      }
+      break;
     }
 
-    if (engineStoppedNow != lastEngineStoppedState) {
-      const uint8_t engineStoppedIds[] = {21, 30};
-      for (uint8_t i = 0; i < sizeof(engineStoppedIds); i++) {
-        uint8_t msg[] = {
-          0x40,
-          engineStoppedIds[i],
-          0x00,
-          static_cast<uint8_t>(engineStoppedNow ? 0x29 : 0x28),
-          0xFF, 0xFF, 0xFF, 0xFF
-        };
-        CAN.sendMsgBuf(0x5C0, 0, 8, msg);
+    case FrameTask_Speed:
+      if (frameDirtyGroups & GameStateGroup_Speed) {
+        sendSpeed(mapSpeed(game));
+      } else {
+        resendFrame(speedFrame);
       }
-      lastEngineStoppedState = engineStoppedNow;
+      break;
+
+    case FrameTask_RPM:
+      if (frameDirtyGroups & (GameStateGroup_Engine | GameStateGroup_Gear)) {
+        sendRPM(mapRPM(game), mapGenericGearToLocalGear(game.gear));
+      } else {
+        sendFrame(rpmOffsetFrame);
+        sendFrame(rpmFrame);
+      }
+      break;
+
+    case FrameTask_BodyKeepAlive: {
+      // Automatic high-beam keep-alive.
+      uint8_t ahbFrame[8];
+      const uint8_t ahbVal = game.highBeam ? 0x02 : 0x01;
+      for (uint8_t i = 0; i < 8; i++) ahbFrame[i] = ahbVal;
+      CAN.sendMsgBuf(0x36A, 0, 8, ahbFrame);
+
+      // Automatic start/stop keep-alive.
+      uint8_t assFrame[8];
+      const uint8_t assVal = game.ignition ? 0x1A : 0xE6;
+      for (uint8_t i = 0; i < 8; i++) assFrame[i] = assVal;
+      CAN.sendMsgBuf(0x30B, 0, 8, assFrame);
+      break;
     }
 
-    sendSpeed(mapSpeed(game));
-    sendRPM(mapRPM(game), mapGenericGearToLocalGear(game.gear));
-    sendBasicDriveInfo(game, game.oilTemperature);
+    case FrameTask_DriveInfo:
+      sendBasicDriveInfo(game, game.oilTemperature);
+      break;
 
-    // Gateway, body and chassis keep-alive frames for standalone cluster operation.
-    {
+    case FrameTask_Gateway: {
+      // Gateway, body and chassis keep-alive frames for standalone cluster operation.
       unsigned char vehicleStatus[8] = {
         0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0,
         static_cast<uint8_t>(random(0xFC, 0xFD))
@@ -207,9 +335,10 @@ void BMWFSeriesCluster::updateWithGame(GameState& game) {
 
       unsigned char gatewayFrame[2] = {0x79, 0x20};
       CAN.sendMsgBuf(0x381, 0, 2, gatewayFrame);
+      break;
     }
 
-    {
+    case FrameTask_Chassis: {
       uint8_t icmFrame[8] = {
         static_cast<uint8_t>(0xF0 | counter4Bit), 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00
       };
@@ -229,120 +358,93 @@ void BMWFSeriesCluster::updateWithGame(GameState& game) {
         static_cast<uint8_t>(0xF0 | counter4Bit), 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64
       };
       CAN.sendMsgBuf(0x3D0, 0, 8, batteryFrame);
+      break;
     }
 
-    sendAutomaticTransmission(game.gear, game.gearIndex);
+    case FrameTask_Transmission:
+      if (frameDirtyGroups & GameStateGroup_Gear) {
+        sendAutomaticTransmission(game.gear, game.gearIndex);
+      } else {
+        resendFrame(transmissionFrame);
+      }
 
-    if (game.gear == GearState_Auto_N) {
-      unsigned char neutralWithoutCRC[] = {
-        static_cast<uint8_t>(0xF0 | counter4Bit), 0x60, 0xFC, 0xFF
-      };
-      unsigned char neutralWithCRC[] = {
-        crc8Calculator.get_crc8(neutralWithoutCRC, 4, 0x5A),
-        neutralWithoutCRC[0], neutralWithoutCRC[1], neutralWithoutCRC[2], neutralWithoutCRC[3]
-      };
-      CAN.sendMsgBuf(0x178, 0, 5, neutralWithCRC);
-
-      uint8_t msg169_on[] = {0x40, 169, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xFF};
-      uint8_t msg203_on[] = {0x40, 203, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xFF};
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg169_on);
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg203_on);
-    } else {
-      uint8_t msg169_off[] = {0x40, 169, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF};
-      uint8_t msg203_off[] = {0x40, 203, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF};
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg169_off);
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg203_off);
-    }
+      if (game.gear == GearState_Auto_N) {
+        neutralFrame.setCounter(counter4Bit);
+        sendFrame(neutralFrame);
+      }
+      checkControl.set(169, game.gear == GearState_Auto_N);
+      checkControl.set(203, game.gear == GearState_Auto_N);
+      break;
+
+    case FrameTask_FuelAndParkBrake:
+      sendFuel(game.fuelQuantity);
+      if (frameDirtyGroups & GameStateGroup_Body) {
+        sendParkBrake(game.handbrake);
+      } else {
+        resendFrame(parkBrakeFrame);
+      }
+      break;
 
-    sendFuel(game.fuelQuantity);
-    sendParkBrake(game.handbrake);
-    sendDistanceTravelled(mapSpeed(game));
-    sendAlerts(game, game.offroadLight);
-
-    // CC-ID 78: Vehicle Speed Limit Exceeded.
-    static bool lastOver160 = false;
-    const bool over160 = game.speed > 160;
-    if (over160 != lastOver160) {
-      uint8_t msg78[] = {
-        0x40, 78, 0x00, static_cast<uint8_t>(over160 ? 0x29 : 0x28),
-        0xFF, 0xFF, 0xFF, 0xFF
-      };
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg78);
-      lastOver160 = over160;
-    }
+    case FrameTask_Distance:
+      sendDistanceTravelled(mapSpeed(game));
+      break;
 
-    // Engine warning output uses state-change-only transmission.
-    static bool lastEngineLightState = false;
-    if (game.engineLight != lastEngineLightState) {
-      uint8_t msg50[] = {
-        0x40, 50, 0x00, static_cast<uint8_t>(game.engineLight ? 0x29 : 0x28),
-        0xFF, 0xFF, 0xFF, 0xFF
-      };
-      CAN.sendMsgBuf(0x5C0, 0, 8, msg50);
-      lastEngineLightState = game.engineLight;
-    }
+    case FrameTask_Alerts: {
+      sendAlerts(game, game.offroadLight);
 
-    // TPMS ECU keep-alive.
-    {
-      unsigned char tpmsWithoutCRC[] = {
-        static_cast<uint8_t>(0xF0 | counter4Bit), 0xA2, 0xA0, 0xA0
-      };
-      unsigned char tpmsWithCRC[] = {
-        crc8Calculator.get_crc8(tpmsWithoutCRC, 4, 0xC5),
-        tpmsWithoutCRC[0], tpmsWithoutCRC[1], tpmsWithoutCRC[2], tpmsWithoutCRC[3]
-      };
-      CAN.sendMsgBuf(0x369, 0, 5, tpmsWithCRC);
-    }
+      // CC-ID 78: Vehicle Speed Limit Exceeded.
+      checkControl.set(78, game.speed > 160);
 
-    if (game.ignition && millis() - ignitionOnTime < 3000) {
-      updateLanguageAndUnits();
+      // CC-ID 50: engine warning.
+      checkControl.set(50, game.engineLight);
+      break;
     }
 
-    counter4Bit++;
-    if (counter4Bit > 14) counter4Bit = 0;
-
-    count++;
-    if (count >= 254) count = 0;
-
-    lastDashboardUpdateTime = millis();
-  }
-
-  // Manual CC-ID injection for bench testing.
-  if (game.alertStart) {
-    uint8_t msg[] = {0x40, game.alertId, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xFF};
-    CAN.sendMsgBuf(0x5C0, 0, 8, msg);
-    game.alertStart = false;
-  }
-
-  if (game.alertClear) {
-    uint8_t msg[] = {0x40, game.alertId, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF};
-    CAN.sendMsgBuf(0x5C0, 0, 8, msg);
-    game.alertClear = false;
-  }
-
-  if (millis() - lastDashboardUpdateTimeLights >= dashboardUpdateTimeLights) {
-    sendLights(game.mainLights, game.highBeam, game.rearFogLight, game.frontFogLight);
-    sendBlinkers(game.leftTurningIndicator, game.rightTurningIndicator);
-    lastDashboardUpdateTimeLights = millis();
-  }
+    case FrameTask_Tpms:
+      // TPMS ECU keep-alive.
+      tpmsFrame.setCounter(counter4Bit);
+      sendFrame(tpmsFrame);
+      break;
+
+    case FrameTask_Lights:
+      sendLights(game.mainLights, game.highBeam, game.rearFogLight, game.frontFogLight);
+      break;
+
+    case FrameTask_Blinkers:
+      sendBlinkers(game.leftTurningIndicator, game.rightTurningIndicator);
+      break;
+
+    case FrameTask_Backlight:
+      sendBacklightBrightness(game.backlightBrightness);
+      break;
+
+    case FrameTask_DriveMode: {
+      uint8_t driveModeToSend = game.driveMode;
+      if (driveModeToSend != 1 && driveModeToSend != 2 && driveModeToSend != 4 &&
+          driveModeToSend != 5 && driveModeToSend != 6 && driveModeToSend != 7) {
+        driveModeToSend = 2;
+      }
+      sendDriveMode(driveModeToSend);
+      break;
+    }
 
-  if (millis() - lastDashboardUpdateTime1000ms >= dashboardUpdateTimeSlow) {
-    sendBacklightBrightness(game.backlightBrightness);
+    case FrameTask_OutsideTemperature:
+      sendOutsideTemperature(game.outdoorTemperature);
+      break;
 
-    uint8_t driveModeToSend = game.driveMode;
-    if (driveModeToSend != 1 && driveModeToSend != 2 && driveModeToSend != 4 &&
-        driveModeToSend != 5 && driveModeToSend != 6 && driveModeToSend != 7) {
-      driveModeToSend = 2;
+    case FrameTask_Time: {
+      const unsigned long totalSeconds = game.time / 1000UL;
+      const uint8_t hours = static_cast<uint8_t>((totalSeconds / 3600UL) % 24UL);
+      const uint8_t minutes = static_cast<uint8_t>((totalSeconds / 60UL) % 60UL);
+      sendTime(hours, minutes);
+      break;
     }
-    sendDriveMode(driveModeToSend);
 
-    sendOutsideTemperature(game.outdoorTemperature);
-    const unsigned long totalSeconds = game.time / 1000UL;
-    const uint8_t hours = static_cast<uint8_t>((totalSeconds / 3600UL) % 24UL);
-    const uint8_t minutes = static_cast<uint8_t>((totalSeconds / 60UL) % 60UL);
-    sendTime(hours, minutes);
+    case FrameTask_LanguageAndUnits:
+      updateLanguageAndUnits();
+      break;
 
-    updateLanguageAndUnits();
-    lastDashboardUpdateTime1000ms = millis();
+    default:
+      break;
   }
 }
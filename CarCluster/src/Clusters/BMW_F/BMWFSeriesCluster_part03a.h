@@ -1,14 +1,16 @@
   uint8_t ignitionStatus = ignition ? 0x8A : 0x8;
-  unsigned char ignitionWithoutCRC[] = { (uint8_t)(0x80|counter4Bit), ignitionStatus, 0xDD, 0xF1, 0x01, 0x30, 0x06 };
-  unsigned char ignitionWithCRC[] = { crc8Calculator.get_crc8(ignitionWithoutCRC, 7, 0x44), ignitionWithoutCRC[0], ignitionWithoutCRC[1], ignitionWithoutCRC[2], ignitionWithoutCRC[3], ignitionWithoutCRC[4], ignitionWithoutCRC[5], ignitionWithoutCRC[6] };
-  CAN.sendMsgBuf(0x12F, 0, 8, ignitionWithCRC);
+  ignitionFrame.setCounter(counter4Bit);
+  ignitionFrame.setByte(2, ignitionStatus);
+  sendFrame(ignitionFrame);
 }
 
 void BMWFSeriesCluster::sendSpeed(int speed) {
   uint16_t calculatedSpeed = (double)speed * 64.01;
-  unsigned char speedWithoutCRC[] = { (uint8_t)(0xC0|counter4Bit), lo8(calculatedSpeed), hi8(calculatedSpeed), (uint8_t)((speed == 0 ? 0x81 : 0x91)) };
-  unsigned char speedWithCRC[] = { crc8Calculator.get_crc8(speedWithoutCRC, 4, 0xA9), speedWithoutCRC[0], speedWithoutCRC[1], speedWithoutCRC[2], speedWithoutCRC[3] };
-  CAN.sendMsgBuf(0x1A1, 0, 5, speedWithCRC);
+  speedFrame.setCounter(counter4Bit);
+  speedFrame.setByte(2, lo8(calculatedSpeed));
+  speedFrame.setByte(3, hi8(calculatedSpeed));
+  speedFrame.setByte(4, (uint8_t)((speed == 0 ? 0x81 : 0x91)));
+  sendFrame(speedFrame);
 }
 
 void BMWFSeriesCluster::sendRPM(int rpm, int manualGear) {
@@ -32,35 +34,20 @@ void BMWFSeriesCluster::sendRPM(int rpm, int manualGear) {
   uint16_t rpmScaledPlus  = (uint16_t)((rpm + 4) * 1.557f);
   uint16_t rpmScaledMinus = (uint16_t)((rpm) * 1.557f);
 
-  // ===== Frame template =====
-  uint8_t rpmFrame[8] = {
-    0x00, // CRC placeholder
-    0x00, // LSB RPM
-    0x00, // MSB RPM
-    0xC0,
-    0xF0,
-    (uint8_t)calculatedGear,
-    0xFF,
-    0xFF
-  };
+  // ===== Frame templates: CRC, LSB RPM, MSB RPM, 0xC0, 0xF0, gear, 0xFF, 0xFF =====
+  // Each of the two frames keeps its own template so an unchanged RPM can be resent without any CRC work.
 
   // ---------- First frame (rpm + small offset) ----------
-  rpmFrame[1] = lo8(rpmScaledPlus);
-  rpmFrame[2] = hi8(rpmScaledPlus);
-
-  uint8_t crc1 = crc8Calculator.get_crc8(&rpmFrame[1], 7, 0x7A);
-  rpmFrame[0] = crc1;
-
-  CAN.sendMsgBuf(0x0F3, 0, 8, rpmFrame);
+  rpmOffsetFrame.setByte(1, lo8(rpmScaledPlus));
+  rpmOffsetFrame.setByte(2, hi8(rpmScaledPlus));
+  rpmOffsetFrame.setByte(5, (uint8_t)calculatedGear);
+  sendFrame(rpmOffsetFrame);
 
   // ---------- Second frame (real rpm) ----------
-  rpmFrame[1] = lo8(rpmScaledMinus);
-  rpmFrame[2] = hi8(rpmScaledMinus);
-
-  uint8_t crc2 = crc8Calculator.get_crc8(&rpmFrame[1], 7, 0x7A);
-  rpmFrame[0] = crc2;
-
-  CAN.sendMsgBuf(0x0F3, 0, 8, rpmFrame);
+  rpmFrame.setByte(5, (uint8_t)calculatedGear);
+  rpmFrame.setByte(1, lo8(rpmScaledMinus));
+  rpmFrame.setByte(2, hi8(rpmScaledMinus));
+  sendFrame(rpmFrame);
 }
 
 void BMWFSeriesCluster::sendAutomaticTransmission(GearState gear, uint8_t gearIndex) {
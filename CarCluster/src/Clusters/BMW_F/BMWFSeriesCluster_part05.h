@@ -1,17 +1,6 @@
-    lo8(distanceTravelledCounter),
-    hi8(distanceTravelledCounter),
-    0xF2
-  };
-
-  unsigned char mpg2WithCRC[] = {
-    crc8Calculator.get_crc8(mpg2WithoutCRC, 4, 0xDE),
-    mpg2WithoutCRC[0],
-    mpg2WithoutCRC[1],
-    mpg2WithoutCRC[2],
-    mpg2WithoutCRC[3]
-  };
-
-  CAN.sendMsgBuf(0x2BB, 0, 5, mpg2WithCRC);
+  mpg2Frame.setByte(2, lo8(distanceTravelledCounter));
+  mpg2Frame.setByte(3, hi8(distanceTravelledCounter));
+  sendFrame(mpg2Frame);
 }
 
 // ####################################################################################################################
@@ -51,53 +40,13 @@ void BMWFSeriesCluster::sendBacklightBrightness(uint8_t brightness) {
 }
 
 void BMWFSeriesCluster::sendAlerts(GameState& game, bool stabilityIntervention) {
-  static bool lastDoorFL = false;
-  static bool lastDoorFR = false;
-  static bool lastDoorRL = false;
-  static bool lastDoorRR = false;
-
-  if (game.doorFR != lastDoorFR) {
-    uint8_t msg[] = {0x40, 14, 0x00, static_cast<uint8_t>(game.doorFR ? 0x29 : 0x28), 0xFF, 0xFF, 0xFF, 0xFF};
-    CAN.sendMsgBuf(0x5C0, 0, 8, msg);
-    lastDoorFR = game.doorFR;
-  }
-
-  if (game.doorFL != lastDoorFL) {
-    uint8_t msg[] = {0x40, 15, 0x00, static_cast<uint8_t>(game.doorFL ? 0x29 : 0x28), 0xFF, 0xFF, 0xFF, 0xFF};
-    CAN.sendMsgBuf(0x5C0, 0, 8, msg);
-    lastDoorFL = game.doorFL;
-  }
-
-  if (game.doorRL != lastDoorRL) {
-    uint8_t msg[] = {0x40, 16, 0x00, static_cast<uint8_t>(game.doorRL ? 0x29 : 0x28), 0xFF, 0xFF, 0xFF, 0xFF};
-    CAN.sendMsgBuf(0x5C0, 0, 8, msg);
-    lastDoorRL = game.doorRL;
-  }
-
-  if (game.doorRR != lastDoorRR) {
-    uint8_t msg[] = {0x40, 17, 0x00, static_cast<uint8_t>(game.doorRR ? 0x29 : 0x28), 0xFF, 0xFF, 0xFF, 0xFF};
-    CAN.sendMsgBuf(0x5C0, 0, 8, msg);
-    lastDoorRR = game.doorRR;
-  }
-
-  uint8_t stabilityMessage[] = {
-    0x40, 215, 0x00, static_cast<uint8_t>(stabilityIntervention ? 0x29 : 0x28),
-    0xFF, 0xFF, 0xFF, 0xFF
-  };
-  CAN.sendMsgBuf(0x5C0, 0, 8, stabilityMessage);
-}
+  checkControl.set(14, game.doorFR);
+  checkControl.set(15, game.doorFL);
+  checkControl.set(16, game.doorRL);
+  checkControl.set(17, game.doorRR);
 
-void BMWFSeriesCluster::sendSteeringWheelButton(int buttonEvent) {
-  // BC/menu action only.
-  if (buttonEvent != 1) return;
-
-  uint8_t pressFrame[2] = {0x4C, 0xFF};
-  CAN.sendMsgBuf(0x1EE, 0, 2, pressFrame);
-
-  delay(40);
-
-  uint8_t releaseFrame[2] = {0x00, 0xFF};
-  CAN.sendMsgBuf(0x1EE, 0, 2, releaseFrame);
+  // Held cleared until the engine is stable, like the other stability warnings in sendBasicDriveInfo().
+  checkControl.set(215, stabilityIntervention && engineStable);
 }
 
 void BMWFSeriesCluster::updateLanguageAndUnits() {
@@ -120,15 +69,9 @@ void BMWFSeriesCluster::updateLanguageAndUnits() {
 }
 
 void BMWFSeriesCluster::sendDriveMode(uint8_t driveMode) {
-  unsigned char modeWithoutCRC[] = {
-    static_cast<uint8_t>(0xF0 | counter4Bit), 0, 0, driveMode, 0x11, 0xC0
-  };
-  unsigned char modeWithCRC[] = {
-    crc8Calculator.get_crc8(modeWithoutCRC, 6, 0x4A),
-    modeWithoutCRC[0], modeWithoutCRC[1], modeWithoutCRC[2],
-    modeWithoutCRC[3], modeWithoutCRC[4], modeWithoutCRC[5]
-  };
-  CAN.sendMsgBuf(0x3A7, 0, 7, modeWithCRC);
+  driveModeFrame.setCounter(counter4Bit);
+  driveModeFrame.setByte(4, driveMode);
+  sendFrame(driveModeFrame);
 }
 
 float BMWFSeriesCluster::mapRPMValueForFuelModel(int speed) {
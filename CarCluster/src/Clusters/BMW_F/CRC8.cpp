@@ -6,37 +6,40 @@
 
 #include "CRC8.h"
 
-CRC8::CRC8(void) {
-}
+namespace {
 
-void CRC8::begin(void) {
-  crc  remainder;
-    for (int dividend = 0; dividend < 256; ++dividend)
-    {
-        remainder = dividend << (WIDTH - 8);
-
-        for (uint8_t bit = 8; bit > 0; --bit)
-        {  
-            if (remainder & TOPBIT)
-            {
-                remainder = (remainder << 1) ^ POLYNOMIAL;
-            }
-            else
-            {
-                remainder = (remainder << 1);
-            }
-        }
-        crcTable[dividend] = remainder;
-    }
+constexpr crc crc8Remainder(crc remainder, uint8_t bit) {
+  return bit == 0 ? remainder
+                  : crc8Remainder((remainder & TOPBIT) ? static_cast<crc>((remainder << 1) ^ POLYNOMIAL)
+                                                       : static_cast<crc>(remainder << 1),
+                                  bit - 1);
 }
 
+}  // namespace
+
+#define CRC8_ENTRY(dividend) crc8Remainder(static_cast<crc>((dividend) << (WIDTH - 8)), 8)
+#define CRC8_ROW(row)                                                                                              \
+  CRC8_ENTRY(row + 0x0), CRC8_ENTRY(row + 0x1), CRC8_ENTRY(row + 0x2), CRC8_ENTRY(row + 0x3),                     \
+  CRC8_ENTRY(row + 0x4), CRC8_ENTRY(row + 0x5), CRC8_ENTRY(row + 0x6), CRC8_ENTRY(row + 0x7),                     \
+  CRC8_ENTRY(row + 0x8), CRC8_ENTRY(row + 0x9), CRC8_ENTRY(row + 0xA), CRC8_ENTRY(row + 0xB),                     \
+  CRC8_ENTRY(row + 0xC), CRC8_ENTRY(row + 0xD), CRC8_ENTRY(row + 0xE), CRC8_ENTRY(row + 0xF)
+
+static_assert(CRC8_ENTRY(0x01) == POLYNOMIAL, "CRC8 table generation changed");
+
+constexpr crc crc8Table[256] = {
+  CRC8_ROW(0x00), CRC8_ROW(0x10), CRC8_ROW(0x20), CRC8_ROW(0x30),
+  CRC8_ROW(0x40), CRC8_ROW(0x50), CRC8_ROW(0x60), CRC8_ROW(0x70),
+  CRC8_ROW(0x80), CRC8_ROW(0x90), CRC8_ROW(0xA0), CRC8_ROW(0xB0),
+  CRC8_ROW(0xC0), CRC8_ROW(0xD0), CRC8_ROW(0xE0), CRC8_ROW(0xF0)};
+
+#undef CRC8_ROW
+#undef CRC8_ENTRY
+
 crc CRC8::get_crc8(uint8_t const message[], int nBytes, uint8_t final) {
-  uint8_t data;
   crc remainder = 0xFF;
 
   for (int byte = 0; byte < nBytes; ++byte) {
-      data = message[byte] ^ (remainder >> (WIDTH - 8));
-      remainder = crcTable[data] ^ (remainder << 8);
+      remainder = crc8Table[message[byte] ^ remainder];
   }
 	remainder = remainder^final;
    
@@ -20,14 +20,24 @@ typedef uint8_t crc;
 #define WIDTH (8 * sizeof(crc))
 #define TOPBIT (1 << (WIDTH - 1))
 
+// Generated by the compiler in CRC8.cpp and placed in flash (.rodata); nothing is built at startup.
+extern const crc crc8Table[256];
+
 class CRC8 {
 	public:
-	  CRC8();
-	  void begin();
-	  crc get_crc8(uint8_t const message[], int nBytes, uint8_t final);
-	 
-	private:
-	  uint8_t crcTable[256];
+	  // Any length and final XOR.
+	  static crc get_crc8(uint8_t const message[], int nBytes, uint8_t final);
+
+	  // Fixed length and final XOR, instantiated once per F10 frame layout so the compiler can unroll the loop.
+	  template <uint8_t nBytes, uint8_t final>
+	  static crc get_crc8(uint8_t const message[]) {
+	    crc remainder = 0xFF;
+#pragma GCC unroll 8
+	    for (uint8_t byte = 0; byte < nBytes; ++byte) {
+	      remainder = crc8Table[message[byte] ^ remainder];
+	    }
+	    return remainder ^ final;
+	  }
 };
 
 #endif
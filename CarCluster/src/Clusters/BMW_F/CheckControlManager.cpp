@@ -0,0 +1,105 @@
+// ####################################################################################################################
+// BMW F10 Check-Control message manager
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// Better_CAN: https://github.com/JackieZ123430/Better_CAN
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "CheckControlManager.h"
+
+namespace {
+
+const unsigned long kNothingDue = 0xFFFF;
+
+}  // namespace
+
+void CheckControlManager::assign(uint32_t* bits, uint8_t id, bool value) {
+  const uint32_t mask = 1UL << (id & 31);
+  if (value) {
+    bits[id >> 5] |= mask;
+  } else {
+    bits[id >> 5] &= ~mask;
+  }
+}
+
+void CheckControlManager::set(uint8_t id, bool active) {
+  if (!test(managed, id)) {
+    assign(managed, id, true);
+    assign(forced, id, true);
+  }
+  assign(desired, id, active);
+}
+
+void CheckControlManager::release(uint8_t id) {
+  if (test(injected, id)) return;
+  assign(managed, id, false);
+  assign(forced, id, false);
+}
+
+void CheckControlManager::inject(uint8_t id, bool active) {
+  assign(managed, id, true);
+  assign(forced, id, true);
+  assign(injected, id, true);
+  assign(injectedState, id, active);
+}
+
+bool CheckControlManager::wanted(uint8_t id) const {
+  return test(injected, id) ? test(injectedState, id) : test(desired, id);
+}
+
+void CheckControlManager::service(unsigned long now) {
+  enqueueChanges();
+
+  if (frameSent && now - lastFrameTime < CHECK_CONTROL_FRAME_INTERVAL_MS) return;
+
+  while (queueLength > 0) {
+    const uint8_t id = queue[queueHead++];
+    queueLength--;
+    assign(queued, id, false);
+
+    // Skip CC-IDs released or switched back to the transmitted state while they waited.
+    if (!test(managed, id)) continue;
+    if (wanted(id) == test(transmitted, id) && !test(forced, id)) continue;
+
+    send(id);
+    lastFrameTime = now;
+    return;
+  }
+}
+
+unsigned long CheckControlManager::millisUntilNextFrame(unsigned long now) const {
+  if (queueLength == 0) return kNothingDue;
+  return frameSent && now - lastFrameTime < CHECK_CONTROL_FRAME_INTERVAL_MS
+             ? CHECK_CONTROL_FRAME_INTERVAL_MS - (now - lastFrameTime)
+             : 0;
+}
+
+void CheckControlManager::enqueueChanges() {
+  for (uint8_t word = 0; word < CHECK_CONTROL_BITMAP_WORDS; word++) {
+    const uint32_t wantedWord = (desired[word] & ~injected[word]) | (injectedState[word] & injected[word]);
+    uint32_t changed = ((wantedWord ^ transmitted[word]) | forced[word]) & managed[word] & ~queued[word];
+    while (changed != 0) {
+      const uint8_t bit = static_cast<uint8_t>(__builtin_ctz(changed));
+      changed &= changed - 1;
+
+      queue[static_cast<uint8_t>(queueHead + queueLength)] = static_cast<uint8_t>(word * 32 + bit);
+      queueLength++;
+      queued[word] |= 1UL << bit;
+    }
+  }
+}
+
+void CheckControlManager::send(uint8_t id) {
+  const bool active = wanted(id);
+  uint8_t frame[8] = {0x40, id, 0x00, static_cast<uint8_t>(active ? 0x29 : 0x28), 0xFF, 0xFF, 0xFF, 0xFF};
+  CAN.sendMsgBuf(CHECK_CONTROL_CAN_ID, 0, 8, frame);
+
+  assign(transmitted, id, active);
+  assign(forced, id, false);
+  // A cleared injection hands the CC-ID back to set().
+  if (test(injected, id) && !active) assign(injected, id, false);
+  frameSent = true;
+}
@@ -0,0 +1,82 @@
+// ####################################################################################################################
+// BMW F10 Check-Control message manager
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// Better_CAN: https://github.com/JackieZ123430/Better_CAN
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Every Check-Control warning is one CC-ID (0-255) switched on or off by an 8-byte frame on 0x5C0. The cluster code
+// only declares the state it wants with set(); the manager keeps 256-bit bitmaps of the wanted and the last
+// transmitted states, diffs them once per service() call and queues every CC-ID that differs. The queue drains one
+// frame per CHECK_CONTROL_FRAME_INTERVAL_MS, so several warnings raised in the same tick (doors, tyres, engine) are
+// spread out instead of hitting the bus together, and a state that flips back before its turn costs no frame.
+//
+// Nothing is re-sent while the states agree: re-activating a CC-ID can bring its popup back. release() stops managing
+// a CC-ID without sending anything, leaving it to the cluster.
+//
+// inject() is the bench-test path and overrides whatever the cluster code declares for the CC-ID. An injected
+// activation holds until it is cleared; the clear frame is sent and the CC-ID then goes back to its declared state.
+// ####################################################################################################################
+
+#ifndef BMW_F10_CHECK_CONTROL_MANAGER_H
+#define BMW_F10_CHECK_CONTROL_MANAGER_H
+
+#include "Arduino.h"
+#include "../../Libs/MCP_CAN/mcp_can.h"
+
+#ifndef CHECK_CONTROL_FRAME_INTERVAL_MS
+#define CHECK_CONTROL_FRAME_INTERVAL_MS 10
+#endif
+
+#define CHECK_CONTROL_CAN_ID 0x5C0
+#define CHECK_CONTROL_BITMAP_WORDS 8
+
+class CheckControlManager {
+ public:
+  explicit CheckControlManager(MCP_CAN& can) : CAN(can) {}
+
+  // Declares the wanted state of a CC-ID. The first call for a CC-ID always sends it once.
+  void set(uint8_t id, bool active);
+  void release(uint8_t id);
+  // State declared with set(), whatever inject() overrides it with.
+  bool isActive(uint8_t id) const { return test(desired, id); }
+
+  // Sends the CC-ID with the given state ahead of the declared one; see above.
+  void inject(uint8_t id, bool active);
+
+  // Queues the CC-IDs whose wanted state differs from the transmitted one and sends at most one frame.
+  void service(unsigned long now);
+  unsigned long millisUntilNextFrame(unsigned long now) const;
+  uint16_t pendingCount() const { return queueLength; }
+
+ private:
+  static bool test(const uint32_t* bits, uint8_t id) { return (bits[id >> 5] >> (id & 31)) & 1; }
+  static void assign(uint32_t* bits, uint8_t id, bool value);
+
+  bool wanted(uint8_t id) const;
+  void enqueueChanges();
+  void send(uint8_t id);
+
+  MCP_CAN& CAN;
+
+  uint32_t desired[CHECK_CONTROL_BITMAP_WORDS] = {};
+  uint32_t transmitted[CHECK_CONTROL_BITMAP_WORDS] = {};
+  uint32_t managed[CHECK_CONTROL_BITMAP_WORDS] = {};
+  // Sent on their next turn even when unchanged: newly managed and injected CC-IDs.
+  uint32_t forced[CHECK_CONTROL_BITMAP_WORDS] = {};
+  uint32_t injected[CHECK_CONTROL_BITMAP_WORDS] = {};
+  uint32_t injectedState[CHECK_CONTROL_BITMAP_WORDS] = {};
+  uint32_t queued[CHECK_CONTROL_BITMAP_WORDS] = {};
+
+  // A CC-ID is queued at most once, so 256 entries never overflow.
+  uint8_t queue[256];
+  uint8_t queueHead = 0;
+  uint16_t queueLength = 0;
+
+  bool frameSent = false;
+  unsigned long lastFrameTime = 0;
+};
+
+#endif
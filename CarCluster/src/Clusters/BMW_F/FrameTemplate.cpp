@@ -0,0 +1,57 @@
+// ####################################################################################################################
+// BMW F10 CRC-protected frame template
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// Better_CAN: https://github.com/JackieZ123430/Better_CAN
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "FrameTemplate.h"
+
+void FrameTemplate::begin(uint32_t id, uint8_t length, CrcFunction crcFunction, const uint8_t payload[]) {
+  this->crcFunction = crcFunction;
+  canId = id;
+  frameLength = length;
+
+  memset(data, 0, sizeof(data));
+  memcpy(&data[1], payload, length - 1);
+
+  // Linear part of the CRC for each counter nibble: crc(nibble in byte 1, rest zero) ^ crc(all zero).
+  uint8_t probe[7] = {};
+  const uint8_t zeroCrc = CRC8::get_crc8(probe, length - 1, 0);
+  for (uint8_t counter = 0; counter < 16; counter++) {
+    probe[0] = counter;
+    counterCrcDelta[counter] = CRC8::get_crc8(probe, length - 1, 0) ^ zeroCrc;
+  }
+
+  crcValid = false;
+}
+
+void FrameTemplate::setBits(uint8_t index, uint8_t mask, uint8_t value) {
+  if (index == 0 || index >= frameLength) return;
+
+  const uint8_t patched = static_cast<uint8_t>((data[index] & ~mask) | (value & mask));
+  if (patched == data[index]) return;
+
+  data[index] = patched;
+  crcValid = false;
+}
+
+void FrameTemplate::setCounter(uint8_t counter) {
+  const uint8_t oldCounter = data[1] & 0x0F;
+  const uint8_t newCounter = counter & 0x0F;
+  if (oldCounter == newCounter) return;
+
+  data[1] = static_cast<uint8_t>((data[1] & 0xF0) | newCounter);
+  if (crcValid) data[0] ^= counterCrcDelta[oldCounter] ^ counterCrcDelta[newCounter];
+}
+
+const uint8_t* FrameTemplate::frame() {
+  if (!crcValid) {
+    data[0] = crcFunction(&data[1]);
+    crcValid = true;
+  }
+  return data;
+}
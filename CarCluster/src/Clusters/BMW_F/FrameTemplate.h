@@ -0,0 +1,53 @@
+// ####################################################################################################################
+// BMW F10 CRC-protected frame template
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// Better_CAN: https://github.com/JackieZ123430/Better_CAN
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// F-series chassis frames carry a CRC8 in byte 0 over bytes 1..n-1 and a 4-bit alive counter in the low nibble of
+// byte 1. A template keeps the complete frame between sends so only the changed bytes are patched. The CRC is
+// affine over GF(2), so a counter step is applied by XOR-ing in two entries of a 16-entry table built in begin();
+// any other byte change marks the CRC stale and it is recomputed once on the next frame() call, using the CRC8
+// specialisation for that frame's length and final XOR.
+// ####################################################################################################################
+
+#ifndef BMW_F10_FRAME_TEMPLATE_H
+#define BMW_F10_FRAME_TEMPLATE_H
+
+#include "Arduino.h"
+#include "CRC8.h"
+
+class FrameTemplate {
+ public:
+  // payload holds bytes 1..length-1 of the frame; byte 0 is the CRC.
+  template <uint8_t length, uint8_t finalXor>
+  void begin(uint32_t id, const uint8_t payload[]) {
+    static_assert(length >= 2 && length <= 8, "F10 CRC frames are 2 to 8 bytes long");
+    begin(id, length, &CRC8::get_crc8<length - 1, finalXor>, payload);
+  }
+
+  void setByte(uint8_t index, uint8_t value) { setBits(index, 0xFF, value); }
+  void setBits(uint8_t index, uint8_t mask, uint8_t value);
+  void setCounter(uint8_t counter);
+
+  const uint8_t* frame();
+  uint32_t id() const { return canId; }
+  uint8_t length() const { return frameLength; }
+
+ private:
+  typedef crc (*CrcFunction)(uint8_t const message[]);
+
+  void begin(uint32_t id, uint8_t length, CrcFunction crcFunction, const uint8_t payload[]);
+
+  CrcFunction crcFunction = nullptr;
+  uint32_t canId = 0;
+  uint8_t frameLength = 0;
+  bool crcValid = false;
+  uint8_t data[8] = {};
+  uint8_t counterCrcDelta[16] = {};
+};
+
+#endif
@@ -0,0 +1,93 @@
+// ####################################################################################################################
+// BMW F10 steering-wheel button sequencer
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// Better_CAN: https://github.com/JackieZ123430/Better_CAN
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "SteeringButtonSequencer.h"
+
+namespace {
+
+const unsigned long kNothingDue = 0xFFFF;
+
+unsigned long remaining(unsigned long start, unsigned long period, unsigned long now) {
+  const unsigned long elapsed = now - start;
+  return elapsed >= period ? 0 : period - elapsed;
+}
+
+}  // namespace
+
+uint16_t SteeringButtonSequencer::durationOf(uint8_t action) {
+  switch (action) {
+    case SteeringButtonAction_Press: return STEERING_BUTTON_PRESS_MS;
+    case SteeringButtonAction_Hold: return STEERING_BUTTON_HOLD_MS;
+    case SteeringButtonAction_LongPress: return STEERING_BUTTON_LONG_PRESS_MS;
+    default: return 0;
+  }
+}
+
+bool SteeringButtonSequencer::queue(int action) {
+  if (action < 0 || action > 0xFF || durationOf(static_cast<uint8_t>(action)) == 0) return false;
+  if (queueLength >= STEERING_BUTTON_QUEUE_SIZE) return false;
+
+  actions[(queueHead + queueLength) % STEERING_BUTTON_QUEUE_SIZE] = static_cast<uint8_t>(action);
+  queueLength++;
+  return true;
+}
+
+void SteeringButtonSequencer::service(unsigned long now) {
+  if (state == State_Pressed) {
+    if (now - stateStart >= pressDuration) {
+      sendRelease(now);
+    } else if (now - lastPressFrame >= STEERING_BUTTON_REPEAT_MS) {
+      sendPress(now);
+    }
+    return;
+  }
+
+  if (state == State_Gap) {
+    if (now - stateStart < STEERING_BUTTON_GAP_MS) return;
+    state = State_Idle;
+  }
+
+  if (queueLength == 0) return;
+
+  pressDuration = durationOf(actions[queueHead]);
+  queueHead = (queueHead + 1) % STEERING_BUTTON_QUEUE_SIZE;
+  queueLength--;
+
+  state = State_Pressed;
+  stateStart = now;
+  sendPress(now);
+}
+
+unsigned long SteeringButtonSequencer::millisUntilNextFrame(unsigned long now) const {
+  switch (state) {
+    case State_Pressed: {
+      const unsigned long release = remaining(stateStart, pressDuration, now);
+      const unsigned long repeat = remaining(lastPressFrame, STEERING_BUTTON_REPEAT_MS, now);
+      return release < repeat ? release : repeat;
+    }
+    case State_Gap:
+      return queueLength > 0 ? remaining(stateStart, STEERING_BUTTON_GAP_MS, now) : kNothingDue;
+    default:
+      return queueLength > 0 ? 0 : kNothingDue;
+  }
+}
+
+void SteeringButtonSequencer::sendPress(unsigned long now) {
+  uint8_t pressFrame[2] = {0x4C, 0xFF};
+  CAN.sendMsgBuf(0x1EE, 0, 2, pressFrame);
+  lastPressFrame = now;
+}
+
+void SteeringButtonSequencer::sendRelease(unsigned long now) {
+  uint8_t releaseFrame[2] = {0x00, 0xFF};
+  CAN.sendMsgBuf(0x1EE, 0, 2, releaseFrame);
+  state = State_Gap;
+  stateStart = now;
+}
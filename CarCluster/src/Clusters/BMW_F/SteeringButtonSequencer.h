@@ -0,0 +1,63 @@
+// ####################################################################################################################
+// BMW F10 steering-wheel button sequencer
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// Better_CAN: https://github.com/JackieZ123430/Better_CAN
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Plays BC/menu button actions on 0x1EE without blocking: service() sends the press frame, repeats it every
+// STEERING_BUTTON_REPEAT_MS while the button is held, and sends the release once the action's duration has passed.
+// Queued actions follow each other with STEERING_BUTTON_GAP_MS released in between so the cluster sees separate
+// presses. Only the press and release frames come from here; every other frame keeps its schedule meanwhile.
+// ####################################################################################################################
+
+#ifndef BMW_F10_STEERING_BUTTON_SEQUENCER_H
+#define BMW_F10_STEERING_BUTTON_SEQUENCER_H
+
+#include "Arduino.h"
+#include "../../Libs/MCP_CAN/mcp_can.h"
+#include "../../Games/GameSimulation.h"
+
+#define STEERING_BUTTON_QUEUE_SIZE 8
+#define STEERING_BUTTON_PRESS_MS 40
+#define STEERING_BUTTON_HOLD_MS 1000
+#define STEERING_BUTTON_LONG_PRESS_MS 3000
+#define STEERING_BUTTON_REPEAT_MS 100
+#define STEERING_BUTTON_GAP_MS 100
+
+class SteeringButtonSequencer {
+ public:
+  explicit SteeringButtonSequencer(MCP_CAN& can) : CAN(can) {}
+
+  // Returns false when the action is unknown or the queue is full.
+  bool queue(int action);
+  void service(unsigned long now);
+  unsigned long millisUntilNextFrame(unsigned long now) const;
+  bool busy() const { return state != State_Idle || queueLength > 0; }
+
+ private:
+  enum State : uint8_t {
+    State_Idle,
+    State_Pressed,
+    State_Gap,
+  };
+
+  static uint16_t durationOf(uint8_t action);
+  void sendPress(unsigned long now);
+  void sendRelease(unsigned long now);
+
+  MCP_CAN& CAN;
+
+  uint8_t actions[STEERING_BUTTON_QUEUE_SIZE];
+  uint8_t queueHead = 0;
+  uint8_t queueLength = 0;
+
+  State state = State_Idle;
+  unsigned long stateStart = 0;
+  unsigned long lastPressFrame = 0;
+  uint16_t pressDuration = 0;
+};
+
+#endif
@@ -135,133 +135,275 @@ GearState decodeGear(char gearLetter, uint8_t gearIndex) {
   }
 }
 
-bool packetShowsEngineFault(const BetterCANPacket& data) {
-  return data.checkengine ||
-         data.engineImpactDamage ||
-         data.radiatorLeak ||
-         data.oilpanLeak ||
-         data.oilRadiatorLeak ||
-         data.exhaustBroken ||
-         data.mainEngineBroken ||
-         data.gearboxBroken ||
-         data.engineDisabled ||
-         data.engineLockedUp ||
-         data.engineReducedTorque ||
-         data.coolantOverheating ||
-         data.oilOverheating;
+// Byte offsets of the fields the F10 cluster consumes, so both packet layouts are decoded in place from the UDP
+// buffer without copying them into a struct first. kFieldAbsent marks fields a layout does not carry; they read as
+// zero, like the zero-filled fields of the old legacy-to-current expansion.
+const uint8_t kFieldAbsent = 0xFF;
+static_assert(sizeof(BetterCANPacket) < kFieldAbsent, "Better_CAN offsets no longer fit in uint8_t");
+
+const uint8_t kEngineFaultFieldCount = 13;
+
+struct BetterCANLayout {
+  uint8_t time;
+  uint8_t speedKmh;
+  uint8_t rpm;
+  uint8_t gearLetter;
+  uint8_t gearIndex;
+  uint8_t ignition;
+  uint8_t engineRunning;
+  uint8_t doorFL;
+  uint8_t doorFR;
+  uint8_t doorRL;
+  uint8_t doorRR;
+  uint8_t trunkOpen;
+  uint8_t hoodOpen;
+  uint8_t parkingBrake;
+  uint8_t absActive;
+  uint8_t isABSBrakeActive;
+  uint8_t escAvailable;
+  uint8_t escActive;
+  uint8_t tcsAvailable;
+  uint8_t tcsActive;
+  uint8_t hasESC;
+  uint8_t hasTCS;
+  uint8_t isTCBrakeActive;
+  uint8_t isYCBrakeActive;
+  uint8_t driveMode;
+  uint8_t highBeam;
+  uint8_t lowBeam;
+  uint8_t fog;
+  uint8_t signalL;
+  uint8_t signalR;
+  uint8_t hazard;
+  uint8_t brakelights;
+  uint8_t battery;
+  uint8_t oil;
+  uint8_t oilLevelCritical;
+  uint8_t starvedOfOil;
+  uint8_t lowfuel;
+  uint8_t fuel;
+  uint8_t waterTemp;
+  uint8_t oilTemp;
+  uint8_t tireDefFL;
+  uint8_t tireDefFR;
+  uint8_t tireDefRL;
+  uint8_t tireDefRR;
+  uint8_t engineFaults[kEngineFaultFieldCount];
+};
+
+#define BETTER_CAN_OFFSET(packet, field) static_cast<uint8_t>(offsetof(packet, field))
+
+// Fields present at possibly different offsets in both layouts.
+template <typename Packet>
+BetterCANLayout commonLayout() {
+  BetterCANLayout layout;
+  memset(&layout, kFieldAbsent, sizeof(layout));
+
+  layout.time = BETTER_CAN_OFFSET(Packet, time);
+  layout.speedKmh = BETTER_CAN_OFFSET(Packet, speedKmh);
+  layout.rpm = BETTER_CAN_OFFSET(Packet, rpm);
+  layout.gearLetter = BETTER_CAN_OFFSET(Packet, gearLetter);
+  layout.gearIndex = BETTER_CAN_OFFSET(Packet, gearIndex);
+  layout.ignition = BETTER_CAN_OFFSET(Packet, ignition);
+  layout.engineRunning = BETTER_CAN_OFFSET(Packet, engineRunning);
+  layout.doorFL = BETTER_CAN_OFFSET(Packet, doorFL);
+  layout.doorFR = BETTER_CAN_OFFSET(Packet, doorFR);
+  layout.doorRL = BETTER_CAN_OFFSET(Packet, doorRL);
+  layout.doorRR = BETTER_CAN_OFFSET(Packet, doorRR);
+  layout.parkingBrake = BETTER_CAN_OFFSET(Packet, parkingBrake);
+  layout.absActive = BETTER_CAN_OFFSET(Packet, absActive);
+  layout.isABSBrakeActive = BETTER_CAN_OFFSET(Packet, isABSBrakeActive);
+  layout.escAvailable = BETTER_CAN_OFFSET(Packet, escAvailable);
+  layout.escActive = BETTER_CAN_OFFSET(Packet, escActive);
+  layout.tcsAvailable = BETTER_CAN_OFFSET(Packet, tcsAvailable);
+  layout.tcsActive = BETTER_CAN_OFFSET(Packet, tcsActive);
+  layout.hasESC = BETTER_CAN_OFFSET(Packet, hasESC);
+  layout.hasTCS = BETTER_CAN_OFFSET(Packet, hasTCS);
+  layout.isTCBrakeActive = BETTER_CAN_OFFSET(Packet, isTCBrakeActive);
+  layout.isYCBrakeActive = BETTER_CAN_OFFSET(Packet, isYCBrakeActive);
+  layout.highBeam = BETTER_CAN_OFFSET(Packet, highBeam);
+  layout.lowBeam = BETTER_CAN_OFFSET(Packet, lowBeam);
+  layout.fog = BETTER_CAN_OFFSET(Packet, fog);
+  layout.signalL = BETTER_CAN_OFFSET(Packet, signalL);
+  layout.signalR = BETTER_CAN_OFFSET(Packet, signalR);
+  layout.hazard = BETTER_CAN_OFFSET(Packet, hazard);
+  layout.brakelights = BETTER_CAN_OFFSET(Packet, brakelights);
+  layout.battery = BETTER_CAN_OFFSET(Packet, battery);
+  layout.oil = BETTER_CAN_OFFSET(Packet, oil);
+  layout.lowfuel = BETTER_CAN_OFFSET(Packet, lowfuel);
+  layout.fuel = BETTER_CAN_OFFSET(Packet, fuel);
+  layout.waterTemp = BETTER_CAN_OFFSET(Packet, waterTemp);
+  layout.oilTemp = BETTER_CAN_OFFSET(Packet, oilTemp);
+  layout.tireDefFL = BETTER_CAN_OFFSET(Packet, tireDefFL);
+  layout.tireDefFR = BETTER_CAN_OFFSET(Packet, tireDefFR);
+  layout.tireDefRL = BETTER_CAN_OFFSET(Packet, tireDefRL);
+  layout.tireDefRR = BETTER_CAN_OFFSET(Packet, tireDefRR);
+  layout.engineFaults[0] = BETTER_CAN_OFFSET(Packet, checkengine);
+
+  return layout;
+}
+
+BetterCANLayout currentLayout() {
+  BetterCANLayout layout = commonLayout<BetterCANPacket>();
+
+  layout.trunkOpen = BETTER_CAN_OFFSET(BetterCANPacket, trunkOpen);
+  layout.hoodOpen = BETTER_CAN_OFFSET(BetterCANPacket, hoodOpen);
+  layout.driveMode = BETTER_CAN_OFFSET(BetterCANPacket, driveMode);
+  layout.oilLevelCritical = BETTER_CAN_OFFSET(BetterCANPacket, oilLevelCritical);
+  layout.starvedOfOil = BETTER_CAN_OFFSET(BetterCANPacket, starvedOfOil);
+
+  layout.engineFaults[1] = BETTER_CAN_OFFSET(BetterCANPacket, engineImpactDamage);
+  layout.engineFaults[2] = BETTER_CAN_OFFSET(BetterCANPacket, radiatorLeak);
+  layout.engineFaults[3] = BETTER_CAN_OFFSET(BetterCANPacket, oilpanLeak);
+  layout.engineFaults[4] = BETTER_CAN_OFFSET(BetterCANPacket, oilRadiatorLeak);
+  layout.engineFaults[5] = BETTER_CAN_OFFSET(BetterCANPacket, exhaustBroken);
+  layout.engineFaults[6] = BETTER_CAN_OFFSET(BetterCANPacket, mainEngineBroken);
+  layout.engineFaults[7] = BETTER_CAN_OFFSET(BetterCANPacket, gearboxBroken);
+  layout.engineFaults[8] = BETTER_CAN_OFFSET(BetterCANPacket, engineDisabled);
+  layout.engineFaults[9] = BETTER_CAN_OFFSET(BetterCANPacket, engineLockedUp);
+  layout.engineFaults[10] = BETTER_CAN_OFFSET(BetterCANPacket, engineReducedTorque);
+  layout.engineFaults[11] = BETTER_CAN_OFFSET(BetterCANPacket, coolantOverheating);
+  layout.engineFaults[12] = BETTER_CAN_OFFSET(BetterCANPacket, oilOverheating);
+
+  return layout;
+}
+
+#undef BETTER_CAN_OFFSET
+
+const BetterCANLayout kCurrentLayout = currentLayout();
+const BetterCANLayout kLegacyLayout = commonLayout<LegacyBetterCANPacket>();
+
+uint8_t readByte(const uint8_t* data, uint8_t offset) {
+  return offset == kFieldAbsent ? 0 : data[offset];
 }
 
-BetterCANPacket expandLegacyPacket(const LegacyBetterCANPacket& legacy) {
-  BetterCANPacket data{};
-
-  data.time = legacy.time;
-  data.speedKmh = legacy.speedKmh;
-  data.rpm = legacy.rpm;
-  data.gearLetter = legacy.gearLetter;
-  data.gearIndex = legacy.gearIndex;
-  data.ignition = legacy.ignition;
-  data.engineRunning = legacy.engineRunning;
-  data.doorFL = legacy.doorFL;
-  data.doorFR = legacy.doorFR;
-  data.doorRL = legacy.doorRL;
-  data.doorRR = legacy.doorRR;
-  data.parkingBrake = legacy.parkingBrake;
-  data.absAvailable = legacy.absAvailable;
-  data.absActive = legacy.absActive;
-  data.escAvailable = legacy.escAvailable;
-  data.escActive = legacy.escActive;
-  data.tcsAvailable = legacy.tcsAvailable;
-  data.tcsActive = legacy.tcsActive;
-  data.abs = legacy.abs;
-  data.isABSBrakeActive = legacy.isABSBrakeActive;
-  data.hasABS = legacy.hasABS;
-  data.hasESC = legacy.hasESC;
-  data.hasTCS = legacy.hasTCS;
-  data.esc = legacy.esc;
-  data.tcs = legacy.tcs;
-  data.isTCBrakeActive = legacy.isTCBrakeActive;
-  data.isYCBrakeActive = legacy.isYCBrakeActive;
-  data.highBeam = legacy.highBeam;
-  data.lowBeam = legacy.lowBeam;
-  data.fog = legacy.fog;
-  data.signalL = legacy.signalL;
-  data.signalR = legacy.signalR;
-  data.hazard = legacy.hazard;
-  data.brakelights = legacy.brakelights;
-  data.battery = legacy.battery;
-  data.oil = legacy.oil;
-  data.checkengine = legacy.checkengine;
-  data.lowfuel = legacy.lowfuel;
-  data.fuel = legacy.fuel;
-  data.waterTemp = legacy.waterTemp;
-  data.oilTemp = legacy.oilTemp;
-  data.tireDefFL = legacy.tireDefFL;
-  data.tireDefFR = legacy.tireDefFR;
-  data.tireDefRL = legacy.tireDefRL;
-  data.tireDefRR = legacy.tireDefRR;
-  data.airspeedKmh = legacy.airspeedKmh;
-
-  return data;
+bool readFlag(const uint8_t* data, uint8_t offset) {
+  return readByte(data, offset) != 0;
 }
 
-void applyPacketToGameState(GameState& gameState, const BetterCANPacket& data) {
-  gameState.time = data.time;
-  gameState.speed = static_cast<int>(roundf(clampFloat(finiteOr(data.speedKmh, 0.0f), 0.0f, 400.0f)));
-  gameState.rpm = static_cast<int>(roundf(clampFloat(finiteOr(data.rpm, 0.0f), 0.0f, 12000.0f)));
-
-  gameState.gearLetter = data.gearLetter;
-  gameState.gearIndex = data.gearIndex <= 8 ? data.gearIndex : 0;
-  gameState.gear = decodeGear(data.gearLetter, gameState.gearIndex);
-
-  gameState.ignition = data.ignition != 0;
-  gameState.engineRunning = data.engineRunning != 0;
-
-  gameState.doorFL = data.doorFL != 0;
-  gameState.doorFR = data.doorFR != 0;
-  gameState.doorRL = data.doorRL != 0;
-  gameState.doorRR = data.doorRR != 0;
-  gameState.trunkOpen = data.trunkOpen != 0;
-  gameState.hoodOpen = data.hoodOpen != 0;
-  gameState.doorOpen = gameState.doorFL || gameState.doorFR || gameState.doorRL ||
-                       gameState.doorRR || gameState.trunkOpen || gameState.hoodOpen;
-
-  gameState.handbrake = data.parkingBrake != 0;
-  gameState.absLight = data.absActive != 0 || data.isABSBrakeActive != 0;
-  gameState.escActive = data.escActive != 0 || data.isYCBrakeActive != 0;
-  gameState.tcsActive = data.tcsActive != 0 || data.isTCBrakeActive != 0;
-  gameState.hasESC = data.hasESC != 0 || data.escAvailable != 0;
-  gameState.hasTCS = data.hasTCS != 0 || data.tcsAvailable != 0;
-  gameState.offroadLight = gameState.escActive || gameState.tcsActive;
-
-  gameState.driveMode = mapBetterCanDriveMode(data.driveMode);
-  gameState.escDisabled = gameState.driveMode == 6;
-
-  gameState.highBeam = data.highBeam != 0;
-  gameState.mainLights = data.lowBeam != 0 || data.highBeam;
-  gameState.frontFogLight = data.fog != 0;
-  gameState.leftTurningIndicator = data.signalL != 0;
-  gameState.rightTurningIndicator = data.signalR != 0;
-  gameState.turningIndicatorsBlinking = data.signalL != 0 || data.signalR != 0 || data.hazard != 0;
-  gameState.brakeLights = data.brakelights != 0;
-
-  gameState.batteryLight = data.battery != 0;
-  gameState.oilLight = data.oil != 0 || data.oilLevelCritical != 0 || data.starvedOfOil != 0;
-  gameState.engineLight = packetShowsEngineFault(data);
-
-  gameState.fuelQuantity = clampFloat(finiteOr(data.fuel, 0.0f), 0.0f, 100.0f);
-  gameState.lowFuelLight = data.lowfuel != 0 || gameState.fuelQuantity <= 10.0f;
-  gameState.coolantTemperature = static_cast<int>(roundf(clampFloat(finiteOr(data.waterTemp, 0.0f), -50.0f, 250.0f)));
-  gameState.oilTemperature = static_cast<int>(roundf(clampFloat(finiteOr(data.oilTemp, 0.0f), -50.0f, 250.0f)));
-
-  gameState.tireDefFL = data.tireDefFL != 0;
-  gameState.tireDefFR = data.tireDefFR != 0;
-  gameState.tireDefRL = data.tireDefRL != 0;
-  gameState.tireDefRR = data.tireDefRR != 0;
+float readFloat(const uint8_t* data, uint8_t offset) {
+  float value = 0.0f;
+  if (offset != kFieldAbsent) memcpy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+uint32_t readUInt32(const uint8_t* data, uint8_t offset) {
+  uint32_t value = 0;
+  if (offset != kFieldAbsent) memcpy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+bool packetShowsEngineFault(const uint8_t* data, const BetterCANLayout& layout) {
+  for (uint8_t i = 0; i < kEngineFaultFieldCount; i++) {
+    if (readFlag(data, layout.engineFaults[i])) return true;
+  }
+  return false;
+}
+
+void applyPacketToGameState(GameState& gameState, const uint8_t* data, const BetterCANLayout& layout) {
+  // Every field goes through setField() so only groups whose values changed are flagged for the cluster.
+  const float speedKmh = finiteOr(readFloat(data, layout.speedKmh), 0.0f);
+  const float engineRpm = finiteOr(readFloat(data, layout.rpm), 0.0f);
+  const int speed = static_cast<int>(roundf(clampFloat(speedKmh, 0.0f, 400.0f)));
+  const int rpm = static_cast<int>(roundf(clampFloat(engineRpm, 0.0f, 12000.0f)));
+  const char gearLetter = static_cast<char>(readByte(data, layout.gearLetter));
+  const uint8_t gearIndex = readByte(data, layout.gearIndex);
+
+  gameState.setField(gameState.time, readUInt32(data, layout.time), GameStateGroup_Dashboard);
+  gameState.setField(gameState.speed, speed, GameStateGroup_Speed);
+  gameState.setField(gameState.rpm, rpm, GameStateGroup_Engine);
+
+  gameState.setField(gameState.gearLetter, gearLetter, GameStateGroup_Gear);
+  gameState.setField(gameState.gearIndex, gearIndex <= 8 ? gearIndex : 0, GameStateGroup_Gear);
+  gameState.setField(gameState.gear, decodeGear(gearLetter, gameState.gearIndex), GameStateGroup_Gear);
+
+  gameState.setField(gameState.ignition, readFlag(data, layout.ignition), GameStateGroup_Engine);
+  gameState.setField(gameState.engineRunning, readFlag(data, layout.engineRunning), GameStateGroup_Engine);
+
+  gameState.setField(gameState.doorFL, readFlag(data, layout.doorFL), GameStateGroup_Body);
+  gameState.setField(gameState.doorFR, readFlag(data, layout.doorFR), GameStateGroup_Body);
+  gameState.setField(gameState.doorRL, readFlag(data, layout.doorRL), GameStateGroup_Body);
+  gameState.setField(gameState.doorRR, readFlag(data, layout.doorRR), GameStateGroup_Body);
+  gameState.setField(gameState.trunkOpen, readFlag(data, layout.trunkOpen), GameStateGroup_Body);
+  gameState.setField(gameState.hoodOpen, readFlag(data, layout.hoodOpen), GameStateGroup_Body);
+  gameState.setField(gameState.doorOpen,
+                     gameState.doorFL || gameState.doorFR || gameState.doorRL ||
+                         gameState.doorRR || gameState.trunkOpen || gameState.hoodOpen,
+                     GameStateGroup_Body);
+
+  gameState.setField(gameState.handbrake, readFlag(data, layout.parkingBrake), GameStateGroup_Body);
+  gameState.setField(gameState.absLight,
+                     readFlag(data, layout.absActive) || readFlag(data, layout.isABSBrakeActive),
+                     GameStateGroup_Warnings);
+  gameState.setField(gameState.escActive,
+                     readFlag(data, layout.escActive) || readFlag(data, layout.isYCBrakeActive),
+                     GameStateGroup_Warnings);
+  gameState.setField(gameState.tcsActive,
+                     readFlag(data, layout.tcsActive) || readFlag(data, layout.isTCBrakeActive),
+                     GameStateGroup_Warnings);
+  gameState.setField(gameState.hasESC,
+                     readFlag(data, layout.hasESC) || readFlag(data, layout.escAvailable),
+                     GameStateGroup_Warnings);
+  gameState.setField(gameState.hasTCS,
+                     readFlag(data, layout.hasTCS) || readFlag(data, layout.tcsAvailable),
+                     GameStateGroup_Warnings);
+  gameState.setField(gameState.offroadLight, gameState.escActive || gameState.tcsActive, GameStateGroup_Warnings);
+
+  gameState.setField(gameState.driveMode,
+                     mapBetterCanDriveMode(readByte(data, layout.driveMode)),
+                     GameStateGroup_Warnings);
+  gameState.setField(gameState.escDisabled, gameState.driveMode == 6, GameStateGroup_Warnings);
+
+  gameState.setField(gameState.highBeam, readFlag(data, layout.highBeam), GameStateGroup_Lights);
+  gameState.setField(gameState.mainLights,
+                     readFlag(data, layout.lowBeam) || readFlag(data, layout.highBeam),
+                     GameStateGroup_Lights);
+  gameState.setField(gameState.frontFogLight, readFlag(data, layout.fog), GameStateGroup_Lights);
+  gameState.setField(gameState.leftTurningIndicator, readFlag(data, layout.signalL), GameStateGroup_Lights);
+  gameState.setField(gameState.rightTurningIndicator, readFlag(data, layout.signalR), GameStateGroup_Lights);
+  gameState.setField(gameState.turningIndicatorsBlinking,
+                     readFlag(data, layout.signalL) || readFlag(data, layout.signalR) ||
+                         readFlag(data, layout.hazard),
+                     GameStateGroup_Lights);
+  gameState.setField(gameState.brakeLights, readFlag(data, layout.brakelights), GameStateGroup_Lights);
+
+  gameState.setField(gameState.batteryLight, readFlag(data, layout.battery), GameStateGroup_Warnings);
+  gameState.setField(gameState.oilLight,
+                     readFlag(data, layout.oil) || readFlag(data, layout.oilLevelCritical) ||
+                         readFlag(data, layout.starvedOfOil),
+                     GameStateGroup_Warnings);
+  gameState.setField(gameState.engineLight, packetShowsEngineFault(data, layout), GameStateGroup_Warnings);
+
+  gameState.setField(gameState.fuelQuantity,
+                     clampFloat(finiteOr(readFloat(data, layout.fuel), 0.0f), 0.0f, 100.0f),
+                     GameStateGroup_Fuel);
+  gameState.setField(gameState.lowFuelLight,
+                     readFlag(data, layout.lowfuel) || gameState.fuelQuantity <= 10.0f,
+                     GameStateGroup_Fuel);
+
+  const int coolantTemperature =
+      static_cast<int>(roundf(clampFloat(finiteOr(readFloat(data, layout.waterTemp), 0.0f), -50.0f, 250.0f)));
+  const int oilTemperature =
+      static_cast<int>(roundf(clampFloat(finiteOr(readFloat(data, layout.oilTemp), 0.0f), -50.0f, 250.0f)));
+  gameState.setField(gameState.coolantTemperature, coolantTemperature, GameStateGroup_Temperature);
+  gameState.setField(gameState.oilTemperature, oilTemperature, GameStateGroup_Temperature);
+
+  gameState.setField(gameState.tireDefFL, readFlag(data, layout.tireDefFL), GameStateGroup_Warnings);
+  gameState.setField(gameState.tireDefFR, readFlag(data, layout.tireDefFR), GameStateGroup_Warnings);
+  gameState.setField(gameState.tireDefRL, readFlag(data, layout.tireDefRL), GameStateGroup_Warnings);
+  gameState.setField(gameState.tireDefRR, readFlag(data, layout.tireDefRR), GameStateGroup_Warnings);
 }
 
 }  // namespace
 
-BeamNGGame::BeamNGGame(GameState& game, uint16_t port) : Game(game), port(port) {}
+BeamNGGame::BeamNGGame(GameState& game, uint16_t port)
+    : Game(game), port(port), receivedState(game.configuration), snapshot(game.configuration) {
+  receivedState.takeDirtyGroups();
+}
+
+bool BeamNGGame::update() {
+  return snapshot.mergeInto(gameState);
+}
 
 void BeamNGGame::begin() {
   if (!beamUdp.listen(port)) {
@@ -275,14 +417,12 @@ void BeamNGGame::begin() {
                 static_cast<unsigned>(sizeof(LegacyBetterCANPacket)));
 
   beamUdp.onPacket([this](AsyncUDPPacket packet) {
-    BetterCANPacket data{};
+    const BetterCANLayout* layout = nullptr;
 
     if (packet.length() == sizeof(BetterCANPacket)) {
-      memcpy(&data, packet.data(), sizeof(data));
+      layout = &kCurrentLayout;
     } else if (packet.length() == sizeof(LegacyBetterCANPacket)) {
-      LegacyBetterCANPacket legacy{};
-      memcpy(&legacy, packet.data(), sizeof(legacy));
-      data = expandLegacyPacket(legacy);
+      layout = &kLegacyLayout;
     } else {
 #if BETTER_CAN_DEBUG
       static uint32_t lastSizeWarning = 0;
@@ -298,6 +438,7 @@ void BeamNGGame::begin() {
       return;
     }
 
-    applyPacketToGameState(gameState, data);
+    applyPacketToGameState(receivedState, packet.data(), *layout);
+    snapshot.publish(receivedState);
   });
 }
@@ -9,15 +9,22 @@
 #include "Arduino.h"
 #include "AsyncUDP.h"
 #include "GameSimulation.h"
+#include "GameStateSnapshot.h"
 
 class BeamNGGame : public Game {
  public:
   BeamNGGame(GameState& game, uint16_t port);
   void begin() override;
+  // CAN task. Returns true when a new packet was merged.
+  bool update();
 
  private:
   uint16_t port;
   AsyncUDP beamUdp;
+
+  // Decoded on the AsyncUDP task only; the CAN task sees it through the snapshot.
+  GameState receivedState;
+  GameStateSnapshot snapshot;
 };
 
 #endif
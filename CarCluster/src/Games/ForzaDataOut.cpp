@@ -0,0 +1,216 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - Forza "Data Out" packet decoder
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "ForzaDataOut.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace {
+
+enum ForzaBlock : uint8_t {
+  ForzaBlock_Sled,
+  ForzaBlock_Dash,
+  ForzaBlock_Extension,
+  ForzaBlock_Count,
+};
+
+enum ForzaFieldType : uint8_t {
+  ForzaFieldType_Float,
+  ForzaFieldType_S32,
+  ForzaFieldType_U8,
+};
+
+// Offsets within the sled block.
+const uint8_t kSledIsRaceOn = 0;
+const uint8_t kSledEngineMaxRpm = 8;
+const uint8_t kSledEngineIdleRpm = 12;
+const uint8_t kSledCurrentEngineRpm = 16;
+const uint8_t kSledVelocity = 32;
+const uint8_t kSledTireCombinedSlip = 180;
+const uint8_t kSledDrivetrainType = 224;
+const uint8_t kSledSize = 232;
+
+// Offsets within the dash block.
+const uint8_t kDashSpeed = 12;
+const uint8_t kDashTireTemperature = 24;
+const uint8_t kDashBoost = 40;
+const uint8_t kDashFuel = 44;
+const uint8_t kDashAccelerator = 71;
+const uint8_t kDashBrake = 72;
+const uint8_t kDashHandbrake = 74;
+const uint8_t kDashGear = 75;
+const uint8_t kDashSize = 79;
+
+// Offsets within the Forza Motorsport 2023 extension block.
+const uint8_t kExtensionTireWear = 0;
+const uint8_t kExtensionSize = 20;  // tyre wear and track ordinal
+
+const uint16_t kBlockAbsent = 0xFFFF;
+
+struct ForzaFormatLayout {
+  uint16_t length;
+  uint16_t blockBase[ForzaBlock_Count];
+};
+
+// Indexed by ForzaPacketFormat.
+constexpr ForzaFormatLayout kFormats[] = {
+    {0, {kBlockAbsent, kBlockAbsent, kBlockAbsent}},
+    {232, {0, kBlockAbsent, kBlockAbsent}},
+    {311, {0, 232, kBlockAbsent}},
+    {324, {0, 244, kBlockAbsent}},
+    {331, {0, 232, 311}},
+};
+
+struct ForzaField {
+  uint8_t block;
+  uint8_t offset;
+  uint8_t type;
+  uint8_t count;
+  uint8_t target;  // offsetof(ForzaTelemetry, ...)
+};
+
+#define FORZA_FIELD(block, offset, type, count, member) \
+  { ForzaBlock_##block, offset, ForzaFieldType_##type, count, offsetof(ForzaTelemetry, member) }
+
+// Sorted by block, then offset, so the decoder walks the packet front to back.
+constexpr ForzaField kFields[] = {
+    FORZA_FIELD(Sled, kSledIsRaceOn, S32, 1, isRaceOn),
+    FORZA_FIELD(Sled, kSledEngineMaxRpm, Float, 1, engineMaxRpm),
+    FORZA_FIELD(Sled, kSledEngineIdleRpm, Float, 1, engineIdleRpm),
+    FORZA_FIELD(Sled, kSledCurrentEngineRpm, Float, 1, currentEngineRpm),
+    FORZA_FIELD(Sled, kSledVelocity, Float, 3, velocity),
+    FORZA_FIELD(Sled, kSledTireCombinedSlip, Float, 4, tireCombinedSlip),
+    FORZA_FIELD(Sled, kSledDrivetrainType, S32, 1, drivetrainType),
+    FORZA_FIELD(Dash, kDashSpeed, Float, 1, speed),
+    FORZA_FIELD(Dash, kDashTireTemperature, Float, 4, tireTemperature),
+    FORZA_FIELD(Dash, kDashBoost, Float, 1, boost),
+    FORZA_FIELD(Dash, kDashFuel, Float, 1, fuel),
+    FORZA_FIELD(Dash, kDashAccelerator, U8, 1, accelerator),
+    FORZA_FIELD(Dash, kDashBrake, U8, 1, brake),
+    FORZA_FIELD(Dash, kDashHandbrake, U8, 1, handbrake),
+    FORZA_FIELD(Dash, kDashGear, U8, 1, gear),
+    FORZA_FIELD(Extension, kExtensionTireWear, Float, 4, tireWear),
+};
+
+#undef FORZA_FIELD
+
+const size_t kFieldCount = sizeof(kFields) / sizeof(kFields[0]);
+
+constexpr unsigned typeSize(uint8_t type) {
+  return type == ForzaFieldType_U8 ? 1 : 4;
+}
+
+constexpr unsigned fieldEnd(const ForzaField& field) {
+  return field.offset + typeSize(field.type) * field.count;
+}
+
+constexpr unsigned blockSize(uint8_t block) {
+  return block == ForzaBlock_Sled ? kSledSize : block == ForzaBlock_Dash ? kDashSize : kExtensionSize;
+}
+
+constexpr bool fieldsOrdered(size_t index) {
+  return index + 1 >= kFieldCount ||
+         ((kFields[index].block < kFields[index + 1].block ||
+           (kFields[index].block == kFields[index + 1].block &&
+            fieldEnd(kFields[index]) <= kFields[index + 1].offset)) &&
+          fieldsOrdered(index + 1));
+}
+
+constexpr bool fieldsInsideBlocks(size_t index) {
+  return index >= kFieldCount ||
+         (fieldEnd(kFields[index]) <= blockSize(kFields[index].block) && fieldsInsideBlocks(index + 1));
+}
+
+constexpr unsigned packetOffset(ForzaPacketFormat format, uint8_t block, uint8_t offset) {
+  return kFormats[format].blockBase[block] + offset;
+}
+
+static_assert(sizeof(ForzaTelemetry) <= 0xFF, "ForzaField::target no longer fits a byte");
+static_assert(fieldsOrdered(0), "Forza field table must be sorted by block and offset without overlaps");
+static_assert(fieldsInsideBlocks(0), "Forza field runs past the end of its block");
+
+static_assert(kFormats[ForzaPacketFormat_Sled].length == kSledSize, "Forza Sled length changed");
+static_assert(packetOffset(ForzaPacketFormat_Dash, ForzaBlock_Dash, kDashSize) ==
+                  kFormats[ForzaPacketFormat_Dash].length,
+              "Forza Dash layout does not end at its length");
+static_assert(packetOffset(ForzaPacketFormat_Horizon, ForzaBlock_Dash, kDashSize) + 1 ==
+                  kFormats[ForzaPacketFormat_Horizon].length,
+              "Forza Horizon layout does not end at its length");
+static_assert(packetOffset(ForzaPacketFormat_Motorsport2023, ForzaBlock_Extension, kExtensionSize) ==
+                  kFormats[ForzaPacketFormat_Motorsport2023].length,
+              "Forza Motorsport 2023 layout does not end at its length");
+
+static_assert(packetOffset(ForzaPacketFormat_Dash, ForzaBlock_Dash, kDashSpeed) == 244, "Forza Dash speed offset");
+static_assert(packetOffset(ForzaPacketFormat_Dash, ForzaBlock_Dash, kDashTireTemperature) == 256,
+              "Forza Dash tyre temperature offset");
+static_assert(packetOffset(ForzaPacketFormat_Dash, ForzaBlock_Dash, kDashFuel) == 276, "Forza Dash fuel offset");
+static_assert(packetOffset(ForzaPacketFormat_Dash, ForzaBlock_Dash, kDashHandbrake) == 306,
+              "Forza Dash handbrake offset");
+static_assert(packetOffset(ForzaPacketFormat_Dash, ForzaBlock_Dash, kDashGear) == 307, "Forza Dash gear offset");
+static_assert(packetOffset(ForzaPacketFormat_Horizon, ForzaBlock_Dash, kDashSpeed) == 256,
+              "Forza Horizon speed offset");
+static_assert(packetOffset(ForzaPacketFormat_Horizon, ForzaBlock_Dash, kDashFuel) == 288, "Forza Horizon fuel offset");
+static_assert(packetOffset(ForzaPacketFormat_Horizon, ForzaBlock_Dash, kDashHandbrake) == 318,
+              "Forza Horizon handbrake offset");
+static_assert(packetOffset(ForzaPacketFormat_Horizon, ForzaBlock_Dash, kDashGear) == 319, "Forza Horizon gear offset");
+static_assert(packetOffset(ForzaPacketFormat_Motorsport2023, ForzaBlock_Extension, kExtensionTireWear) == 311,
+              "Forza Motorsport 2023 tyre wear offset");
+
+}  // namespace
+
+ForzaPacketFormat detectForzaPacketFormat(size_t length) {
+  for (uint8_t format = ForzaPacketFormat_Sled; format <= ForzaPacketFormat_Motorsport2023; format++) {
+    if (kFormats[format].length == length) return static_cast<ForzaPacketFormat>(format);
+  }
+  return ForzaPacketFormat_Unknown;
+}
+
+bool forzaPacketHasDash(ForzaPacketFormat format) {
+  return kFormats[format].blockBase[ForzaBlock_Dash] != kBlockAbsent;
+}
+
+bool decodeForzaPacket(const uint8_t* data, size_t length, ForzaTelemetry& telemetry) {
+  const ForzaPacketFormat format = detectForzaPacketFormat(length);
+  if (format == ForzaPacketFormat_Unknown) return false;
+
+  const ForzaFormatLayout& layout = kFormats[format];
+  memset(&telemetry, 0, sizeof(telemetry));
+  telemetry.format = format;
+  uint8_t* out = reinterpret_cast<uint8_t*>(&telemetry);
+
+  for (size_t i = 0; i < kFieldCount; i++) {
+    const ForzaField& field = kFields[i];
+    const uint16_t base = layout.blockBase[field.block];
+    if (base == kBlockAbsent) continue;
+
+    const uint8_t* in = data + base + field.offset;
+    uint8_t* target = out + field.target;
+    for (uint8_t element = 0; element < field.count; element++) {
+      switch (field.type) {
+        case ForzaFieldType_Float: {
+          float value;
+          memcpy(&value, in, sizeof(value));
+          if (!isfinite(value)) value = 0.0f;
+          memcpy(target, &value, sizeof(value));
+          break;
+        }
+        case ForzaFieldType_S32:
+          memcpy(target, in, sizeof(int32_t));
+          break;
+        default:
+          *target = *in;
+          break;
+      }
+      in += typeSize(field.type);
+      target += typeSize(field.type);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,75 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - Forza "Data Out" packet decoder
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Forza sends one of four little-endian layouts, told apart by their length:
+//
+//   Sled            232 bytes  sled block only (Forza Motorsport 7 "Sled")
+//   Dash            311 bytes  sled + dash block (Forza Motorsport 7 "Car Dash")
+//   Horizon         324 bytes  sled + 12 undocumented bytes + dash block + 1 pad byte (Forza Horizon 4/5)
+//   Motorsport2023  331 bytes  sled + dash block + tyre wear and track ordinal (Forza Motorsport 2023)
+//
+// Every decoded field is one row of a table holding its block and offset within the block; the blocks start at a
+// per-format base. Rows are sorted by packet offset, so decoding is one linear pass over the buffer. The offsets are
+// checked against the published layouts with static_assert in ForzaDataOut.cpp.
+// ####################################################################################################################
+
+#ifndef FORZA_DATA_OUT_H
+#define FORZA_DATA_OUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum ForzaPacketFormat : uint8_t {
+  ForzaPacketFormat_Unknown,
+  ForzaPacketFormat_Sled,
+  ForzaPacketFormat_Dash,
+  ForzaPacketFormat_Horizon,
+  ForzaPacketFormat_Motorsport2023,
+};
+
+enum ForzaDrivetrain : int32_t {
+  ForzaDrivetrain_FWD = 0,
+  ForzaDrivetrain_RWD = 1,
+  ForzaDrivetrain_AWD = 2,
+};
+
+// Wheel order of every per-wheel array: front left, front right, rear left, rear right.
+struct ForzaTelemetry {
+  ForzaPacketFormat format;
+
+  // Sled block, present in every format.
+  int32_t isRaceOn;
+  float engineMaxRpm;
+  float engineIdleRpm;
+  float currentEngineRpm;
+  float velocity[3];           // m/s in car space
+  float tireCombinedSlip[4];   // 1.0 and above means the tyre has lost grip
+  int32_t drivetrainType;
+
+  // Dash block; zero in Sled packets.
+  float speed;                 // m/s
+  float boost;                 // psi
+  float fuel;                  // 0.0 - 1.0
+  float tireTemperature[4];    // degrees Fahrenheit
+  uint8_t accelerator;         // 0 - 255
+  uint8_t brake;               // 0 - 255
+  uint8_t handbrake;           // 0 - 255
+  uint8_t gear;                // raw gear byte, 0 = reverse
+
+  // Forza Motorsport 2023 only; zero otherwise.
+  float tireWear[4];           // 0.0 new - 1.0 worn out
+};
+
+ForzaPacketFormat detectForzaPacketFormat(size_t length);
+bool forzaPacketHasDash(ForzaPacketFormat format);
+
+// Decodes a packet of any supported format into telemetry. Returns false, leaving telemetry untouched, when the
+// length matches no known format. Non-finite floats are decoded as 0.
+bool decodeForzaPacket(const uint8_t* data, size_t length, ForzaTelemetry& telemetry);
+
+#endif
@@ -6,24 +6,40 @@
 #include "ForzaHorizonGame.h"
 
 #include <math.h>
-#include <string.h>
 
 namespace {
 
-float readFloat(const uint8_t* data, size_t offset) {
-  float value = 0.0f;
-  memcpy(&value, data + offset, sizeof(value));
-  return isfinite(value) ? value : 0.0f;
+bool wheelSlipping(const ForzaTelemetry& telemetry, uint8_t wheel) {
+  return telemetry.tireCombinedSlip[wheel] >= FORZA_TIRE_SLIP_THRESHOLD;
 }
 
-uint8_t readByte(const uint8_t* data, size_t offset) {
-  return data[offset];
+// Traction control only reacts to the driven wheels spinning up under throttle; stability control is approximated
+// by any wheel sliding while the driver brakes.
+void decodeStabilityIntervention(const ForzaTelemetry& telemetry, bool& tcsActive, bool& escActive) {
+  const bool frontSlip = wheelSlipping(telemetry, 0) || wheelSlipping(telemetry, 1);
+  const bool rearSlip = wheelSlipping(telemetry, 2) || wheelSlipping(telemetry, 3);
+
+  bool drivenSlip;
+  switch (telemetry.drivetrainType) {
+    case ForzaDrivetrain_FWD: drivenSlip = frontSlip; break;
+    case ForzaDrivetrain_RWD: drivenSlip = rearSlip; break;
+    default: drivenSlip = frontSlip || rearSlip; break;
+  }
+
+  tcsActive = drivenSlip && telemetry.accelerator >= FORZA_PEDAL_THRESHOLD;
+  escActive = (frontSlip || rearSlip) && telemetry.brake >= FORZA_PEDAL_THRESHOLD;
 }
 
 }  // namespace
 
 ForzaHorizonGame::ForzaHorizonGame(GameState& game, uint16_t port)
-    : Game(game), port(port) {}
+    : Game(game), port(port), receivedState(game.configuration), snapshot(game.configuration) {
+  receivedState.takeDirtyGroups();
+}
+
+bool ForzaHorizonGame::update() {
+  return snapshot.mergeInto(gameState);
+}
 
 void ForzaHorizonGame::begin() {
   if (!forzaUdp.listen(port)) {
@@ -34,57 +50,93 @@ void ForzaHorizonGame::begin() {
   Serial.printf("[Forza] UDP listening on port %u\n", port);
 
   forzaUdp.onPacket([this](AsyncUDPPacket packet) {
-    if (packet.length() != 324 && packet.length() != 331) return;
-
-    const uint8_t* bytes = packet.data();
-    const bool motorsport2023 = packet.length() == 331;
-
-    const float maximumRpm = readFloat(bytes, 8);
-    const float currentRpm = readFloat(bytes, 16);
-    const float speedMps = readFloat(bytes, motorsport2023 ? 244 : 256);
-
-    gameState.time = millis();
-    gameState.ignition = maximumRpm > 0.0f;
-    gameState.engineRunning = currentRpm > 50.0f;
-    gameState.rpm = static_cast<int>(currentRpm);
-
-    if (maximumRpm > gameState.configuration.maximumRPMValue && maximumRpm > 0.0f) {
-      gameState.rpm = static_cast<int>(
-          currentRpm * gameState.configuration.maximumRPMValue / maximumRpm);
+    ForzaTelemetry telemetry;
+    if (!decodeForzaPacket(packet.data(), packet.length(), telemetry)) return;
+
+    const bool hasDash = forzaPacketHasDash(telemetry.format);
+    const float maximumRpm = telemetry.engineMaxRpm;
+    const float currentRpm = telemetry.currentEngineRpm;
+    const float speedMps = hasDash ? telemetry.speed
+                                   : sqrtf(telemetry.velocity[0] * telemetry.velocity[0] +
+                                           telemetry.velocity[1] * telemetry.velocity[1] +
+                                           telemetry.velocity[2] * telemetry.velocity[2]);
+
+    receivedState.setField(receivedState.time, millis(), GameStateGroup_Dashboard);
+    receivedState.setField(receivedState.ignition, maximumRpm > 0.0f, GameStateGroup_Engine);
+    receivedState.setField(receivedState.engineRunning, currentRpm > 50.0f, GameStateGroup_Engine);
+
+    int rpm = static_cast<int>(currentRpm);
+    if (maximumRpm > receivedState.configuration.maximumRPMValue && maximumRpm > 0.0f) {
+      rpm = static_cast<int>(currentRpm * receivedState.configuration.maximumRPMValue / maximumRpm);
     }
-
-    gameState.speed = static_cast<int>(speedMps * 3.6f);
-    if (gameState.speed < 0) gameState.speed = 0;
-
-    const uint8_t forzaGear = readByte(bytes, motorsport2023 ? 307 : 319);
-    gameState.gearIndex = 0;
-
-    if (!gameState.ignition) {
-      gameState.gear = GearState_Auto_P;
-      gameState.gearLetter = 'P';
-      gameState.doorOpen = true;  // menu/not driving indication retained from the original project
+    receivedState.setField(receivedState.rpm, rpm, GameStateGroup_Engine);
+
+    const int speed = static_cast<int>(speedMps * 3.6f);
+    receivedState.setField(receivedState.speed, speed < 0 ? 0 : speed, GameStateGroup_Speed);
+
+    const uint8_t forzaGear = telemetry.gear;
+    GearState gear = GearState_Auto_D;
+    char gearLetter = 'D';
+    uint8_t gearIndex = 0;
+    bool doorOpen = false;
+
+    if (!receivedState.ignition) {
+      gear = GearState_Auto_P;
+      gearLetter = 'P';
+      doorOpen = true;  // menu/not driving indication retained from the original project
+    } else if (!hasDash) {
+      // Sled packets carry no gear; keep D.
     } else if (forzaGear == 0) {
-      gameState.gear = GearState_Auto_R;
-      gameState.gearLetter = 'R';
-      gameState.doorOpen = false;
+      gear = GearState_Auto_R;
+      gearLetter = 'R';
     } else if (forzaGear == 1) {
-      gameState.gear = GearState_Auto_N;
-      gameState.gearLetter = 'N';
-      gameState.doorOpen = false;
+      gear = GearState_Auto_N;
+      gearLetter = 'N';
     } else {
-      gameState.gear = GearState_Auto_D;
-      gameState.gearLetter = 'D';
-      gameState.gearIndex = forzaGear > 1 ? static_cast<uint8_t>(forzaGear - 1) : 0;
-      if (gameState.gearIndex > 8) gameState.gearIndex = 8;
-      gameState.doorOpen = false;
+      gearIndex = forzaGear > 1 ? static_cast<uint8_t>(forzaGear - 1) : 0;
+      if (gearIndex > 8) gearIndex = 8;
     }
 
-    gameState.doorFL = gameState.doorOpen;
-    gameState.doorFR = false;
-    gameState.doorRL = false;
-    gameState.doorRR = false;
+    receivedState.setField(receivedState.gear, gear, GameStateGroup_Gear);
+    receivedState.setField(receivedState.gearLetter, gearLetter, GameStateGroup_Gear);
+    receivedState.setField(receivedState.gearIndex, gearIndex, GameStateGroup_Gear);
+    receivedState.setField(receivedState.doorOpen, doorOpen, GameStateGroup_Body);
+
+    receivedState.setField(receivedState.doorFL, receivedState.doorOpen, GameStateGroup_Body);
+    receivedState.setField(receivedState.doorFR, false, GameStateGroup_Body);
+    receivedState.setField(receivedState.doorRL, false, GameStateGroup_Body);
+    receivedState.setField(receivedState.doorRR, false, GameStateGroup_Body);
+
+    receivedState.setField(receivedState.handbrake, telemetry.handbrake != 0, GameStateGroup_Body);
+
+    // Dash fields read zero in menus, so fuel and driver-aid state only follow the game while a race is on.
+    if (hasDash && telemetry.isRaceOn) {
+      float fuelPercent = telemetry.fuel * 100.0f;
+      if (fuelPercent < 0.0f) fuelPercent = 0.0f;
+      if (fuelPercent > 100.0f) fuelPercent = 100.0f;
+      receivedState.setField(receivedState.fuelQuantity, fuelPercent, GameStateGroup_Fuel);
+      receivedState.setField(receivedState.lowFuelLight, fuelPercent <= 10.0f, GameStateGroup_Fuel);
+      receivedState.setField(receivedState.brakeLights, telemetry.brake >= FORZA_PEDAL_THRESHOLD,
+                             GameStateGroup_Lights);
+
+      bool tcsActive;
+      bool escActive;
+      decodeStabilityIntervention(telemetry, tcsActive, escActive);
+      receivedState.setField(receivedState.tcsActive, tcsActive, GameStateGroup_Warnings);
+      receivedState.setField(receivedState.escActive, escActive, GameStateGroup_Warnings);
+      receivedState.setField(receivedState.offroadLight, tcsActive || escActive, GameStateGroup_Warnings);
+    }
 
-    const size_t handbrakeOffset = motorsport2023 ? 306 : 318;
-    gameState.handbrake = readByte(bytes, handbrakeOffset) != 0;
+    // Only Forza Motorsport 2023 reports tyre wear; the other layouts leave it zero.
+    receivedState.setField(receivedState.tireDefFL, telemetry.tireWear[0] >= FORZA_TIRE_WEAR_WARNING,
+                           GameStateGroup_Warnings);
+    receivedState.setField(receivedState.tireDefFR, telemetry.tireWear[1] >= FORZA_TIRE_WEAR_WARNING,
+                           GameStateGroup_Warnings);
+    receivedState.setField(receivedState.tireDefRL, telemetry.tireWear[2] >= FORZA_TIRE_WEAR_WARNING,
+                           GameStateGroup_Warnings);
+    receivedState.setField(receivedState.tireDefRR, telemetry.tireWear[3] >= FORZA_TIRE_WEAR_WARNING,
+                           GameStateGroup_Warnings);
+
+    snapshot.publish(receivedState);
   });
 }
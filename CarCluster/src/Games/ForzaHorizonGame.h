@@ -7,16 +7,39 @@
 
 #include "Arduino.h"
 #include "AsyncUDP.h"
+#include "ForzaDataOut.h"
 #include "GameSimulation.h"
+#include "GameStateSnapshot.h"
+
+// Combined slip at which a tyre counts as spinning or sliding.
+#ifndef FORZA_TIRE_SLIP_THRESHOLD
+#define FORZA_TIRE_SLIP_THRESHOLD 1.0f
+#endif
+
+// Accelerator/brake byte (0-255) above which the pedal counts as pressed.
+#ifndef FORZA_PEDAL_THRESHOLD
+#define FORZA_PEDAL_THRESHOLD 26
+#endif
+
+// Forza Motorsport 2023 tyre wear (0.0-1.0) that raises the tyre warning.
+#ifndef FORZA_TIRE_WEAR_WARNING
+#define FORZA_TIRE_WEAR_WARNING 0.8f
+#endif
 
 class ForzaHorizonGame : public Game {
  public:
   ForzaHorizonGame(GameState& game, uint16_t port);
   void begin() override;
+  // CAN task. Returns true when a new packet was merged.
+  bool update();
 
  private:
   uint16_t port;
   AsyncUDP forzaUdp;
+
+  // Decoded on the AsyncUDP task only; the CAN task sees it through the snapshot.
+  GameState receivedState;
+  GameStateSnapshot snapshot;
 };
 
 #endif
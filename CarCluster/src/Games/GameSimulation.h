@@ -64,6 +64,29 @@ enum GearState {
   GearState_Auto_S = 15
 };
 
+// Values of GameState::buttonEventToProcess: the BC/menu button pressed briefly, held or held long.
+enum SteeringButtonAction : uint8_t {
+  SteeringButtonAction_None = 0,
+  SteeringButtonAction_Press = 1,
+  SteeringButtonAction_Hold = 2,
+  SteeringButtonAction_LongPress = 3,
+};
+
+// Field groups for dirty tracking. Sources flag a group when one of its fields actually changes, and the cluster
+// only re-encodes the frames that depend on a flagged group.
+enum GameStateGroup : uint16_t {
+  GameStateGroup_Speed = 1 << 0,        // speed
+  GameStateGroup_Engine = 1 << 1,       // rpm, engineRunning, ignition
+  GameStateGroup_Gear = 1 << 2,         // gear, gearLetter, gearIndex
+  GameStateGroup_Temperature = 1 << 3,  // coolant, oil and outdoor temperature
+  GameStateGroup_Fuel = 1 << 4,         // fuelQuantity, lowFuelLight
+  GameStateGroup_Lights = 1 << 5,       // exterior lights and turn indicators
+  GameStateGroup_Body = 1 << 6,         // doors, trunk, hood, handbrake
+  GameStateGroup_Warnings = 1 << 7,     // drive mode, warning lights, ESC/TCS, tyres
+  GameStateGroup_Dashboard = 1 << 8,    // backlight, time
+  GameStateGroup_All = 0x01FF
+};
+
 class GameState {
  public:
   explicit GameState(ClusterConfiguration configuration) : configuration(configuration) {}
@@ -125,10 +148,104 @@ class GameState {
     return tireDefFL || tireDefFR || tireDefRL || tireDefRR;
   }
 
+  // SteeringButtonAction for the cluster to queue; cleared once taken.
   int buttonEventToProcess = 0;
   uint8_t alertId = 0;
   bool alertStart = false;
   bool alertClear = false;
+
+  // Reported back by the cluster and decoded by CanRxDispatcher handlers. Never sent, so they belong to no group.
+  uint32_t clusterOdometer = 0;
+  uint16_t clusterRange = 0;
+  unsigned long clusterLastSeenTime = 0;
+
+  // GameStateGroup bits changed since the cluster last collected them.
+  uint16_t dirtyGroups = GameStateGroup_All;
+
+  template <typename T, typename V>
+  void setField(T& field, V value, uint16_t group) {
+    const T converted = static_cast<T>(value);
+    if (field == converted) return;
+    field = converted;
+    dirtyGroups |= group;
+  }
+
+  void markDirty(uint16_t groups) {
+    dirtyGroups |= groups;
+  }
+
+  uint16_t takeDirtyGroups() {
+    const uint16_t groups = dirtyGroups;
+    dirtyGroups = 0;
+    return groups;
+  }
+
+  // Copies the fields of the given groups from source, flagging only the values that differ.
+  void copyGroups(const GameState& source, uint16_t groups) {
+    if (groups & GameStateGroup_Speed) {
+      setField(speed, source.speed, GameStateGroup_Speed);
+    }
+    if (groups & GameStateGroup_Engine) {
+      setField(rpm, source.rpm, GameStateGroup_Engine);
+      setField(engineRunning, source.engineRunning, GameStateGroup_Engine);
+      setField(ignition, source.ignition, GameStateGroup_Engine);
+    }
+    if (groups & GameStateGroup_Gear) {
+      setField(gear, source.gear, GameStateGroup_Gear);
+      setField(gearLetter, source.gearLetter, GameStateGroup_Gear);
+      setField(gearIndex, source.gearIndex, GameStateGroup_Gear);
+    }
+    if (groups & GameStateGroup_Temperature) {
+      setField(coolantTemperature, source.coolantTemperature, GameStateGroup_Temperature);
+      setField(oilTemperature, source.oilTemperature, GameStateGroup_Temperature);
+      setField(outdoorTemperature, source.outdoorTemperature, GameStateGroup_Temperature);
+    }
+    if (groups & GameStateGroup_Fuel) {
+      setField(fuelQuantity, source.fuelQuantity, GameStateGroup_Fuel);
+      setField(lowFuelLight, source.lowFuelLight, GameStateGroup_Fuel);
+    }
+    if (groups & GameStateGroup_Lights) {
+      setField(leftTurningIndicator, source.leftTurningIndicator, GameStateGroup_Lights);
+      setField(rightTurningIndicator, source.rightTurningIndicator, GameStateGroup_Lights);
+      setField(turningIndicatorsBlinking, source.turningIndicatorsBlinking, GameStateGroup_Lights);
+      setField(mainLights, source.mainLights, GameStateGroup_Lights);
+      setField(brakeLights, source.brakeLights, GameStateGroup_Lights);
+      setField(rearFogLight, source.rearFogLight, GameStateGroup_Lights);
+      setField(frontFogLight, source.frontFogLight, GameStateGroup_Lights);
+      setField(highBeam, source.highBeam, GameStateGroup_Lights);
+    }
+    if (groups & GameStateGroup_Body) {
+      setField(doorOpen, source.doorOpen, GameStateGroup_Body);
+      setField(doorFL, source.doorFL, GameStateGroup_Body);
+      setField(doorFR, source.doorFR, GameStateGroup_Body);
+      setField(doorRL, source.doorRL, GameStateGroup_Body);
+      setField(doorRR, source.doorRR, GameStateGroup_Body);
+      setField(trunkOpen, source.trunkOpen, GameStateGroup_Body);
+      setField(hoodOpen, source.hoodOpen, GameStateGroup_Body);
+      setField(handbrake, source.handbrake, GameStateGroup_Body);
+    }
+    if (groups & GameStateGroup_Warnings) {
+      setField(offroadLight, source.offroadLight, GameStateGroup_Warnings);
+      setField(driveMode, source.driveMode, GameStateGroup_Warnings);
+      setField(absLight, source.absLight, GameStateGroup_Warnings);
+      setField(batteryLight, source.batteryLight, GameStateGroup_Warnings);
+      setField(oilLight, source.oilLight, GameStateGroup_Warnings);
+      setField(engineLight, source.engineLight, GameStateGroup_Warnings);
+      setField(escActive, source.escActive, GameStateGroup_Warnings);
+      setField(escDisabled, source.escDisabled, GameStateGroup_Warnings);
+      setField(hasESC, source.hasESC, GameStateGroup_Warnings);
+      setField(tcsActive, source.tcsActive, GameStateGroup_Warnings);
+      setField(hasTCS, source.hasTCS, GameStateGroup_Warnings);
+      setField(tireDefFL, source.tireDefFL, GameStateGroup_Warnings);
+      setField(tireDefFR, source.tireDefFR, GameStateGroup_Warnings);
+      setField(tireDefRL, source.tireDefRL, GameStateGroup_Warnings);
+      setField(tireDefRR, source.tireDefRR, GameStateGroup_Warnings);
+    }
+    if (groups & GameStateGroup_Dashboard) {
+      setField(backlightBrightness, source.backlightBrightness, GameStateGroup_Dashboard);
+      setField(time, source.time, GameStateGroup_Dashboard);
+    }
+  }
 };
 
 class Game {
@@ -0,0 +1,93 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - GameState hand-off between the network tasks and the CAN task
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// Better_CAN: https://github.com/JackieZ123430/Better_CAN
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// AsyncUDP handlers run on the ESP32 async_udp task while the CAN task encodes frames on the other core. Each UDP
+// game decodes into its own GameState and publishes the whole state through a seqlock; the CAN task copies a
+// consistent snapshot and merges only the field groups changed since its previous read. Neither side ever waits: the
+// writer never blocks, and a reader that races a write simply tries again on its next pass. The web dashboard uses
+// the same exchange in both directions with the network task.
+//
+// One writer task per snapshot. Groups are accumulated by the writer until the reader acknowledges the sequence
+// number it consumed, so a group changed in a snapshot the reader skipped is still merged later.
+// ####################################################################################################################
+
+#ifndef GAME_STATE_SNAPSHOT_H
+#define GAME_STATE_SNAPSHOT_H
+
+#include <atomic>
+
+#include "GameSimulation.h"
+
+class GameStateSnapshot {
+ public:
+  explicit GameStateSnapshot(ClusterConfiguration configuration) : state(configuration), received(configuration) {}
+
+  // Writer side (network task).
+  void publish(GameState& source) {
+    publish(source, source.takeDirtyGroups());
+  }
+
+  // Writer side for a source whose dirty groups are consumed elsewhere; the caller names the changed groups.
+  void publish(const GameState& source, uint16_t changedGroups) {
+    const uint32_t current = sequence.load(std::memory_order_relaxed);
+    if (acknowledgedSequence.load(std::memory_order_acquire) == current) pendingGroups = 0;
+    pendingGroups |= changedGroups;
+
+    sequence.store(current + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    state = source;
+    groups = pendingGroups;
+    sequence.store(current + 2, std::memory_order_release);
+  }
+
+  // Reader side (CAN task). Returns true when a new snapshot was merged into target.
+  bool mergeInto(GameState& target) {
+    if (!readLatest()) return false;
+    target.copyGroups(received, receivedGroups);
+    return true;
+  }
+
+  // Reader side. Replaces target with the whole snapshot, fields outside any group included.
+  bool copyInto(GameState& target) {
+    if (!readLatest()) return false;
+    target = received;
+    return true;
+  }
+
+ private:
+  bool readLatest() {
+    for (uint8_t attempt = 0; attempt < 3; attempt++) {
+      const uint32_t before = sequence.load(std::memory_order_acquire);
+      if (before == consumedSequence) return false;
+      if (before & 1) continue;
+
+      received = state;
+      receivedGroups = groups;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence.load(std::memory_order_relaxed) != before) continue;
+
+      consumedSequence = before;
+      acknowledgedSequence.store(before, std::memory_order_release);
+      return true;
+    }
+    return false;
+  }
+
+  std::atomic<uint32_t> sequence{0};
+  std::atomic<uint32_t> acknowledgedSequence{0};
+  GameState state;
+  uint16_t groups = 0;
+
+  uint16_t pendingGroups = 0;    // writer only
+  uint32_t consumedSequence = 0; // reader only
+  GameState received;            // reader only
+  uint16_t receivedGroups = 0;   // reader only
+};
+
+#endif
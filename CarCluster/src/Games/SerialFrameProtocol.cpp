@@ -0,0 +1,69 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - binary serial frame protocol
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "SerialFrameProtocol.h"
+
+uint8_t serialFrameCrc8(const uint8_t* data, size_t length) {
+  uint8_t crc = 0x00;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+    }
+  }
+  return crc;
+}
+
+bool SerialFrameDecoder::push(uint8_t incoming) {
+  if (!receiving) {
+    if (incoming == 0x00) {
+      receiving = true;
+      overflowed = false;
+      position = 0;
+    }
+    return false;
+  }
+
+  if (incoming != 0x00) {
+    if (position < sizeof(buffer)) {
+      buffer[position++] = incoming;
+    } else {
+      overflowed = true;
+    }
+    return false;
+  }
+
+  // Repeated delimiters only resynchronise.
+  if (position == 0 && !overflowed) return false;
+
+  receiving = false;
+  if (!overflowed && decodeFrame()) return true;
+
+  rejected++;
+  return false;
+}
+
+bool SerialFrameDecoder::decodeFrame() {
+  // COBS decode in place; the write index never overtakes the read index.
+  uint16_t readIndex = 0;
+  uint16_t writeIndex = 0;
+
+  while (readIndex < position) {
+    const uint8_t code = buffer[readIndex++];
+    for (uint8_t i = 1; i < code; i++) {
+      if (readIndex >= position) return false;
+      buffer[writeIndex++] = buffer[readIndex++];
+    }
+    if (code < 0xFF && readIndex < position) buffer[writeIndex++] = 0x00;
+  }
+
+  if (writeIndex < 3) return false;
+  if (buffer[0] > SERIAL_FRAME_MAX_PAYLOAD || buffer[0] + 3 != writeIndex) return false;
+  return serialFrameCrc8(buffer, writeIndex - 1) == buffer[writeIndex - 1];
+}
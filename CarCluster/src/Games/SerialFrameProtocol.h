@@ -0,0 +1,105 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - binary serial frame protocol
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Opt-in alternative to the SimHub JSON lines on the serial port. JSON text never contains a zero byte, so a sender
+// can switch to binary frames at any time without reconfiguring the firmware and both formats share the port.
+//
+//   wire:  0x00 | COBS(length, type, payload[length], crc) | 0x00
+//   crc:   CRC-8, polynomial 0x07, init 0x00, over length, type and payload
+//
+// Frame types reuse the JSON "action" numbers. Payloads are packed little-endian structs read at fixed offsets.
+// Tools/carcluster_serial.py is the matching PC-side encoder; keep both in step when a payload changes.
+// ####################################################################################################################
+
+#ifndef SERIAL_FRAME_PROTOCOL_H
+#define SERIAL_FRAME_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SERIAL_FRAME_MAX_PAYLOAD 240
+
+enum SerialFrameType : uint8_t {
+  SerialFrameType_CanPassthrough = 0,
+  SerialFrameType_CanBatch = 1,
+  SerialFrameType_SimhubTelemetry = 10,
+};
+
+// Action 0: standard 11-bit ID followed by 0-8 data bytes; the data length is the payload length minus 2.
+struct __attribute__((packed)) SerialCanPassthroughPayload {
+  uint16_t id;
+  uint8_t data[8];
+};
+
+// Action 1: one header byte followed by records of {offsetMs, id, length, data[length]}. Each record is sent
+// offsetMs after the batch base time: the moment the batch arrived, or with SerialCanBatchFlag_Continue the time of
+// the last record of the previous batch, so a long capture can be streamed in chunks without accumulating drift.
+enum SerialCanBatchFlag : uint8_t {
+  SerialCanBatchFlag_Continue = 0x01,
+};
+
+struct __attribute__((packed)) SerialCanBatchRecord {
+  uint16_t offsetMs;
+  uint16_t id;
+  uint8_t length;
+};
+
+enum SimhubTelemetryFlag : uint8_t {
+  SimhubTelemetryFlag_Running = 0x01,
+  SimhubTelemetryFlag_Paused = 0x02,
+  SimhubTelemetryFlag_LeftIndicator = 0x04,
+  SimhubTelemetryFlag_RightIndicator = 0x08,
+  SimhubTelemetryFlag_Handbrake = 0x10,
+  SimhubTelemetryFlag_Abs = 0x20,
+  SimhubTelemetryFlag_TractionControl = 0x40,
+};
+
+// Action 10: the same values as the JSON keys rpm, spe, oit, gea, fue and the run/pau/lft/rit/hnb/abs/tra flags.
+struct __attribute__((packed)) SimhubTelemetryPayload {
+  uint16_t rpm;
+  uint16_t speed;
+  int16_t oilTemperature;
+  int8_t gear;
+  uint8_t fuelPercent;
+  uint8_t flags;
+};
+
+static_assert(sizeof(SerialCanPassthroughPayload) == 10, "CAN passthrough payload size changed");
+static_assert(sizeof(SerialCanBatchRecord) == 5, "CAN batch record header size changed");
+static_assert(sizeof(SimhubTelemetryPayload) == 9, "SimHub telemetry payload size changed");
+static_assert(offsetof(SimhubTelemetryPayload, gear) == 6, "SimHub telemetry gear offset changed");
+static_assert(offsetof(SimhubTelemetryPayload, flags) == 8, "SimHub telemetry flags offset changed");
+
+// Collects COBS-encoded bytes between zero delimiters and validates the decoded frame in place.
+class SerialFrameDecoder {
+ public:
+  // True between a starting zero byte and the delimiter that ends the frame.
+  bool active() const { return receiving; }
+
+  // Feeds one byte. Returns true when it completed a valid frame, which stays readable until the next push().
+  bool push(uint8_t incoming);
+
+  SerialFrameType type() const { return static_cast<SerialFrameType>(buffer[1]); }
+  const uint8_t* payload() const { return &buffer[2]; }
+  uint8_t payloadLength() const { return buffer[0]; }
+
+  uint32_t rejectedFrames() const { return rejected; }
+
+ private:
+  bool decodeFrame();
+
+  bool receiving = false;
+  bool overflowed = false;
+  uint16_t position = 0;
+  uint32_t rejected = 0;
+  uint8_t buffer[SERIAL_FRAME_MAX_PAYLOAD + 4] = {};
+};
+
+uint8_t serialFrameCrc8(const uint8_t* data, size_t length);
+
+#endif
@@ -1,5 +1,5 @@
 // ####################################################################################################################
-// SimHub serial JSON integration retained for the BMW F10 build
+// SimHub serial integration retained for the BMW F10 build: JSON lines and binary frames (SerialFrameProtocol.h)
 // ####################################################################################################################
 
 #include "SimhubGame.h"
@@ -9,47 +9,90 @@ SimhubGame::SimhubGame(GameState& game) : Game(game) {}
 void SimhubGame::begin() {}
 
 void SimhubGame::decodeSerialData(JsonDocument& doc) {
-  gameState.time = millis();
-  gameState.rpm = doc["rpm"] | 0;
-  gameState.engineRunning = gameState.rpm > 50;
-  gameState.ignition = (doc["run"] | 0) != 0 || gameState.engineRunning;
+  SimhubTelemetry telemetry;
+  telemetry.rpm = doc["rpm"] | 0;
+  telemetry.speed = doc["spe"] | 0;
+  telemetry.gear = doc["gea"].as<int>();
+  telemetry.oilTemperature = doc["oit"] | 90;
+  telemetry.fuelQuantity = doc["fue"] | 0;
+  telemetry.running = (doc["run"] | 0) != 0;
+  telemetry.paused = (doc["pau"] | 0) != 0;
+  telemetry.leftIndicator = (doc["lft"] | 0) != 0;
+  telemetry.rightIndicator = (doc["rit"] | 0) != 0;
+  telemetry.handbrake = (doc["hnb"] | 0) != 0;
+  telemetry.abs = (doc["abs"] | 0) != 0;
+  telemetry.tractionControl = (doc["tra"] | 0) != 0;
+  applyTelemetry(telemetry);
+}
+
+bool SimhubGame::decodeBinaryData(const uint8_t* payload, uint8_t length) {
+  if (length != sizeof(SimhubTelemetryPayload)) return false;
+
+  SimhubTelemetryPayload packet;
+  memcpy(&packet, payload, sizeof(packet));
+
+  SimhubTelemetry telemetry;
+  telemetry.rpm = packet.rpm;
+  telemetry.speed = packet.speed;
+  telemetry.gear = packet.gear;
+  telemetry.oilTemperature = packet.oilTemperature;
+  telemetry.fuelQuantity = packet.fuelPercent;
+  telemetry.running = (packet.flags & SimhubTelemetryFlag_Running) != 0;
+  telemetry.paused = (packet.flags & SimhubTelemetryFlag_Paused) != 0;
+  telemetry.leftIndicator = (packet.flags & SimhubTelemetryFlag_LeftIndicator) != 0;
+  telemetry.rightIndicator = (packet.flags & SimhubTelemetryFlag_RightIndicator) != 0;
+  telemetry.handbrake = (packet.flags & SimhubTelemetryFlag_Handbrake) != 0;
+  telemetry.abs = (packet.flags & SimhubTelemetryFlag_Abs) != 0;
+  telemetry.tractionControl = (packet.flags & SimhubTelemetryFlag_TractionControl) != 0;
+  applyTelemetry(telemetry);
+  return true;
+}
 
-  const int simGear = doc["gea"].as<int>();
-  gameState.gearIndex = 0;
+void SimhubGame::applyTelemetry(const SimhubTelemetry& telemetry) {
+  gameState.setField(gameState.time, millis(), GameStateGroup_Dashboard);
+  gameState.setField(gameState.rpm, telemetry.rpm, GameStateGroup_Engine);
+  gameState.setField(gameState.engineRunning, gameState.rpm > 50, GameStateGroup_Engine);
+  gameState.setField(gameState.ignition, telemetry.running || gameState.engineRunning, GameStateGroup_Engine);
+
+  const int simGear = telemetry.gear;
 
   if (simGear > 0) {
-    gameState.gear = GearState_Auto_D;
-    gameState.gearLetter = 'D';
-    gameState.gearIndex = simGear > 8 ? 8 : static_cast<uint8_t>(simGear);
+    gameState.setField(gameState.gear, GearState_Auto_D, GameStateGroup_Gear);
+    gameState.setField(gameState.gearLetter, 'D', GameStateGroup_Gear);
+    gameState.setField(gameState.gearIndex, simGear > 8 ? 8 : static_cast<uint8_t>(simGear), GameStateGroup_Gear);
   } else if (simGear == 0) {
-    gameState.gear = GearState_Auto_N;
-    gameState.gearLetter = 'N';
+    gameState.setField(gameState.gear, GearState_Auto_N, GameStateGroup_Gear);
+    gameState.setField(gameState.gearLetter, 'N', GameStateGroup_Gear);
+    gameState.setField(gameState.gearIndex, 0, GameStateGroup_Gear);
   } else {
-    gameState.gear = GearState_Auto_R;
-    gameState.gearLetter = 'R';
+    gameState.setField(gameState.gear, GearState_Auto_R, GameStateGroup_Gear);
+    gameState.setField(gameState.gearLetter, 'R', GameStateGroup_Gear);
+    gameState.setField(gameState.gearIndex, 0, GameStateGroup_Gear);
   }
 
-  gameState.speed = doc["spe"] | 0;
-  gameState.leftTurningIndicator = (doc["lft"] | 0) != 0;
-  gameState.rightTurningIndicator = (doc["rit"] | 0) != 0;
-  gameState.turningIndicatorsBlinking =
-      gameState.leftTurningIndicator || gameState.rightTurningIndicator;
-
-  gameState.oilTemperature = doc["oit"] | 90;
-  gameState.coolantTemperature = gameState.oilTemperature;
-
-  gameState.doorOpen = (doc["pau"] | 0) != 0 || (doc["run"] | 0) == 0;
-  gameState.doorFL = gameState.doorOpen;
-  gameState.doorFR = false;
-  gameState.doorRL = false;
-  gameState.doorRR = false;
-
-  gameState.fuelQuantity = doc["fue"] | 0;
-  if (gameState.fuelQuantity < 0.0f) gameState.fuelQuantity = 0.0f;
-  if (gameState.fuelQuantity > 100.0f) gameState.fuelQuantity = 100.0f;
-  gameState.lowFuelLight = gameState.fuelQuantity <= 10.0f;
-
-  gameState.handbrake = (doc["hnb"] | 0) != 0;
-  gameState.absLight = (doc["abs"] | 0) != 0;
-  gameState.offroadLight = (doc["tra"] | 0) != 0;
+  gameState.setField(gameState.speed, telemetry.speed, GameStateGroup_Speed);
+  gameState.setField(gameState.leftTurningIndicator, telemetry.leftIndicator, GameStateGroup_Lights);
+  gameState.setField(gameState.rightTurningIndicator, telemetry.rightIndicator, GameStateGroup_Lights);
+  gameState.setField(gameState.turningIndicatorsBlinking,
+                     gameState.leftTurningIndicator || gameState.rightTurningIndicator,
+                     GameStateGroup_Lights);
+
+  gameState.setField(gameState.oilTemperature, telemetry.oilTemperature, GameStateGroup_Temperature);
+  gameState.setField(gameState.coolantTemperature, gameState.oilTemperature, GameStateGroup_Temperature);
+
+  gameState.setField(gameState.doorOpen, telemetry.paused || !telemetry.running, GameStateGroup_Body);
+  gameState.setField(gameState.doorFL, gameState.doorOpen, GameStateGroup_Body);
+  gameState.setField(gameState.doorFR, false, GameStateGroup_Body);
+  gameState.setField(gameState.doorRL, false, GameStateGroup_Body);
+  gameState.setField(gameState.doorRR, false, GameStateGroup_Body);
+
+  float fuelQuantity = telemetry.fuelQuantity;
+  if (fuelQuantity < 0.0f) fuelQuantity = 0.0f;
+  if (fuelQuantity > 100.0f) fuelQuantity = 100.0f;
+  gameState.setField(gameState.fuelQuantity, fuelQuantity, GameStateGroup_Fuel);
+  gameState.setField(gameState.lowFuelLight, gameState.fuelQuantity <= 10.0f, GameStateGroup_Fuel);
+
+  gameState.setField(gameState.handbrake, telemetry.handbrake, GameStateGroup_Body);
+  gameState.setField(gameState.absLight, telemetry.abs, GameStateGroup_Warnings);
+  gameState.setField(gameState.offroadLight, telemetry.tractionControl, GameStateGroup_Warnings);
 }
@@ -1,5 +1,5 @@
 // ####################################################################################################################
-// SimHub serial JSON integration retained for the BMW F10 build
+// SimHub serial integration retained for the BMW F10 build: JSON lines and binary frames (SerialFrameProtocol.h)
 // ####################################################################################################################
 
 #ifndef SIMHUB_GAME_H
@@ -8,12 +8,33 @@
 #include "Arduino.h"
 #include "../Libs/ArduinoJson/ArduinoJson.h"
 #include "GameSimulation.h"
+#include "SerialFrameProtocol.h"
+
+// Values shared by the JSON and binary serial paths.
+struct SimhubTelemetry {
+  int rpm = 0;
+  int speed = 0;
+  int gear = 0;
+  int oilTemperature = 90;
+  float fuelQuantity = 0.0f;
+  bool running = false;
+  bool paused = false;
+  bool leftIndicator = false;
+  bool rightIndicator = false;
+  bool handbrake = false;
+  bool abs = false;
+  bool tractionControl = false;
+};
 
 class SimhubGame : public Game {
  public:
   explicit SimhubGame(GameState& game);
   void begin() override;
   void decodeSerialData(JsonDocument& doc);
+  bool decodeBinaryData(const uint8_t* payload, uint8_t length);
+
+ private:
+  void applyTelemetry(const SimhubTelemetry& telemetry);
 };
 
 #endif
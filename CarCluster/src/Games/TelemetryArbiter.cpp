@@ -0,0 +1,114 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - telemetry source arbitration
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "TelemetryArbiter.h"
+
+namespace {
+
+// The idle state leaves fuel, temperatures and the dashboard group at their last values.
+const uint16_t kIdleGroups = GameStateGroup_Speed | GameStateGroup_Engine | GameStateGroup_Gear |
+                             GameStateGroup_Lights | GameStateGroup_Body | GameStateGroup_Warnings;
+
+}  // namespace
+
+static_assert(TelemetrySource_Count == 5, "TelemetryArbiter::slots initializer must list every source");
+
+TelemetryArbiter::TelemetryArbiter(ClusterConfiguration configuration, unsigned long timeout)
+    : slots{Slot(configuration), Slot(configuration), Slot(configuration), Slot(configuration), Slot(configuration)},
+      idleState(configuration),
+      arbitratedState(configuration) {
+  arbitratedState.takeDirtyGroups();
+  for (uint8_t i = 0; i < TelemetrySource_Count; i++) {
+    slots[i].timeout = timeout;
+    slots[i].priority = i;
+    slots[i].state.takeDirtyGroups();
+  }
+}
+
+void TelemetryArbiter::markFresh(TelemetrySource source, unsigned long now) {
+  slots[source].lastUpdate = now;
+  slots[source].seen = true;
+}
+
+TelemetrySource TelemetryArbiter::arbitrate(unsigned long now) {
+  const TelemetrySource selected = select(now);
+
+  if (selected != active) {
+    if (selected == TelemetrySource_None) {
+      arbitratedState.copyGroups(idleState, kIdleGroups);
+    } else {
+      slots[selected].state.takeDirtyGroups();
+      arbitratedState.copyGroups(slots[selected].state, GameStateGroup_All);
+    }
+    Serial.printf("[Telemetry] Source: %s\n", sourceName(selected));
+    active = selected;
+#if TELEMETRY_SMOOTHING
+    // Start from the new source's values rather than sweeping over from the previous one.
+    speedFilter.reset(arbitratedState.speed, now);
+    rpmFilter.reset(arbitratedState.rpm, now);
+#endif
+    return active;
+  }
+
+  if (active != TelemetrySource_None) {
+    Slot& slot = slots[active];
+    const uint16_t groups = slot.state.takeDirtyGroups();
+    if (groups != 0) arbitratedState.copyGroups(slot.state, groups);
+#if TELEMETRY_SMOOTHING
+    if (groups & GameStateGroup_Speed) speedFilter.measure(slot.state.speed, slot.lastUpdate);
+    if (groups & GameStateGroup_Engine) rpmFilter.measure(slot.state.rpm, slot.lastUpdate);
+#endif
+  }
+  return active;
+}
+
+void TelemetryArbiter::apply(GameState& output, unsigned long now) {
+  const uint16_t groups = arbitratedState.takeDirtyGroups();
+  if (groups != 0) output.copyGroups(arbitratedState, groups);
+  applyFilters(output, now);
+}
+
+const char* TelemetryArbiter::sourceName(TelemetrySource source) {
+  switch (source) {
+    case TelemetrySource_Replay: return "replay";
+    case TelemetrySource_BetterCAN: return "Better_CAN";
+    case TelemetrySource_Forza: return "Forza";
+    case TelemetrySource_Simhub: return "SimHub";
+    case TelemetrySource_Dashboard: return "dashboard";
+    default: return "idle";
+  }
+}
+
+// Replaces the raw speed and rpm copied by apply() with the filter estimates for this pass.
+void TelemetryArbiter::applyFilters(GameState& output, unsigned long now) {
+#if TELEMETRY_SMOOTHING
+  const int speed = speedFilter.estimate(now);
+  const int rpm = rpmFilter.estimate(now);
+  output.setField(output.speed, speed < 0 ? 0 : speed, GameStateGroup_Speed);
+  output.setField(output.rpm, rpm < 0 ? 0 : rpm, GameStateGroup_Engine);
+#else
+  (void)output;
+  (void)now;
+#endif
+}
+
+bool TelemetryArbiter::fresh(const Slot& slot, unsigned long now) const {
+  return slot.seen && (slot.timeout == 0 || now - slot.lastUpdate < slot.timeout);
+}
+
+TelemetrySource TelemetryArbiter::select(unsigned long now) const {
+  TelemetrySource best = TelemetrySource_None;
+  for (uint8_t i = 0; i < TelemetrySource_Count; i++) {
+    if (!fresh(slots[i], now)) continue;
+    if (best == TelemetrySource_None || slots[i].priority < slots[best].priority) {
+      best = static_cast<TelemetrySource>(i);
+    }
+  }
+  return best;
+}
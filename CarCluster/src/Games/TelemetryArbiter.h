@@ -0,0 +1,104 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - telemetry source arbitration
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Every input writes into its own slot instead of the GameState the cluster encodes. The CAN task marks a slot fresh
+// whenever its source delivered something, and arbitrate() copies the highest-priority slot that is still fresh into
+// the arbitrated state: the whole state when the choice changes, afterwards only the groups the slot changed. A source
+// that stops sending for longer than its timeout drops out, and with no fresh source left the cluster falls back to
+// a parked car (ignition off, P, lights and warnings off) that keeps its last fuel, temperatures and backlight.
+// apply() then moves the changed groups into the cluster state.
+//
+// With TELEMETRY_SMOOTHING the speed and rpm of the selected source pass through a TelemetryFilter each, fed with the
+// time each sample reached the CAN task, so the needles move at the CAN frame rate instead of the source rate. Only
+// apply() writes the estimates; the arbitrated state keeps what the source sent, which is what gets recorded.
+//
+// Slots are only touched on the CAN task. Fields outside any group (button events, alerts, cluster feedback) stay on
+// the cluster state and are never arbitrated.
+// ####################################################################################################################
+
+#ifndef TELEMETRY_ARBITER_H
+#define TELEMETRY_ARBITER_H
+
+#include "Arduino.h"
+#include "GameSimulation.h"
+#include "TelemetryFilter.h"
+
+// Default time a source stays selected after its last update.
+#ifndef TELEMETRY_SOURCE_TIMEOUT_MS
+#define TELEMETRY_SOURCE_TIMEOUT_MS 1000
+#endif
+
+#ifndef TELEMETRY_SMOOTHING
+#define TELEMETRY_SMOOTHING 1
+#endif
+
+// Jumps the filters take as they come (km/h, rpm).
+#define TELEMETRY_SMOOTHING_SPEED_STEP 20
+#define TELEMETRY_SMOOTHING_RPM_STEP 1000
+
+// Default priorities follow this order, first wins.
+enum TelemetrySource : uint8_t {
+  TelemetrySource_Replay,
+  TelemetrySource_BetterCAN,
+  TelemetrySource_Forza,
+  TelemetrySource_Simhub,
+  TelemetrySource_Dashboard,
+  TelemetrySource_Count,
+  TelemetrySource_None = TelemetrySource_Count,
+};
+
+class TelemetryArbiter {
+ public:
+  TelemetryArbiter(ClusterConfiguration configuration, unsigned long timeout);
+
+  // The state a source decodes into.
+  GameState& source(TelemetrySource source) { return slots[source].state; }
+
+  void markFresh(TelemetrySource source, unsigned long now);
+  // 0 keeps the source selected until a higher-priority one takes over.
+  void setTimeout(TelemetrySource source, unsigned long timeout) { slots[source].timeout = timeout; }
+  // Lower values win; sources of equal priority keep their enum order.
+  void setPriority(TelemetrySource source, uint8_t priority) { slots[source].priority = priority; }
+
+  // Copies the selected source into the arbitrated state and returns it, TelemetrySource_None when the idle state
+  // applies.
+  TelemetrySource arbitrate(unsigned long now);
+  // What arbitrate() selected, before smoothing; dirtyGroups holds the groups changed since the last apply().
+  const GameState& arbitrated() const { return arbitratedState; }
+  // Copies the arbitrated changes into output and replaces its speed and rpm with the filter estimates.
+  void apply(GameState& output, unsigned long now);
+  TelemetrySource activeSource() const { return active; }
+
+  static const char* sourceName(TelemetrySource source);
+
+ private:
+  struct Slot {
+    explicit Slot(ClusterConfiguration configuration) : state(configuration) {}
+
+    GameState state;
+    unsigned long lastUpdate = 0;
+    unsigned long timeout = 0;
+    uint8_t priority = 0;
+    bool seen = false;
+  };
+
+  bool fresh(const Slot& slot, unsigned long now) const;
+  TelemetrySource select(unsigned long now) const;
+  void applyFilters(GameState& output, unsigned long now);
+
+  Slot slots[TelemetrySource_Count];
+  GameState idleState;
+  GameState arbitratedState;
+  TelemetrySource active = TelemetrySource_None;
+#if TELEMETRY_SMOOTHING
+  TelemetryFilter speedFilter{TELEMETRY_SMOOTHING_SPEED_STEP};
+  TelemetryFilter rpmFilter{TELEMETRY_SMOOTHING_RPM_STEP};
+#endif
+};
+
+#endif
@@ -0,0 +1,80 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - fixed-point alpha-beta filter for needle channels
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "TelemetryFilter.h"
+
+namespace {
+
+// Keep positions, rates and their products well inside int32_t.
+const int kValueLimit = 1 << 20;
+const int64_t kRateLimit = 1 << 24;
+
+int clampValue(int value) {
+  if (value > kValueLimit) return kValueLimit;
+  if (value < -kValueLimit) return -kValueLimit;
+  return value;
+}
+
+int32_t extrapolate(int32_t position, int32_t rate, unsigned long elapsed) {
+  return position + static_cast<int32_t>(static_cast<int64_t>(rate) * static_cast<int64_t>(elapsed) / 256);
+}
+
+}  // namespace
+
+void TelemetryFilter::reset(int value, unsigned long now) {
+  lastValue = clampValue(value);
+  position = static_cast<int32_t>(lastValue) * 256;
+  rate = 0;
+  lastMeasurement = now;
+  horizon = 0;
+  settled = true;
+}
+
+void TelemetryFilter::measure(int value, unsigned long now) {
+  unsigned long interval = now - lastMeasurement;
+  if (interval > TELEMETRY_FILTER_MAX_INTERVAL_MS) {
+    reset(value, now);
+    return;
+  }
+  if (interval == 0) interval = 1;
+
+  value = clampValue(value);
+  const int32_t predicted = extrapolate(position, rate, interval);
+  const int32_t residual = static_cast<int32_t>(value) * 256 - predicted;
+  if (residual > stepLimit * 256 || residual < -stepLimit * 256) {
+    reset(value, now);
+    return;
+  }
+
+  position = predicted + static_cast<int32_t>(static_cast<int64_t>(TELEMETRY_FILTER_ALPHA) * residual / 256);
+  int64_t corrected = rate + static_cast<int64_t>(TELEMETRY_FILTER_BETA) * residual / static_cast<int64_t>(interval);
+  if (corrected > kRateLimit) corrected = kRateLimit;
+  if (corrected < -kRateLimit) corrected = -kRateLimit;
+  rate = static_cast<int32_t>(corrected);
+
+  lastValue = value;
+  lastMeasurement = now;
+  horizon = interval < TELEMETRY_FILTER_MAX_EXTRAPOLATION_MS ? interval : TELEMETRY_FILTER_MAX_EXTRAPOLATION_MS;
+  settled = false;
+}
+
+int TelemetryFilter::estimate(unsigned long now) {
+  if (settled) return lastValue;
+
+  const unsigned long elapsed = now - lastMeasurement;
+  if (elapsed >= 2 * horizon) {
+    position = static_cast<int32_t>(lastValue) * 256;
+    rate = 0;
+    settled = true;
+    return lastValue;
+  }
+
+  const int32_t ahead = extrapolate(position, rate, elapsed < horizon ? elapsed : horizon);
+  return static_cast<int>((ahead + 128) >> 8);
+}
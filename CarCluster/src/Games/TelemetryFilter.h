@@ -0,0 +1,55 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - fixed-point alpha-beta filter for needle channels
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Games send speed and rpm at 30-60 Hz while the cluster frames go out every 20 ms, so raw values move the needles in
+// visible steps. Each measurement corrects a position and rate estimate (alpha-beta filter); between measurements
+// estimate() extrapolates along the rate for at most one measurement interval and then holds. A channel that gets no
+// new measurement for two intervals settles on the last measured value, so a source that only sends on change, or
+// stops changing, ends exactly where it said. A measurement further than the step limit from the prediction (a gear
+// change, a car reset) restarts the filter on it instead of ringing around the new value.
+//
+// Position is kept in 1/256 units and the rate in 1/65536 units per millisecond; no floating point on the CAN task.
+// ####################################################################################################################
+
+#ifndef TELEMETRY_FILTER_H
+#define TELEMETRY_FILTER_H
+
+#include <stdint.h>
+
+// Gains in 1/256: how much of the prediction error corrects the position and the rate.
+#ifndef TELEMETRY_FILTER_ALPHA
+#define TELEMETRY_FILTER_ALPHA 128
+#endif
+
+#ifndef TELEMETRY_FILTER_BETA
+#define TELEMETRY_FILTER_BETA 43
+#endif
+
+// Longest extrapolation; measurements further apart than TELEMETRY_FILTER_MAX_INTERVAL_MS restart the filter.
+#define TELEMETRY_FILTER_MAX_EXTRAPOLATION_MS 100
+#define TELEMETRY_FILTER_MAX_INTERVAL_MS 250
+
+class TelemetryFilter {
+ public:
+  explicit TelemetryFilter(int stepLimit) : stepLimit(stepLimit) {}
+
+  void reset(int value, unsigned long now);
+  void measure(int value, unsigned long now);
+  int estimate(unsigned long now);
+
+ private:
+  int stepLimit;
+  int32_t position = 0;  // 1/256 units
+  int32_t rate = 0;      // 1/65536 units per ms
+  int lastValue = 0;
+  unsigned long lastMeasurement = 0;
+  unsigned long horizon = 0;
+  bool settled = true;
+};
+
+#endif
@@ -0,0 +1,266 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - binary telemetry log format
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "TelemetryLog.h"
+
+#include <string.h>
+
+namespace {
+
+const uint8_t kHeader[TELEMETRY_LOG_HEADER_SIZE] = {'C', 'C', 'T', TELEMETRY_LOG_VERSION};
+
+// Payload bytes per group, in GameStateGroup bit order.
+const uint8_t kGroupPayloadSizes[] = {2, 3, 3, 6, 5, 1, 1, 3, 5};
+
+class RecordWriter {
+ public:
+  explicit RecordWriter(uint8_t* out) : out(out) {}
+
+  void u8(uint8_t value) { out[length++] = value; }
+
+  void u16(uint16_t value) {
+    u8(static_cast<uint8_t>(value));
+    u8(static_cast<uint8_t>(value >> 8));
+  }
+
+  void u32(uint32_t value) {
+    u16(static_cast<uint16_t>(value));
+    u16(static_cast<uint16_t>(value >> 16));
+  }
+
+  void i16(int value) {
+    if (value > INT16_MAX) value = INT16_MAX;
+    if (value < INT16_MIN) value = INT16_MIN;
+    u16(static_cast<uint16_t>(static_cast<int16_t>(value)));
+  }
+
+  void f32(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    u32(bits);
+  }
+
+  void varint(uint32_t value) {
+    while (value >= 0x80) {
+      u8(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    u8(static_cast<uint8_t>(value));
+  }
+
+  size_t length = 0;
+
+ private:
+  uint8_t* out;
+};
+
+class RecordReader {
+ public:
+  RecordReader(const uint8_t* in, size_t length) : in(in), length(length) {}
+
+  bool available(size_t count) const { return position + count <= length; }
+
+  uint8_t u8() { return in[position++]; }
+
+  uint16_t u16() {
+    const uint16_t low = u8();
+    return static_cast<uint16_t>(low | (u8() << 8));
+  }
+
+  uint32_t u32() {
+    const uint32_t low = u16();
+    return low | (static_cast<uint32_t>(u16()) << 16);
+  }
+
+  int i16() { return static_cast<int16_t>(u16()); }
+
+  float f32() {
+    const uint32_t bits = u32();
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  bool varint(uint32_t* value) {
+    *value = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7) {
+      if (!available(1)) return false;
+      const uint8_t byte = u8();
+      *value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+  }
+
+  size_t position = 0;
+
+ private:
+  const uint8_t* in;
+  size_t length;
+};
+
+uint8_t packBits(bool b0, bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7) {
+  return static_cast<uint8_t>(b0 | (b1 << 1) | (b2 << 2) | (b3 << 3) | (b4 << 4) | (b5 << 5) | (b6 << 6) | (b7 << 7));
+}
+
+bool bit(uint16_t bits, uint8_t index) {
+  return (bits >> index) & 1;
+}
+
+}  // namespace
+
+size_t encodeTelemetryLogHeader(uint8_t* out) {
+  memcpy(out, kHeader, sizeof(kHeader));
+  return sizeof(kHeader);
+}
+
+bool isTelemetryLogHeader(const uint8_t* in, size_t length) {
+  return length >= sizeof(kHeader) && memcmp(in, kHeader, sizeof(kHeader)) == 0;
+}
+
+size_t encodeTelemetryRecord(uint8_t* out, uint32_t deltaMs, const GameState& state, uint16_t groups) {
+  RecordWriter writer(out);
+  groups &= GameStateGroup_All;
+  writer.varint(deltaMs);
+  writer.u16(groups);
+
+  if (groups & GameStateGroup_Speed) {
+    writer.i16(state.speed);
+  }
+  if (groups & GameStateGroup_Engine) {
+    writer.i16(state.rpm);
+    writer.u8(packBits(state.engineRunning, state.ignition, false, false, false, false, false, false));
+  }
+  if (groups & GameStateGroup_Gear) {
+    writer.u8(static_cast<uint8_t>(state.gear));
+    writer.u8(static_cast<uint8_t>(state.gearLetter));
+    writer.u8(state.gearIndex);
+  }
+  if (groups & GameStateGroup_Temperature) {
+    writer.i16(state.coolantTemperature);
+    writer.i16(state.oilTemperature);
+    writer.i16(state.outdoorTemperature);
+  }
+  if (groups & GameStateGroup_Fuel) {
+    writer.f32(state.fuelQuantity);
+    writer.u8(state.lowFuelLight);
+  }
+  if (groups & GameStateGroup_Lights) {
+    writer.u8(packBits(state.leftTurningIndicator, state.rightTurningIndicator, state.turningIndicatorsBlinking,
+                       state.mainLights, state.brakeLights, state.rearFogLight, state.frontFogLight,
+                       state.highBeam));
+  }
+  if (groups & GameStateGroup_Body) {
+    writer.u8(packBits(state.doorOpen, state.doorFL, state.doorFR, state.doorRL, state.doorRR, state.trunkOpen,
+                       state.hoodOpen, state.handbrake));
+  }
+  if (groups & GameStateGroup_Warnings) {
+    writer.u8(state.driveMode);
+    writer.u16(static_cast<uint16_t>(
+        packBits(state.offroadLight, state.absLight, state.batteryLight, state.oilLight, state.engineLight,
+                 state.escActive, state.escDisabled, state.hasESC) |
+        packBits(state.tcsActive, state.hasTCS, state.tireDefFL, state.tireDefFR, state.tireDefRL, state.tireDefRR,
+                 false, false) << 8));
+  }
+  if (groups & GameStateGroup_Dashboard) {
+    writer.u8(state.backlightBrightness);
+    writer.u32(static_cast<uint32_t>(state.time));
+  }
+
+  return writer.length;
+}
+
+size_t decodeTelemetryRecord(const uint8_t* in, size_t length, uint32_t* deltaMs, GameState& state) {
+  RecordReader reader(in, length);
+  if (!reader.varint(deltaMs) || !reader.available(2)) return 0;
+
+  const uint16_t groups = reader.u16();
+  if (groups & ~GameStateGroup_All) return 0;
+
+  size_t payloadSize = 0;
+  for (uint8_t i = 0; i < sizeof(kGroupPayloadSizes); i++) {
+    if (groups & (1 << i)) payloadSize += kGroupPayloadSizes[i];
+  }
+  if (!reader.available(payloadSize)) return 0;
+
+  if (groups & GameStateGroup_Speed) {
+    state.setField(state.speed, reader.i16(), GameStateGroup_Speed);
+  }
+  if (groups & GameStateGroup_Engine) {
+    state.setField(state.rpm, reader.i16(), GameStateGroup_Engine);
+    const uint8_t flags = reader.u8();
+    state.setField(state.engineRunning, bit(flags, 0), GameStateGroup_Engine);
+    state.setField(state.ignition, bit(flags, 1), GameStateGroup_Engine);
+  }
+  if (groups & GameStateGroup_Gear) {
+    state.setField(state.gear, static_cast<GearState>(reader.u8()), GameStateGroup_Gear);
+    state.setField(state.gearLetter, static_cast<char>(reader.u8()), GameStateGroup_Gear);
+    state.setField(state.gearIndex, reader.u8(), GameStateGroup_Gear);
+  }
+  if (groups & GameStateGroup_Temperature) {
+    state.setField(state.coolantTemperature, reader.i16(), GameStateGroup_Temperature);
+    state.setField(state.oilTemperature, reader.i16(), GameStateGroup_Temperature);
+    state.setField(state.outdoorTemperature, reader.i16(), GameStateGroup_Temperature);
+  }
+  if (groups & GameStateGroup_Fuel) {
+    state.setField(state.fuelQuantity, reader.f32(), GameStateGroup_Fuel);
+    state.setField(state.lowFuelLight, reader.u8() != 0, GameStateGroup_Fuel);
+  }
+  if (groups & GameStateGroup_Lights) {
+    const uint8_t lights = reader.u8();
+    state.setField(state.leftTurningIndicator, bit(lights, 0), GameStateGroup_Lights);
+    state.setField(state.rightTurningIndicator, bit(lights, 1), GameStateGroup_Lights);
+    state.setField(state.turningIndicatorsBlinking, bit(lights, 2), GameStateGroup_Lights);
+    state.setField(state.mainLights, bit(lights, 3), GameStateGroup_Lights);
+    state.setField(state.brakeLights, bit(lights, 4), GameStateGroup_Lights);
+    state.setField(state.rearFogLight, bit(lights, 5), GameStateGroup_Lights);
+    state.setField(state.frontFogLight, bit(lights, 6), GameStateGroup_Lights);
+    state.setField(state.highBeam, bit(lights, 7), GameStateGroup_Lights);
+  }
+  if (groups & GameStateGroup_Body) {
+    const uint8_t body = reader.u8();
+    state.setField(state.doorOpen, bit(body, 0), GameStateGroup_Body);
+    state.setField(state.doorFL, bit(body, 1), GameStateGroup_Body);
+    state.setField(state.doorFR, bit(body, 2), GameStateGroup_Body);
+    state.setField(state.doorRL, bit(body, 3), GameStateGroup_Body);
+    state.setField(state.doorRR, bit(body, 4), GameStateGroup_Body);
+    state.setField(state.trunkOpen, bit(body, 5), GameStateGroup_Body);
+    state.setField(state.hoodOpen, bit(body, 6), GameStateGroup_Body);
+    state.setField(state.handbrake, bit(body, 7), GameStateGroup_Body);
+  }
+  if (groups & GameStateGroup_Warnings) {
+    state.setField(state.driveMode, reader.u8(), GameStateGroup_Warnings);
+    const uint16_t warnings = reader.u16();
+    state.setField(state.offroadLight, bit(warnings, 0), GameStateGroup_Warnings);
+    state.setField(state.absLight, bit(warnings, 1), GameStateGroup_Warnings);
+    state.setField(state.batteryLight, bit(warnings, 2), GameStateGroup_Warnings);
+    state.setField(state.oilLight, bit(warnings, 3), GameStateGroup_Warnings);
+    state.setField(state.engineLight, bit(warnings, 4), GameStateGroup_Warnings);
+    state.setField(state.escActive, bit(warnings, 5), GameStateGroup_Warnings);
+    state.setField(state.escDisabled, bit(warnings, 6), GameStateGroup_Warnings);
+    state.setField(state.hasESC, bit(warnings, 7), GameStateGroup_Warnings);
+    state.setField(state.tcsActive, bit(warnings, 8), GameStateGroup_Warnings);
+    state.setField(state.hasTCS, bit(warnings, 9), GameStateGroup_Warnings);
+    state.setField(state.tireDefFL, bit(warnings, 10), GameStateGroup_Warnings);
+    state.setField(state.tireDefFR, bit(warnings, 11), GameStateGroup_Warnings);
+    state.setField(state.tireDefRL, bit(warnings, 12), GameStateGroup_Warnings);
+    state.setField(state.tireDefRR, bit(warnings, 13), GameStateGroup_Warnings);
+  }
+  if (groups & GameStateGroup_Dashboard) {
+    state.setField(state.backlightBrightness, reader.u8(), GameStateGroup_Dashboard);
+    state.setField(state.time, reader.u32(), GameStateGroup_Dashboard);
+  }
+
+  return reader.position;
+}
+
+bool peekTelemetryRecordDelta(const uint8_t* in, size_t length, uint32_t* deltaMs) {
+  RecordReader reader(in, length);
+  return reader.varint(deltaMs);
+}
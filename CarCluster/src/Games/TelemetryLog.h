@@ -0,0 +1,50 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - binary telemetry log format
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// A telemetry log is a 4-byte header followed by one record per GameState change:
+//
+//   header:  'C' 'C' 'T' version
+//   record:  deltaMs (LEB128 varint) | groups (uint16 LE) | payload of every group in groups, lowest bit first
+//
+// deltaMs is the time since the previous record, so a replay can rebuild the original timing exactly. Only the field
+// groups that changed are stored, packed little-endian with booleans folded into bit fields; the first record of a log
+// carries GameStateGroup_All so a replay starts from a complete state. Pure byte-buffer code, shared by the firmware
+// recorder and replay and by the host tools.
+// ####################################################################################################################
+
+#ifndef TELEMETRY_LOG_H
+#define TELEMETRY_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "GameSimulation.h"
+
+#define TELEMETRY_LOG_VERSION 1
+#define TELEMETRY_LOG_HEADER_SIZE 4
+
+// Worst case: 5-byte delta, 2-byte group mask and all nine group payloads (29 bytes).
+#define TELEMETRY_LOG_MAX_RECORD_SIZE 36
+
+// Writes the header into out, which must hold TELEMETRY_LOG_HEADER_SIZE bytes.
+size_t encodeTelemetryLogHeader(uint8_t* out);
+bool isTelemetryLogHeader(const uint8_t* in, size_t length);
+
+// Writes one record with the given groups of state into out, which must hold TELEMETRY_LOG_MAX_RECORD_SIZE bytes.
+// Returns the record length.
+size_t encodeTelemetryRecord(uint8_t* out, uint32_t deltaMs, const GameState& state, uint16_t groups);
+
+// Reads one record from in and applies its fields to state with setField(), so only the values that differ are
+// flagged dirty. Returns the bytes consumed, or 0 when in holds no complete record or the record is malformed; call
+// again with more data when length < TELEMETRY_LOG_MAX_RECORD_SIZE.
+size_t decodeTelemetryRecord(const uint8_t* in, size_t length, uint32_t* deltaMs, GameState& state);
+
+// Reads only the delta of the record at in, so a player can wait for it to fall due before applying it.
+bool peekTelemetryRecordDelta(const uint8_t* in, size_t length, uint32_t* deltaMs);
+
+#endif
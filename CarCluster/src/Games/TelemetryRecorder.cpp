@@ -0,0 +1,133 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - telemetry recording to LittleFS
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "TelemetryRecorder.h"
+
+static_assert((TELEMETRY_RECORDER_QUEUE_SIZE & (TELEMETRY_RECORDER_QUEUE_SIZE - 1)) == 0,
+              "TELEMETRY_RECORDER_QUEUE_SIZE must be a power of two");
+static_assert(TELEMETRY_RECORDER_BUFFER_SIZE <= TELEMETRY_RECORDER_QUEUE_SIZE,
+              "TELEMETRY_RECORDER_BUFFER_SIZE must fit the queue");
+
+void TelemetryRecorder::capture(const GameState& game, unsigned long now) {
+  if (!active.load(std::memory_order_acquire)) return;
+
+  const uint32_t requested = startRequests.load(std::memory_order_acquire);
+  if (requested != startsAcknowledged.load(std::memory_order_relaxed)) {
+    // Records already in the ring belong to the previous recording; the first one of this session is a complete
+    // state at delta 0.
+    resync = true;
+    lastCaptureTime = now;
+    records.store(0, std::memory_order_relaxed);
+    sessionStart.store(queueWritten.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    startsAcknowledged.store(requested, std::memory_order_release);
+  }
+
+  uint16_t groups = game.dirtyGroups;
+  if (resync) groups = GameStateGroup_All;
+  if (groups == 0) return;
+
+  const uint32_t end = queueWritten.load(std::memory_order_relaxed);
+  if (TELEMETRY_RECORDER_QUEUE_SIZE - (end - queueRead.load(std::memory_order_acquire)) <
+      TELEMETRY_LOG_MAX_RECORD_SIZE) {
+    // Changes dropped here are only caught up by a complete state.
+    resync = true;
+    return;
+  }
+
+  uint8_t record[TELEMETRY_LOG_MAX_RECORD_SIZE];
+  const size_t length =
+      encodeTelemetryRecord(record, static_cast<uint32_t>(now - lastCaptureTime), game, groups);
+  for (size_t i = 0; i < length; i++) queue[(end + i) % TELEMETRY_RECORDER_QUEUE_SIZE] = record[i];
+  queueWritten.store(end + length, std::memory_order_release);
+
+  lastCaptureTime = now;
+  resync = false;
+  records.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool TelemetryRecorder::start(const char* path) {
+  stop();
+
+  file = fileSystem.open(path, FILE_WRITE);
+  if (!file) {
+    Serial.printf("[Telemetry] Cannot create %s\n", path);
+    return false;
+  }
+
+  uint8_t header[TELEMETRY_LOG_HEADER_SIZE];
+  written = file.write(header, encodeTelemetryLogHeader(header));
+
+  lastFlushTime = millis();
+  sessionPending = true;
+  startRequests.fetch_add(1, std::memory_order_release);
+  active.store(true, std::memory_order_release);
+
+  Serial.printf("[Telemetry] Recording to %s\n", path);
+  return true;
+}
+
+void TelemetryRecorder::stop() {
+  active = false;
+  if (!file) return;
+
+  flush();
+  if (!file) return;
+  file.close();
+  Serial.printf("[Telemetry] Recorded %lu records, %lu bytes\n",
+                static_cast<unsigned long>(records.load()),
+                static_cast<unsigned long>(written));
+}
+
+void TelemetryRecorder::service() {
+  if (!file || !sessionStarted()) return;
+
+  const uint32_t pending = queueWritten.load(std::memory_order_acquire) - queueRead.load(std::memory_order_relaxed);
+  if (pending >= TELEMETRY_RECORDER_BUFFER_SIZE ||
+      (pending > 0 && millis() - lastFlushTime >= TELEMETRY_RECORDER_FLUSH_INTERVAL)) {
+    flush();
+  }
+}
+
+// Once the CAN task has acknowledged start(), skips what was queued before the session began.
+bool TelemetryRecorder::sessionStarted() {
+  if (!sessionPending) return true;
+  if (startsAcknowledged.load(std::memory_order_acquire) != startRequests.load(std::memory_order_relaxed)) return false;
+
+  queueRead.store(sessionStart.load(std::memory_order_relaxed), std::memory_order_release);
+  sessionPending = false;
+  return true;
+}
+
+// Writes everything queued so far, in at most two pieces when the ring wraps.
+bool TelemetryRecorder::flush() {
+  lastFlushTime = millis();
+  if (!sessionStarted()) return true;
+
+  const uint32_t end = queueWritten.load(std::memory_order_acquire);
+  uint32_t start = queueRead.load(std::memory_order_relaxed);
+  while (start != end) {
+    const uint32_t offset = start % TELEMETRY_RECORDER_QUEUE_SIZE;
+    uint32_t pending = end - start;
+    if (pending > TELEMETRY_RECORDER_QUEUE_SIZE - offset) pending = TELEMETRY_RECORDER_QUEUE_SIZE - offset;
+
+    const size_t count = file.write(queue + offset, pending);
+    written += count;
+    start += pending;
+    queueRead.store(start, std::memory_order_release);
+    if (count == pending) continue;
+
+    // A short write means the partition is full; keep what made it to flash.
+    active = false;
+    file.close();
+    Serial.printf("[Telemetry] Flash full, recording stopped after %lu records\n",
+                  static_cast<unsigned long>(records.load()));
+    return false;
+  }
+  return true;
+}
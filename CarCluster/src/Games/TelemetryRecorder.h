@@ -0,0 +1,88 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - telemetry recording to LittleFS
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Streams the arbitrated GameState, whatever its source and before smoothing, into a TelemetryLog file. The CAN task encodes
+// one record per pass that changed something, timestamped when it was captured, into a single-producer byte ring; the
+// network task does all flash writes, which can stall for milliseconds while LittleFS erases a block. The ring is
+// written out in TELEMETRY_RECORDER_BUFFER_SIZE chunks, at least every TELEMETRY_RECORDER_FLUSH_INTERVAL ms. When a
+// stall fills it the CAN task skips records and restarts with a complete state once there is room again.
+//
+// start() runs on the network task while capture() may be half way through a record, so it never touches the ring or
+// the CAN task's state. It publishes a start request instead; the next capture() starts the session in its own task
+// and acknowledges it with the ring position the session begins at. Until then the network task writes nothing.
+// ####################################################################################################################
+
+#ifndef TELEMETRY_RECORDER_H
+#define TELEMETRY_RECORDER_H
+
+#include <atomic>
+
+#include "Arduino.h"
+#include "FS.h"
+#include "GameSimulation.h"
+#include "TelemetryLog.h"
+
+#ifndef TELEMETRY_RECORDER_BUFFER_SIZE
+#define TELEMETRY_RECORDER_BUFFER_SIZE 512
+#endif
+
+// Records waiting for the network task; a power of two. About four seconds of a 50 Hz Better_CAN session.
+#ifndef TELEMETRY_RECORDER_QUEUE_SIZE
+#define TELEMETRY_RECORDER_QUEUE_SIZE 2048
+#endif
+
+#ifndef TELEMETRY_RECORDER_FLUSH_INTERVAL
+#define TELEMETRY_RECORDER_FLUSH_INTERVAL 1000
+#endif
+
+class TelemetryRecorder {
+ public:
+  explicit TelemetryRecorder(fs::FS& fileSystem) : fileSystem(fileSystem) {}
+
+  // CAN task: call with TelemetryArbiter::arbitrated() between arbitrate() and apply(), which collects its dirty
+  // groups. now is the time the record is stamped with.
+  void capture(const GameState& game, unsigned long now);
+
+  // Network task.
+  bool start(const char* path);
+  void stop();
+  void service();
+
+  bool recording() const { return active.load(std::memory_order_relaxed); }
+  uint32_t recordCount() const { return records.load(std::memory_order_relaxed); }
+  uint32_t bytesWritten() const { return written; }
+
+ private:
+  bool sessionStarted();
+  bool flush();
+
+  fs::FS& fileSystem;
+  File file;
+
+  std::atomic<bool> active{false};
+  std::atomic<uint32_t> records{0};
+
+  // Start handoff: the network task bumps startRequests, the CAN task answers by storing sessionStart and then
+  // startsAcknowledged.
+  std::atomic<uint32_t> startRequests{0};
+  std::atomic<uint32_t> startsAcknowledged{0};
+  std::atomic<uint32_t> sessionStart{0};
+
+  // Free-running byte counters of the ring; only the CAN task advances queueWritten, only the network task queueRead.
+  uint8_t queue[TELEMETRY_RECORDER_QUEUE_SIZE];
+  std::atomic<uint32_t> queueWritten{0};
+  std::atomic<uint32_t> queueRead{0};
+
+  bool resync = true;                 // CAN task only
+  unsigned long lastCaptureTime = 0;  // CAN task only
+  unsigned long lastFlushTime = 0;    // network task only
+  uint32_t written = 0;               // network task only
+  bool sessionPending = false;        // network task only
+};
+
+#endif
@@ -0,0 +1,123 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - telemetry replay from LittleFS
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "TelemetryReplayGame.h"
+
+#include <string.h>
+
+TelemetryReplayGame::TelemetryReplayGame(GameState& game, fs::FS& fileSystem)
+    : Game(game), fileSystem(fileSystem), replayState(game.configuration), snapshot(game.configuration) {
+  replayState.takeDirtyGroups();
+}
+
+bool TelemetryReplayGame::update() {
+  const bool merged = snapshot.mergeInto(gameState);
+  return merged || active.load(std::memory_order_acquire);
+}
+
+bool TelemetryReplayGame::start(const char* path, uint8_t speed, bool loop) {
+  stop();
+
+  file = fileSystem.open(path, FILE_READ);
+  if (!file) {
+    Serial.printf("[Telemetry] Cannot open %s\n", path);
+    return false;
+  }
+
+  uint8_t header[TELEMETRY_LOG_HEADER_SIZE];
+  if (file.read(header, sizeof(header)) != sizeof(header) || !isTelemetryLogHeader(header, sizeof(header))) {
+    Serial.printf("[Telemetry] %s is not a telemetry log\n", path);
+    file.close();
+    return false;
+  }
+
+  this->speed = speed < 1 ? 1 : (speed > TELEMETRY_REPLAY_MAX_SPEED ? TELEMETRY_REPLAY_MAX_SPEED : speed);
+  looping = loop;
+  played = 0;
+  playedSinceRewind = 0;
+  bufferStart = 0;
+  bufferEnd = 0;
+  logTime = 0;
+  startTime = millis();
+  active.store(true, std::memory_order_release);
+
+  Serial.printf("[Telemetry] Replaying %s at %ux\n", path, this->speed);
+  return true;
+}
+
+void TelemetryReplayGame::stop() {
+  if (!file) return;
+  file.close();
+  active.store(false, std::memory_order_release);
+  Serial.printf("[Telemetry] Replay stopped after %lu records\n", static_cast<unsigned long>(played));
+}
+
+void TelemetryReplayGame::service() {
+  if (!file) return;
+
+  uint64_t elapsed = static_cast<uint64_t>(millis() - startTime) * speed;
+  for (;;) {
+    if (bufferEnd - bufferStart < TELEMETRY_LOG_MAX_RECORD_SIZE) fill();
+    const size_t available = bufferEnd - bufferStart;
+
+    uint32_t deltaMs = 0;
+    size_t used = 0;
+    if (available > 0 && peekTelemetryRecordDelta(buffer + bufferStart, available, &deltaMs)) {
+      if (logTime + static_cast<uint64_t>(deltaMs) > elapsed) break;
+      used = decodeTelemetryRecord(buffer + bufferStart, available, &deltaMs, replayState);
+    }
+
+    if (used == 0) {
+      // fill() leaves less than a full record only at the end of the file, where a truncated record from a recording
+      // cut short is expected. Anything else is corrupt.
+      if (available >= TELEMETRY_LOG_MAX_RECORD_SIZE) {
+        Serial.println("[Telemetry] Corrupt record, replay stopped");
+        stop();
+        break;
+      }
+      if (!rewind()) break;
+      elapsed = 0;
+      continue;
+    }
+
+    bufferStart += used;
+    logTime += deltaMs;
+    played++;
+    playedSinceRewind++;
+  }
+
+  if (replayState.dirtyGroups != 0) snapshot.publish(replayState);
+}
+
+void TelemetryReplayGame::fill() {
+  if (bufferStart > 0) {
+    memmove(buffer, buffer + bufferStart, bufferEnd - bufferStart);
+    bufferEnd -= bufferStart;
+    bufferStart = 0;
+  }
+
+  const int count = file.read(buffer + bufferEnd, sizeof(buffer) - bufferEnd);
+  if (count > 0) bufferEnd += count;
+}
+
+// Starts over at the first record, which carries the complete state, or ends the replay.
+bool TelemetryReplayGame::rewind() {
+  if (!looping || playedSinceRewind == 0) {
+    stop();
+    return false;
+  }
+
+  file.seek(TELEMETRY_LOG_HEADER_SIZE);
+  bufferStart = 0;
+  bufferEnd = 0;
+  logTime = 0;
+  playedSinceRewind = 0;
+  startTime = millis();
+  return true;
+}
@@ -0,0 +1,68 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - telemetry replay from LittleFS
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Plays a TelemetryRecorder log back as if the game were running. The network task reads the file and applies every
+// record that has fallen due; the CAN task merges the result like any UDP game. Due times come from the log's own
+// timestamps against one start time, so playback never drifts and a late pass catches up on every record it missed.
+// Speed 2-16 plays the log that many times faster.
+// ####################################################################################################################
+
+#ifndef TELEMETRY_REPLAY_GAME_H
+#define TELEMETRY_REPLAY_GAME_H
+
+#include "Arduino.h"
+#include "FS.h"
+#include <atomic>
+
+#include "GameSimulation.h"
+#include "GameStateSnapshot.h"
+#include "TelemetryLog.h"
+
+#define TELEMETRY_REPLAY_MAX_SPEED 16
+
+class TelemetryReplayGame : public Game {
+ public:
+  TelemetryReplayGame(GameState& game, fs::FS& fileSystem);
+  void begin() override {}
+  // CAN task. Returns true while a replay is playing or when it published a final state.
+  bool update();
+
+  // Network task.
+  bool start(const char* path, uint8_t speed, bool loop);
+  void stop();
+  void service();
+
+  bool playing() const { return static_cast<bool>(file); }
+  uint8_t playbackSpeed() const { return speed; }
+  uint32_t recordsPlayed() const { return played; }
+
+ private:
+  void fill();
+  bool rewind();
+
+  fs::FS& fileSystem;
+  File file;
+  uint8_t speed = 1;
+  bool looping = false;
+  std::atomic<bool> active{false};  // file is open; read by the CAN task
+
+  unsigned long startTime = 0;
+  uint32_t logTime = 0;
+  uint32_t played = 0;
+  uint32_t playedSinceRewind = 0;
+
+  uint8_t buffer[256];
+  size_t bufferStart = 0;
+  size_t bufferEnd = 0;
+
+  // Decoded on the network task only; the CAN task sees it through the snapshot.
+  GameState replayState;
+  GameStateSnapshot snapshot;
+};
+
+#endif
@@ -231,7 +231,7 @@ INT8U MCP_CAN::mcp2515_requestNewMode(const INT8U newmode)
 *********************************************************************************************************/
 INT8U MCP_CAN::mcp2515_configRate(const INT8U canSpeed, const INT8U canClock)            
 {
-    INT8U set, cfg1, cfg2, cfg3;
+    INT8U set, cfg1 = 0, cfg2 = 0, cfg3 = 0;
     set = 1;
     switch (canClock & MCP_CLOCK_SELECT)
     {
@@ -650,13 +650,12 @@ INT8U MCP_CAN::mcp2515_init(const INT8U canIDMode, const INT8U canSpeed, const I
 }
 
 /*********************************************************************************************************
-** Function name:           mcp2515_write_id
-** Descriptions:            Write CAN ID
+** Function name:           mcp2515_encode_id
+** Descriptions:            Packs a CAN ID into the SIDH, SIDL, EID8, EID0 register layout
 *********************************************************************************************************/
-void MCP_CAN::mcp2515_write_id( const INT8U mcp_addr, const INT8U ext, const INT32U id )
+void MCP_CAN::mcp2515_encode_id( const INT8U ext, const INT32U id, INT8U tbufdata[] )
 {
     uint16_t canid;
-    INT8U tbufdata[4];
 
     canid = (uint16_t)(id & 0x0FFFF);
 
@@ -677,8 +676,6 @@ void MCP_CAN::mcp2515_write_id( const INT8U mcp_addr, const INT8U ext, const INT
         tbufdata[MCP_EID0] = 0;
         tbufdata[MCP_EID8] = 0;
     }
-    
-    mcp2515_setRegisterS( mcp_addr, tbufdata, 4 );
 }
 
 /*********************************************************************************************************
@@ -715,18 +712,12 @@ void MCP_CAN::mcp2515_write_mf( const INT8U mcp_addr, const INT8U ext, const INT
 }
 
 /*********************************************************************************************************
-** Function name:           mcp2515_read_id
-** Descriptions:            Read CAN ID
+** Function name:           mcp2515_decode_id
+** Descriptions:            Unpacks a CAN ID from the SIDH, SIDL, EID8, EID0 register layout
 *********************************************************************************************************/
-void MCP_CAN::mcp2515_read_id( const INT8U mcp_addr, INT8U* ext, INT32U* id )
+void MCP_CAN::mcp2515_decode_id( const INT8U tbufdata[], INT8U* ext, INT32U* id )
 {
-    INT8U tbufdata[4];
-
     *ext = 0;
-    *id = 0;
-
-    mcp2515_readRegisterS( mcp_addr, tbufdata, 4 );
-
     *id = (tbufdata[MCP_SIDH]<<3) + (tbufdata[MCP_SIDL]>>5);
 
     if ( (tbufdata[MCP_SIDL] & MCP_TXB_EXIDE_M) ==  MCP_TXB_EXIDE_M ) 
@@ -741,44 +732,73 @@ void MCP_CAN::mcp2515_read_id( const INT8U mcp_addr, INT8U* ext, INT32U* id )
 
 /*********************************************************************************************************
 ** Function name:           mcp2515_write_canMsg
-** Descriptions:            Write message
+** Descriptions:            Write message. LOAD TX BUFFER moves ID, DLC and data in one chip-select window
+**                          instead of one register write per field.
 *********************************************************************************************************/
 void MCP_CAN::mcp2515_write_canMsg( const INT8U buffer_sidh_addr)
 {
-    INT8U mcp_addr;
-    mcp_addr = buffer_sidh_addr;
-    mcp2515_setRegisterS(mcp_addr+5, m_nDta, m_nDlc );                  /* write data bytes             */
-	
-    if ( m_nRtr == 1)                                                   /* if RTR set bit in byte       */
-        m_nDlc |= MCP_RTR_MASK;  
+    INT8U frame[1 + 5 + MAX_CHAR_IN_MESSAGE];
+    INT8U len = m_nDlc > MAX_CHAR_IN_MESSAGE ? MAX_CHAR_IN_MESSAGE : m_nDlc;
+    INT8U i;
 
-    mcp2515_setRegister((mcp_addr+4), m_nDlc );                         /* write the RTR and DLC        */
-    mcp2515_write_id(mcp_addr, m_nExtFlg, m_nID );                      /* write CAN id                 */
+    frame[0] = MCP_LOAD_TX0 + (((buffer_sidh_addr - 1 - MCP_TXB0CTRL) >> 4) << 1);
+    mcp2515_encode_id(m_nExtFlg, m_nID, &frame[1]);
+    frame[5] = len | (m_nRtr == 1 ? MCP_RTR_MASK : 0);                  /* RTR and DLC                  */
+    for (i = 0; i < len; i++)
+        frame[6 + i] = m_nDta[i];
+
+    mcpSPI->beginTransaction(SPISettings(10000000, MSBFIRST, SPI_MODE0));
+    MCP2515_SELECT();
+    mcpSPI->transfer(frame, 6 + len);
+    MCP2515_UNSELECT();
+    mcpSPI->endTransaction();
+}
+
+/*********************************************************************************************************
+** Function name:           mcp2515_requestToSend
+** Descriptions:            Sets TXREQ of one TX buffer with the single-byte RTS instruction
+*********************************************************************************************************/
+void MCP_CAN::mcp2515_requestToSend( const INT8U buffer_sidh_addr)
+{
+    static const INT8U rts[MCP_N_TXBUFFERS] = { MCP_RTS_TX0, MCP_RTS_TX1, MCP_RTS_TX2 };
 
+    mcpSPI->beginTransaction(SPISettings(10000000, MSBFIRST, SPI_MODE0));
+    MCP2515_SELECT();
+    spi_readwrite(rts[(buffer_sidh_addr - 1 - MCP_TXB0CTRL) >> 4]);
+    MCP2515_UNSELECT();
+    mcpSPI->endTransaction();
 }
 
 /*********************************************************************************************************
 ** Function name:           mcp2515_read_canMsg
-** Descriptions:            Read message
+** Descriptions:            Read message. READ RX BUFFER returns ID, DLC and data in one chip-select window
+**                          and clears the buffer's RXnIF flag when CS is released.
 *********************************************************************************************************/
 void MCP_CAN::mcp2515_read_canMsg( const INT8U buffer_sidh_addr)        /* read can msg                 */
 {
-    INT8U mcp_addr, ctrl;
-
-    mcp_addr = buffer_sidh_addr;
+    INT8U header[5];
+    INT8U i;
 
-    mcp2515_read_id( mcp_addr, &m_nExtFlg,&m_nID );
+    mcpSPI->beginTransaction(SPISettings(10000000, MSBFIRST, SPI_MODE0));
+    MCP2515_SELECT();
+    spi_readwrite(buffer_sidh_addr == MCP_RXBUF_0 ? MCP_READ_RX0 : MCP_READ_RX1);
+    for (i = 0; i < 5; i++)
+        header[i] = spi_read();
+
+    m_nDlc = header[4] & MCP_DLC_MASK;
+    if (m_nDlc > MAX_CHAR_IN_MESSAGE)
+        m_nDlc = MAX_CHAR_IN_MESSAGE;
+    mcpSPI->transfer(m_nDta, m_nDlc);
+    MCP2515_UNSELECT();
+    mcpSPI->endTransaction();
 
-    ctrl = mcp2515_readRegister( mcp_addr-1 );
-    m_nDlc = mcp2515_readRegister( mcp_addr+4 );
+    mcp2515_decode_id(header, &m_nExtFlg, &m_nID);
 
-    if (ctrl & 0x08)
-        m_nRtr = 1;
+    // Standard remote frames set SRR in SIDL; extended ones set RTR in the DLC register.
+    if (m_nExtFlg)
+        m_nRtr = (header[4] & MCP_RTR_MASK) ? 1 : 0;
     else
-        m_nRtr = 0;
-
-    m_nDlc &= MCP_DLC_MASK;
-    mcp2515_readRegisterS( mcp_addr+5, &(m_nDta[0]), m_nDlc );
+        m_nRtr = (header[MCP_SIDL] & 0x10) ? 1 : 0;
 }
 
 /*********************************************************************************************************
@@ -816,6 +836,7 @@ MCP_CAN::MCP_CAN(INT8U _CS)
     MCP2515_UNSELECT();
     pinMode(MCPCS, OUTPUT);
     mcpSPI = &SPI;
+    initTxQueue();
 }
 
 /*********************************************************************************************************
@@ -828,6 +849,7 @@ MCP_CAN::MCP_CAN(SPIClass *_SPI, INT8U _CS)
     MCP2515_UNSELECT();
     pinMode(MCPCS, OUTPUT);
     mcpSPI = _SPI;
+    initTxQueue();
 }
 
 /*********************************************************************************************************
@@ -1119,11 +1141,12 @@ INT8U MCP_CAN::sendMsg()
 
     if(uiTimeOut >= TIMEOUTVALUE) 
     {   
+        txTimeouts++;
         return CAN_GETTXBFTIMEOUT;                                      /* get tx buff time out         */
     }
     uiTimeOut = 0;
     mcp2515_write_canMsg( txbuf_n);
-    mcp2515_modifyRegister( txbuf_n-1 , MCP_TXB_TXREQ_M, MCP_TXB_TXREQ_M );
+    mcp2515_requestToSend( txbuf_n);
     
     temp = micros();
     do
@@ -1134,8 +1157,14 @@ INT8U MCP_CAN::sendMsg()
     } while (res1 && (uiTimeOut < TIMEOUTVALUE));   
     
     if(uiTimeOut >= TIMEOUTVALUE)                                       /* send msg timeout             */	
+    {
+        txTimeouts++;
         return CAN_SENDMSGTIMEOUT;
-    
+    }
+
+    if (txObserver)
+        txObserver(txObserverContext, m_nID, m_nExtFlg, m_nRtr,
+                   m_nDlc > MAX_CHAR_IN_MESSAGE ? MAX_CHAR_IN_MESSAGE : m_nDlc, m_nDta);
     return CAN_OK;
 }
 
@@ -1145,12 +1174,7 @@ INT8U MCP_CAN::sendMsg()
 *********************************************************************************************************/
 INT8U MCP_CAN::sendMsgBuf(INT32U id, INT8U ext, INT8U len, INT8U *buf)
 {
-    INT8U res;
-	
-    setMsg(id, 0, ext, len, buf);
-    res = sendMsg();
-    
-    return res;
+    return submitMsg(id, 0, ext, len, buf);
 }
 
 /*********************************************************************************************************
@@ -1160,17 +1184,40 @@ INT8U MCP_CAN::sendMsgBuf(INT32U id, INT8U ext, INT8U len, INT8U *buf)
 INT8U MCP_CAN::sendMsgBuf(INT32U id, INT8U len, INT8U *buf)
 {
     INT8U ext = 0, rtr = 0;
-    INT8U res;
     
     if((id & 0x80000000) == 0x80000000)
         ext = 1;
  
     if((id & 0x40000000) == 0x40000000)
         rtr = 1;
-        
-    setMsg(id, rtr, ext, len, buf);
-    res = sendMsg();
-    
+
+    return submitMsg(id, rtr, ext, len, buf);
+}
+
+/*********************************************************************************************************
+** Function name:           submitMsg
+** Descriptions:            Appends the message to the TX queue when it is enabled, otherwise sends it and
+**                          waits. Common tail of both sendMsgBuf() overloads.
+*********************************************************************************************************/
+INT8U MCP_CAN::submitMsg(INT32U id, INT8U rtr, INT8U ext, INT8U len, INT8U *pData)
+{
+    INT8U res;
+#if CAN_FRAME_TIMING
+    const INT32U startedAt = micros();
+#endif
+
+    if (txqEnabled)
+        res = queueMsg(id, rtr, ext, len, pData);
+    else
+    {
+        setMsg(id, rtr, ext, len, pData);
+        res = sendMsg();
+    }
+
+#if CAN_FRAME_TIMING
+    if (sendObserver)
+        sendObserver(sendObserverContext, id, ext, startedAt, micros());
+#endif
     return res;
 }
 
@@ -1186,14 +1233,12 @@ INT8U MCP_CAN::readMsg()
 
     if ( stat & MCP_STAT_RX0IF )                                        /* Msg in Buffer 0              */
     {
-        mcp2515_read_canMsg( MCP_RXBUF_0);
-        mcp2515_modifyRegister(MCP_CANINTF, MCP_RX0IF, 0);
+        mcp2515_read_canMsg( MCP_RXBUF_0);                              /* also clears RX0IF            */
         res = CAN_OK;
     }
     else if ( stat & MCP_STAT_RX1IF )                                   /* Msg in Buffer 1              */
     {
-        mcp2515_read_canMsg( MCP_RXBUF_1);
-        mcp2515_modifyRegister(MCP_CANINTF, MCP_RX1IF, 0);
+        mcp2515_read_canMsg( MCP_RXBUF_1);                              /* also clears RX1IF            */
         res = CAN_OK;
     }
     else 
@@ -1362,6 +1407,218 @@ INT8U MCP_CAN::getGPI(void)
     return (res >> 3);
 }
 
+/*********************************************************************************************************
+** Function name:           initTxQueue
+** Descriptions:            Resets the software TX queue (queue starts disabled)
+*********************************************************************************************************/
+void MCP_CAN::initTxQueue(void)
+{
+    txqEnabled = 0;
+    txqHead = 0;
+    txqTail = 0;
+    txBusyMask = 0;
+    txAbortMask = 0;
+    txqDropped = 0;
+    txqStale = 0;
+    txTimeouts = 0;
+    txObserver = 0;
+    txObserverContext = 0;
+#if CAN_FRAME_TIMING
+    sendObserver = 0;
+    sendObserverContext = 0;
+#endif
+    for (INT8U i = 0; i < MCP_N_TXBUFFERS; i++) {
+        txBufferId[i] = 0;
+        txBufferLoadedAt[i] = 0;
+        txBufferFlags[i] = 0;
+        txBufferDlc[i] = 0;
+    }
+}
+
+/*********************************************************************************************************
+** Function name:           enableTxQueue
+** Descriptions:            Public function, makes sendMsgBuf() append to the software TX queue and return
+**                          immediately instead of waiting for the frame to leave the MCP2515.
+*********************************************************************************************************/
+void MCP_CAN::enableTxQueue(INT8U enable)
+{
+    txqEnabled = enable ? 1 : 0;
+}
+
+/*********************************************************************************************************
+** Function name:           queueMsg
+** Descriptions:            Appends a message to the TX queue and tops up any free hardware buffer.
+*********************************************************************************************************/
+INT8U MCP_CAN::queueMsg(INT32U id, INT8U rtr, INT8U ext, INT8U len, INT8U *pData)
+{
+    INT8U next = (txqTail + 1) % MCP_TXQUEUE_SIZE;
+
+    if (next == txqHead)
+    {
+        txqDropped++;
+        return CAN_FAILTX;
+    }
+
+    if (len > MAX_CHAR_IN_MESSAGE)
+        len = MAX_CHAR_IN_MESSAGE;
+
+    txqId[txqTail] = id;
+    txqFlags[txqTail] = (ext ? 0x01 : 0x00) | (rtr ? 0x02 : 0x00);
+    txqDlc[txqTail] = len;
+    for (INT8U i = 0; i < len; i++)
+        txqData[txqTail][i] = pData[i];
+    txqTail = next;
+
+    serviceTxQueue();
+    return CAN_OK;
+}
+
+/*********************************************************************************************************
+** Function name:           serviceTxQueue
+** Descriptions:            Public function, loads queued frames into free TX buffers. Never waits for the
+**                          bus: one READ STATUS tells which buffers finished, and only those are refilled.
+**                          Call from loop(). Returns the number of frames still waiting.
+*********************************************************************************************************/
+INT8U MCP_CAN::serviceTxQueue(void)
+{
+    const INT8U ctrlregs[MCP_N_TXBUFFERS] = { MCP_TXB0CTRL, MCP_TXB1CTRL, MCP_TXB2CTRL };
+    const INT8U txreqbits[MCP_N_TXBUFFERS] = { MCP_STAT_TX0REQ, MCP_STAT_TX1REQ, MCP_STAT_TX2REQ };
+    INT8U i, status, buffer;
+    INT32U now;
+
+    if (txqHead == txqTail && txBusyMask == 0)
+        return 0;
+
+    status = mcp2515_readStatus();
+    now = micros();
+
+    for (i = 0; i < MCP_N_TXBUFFERS; i++)
+    {
+        if (!(txBusyMask & (1 << i)))
+            continue;
+
+        if (!(status & txreqbits[i]))
+        {
+            txBusyMask &= ~(1 << i);
+            if (txAbortMask & (1 << i))
+            {
+                // TXREQ was cleared below. A frame already on the wire still finishes; ABTF or TXERR tell that
+                // it did not.
+                txAbortMask &= ~(1 << i);
+                if (mcp2515_readRegister(ctrlregs[i]) & (MCP_TXB_ABTF_M | MCP_TXB_TXERR_M))
+                {
+                    txqStale++;
+                    continue;
+                }
+            }
+            if (txObserver)
+                txObserver(txObserverContext, txBufferId[i], txBufferFlags[i] & 0x01,
+                           (txBufferFlags[i] & 0x02) ? 1 : 0, txBufferDlc[i], txBufferData[i]);
+        }
+        else if (!(txAbortMask & (1 << i)) && now - txBufferLoadedAt[i] >= MCP_TXQUEUE_STALE)
+        {
+            // Nobody acknowledged the frame (cluster off or bus-off). Ask the MCP2515 to drop it so fresher data
+            // can go out. The buffer stays busy until a later status read shows TXREQ clear.
+            mcp2515_modifyRegister(ctrlregs[i], MCP_TXB_TXREQ_M, 0);
+            txAbortMask |= (1 << i);
+        }
+    }
+
+    while (txqHead != txqTail)
+    {
+        // Frames with the same ID must leave in queue order, but the MCP2515 picks the highest-numbered buffer
+        // first on equal priority. Hold the next frame back while an earlier one with its ID is still pending.
+        for (i = 0; i < MCP_N_TXBUFFERS; i++)
+            if ((txBusyMask & (1 << i)) && txBufferId[i] == txqId[txqHead])
+                break;
+        if (i < MCP_N_TXBUFFERS)
+            break;
+
+        for (buffer = 0; buffer < MCP_N_TXBUFFERS; buffer++)
+            if (!(txBusyMask & (1 << buffer)))
+                break;
+        if (buffer == MCP_N_TXBUFFERS)
+            break;
+
+        setMsg(txqId[txqHead], (txqFlags[txqHead] & 0x02) ? 1 : 0, txqFlags[txqHead] & 0x01,
+               txqDlc[txqHead], txqData[txqHead]);
+        mcp2515_write_canMsg(ctrlregs[buffer] + 1);
+        mcp2515_requestToSend(ctrlregs[buffer] + 1);
+
+        txBusyMask |= (1 << buffer);
+        txBufferId[buffer] = txqId[txqHead];
+        txBufferLoadedAt[buffer] = now;
+        txBufferFlags[buffer] = txqFlags[txqHead];
+        txBufferDlc[buffer] = txqDlc[txqHead];
+        for (INT8U j = 0; j < txqDlc[txqHead]; j++)
+            txBufferData[buffer][j] = txqData[txqHead][j];
+        txqHead = (txqHead + 1) % MCP_TXQUEUE_SIZE;
+    }
+
+    return txQueuePending();
+}
+
+/*********************************************************************************************************
+** Function name:           txQueuePending
+** Descriptions:            Public function, number of frames waiting in the software TX queue.
+*********************************************************************************************************/
+INT8U MCP_CAN::txQueuePending(void)
+{
+    return (txqTail + MCP_TXQUEUE_SIZE - txqHead) % MCP_TXQUEUE_SIZE;
+}
+
+/*********************************************************************************************************
+** Function name:           txQueueDropped
+** Descriptions:            Public function, frames rejected because the TX queue was full.
+*********************************************************************************************************/
+INT32U MCP_CAN::txQueueDropped(void)
+{
+    return txqDropped;
+}
+
+/*********************************************************************************************************
+** Function name:           txQueueStale
+** Descriptions:            Public function, frames aborted because they were not sent within MCP_TXQUEUE_STALE.
+*********************************************************************************************************/
+INT32U MCP_CAN::txQueueStale(void)
+{
+    return txqStale;
+}
+
+/*********************************************************************************************************
+** Function name:           txTimeoutCount
+** Descriptions:            Public function, blocking sends that returned CAN_GETTXBFTIMEOUT or
+**                          CAN_SENDMSGTIMEOUT. Queued sends report txQueueDropped()/txQueueStale() instead.
+*********************************************************************************************************/
+INT32U MCP_CAN::txTimeoutCount(void)
+{
+    return txTimeouts;
+}
+
+/*********************************************************************************************************
+** Function name:           setTxObserver
+** Descriptions:            Public function, installs a callback that sees every frame once it has left its TX
+**                          buffer. Queued frames are reported by serviceTxQueue(). Pass NULL to remove it.
+*********************************************************************************************************/
+void MCP_CAN::setTxObserver(MCP_TX_OBSERVER observer, void *context)
+{
+    txObserver = observer;
+    txObserverContext = context;
+}
+
+#if CAN_FRAME_TIMING
+/*********************************************************************************************************
+** Function name:           setSendObserver
+** Descriptions:            Public function, installs a callback that sees the start and end time of every
+**                          sendMsgBuf() call. Pass NULL to remove it.
+*********************************************************************************************************/
+void MCP_CAN::setSendObserver(MCP_SEND_OBSERVER observer, void *context)
+{
+    sendObserver = observer;
+    sendObserverContext = context;
+}
+#endif
+
 /*********************************************************************************************************
   END FILE
 *********************************************************************************************************/
@@ -27,6 +27,21 @@
 #include "mcp_can_dfs.h"
 #define MAX_CHAR_IN_MESSAGE 8
 
+#ifndef MCP_TXQUEUE_SIZE
+#define MCP_TXQUEUE_SIZE 64                                             // Software TX queue depth (frames)
+#endif
+
+// Called for every frame that left a TX buffer: from sendMsg() once TXREQ clears, or from serviceTxQueue() when it
+// sees TXREQ clear on a queued frame. Frames aborted as stale or timed out are not reported.
+typedef void (*MCP_TX_OBSERVER)(void *context, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U *data);
+
+#ifndef CAN_FRAME_TIMING
+#define CAN_FRAME_TIMING 0                                              // Time every sendMsgBuf() call
+#endif
+
+// Called after every sendMsgBuf() with micros() at entry and return. Only compiled with CAN_FRAME_TIMING.
+typedef void (*MCP_SEND_OBSERVER)(void *context, INT32U id, INT8U ext, INT32U startedAt, INT32U finishedAt);
+
 class MCP_CAN
 {
     private:
@@ -41,6 +56,30 @@ class MCP_CAN
     SPIClass *mcpSPI;                                                       // The SPI-Device used
     INT8U   MCPCS;                                                      // Chip Select pin number
     INT8U   mcpMode;                                                    // Mode to return to after configurations are performed.
+
+    INT8U   txqEnabled;                                                 // sendMsgBuf() enqueues instead of blocking
+    INT8U   txqHead;                                                    // Next frame to load into the MCP2515
+    INT8U   txqTail;                                                    // Next free queue slot
+    INT32U  txqId[MCP_TXQUEUE_SIZE];                                    // Queued frames
+    INT8U   txqFlags[MCP_TXQUEUE_SIZE];                                 // Bit 0: extended, bit 1: RTR
+    INT8U   txqDlc[MCP_TXQUEUE_SIZE];
+    INT8U   txqData[MCP_TXQUEUE_SIZE][MAX_CHAR_IN_MESSAGE];
+    INT8U   txBusyMask;                                                 // Hardware buffers loaded by the queue
+    INT8U   txAbortMask;                                                // Busy buffers whose TXREQ was cleared as stale
+    INT32U  txBufferId[MCP_N_TXBUFFERS];                                // CAN ID held by each hardware buffer
+    INT32U  txBufferLoadedAt[MCP_N_TXBUFFERS];                          // micros() when TXREQ was set
+    INT8U   txBufferFlags[MCP_N_TXBUFFERS];                             // Queue flags of each hardware buffer
+    INT8U   txBufferDlc[MCP_N_TXBUFFERS];
+    INT8U   txBufferData[MCP_N_TXBUFFERS][MAX_CHAR_IN_MESSAGE];         // Kept for the TX observer
+    INT32U  txqDropped;                                                 // Frames rejected because the queue was full
+    INT32U  txqStale;                                                   // Frames aborted after MCP_TXQUEUE_STALE
+    INT32U  txTimeouts;                                                 // sendMsg() CAN_GETTXBFTIMEOUT/CAN_SENDMSGTIMEOUT
+    MCP_TX_OBSERVER txObserver;                                         // Optional per-frame TX instrumentation
+    void   *txObserverContext;
+#if CAN_FRAME_TIMING
+    MCP_SEND_OBSERVER sendObserver;                                     // Optional sendMsgBuf() timing
+    void   *sendObserverContext;
+#endif
     
 
 /*********************************************************************************************************
@@ -85,15 +124,16 @@ class MCP_CAN
                            const INT8U ext,
                            const INT32U id );
 
-    void mcp2515_write_id( const INT8U mcp_addr,                        // Write CAN ID
-                           const INT8U ext,
-                           const INT32U id );
+    void mcp2515_encode_id( const INT8U ext,                            // Pack CAN ID into SIDH..EID0
+                            const INT32U id,
+                            INT8U tbufdata[] );
 
-    void mcp2515_read_id( const INT8U mcp_addr,                         // Read CAN ID
-      INT8U* ext,
-                                INT32U* id );
+    void mcp2515_decode_id( const INT8U tbufdata[],                     // Unpack CAN ID from SIDH..EID0
+                            INT8U* ext,
+                            INT32U* id );
 
     void mcp2515_write_canMsg( const INT8U buffer_sidh_addr );          // Write CAN message
+    void mcp2515_requestToSend( const INT8U buffer_sidh_addr );         // RTS for one TX buffer
     void mcp2515_read_canMsg( const INT8U buffer_sidh_addr);            // Read CAN message
     INT8U mcp2515_getNextFreeTXBuf(INT8U *txbuf_n);                     // Find empty transmit buffer
 
@@ -105,6 +145,9 @@ class MCP_CAN
     INT8U clearMsg();                                                   // Clear all message to zero
     INT8U readMsg();                                                    // Read message
     INT8U sendMsg();                                                    // Send message
+    INT8U queueMsg(INT32U id, INT8U rtr, INT8U ext, INT8U len, INT8U *pData);      // Append message to TX queue
+    INT8U submitMsg(INT32U id, INT8U rtr, INT8U ext, INT8U len, INT8U *pData);     // Queue or send message
+    void initTxQueue(void);
 
 public:
     MCP_CAN(INT8U _CS);
@@ -130,6 +173,16 @@ public:
     INT8U abortTX(void);                                                // Abort queued transmission(s)
     INT8U setGPO(INT8U data);                                           // Sets GPO
     INT8U getGPI(void);                                                 // Reads GPI
+    void enableTxQueue(INT8U enable);                                   // Route sendMsgBuf() through the TX queue
+    INT8U serviceTxQueue(void);                                         // Refill free TX buffers from the queue
+    INT8U txQueuePending(void);                                         // Frames waiting in the queue
+    INT32U txQueueDropped(void);                                        // Frames dropped because the queue was full
+    INT32U txQueueStale(void);                                          // Frames aborted because they never left
+    INT32U txTimeoutCount(void);                                        // Blocking sends that timed out
+    void setTxObserver(MCP_TX_OBSERVER observer, void *context);        // Report every frame loaded for TX
+#if CAN_FRAME_TIMING
+    void setSendObserver(MCP_SEND_OBSERVER observer, void *context);    // Report the duration of every send
+#endif
 };
 
 #endif
@@ -45,6 +45,9 @@
  *   Begin mt
  */
 #define TIMEOUTVALUE    2500                                           /* In Microseconds, May need changed depending on application and baud rate */
+#ifndef MCP_TXQUEUE_STALE
+#define MCP_TXQUEUE_STALE (4 * TIMEOUTVALUE)                            /* Queued frame still pending after this is aborted */
+#endif
 #define MCP_SIDH        0
 #define MCP_SIDL        1
 #define MCP_EID8        2
@@ -79,6 +82,9 @@
 #define MCP_STAT_RXIF_MASK   (0x03)
 #define MCP_STAT_RX0IF       (1<<0)
 #define MCP_STAT_RX1IF       (1<<1)
+#define MCP_STAT_TX0REQ      (1<<2)
+#define MCP_STAT_TX1REQ      (1<<4)
+#define MCP_STAT_TX2REQ      (1<<6)
 
 #define MCP_EFLG_RX1OVR     (1<<7)
 #define MCP_EFLG_RX0OVR     (1<<6)
@@ -0,0 +1,215 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - CAN bus load accounting
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "CanBusMonitor.h"
+
+namespace {
+
+const uint16_t kCrc15Polynomial = 0x4599;
+
+// CRC delimiter, ACK slot and delimiter, end of frame and intermission follow the CRC without stuffing.
+const uint8_t kUnstuffedTrailerBits = 1 + 2 + 7 + 3;
+
+// Feeds the stuffed part of a frame (start of frame up to the CRC) bit by bit, tracking CRC-15 and stuff bits.
+class FrameBitCounter {
+ public:
+  void pushField(uint32_t value, uint8_t width, bool coveredByCrc = true) {
+    while (width-- > 0) {
+      const bool bit = (value >> width) & 0x01;
+      if (coveredByCrc) updateCrc(bit);
+      stuff(bit);
+    }
+  }
+
+  uint16_t crc() const { return crcRegister; }
+  uint16_t bits() const { return fieldBits + stuffBits; }
+
+ private:
+  void updateCrc(bool bit) {
+    const bool feedback = bit != ((crcRegister >> 14) & 0x01);
+    crcRegister = static_cast<uint16_t>((crcRegister << 1) & 0x7FFF);
+    if (feedback) crcRegister ^= kCrc15Polynomial;
+  }
+
+  // After five equal bits the transmitter inserts a complementary one, which starts the next run.
+  void stuff(bool bit) {
+    fieldBits++;
+    if (runLength > 0 && bit == runBit) {
+      runLength++;
+    } else {
+      runBit = bit;
+      runLength = 1;
+    }
+
+    if (runLength == 5) {
+      stuffBits++;
+      runBit = !bit;
+      runLength = 1;
+    }
+  }
+
+  uint16_t crcRegister = 0;
+  uint16_t fieldBits = 0;
+  uint16_t stuffBits = 0;
+  bool runBit = false;
+  uint8_t runLength = 0;
+};
+
+}  // namespace
+
+void CanBusMonitor::begin() {
+  bucketStartTime = millis();
+  secondStartTime = bucketStartTime;
+  CAN.setTxObserver(observeFrame, this);
+}
+
+uint16_t CanBusMonitor::frameBits(uint32_t id, bool extended, bool remote, uint8_t length, const uint8_t* data) {
+  if (length > 8) length = 8;
+
+  FrameBitCounter counter;
+  counter.pushField(0, 1);  // start of frame
+  if (extended) {
+    counter.pushField(id >> 18, 11);
+    counter.pushField(1, 1);  // SRR
+    counter.pushField(1, 1);  // IDE
+    counter.pushField(id & 0x3FFFF, 18);
+    counter.pushField(remote ? 1 : 0, 1);
+    counter.pushField(0, 2);  // r1, r0
+  } else {
+    counter.pushField(id & 0x7FF, 11);
+    counter.pushField(remote ? 1 : 0, 1);
+    counter.pushField(0, 2);  // IDE, r0
+  }
+  counter.pushField(length, 4);
+  if (!remote) {
+    for (uint8_t i = 0; i < length; i++) counter.pushField(data[i], 8);
+  }
+  counter.pushField(counter.crc(), 15, false);
+
+  return counter.bits() + kUnstuffedTrailerBits;
+}
+
+void CanBusMonitor::observeFrame(void* context, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U* data) {
+  CanBusMonitor* monitor = static_cast<CanBusMonitor*>(context);
+
+  // The MCP2515 keeps only the low 11 bits of a standard ID, so 0xB68 goes out as 0x368.
+  if (!ext) id &= 0x7FF;
+  monitor->record(ext ? CAN_BUS_MONITOR_EXTENDED_ID : id, frameBits(id, ext != 0, rtr != 0, len, data));
+}
+
+void CanBusMonitor::record(uint32_t id, uint16_t bits) {
+  roll(millis());
+
+  bucketBits[currentBucket] += bits;
+  bucketFrames[currentBucket]++;
+
+  uint8_t low = 0;
+  uint8_t high = trackedIds;
+  while (low < high) {
+    const uint8_t middle = (low + high) / 2;
+    if (ids[middle].id < id) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  if (low == trackedIds || ids[low].id != id) {
+    if (trackedIds >= CAN_BUS_MONITOR_MAX_IDS || id == CAN_BUS_MONITOR_EXTENDED_ID) {
+      untracked++;
+      return;
+    }
+    for (uint8_t i = trackedIds; i > low; i--) ids[i] = ids[i - 1];
+    memset(&ids[low], 0, sizeof(ids[low]));
+    ids[low].id = static_cast<uint16_t>(id);
+    trackedIds++;
+  }
+
+  CanIdStatistics& statistics = ids[low];
+  statistics.frames++;
+  statistics.bits += bits;
+  statistics.windowFrames++;
+  statistics.windowBits += bits;
+}
+
+void CanBusMonitor::update() {
+  const unsigned long now = millis();
+  const bool newSecond = now - secondStartTime >= 1000;
+  roll(now);
+
+  if (newSecond) {
+    transmitErrors = CAN.errorCountTX();
+    receiveErrors = CAN.errorCountRX();
+  }
+  if (now - lastReportTime >= CAN_BUS_MONITOR_BUCKET_MS) {
+    lastReportTime = now;
+    publishReport();
+  }
+}
+
+void CanBusMonitor::publishReport() {
+  CanBusReport& report = reportSnapshot.beginPublish();
+  report.bitsPerSecond = bitsPerSecond();
+  report.framesPerSecond = framesPerSecond();
+  report.utilisation = bitRate > 0 ? 100.0f * report.bitsPerSecond / bitRate : 0.0f;
+  report.transmitErrors = transmitErrors;
+  report.receiveErrors = receiveErrors;
+  report.txTimeouts = CAN.txTimeoutCount();
+  report.txDropped = CAN.txQueueDropped();
+  report.txStale = CAN.txQueueStale();
+  report.untrackedFrames = untracked;
+  report.idCount = trackedIds;
+  memcpy(report.ids, ids, trackedIds * sizeof(ids[0]));
+  reportSnapshot.endPublish();
+}
+
+void CanBusMonitor::roll(unsigned long now) {
+  const uint8_t bucketCount = CAN_BUS_MONITOR_WINDOW_BUCKETS + 1;
+
+  if (now - bucketStartTime >= static_cast<unsigned long>(CAN_BUS_MONITOR_BUCKET_MS) * bucketCount) {
+    memset(bucketBits, 0, sizeof(bucketBits));
+    memset(bucketFrames, 0, sizeof(bucketFrames));
+    bucketStartTime = now;
+  }
+  while (now - bucketStartTime >= CAN_BUS_MONITOR_BUCKET_MS) {
+    currentBucket = (currentBucket + 1) % bucketCount;
+    bucketBits[currentBucket] = 0;
+    bucketFrames[currentBucket] = 0;
+    bucketStartTime += CAN_BUS_MONITOR_BUCKET_MS;
+  }
+
+  const unsigned long sinceSecondStart = now - secondStartTime;
+  if (sinceSecondStart < 1000) return;
+
+  // A gap of more than a second means the last complete second carried nothing.
+  const bool idle = sinceSecondStart >= 2000;
+  for (uint8_t i = 0; i < trackedIds; i++) {
+    ids[i].framesPerSecond = idle ? 0 : ids[i].windowFrames;
+    ids[i].bitsPerSecond = idle ? 0 : ids[i].windowBits;
+    ids[i].windowFrames = 0;
+    ids[i].windowBits = 0;
+  }
+  secondStartTime = now - sinceSecondStart % 1000;
+}
+
+uint32_t CanBusMonitor::bitsPerSecond() const {
+  uint32_t bits = 0;
+  for (uint8_t i = 0; i <= CAN_BUS_MONITOR_WINDOW_BUCKETS; i++) {
+    if (i != currentBucket) bits += bucketBits[i];
+  }
+  return bits;
+}
+
+uint32_t CanBusMonitor::framesPerSecond() const {
+  uint32_t frames = 0;
+  for (uint8_t i = 0; i <= CAN_BUS_MONITOR_WINDOW_BUCKETS; i++) {
+    if (i != currentBucket) frames += bucketFrames[i];
+  }
+  return frames;
+}
@@ -0,0 +1,106 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - CAN bus load accounting
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Watches every frame MCP_CAN reports as sent and charges its exact on-wire length, stuff bits included, to
+// its CAN ID and to a rolling one-second window. Only frames sent by this node are seen, so the utilisation is the
+// share of the bus taken by CarCluster itself; the cluster's own traffic comes on top. TX timeouts, queue drops and
+// the MCP2515 TEC/REC error counters are collected alongside for the web dashboard.
+//
+// All counters belong to the CAN task. update() publishes a CanBusReport every bucket through a SeqlockSnapshot, and
+// the web dashboard formats its replies from report() on the network task.
+// ####################################################################################################################
+
+#ifndef CAN_BUS_MONITOR_H
+#define CAN_BUS_MONITOR_H
+
+#include "Arduino.h"
+#include "../Libs/MCP_CAN/mcp_can.h"
+#include "SeqlockSnapshot.h"
+
+#ifndef CAN_BUS_MONITOR_MAX_IDS
+#define CAN_BUS_MONITOR_MAX_IDS 48
+#endif
+
+#define CAN_BUS_MONITOR_BUCKET_MS 100
+#define CAN_BUS_MONITOR_EXTENDED_ID 0xFFFF
+#define CAN_BUS_MONITOR_WINDOW_BUCKETS 10
+
+struct CanIdStatistics {
+  uint16_t id;
+  uint32_t frames;
+  uint32_t bits;
+  // Totals of the last complete second.
+  uint16_t framesPerSecond;
+  uint32_t bitsPerSecond;
+  // Totals of the second in progress.
+  uint16_t windowFrames;
+  uint32_t windowBits;
+};
+
+struct CanBusReport {
+  // Share of the bus used by transmitted frames over the last full second, in percent.
+  float utilisation;
+  uint32_t framesPerSecond;
+  uint32_t bitsPerSecond;
+  uint8_t transmitErrors;
+  uint8_t receiveErrors;
+  uint32_t txTimeouts;
+  uint32_t txDropped;
+  uint32_t txStale;
+  // Extended frames and standard IDs beyond the table; they still count towards utilisation.
+  uint32_t untrackedFrames;
+  uint8_t idCount;
+  CanIdStatistics ids[CAN_BUS_MONITOR_MAX_IDS];
+};
+
+class CanBusMonitor {
+ public:
+  explicit CanBusMonitor(MCP_CAN& can, uint32_t bitRate = 500000) : CAN(can), bitRate(bitRate) {}
+
+  // Installs the TX observer. Call once after the MCP2515 is initialised.
+  void begin();
+
+  // Rolls the windows, samples TEC/REC once per second and publishes the report. Call from the CAN task.
+  void update();
+
+  // Bits a data or remote frame occupies on the wire, from start of frame to the end of intermission.
+  static uint16_t frameBits(uint32_t id, bool extended, bool remote, uint8_t length, const uint8_t* data);
+
+  // Latest report published by update(); network task only.
+  const CanBusReport& report() { return reportSnapshot.read(); }
+
+ private:
+  static void observeFrame(void* context, INT32U id, INT8U ext, INT8U rtr, INT8U len, const INT8U* data);
+  void record(uint32_t id, uint16_t bits);
+  void roll(unsigned long now);
+  void publishReport();
+  uint32_t bitsPerSecond() const;
+  uint32_t framesPerSecond() const;
+
+  MCP_CAN& CAN;
+  uint32_t bitRate;
+
+  CanIdStatistics ids[CAN_BUS_MONITOR_MAX_IDS];
+  uint8_t trackedIds = 0;
+  uint32_t untracked = 0;
+
+  // One extra bucket holds the interval in progress, so the window always covers complete buckets.
+  uint32_t bucketBits[CAN_BUS_MONITOR_WINDOW_BUCKETS + 1] = {};
+  uint16_t bucketFrames[CAN_BUS_MONITOR_WINDOW_BUCKETS + 1] = {};
+  uint8_t currentBucket = 0;
+  unsigned long bucketStartTime = 0;
+  unsigned long secondStartTime = 0;
+
+  uint8_t transmitErrors = 0;
+  uint8_t receiveErrors = 0;
+
+  SeqlockSnapshot<CanBusReport> reportSnapshot;
+  unsigned long lastReportTime = 0;
+};
+
+#endif
@@ -0,0 +1,130 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - per-ID CAN send timing histograms
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "CanFrameTiming.h"
+
+#if CAN_FRAME_TIMING
+
+// The cluster schedule uses 20, 100 and 1000 ms periods; the edges are finest around 20 ms and keep each nominal
+// period away from a bucket boundary.
+const uint32_t CanFrameTiming::kPeriodEdges[CAN_FRAME_TIMING_PERIOD_BUCKETS - 1] = {
+    1000, 5000, 10000, 15000, 19000, 19500, 20500, 21000, 25000, 50000, 90000, 110000, 500000, 900000, 1100000};
+
+const uint32_t CanFrameTiming::kDurationEdges[CAN_FRAME_TIMING_DURATION_BUCKETS - 1] = {
+    10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+
+namespace {
+
+uint8_t bucketFor(const uint32_t* edges, uint8_t edgeCount, uint32_t value) {
+  uint8_t bucket = 0;
+  while (bucket < edgeCount && value >= edges[bucket]) bucket++;
+  return bucket;
+}
+
+}  // namespace
+
+void CanFrameTiming::begin() {
+  reset();
+  CAN.setSendObserver(observeSend, this);
+}
+
+void CanFrameTiming::reset() {
+  memset(ids, 0, sizeof(ids));
+  trackedIds = 0;
+  untracked = 0;
+}
+
+void CanFrameTiming::update() {
+  const unsigned long now = millis();
+  if (now - lastReportTime < CAN_FRAME_TIMING_REPORT_INTERVAL_MS) return;
+  lastReportTime = now;
+
+  CanFrameTimingReport& report = reportSnapshot.beginPublish();
+  report.untrackedSends = untracked;
+  report.idCount = trackedIds;
+  memcpy(report.ids, ids, trackedIds * sizeof(ids[0]));
+  reportSnapshot.endPublish();
+}
+
+void CanFrameTiming::observeSend(void* context, INT32U id, INT8U ext, INT32U startedAt, INT32U finishedAt) {
+  CanFrameTiming* timing = static_cast<CanFrameTiming*>(context);
+
+  // Same folding as CanBusMonitor: the MCP2515 keeps only the low 11 bits of a standard ID.
+  timing->record(ext ? CAN_FRAME_TIMING_EXTENDED_ID : (id & 0x7FF), startedAt, finishedAt - startedAt);
+}
+
+void CanFrameTiming::record(uint32_t id, uint32_t startedAt, uint32_t duration) {
+  uint8_t low = 0;
+  uint8_t high = trackedIds;
+  while (low < high) {
+    const uint8_t middle = (low + high) / 2;
+    if (ids[middle].id < id) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  if (low == trackedIds || ids[low].id != id) {
+    if (trackedIds >= CAN_FRAME_TIMING_MAX_IDS) {
+      untracked++;
+      return;
+    }
+    for (uint8_t i = trackedIds; i > low; i--) ids[i] = ids[i - 1];
+    memset(&ids[low], 0, sizeof(ids[low]));
+    ids[low].id = static_cast<uint16_t>(id);
+    trackedIds++;
+  }
+
+  CanFrameTimingStatistics& statistics = ids[low];
+  if (statistics.sends > 0) {
+    const uint32_t period = startedAt - statistics.lastSendAt;
+    statistics.periods[bucketFor(kPeriodEdges, CAN_FRAME_TIMING_PERIOD_BUCKETS - 1, period)]++;
+    if (statistics.sends == 1 || period < statistics.minimumPeriod) statistics.minimumPeriod = period;
+    if (period > statistics.maximumPeriod) statistics.maximumPeriod = period;
+  }
+  statistics.durations[bucketFor(kDurationEdges, CAN_FRAME_TIMING_DURATION_BUCKETS - 1, duration)]++;
+  if (duration > statistics.maximumDuration) statistics.maximumDuration = duration;
+  statistics.lastSendAt = startedAt;
+  statistics.sends++;
+}
+
+void CanFrameTiming::printReport() const {
+  Serial.print("[Timing] period edges us:");
+  for (uint8_t i = 0; i < CAN_FRAME_TIMING_PERIOD_BUCKETS - 1; i++) {
+    Serial.printf(" %lu", static_cast<unsigned long>(kPeriodEdges[i]));
+  }
+  Serial.print("; duration edges us:");
+  for (uint8_t i = 0; i < CAN_FRAME_TIMING_DURATION_BUCKETS - 1; i++) {
+    Serial.printf(" %lu", static_cast<unsigned long>(kDurationEdges[i]));
+  }
+  Serial.println();
+
+  for (uint8_t i = 0; i < trackedIds; i++) {
+    const CanFrameTimingStatistics& statistics = ids[i];
+    Serial.printf("[Timing] 0x%03X sends %lu period %lu-%lu us duration max %lu us |",
+                  static_cast<unsigned>(statistics.id),
+                  static_cast<unsigned long>(statistics.sends),
+                  static_cast<unsigned long>(statistics.minimumPeriod),
+                  static_cast<unsigned long>(statistics.maximumPeriod),
+                  static_cast<unsigned long>(statistics.maximumDuration));
+    for (uint8_t bucket = 0; bucket < CAN_FRAME_TIMING_PERIOD_BUCKETS; bucket++) {
+      Serial.printf(" %lu", static_cast<unsigned long>(statistics.periods[bucket]));
+    }
+    Serial.print(" |");
+    for (uint8_t bucket = 0; bucket < CAN_FRAME_TIMING_DURATION_BUCKETS; bucket++) {
+      Serial.printf(" %lu", static_cast<unsigned long>(statistics.durations[bucket]));
+    }
+    Serial.println();
+  }
+
+  if (untracked > 0) Serial.printf("[Timing] %lu sends of untracked IDs\n", static_cast<unsigned long>(untracked));
+}
+
+#endif
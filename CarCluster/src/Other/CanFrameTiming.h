@@ -0,0 +1,90 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - per-ID CAN send timing histograms
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Timestamps every MCP_CAN::sendMsgBuf() call with micros() and keeps two fixed-bucket histograms per CAN ID: the
+// period since the previous send of the same ID and the time the call itself took. Minimum and maximum period are
+// kept alongside, so a run proves the bound directly. Everything lives in static arrays and is only compiled with
+// -DCAN_FRAME_TIMING=1; the default build carries neither the code nor the hook in MCP_CAN.
+//
+// The histograms belong to the CAN task. update() publishes them once per CAN_FRAME_TIMING_REPORT_INTERVAL_MS through
+// a SeqlockSnapshot for the web dashboard on the network task.
+// ####################################################################################################################
+
+#ifndef CAN_FRAME_TIMING_H
+#define CAN_FRAME_TIMING_H
+
+#include "Arduino.h"
+#include "../Libs/MCP_CAN/mcp_can.h"
+#include "SeqlockSnapshot.h"
+
+#if CAN_FRAME_TIMING
+
+#ifndef CAN_FRAME_TIMING_MAX_IDS
+#define CAN_FRAME_TIMING_MAX_IDS 32
+#endif
+
+#define CAN_FRAME_TIMING_EXTENDED_ID 0xFFFF
+#define CAN_FRAME_TIMING_PERIOD_BUCKETS 16
+#define CAN_FRAME_TIMING_DURATION_BUCKETS 10
+#define CAN_FRAME_TIMING_REPORT_INTERVAL_MS 1000
+
+struct CanFrameTimingStatistics {
+  uint16_t id;
+  uint32_t sends;
+  uint32_t lastSendAt;
+  uint32_t minimumPeriod;
+  uint32_t maximumPeriod;
+  uint32_t maximumDuration;
+  uint32_t periods[CAN_FRAME_TIMING_PERIOD_BUCKETS];
+  uint32_t durations[CAN_FRAME_TIMING_DURATION_BUCKETS];
+};
+
+struct CanFrameTimingReport {
+  uint32_t untrackedSends;
+  uint8_t idCount;
+  CanFrameTimingStatistics ids[CAN_FRAME_TIMING_MAX_IDS];
+};
+
+class CanFrameTiming {
+ public:
+  explicit CanFrameTiming(MCP_CAN& can) : CAN(can) {}
+
+  // Installs the send observer. Call once after the MCP2515 is initialised.
+  void begin();
+  void reset();
+
+  // Publishes the report for the network task. Call from the CAN task.
+  void update();
+
+  // Prints one line per CAN ID to Serial. CAN task only.
+  void printReport() const;
+
+  // Latest report published by update(); network task only.
+  const CanFrameTimingReport& report() { return reportSnapshot.read(); }
+
+  // Upper bounds in microseconds of every bucket but the last, which takes everything above.
+  static const uint32_t kPeriodEdges[CAN_FRAME_TIMING_PERIOD_BUCKETS - 1];
+  static const uint32_t kDurationEdges[CAN_FRAME_TIMING_DURATION_BUCKETS - 1];
+
+ private:
+  static void observeSend(void* context, INT32U id, INT8U ext, INT32U startedAt, INT32U finishedAt);
+  void record(uint32_t id, uint32_t startedAt, uint32_t duration);
+
+  MCP_CAN& CAN;
+
+  CanFrameTimingStatistics ids[CAN_FRAME_TIMING_MAX_IDS];
+  uint8_t trackedIds = 0;
+  uint32_t untracked = 0;
+
+  SeqlockSnapshot<CanFrameTimingReport> reportSnapshot;
+  unsigned long lastReportTime = 0;
+};
+
+#endif
+
+#endif
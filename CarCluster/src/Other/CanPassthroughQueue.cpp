@@ -0,0 +1,69 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - timed raw CAN passthrough
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "CanPassthroughQueue.h"
+
+#include <limits.h>
+
+#include "../Games/SerialFrameProtocol.h"
+
+bool CanPassthroughQueue::enqueueBatch(const uint8_t* payload, uint8_t length) {
+  if (length < 1) return false;
+
+  if (!(payload[0] & SerialCanBatchFlag_Continue)) batchBaseTime = millis();
+
+  uint8_t position = 1;
+  unsigned long lastDueTime = batchBaseTime;
+
+  while (position < length) {
+    if (length - position < static_cast<uint8_t>(sizeof(SerialCanBatchRecord))) return false;
+
+    SerialCanBatchRecord record;
+    memcpy(&record, &payload[position], sizeof(record));
+    position += sizeof(record);
+
+    if (record.length > 8 || length - position < record.length || record.id > 0x7FF) return false;
+
+    lastDueTime = batchBaseTime + record.offsetMs;
+
+    if (count < CAN_PASSTHROUGH_QUEUE_SIZE) {
+      PendingFrame& frame = frames[(head + count) % CAN_PASSTHROUGH_QUEUE_SIZE];
+      frame.dueTime = lastDueTime;
+      frame.id = record.id;
+      frame.length = record.length;
+      memcpy(frame.data, &payload[position], record.length);
+      count++;
+    } else {
+      droppedFrames++;
+    }
+
+    position += record.length;
+  }
+
+  batchBaseTime = lastDueTime;
+  return true;
+}
+
+void CanPassthroughQueue::service() {
+  while (count > 0 && CAN.txQueuePending() < MCP_TXQUEUE_SIZE / 2) {
+    PendingFrame& frame = frames[head];
+    if (static_cast<long>(millis() - frame.dueTime) < 0) return;
+
+    CAN.sendMsgBuf(frame.id, 0, frame.length, frame.data);
+    head = (head + 1) % CAN_PASSTHROUGH_QUEUE_SIZE;
+    count--;
+  }
+}
+
+unsigned long CanPassthroughQueue::millisUntilNextFrame() const {
+  if (count == 0) return ULONG_MAX;
+
+  const long remaining = static_cast<long>(frames[head].dueTime - millis());
+  return remaining > 0 ? static_cast<unsigned long>(remaining) : 0;
+}
@@ -0,0 +1,54 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - timed raw CAN passthrough
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Holds frames from binary CAN batches (SerialFrameType_CanBatch) until their requested send time and then hands
+// them to the MCP_CAN TX queue. Frames leave in arrival order; a frame due earlier than the one queued before it is
+// sent right after it. Only half of the TX queue is filled so the cluster's own frames always find room.
+// ####################################################################################################################
+
+#ifndef CAN_PASSTHROUGH_QUEUE_H
+#define CAN_PASSTHROUGH_QUEUE_H
+
+#include "Arduino.h"
+#include "../Libs/MCP_CAN/mcp_can.h"
+
+#ifndef CAN_PASSTHROUGH_QUEUE_SIZE
+#define CAN_PASSTHROUGH_QUEUE_SIZE 32
+#endif
+
+class CanPassthroughQueue {
+ public:
+  explicit CanPassthroughQueue(MCP_CAN& can) : CAN(can) {}
+
+  // Parses a SerialFrameType_CanBatch payload. Returns false if it was malformed; records before the error are kept.
+  bool enqueueBatch(const uint8_t* payload, uint8_t length);
+
+  // Sends every frame that is due. Call from loop() next to MCP_CAN::serviceTxQueue().
+  void service();
+
+  unsigned long millisUntilNextFrame() const;
+  uint8_t pending() const { return count; }
+  uint32_t dropped() const { return droppedFrames; }
+
+ private:
+  struct PendingFrame {
+    unsigned long dueTime;
+    uint16_t id;
+    uint8_t length;
+    uint8_t data[8];
+  };
+
+  MCP_CAN& CAN;
+  PendingFrame frames[CAN_PASSTHROUGH_QUEUE_SIZE];
+  uint8_t head = 0;
+  uint8_t count = 0;
+  unsigned long batchBaseTime = 0;
+  uint32_t droppedFrames = 0;
+};
+
+#endif
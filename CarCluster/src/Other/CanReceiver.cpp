@@ -0,0 +1,122 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - filtered, interrupt-driven CAN receive
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "CanReceiver.h"
+
+namespace {
+
+// Filters 0-1 belong to RXB0 (mask 0), filters 2-5 to RXB1 (mask 1).
+const uint8_t kHardwareFilterCount = 6;
+const uint32_t kUnusedExtendedId = 0x1FFFFFFF;
+
+// MCP_CAN expects standard IDs in bits 16-26 of masks and filters; the low 16 bits match the first two data bytes.
+uint32_t standardMaskValue(uint16_t id) {
+  return static_cast<uint32_t>(id & 0x7FF) << 16;
+}
+
+// One SPI drain per pass reads at most this many frames; a longer burst keeps the flag set for the next pass.
+const uint8_t kMaximumFramesPerService = 8;
+
+}  // namespace
+
+volatile bool CanReceiver::interruptPending = false;
+
+void IRAM_ATTR CanReceiver::handleInterrupt() {
+  interruptPending = true;
+}
+
+bool CanReceiver::watch(uint16_t id) {
+  id &= 0x7FF;
+  if (isWatched(id)) return true;
+  if (watchedCount >= CAN_RX_MAX_WATCHED_IDS) return false;
+
+  watchedIds[watchedCount++] = id;
+  return true;
+}
+
+void CanReceiver::begin() {
+  configureFilters();
+
+  // Frames may already be waiting from before the filters were applied.
+  interruptPending = true;
+  attachInterrupt(digitalPinToInterrupt(interruptPin), handleInterrupt, FALLING);
+}
+
+void CanReceiver::configureFilters() {
+  if (watchedCount == 0) {
+    for (uint8_t mask = 0; mask < 2; mask++) CAN.init_Mask(mask, 1, kUnusedExtendedId);
+    for (uint8_t filter = 0; filter < kHardwareFilterCount; filter++) CAN.init_Filt(filter, 1, kUnusedExtendedId);
+    return;
+  }
+
+  if (watchedCount <= kHardwareFilterCount) {
+    for (uint8_t mask = 0; mask < 2; mask++) CAN.init_Mask(mask, 0, standardMaskValue(0x7FF));
+    for (uint8_t filter = 0; filter < kHardwareFilterCount; filter++) {
+      const uint8_t index = filter < watchedCount ? filter : watchedCount - 1;
+      CAN.init_Filt(filter, 0, standardMaskValue(watchedIds[index]));
+    }
+    return;
+  }
+
+  // Keep only the ID bits all watched IDs share; service() drops the extra frames this lets through.
+  uint16_t differingBits = 0;
+  for (uint8_t i = 1; i < watchedCount; i++) differingBits |= watchedIds[i] ^ watchedIds[0];
+
+  const uint16_t sharedMask = static_cast<uint16_t>(0x7FF & ~differingBits);
+  for (uint8_t mask = 0; mask < 2; mask++) CAN.init_Mask(mask, 0, standardMaskValue(sharedMask));
+  for (uint8_t filter = 0; filter < kHardwareFilterCount; filter++) {
+    CAN.init_Filt(filter, 0, standardMaskValue(watchedIds[0]));
+  }
+}
+
+void CanReceiver::service() {
+  if (!interruptPending) return;
+  interruptPending = false;
+
+  uint8_t drained = 0;
+  while (digitalRead(interruptPin) == LOW) {
+    if (drained++ >= kMaximumFramesPerService) {
+      interruptPending = true;
+      return;
+    }
+
+    CanFrame frame;
+    uint8_t extended = 0;
+    unsigned long id = 0;
+    if (CAN.readMsgBuf(&id, &extended, &frame.length, frame.data) != CAN_OK) return;
+    if (extended || !isWatched(id)) continue;
+
+    frame.id = id;
+    frame.receivedMicros = micros();
+
+    if (count == CAN_RX_RING_SIZE) {
+      head = (head + 1) % CAN_RX_RING_SIZE;
+      count--;
+      overflowedFrames++;
+    }
+    ring[(head + count) % CAN_RX_RING_SIZE] = frame;
+    count++;
+  }
+}
+
+bool CanReceiver::read(CanFrame& frame) {
+  if (count == 0) return false;
+
+  frame = ring[head];
+  head = (head + 1) % CAN_RX_RING_SIZE;
+  count--;
+  return true;
+}
+
+bool CanReceiver::isWatched(uint32_t id) const {
+  for (uint8_t i = 0; i < watchedCount; i++) {
+    if (watchedIds[i] == id) return true;
+  }
+  return false;
+}
@@ -0,0 +1,74 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - filtered, interrupt-driven CAN receive
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Consumers register the standard IDs they need with watch() before begin(). begin() programs the MCP2515 masks and
+// filters so every other frame is rejected in hardware and never raises INT. With nothing watched, the filters are
+// set to a single extended ID the F10 bus never carries.
+//
+// The INT falling edge only sets a flag: SPI cannot be used from an ESP32 interrupt while loop() owns the bus, so
+// service() moves flagged frames from RXB0/RXB1 into a ring on the next pass and read() hands them out. Up to six
+// IDs are matched exactly in hardware; beyond that the masks are widened and the rest is filtered in software.
+// ####################################################################################################################
+
+#ifndef CAN_RECEIVER_H
+#define CAN_RECEIVER_H
+
+#include "Arduino.h"
+#include "../Libs/MCP_CAN/mcp_can.h"
+
+#ifndef CAN_RX_MAX_WATCHED_IDS
+#define CAN_RX_MAX_WATCHED_IDS 16
+#endif
+
+#ifndef CAN_RX_RING_SIZE
+#define CAN_RX_RING_SIZE 16
+#endif
+
+struct CanFrame {
+  uint32_t id;
+  uint8_t length;
+  uint8_t data[8];
+  unsigned long receivedMicros;
+};
+
+class CanReceiver {
+ public:
+  CanReceiver(MCP_CAN& can, uint8_t interruptPin) : CAN(can), interruptPin(interruptPin) {}
+
+  // Registers a standard ID. Returns false when the watch list is full.
+  bool watch(uint16_t id);
+
+  // Programs masks and filters and attaches the INT interrupt. Call once the MCP2515 is initialised.
+  void begin();
+
+  // Drains RXB0/RXB1 into the ring if the interrupt fired. Call from loop().
+  void service();
+
+  bool read(CanFrame& frame);
+  uint32_t overflowed() const { return overflowedFrames; }
+
+ private:
+  static void IRAM_ATTR handleInterrupt();
+  static volatile bool interruptPending;
+
+  bool isWatched(uint32_t id) const;
+  void configureFilters();
+
+  MCP_CAN& CAN;
+  uint8_t interruptPin;
+
+  uint16_t watchedIds[CAN_RX_MAX_WATCHED_IDS];
+  uint8_t watchedCount = 0;
+
+  CanFrame ring[CAN_RX_RING_SIZE];
+  uint8_t head = 0;
+  uint8_t count = 0;
+  uint32_t overflowedFrames = 0;
+};
+
+#endif
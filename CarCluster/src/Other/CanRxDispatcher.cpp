@@ -0,0 +1,49 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - inbound CAN dispatcher
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "CanRxDispatcher.h"
+
+bool CanRxDispatcher::on(uint16_t id, CanFrameHandler handler) {
+  id &= 0x7FF;
+  if (routeCount >= CAN_RX_MAX_WATCHED_IDS || !handler) return false;
+  for (uint8_t i = 0; i < routeCount; i++) {
+    if (routes[i].id == id) return false;
+  }
+
+  // Insertion keeps the table sorted; it only runs during setup().
+  uint8_t position = routeCount;
+  while (position > 0 && routes[position - 1].id > id) {
+    routes[position] = routes[position - 1];
+    position--;
+  }
+
+  routes[position].id = id;
+  routes[position].handler = handler;
+  routeCount++;
+  receiver.watch(id);
+  return true;
+}
+
+void CanRxDispatcher::dispatch() {
+  CanFrame frame;
+  while (receiver.read(frame)) {
+    uint8_t low = 0;
+    uint8_t high = routeCount;
+    while (low < high) {
+      const uint8_t middle = (low + high) / 2;
+      if (routes[middle].id < frame.id) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+
+    if (low < routeCount && routes[low].id == frame.id) routes[low].handler(frame, game);
+  }
+}
@@ -0,0 +1,45 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - inbound CAN dispatcher
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Routes frames from CanReceiver to decode functions keyed by standard CAN ID. Routes are registered during setup()
+// with on(), which also asks the receiver to let that ID through its hardware filters; the table is kept sorted so
+// dispatch() finds a handler with a binary search. Nothing is allocated per frame.
+// ####################################################################################################################
+
+#ifndef CAN_RX_DISPATCHER_H
+#define CAN_RX_DISPATCHER_H
+
+#include "Arduino.h"
+#include "CanReceiver.h"
+#include "../Games/GameSimulation.h"
+
+typedef void (*CanFrameHandler)(const CanFrame& frame, GameState& game);
+
+class CanRxDispatcher {
+ public:
+  CanRxDispatcher(CanReceiver& receiver, GameState& game) : receiver(receiver), game(game) {}
+
+  // Must be called before CanReceiver::begin(). Returns false if the ID is already routed or the table is full.
+  bool on(uint16_t id, CanFrameHandler handler);
+
+  // Decodes every frame waiting in the receiver ring. Call from loop() after CanReceiver::service().
+  void dispatch();
+
+ private:
+  struct Route {
+    uint16_t id;
+    CanFrameHandler handler;
+  };
+
+  CanReceiver& receiver;
+  GameState& game;
+  Route routes[CAN_RX_MAX_WATCHED_IDS];
+  uint8_t routeCount = 0;
+};
+
+#endif
@@ -0,0 +1,64 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - seqlock copy of CAN task statistics for the network task
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// The same hand-off as GameStateSnapshot for plain structs: the CAN task fills the published copy in place between
+// beginPublish() and endPublish(), and the network task takes a consistent copy of it with read(). The writer never
+// blocks; a reader that races a write keeps its previous copy and picks up the new one on its next call.
+//
+// One writer task and one reader task per snapshot.
+// ####################################################################################################################
+
+#ifndef SEQLOCK_SNAPSHOT_H
+#define SEQLOCK_SNAPSHOT_H
+
+#include <atomic>
+#include <stdint.h>
+
+template <typename T>
+class SeqlockSnapshot {
+ public:
+  // Writer side (CAN task). Fill the returned struct, then call endPublish().
+  T& beginPublish() {
+    const uint32_t current = sequence.load(std::memory_order_relaxed);
+    sequence.store(current + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return published;
+  }
+
+  void endPublish() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  // Reader side (network task). Returns the newest consistent copy taken so far.
+  const T& read() {
+    for (uint8_t attempt = 0; attempt < 3; attempt++) {
+      const uint32_t before = sequence.load(std::memory_order_acquire);
+      if (before == consumedSequence) break;
+      if (before & 1) continue;
+
+      scratch = published;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence.load(std::memory_order_relaxed) != before) continue;
+
+      received = scratch;
+      consumedSequence = before;
+      break;
+    }
+    return received;
+  }
+
+ private:
+  std::atomic<uint32_t> sequence{0};
+  T published = {};
+
+  uint32_t consumedSequence = 0;  // reader only
+  T scratch = {};                 // reader only
+  T received = {};                // reader only
+};
+
+#endif
@@ -13,81 +13,249 @@
 
 #include "WebDashboard.h"
 
-WebDashboard::WebDashboard(GameState &game, unsigned long webDashboardUpdateInterval): gameState(game) {
+namespace {
+
+size_t printBusIds(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const CanBusReport *report = va_arg(*ap, const CanBusReport *);
+  size_t length = 0;
+  for (uint8_t i = 0; i < report->idCount; i++) {
+    const CanIdStatistics &statistics = report->ids[i];
+    length += mg_xprintf(out, ptr, "%s{\"id\":%u,\"frames\":%lu,\"frames_per_second\":%u,\"bits_per_second\":%lu}",
+                         i == 0 ? "" : ",",
+                         static_cast<unsigned>(statistics.id),
+                         static_cast<unsigned long>(statistics.frames),
+                         static_cast<unsigned>(statistics.framesPerSecond),
+                         static_cast<unsigned long>(statistics.bitsPerSecond));
+  }
+  return length;
+}
+
+#if CAN_FRAME_TIMING
+size_t printCounts(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const uint32_t *counts = va_arg(*ap, const uint32_t *);
+  const int count = va_arg(*ap, int);
+  size_t length = 0;
+  for (int i = 0; i < count; i++) {
+    length += mg_xprintf(out, ptr, "%s%lu", i == 0 ? "" : ",", static_cast<unsigned long>(counts[i]));
+  }
+  return length;
+}
+
+size_t printTimingIds(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const CanFrameTimingReport *report = va_arg(*ap, const CanFrameTimingReport *);
+  size_t length = 0;
+  for (uint8_t i = 0; i < report->idCount; i++) {
+    const CanFrameTimingStatistics &statistics = report->ids[i];
+    length += mg_xprintf(out, ptr,
+                         "%s{\"id\":%u,\"sends\":%lu,\"period_min_us\":%lu,\"period_max_us\":%lu,"
+                         "\"duration_max_us\":%lu,\"periods\":[%M],\"durations\":[%M]}",
+                         i == 0 ? "" : ",",
+                         static_cast<unsigned>(statistics.id),
+                         static_cast<unsigned long>(statistics.sends),
+                         static_cast<unsigned long>(statistics.minimumPeriod),
+                         static_cast<unsigned long>(statistics.maximumPeriod),
+                         static_cast<unsigned long>(statistics.maximumDuration),
+                         printCounts, statistics.periods, CAN_FRAME_TIMING_PERIOD_BUCKETS,
+                         printCounts, statistics.durations, CAN_FRAME_TIMING_DURATION_BUCKETS);
+  }
+  return length;
+}
+#endif
+
+}  // namespace
+
+WebDashboard::WebDashboard(GameState &game, GameState &dashboardSource, CanBusMonitor &busMonitor,
+                           unsigned long webDashboardUpdateInterval)
+    : gameState(game),
+      dashboardSource(dashboardSource),
+      viewState(game.configuration),
+      controlState(game.configuration),
+      viewSnapshot(game.configuration),
+      controlSnapshot(game.configuration),
+      busMonitor(busMonitor) {
   this->webDashboardUpdateInterval = webDashboardUpdateInterval;
+  memset(&publishedState, 0, sizeof(publishedState));
+}
+
+bool WebDashboard::exchangeGameState() {
+  // Until the first edit, follow what the cluster shows, so groups the user never touched keep those values instead
+  // of the defaults once the dashboard becomes the source.
+  if (!dashboardSourceEdited) dashboardSource.copyGroups(gameState, GameStateGroup_All);
+  const bool edited = controlSnapshot.mergeInto(dashboardSource);
+  if (edited) dashboardSourceEdited = true;
+
+  // One action per pass; the cluster queues it before the next.
+  const uint8_t read = buttonActionsRead.load(std::memory_order_relaxed);
+  if (gameState.buttonEventToProcess == 0 && read != buttonActionsWritten.load(std::memory_order_acquire)) {
+    gameState.buttonEventToProcess = buttonActions[read % WEB_DASHBOARD_BUTTON_QUEUE_SIZE];
+    buttonActionsRead.store(read + 1, std::memory_order_release);
+  }
+  if (pendingAlertStart.exchange(false)) gameState.alertStart = true;
+  if (pendingAlertClear.exchange(false)) gameState.alertClear = true;
+
+  viewSnapshot.publish(gameState, GameStateGroup_All);
+  return edited;
 }
 
 void WebDashboard::getState(struct state *data) {
-  data->speed = gameState.speed;
-  data->maximumSpeed = gameState.configuration.maximumSpeedValue;
-  data->rpm = gameState.rpm;
-  data->maximumRPM = gameState.configuration.maximumRPMValue;
-  data->fuel = gameState.fuelQuantity;
-  data->high_beam = gameState.highBeam;
-  data->fog_rear = gameState.rearFogLight;
-  data->fog_front = gameState.frontFogLight;
-  data->left_indicator = gameState.leftTurningIndicator;
-  data->right_indicator = gameState.rightTurningIndicator;
-  data->main_lights = gameState.mainLights;
-  data->door_open = gameState.doorOpen;
-  data->dsc = gameState.offroadLight;
-  data->abs = gameState.absLight;
-  strcpy(data->gear, mapGenericGearToLocalGear(gameState.gear));
-  data->backlight = gameState.backlightBrightness;
-  data->coolant_temp = gameState.coolantTemperature;
-  data->minimumCoolantTemp = gameState.configuration.minimumCoolantTemperature;
-  data->maximumCoolantTemp = gameState.configuration.maximumCoolantTemperature;
-  data->handbrake = gameState.handbrake;
-  data->ignition = gameState.ignition;
-  strcpy(data->drive_mode, mapGenericDriveModeToLocalDriveMode(gameState.driveMode));
-  data->outdoor_temp = gameState.outdoorTemperature;
-  data->indicators_blink = gameState.turningIndicatorsBlinking;
+  data->speed = viewState.speed;
+  data->maximumSpeed = viewState.configuration.maximumSpeedValue;
+  data->rpm = viewState.rpm;
+  data->maximumRPM = viewState.configuration.maximumRPMValue;
+  data->fuel = viewState.fuelQuantity;
+  data->high_beam = viewState.highBeam;
+  data->fog_rear = viewState.rearFogLight;
+  data->fog_front = viewState.frontFogLight;
+  data->left_indicator = viewState.leftTurningIndicator;
+  data->right_indicator = viewState.rightTurningIndicator;
+  data->main_lights = viewState.mainLights;
+  data->door_open = viewState.doorOpen;
+  data->dsc = viewState.offroadLight;
+  data->abs = viewState.absLight;
+  strcpy(data->gear, mapGenericGearToLocalGear(viewState.gear));
+  data->backlight = viewState.backlightBrightness;
+  data->coolant_temp = viewState.coolantTemperature;
+  data->minimumCoolantTemp = viewState.configuration.minimumCoolantTemperature;
+  data->maximumCoolantTemp = viewState.configuration.maximumCoolantTemperature;
+  data->handbrake = viewState.handbrake;
+  data->ignition = viewState.ignition;
+  strcpy(data->drive_mode, mapGenericDriveModeToLocalDriveMode(viewState.driveMode));
+  data->outdoor_temp = viewState.outdoorTemperature;
+  data->indicators_blink = viewState.turningIndicatorsBlinking;
+  data->odometer = viewState.clusterOdometer;
+  data->range = viewState.clusterRange;
+  data->cluster_online = viewState.clusterLastSeenTime != 0 &&
+                         millis() - viewState.clusterLastSeenTime < CLUSTER_ONLINE_TIMEOUT_MS;
 }
 
 void WebDashboard::setState(struct state *data) {
-  gameState.speed = data->speed;
-  gameState.rpm = data->rpm;
-  gameState.fuelQuantity = data->fuel;
-  gameState.highBeam = data->high_beam;
-  gameState.rearFogLight = data->fog_rear;
-  gameState.frontFogLight = data->fog_front;
-  gameState.leftTurningIndicator = data->left_indicator;
-  gameState.rightTurningIndicator = data->right_indicator;
-  gameState.mainLights = data->main_lights;
-  gameState.doorOpen = data->door_open;
-  gameState.doorFL = data->door_open;
-  gameState.doorFR = false;
-  gameState.doorRL = false;
-  gameState.doorRR = false;
-  gameState.offroadLight = data->dsc;
-  gameState.absLight = data->abs;
-  gameState.gear = mapLocalGearToGenericGear(data->gear);
-  gameState.backlightBrightness = data->backlight;
-  gameState.coolantTemperature = data->coolant_temp;
-  gameState.oilTemperature = data->coolant_temp;
-  gameState.handbrake = data->handbrake;
-  gameState.ignition = data->ignition;
-  gameState.driveMode = mapLocalDriveModeToGenericDriveMode(data->drive_mode);
-  gameState.outdoorTemperature = data->outdoor_temp;
-  gameState.turningIndicatorsBlinking = data->indicators_blink;
+  // Start from what the dashboard shows so only the fields the user changed differ from the game.
+  controlState = viewState;
+  controlState.takeDirtyGroups();
+
+  controlState.setField(controlState.speed, data->speed, GameStateGroup_Speed);
+  controlState.setField(controlState.rpm, data->rpm, GameStateGroup_Engine);
+  controlState.setField(controlState.fuelQuantity, data->fuel, GameStateGroup_Fuel);
+  controlState.setField(controlState.highBeam, data->high_beam, GameStateGroup_Lights);
+  controlState.setField(controlState.rearFogLight, data->fog_rear, GameStateGroup_Lights);
+  controlState.setField(controlState.frontFogLight, data->fog_front, GameStateGroup_Lights);
+  controlState.setField(controlState.leftTurningIndicator, data->left_indicator, GameStateGroup_Lights);
+  controlState.setField(controlState.rightTurningIndicator, data->right_indicator, GameStateGroup_Lights);
+  controlState.setField(controlState.mainLights, data->main_lights, GameStateGroup_Lights);
+  controlState.setField(controlState.doorOpen, data->door_open, GameStateGroup_Body);
+  controlState.setField(controlState.doorFL, data->door_open, GameStateGroup_Body);
+  controlState.setField(controlState.doorFR, false, GameStateGroup_Body);
+  controlState.setField(controlState.doorRL, false, GameStateGroup_Body);
+  controlState.setField(controlState.doorRR, false, GameStateGroup_Body);
+  controlState.setField(controlState.offroadLight, data->dsc, GameStateGroup_Warnings);
+  controlState.setField(controlState.absLight, data->abs, GameStateGroup_Warnings);
+  controlState.setField(controlState.gear, mapLocalGearToGenericGear(data->gear), GameStateGroup_Gear);
+  controlState.setField(controlState.backlightBrightness, data->backlight, GameStateGroup_Dashboard);
+  controlState.setField(controlState.coolantTemperature, data->coolant_temp, GameStateGroup_Temperature);
+  controlState.setField(controlState.oilTemperature, data->coolant_temp, GameStateGroup_Temperature);
+  controlState.setField(controlState.handbrake, data->handbrake, GameStateGroup_Body);
+  controlState.setField(controlState.ignition, data->ignition, GameStateGroup_Engine);
+  controlState.setField(controlState.driveMode,
+                        mapLocalDriveModeToGenericDriveMode(data->drive_mode),
+                        GameStateGroup_Warnings);
+  controlState.setField(controlState.outdoorTemperature, data->outdoor_temp, GameStateGroup_Temperature);
+  controlState.setField(controlState.turningIndicatorsBlinking, data->indicators_blink, GameStateGroup_Lights);
+
+  controlSnapshot.publish(controlState);
+}
+
+void WebDashboard::busReply(struct mg_connection *c, struct mg_http_message *hm) {
+  (void)hm;
+  const CanBusReport &report = busMonitor.report();
+  mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
+                "{\"utilisation\":%g,\"frames_per_second\":%lu,\"bits_per_second\":%lu,"
+                "\"tec\":%u,\"rec\":%u,\"tx_timeouts\":%lu,\"tx_dropped\":%lu,\"tx_stale\":%lu,"
+                "\"untracked_frames\":%lu,\"ids\":[%M]}\n",
+                static_cast<double>(report.utilisation),
+                static_cast<unsigned long>(report.framesPerSecond),
+                static_cast<unsigned long>(report.bitsPerSecond),
+                static_cast<unsigned>(report.transmitErrors),
+                static_cast<unsigned>(report.receiveErrors),
+                static_cast<unsigned long>(report.txTimeouts),
+                static_cast<unsigned long>(report.txDropped),
+                static_cast<unsigned long>(report.txStale),
+                static_cast<unsigned long>(report.untrackedFrames),
+                printBusIds, &report);
+}
+
+#if CAN_FRAME_TIMING
+void WebDashboard::timingReply(struct mg_connection *c, struct mg_http_message *hm, CanFrameTiming &timing) {
+  (void)hm;
+  const CanFrameTimingReport &report = timing.report();
+  mg_http_reply(c, 200, "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
+                "{\"period_edges_us\":[%M],\"duration_edges_us\":[%M],\"untracked_sends\":%lu,\"ids\":[%M]}\n",
+                printCounts, CanFrameTiming::kPeriodEdges, CAN_FRAME_TIMING_PERIOD_BUCKETS - 1,
+                printCounts, CanFrameTiming::kDurationEdges, CAN_FRAME_TIMING_DURATION_BUCKETS - 1,
+                static_cast<unsigned long>(report.untrackedSends),
+                printTimingIds, &report);
+}
+#endif
+
+// GET /api/telemetry reports the state; ?record=/path starts recording, ?replay=/path[&speed=N][&loop=1] starts a
+// replay and ?stop=1 ends both. Paths are LittleFS paths and must start with '/'.
+void WebDashboard::telemetryReply(struct mg_connection *c, struct mg_http_message *hm, TelemetryRecorder &recorder,
+                                  TelemetryReplayGame &replay) {
+  char path[32];
+  char value[8];
+  bool accepted = true;
+
+  if (mg_http_get_var(&hm->query, "stop", value, sizeof(value)) > 0) {
+    recorder.stop();
+    replay.stop();
+  }
+  if (mg_http_get_var(&hm->query, "record", path, sizeof(path)) > 0) {
+    accepted = path[0] == '/' && recorder.start(path);
+  }
+  if (mg_http_get_var(&hm->query, "replay", path, sizeof(path)) > 0) {
+    const uint8_t speed = mg_http_get_var(&hm->query, "speed", value, sizeof(value)) > 0 ? atoi(value) : 1;
+    const bool loop = mg_http_get_var(&hm->query, "loop", value, sizeof(value)) > 0 && atoi(value) != 0;
+    accepted = path[0] == '/' && replay.start(path, speed, loop);
+  }
+
+  mg_http_reply(c, accepted ? 200 : 400, "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
+                "{\"recording\":%s,\"records\":%lu,\"bytes\":%lu,"
+                "\"replaying\":%s,\"speed\":%u,\"records_played\":%lu}\n",
+                recorder.recording() ? "true" : "false",
+                static_cast<unsigned long>(recorder.recordCount()),
+                static_cast<unsigned long>(recorder.bytesWritten()),
+                replay.playing() ? "true" : "false",
+                static_cast<unsigned>(replay.playbackSpeed()),
+                static_cast<unsigned long>(replay.recordsPlayed()));
 }
 
 void WebDashboard::steeringWheelAction(struct mg_str params) {
   if (params.len < 1) return;
 
   const int requestedAction = params.buf[0] - '0';
-  // The dashboard exposes only the BC/menu action to the cluster output layer.
-  gameState.buttonEventToProcess = requestedAction == 1 ? 1 : 0;
+  // The dashboard exposes only the BC/menu action: 1 press, 2 hold, 3 long press.
+  if (requestedAction < SteeringButtonAction_Press || requestedAction > SteeringButtonAction_LongPress) return;
+
+  const uint8_t written = buttonActionsWritten.load(std::memory_order_relaxed);
+  if (static_cast<uint8_t>(written - buttonActionsRead.load(std::memory_order_acquire)) >=
+      WEB_DASHBOARD_BUTTON_QUEUE_SIZE) {
+    return;
+  }
+  buttonActions[written % WEB_DASHBOARD_BUTTON_QUEUE_SIZE] = static_cast<uint8_t>(requestedAction);
+  buttonActionsWritten.store(written + 1, std::memory_order_release);
+}
+
+bool WebDashboard::steeringWheelActionPending() const {
+  return buttonActionsRead.load(std::memory_order_acquire) != buttonActionsWritten.load(std::memory_order_relaxed);
 }
 
 void WebDashboard::alertStart(struct mg_str params) {
   (void)params;
-  gameState.alertStart = true;
+  pendingAlertStart.store(true);
 }
 
 void WebDashboard::alertClear(struct mg_str params) {
   (void)params;
-  gameState.alertClear = true;
+  pendingAlertClear.store(true);
 }
 
 const char* WebDashboard::mapGenericGearToLocalGear(GearState inputGear) {
@@ -158,8 +326,16 @@ uint8_t WebDashboard::mapLocalDriveModeToGenericDriveMode(const char *driveMode)
 }
 
 void WebDashboard::update() {
-  if (millis() - lastWebDashboardUpdateTime >= webDashboardUpdateInterval) {
-    glue_update_state();
-    lastWebDashboardUpdateTime = millis();
-  }
+  if (millis() - lastWebDashboardUpdateTime < webDashboardUpdateInterval) return;
+  lastWebDashboardUpdateTime = millis();
+  viewSnapshot.copyInto(viewState);
+
+  // Zeroed first so the bytes behind short strings compare equal between snapshots.
+  struct state current;
+  memset(&current, 0, sizeof(current));
+  getState(&current);
+
+  if (memcmp(&current, &publishedState, sizeof(current)) != 0) glue_update_state();
+  mongoose_ws_publish("state", &publishedState, &current);
+  publishedState = current;
 }
@@ -11,8 +11,20 @@
 
 #include "mongoose/mongoose.h"
 #include "mongoose/mongoose_glue.h"
+#include <atomic>
+
 #include "../Games/GameSimulation.h"
+#include "../Games/GameStateSnapshot.h"
+#include "../Games/TelemetryRecorder.h"
+#include "../Games/TelemetryReplayGame.h"
+#include "CanBusMonitor.h"
+#include "CanFrameTiming.h"
+
+// The cluster counts as online while one of its routed frames arrived within this window.
+#define CLUSTER_ONLINE_TIMEOUT_MS 2000
 
+// Steering-wheel actions the dashboard can queue ahead of the CAN task; a power of two.
+#define WEB_DASHBOARD_BUTTON_QUEUE_SIZE 8
 
 class WebDashboard {
   WebDashboard(const WebDashboard &other) = delete;
@@ -21,18 +33,46 @@ class WebDashboard {
   WebDashboard &operator=(WebDashboard &&other) = delete;
 
   public:
-    WebDashboard(GameState& game, unsigned long webDashboardUpdateInterval);
+    // Edits made on the dashboard go to dashboardSource; game is the state the cluster shows.
+    WebDashboard(GameState& game, GameState& dashboardSource, CanBusMonitor& busMonitor,
+                 unsigned long webDashboardUpdateInterval);
+    // CAN task side: applies dashboard edits to dashboardSource and button events to the game, and publishes the game
+    // for the dashboard. Returns true when an edit was applied.
+    bool exchangeGameState();
+    // Everything else runs on the network task and only sees the published copy.
     void update();
     void getState(struct state *data);
     void setState(struct state *data);
+    void busReply(struct mg_connection *c, struct mg_http_message *hm);
+#if CAN_FRAME_TIMING
+    void timingReply(struct mg_connection *c, struct mg_http_message *hm, CanFrameTiming &timing);
+#endif
+    void telemetryReply(struct mg_connection *c, struct mg_http_message *hm, TelemetryRecorder &recorder,
+                        TelemetryReplayGame &replay);
     void steeringWheelAction(struct mg_str params);
+    bool steeringWheelActionPending() const;
     void alertStart(struct mg_str params);
     void alertClear(struct mg_str params);
 
   private:
     GameState &gameState;
+    GameState &dashboardSource;
+    bool dashboardSourceEdited = false;
+    GameState viewState;
+    GameState controlState;
+    GameStateSnapshot viewSnapshot;
+    GameStateSnapshot controlSnapshot;
+    // Single-producer ring from the network task to the CAN task; the counters wrap at 256.
+    uint8_t buttonActions[WEB_DASHBOARD_BUTTON_QUEUE_SIZE];
+    std::atomic<uint8_t> buttonActionsWritten{0};
+    std::atomic<uint8_t> buttonActionsRead{0};
+    std::atomic<bool> pendingAlertStart{false};
+    std::atomic<bool> pendingAlertClear{false};
+    CanBusMonitor &busMonitor;
     unsigned long webDashboardUpdateInterval;
     unsigned long lastWebDashboardUpdateTime = 0;
+    // Snapshot last pushed to websocket clients; the next push goes out only when the state differs from it.
+    struct state publishedState;
 
     const char* mapGenericGearToLocalGear(GearState inputGear);
     GearState mapLocalGearToGenericGear(const char *gear);
@@ -10,4197 +10,4216 @@ const char *mg_unpack(const char *, size_t *, time_t *);
 #endif
 
 static const unsigned char v1[] = {
-  31, 139,   8,   0,   0,   0,   0,   0,   0,   3, 172, 125, // ...........}
- 123, 151, 218,  70, 246, 224, 223, 187, 159,   2,  52,  94, // {..F......4^
-  34, 133, 130,   6, 250, 225, 182, 112, 153, 147, 180, 237, // "......p....
- 180,  39, 110, 219, 227, 182, 157, 140, 153,  30,  31,   1, // .'n.........
-   5,  40,  45,  36,  34, 137, 126,  76, 195, 126, 246, 189, // .(-$".~L.~..
- 143, 170, 146,   4, 116,  38, 249, 157, 205, 113,  68, 169, // ....t&...qD.
- 158, 183, 238, 171, 238, 189,  85, 165, 126,  94, 127, 249, // ......U.~^..
- 254, 236, 211,  63,  63, 188, 170, 205, 243,  69, 244, 226, // ...??....E..
- 249,  66, 229,  65, 109,  60,  15, 210,  76, 229, 114, 149, // .B.Am<..L.r.
-  79,  91, 167,  58,  47,  14,  22,  74, 222, 132, 234, 118, // O[.:/..J...v
- 153, 164, 121, 109, 156, 196, 185, 138, 115, 233, 220, 134, // ..ym....s...
- 147, 124,  46,  39, 234,  38,  28, 171,  22, 189, 136,  90, // .|.'.&.....Z
-  24, 135, 121,  24,  68, 173, 108,  28,  68,  74, 118, 219, // ..y.D.l.DJv.
-  29, 231, 197, 243,  40, 140, 175, 107, 169, 138, 100,   8, // ....(..k..d.
-  77, 107, 243,  84,  77, 101, 148, 204, 146, 118, 118,  51, // Mk.TMe...vv3
- 171, 229, 247,  75,  37, 195,  69,  48,  83,   7, 240, 218, // ...K%.E0S...
- 188,  67,  56, 178, 252,  62,  82,  47, 218, 171, 101, 148, // .C8..>R/..e.
- 228, 130, 127, 106, 223, 155, 132,  63,  82, 211,  36,  85, // ...j...?R.$U
- 246,  53, 152, 230,  42, 125,  24,  37, 119, 173,  44, 252, // .5..*}.%w.,.
-  79,  24, 207, 252,  81, 146,  78,  84, 218, 130, 156,  13, // O...Q.NT....
- 215, 121,  32, 208, 252,  69,  24, 183,  52, 232, 253,  41, // .y ..E..4..)
- 252, 182, 166, 193,  34, 140, 238, 253, 236,  62, 203, 213, // ...."....>..
- 162, 181,  10,  69,  43,  88,  46,  35, 213, 226,  12, 113, // ...E+X.#...q
- 169, 102, 137, 170, 125, 126,  35,  62,  38, 163,  36,  79, // .f..}~#>&.$O
- 196, 185, 138, 110,  84,  30, 142, 131, 218,  59, 181,  82, // ...nT....;.R
- 226, 135,  20, 166,  41, 222,  65,  73, 237,  50, 136,  51, // ....).AI.2.3
- 145, 193, 163, 149, 169,  52, 156, 138,  31, 176, 155, 218, // .....4......
-  89,  18,  37, 105, 237, 213,  34, 249,  45, 180, 125, 109, // Y.%i..".-.}m
- 191,  94, 222,  47,  70, 137, 238, 165,  84, 191,  15,  24, // .^./F...T...
-  83, 173, 185,  10, 103, 243, 220, 239, 182, 143,  97,  34, // S...g.....a"
- 173,  60, 204,  35, 245, 144, 171, 187, 188,  21,  68, 225, // .<.#......D.
-  44, 246, 199,  48,  17, 149, 242,  84,  96, 234, 202, 239, // ,..0...T`...
- 158,  46, 239, 248, 245, 150,  91,  62, 237, 116, 176, 229, // ......[>.t..
- 109,  26,  44,  31,  86,   0,  26, 128,  23, 169, 113, 238, // m.,.V.....q.
- 199,  73, 172, 250, 203,  36,   3,  74,  37, 177,  15, 132, // .I...$.J%...
-   9, 242, 240,  70,  97, 213, 228,  70, 165, 128, 217, 214, // ...Fa..F....
-  42,   6,  20,  62, 216,  42, 193,  40,  75, 162,  85,  78, // *..>.*.(K.UN
-  85, 184,   8,  43,  78, 163, 228, 214, 159, 135, 147, 137, // U..+N.......
- 138,  53, 166, 107, 227,  32, 190,   9,  50, 141, 240, 110, // .5.k. ..2..n
- 167, 243, 127, 250, 102,  18, 152, 158, 132, 217,  50,  10, // ....f.....2.
- 238, 253,  81, 148, 140, 175, 247,   3,  16, 220, 133, 217, // ..Q.........
- 254, 113,  35,  53,  83, 241, 100,  15,   2,  22,  65,  58, // .q#5S.d...A:
-  11, 161, 238,  42,  79, 202, 200,  56,  90,  34, 253,  91, // ...*O..8Z".[
-  97, 140, 184, 124, 168,  12,  93, 228, 215, 190, 183,  37, // a..|..]....%
- 156, 209, 218, 174, 144, 167,  15,  60,  64,  43, 229, 137, // .......<@+..
- 156, 112, 191,  12,  78,  45, 159,  63, 148,  49, 126, 194, // .p..N-.?.1~.
-  24, 183, 133,  47, 190, 127,   0,  68,  33, 211,  68,  26, // .../...D!.D.
- 232,   5, 224,  43,  82, 253, 199,  70, 213,  45,  33,   5, // ...+R..F.-!.
- 163,  94,   3, 162,  53,  42, 213, 194,  98,  18, 146,  21, // .^..5*..b...
- 136,  96, 162, 253,  81,  48, 190, 158, 165,   9, 208, 166, // .`..Q0......
-  53, 142, 194, 165, 191,  12,  38,  19, 144,   5,  20, 130, // 5.....&.....
- 122, 184,  64, 169,  13, 226, 188, 152,  21,  14,   4,   8, // z.@.........
-   7,   0, 181, 248, 104, 185, 240,  29, 223, 233, 239,   5, // ....h.......
- 184, 104,  11, 220, 147, 187, 186,   3,  15,   1, 189,   9, // .h..........
- 162,  85, 129,  96, 228,  45, 172, 140, 146, 160,  50, 152, // .U.`.-....2.
- 191,   6, 197, 215, 244, 224, 124, 196, 219, 120, 149, 102, // ......|..x.f
-  73, 234,  47, 147,  16, 201,  88, 157, 124,  50, 157,  66, // I./...X.|2.B
- 211, 100,  25, 140, 195, 252, 222, 111,  31, 114,  75, 100, // .d.....o.rKd
- 222,   7,  93, 191, 165, 110,   0, 224, 140, 121, 185, 152, // ..]..n...y..
- 190, 255, 183,  14, 253, 215, 237, 245, 247, 114,  17,  15, // .........r..
- 218, 186,  19,  69, 250, 126, 111, 151, 183,  97,  20, 181, // ...E.~o..a..
-  64,  23, 198,  51, 229, 231,  41, 200,  54,  40, 157, 197, // @..3..).6(..
- 110, 159, 253,  60,  89, 250, 157, 126, 164, 166, 185,  79, // n..<Y..~...O
- 164, 159, 255, 167, 182,  53, 204,  77,  94,  43,  15, 166, // .....5.M^+..
- 213, 147, 230, 166, 229,  93, 109,  18, 100, 115,  53, 169, // .....]m.ds5.
- 253, 237, 164, 243, 116, 114,  58,  42,  11, 204,  78, 127, // ....tr:*..N.
- 247,  59, 253, 221,  61,  88, 117, 151, 231, 201,  98,  95, // .;..=Xu...b_
- 135, 133,  48, 150,  16, 176, 220, 143, 200, 253, 179, 230, // ..0.........
-  33, 252,  78,  13, 230,  28,  78, 250, 102,   6, 193,  36, // !.N...N.f..$
-  92, 101, 254,  49,   8, 246,  31, 163, 229, 207, 115,  39, // .e.1......s'
-  74,  63,  83,  95,  88, 130,  23, 239, 102, 202,  59,  57, // J?S_X...f.;9
- 247,  59,  57,  75, 221, 172, 202, 150, 207,  15, 120, 101, // .;9K......xe
- 121,  62,  74,  38, 247,  47, 254, 247, 243, 108, 156, 134, // y>J&./...l..
- 203, 156, 151, 160,  69,  50,  89,  65, 209, 116,  21, 143, // ....E2YA.t..
- 113,  38,  53, 229,  42, 145, 139,  72, 196, 222, 195, 251, // q&5.*..H....
- 209, 111,   8, 199,  68,  77, 129, 253,  63, 164, 201,  18, // .o..DM..?...
-   4, 228, 158, 138,  31, 102,  42, 247,  35,   1, 203, 165, // .....f*.#...
-  31,  11,  21, 175,  22,  42,  13,  70, 145, 242, 235,  29, // .....*.F....
-   1,  18,  53,  13, 103,  43, 243, 190, 241,  54,  55,  65, // ..5.g+...67A
-  90, 163,  30, 229,  44,  74,  70,  65, 244, 105,  30, 102, // Z...,JFA.i.f
-  34, 145,  15,  27, 145, 226,  35, 148, 113, 123,  25, 164, // ".....#.q{..
-  99,  21, 125,  84, 191, 175, 194,  84,  61,  59,  26, 247, // c.}T...T=;..
- 250, 241,  42, 138, 164,  12,  27,  13, 215,  13, 165,   1, // ..*.........
- 206,  85, 222,  67,  56, 117,  21,  44, 182, 181, 196,  75, // .U.C8u.,...K
-  85, 190,  74,  33,  49,  84,  87, 109, 117, 135, 216, 204, // U.J!1TWmu...
- 250, 166,  52, 245,  30, 104,  88, 153,  66, 105, 127,   2, // ..4..hX.Bi..
-   8, 205,  85, 141, 210, 152,  29, 201, 135, 112, 226,  43, // ..U......p.+
- 161,  91, 249,  15, 155,  77, 191, 212, 155, 140,  68, 222, // .[...M....D.
-   6,  69,  16, 185, 145, 233,  24, 192, 183, 105, 175,  72, // .E.......i.H
- 210, 220,  98, 249,  42,  77, 147, 212, 117, 206, 130,  24, // ..b.*M..u...
- 116,  68,  13, 176,  53, 169,  49,  90, 107, 223,  57,  77, // tD..5.1Zk.9M
- 213, 116, 190, 115, 188, 126,  62,  79, 147, 219,  90, 220, // .t.s.~>O..Z.
-  30,  39,  19,  37, 157, 139, 247,  47,  63, 191, 125, 245, // .'.%.../?.}.
- 237, 221, 251,  79, 223,  94, 191, 255, 252, 238, 165,  35, // ...O.^.....#
- 226, 141, 215,  78, 213,  44, 132,  37,  56,  45,  77,  88, // ...N.,.%8-MX
- 228, 222,   3, 194,  45, 243, 141, 216, 131,  39,  25, 122, // ....-....'.z
- 194, 237, 136, 208,  54, 245,  92, 231, 233, 231, 159, 131, // ....6.......
- 159,  28,  97, 251,   0, 220, 123,  15, 128, 128,  90,  44, // ..a...{...Z,
- 146, 190, 114, 115,  59,  39,  39,  85, 184, 166,  57, 194, // ..rs;''U..9.
- 245, 228, 139,  55, 158, 168, 148, 141,  83,  21, 228, 234, // ...7....S...
-  12, 245, 227,  93, 206,  85, 126, 217, 170, 130, 198,  19, // ...].U~.....
- 151, 252, 180,  85,   2, 139, 238, 171, 233,  20, 152, 135, // ...U........
- 139,  85, 178,  91, 254,  81,  77, 117,  97, 186,  91, 120, // .U.[.QMua.[x
- 161,  22, 137,  46,  13, 119,  75,  43,  64, 169,  96, 171, // .....wK+@.`.
- 194,  40, 200, 199, 115,  93, 246, 106, 171,  44,   3, 197, // .(..s].j.,..
-  30, 104, 152, 213, 249, 110, 207, 151, 229, 242, 127, 108, // .h...n.....l
-  79, 151, 243,  47,  60, 226, 161,  84, 132,  34,  16, 153, // O../<..T."..
-  88, 137, 177, 152, 138, 165, 152, 136, 185, 152, 137, 133, // X...........
- 248, 134,  60, 125,  35, 135,  87, 226,  94,  30, 160,  26, // ..<}#.W.^...
-  95, 171,  59, 119, 224, 103, 235, 217,  58,  94,  47, 215, // _.;w.g..:^/.
-  79, 188, 117, 186, 156, 175, 103, 105,  56,  89,  39, 183, // O.u...gi8Y'.
- 217, 122,  17, 143, 215, 113, 126, 187,   6,   9,  27, 142, // .z...q~.....
- 231,  87, 235, 255,  36, 201, 250, 223, 160, 103, 214,  33, // .W..$....g.!
-  16,  51,  56,   8, 197, 157, 252,  33,  77, 131, 251, 118, // .38....!M..v
- 152, 209, 111, 223,  10, 234, 136, 153,   3,  20, 149,  75, // ..o........K
-  60, 141, 108, 159, 123, 106,  24,   1, 175, 192, 195,  48, // <.l.{j.....0
- 180, 218, 216,  22, 183,  40,  63, 170, 209,  80, 200,  71, // .....(?..P.G
- 160, 251, 222,   1,  43,  86, 223, 128, 141,  22,  96, 225, // ....+V....`.
- 156, 205, 195, 104,   2, 149, 139, 166,  23, 172,  21,  88, // ...h.......X
- 170, 128, 143, 112, 242,  48, 209,  62, 142,  30, 242, 200, // ...p.0.>....
- 206, 181, 186, 119,  64, 100,   7,  49, 140,  31,  94, 249, // ...w@d.1..^.
- 192,  93,  83, 122,  79, 248,  61, 128,   7, 165,  80,  72, // .]SzO.=...PH
-  97,  29,   7, 165,   1, 234, 183,  29, 169, 120,   6, 246, // a........x..
-  66,  15,  36,  61, 104, 143, 113,  96,   0,  70, 238, 148, // B.$=h.q`.F..
-  31,  14,  82,  22,  73,  91,  34, 122, 158,  31, 121, 194, // ..R.I["z..y.
-  49,  48, 194,  88, 168, 208, 146, 105,  13,  38, 133, 234, // 10.X...i.&..
- 163,  46,  21, 234, 174,  96,  21, 229, 168, 188,  50, 207, // .....`....2.
-   2, 187, 149, 127, 147, 132, 147,  90,  71,  74, 137,  32, // .......ZGJ. 
-  34,  28,   8, 105, 181,  14, 228, 120,   6, 163, 215, 128, // "..i...x....
- 139,  64,  32,  18, 112, 148,  18, 146, 174, 141, 234,  20, // .@ .p.......
-   9,  35,  10, 244,  27, 130,   4, 154, 102, 137, 157, 248, // .#......f...
- 185,   0,  28, 129, 222,   4, 204, 128, 222, 252, 246, 237, // ............
- 218, 199,  30,  32,  97, 126,  71, 126,   7, 158, 202, 188, // ... a~G~....
- 142,  57,   1,  42,  53, 203, 211, 213,  56,   7, 171, 129, // .9.*5...8...
-  97, 133, 178,  27, 159,  85, 100,  50, 104,  54,   3,  63, // a....Ud2h6.?
- 129, 156, 208, 111, 117, 225, 103,   5, 235, 177,   1,  85, // ...ou.g....U
-  87,  49, 248,   8, 219,  55,  49, 209,  92,  39,  92,  16, // W1...71..'..
- 189, 180, 128, 255,  45, 242, 135,  97,  27,  75, 139, 162, // ....-..a.K..
- 252, 140,  57,  46,   7, 253, 221, 166,   9,  73, 120, 199, // ..9......Ix.
- 151,  49,  11,  36, 232,  40,  91, 247,   9, 215,   5,  82, // .1.$.([....R
-  51,  12, 185, 103,  59, 254, 246, 109,   0, 165, 240,  35, // 3..g;..m...#
- 240,  17,  54, 187,  30,  77, 165, 111,  57, 185, 159,  63, // ..6..M.o9..?
- 199, 146, 107,  77, 251, 126, 222, 108, 122, 186, 163, 186, // ..kM.~.lz...
- 116,  35,  73, 133, 195, 252, 202,  51, 243, 138,  32,  67, // t#I....3.. C
- 153,   1, 232,  69,  35,  96,  31, 115, 180,  49, 129,  16, // ...E#`.s.1..
- 240, 176,   5, 200, 151,  56, 125, 183, 142, 189,  79, 128, // .....8}...O.
-  11, 232,  87, 214,  59,  48,  10,  76, 119, 149, 205, 161, // ..W.;0.Lw...
- 184, 209, 168, 127, 130, 236, 180, 217,  92, 175,  87, 117, // ..........Wu
-  96, 110,  96, 146,  17, 172, 239,  99,  80, 103, 168,  74, // `n`....cPg.J
-  97, 113, 247, 112, 201,  90, 237,  45,  89, 175, 199, 158, // aq.p.Z.-Y...
- 251, 169, 196,  48, 159,  92, 230,  19, 203,  54,  34,   5, // ...0.....6".
- 206,  90,  17,  38, 178,  54, 172, 231, 185,  59, 245, 250, // .Z.&.6...;..
-  74,  66, 122,  30,  78, 115, 215, 235, 123,   6, 186,  92, // JBz.Ns..{...
-  26, 209, 128, 117,  85,  51,  69,  42, 221, 132, 240, 227, // ...uU3E*....
-  65, 165,  27, 124,   0, 163, 162,  38,  90, 225,   3, 241, // A..|...&Z...
- 242,   1, 129, 139, 229, 200,   5,  29, 149, 120,  84,  77, // .........xTM
-  38, 248, 108, 118, 197,  14, 115, 196, 158, 120, 233,  82, // &.lv..s..x.R
-  43,   2,  13,  83,  49, 247, 210,  70, 191,  56,   3,  35, // +..S1..F.8.#
-  85, 125, 254, 248,  70,  28, 246,  26, 216, 199, 106,  48, // U}..F.....j0
-  76, 175, 152,  97,   3, 193,  68,  79,   1, 205, 137, 231, // L..a..DO....
- 167, 162,  94, 119,  77,  45,  79, 192, 191, 184,  24, 153, // ..^wM-O.....
- 210,  68,  80,  76, 128, 224, 197, 226, 163, 139, 226, 165, // .DPL........
- 171, 169, 186,  76,  27, 141, 146, 121, 146,  51, 206,   0, // ...L...y.3..
-  95, 253, 130,  41, 128, 247, 160, 174, 101,   8, 124,  25, // _..)....e.|.
- 179, 110, 196, 164, 226, 140, 246,  40, 200, 148,  36,   8, // .n.....(..$.
-  35,   9,  70, 218, 243, 188, 204, 101,  81, 133, 203,  98, // #.F....eQ..b
- 106, 114,  13, 138, 212, 118,  74, 208,   0, 251, 239, 116, // jr...vJ....t
-  72,  12,  55, 130, 245, 242, 122,  99, 152,  28, 160, 220, // H.7...zc....
- 108,   0, 131, 158, 176,  26,  44,  71,  62, 210,  52, 245, // l.....,G>.4.
- 250, 196,  70, 178,  83, 240, 194, 127, 220,  42,  23, 232, // ..F.S....*..
- 149, 133,  39,  91,  44,  47, 247,  98,  36,  99, 128,   8, // ..'[,/.b$c..
- 129,  91, 175, 111, 196,   5,  64, 162,  39, 128, 179,  93, // .[.o..@.'..]
-  85,  76, 135, 138,  46,  42, 250,   4, 121, 209, 172, 179, // UL...*..y...
- 148,  83,  49,   1,  84,  96,  83, 146,  42,  94, 108, 128, // .S1.T`S.*^l.
- 104, 192,  76, 157, 126, 250,  60, 233,   3, 175, 123,  26, // h.L.~.<...{.
-  39,   1, 168, 239,  20, 241, 225, 140, 146,  36,  82,  65, // '........$RA
- 236, 212, 141,  84,   5, 144, 105, 101, 173, 200,  29,   0, // ...T..ie....
-  64, 105, 115,  34, 160,  41,  11, 109, 122,  37,  29, 208, // @is".).mz%..
- 101,  32,  13, 133,  68,   6, 235, 181,   3,  38, 228,   8, // e ..D....&..
-  44, 145,  74, 222,  40,   4,  95,  47, 175, 228,   5, 237, // ,.J.(._/....
- 146,  46, 148, 242, 146, 122,  26,  92, 187,  37, 174,  43, // .....z...%.+
-  30, 158, 127, 231,   6,  30, 148, 190,  21,  15,  70, 153, // ..........F.
- 249, 193, 102, 167,  86, 161, 254, 203, 189,  55,  26,   1, // ..f.V....7..
-  64,  60, 122, 209, 129,  14,   2, 210,  25,  34,  96, 173, // @<z......"`.
-   7, 191, 160, 198, 225,   9, 106, 124,  64,  79, 205, 245, // ......j|@O..
-  36, 117, 126, 128,  98,  37,  21, 189, 142, 104, 218,  35, // $u~.b%...h.#
- 144, 174, 140, 249, 174, 213,   5, 173, 225, 142,  37,  22, // ..........%.
- 134,  59, 180,  98,  74,  33, 253,  67, 104,  72, 131,  72, // .;.bJ!.ChH.H
- 214,  87, 208, 158,  22, 117, 171,  79, 101, 182,  94, 103, // .W...u.Oe.^g
-  32, 171, 144, 192, 138,   0,  45, 230,  81, 221,  70,   3, //  .....-.Q.F.
-  38, 227, 246, 128, 219,  80, 220, 172,  90, 164, 182,  47, // &....P..Z../
- 154, 154, 193, 179, 173,  90, 180,  56,  38,  50, 130,  37, // .....Z.8&2.%
-  36, 149,  81, 179, 219,  79,  94, 200, 206, 122, 157,  62, // $.Q..O^..z.>
- 183, 236,  69, 202,  28, 115,  41, 225,  34,  64,   9,  50, // ..E..s)."@.2
-  67, 185, 155, 253,   0,  89,  75, 189, 159, 180,  90,  27, // C....YK...Z.
- 104,  92, 244,  90, 244, 149, 254, 181, 190,  82, 100, 204, // h..Z.....Rd.
- 141, 145, 183,  86, 119,   3,  58,  35,   2, 246,  94, 122, // ...Vw.:#..^z
- 168, 128, 151, 173, 150, 128,  94, 163, 225,  24, 123, 117, // ......^...{u
- 169, 195, 181, 236, 129,  56,  50, 246,   0, 121,   6, 141, // .....82..y..
-  72, 180, 129, 219, 234,  74,  57, 110,  52,  38, 208, 110, // H....J9n4&.n
-  31,  31, 107, 188, 186,   1, 119, 116, 228, 121, 254, 184, // ..k...wt.y..
-  46,  87, 144,  51, 150, 114, 213, 234,  14, 160, 161, 143, // .W.3.r......
- 201,  38,  36, 155,  77, 223,  29, 191,  88,  81,  30, 188, // .&$.M...XQ..
- 136, 162, 145, 231,  91,  41, 160,  21,  15, 230, 190,  36, // ....[).....$
- 196, 179, 176,  77, 203, 194, 134, 208, 239, 193,   9, 205, // ...M........
-  69,  73, 212,   1, 160, 163, 158, 184,  25, 204, 169, 172, // EI..........
-  28,  43, 108, 132,   3, 132, 237,  85, 188, 128, 133,  40, // .+l....U...(
-  71, 197, 174, 147, 160, 157,   4,  16,  59,  71, 222, 197, // G.......;G..
-  62, 147,  54, 184, 143, 104,   3,  54,  26,  54,   9, 124, // >.6..h.6.6.|
-  74, 154, 110, 189,  62, 119, 217, 210,   1, 243, 143, 241, // J.n.>w......
-  87, 151, 212,  24,  85,  44,  51,   5, 200,  13, 120, 179, // W...U,3...x.
-  49, 180, 250,   5, 252, 232, 207,  60, 136, 151, 167, 247, // 1......<....
-  15, 251, 139,  92, 111,  51,  70,  43, 157, 252,  57,  28, // ....o3F+..9.
-   4,   4,   0,  12, 169, 132, 245,  41,  46,  11,  31,   8, // .......)....
-  65, 200,  43,  60, 210, 117,   9,  77, 137, 225,  72, 196, // A.+<.u.M..H.
-  86,   2,  72,   2,  27, 214, 197,  95, 156,  59, 232, 141, // V.H...._.;..
-  93, 250, 229, 204,  58, 125,  40, 189, 229,   5, 193,  19, // ]...:}(.....
-   4,  63, 245, 205, 243, 212, 139, 232, 198, 205,   4, 224, // .?..........
- 212,  26,  80,  27,  23, 156,  65,  49,   2, 206, 186, 240, // ..P...A1....
-  64,  93, 118, 250, 203, 231,  23, 253, 101,  65, 166,  57, // @]v.....eA.9
-  25,  31, 215, 195,  37,  49, 218,  68,  34,  35, 201,  57, // ....%1.D"#.9
-  74, 247, 224, 155,  63,  26,  82, 234, 106, 189, 254,  38, // J...?.R.j..&
-  40,  37, 151, 224,  21, 188, 132, 217, 206,  65, 161,  87, // (%.......A.W
- 245, 188, 152,  81,  51,  40,  66, 170,   0,  43, 226,  79, // ...Q3(B..+.O
-  93, 234,  55, 119, 194, 191, 231, 156,  96, 122, 204, 129, // ].7w....`z..
- 244, 108, 153,  80,  45,  26,  98, 188,  94, 207, 160, 192, // .l.P-.b.^...
-  48, 250, 194,  44,  94,  51, 232,  99,  33, 103, 158,  56, // 0..,^3.c!g.8
- 106, 204, 137,  31, 215,  19, 210, 247,  12, 236, 245, 160, // j...........
-  88,  56, 246, 114, 209,  30,  67,  74,  35, 245, 129,  21, // X8.r..CJ#...
-   7,  17, 137,  22,  13, 176,  54, 247, 210, 136,  72,  68, // ......6...HD
- 232, 134, 213, 183,  32,  88, 129, 235, 104, 147, 243, 122, // .... X..h..z
-  31,  65, 101, 248,  63, 215,  82,  87, 143, 201, 192,  12, // .Ae.?.RW....
- 194,  56, 115,  35, 196, 114,   4, 124, 159, 227,  20, 219, // .8s#.r.|....
- 144, 165, 210, 252,  71,  10, 140,  51,  97,  69, 196, 162, // ....G..3aE..
-  13,  78,  58, 211, 213, 235,  79,  18, 112, 248, 161, 191, // .N:...O.p...
- 168,  29, 131, 145, 122,  25, 142,  34,  88,  52, 250, 183, // ....z.."X4..
- 176,  34,  40, 173,  12, 161, 240,  84,   2,  33, 209, 236, // ."(....T.!..
- 249,  84,  82,  50, 209, 198, 157,   3, 121, 192,  82, 220, // .TR2....y.R.
-  51, 255, 185,   6, 143, 249,   6, 196, 229,  30, 144, 120, // 3..........x
- 239,  35, 162,  87, 114,  86,  30, 203,  35, 202, 172,  26, // .#.WrV..#...
- 178, 245, 180, 152,  44, 241, 220,  66, 172,  10,  11, 224, // ....,..B....
- 149, 246, 246, 185,   2,  88,  52, 235,  53, 152, 109,  76, // .....X4.5.mL
-  71, 133, 235, 161,  94, 116,  11,  83, 118, 189, 118, 239, // G...^t.Sv.v.
-  64, 134,   6,  10, 236, 138, 133, 114, 203,  97,  18, 238, // @......r.a..
- 108, 227, 249, 185, 177,  93, 129, 229, 139, 177,  62,  24, // l....]....>.
- 127, 206, 105,  97, 127, 195, 206,  21, 118, 162, 114,  27, // ..ia....v.r.
- 229, 201, 245, 192, 209, 192, 113, 192, 205, 242,  21, 216, // ......q.....
- 219, 178, 148, 101,  86, 108,  43,  99, 128, 247, 251, 118, // ...eVl+c...v
- 174,  50,  84,  46, 131, 200, 143, 154, 206, 242, 206,  41, // .2T........)
-   6, 252,  97, 199,  30, 233,  43,  31,  25, 139,  34,  83, // ..a...+..."S
-   8, 131, 199, 111,  85, 219,  32,   2, 131, 151, 106, 180, // ...oU. ...j.
- 199,  89, 246,   9, 125, 140, 168, 175, 162,  76,  61, 236, // .Y..}....L=.
- 171,  28, 147, 213,  94, 173,  30,  75, 199,   1,  78,  33, // ....^..K..N!
- 245, 145, 163, 239,  23, 123, 200,  90, 152,   2, 136,  63, // .....{.Z...?
- 152, 250,   0,  27, 212,  67,  78, 143, 138, 170, 145,   7, // .....CN.....
-  61,  70,  56, 113, 208, 183, 240,  83, 173, 143,   5, 222, // =F8q...S....
-   6, 129, 169,  33,  48, 137, 198,  35,  24,  66,  68, 162, // ...!0..#.BD.
-  97, 247, 202,  75, 101, 174, 109, 211,  84,  45,  35,  48, // a..Ke.m.T-#0
- 151, 221, 165, 112, 158, 116,  29, 164,   5, 100, 230, 201, // ...p.t...d..
- 219, 228,  86, 165, 103, 160, 244,  92,  15, 221,  82,  32, // ..V.g.....R 
- 114,  18, 191,  78, 198, 171, 236, 253, 138,  12, 159,  34, // r..N......."
- 227,  13, 117,  58, 216, 106, 212, 206, 162,  16, 122, 237, // ..u:.j....z.
-  33, 153,  77,  18, 188,  42, 152,  25,   0,  26, 129, 131, // !.M..*......
-  78, 111, 195, 188, 153,  98,  80,  43,  26, 196, 131, 168, // No...bP+....
- 189,   2, 131, 117, 229, 187, 152, 152,  64, 105,  48, 153, // ...u....@i0.
- 188, 194,  64, 232,  91,  12,  31, 197,  10, 166,  46, 210, // ..@.[.......
- 193, 204, 159, 139, 148, 150,  43,  14,   8,  60,  86, 163, // ......+..<V.
- 160, 197,  60, 207, 151, 254, 193, 193, 237, 237, 109, 251, // ..<.......m.
- 246, 176, 157, 164, 179, 131,  94, 167, 211, 193, 173,  45, // ......^....-
- 128,  59, 241, 202,  56,  56, 184, 195, 125,  49, 247, 124, // .;..88..}1.|
- 237, 207, 189,   3,  12, 171, 120,  69,  81, 246,  14,  60, // ......xEQ..<
- 139,  39, 144, 155,  57, 220,  57, 225, 150,  34, 185, 200, // .'..9.9.."..
- 106, 128,  92,  14,  19, 155,  23, 140,  49, 112,  50,   2, // j.......1p2.
- 232, 116,  18,  99, 183,  58, 153,   7, 163,  55, 224, 126, // .t.c.:...7.~
- 221, 233, 215,  73, 114,  27,  71,  73,  48, 209, 175, 105, // ...Ir.GI0..i
- 114, 123, 185, 100,  51,  22, 222, 198,  73,  84, 122,  75, // r{.d3...ITzK
-  65, 216, 116, 114, 153,  44, 113, 219, 135, 223, 136,  51, // A.tr.,q....3
-  20,  45, 110, 219,  50,  17, 177,  19,  80,  83, 197, 234, // .-n.2...PS..
- 182, 217, 163,  56, 144,  58, 186, 213, 122,  93, 199, 245, // ...8.:..z]..
-   2,  56,  18, 228,  16, 186,  31,  30, 161,  28,  50, 206, // .8........2.
- 127, 200, 129, 189,  71, 171,  28, 125,   9, 159, 132, 179, // ....G..}....
- 148,  35,  44,  80,  18, 129, 234,  90,  65,   5, 183, 195, // .#,P...ZA...
- 202, 220, 143,  37, 127, 190, 136,   6, 210, 146,  77, 110, // ...%......Mn
- 187,  14, 231, 128, 162, 164, 183,  33,  43, 220, 166,  42, // .......!+..*
- 153, 153, 144, 229, 193, 255,  18, 236,  24,  75,  14, 120, // .........K.x
- 127,  14, 220, 163, 149, 164,  85, 104,  96, 105,  80,  68, // ......Uh`iPD
- 125, 160, 127,  17, 108, 244, 130,  10, 120,  94, 150,  92, // }...l...x^..
- 156,  71,  29, 156,  27, 112, 113,  46, 196, 181, 184,  20, // .G...pq.....
- 159, 196,  43, 241,  65, 252,  40,  94, 138, 143, 226,  92, // ..+.A.(^....
- 188, 145,  12,  30, 194, 102,  85, 110,  94, 182, 216, 189, // .....fUn^...
-  82, 208, 163, 223, 237, 157,  54,  34, 210, 186, 104, 163, // R.....6"..h.
- 177, 255,  25, 177, 255,   9,  46, 241,  74, 175, 249, 164, // ........J...
- 133, 175, 192,  24,  90,  74, 180,  67,  70, 176, 186,  44, // ....ZJ.CF..,
-   1, 110, 173, 154, 118,  73, 247, 134, 232,  14, 101, 232, // .n..vI....e.
- 118, 177,  51, 112,  45,  29,  72, 228,   9, 214, 112, 128, // v.3p-.H...p.
-  53, 222,  52,  26, 111, 218,  54, 167, 205,  33,  86, 113, // 5.4.o.6..!Vq
-  41,  97, 136,  55,  38,  80,  66, 107,  12, 172, 204, 195, // )a.7&PBk....
-  37, 174, 216,  87, 226, 147,  92,  14,  46,   7, 151, 220, // %..W........
-  99, 155, 246, 149, 124,  44, 242, 217, 223,  30,  15, 238, // c...|,......
-  37, 152,  22, 108, 177,  80,   6, 185,  24, 184, 128, 191, // %..l.P......
- 242, 221, 235,   1,  23,  76, 100, 172, 110, 107, 111, 220, // .....Ld.nko.
-  11, 241, 201, 243, 221, 114, 222,  25, 229, 137,  73, 197, // .....r....I.
- 121, 122,  35,  38,  26,  56, 249, 213,  19, 151, 141, 198, // yz#&.8......
- 101,  59,  91, 141, 220,   9, 214, 227, 224, 206,   5, 164, // e;[.........
- 178,  60, 200, 113, 153, 209,  41, 210,  40,  19,  27, 239, // .<.q..).(...
- 249,  36,  16, 134,  24,  92, 246,  57,  65, 131, 225,  18, // .$.....9A...
- 202, 154,  99, 192,   1,  18, 217,   8,  18, 158, 184, 102, // ..c........f
-  43,  68,  82, 165, 140, 172,  25, 248, 149, 186,  83,  91, // +DR.......S[
-  94,   7,  12, 205,  84, 254,  82, 165, 225, 141, 154,  92, // ^...T.R.....
-  98, 217, 235,  52,  89,  80,   0, 206,  54,  50, 173, 108, // b..4YP..62.l
-   6,   5,  51,  40,   9, 106, 117, 196, 153, 226, 241, 142, // ..3(.ju.....
- 220,  11,  83,  25,  77,  46,  61,  87, 177,  48, 221,  82, // ..S.M.=W.0.R
- 225,  13, 216,  40, 115, 207,  66, 253,  71,  80,  49, 220, // ...(s.B.GP1.
- 147, 170, 153, 123, 193, 246, 246, 190,  92, 183,  52, 219, // ...{......4.
-  82, 249, 203, 112,  98,  27,   1, 250, 120, 205, 222,  83, // R..pb...x..S
-  94, 104, 220,  63,   5, 221,   5, 200, 200, 236,  17,  32, // ^h.?....... 
-  63, 170, 177, 130,  54, 186, 230,  31,  20,  50, 247, 212, // ?...6....2..
-  17,  48, 196, 186, 233,  44, 155,  39, 171, 104, 114, 102, // .0...,.'.hrf
-  90, 125,  94,  78, 136,  42, 164, 208,  30,  41,  53, 184, // Z}^N.*...)5.
- 135, 254, 214, 235, 156,  16,  77, 252, 124, 227,  21, 177, // ......M.|...
- 154,  27,  14, 231, 221,  16, 125, 183,  24, 145, 249,  71, // ......}....G
- 104,  86, 235, 178,  17, 175, 165, 152, 210, 215, 108, 141, // hV........l.
- 115, 122, 215,  40,  82,  58, 172,  39, 209,  50,  18, 175, // sz.(R:.'.2..
- 192,  88, 125, 245, 156, 184, 212,  88, 171, 175, 192,  90, // .X}....X...Z
- 173,  16,   0, 202, 134, 175, 174, 192, 134, 212, 188, 204, // ............
- 220, 173, 171, 219, 192, 224, 196, 179, 154, 127,  47, 170, // ........../.
-  13, 110, 246, 102, 151, 144, 242,  24, 107,  20, 237,  45, // .n.f....k..-
- 104, 118,  90, 222, 195, 190, 186,  46, 169,  82, 152,  37, // hvZ......R.%
- 186,  80,  85, 129,  45, 112, 138, 110,  22,  51, 188,   2, // .PU.-p.n.3..
- 108, 138,  15, 164,   3,  83, 241, 163, 236, 136, 107,  38, // l....S....k&
- 200, 126, 188, 139,  15, 141, 198,   7, 244,  33, 151, 210, // .~.......!..
- 232,  16,  67,  43,  81, 136, 145,  30, 211,  19,  47,   1, // ..C+Q...../.
- 207,  47, 171, 120, 126, 185,  15, 207,  47,  75, 120, 102, // ./.x~.../Kxf
- 187,  10,  44, 247, 255, 225, 152,  21, 192, 181, 173,  63, // ..,........?
- 225, 208, 105, 179, 249, 227, 243, 222, 177,  87, 157, 154, // ..i......W..
- 193,  58, 136,  18, 109, 126, 232,  45,  38, 114, 178,  71, // .:..m~.-&r.G
-  46, 169, 152,  24, 123, 221,  42, 119,  81, 139,   0, 209, // ....{.*wQ...
- 234, 243, 130, 112,  80, 229,  50,  14, 150,  32,   0, 218, // ...pP.2.. ..
-  49,  49, 212, 115, 111,  30,  47,  69, 122,  65,  87,  43, // 11.so./EzAW+
- 137,  97, 192,  59, 247, 163, 228, 222, 150, 176,  30, 209, // .a.;........
- 170,   7,  50, 245, 214,   8, 252,  18,  99,  34, 131, 165, // ..2.....c"..
-  94,  45, 108, 100, 107, 233,  13,  62, 250, 195, 143,  87, // ^-ldk..>...W
- 123, 150,  88,   0, 156,  60, 235, 220,  10,  10,  58,  35, // {.X..<....:#
- 221, 147, 238,  99, 236,  44, 238, 181, 122, 125,  69, 248, // ...c.,..z}E.
- 145, 188, 209,  81, 248, 236,  83,  22,  85, 142, 105, 141, // ...Q..S.U.i.
- 217, 227, 170, 203,   0,  77, 120, 213, 206, 231,  42,  46, // .....Mx...*.
- 228, 121, 181, 150, 227,  65, 247, 164, 227, 195, 138, 220, // .y...A......
-  95, 145, 163, 181, 178, 142,  86, 163, 177, 170,  56, 101, // _.....V...8e
- 222,  74,  86,  51, 130,  97,   0,  78,  30,  24, 112, 239, // .JV3.a.N..p.
- 167, 238, 202,  99, 107,  75,  75, 253, 138, 121,   4, 199, // ...ckKK..y..
-  57, 151, 129, 225, 172, 243,  86, 171, 239, 221, 186, 193, // 9.....V.....
- 240, 252,  74,  27, 144, 143, 232, 136, 190,   9,  60, 160, // ..J.......<.
-  27, 196,  93,  49, 122,   3, 244,  60,  11, 213,  52, 112, // ..]1z..<..4p
- 183,  21, 139, 238, 204, 243, 141,  21, 177,  27, 114,  53, // ..........r5
- 184, 103, 227, 166, 188,  61,   8, 230,  13,  52, 103, 190, // .g...=...4g.
-  29,  89,  35, 226, 162, 100, 220,  56, 108,  51,  95,  12, // .Y#..d.8l3_.
-  18, 249,  71,  86, 181, 239,  44,   2,  48, 138,  31, 173, // ..GV..,.0...
- 216, 125, 246, 236, 244, 224,   2, 170, 208, 227, 226, 173, // .}..........
- 227,  39, 176, 142,  63,  86, 245, 217, 193,  29, 237, 230, // .'..?V......
- 154,   0,  79, 192,   4, 156,  98, 108, 248, 185,  69, 238, // ..O...bl..E.
- 148,  67, 228, 238,  76,   6, 195,  41,   5, 130, 203,  86, // .C..L..)...V
-  41,  90,  63,  51,   9, 182, 214,   5,  48, 207, 197,  96, // )Z?3....0..`
- 214, 142, 146, 113,  16, 161,  65,  15,  64, 250, 135,  18, // ...q..A.@...
- 157,  98, 227,  96, 131,  46, 150,  51, 129, 189, 112,  36, // .b.`...3..p$
- 140, 163, 231,  27, 107, 119, 170, 210, 214, 209, 133,  49, // ....kw.....1
- 236,  38, 224,   8, 225, 214,  95, 155, 247, 166, 209, 191, // .&...._.....
- 195,  77,  75, 119, 132, 123,  36,  91, 133, 175,  34, 133, // .MKw.{$[..".
- 111, 239,  46, 221,   4, 204, 201,  81,  59, 132,  53, 110, // o......Q;.5n
-   4,   2,   6, 160,  33, 225,  23,  24,  13, 131,  31, 176, // ....!.......
- 164,   3,  20,  59,  92,  76,   2,  27, 115, 210, 177, 193, // ...;.L..s...
-  11, 239,  30, 158, 163, 245, 122, 133, 187, 164,  32, 166, // ......z... .
-   1, 191, 186, 250, 101,  84, 172, 198,   1, 178, 141, 222, // ....eT......
- 161, 212,  91, 103,   8,  90, 230,  21, 228, 198,  32,  80, // ..[g.Z.... P
- 125, 101, 244,  68,  64, 110, 230,  61, 110,  22,  51, 146, // }e.D@n.=n.3.
- 193,  19,  51, 136, 204, 202, 248, 190,  31,   2, 186, 203, // ..3.........
- 133, 136, 121, 218, 128, 185,   2, 132, 146, 173,  72, 225, // ..y.......H.
- 251,  41, 250,  37, 247,  72, 158, 153, 188, 135,  58, 194, // .).%.H....:.
-  49, 154,   1, 120, 100,  90, 114, 166,  38, 120, 200,  37, // 1..xdZr.&x.%
-  77,  86,  89, 116, 127, 169, 242,  55,  49, 120, 116, 231, // MVYt...71xt.
- 159, 128,  63, 176, 214,  68, 206, 108, 197,  58, 119,  57, // ..?..D.l.:w9
- 226,  24, 159,  67,  35,  97,  37, 116, 163, 120, 103, 244, // ...C#a%t.xg.
-  11, 101,  97,  29, 240,  83, 199, 115,  53, 190,  86, 147, // .ea..S.s5.V.
- 106, 141,  51, 157,  73, 253, 160, 114,  14,  99,   0,  23, // j.3.I..r.c..
-  99,   1,  58, 132,  53,  19, 137, 183, 177, 224, 143, 188, // c.:.5.......
- 153,  28, 237, 192,  62, 152, 203, 153, 255,  71,  96,  15, // ....>....G`.
- 150,  88, 193,   2,  56,  88, 224, 107,   9, 158, 193,  13, // .X..8X.k....
- 100, 172, 246, 238,  80, 204, 214, 107,  68,  22, 208,  21, // d...P..kD...
-  82,  12, 215,  76,  16, 250,  18, 143, 195, 179,  24,  41, // R..L.......)
- 195, 136,  50,  42,  74, 144,  16, 201,  70,  44,  38, 215, // ..2*J...F,&.
- 235,  82, 166,   2,  53, 165,  65, 242, 136,  67, 236, 171, // .R..5.A..C..
-  52, 181,  60, 173, 126, 134,  87,  22, 199, 188, 207,  88, // 4.<.~.W....X
-  84, 197,  88,   5, 175,   0, 115, 111,  48, 247, 135, 115, // T.X...so0..s
- 163, 205, 209, 167,   5, 199,  55, 230,  35,  57,  36, 245, // ......7.#9$.
- 127,  44, 200,  62, 235, 160,  96,  16,  12,  59,  87,  62, // .,.>..`..;W>
-  41, 175,  70, 227, 137,  27, 137, 142,  71, 138,  73, 148, // ).F.....G.I.
- 217, 112,  90, 232, 207, 169, 209, 159, 192, 101, 125, 152, // .pZ......e}.
-  59, 148, 105, 204,  10, 244, 115, 102, 169, 202,  50,  28, // ;.i...sf..2.
- 222,  44,  70, 139,  61, 254, 170, 110,  80, 218,  89,  89, // .,F.=..nP.YY
- 172, 215,  11,  68,  18, 244,  10,  51,  46,  58, 170, 203, // ...D...3.:..
-  11,  40, 193, 152, 158, 147,  44,  53, 101,  46, 184,  46, // .(....,5e...
-  18, 193,  51,  52,  89,  24, 154, 128, 176,  88, 202,  10, // ..34Y....X..
- 235,   6, 130, 177,   8, 102, 163, 238, 158,  91, 220, 152, // .....f...[..
-  22, 158, 221, 147, 219, 184, 122,  17,  40, 233, 104,  92, // ......z.(.h.
-  29, 181,   7,  75,  62, 224,  36, 156,  78, 213,  68, 187, // ...K>.$.N.D.
- 129,   2, 157,  72,  90, 195,   6,  60, 148,  95, 138, 214, // ...HZ..<._..
- 125,  52,  17,  52, 179, 109,  29, 131,  24, 199, 207, 205, // }4.4.m......
- 214,  90,  63,   6, 217,  61, 119, 163,  97, 124,  37, 162, // .Z?..=w.a|%.
-  97, 179, 105, 127,  60,  90, 120, 198, 172, 127, 198, 160, // a.i.<Zx.....
- 127,  20, 198, 104, 170, 166,  42, 110, 178,  99, 124, 129, // ...h..*n.c|.
- 214, 151,  57, 177,  13, 121,  84, 123, 226, 124, 138, 117, // ..9..yT{.|.u
-  14,  26, 180, 187,  49, 117,  90, 199, 192,   5,  47, 109, // ....1uZ.../m
-  57, 159,  27, 176, 181,  35, 187, 111, 135,  92, 159, 242, // 9....#.o....
- 144, 123, 119, 207,   1,  27, 253,  24, 245,  33,  36, 192, // .{w......!$.
- 153, 137,  13,  35, 228, 196, 245, 144,  41,  49,  96, 161, // ...#....)1`.
-  87,  84, 101, 118,  19, 100, 190,  55, 226,  95, 192, 245, // WTev.d.7._..
- 213, 192, 101, 194, 159, 250,  92, 129, 241,  87, 185, 190, // ..e......W..
- 173, 254, 102, 251,  60,  10,  16, 179, 159,  75, 187,  10, // ..f.<....K..
- 208,  14, 185,  93,  18,  76,  66,  47,  10, 158,  64,  16, // ...].LB/..@.
- 152,   2,  20,  38,  21,   9, 110, 248, 238,  11, 213, 120, // ...&..n....x
-   3, 156, 157,  79, 209,  99, 218, 113, 229,  56,  55, 237, // ...O.c.q.87.
- 170, 103, 248, 120, 137,  20, 148, 110,  29,  35, 133,  80, // .g.x...n.#.P
- 234, 145, 132,  95, 184, 111,  89, 189,  13,  49, 184, 144, // ..._.oY..1..
- 160, 230, 255,   6, 196, 168, 236, 154,  83, 139, 193,  48, // ........S..0
- 186, 242,  19,  30,  35, 111,  79, 195,  52,  99, 243, 210, // ....#oO.4c..
-  28, 118, 201, 203,  75, 137, 217,  91, 231, 150,  17, 180, // .v..K..[....
- 195, 157,  18,  85, 105,   8, 140,  13, 107,  14, 110, 160, // ...Ui...k.n.
-  43,  72,  20, 248, 250, 133,  99, 203, 250, 240,  27, 158, // +H....c.....
-  44, 201, 165,   3,  63, 103,  78, 115, 209, 108, 226,   9, // ,...?gNs.l..
-  20,  37, 192, 166, 205, 240,  36, 159, 191, 117, 250, 108, // .%....$..u.l
- 251,  64,   8,  50, 155,   0, 207, 240,  38, 156,  84,  42, // .@.2....&.T*
-  23, 251, 242, 101,  26, 110,  89, 204, 192,  37,  17,   5, // ...e.nY..%..
-  37,  64, 137,  11,  64, 250, 195, 198, 195,  40,  26,  86, // %@..@....(.V
-  21, 251, 234, 203, 146, 163,  99, 247, 100, 204, 169, 147, // ......c.d...
- 221, 157, 165, 114, 245, 136, 215, 115, 174, 188, 215,  31, // ...r...s....
- 173,  28,  44,  44, 142, 181, 240, 170, 138,  10, 133,  83, // ..,,.......S
-  72, 124, 144, 242,  87, 193, 120, 190,  37, 123, 228,  57, // H|..W.x.%{.9
- 117,   4, 158,  28,   1,  33, 211,  35, 173,  70, 149, 126, // u....!.#.F.~
-  35,  12, 177,  66, 162, 207,   7,  18, 213,  94, 184, 251, // #..B.....^..
- 251, 179,  43, 211,  65,  48, 248,  36, 163, 139, 251,  87, // ..+.A0.$...W
- 104, 166, 178, 189, 129,  18,  46,  74,   7, 118,  54, 197, // h......J.v6.
-  38, 131,  33,  19,  26, 241,  81, 219,  80, 184,  28, 135, // &.!...Q.P...
- 146, 209,  38, 149,  55,  28,  61,  22,  33, 242, 134, 242, // ..&.7.=.!...
- 183,  13, 218,  66, 201, 209, 222, 116, 159,  79,  91, 244, // ...B...t.O[.
- 201,  22,  52,  59, 129, 224,   4,  33,  59, 154,   0, 153, // ..4;...!;...
- 155, 202, 164,  18, 156,  51, 134,  79, 186,  47,  92,  65, // .....3.O./.A
-   7,  40, 105,  35,  18,  12,  74, 202, 117,  31, 175,  71, // .(i#..J.u..G
- 123,  25,  33, 109,  19,  78, 204,  58, 150,  84, 124, 224, // {.!m.N.:.T|.
-  51,  84,  53, 188, 175, 185, 157,  11,  83, 138, 215, 107, // 3T5.....S..k
-  12,  99, 217,  30,  66, 187,  63,  77,  14,  79, 162,  53, // .c..B.?M.O.5
-  85, 142,  54, 106, 190, 225, 115, 155, 106, 179,   1, 161, // U.6j..s.j...
- 239, 136, 179,  82, 104, 207, 128, 186, 117,  90, 147, 143, // ...Rh...uZ..
-  48,  69, 218, 131,  35, 150, 160, 160, 151,  73,  97, 216, // 0E..#....Ia.
- 146, 248,   4, 219,  14,  76, 174, 111,  18,  28, 207,  42, // .....L.o...*
- 106,  60, 118, 194, 205,  85, 160, 104, 169,  46,  26,  22, // j<v..U.h....
- 150, 119,   1,  53,  80,  56, 130, 133,  94,  25, 220,  40, // .w.5P8..^..(
-  59,  54,   6,  85, 114, 243,   6, 222,  56, 121, 123, 160, // ;6.Ur...8y{.
- 254,  46,  41,  30,  12,  74, 187,  50,  63, 160, 249,  88, // ..)..J.2?..X
-  61,  38,  40, 186,  51,  78, 146,  16,  20, 195, 204, 205, // =&(.3N......
- 150, 211,  35,  29, 235, 176, 227,  91, 214, 160, 227, 125, // ..#....[...}
- 138,  23, 248, 118,  17, 102, 106, 160, 127,  75, 141, 209, // ...v.fj..K..
- 187, 108, 143, 192,  39, 116,  77,  25,  88,  18,  73, 116, // .l..'tM.X.It
- 163, 192,  23, 247, 129,  36, 159, 194, 133,  74,  86,  57, // .....$...JV9
-  24,  10, 143, 168,  49, 128,  28,  67, 189, 173, 220, 164, // ....1..C....
-  54,  66,  31, 198,  17,  75, 121, 224, 126, 224, 211, 225, // 6B...Ky.~...
- 103, 193,  18, 234,  43, 239, 201,  90, 167, 158,  28, 132, // g...+..Z....
- 120,  84,  70, 204, 229, 143,  46, 122,  11,  51, 252,   5, // xTF....z.3..
-  99, 106,   1, 203,  62, 146, 252, 179, 120,  45, 126,  19, // cj..>...x-~.
- 239, 196, 251, 199,  78, 117, 244, 113, 119,  72, 159, 181, // ....Nu.qwH..
- 225, 195, 129, 221, 126, 233, 120,   5, 110, 148,  82, 197, // ....~.x.n.R.
-  16,  15,  67,  52, 155,  87, 130, 143, 219, 128, 255,   9, // ..C4.W......
- 237, 214,  50,  28, 116, 253,  30, 110,  58,  81, 225, 149, // ..2.t..n:Q..
- 231, 231,  96,  78, 164,  87, 125, 240, 171, 240, 204,  37, // ..`N.W}....%
- 246,  29, 248,  71, 250, 165, 123,  37, 245, 225, 237,  32, // ...G..{%... 
- 195,  51, 175,  46, 102,  33, 219, 131, 183, 227,  31,  83, // .3..f!.....S
-  37, 202, 146,  38,  31, 148,  48, 117, 135, 157, 156, 216, // %..&..0u....
-  78,  76, 102,  83,   6,  77, 199, 241, 161,  81, 130, 174, // NLfS.M...Q..
- 200, 114,  25, 221, 195,  10, 243, 158, 206,  65, 194,  34, // .r.......A."
- 231,  56, 196, 105,  87, 180,  37,  75, 164,   7,  67,  13, // .8.iW.%K..C.
- 237, 206,   1, 131, 222, 243,  97,  14, 105, 171,   7, 179, // ......a.i...
-  23,  56,  37,   9,  86, 153, 175, 107,   6, 214,  62,   3, // .8%.V..k..>.
- 181, 254,  79,  90,  25,  46, 130, 165, 248,  73, 186, 219, // ..OZ.....I..
-  11,  75,  46, 255, 137,  42, 129,  57, 202,  46,  49, 176, // .K...*.9..1.
- 158, 228, 182, 213,  63,  81,  38,  93,  94,  75,   0,  24, // ....?Q&]^K..
-  40, 121, 175, 223, 168, 165,  66, 203,  60, 167,  58,  64, // (y....B.<.:@
- 154,  10,  79,  27, 162, 240,  57, 245,  46,  24,   4,  48, // ..O...9....0
- 169,  20,  31, 161, 132,  57,   0,  45, 202, 181,  49, 196, // .....9.-..1.
-  73, 155, 141, 228,  81,  39, 197, 246, 213, 191, 255, 149, // I...Q'......
- 125, 255, 175,  24,  30, 107, 147, 120, 114,  48, 195, 157, // }....k.xr0..
-  69, 207,  27, 132,  60,  97,  16,  20, 176,  74, 209,  29, // E...<a...J..
-  54,  93,  36, 222, 192, 213, 133, 135,  84,   8,  16, 244, // 6]$.....T...
-  60, 191, 199,  53, 156, 118, 187,  13, 114, 129, 135,  56, // <..5.v..r..8
- 149, 233, 227,   8, 170, 117, 108,  13,  40, 169, 219, 162, // .....ul.(...
-  99, 209,  17,  32, 140,  48,  66, 252,  66,  30, 227, 113, // c.. .0B.B..q
-  63,  48,  63, 234,  32, 155,  72, 245, 216,  35, 247, 151, // ?0?. .H..#..
-  42, 198,  80,  49,  65, 221,  17, 203,  19, 210,  25,  69, // *.P1A......E
-   1, 116, 110,  10,  60, 194, 196,   6,  36, 181, 211, 207, // .tn.<...$...
- 192,  71, 213, 204, 154,  33, 179,  98,  76,  94,  99,  34, // .G...!.bL^c"
-   0,  75,  48, 192, 179,  40, 150, 187,  87, 208,  96, 245, // .K0..(..W.`.
-  92,  13, 179,  43, 211, 102,   5, 109,  96, 249, 131, 156, // ...+.f.m`...
- 225, 234,  74,  80, 195, 129, 243,  28, 167, 150,  15,  92, // ..JP........
- 236,   0,  48,  29,  94, 193, 168, 135, 158, 159,  52, 101, // ..0.^.....4e
-  78, 204,  12,  85,  90,  45,  61, 125, 231, 133, 174, 108, // N..UZ-=}...l
-   8,   4, 245, 100, 222,  76, 208, 193,  73,   7,  96, 252, // ...d.L..I.`.
- 201, 116, 128,  36, 227, 214, 223,  57, 223,  73, 222,  65, // .t.$...9.I.A
- 253, 142, 155, 165, 144, 105, 187, 192, 241, 160,  27, 192, // .....i......
-  18, 250,  30, 210, 118, 124,  44,  34, 153, 232, 206, 157, // ....v|,"....
-   3, 202, 198,  24, 224, 243,  99, 232, 135, 218,  50, 252, // ......c...2.
- 205, 238, 149, 199, 157,  24,  58, 134,  50,   4,  56, 176, // ......:.2.8.
- 211,  80, 152,  23, 198, 103,  15, 176,  25,  99,   1,  80, // .P...g...c.P
- 204, 169,  57,  26, 168, 255, 101,  18, 255, 138, 109,  42, // ..9...e...m*
- 173,   0, 215,  99,  52, 216,  33, 156, 186, 197,   4,   0, // ...c4.!.....
- 122,  36, 244,  32,  70, 124,   8, 131,  27, 222, 231,   7, // z$. F|......
-  98, 216,  83, 210,  67,  16,  75, 115,   4, 177,  59, 200, // b.S.C.Ks..;.
- 125,  20, 201, 141, 199,  26, 244, 194,  19,  95,  64,  38, // }........_@&
- 127,  70,  53, 252,  59,   0, 254, 119, 249,  59,  42,  68, // .F5.;..w.;*D
- 241,  43, 253, 166, 226,  31, 240, 203,  30, 145,  80, 138, // .+........P.
- 242, 198,  66, 229, 144, 208, 231, 136, 132, 138,  40, 183, // ..B.......(.
-  56, 148, 174, 180, 182, 197,  92,  88, 129, 233, 199, 125, // 8......X...}
-  13,  28, 245,   5, 141,  99,  28,  77,  95, 192, 120,  13, // .....c.M_.x.
-  37, 231,  32,  62, 244, 139,  86, 135,  15,  48,  64, 101, // %. >..V..0@e
- 248, 217,  88, 233,  86,  47,  40, 212, 102, 227, 147, 244, // ..X.V/(.f...
-  66,  72, 197,   5,  28, 223, 192, 192,  46, 140,  92, 149, // BH..........
- 148, 173,  92,   0, 229,  51, 152, 182, 135,  94, 191, 254, // .....3...^..
-  59, 175, 192, 106,  73,  30, 224,  57, 212, 193,  83,  36, // ;..jI..9..S$
- 109,  58, 166,  23, 181,  65, 225,  10,   2, 163,  88, 186, // m:...A....X.
- 112,  31, 181, 232,  54,  45, 237, 163, 126,   1,  22,  81, // p...6-..~..Q
- 161, 187,  99, 149,  62, 104,  71, 199,  71,  75,   1, 112, // ..c.>hG.GK.p
-  94, 106,  30, 238, 129, 170,  56,   8, 178,  15,  40, 151, // ^j....8...(.
-  39, 119, 142,  71, 101, 200, 247,  83, 156,  81, 234,  52, // 'w.Ge..S.Q.4
-  40, 212, 226, 107,  99, 206,  13, 113, 113,  27,  95,   9, // (..kc..qq._.
-  59, 202, 179, 210, 113, 147,  49,  30, 214,  30, 152, 141, // ;...q.1.....
- 103, 242, 127, 120,  52, 208,  22,  57, 109, 253, 189,  70, // g..x4..9m..F
- 214,  41,  91, 192, 124,  92, 173,  52, 104, 230,  22, 154, // .)[.|..4h...
-  82, 245, 149, 252, 185,  56, 151,  76, 145,  95,  58,  96, // R....8.L._:`
- 140,  63, 231, 188,  63, 110, 145, 106, 172, 103,  53, 246, // .?..?n.j.g5.
- 196, 158, 220, 105,  41,  23, 131, 255, 133,   1,  86, 202, // ...i).....V.
-  21, 191, 147, 223, 152,  83,  85, 244, 106, 137,  87,  43, // .....SU.j.W+
- 122, 249,  53, 199, 135, 255, 222, 104, 252,  29, 173,  98, // z.5....h...b
- 106, 177, 101,   6,  40, 142, 238,  94, 235,  31,  14,   5, // j.e.(..^....
-  18, 232,  11, 105, 115,   0,  28, 176, 182,  85, 196, 103, // ...is....U.g
- 104, 168, 155, 180,  50, 208, 175, 141, 198, 175, 104, 223, // h...2.....h.
- 124, 214, 252, 156,  75, 247,  53,  29, 245, 164, 157, 217, // |...K.5.....
- 243,  62,  42, 141, 223,  64,  86,  95, 115, 244, 152, 192, // .>*..@V_s...
- 127, 109,  18, 152, 243, 168,  63, 241, 206, 108,  81, 209, // .m....?..lQ.
-  11, 226,  37, 228, 164,  57, 159, 230, 233, 205, 221,  42, // ..%..9.....*
-  82, 243,  29, 132, 218, 113,   1,  70,  32, 236, 111, 242, // R....q.F .o.
-  53,  78, 132, 165, 185,  50, 151, 127,  52,  26, 255,  40, // 5N...2..4..(
- 187,  39,  48, 137, 126, 206, 232,  57,  71,  19, 207, 146, // .'0.~..9G...
- 203,  72, 161, 139, 103,  88, 127,  54, 198,  99, 163, 241, // .H..gX.6.c..
-  14,  38, 250,  59, 172, 129, 191, 175,  84, 150, 255,  16, // .&.;....T...
- 135, 139,   0, 187, 126, 157, 130, 183,  11,   2, 238, 190, // ....~.......
- 123, 172,  16,  86, 227, 157,  53,  30, 120, 183,  36,  90, // {..V..5.x.$Z
- 227,  72,   5, 169,  54, 232, 240,  56, 186,  90,  53,  26, // .H..6..8.Z5.
- 227,  32,  30, 171, 168, 218,  19, 218, 176, 133, 233,  71, // . .........G
- 164, 143, 101,  41,  35,  18, 221,  78, 199, 235,  99, 115, // ..e)#..N..cs
- 176,   9, 246,   2,  67,  34, 239, 185,  42, 243,  24, 117, // ....C"..*..u
- 231, 143,  19,  41, 212,  36,  58, 199, 160,  31,  83, 200, // ...).$:...S.
- 210,   6, 241, 172, 221,  78,  82, 151,  91, 220, 151, 239, // .....NR.[...
-   6, 112, 140, 160, 236,  10, 201,  92, 234, 252,  48,   2, // .p........0.
- 131, 180, 210, 136, 165, 154, 174,  42, 172, 215, 106, 202, // .......*..j.
- 238,  39,  75,  77, 180, 119,  20, 197, 250, 216,  85, 154, // .'KM.w....U.
-  43, 112, 255,  51,  47, 132,  42, 178,  66,   5,  67, 227, // +p.3/.*.B.C.
- 157,  32, 101,  89, 127, 181, 237, 137,  98, 111, 192,  31, // . eY....bo..
- 100,  79, 245,  13, 209, 152, 109, 116, 152, 228,  92, 171, // dO....mt....
- 150,  71, 113,  72, 115,  30,  35, 212,  54,  40,   4, 156, // .GqHs.#.6(..
- 183, 217,  24, 181, 167, 239,  51, 228, 188, 128, 208, 121, // ......3....y
-  68,   2, 207, 219, 208, 128, 106, 181, 207, 101, 216,  75, // D.....j..e.K
- 214, 210, 202,  52,  46, 105,  76,  11, 241, 190, 152, 143, // ...4.iL.....
-  70, 211, 216, 128,  17, 129, 103,  33,  94, 151,  47, 183, // F.....g!^./.
-  16, 198,  77,  95, 125, 174, 140,  79, 119, 187, 222, 178, // ..M_}..Ow...
- 236, 123, 212,  65,  28, 140,   5,  69, 103,  87,  56, 137, // .{.A...EgW8.
-  49, 165, 173, 240,  95,  57,  14,  70, 113, 205, 232,  74, // 1..._9.Fq..J
- 223, 163,   4, 217, 197,  91,  87, 118, 128, 249,  95, 190, // .....[Wv.._.
-   4, 166, 102,  91, 254,  80,  26, 196, 215, 224, 134, 224, // ..f[.P......
-  15, 184,  24, 252, 254,  66, 191, 183,  48, 131, 246, 223, // .....B..0...
- 192,  93, 162, 223,  82,  71, 139, 173, 142, 168,  92, 162, // .]..RG......
- 126, 198, 182,  82, 233, 165,  68, 111,   5,  12,  58, 190, // ~..R..Do..:.
- 250, 230, 154, 204, 101, 144, 207, 189, 246,  34,   0,   4, // ....e...."..
- 221, 120, 237, 223, 192, 231, 114,  49, 246, 173, 139,  75, // .x....r1...K
- 131, 124, 171, 220,  73, 178, 134, 182, 251, 239, 127,  29, // .|..I.......
-  52, 215, 240, 255,  19, 143,  13, 236, 118, 182, 140, 194, // 4.......v...
- 220,   5, 155, 173, 188, 244, 222,  20, 173,  29, 223, 193, // ............
- 128,  14, 126, 229, 225, 135, 220, 237, 120, 131, 110, 211, // ..~.....x.n.
- 249, 190,  57, 112, 236, 246, 162,  45,  51,  52, 106, 117, // ..9p...-34ju
-  61,  80,  81,  71, 254,  49,  99, 158, 246, 106,  96, 130, // =PQG.1c..j`.
-  24, 135, 165, 163,   0, 234, 150, 151,  27, 117,  33,  31, // .........u!.
-  86, 105, 228, 171, 183,  46,  72, 140, 186, 150, 191, 184, // Vi....H.....
- 234, 194,  43,  17, 233, 173, 185, 230,  99, 110,  37,  57, // ..+.....cn%9
-  77,  23, 221, 247,  91, 144, 162,  91, 218,  37, 195, 122, // M...[..[.%.z
- 131,  82, 218, 215, 101,  24,  12,  99, 187, 226, 109, 169, // .R..e..c..m.
- 214, 110, 174,  11, 166,  37, 126, 159,   0,  47, 234,  78, // .n...%~../.N
-  74, 103,  50,  77, 163, 162, 223, 123, 143, 112,  31, 147, // Jg2M...{.p..
- 114,   6, 188,  53, 241,  68,  35, 104, 217, 241, 156,  94, // r..5.D#h...^
-  75, 184,  59, 171, 248,  69, 184,   5, 207, 151, 102, 212, // K.;..E....f.
-  93, 249, 198, 140, 186,   3,  54, 107, 167, 160, 101, 213, // ].....6k..e.
- 167, 132, 110,  72, 129, 134,   5, 191, 216,  58, 104, 165, // ..nH.....:h.
-  30, 159, 232, 189, 227,  58, 226,  58,  79, 163, 159, 213, // .....:.:O...
-  61,  74,   4, 126, 105,  67,  39, 131,  40, 215,  41,  50, // =J.~iC'.(.)2
-  44, 116, 122, 180, 202, 243,  36, 246, 140, 196, 169, 118, // ,tz...$....v
-  14, 230, 173, 202, 241,  96,  47,  70, 176,   3,  50, 155, // .....`/F..2.
- 139, 221,  70,  92, 187, 102, 229, 211, 114, 124,  76, 208, // ..F..f..r|L.
- 211, 251, 214, 243,  32,  43,  21, 225,  70,  94,  43, 166, // .... +..F^+.
- 207,  48,  56, 116,  40, 165,  90, 108,  74, 204,  97,  55, // .08t(.ZlJ.a7
- 232,  97, 251,  50,  50,  90,  60, 229, 225, 236,  74, 198, // .a.22Z<...J.
-  87, 121, 164, 218,  11,  12, 221, 240, 168,  22, 240, 172, // Wy..........
- 248,  20, 106, 138, 187, 137,  11,  82, 142, 224,  84,  30, // ..j....R..T.
-  28, 208, 181, 178, 122, 184,  94, 135,  54, 247, 219,  32, // ....z.^.6.. 
-  83, 209, 244, 201,  65, 232, 217,  59,  30, 118, 191, 133, // S...A..;.v..
-  78,  80, 211, 166, 166,  57,  36, 107, 120,   2, 215,  63, // NP...9$kx..?
-  15,  49,   4,  28,  75, 149, 236, 185,  76,  58, 146,  10, // .1..K...L:..
- 185, 197, 125, 130,  42,   3,  20, 116, 207, 113, 143,   8, // ..}.*..t.q..
- 167, 126,  55, 204, 175, 218, 176,  32, 127,  68, 242, 163, // .~7.... .D..
- 235, 161,  21,  93,  71,  83, 191, 222, 221, 144, 133, 128, // ...]GS......
- 183, 169, 192, 169, 138,   6, 142,  30,  11, 132,  17, 205, // ............
-   7,  71,  48, 159,  15, 147, 171,   1,  61,  97, 145, 223, // .G0.....=a..
- 203, 200, 224, 195, 231,  73, 122, 223, 104, 232, 196,  48, // .....Iz.h..0
- 105,  58,  20, 123, 115, 174, 246, 229, 185, 165,  43,  62, // i:.{s.....+>
-  24,  16,  59, 227, 235,  88, 185,  87,  92,  66, 132,  38, // ..;..X.W.B.&
- 203,  55, 139, 133, 154, 132, 208,   2, 143,  57,   5,  51, // .7.......9.3
- 146,  16, 164, 230,  99, 101,  46, 237, 212,  64, 225, 158, // ....ce...@..
- 250, 219, 213, 150,  41,  29, 130, 124, 201, 202,  15, 178, // ....)..|....
-   0,  23, 124,  12,   5, 209,  92, 220, 184,   5, 184,  72, // ..|........H
-  53,  92,   2, 181, 250, 160, 206, 183,  86, 109,  59, 113, // 5.......Vm;q
-  23, 180, 141, 125, 245,  74, 241,  65, 173, 123, 144, 114, // ...}.J.A.{.r
-  32,  43, 168, 130, 192, 187, 179, 225,  50,  62, 255,  39, //  +......2>.'
-  30, 246, 134, 191, 253,  61,  38,  69, 135, 194, 222, 216, // .....=&E....
- 115,  56,  70, 217, 131, 110,  77, 192, 146,  53,  55, 143, // s8F..nM..57.
- 211,  78, 226,  51, 250,  90,  66, 181, 208, 228, 110, 132, // .N.3.ZB...n.
- 225, 138, 157, 253, 129,  92, 190, 114,  75,  45,  76, 208, // .......rK-L.
- 218,  42, 140, 226, 108,  39, 237,   6, 208,   6, 217,  70, // .*..l'.....F
- 104,   5,  83, 233, 141, 113,  96, 226, 197, 140, 134, 141, // h.S..q`.....
- 177,  99, 121, 135, 160,  96, 205, 202, 158, 196,  18,   4, // .cy..`......
-  29, 127,  75,  17,  78,  23, 143, 199, 139, 221, 243, 122, // ..K.N......z
- 126, 201,  28, 229, 182, 160, 221,  74,  21, 205, 193, 188, // ~......J....
- 114,  61,  34,  40,  65, 208,  87, 151, 184,  45, 118,  73, // r="(A.W..-vI
- 241, 209, 219, 245, 122, 231, 176,  53,  30, 227,  37,  50, // ....z..5..%2
- 150, 238, 235,   3, 221,  65, 247,   2,  37, 209,  72, 219, // .....A..%.H.
- 109,  49, 142, 194, 241,  53,  72, 206,  19, 228, 236,  59, // m1...5H....;
- 109, 134,  99,  76, 140, 132, 137, 113, 187, 146, 184, 152, // m.cL...q....
-  80, 147, 202, 174, 162,  62, 238, 107, 215,  25, 192,   3, // P....>.k....
- 152,  47,  70, 123, 227, 186,  20, 109,  47,  15,  81, 121, // ./F{...m/.Qy
- 121, 240, 208, 196,  53, 104, 232, 110, 225,  75, 239,  89, // y...5h.n.K.Y
- 148,  49, 177, 239, 218,   8, 193, 167,  99, 197, 184, 131, // .1......c...
-   8, 115, 192, 181,  27,  86, 117,  72, 153, 197, 152,  39, // .s...VuH...'
- 212, 245, 182, 135, 216, 226, 219,  71, 105, 242, 120,  69, // .......Gi.xE
- 128, 122, 182, 181, 195,   5,  75, 177,  49, 178, 213, 194, // .z....K.1...
- 227,  59, 154, 106,  86, 196, 178, 244, 186,  87,  94, 246, // .;.jV....W^.
- 244,  14,  41,  26,  90, 160, 216, 170,  17,  95, 187,  41, // ..).Z...._.)
-  41,  15, 220, 129, 255, 175, 129,  59, 252, 247, 223, 174, // )......;....
- 190, 247, 188, 129, 251, 183, 246, 247, 222, 224, 201,   1, // ............
-  45,  10, 172, 198,  19,  92,   8, 192, 162, 211,  42,  31, // -.........*.
-  47,  13, 152,  81,   3, 137, 175, 198, 174, 105, 192, 146, // /..Q.....i..
- 193,  65, 184, 160,  18, 132, 227,  88,  91, 128, 113,  54, // .A.....X[.q6
-  93,  83, 226,  10,  50, 156,  40, 252, 208, 196, 231, 143, // ]S..2.(.....
- 111, 172, 204, 187,  43,  12,  23,  93, 201, 125,  37, 250, // o...+..].}%.
- 242,  64, 215, 152,  98,  18,  73,  13, 104,  65, 131, 205, // .@..b.I.hA..
- 216,  92,   9, 197,  49,  97, 149, 128, 220, 156, 184, 193, // ....1a......
-  34, 104,  44, 241, 140,  17,  76, 233, 206,  26,  79, 194, // "h,...L...O.
- 222, 240, 211, 231,  91, 198, 230, 244,  80,  78, 187, 244, // ....[...PN..
- 100, 142,  73,  76,  23,  38, 153,  62,  10, 206, 185,  37, // d.IL.&.>...%
-  83, 207,  95,  15, 155, 223,  15, 174, 172, 173,  39,  38, // S._.......'&
- 146, 122,  49,  75, 161,  46,  61, 128, 245,  91,  77,  60, // .z1K..=..[M<
-  12,  57,   3, 116,  98,  46, 255, 239, 196, 242, 147, 211, // .9.tb.......
- 116,  48, 100,  95, 206, 249, 222, 193, 224,  61, 158,  25, // t0d_.....=..
- 192, 234,  72, 129, 250, 162, 209, 168, 227, 253, 157, 206, // ..H.........
- 139,  82, 189,   1, 218,   5, 115,   0,  46,  70,  21, 205, // .R....s..F..
-   7, 149, 240,  94, 221, 112, 185,  23, 151,  11,  79, 128, // ...^.p....O.
- 172, 204, 192,  54, 192,  10,  74,  99, 118, 202, 198, 238, // ...6..Jcv...
- 110, 125, 131, 113, 176,  91, 205,  33,  40, 123, 206,  30, // n}.q.[.!({..
-  64, 211, 167,  26,  42, 131, 235, 227,  10, 117,  90, 232, // @...*....uZ.
- 141, 121, 141,  55,   9, 234,  28, 225,  13,  55, 120, 123, // .y.7.....7x{
- 167, 100, 104, 155,  23, 178,  44, 204, 119,  83, 134, 192, // .dh...,.wS..
- 160,  87,  27, 208, 172, 180,  25, 179,  37,  17, 122,  35, // .W......%.z#
-  87,  96, 184, 223, 232, 116,  96,  84, 178,  15, 112,  95, // W`...t`T..p_
- 130, 148,  43, 222,  73, 101,  29, 253, 202,  45, 118,  31, // ..+.Ie...-v.
- 113,  63,  13, 199, 201, 104, 217, 127,  68,  50, 248, 219, // q?...h..D2..
-  25, 188, 213, 165,  12, 112, 165, 207,  51, 240, 205,  42, // .....p..3..*
- 254, 173, 124, 135,   1, 239,  96, 202,  61, 249,  24, 244, // ..|...`.=...
- 252, 111,  31, 160, 192, 143,  56,  72, 107,  34, 229, 244, // .o....8Hk"..
- 173,   7, 187, 218, 224,  65,  25, 168,  67, 223, 167,  48, // .....A..C..0
-  17, 213, 125, 223, 168, 200, 254,  39, 223, 168, 184, 118, // ..}....'...v
- 205,  45,  94, 220, 124, 228, 155, 189,   9,  38, 204,  85, // .-^.|....&.U
-  62, 111, 227, 102, 184, 205, 128, 254, 220, 156, 151, 178, // >o.f........
-  80,  16, 119, 171, 204, 143, 100,   6, 138, 128, 246, 249, // P.w...d.....
-  30, 240, 251,  17, 230, 182, 191, 154, 250,  54, 238,   0, // .........6..
-  88, 199, 139, 197,   1, 222,  90,  70,  27,  14, 148,  26, // X.....ZF....
- 116, 117,  97, 105,  37, 117, 159, 104, 150, 132, 201,  42, // tuai%u.h...*
- 243,  77,  77,  97, 226, 150, 177,  64,  86, 241, 227,  65, // .MMa...@V..A
- 153, 115, 248, 200, 129,   5,   4, 215,  35,  94,  45,  82, // .s......#^-R
- 222, 177,  15, 218, 193,  24,  13, 100,  25,  15, 134, 241, // .......d....
- 149,  63, 188,  42, 197, 255, 149,  61, 237, 187,  66, 123, // .?.*...=..B{
-  81, 141, 134, 171,  43, 140, 219, 238, 243, 185, 147,  70, // Q...+......F
-  35,  41, 109,   5,  93, 184, 234, 218, 110,  93, 139,   7, // #)m.]...n]..
- 190,  16, 129,  55, 183, 209, 184, 233, 227, 167, 108, 212, // ...7......l.
-  39, 201, 159, 144, 195,  53,  28,  15,  20,  41,   0, 164, // '....5...)..
- 197, 159, 119, 193, 171,  67, 133, 211, 241,  31, 151, 205, // ..w..C......
- 244,  15,  47, 186,  21,  51,  89, 125,   0, 168, 168,  43, // ../..3Y}...+
- 129, 206,  13,   1, 222, 183, 236, 144, 244, 249, 147,  57, // ...........9
- 145,  76, 250, 124, 193,  81,  99,  93, 253, 208, 108,  22, // .L.|.Qc]..l.
- 213,  34,  93,  45,   6,  65,  76, 232, 246,  88, 219, 214, // ."]-.AL..X..
-   4, 208,  26, 178, 117,  40, 234,  46, 222,  68, 193, 123, // ....u(...D.{
- 182, 234,  43,  70, 153,  48, 248,  17, 181, 199, 110,  57, // ..+F.0....n9
-  96, 131,  70,   2, 126, 117,   8,  61, 167,  77,  36,  99, // `.F.~u.=.M$c
-  58,   9, 169, 126, 144,  48,  30, 128,   9, 188, 109, 118, // :..~.0....mv
- 161, 139, 121, 189,  50, 254, 199, 135,  23,  29, 107, 214, // ..y.2.....k.
- 186,  94,  95, 125,   0,   0, 113, 140,  34, 111,   3, 214, // .^_}..q."o..
-  52, 176, 229, 253,   3,  34,  99, 179, 161,  73, 127, 192, // 4...."c..I..
- 190, 105, 128,  31,  81,  61, 219, 110,  95, 234, 110, 173, // .i..Q=.n_.n.
- 156, 196, 198, 245, 193, 102, 232, 124, 197, 253, 109, 111, // .....f.|..mo
-  35,  71, 191,   9,   3,  21, 241,   0, 172, 219, 135, 208, // #G..........
- 239, 136,  75, 252, 230, 137,  31, 183, 129, 225,  13, 191, // ..K.........
- 210, 167, 162, 204, 203, 157, 229,  98,  31, 204,  46, 139, // .......b....
-  79, 104, 128, 106, 163, 157, 181,  99, 220, 249, 128,   4, // Oh.j...c....
- 197,  19, 208, 125,  56, 236,  53,  98, 192,  40,  40, 133, // ...}8.5b.((.
-  75,  12, 247, 229, 158,  79,  87, 109, 243, 118, 136,  49, // K....OWm.v.1
- 214,  16, 102,  82, 186,  21,  20,  83, 224,  18,  56,  25, // ..fR...S..8.
- 109, 237, 114, 193, 146,  10, 150, 216,  99,  59, 166, 112, // m.r.....c;.p
-  55, 142, 137, 103, 115,  12, 217, 244, 224,  60,  54, 141, // 7..gs....<6.
- 163, 133, 172, 192, 209,  71, 107, 125, 222, 152,  47, 160, // .....Gk}../.
- 224, 248, 148, 176, 253, 208,  91,  46, 119,  26, 159, 151, // ......[.w...
-   2,  26, 104, 156,  83, 111, 165, 242, 175, 198, 235,  50, // ..h.So.....2
- 248, 206,  10, 118, 203, 233, 228,  69,  76, 171, 104, 251, // ...v...EL.h.
- 178,  29, 210, 148, 192,  41, 172, 227, 219, 220,  37, 255, // .....)....%.
- 213, 102, 239, 113, 198, 138,  81, 222, 252, 137,  81, 180, // .f.q..Q...Q.
-   0,  96, 151, 113, 229, 214,  85,  68,  72,  76,  37, 157, // .`.q..UDHL%.
- 104, 188,  36, 108,  33,   5,  90,  93,  81, 176,   4, 182, // h.$l!.Z]Q...
-  87, 136,  66, 179, 170, 149,   6, 255, 133, 142, 197, 224, // W.B.........
- 192,  20, 135, 203, 182, 100, 207,   8,  21, 158, 179,  94, // .....d.....^
- 246, 137, 202,  17,  82,  57, 130, 177,  62, 131, 184,  20, // ....R9..>...
- 244, 228, 251,  28,  40, 124, 113,  41,  55,  34, 242,  71, // ....(|q)7".G
-  68, 126, 240,  73, 253,  28, 175,  62,  18, 156,  81,  59, // D~.I...>..Q;
-  45,  87,  75, 169,  90, 170, 105, 132,  55, 134, 213, 134, // -WK.Z.i.7...
-  96,  46, 193, 250, 153, 252, 176, 143, 250,  56,  22, 234, // `........8..
-  60,  83, 155,   8, 124, 103,  24,  32, 171, 208, 125,  38, // <S..|g. ..}&
- 213, 143, 128,  14, 118,  50, 228,  81, 169, 191, 215, 118, // ....v2.Q...v
- 238,  48, 243,  21, 125, 175,  12, 172, 117, 221, 118, 159, // .0..}...u.v.
- 185,  12, 163, 163,  68,  51,  45, 226, 190, 225,  47,  18, // ....D3-.../.
- 241, 226,  34,  61, 125, 150, 135,  84,   4, 105, 157,  30, // .."=}..T.i..
-   8, 205, 116,  45,  79, 133, 250, 141, 206,  10,  89,  13, // ..t-O.....Y.
-   0,  56,  16, 172,   5,  74,  48, 253, 246,  39, 152,  33, // .8...J0..'.!
-  39, 228, 227, 253,  35, 152, 179, 209, 133, 197, 172, 105, // '...#......i
-  94, 165,  46, 223, 105,  53,  18, 107,  71,  78,  43,  48, // ^...i5.kGN+0
- 253, 161, 180, 247, 171, 188, 149,  76,  91, 244,  57, 189, // .......L[.9.
- 154, 226,  15, 133,  65, 207, 191, 104, 179,  63,  54,  72, // ....A..h.?6H
- 229, 169, 156,  54, 244,  75,   3,  32, 213, 158,  14,  78, // ...6.K. ...N
- 161,  24, 237, 189,  21,  72,  75, 143,  85, 133,  30,  85, // .....HK.U..U
- 234,  36, 149, 183, 169,  60, 236, 149, 250, 250, 103,  65, // .$...<....gA
-  32,  18,  79, 236, 155, 145,  93, 210, 217, 202, 160,  59, //  .O...]....;
- 111,  79, 208, 133,  49,  11,  23, 188, 242, 206, 106,  14, // oO..1.....j.
- 230, 243, 199, 210, 169, 149,  81,  26, 196,  19, 169,  62, // ......Q....>
- 137,  74, 238, 124, 247, 116,  27,  58,  50, 149,  58, 151, // .J.|.t.:2.:.
- 187, 103, 111, 114, 102, 125,  43, 108, 170, 205, 130, 112, // .gorf}+l...p
- 199, 139, 125,  94,  82, 120, 244, 110, 188, 194, 188, 173, // ..}^Rx.n....
- 112,  39,  81, 107,  38, 116, 171,  43,  35, 125, 222, 254, // p'Qk&t.+#}..
- 206, 222,  86,  55,   5, 223,  42, 146, 219, 187,  18, 151, // ..V7..*.....
- 144,  70, 184,  67, 230, 106,  43,  43,  79,  21, 133,  17, // .F.C.j++O...
-  65,   1, 234, 242,  59,  91, 140, 151,  90, 182,   0, 148, // A...;[..Z...
- 120,  38, 180,  10,  85, 182,  26, 225, 231,  10,  71, 213, // x&..U.....G.
-  51,  72, 102, 113, 251, 167, 139, 159, 100, 211, 128, 177, // 3Hfq....d...
-  74,  70,  99,  65, 236, 136,  10, 125, 145, 167,  36,   5, // JFcA...}..$.
- 120,  40, 182,  58,  16,  53, 124,  63, 221,  37,  73, 173, // x(.:.5|?.%I.
- 232, 119, 171,  73, 158, 240,  23, 104, 254, 176,  77,  19, // .w.I...h..M.
- 207,  79, 108,  53, 251, 251, 229, 251, 119, 127, 101, 160, // .Ol5....w.e.
- 165,  82, 215, 149, 179, 128, 164,  30, 183, 166, 184, 219, // .R..........
-  73,  49,  95, 220, 149, 126, 228, 115, 142, 165, 113, 132, // I1_..~.s..q.
-  57, 234, 141, 223, 119, 180, 195, 128,  77,  80,  57, 115, // 9...w...MP9s
- 179, 165, 126,  67, 198, 123, 168,  25, 235, 102,  35, 232, // ..~C.{...f#.
- 128,  13,  27,  39, 134, 121, 110, 248, 245, 135,  23, 184, // ...'.yn.....
-  17,  87, 209,   5, 103, 247, 227,  72, 213,  38,  42,   7, // .W..g..H.&*.
- 216, 212, 132,  62, 148,  88,  89,  88, 155,  77,  48,  81, // ...>.XYX.M0Q
- 240,  97, 236,  26, 163, 168, 148, 102, 158, 130,  11, 113, // .a.....f...q
-  75,  26,  24, 204,   3,  12, 183, 223, 237, 152,  61, 184, // K.........=.
- 189, 228, 170, 207,  91, 177,  49, 245, 209, 171, 138, 161, // ....[.1.....
- 185,  28, 205, 198,  91,  87, 235,  30, 179, 152, 118,  81, // ....[W....vQ
-  99,  31, 246, 192, 212,  62,  60,  49,  69, 120, 168, 200, // c....><1Ex..
- 180,  56,  54, 250,  31, 160, 249, 177,  20,  15,  53, 189, // .86.......5.
- 226, 194, 160, 213, 206,  90, 234,   5,  34, 124, 209, 193, // .....Z.."|..
-  19,  60,  95, 245,  89, 185,  50,  25,  89,   1, 214,  59, // .<_.Y.2.Y..;
- 125,  67, 112,  98, 229,  55,  86,  79,  82, 140, 169, 132, // }Cpb.7VOR...
- 140,  59,  48,   0, 221, 174, 129,  76,  71, 185, 232, 104, // .;0....LG..h
- 252, 122, 221,  49, 226,  22, 122,  70, 222, 110, 202, 138, // .z.1..zF.n..
- 182, 251, 212,  98, 188, 162, 230,  42, 245,   0, 232,  19, // ...b...*....
-  91, 205, 158, 220, 130,  98, 171, 188,  43, 112,   3,  27, // [....b..+p..
- 127, 126,  84, 151, 149, 173,  76, 163,  97, 204,  40, 135, // .~T...L.a.(.
-  39, 253,  45,  58, 103, 219, 116, 142, 129, 206, 151, 109, // '.-:g.t....m
-  58, 122,  91,  85, 152, 165, 181, 154, 116, 220, 231, 191, // :z[U....t...
- 160, 227, 144, 163,  43,  58, 177, 210, 153, 216, 134, 215, // ....+:......
-   0, 140, 188, 114, 248,  39,  33, 254,  76,   7, 118, 171, // ...r.'!.L.v.
-  96, 189, 219, 226, 192, 186, 219,  51, 220,  85, 224, 100, // `......3.U.d
-   7,  37, 127, 192, 250, 143,  74, 251, 231, 199, 165,  29, // .%....J.....
- 198, 181, 236, 254, 199,  34, 186, 165,  23,  12, 115, 131, // ....."....s.
-   5, 186, 109, 155,  21, 202, 193, 114, 165, 238, 155,  25, // ..m....r....
- 171,  18, 150, 189, 161, 237, 231, 247,  37, 188, 140, 119, // ........%..w
- 149,  30, 213, 188, 116, 121,  77, 134, 145,  79,  45, 179, // ....tyM..O-.
-  87, 137, 115,  87, 246,  91,  74, 226, 241, 200, 105,  90, // W.sW.[J...iZ
-  19,  54,  45, 105,  13,  66,  99,   5, 156, 203,  45,  50, // .6-i.Bc...-2
- 253,  73, 116, 109, 201,  59, 114, 203,  51, 180, 152, 180, // .Itm.;r.3...
-  45,  99, 196, 217, 218, 121,  40, 232,  86, 180, 152, 245, // -c...y(.V...
- 222, 105, 179, 194,  50, 245, 251, 199, 184, 167, 103, 241, // .i..2.....g.
- 225, 154, 113, 123, 198, 236, 193, 147, 109,  52, 214,  86, // ..q{....m4.V
-   7, 147, 114,   7, 166, 213, 169,  85, 126, 235, 181,  49, // ..r....U~..1
- 188,  54,  12, 223,  79,  66, 125,  17,  10, 143, 141, 149, // .6..OB}.....
-  60, 199, 223, 245,  23,  31, 233,  99, 181,  12,  46,  69, // <......c...E
-  15,  48,   3, 207, 129, 224,  58, 189, 169, 156, 171, 250, // .0....:.....
-  59, 217, 214,  95, 192, 174, 251, 130,  70, 212,  23, 169, // ;.._....F...
- 216, 189,  43, 215, 249, 213, 125, 192,  45,  58, 140, 236, // ..+...}.-:..
-  27, 243, 131,  78, 171, 228, 188, 196,   1, 227,  67, 238, // ...N......C.
-  48,  18, 241, 149,  84,  97,  97,  12,  48, 193,  69, 100, // 0...Taa.0.Ed
- 206,  95, 223, 176, 143,  17, 209, 201,  39, 218, 188, 226, // ._......'...
- 239,  40,  60, 208,  15, 252, 255,   4, 102, 124, 164, 125, // .(<.....f|.}
-  21, 246, 232, 105, 117, 248,  92, 233, 146, 199, 212, 151, // ...iu.......
- 238,  52, 133, 200,   0,  27, 116, 252,  58,  39,  28, 199, // .4....t.:'..
- 167, 200, 249,   6,  79,  78, 150, 187,  40, 111,   0, 235, // ....ON..(o..
- 155, 166,  46, 126,  59, 144,  79,  90, 153,  43, 180, 170, // ...~;.OZ.+..
- 124, 102, 126, 131,  95, 225,   3,  19, 103, 207, 234, 244, // |f~._...g...
-  78, 170, 174,  72, 116,  99,  99, 174, 106, 192,  20,  93, // N..Htcc.j..]
- 246, 109,  52,  14, 201,  52, 196, 116, 233, 190, 173, 171, // .m4..4.t....
- 115, 232,   2,  99,  78,   7,  62,  66, 131, 164,  39, 171, // s..cN.>B..'.
- 246, 164,  34, 144, 156,  85,  49,  84, 240, 148,  97, 161, // .."..U1T..a.
-  19, 129, 145, 134,   9, 224, 158, 142, 188,  21, 103, 205, // ..........g.
-   8,  14,  12,  36, 129, 217, 226, 226,  81,  95, 109, 142, // ...$....Q_m.
-  88, 170, 254, 163, 108, 195,  49, 217, 200,  49, 222,  58, // X...l.1..1.:
-  57, 215, 193, 189, 144,  87,  37,  18,  48,  21, 129, 234, // 9....W%.0...
- 165, 147, 103, 234,  39, 123,  13, 162, 220, 182, 235, 242, // ..g.'{......
-  57,  93, 245, 115, 105, 139, 132,  78, 185,  62, 118,  82, // 9].si..N.>vR
-  73, 193,  40,  80, 178,  82,  23, 225,  24,  68,  35, 200, // I.(P.R...D#.
- 174, 121, 228, 173,  60,  26, 199, 243,  92, 213, 129, 133, // .y..<.......
- 167,  66,  28, 245,  19,  99, 242, 221, 198,  67, 126, 254, // .B...c...C~.
- 181, 173,  63, 194,  77,  87,  96, 157, 111,  89, 238, 236, // ..?.MW`.oY..
- 213, 202, 161, 202, 170,  86, 216,  67, 249, 131, 175,  15, // .....V.C....
-  91,  31, 212,  22,  28,  13, 211, 113,   5,  65, 223, 151, // [......q.A..
- 125, 164, 142, 250, 117, 163,  63,  60, 187,  83, 129,  53, // }...u.?<.S.5
- 190,  62, 186,  72,   2, 134, 144, 131, 141,  68,  31, 161, // .>.H.....D..
- 125, 164, 191,  46, 233, 231, 223,  93,   7, 234,  56, 130, // }......]..8.
- 196,  29, 208, 179, 239,  75,  76, 230, 219,  96,  28,  95, // .....KL..`._
- 139, 204,  61, 103, 187, 128, 197, 252, 121,  37, 106,  91, // ..=g....y%j[
- 186, 234,  41, 227, 226, 146,  40,  86,  75,  36, 222, 159, // ..)...(VK$..
- 235,  39,  80,  59, 203, 241, 220,  23,  42, 235, 143, 250, // .'P;....*...
- 224,  53, 158, 210, 138, 193, 195, 231, 175,  28,  65,  61, // .5........A=
-  80, 111,  17, 253, 104, 190,   3, 230,  38, 171, 223, 192, // Po..h...&...
- 156,  22,  48, 131, 234, 225,  85,  12,  79, 123, 211, 253, // ..0...U.O{..
-  21, 250, 228, 141,   6, 184,  31, 147,  66,  32,  27, 198, // ........B ..
-  46,  42, 120, 109, 137,   4,   2, 153, 104, 139, 238,  68, // .*xm....h..D
- 118, 190, 131,  35, 137, 101,  98, 173,  81, 186,  24,  70, // v..#.eb.Q..F
- 178,  59, 148, 232, 114, 112,  31,  18,  63, 210, 186,   1, // .;..rp..?...
-  40,  34, 250, 198, 116,   1, 163,  98,  24, 233, 218, 128, // ("..t..b....
- 134,  83, 152, 239, 177, 233,  74, 124, 132, 175, 152,  11, // .S....J|....
-  77, 131,   2,   9,  88, 249,  17,  82, 232, 173, 126, 188, // M...X..R..~.
- 182, 110,  23,  82, 194,  31, 205, 159, 137,  19,  78,  11, // .n.R......N.
- 215,  55, 106, 127, 166, 101, 221,  51,  20, 211,  39, 139, // .7j..e.3..'.
- 116, 180, 147, 206,  22,  21,  33, 194, 245, 154, 138, 145, // t.....!.....
-  42,  49,  57, 196,  88, 110, 252,  60, 222, 207, 200, 241, // *19.Xn.<....
- 244,  12, 244,  42, 115, 203,   4,   9, 127,  73, 137, 186, // ...*s....I..
-  76, 233, 107, 146, 120,  40,   2, 126, 138, 158, 211, 129, // L.k.x(.~....
-  91, 253,  24,  58, 223, 167,  96, 222, 224,  47,  49,  85, // [..:..`../1U
- 252, 224, 228,  54,  86, 233, 229, 151, 159, 244,  69,  63, // ...6V.....E?
-  84, 159, 231, 128,  99, 173, 153,  30,  18, 223,  32,  45, // T...c..... -
-  53, 203,   7, 206, 127,  35,  38, 126, 149, 162,  86, 199, // 5....#&~..V.
- 234, 184,  75,  90, 209, 252, 248,  45,  48, 237, 213,  98, // ..KZ...-0..b
-  18, 188, 222, 100,  64, 223, 130, 138, 252, 104, 176, 243, // ...d@....h..
- 165, 166, 168, 248, 140,  86, 249, 147,  78, 168,  69, 240, // .....V..N.E.
- 227, 130, 184,  23, 130, 145,  72, 152, 183,  76,  61,  63, // ......H..L=?
- 109,  39, 110,  72, 129, 238,  50, 243, 234,  67, 120, 127, // m'nH..2..Cx.
-  65, 232, 152, 216,  21, 154, 170, 189,  52,  69, 155, 216, // A.......4E..
- 132,  67, 108,  91,  36,  47,  45, 198,  19, 242, 156, 232, // .Cl[$/-.....
- 150, 123, 209, 237, 120, 171,  91, 228, 104,  58, 242, 202, // .{..x.[.h:..
-  73, 219,  29, 182, 222,  22, 194, 121, 149, 193, 221, 248, // I......y....
- 249, 225, 122, 253, 204, 220,  77, 200, 181, 220, 244,  42, // ..z...M....*
-  92,  95, 185, 116, 245,  95, 238, 241, 153,  73,  68, 197, // ._.t._...ID.
- 162,   6,  36, 142,  74,  59,  61,  81, 187, 208,  67, 138, // ..$.J;=Q..C.
- 185, 122, 199,  77, 251, 246, 109, 186, 239, 131, 123, 102, // .z.M..m...{f
- 239, 186, 110, 173, 204, 149,  65,  89, 207,  92, 126, 122, // ..n...AY..~z
-  50, 165, 173,  68,  23,  55, 122, 214, 235, 163,  34,  27, // 2..D.7z...".
- 214, 248, 110, 233, 205, 134, 123, 138, 251, 246, 241, 118, // ..n...{....v
- 253, 195,  61, 245,  45, 236, 250,  67, 100, 200,   9, 223, // ..=.-..Cd...
- 190, 101, 201,  42,  29, 227, 247, 202,  48,  20, 163, 152, // .e.*....0...
-  63, 121, 199, 155, 190,  94, 158,  95,  61, 210, 190, 168, // ?y...^._=...
- 227,  17,   8, 186, 211,  61, 177,  99,  81,  58, 151, 243, // .....=.cQ:..
- 199, 103,  46, 215, 235, 189, 217, 250, 104,  70,  32, 221, // .g......hF .
- 208, 252, 141,   2, 176,  37, 254,  75, 210, 235, 211,  90, // .....%.K...Z
-  88, 203, 228,   3, 237,  52, 225,  95,  69, 249, 238,  57, // X....4._E..9
- 110,  77, 213,  38, 210, 185,  56, 170, 117,  79, 106, 111, // nM.&..8.uOjo
- 187,  93, 252, 233,  30, 213, 122, 207, 106, 221, 211, 218, // .]....z.j...
-  97, 173,  71,  25, 189,  83, 120,  58, 181, 131,  23, 223, // a.G..Sx:....
-   9,  39, 152,  76,  90, 244,  23,  95, 156, 114, 115, 106, // .'.LZ.._.rsj
-  86, 123,  75, 149, 187, 181, 139, 218, 113, 173, 139, 175, // V{K.....q...
- 189, 167, 248, 139, 175, 144, 162,  87, 250, 237,  62, 171, // .......W..>.
- 245,  14,  33, 187, 244, 126, 216, 117, 108, 247, 252, 231, // ..!..~.ul...
- 153, 176, 255,  89, 205, 254,   9,  17, 233, 208, 223, 131, // ...Y........
- 170, 185, 173, 174, 168, 117,  61, 167,  40, 105,  37,  41, // .....u=.(i%)
- 126, 223,  88,  58, 252, 215, 124, 156,  23, 255, 191, 193, // ~.X:..|.....
- 122,  62,  51, 144, 133, 113, 158,  32,  92,  41, 152,  30, // z>3..q. .)..
- 181,  59, 233, 116, 157, 218, 189, 116, 142, 156,  26, 255, // .;.t...t....
-  29, 171, 195,  78, 141,  63, 170,  39, 123,  71, 128, 173, // ...N.?.'{G..
-  90,  21, 144,  83,  13, 200,  17,  12, 113,  74, 232, 198, // Z..S....qJ..
- 180,  65,  44, 204,  45, 205, 203,  40, 133,  10, 135, 181, // .A,.-..(....
- 183, 208,  37, 208, 162, 135, 143, 175,  53, 204, 195,   9, // ..%.....5...
- 224, 207,  51, 122,   3, 120, 241, 173, 119, 172,  59,  73, // ..3z.x..w.;I
- 193,   6, 184,  81,  91, 132, 237, 212, 222,  30,  33,  13, // ...Q[.....!.
- 237,  63, 200, 185, 232, 213, 142, 106, 111, 123, 152, 132, // .?.....jo{..
-  33, 248, 121,  68,  67,  64, 222,  49, 148,  64, 230, 177, // !.yDC@.1.@..
-  33,  57, 120,  99, 183, 250, 207, 195,  84, 168,  14,   3, // !9xc....T...
- 247, 104, 124, 132, 146,  94,  46, 248, 133,  96, 170, 180, // .h|..^...`..
- 198, 191, 227,  82, 105,  11,  67, 158,  16,   0,  39,  56, // ...Ri.C...'8
-  58, 180, 190, 160,  52,  78, 184, 224,  53, 106,  74, 127, // :...4N..5jJ.
- 231, 166, 210,  22,   6,  50,  53, 113,  80, 108, 204,  47, // .....25qPl./
- 212,  95, 165, 113, 158,  44, 183,  64, 238, 106, 240, 176, // ._.q.,.@.j..
-  25,  34, 130, 210,  60,   9, 110, 137, 127, 107, 230,  54, // ."..<.n..k.6
-  72,  39, 217,  22,  53, 122,   6,  92, 154, 162,  77, 240, // H'..5z....M.
-  63,  83, 242, 213, 244,  49,  43, 183,  62, 174,  61, 171, // ?S...1+.>.=.
- 189,  61,  38,  74,  62, 213,  79, 166, 103,   7, 126, 207, // .=&J>.O.g.~.
- 232, 137,  36, 160,  30, 113,  70, 244, 120,  70,  15, 211, // ..$..qF.xF..
-  95,  12, 253, 141, 195,  20,  29, 226,  49, 114,  30,  76, // _.......1r.L
- 115, 124, 207, 191,  41, 252,  28,  57,  85, 134,  59,  33, // s|..)..9U.;!
- 236,   2, 208,  26,  29,  35,  21,  69, 101, 136, 128,   9, // .....#.Ee...
- 158, 214, 206, 224, 137, 227,  16, 228, 196,  76, 196, 158, // .........L..
- 144, 135, 207, 167, 248,  68, 244,  66, 226,  88,  63, 113, // .....D.B.X?q
-  18, 199, 181,  51, 122, 158,  98,  33, 245,   3,  51,   1, // ...3z.b!..3.
- 126, 193,   2, 254, 233,  17, 211,  34, 202, 158,  81, 103, // ~......"..Qg
- 252,  60, 214,  79, 205, 217,  56, 164, 134,  45,  73, 174, // .<.O..8..-I.
- 183, 112,  13, 176, 209,  19,  90, 214, 122, 204,  40, 192, // .p....Z.z.(.
- 183, 103,  36, 160,  70,  33,  21,  79, 200, 132, 127,  72, // .g$.F!.O...H
- 133,  83,  98, 139,  19,   0,   4, 234, 213, 168,  11, 122, // .Sb........z
- 176, 236,  60, 101, 202, 159,  22, 195, 226, 159, 200, 218, // ..<e........
- 226, 104,  70,  27, 114, 135, 102,  48, 236,  15, 146, 154, // .hF.r.f0....
- 178, 168, 132, 226,  73, 144,  86, 248, 145,  33, 180, 204, // ....I.V..!..
-  64,  32, 124,  37, 142,  62, 102,  62, 133,  89,  63, 197, // @ |%.>f>.Y?.
-  73, 227, 140,  46, 186, 135,  52, 255,  67,  74,  63, 163, // I.....4.CJ?.
- 244,  51,  76,   3, 110,  32,  13, 207, 103, 102,  40, 252, // .3L.n ..gf(.
- 107,  64, 213, 129,  80, 137,  60, 171,  17, 221, 142,  16, // k@..P.<.....
- 180,  35, 156, 249,  41, 142, 120, 106, 164,  16,  31,  95, // .#..).xj..._
- 153,  29,  30, 103,  24,  35, 219, 227,   0, 214, 165, 125, // ...g.#.....}
- 178, 205,  90, 129, 240, 133, 125, 118,  45,   2, 116, 147, // ..Z...}v-.t.
-  29, 129, 238,  17,   2, 222, 158,  24, 161, 220, 170, 191, // ............
-  43, 197, 172, 116,  16, 219,  90,   7, 108, 181, 216,  22, // +..t..Z.l...
-  93, 156,  30,  75,  42,  77, 178,  87,  80, 164, 170,  56, // ]..K*M.WP..8
-  79, 180, 114,  56,  33,  61, 143, 152,  69, 101, 137, 252, // O.r8!=..Ee..
- 139, 152, 238, 224, 207,  49, 118, 192,  26, 170, 130,  36, // .....1v....$
- 212, 163, 136, 164, 222,  83,  66, 210, 110, 133, 110, 111, // .....SB.n.no
- 183,   2,  64, 128, 223,  81, 217, 102, 165,  30, 146, 231, // ..@..Q.f....
- 109, 151,  24,  23, 149, 171, 153, 219,  92, 221, 164,  73, // m..........I
- 252,  24, 202, 121, 130,  40, 120, 181, 110, 111, 171, 201, // ...y.(x.no..
-  46, 202,  25, 131, 167, 154,  77, 183, 235, 239,  65,  57, // ......M...A9
- 211, 136, 150,  29, 146, 198, 173,  22, 251,  80, 206,  76, // .........P.L
- 112, 138, 248, 210,  10, 146, 241, 241,  95, 245, 209,  52, // p......._..4
- 140,  34,  88, 148, 249,  84,  12, 253, 105,  66, 221,  60, // ."X..T..iB.<
-  10, 151, 163,   4,  20, 236,  22, 100,  61, 194, 150,  22, // .......d=...
- 184,  30, 169,  84,  98,  35,  16, 146,  46,  46,  86,  39, // ...Tb#....V'
- 240,  48,  75,  13,  63, 143, 112,  85,  63,  50, 189,  38, // .0K.?.pU?2.&
- 227, 235, 191, 166,  35, 121,  77, 102, 189, 141, 227, 117, // ....#yMf...u
- 108,  79, 153, 170,  82,  18, 145,  70,  74, 254, 226,  80, // lO..R..FJ..P
-  51, 173,  65,  29, 158,  66, 219,  98, 106,  80, 245, 135, // 3.A..B.bjP..
- 168,  21, 187, 164,  11,  47,  72, 147, 191,  69,  29, 248, // ...../H..E..
- 148, 228,   2,  21, 224,  41, 169,  34,   0, 255, 169, 233, // .....)."....
-  37, 138, 130, 101, 117, 212, 167, 237, 195, 227, 167,  80, // %..eu......P
- 231,  89, 187, 123, 212,  59,  61, 249, 210,  61,  57,  63, // .Y.{.;=..=9?
- 110, 159, 112, 178, 211,  62, 133, 178, 243,  78, 251, 248, // n.p..>...N..
- 139,  46,  62, 215, 213, 191,   2, 178,  40,  85, 235, 124, // ..>.....(U.|
-  57, 214,  69, 221,  19, 168, 119,  66,  77, 142, 206, 159, // 9.E...wBM...
- 233,  62,  58, 231, 186, 226,  87, 103, 199, 200, 114, 123, // .>:...Wg..r{
- 162,   7,  22,  22, 184,  69, 201, 181, 254, 179, 156, 210, // .....E......
- 233, 152, 140, 109, 154, 238, 161,  51, 207,   9,  60, 139, // ...m...3..<.
-  45,  68,  62, 101, 219, 226,  41, 175, 152, 244,  56,  70, // -D>e..)...8F
- 188,  28,  19,  98, 245, 138, 197,   2,  75, 203,  77, 151, // ...b....K.M.
-  20, 251, 215, 154,  94, 241, 121, 197, 134, 215, 255,  71, // ....^.y....G
- 219, 149, 119, 183, 109,  36, 249, 255, 243,  41,  96, 140, // ..w.m$...)`.
- 163,  37,  45, 144,   2, 192, 155,  50, 200, 231,  40, 147, // .%-....2..(.
- 183, 147,  39, 101,  60, 201, 120, 230,  61, 123, 188,  22, // ..'e<.x.={..
-  69, 130,  18, 214,  16, 192,  37,  72,  89, 138, 196, 239, // E.....%HY...
- 190, 245, 171, 170, 198,  69,  42, 199, 108, 214,  71,  19, // .....E*.l.G.
-  71, 163, 143, 234, 186,  27, 168, 226,  26, 231, 122, 215, // G.........z.
- 128, 112, 245, 112, 152,  39,  11, 149, 248, 202, 147,   5, // .p.p.'......
- 169, 206,  85, 200, 225, 134, 148, 121,  59, 235, 112,  17, // ..U....y;.p.
- 109, 230,  53, 244, 244, 177,  96, 188, 120,  29,  87,  75, // m.5...`.x.WK
-  22,  42,  61, 168, 201, 231, 172,  44, 211, 177, 239, 177, // .*=....,....
-  10, 237, 123,  53,  68, 243,  89, 107, 243,  49,  29, 208, // ..{5D.Yk.1..
- 184, 148,  30, 122, 124, 142,  70,  22,  97, 246,  25,   9, // ...z|.F.a...
- 240, 170, 152, 229, 139, 178, 224, 179, 182,  32,  68, 172, // ......... D.
-  34,  90, 202, 145, 150, 231,  82, 137,  37, 144, 200,  78, // "Z....R.%..N
- 145, 142,  29, 145,  76, 184, 168, 179,  53,  97, 156, 203, // ....L...5a..
-  29, 113,  43, 103,  92, 221,  19, 253, 192, 235,   8, 203, // .q+g........
- 237,   8, 223,   5, 227,   6,  64,  58, 190,  74,  94,  86, // ......@:.J^V
- 252,  60,  80, 164,  81,   6, 249, 228,  66,  72, 171, 172, // .<P.Q...BH..
-  91,   1, 182,  53,   6,  51,  96, 145,   7,  68,  16, 197, // [..5.3`..D..
-  71,  38,  39,  74, 133, 103,  86, 221,  19,  96,  51, 255, // G&'J.gV..`3.
- 151, 187, 218,  30, 156, 128, 117,  30,  42,  68, 141,  54, // ......u.*D.6
- 189,  33, 195, 192,  23,  41, 108, 180, 100, 155, 116, 161, // .!...)l.d.t.
- 104, 149,  69,  89, 235, 134,  76, 135, 159,  17,  17,  63, // h.EY..L....?
- 182, 171, 172,  99, 160, 108, 190, 107, 216, 252, 225, 133, // ...c.l.k....
- 202, 101, 195, 161, 219, 101,  22,  84,  52, 244,  27,  30, // .e...e.T4...
- 202, 165,  80, 183,  44, 100, 138,  81, 155, 244, 154, 246, // ..P.,d.Q....
-  97, 118,  55, 248, 141,  99,  62, 192,  34, 127, 223,  67, // av7..c>."..C
-  24, 231,  47,  61,  68, 203, 147,  84, 169, 168, 203, 234, // ../=D..T....
-  85,  55,  23, 248, 162,   2, 228, 152, 156,  99, 201, 253, // U7.......c..
- 106,  86, 125, 146,  56,  29, 213, 201, 153, 157, 223, 246, // jV}.8.......
- 233,  96, 244,  15, 175, 219, 246, 137, 173,  25, 230,   7, // .`..........
-  30,  73,  53, 137,   7, 118, 219,   3, 186, 110,  41, 211, // .I5..v...n).
- 251, 135, 215,  30, 160, 126, 153, 249, 149, 121, 162,  86, // .....~...y.V
-  39, 156, 250, 255,  97, 133, 146, 248, 174,   2,   9,  86, // '...a......V
- 158, 207,  85,  53, 144,  66, 205, 167, 174, 209,   0,  46, // ..U5.B......
- 134,  70,  29, 232, 138,  86, 110, 128,  67,  70, 110,  50, // .F...Vn.CFn2
- 171, 104, 243,  16,  19, 144,  58,  35,  33,  32, 223, 148, // .h....:#! ..
-  96,  75, 244, 191, 203,  61, 177,  13,  72,  53,  47, 248, // `K...=..H5/.
-  24, 226, 199,  83,  77,  56, 124, 168,  75, 115, 197, 127, // ...SM8|.Ks..
-  79,  86, 216, 251,  53, 188, 233, 239,  51,  60, 232, 224, // OV..5...3<..
- 162, 123,  27, 235, 162, 103,  25, 149, 186,  92, 130, 246, // .{...g......
-  69,   2, 163, 174, 232, 154,  90,  40, 141,  47, 195, 112, // E.....Z(./.p
-  81,  29, 158, 193, 191,  95,  69, 218, 178,  21,  76, 214, // Q...._E...L.
-   9, 220,  27,  44, 111, 224, 214,  24,   0,  28,  23,  80, // ...,o......P
-  41, 206,  60,  12,  18, 163, 224, 177,  24, 251, 128,  26, // ).<.........
-  13, 199, 117, 219, 160, 170, 128, 120, 204, 109,  68,  71, // ..u....x.mDG
-  25, 178,   2,  51,  84, 107, 214, 115, 243,  70, 104, 185, // ...3Tk.s.Fh.
- 170, 162,   4, 118, 146, 197, 208,  80, 131,  15,   5,  53, // ...v...P...5
- 216, 147,   2, 214,   0, 218,  97,  51,  49,  23,  25, 220, // ......a31...
- 126, 207, 128,  36, 174, 218, 151, 197, 208, 114, 195, 143, // ~..$.....r..
-  85,  26,  79, 172, 220,  33, 214,  64, 103, 101,  47, 211, // U.O..!.@ge/.
-  24, 185,  87, 211,  85, 152,  84, 116,  61,  70, 143, 115, // ..W.U.Tt=F.s
- 113,  16, 136,  38, 234, 177,  41, 232, 185, 172, 252,  13, // q..&..).....
- 153,  33,  11,  74,  50,   2, 201,  95,   3,  43, 110, 180, // .!.J2.._.+n.
- 166, 254, 138,  26,  46, 192,  26, 160,  53, 214, 137, 192, // ........5...
-   3, 216, 211, 160, 234, 110, 161, 232,  18, 217,  61,  99, // .....n....=c
- 119, 151, 237, 109, 213, 215,  68, 104, 215, 204, 110, 123, // w..m..Dh..n{
- 185, 141, 227, 140,  68, 120, 152, 180, 194, 251, 104,  83, // ....Dx....hS
- 155, 160,  39,  42, 166, 252, 235, 178, 209, 218,  21,  87, // ..'*.......W
-   7, 107, 233,  84,  94, 116, 115, 173, 221,  92, 101,  90, // .k.T^ts...eZ
- 117, 185, 154, 254,  51, 115, 206, 251, 218, 239,   5, 160, // u...3s......
- 169, 244,  97, 200,  47, 239, 194, 156, 150, 123,  16, 255, // ..a./....{..
-  76, 209, 195, 117, 180, 220, 212, 218, 238, 226,  73, 177, // L..u......I.
- 116, 165, 100, 130, 102,  13,  19, 135, 128,  15, 151, 198, // t.d.f.......
-  93,  68,  26, 131, 197,  63, 116, 153, 109,  68, 150, 254, // ]D...?t.mD..
- 114, 165,  40, 134, 150, 232,  65, 162,  31,  20,  55, 164, // r.(...A...7.
- 133, 178,   0, 191, 142,  54,  55, 219,  43,  51, 168,  61, // .....67.+3.=
- 182, 120, 136,  16,  89,  44, 251, 212, 195,  25, 143, 193, // .x..Y,......
- 149, 161, 240, 149,  94,   7, 104, 222, 103, 173, 162, 207, // ....^.h.g...
- 106, 140, 150,  30, 151,  98, 170, 244, 122,  76, 161,  61, // j....b..zL.=
-  70,  33,  60,  65, 246, 155,  91, 148, 221,  17, 212, 131, // F!<A..[.....
- 174, 224,  22, 240, 190, 203,  46,  47, 148,  29,  46, 123, // ......./...{
-  86, 119, 104, 202, 161, 213, 227, 206, 122, 220,  65, 143, // Vwh.....z.A.
- 103,  77, 215,  97,  75, 244, 181,   4, 191, 100,  87,  69, // gM.aK....dWE
- 151, 209, 164, 195,  58, 144,  80, 162, 207, 173, 249, 190, // ....:.P.....
-  41, 153,  42,  61,  86,  83, 165, 244,  93,  83, 141,  93, // ).*=VS..]S.]
- 136, 116, 177, 195, 101, 215, 197,  21,  29, 210, 168,  40, // .t..e......(
-  49,  12,  23, 199, 212, 154, 148,  58,  48, 238, 177, 199, // 1......:0...
- 189, 247, 120,  36,  52,  36, 250, 215,  25,  98, 132, 157, // ..x$4$...b..
-  17, 166, 219, 229,   7, 169, 236,   1, 223,  92,  64, 235, // ..........@.
-  12,  63,  30, 174, 245, 249, 161,  62,  63,  71, 101, 159, // .?.....>?Ge.
-   1,  71, 101, 135, 143,  61, 158, 186, 174, 129, 146, 206, // .Ge..=......
- 245,  58, 253, 242, 155, 253, 115, 188,  94, 185, 211,  77, // .:....s.^..M
- 124, 112, 210, 204,  77,  88, 179, 198,  89, 182, 159,   9, // |p..MX..Y...
-  16,  45, 176, 120, 241,  47,   1,  42, 125, 241, 138,  10, // .-.x./.*}...
- 247, 245, 196, 113, 209, 197, 148, 251,   6, 234,  67,  35, // ...q......C#
-  33, 220,   3,  94, 159, 129, 248,  63,  10, 234, 191,  73, // !..^...?...I
- 111, 195, 186,  77,  41, 196,  92,   8,  89,  79, 197,  75, // o..M)...YO.K
-  78, 124, 101,   3, 193, 207, 161,  33,  57, 165, 255,  29, // N|e....!9...
- 137, 221, 207,  13, 248, 194, 183,  27,  37,  87, 233, 125, // ........%W.}
- 149,  57, 178,  29,  84, 177,  39,  68, 248,  12,  44, 117, // .9..T.'D..,u
-  87,  73,  21, 207,  21, 193, 197,  63, 158, 103,   0,  33, // WI.....?.g.!
-  26, 182,  91,  66,  69, 227, 103,  50,  29,  46, 211, 223, // ..[BE.g2....
- 109,  11, 123,  58, 143, 142,  85, 178, 140, 149, 236,  99, // m.{:..U....c
- 184,  18,  18,  36,  97,  47, 195, 119,   8,  28,  22, 155, // ...$a/.w....
- 141,  15,  33,  48,  70, 106, 163, 243, 225, 123, 243, 116, // ..!0Fj...{.t
- 242, 185, 246, 224, 144,  38, 133, 146,  85,  66, 224, 186, // .....&..UB..
- 184, 176, 212,  85,  40,  26, 226, 200,  76, 215, 227, 150, // ...U(...L...
-   7,  22, 244,  28, 186, 119,  38,  63,  67,  17, 151, 112, // .....w&?C..p
- 236,   8, 243, 242,  93, 241, 171,  99,  36, 130, 184, 158, // ....]..c$...
-  16, 168, 142, 194, 124, 186, 127,  24,  48,  30,   3, 166, // ....|...0...
-  14,  23,  33, 249,  51, 128, 219, 175, 171,  46,  98, 197, // ..!.3.....b.
- 137,  19, 180, 103, 193,  33, 234, 185,  70, 125,  97,  15, // ...g.!..F}a.
-  24,  13, 109, 168,  76, 227, 125,  62, 134,  10,  36, 122, // ..m.L.}>..$z
- 188, 114, 130,   5,   3,  45,  81, 155,  77, 220,  30,  28, // .r...-Q.M...
- 158, 248,  11, 221,  23,  51, 237,  72,  33, 170, 157,  56, // .....3.H!..8
-  82, 213,  61, 227, 119, 158, 215, 210, 187, 133,  14, 247, // R.=.w.......
-  31, 206, 237,  44, 138, 127,  65,  76, 171, 113, 168, 134, // ...,..AL.q..
-  99,  46, 115,  21, 143, 111, 195, 100,  91, 165, 109, 209, // c.s..o.d[.m.
-  24,  88, 143,  98, 247,  59, 195, 255, 130, 151, 135, 197, // .X.b.;......
-  89, 215,  60, 152, 101, 179, 235, 154,  83, 165, 203, 253, // Y.<.e...S...
- 138,  52, 243, 149, 169,  48,   6,  12,  21, 122, 185,  77, // .4...0...z.M
- 126, 139,  87,  70,  86,  55, 105,  18, 238, 169,   6, 103, // ~.WFV7i....g
- 194,  76,  88, 168, 201, 152,  69, 247,  84,   4, 240,  75, // .LX...E.T..K
-  20,  99, 254, 201,  41,  15,  87,  92, 197, 133, 191, 169, // .c..).W.....
-  47, 186,  92, 238,  28,  55, 235, 103,   8,  90, 201, 122, // /....7.g.Z.z
- 160,  37,  60, 185, 108, 110, 143, 240, 115,  33, 213, 120, // .%<.ln..s!.x
-  57,  70, 102, 224, 201,  54, 171,  17, 126, 117, 143, 227, // 9Ff..6..~u..
-  54, 189, 170, 169, 153, 204,   9, 217, 141,  32, 198,  62, // 6........ .>
-  43, 245,  35,  64, 107, 100, 124, 224,  35, 179, 109, 227, // +.#@kd|.#.m.
- 137,  51, 138, 127, 206, 196,   1, 155, 235, 254, 172, 205, // .3..........
- 145, 160,  97,  95, 120,  71,  65, 234, 201,   4, 129,  82, // ..a_xGA....R
- 231, 140,  78,  23, 172, 101, 226, 216, 248, 162, 110, 211, // ..N..e....n.
-  52, 169, 217,  22, 254,  25, 112, 142,  26, 129,  15,  27, // 4.....p.....
-  66,  77, 177,  80, 124,  90,  35, 230, 208, 163, 194, 195, // BM.P|Z#.....
- 160, 202, 107, 207,  26,  40,  83, 240, 205,  58, 166, 213, // ..k..(S..:..
- 189, 169, 142, 172,   2,  43,  27, 197, 174,   0, 131, 210, // .....+......
-  87, 103,  61,  83, 245, 128,  47, 192, 138, 151, 219, 190, // Wg=S../.....
- 122, 214, 122, 162,  64, 142,  10,  41, 113,  49, 224,  75, // z.z.@..)q1.K
-  29, 177,  60, 140,  71, 239, 118, 155,  69, 243, 202, 156, // ..<.G.v.E...
-  60, 105, 205, 147,  13,  15,  22, 217, 204, 247,  60, 225, // <i........<.
- 104,  93, 101, 124, 214, 107,  49, 186, 171,  78,   1,  24, // h]e|.k1..N..
-  69, 247, 204,  42, 214,  15, 234,  73, 175,  86,  68, 191, // E..*...I.VD.
-  92, 179, 179,  95,  19, 163, 217,  84,  23, 220,  21, 107, // ..._...T...k
- 201,  21,  62,  34,  44, 157, 189, 186, 106,  34, 251,  74, // ..>",...j".J
-  25, 124,   7,  43,  45,  63,  62, 115,  89, 121,  90,   1, // .|.+-?>sYyZ.
-  44, 161, 191, 179, 154, 220, 234,  67, 103, 236, 139, 246, // ,......Cg...
- 206, 199, 158, 156, 248, 124, 194, 162, 189, 107, 201, 180, // .....|...k..
-  71, 140, 252,  29, 238, 125,  36, 187,  58,  29,  81, 125, // G....}$.:.Q}
-  21, 163,  87, 179,  85, 184, 134,   7, 119, 223, 233,  41, // ..W.U...w..)
-  62,  41, 198, 217, 161, 177,  91, 132,  73, 142, 148, 198, // >)....[.I...
-  69, 134,  50, 111, 240, 153, 242, 124,  89,  95,  95, 172, // E.2o...|Y__.
-  27, 177, 251,  48,  20, 175, 203, 164, 204, 139, 162, 220, // ...0........
- 222, 227,  61,  39,  89, 104,  79, 156, 131,  66, 155,  67, // ..='YhO..B.C
- 241, 235,  15, 173, 124, 132, 219, 154, 215, 177, 195,  94, // ....|......^
-   7,  30,  16, 208,  29, 132, 100, 212,  89,  98,  42, 155, // ......d.Yb*.
- 180, 182,  24,  76, 195, 134, 141, 115,  81, 184,  43, 187, // ...L...sQ.+.
-  57, 211, 245, 141, 190, 237, 155, 141,  31,  99, 146, 116, // 9........c.t
- 247,  89, 177, 226, 195, 136,  57, 113,  71, 187, 142, 103, // .Y....9qG..g
-  15,  53,  32, 138, 119,  43, 247, 136, 188,  55,  21, 183, // .5 .w+...7..
-   7,  76,  34,   1, 237,  62,  67, 129, 222,  66, 214,  88, // .L"..>C..B.X
-  84, 157,  21,  83,  42,  40, 197, 103,  19,   0,   5, 248, // T..S*(.g....
-  23, 239,  39, 153, 189,  35,  32, 161, 106, 119, 221, 130, // ..'..# .jw..
-  79,  14,  75, 172, 145, 169,  85,  44,  65,  47, 223, 251, // O.K...U,A/..
- 133, 143, 129, 235, 157, 153, 218,  60, 120, 181, 127,  60, // .......<x..<
-  95,  54, 171, 212, 162,  89, 173, 163, 164, 162,  86, 201, // _6...Y....V.
- 174,  34,  19,  55, 115,  58,  87,  10, 191, 167, 255,  46, // .".7s:W.....
- 120,  11, 231, 124,  80, 232,  73,  88, 121, 241, 109, 242, // x..|P.IXy.m.
- 174,  42,  63,  56, 224, 255,  35, 246,  19,  67, 141,  65, // .*?8..#..C.A
-  29,  21,  61, 235, 112, 185,  14, 179, 155,  95, 214, 134, // ..=.p...._..
-  24,  27, 202, 187, 245, 226, 148, 134, 214, 193, 135,  23, // ............
- 172, 131, 244, 212, 152, 134, 114, 218,  51, 173, 215, 189, // ......r.3...
- 167, 150, 215, 198, 172, 219, 189, 145, 245, 134, 149, 182, // ............
- 158, 216,  60,  52, 244,  54,   4,  82, 155,  21, 102,   2, // ..<4.6.R..f.
- 191,  71,  71,  23, 149, 171,  29, 108, 115, 152,  75, 163, // .GG....ls.K.
- 118, 215, 211,  22, 212, 106, 146, 150, 249, 250,  57, 182, // v....j....9.
-  69, 135, 214,  69, 229, 210, 176, 221, 201,  57,  30, 190, // E..E.....9..
- 249, 175,  99,  87, 159, 249,  34,  27,  71,  80,  92,  59, // ..cW..".GP.;
- 162, 240, 177,   5, 121, 230, 247, 141, 245, 168, 219, 136, // ....y.......
- 166, 153,  44, 172, 186,  87,  61,  60, 254, 198, 235, 154, // ..,..W=<....
-  81, 241, 146,  15, 192,  53, 168, 140,  91, 125, 186, 160, // Q....5..[}..
- 199, 157, 118, 207, 106, 241,  24, 217, 178, 138,  25,  16, // ..v.j.......
-  74,  61, 122,  34, 196,  22, 187, 204, 156, 250,   0, 116, // J=z".......t
- 156, 235,  26,  95, 214, 179,  85,  85, 114,  98, 235,  83, // ..._..UUrb.S
-  16,  13, 115,  31,  58,  84, 210, 255, 174, 163, 140, 240, // ..s.:T......
-  92, 212, 192, 115, 117,  79,  95, 148,  78, 141, 239,  35, // ...suO_.N..#
- 155,  85, 229, 143, 236,   2, 118, 196,  28,  24, 152, 247, // .U....v.....
-  35, 180, 200, 145, 202, 119, 165,  64, 155,   3, 169,  41, // #....w.@...)
-  76,  71,  74,  99, 172,  75, 112, 143,  26, 158, 117,  21, // LGJc.Kp...u.
- 207,  84,   7, 243, 235, 218,  37,  75, 210, 115, 230,  31, // .T....%K.s..
- 166, 149, 154, 203, 212, 208, 119, 174, 125, 178,  74,  35, // ......w.}.J#
- 238,  19,  95,  61,  21, 230, 209, 205, 134,  52, 244,  42, // .._=.....4.*
- 175,  96, 222, 199, 254, 123, 194, 100, 168,  51, 236, 180, // .`...{.d.3..
- 177, 248,   5,  24, 214, 148, 125,  45, 248,  45,   0, 222, // ......}-.-..
- 118, 241,  44,  85, 175, 193, 198,  61, 179,  13, 211,  55, // v.,U...=...7
-  44, 125, 164, 165,  47,  70,  91, 143, 185, 133,  64, 174, // ,}../F[...@.
- 203, 167, 236, 251, 207, 171, 137, 247,  74,  30, 247, 197, // ........J...
- 134,  81, 189, 159, 119, 239,   6, 121, 207, 254, 175, 111, // .Q..w..y...o
-  90, 155,  61,  84, 124, 157, 222, 138, 170, 238,  43, 213, // Z.=T|.....+.
-  37,  58, 162,  75, 244, 172, 161,  57, 241, 120, 132,  23, // %:.K...9.x..
-  60,  45, 112,  64, 126, 185,   9, 163, 245, 242, 165, 147, // <-p@~.......
-   6, 211, 109, 109, 119,  85, 196, 165, 168, 180, 140, 120, // ..mmwU.....x
- 170, 223, 250,  42,   8,  60, 121, 223,  64, 216,  41, 179, // ...*.<y.@.).
-  10,  29,  96, 182, 169, 190,  31,  32,  28,  91,  60,  74, // ..`.... .[<J
- 186, 132, 190, 170,  72, 202, 112,  89, 181, 226,  29, 119, // ....H.pY...w
- 134,  68, 238, 164, 122,  95,  52,  88, 161, 195, 161, 106, // .D..z_4X...j
-   8, 253,  92,  85, 238, 168, 241,  51, 204,  81, 105, 195, // ...U...3.Qi.
-  62, 194, 242, 238, 182,  98, 227, 176, 188,  23,  81, 198, // >....b....Q.
- 180,  33, 243, 131,  66, 220,   9, 153, 119, 114, 171, 120, // .!..B...wr.x
-  19, 198, 225, 158,  26, 206, 198, 214,  25, 116,  73, 207, // .........tI.
- 205,  45,  21, 222, 206,  25,  73,  33, 111, 128, 168, 181, // .-....I!o...
- 234, 105, 201, 150, 173,  39, 150, 173,  39,  90,   0,  55, // .i...'..'Z.7
-  36, 187, 189,  96,  73, 242, 211,  23, 252,  96, 101, 150, // $..`I....`e.
- 127, 206,   4, 185, 196,  38, 148, 242,  92, 170,  62, 143, // .....&....>.
-  62, 190,  87,  70, 159, 205, 122, 198, 242, 160, 166,  34, // >.WF..z...."
- 193, 117,  52,  44, 109,   8, 178,  43, 201, 210,  93, 172, // .u4,m..+..].
- 124,  91,  30, 120, 228, 201,  98,  42,  14, 168,  83, 145, // |[.x..b*..S.
- 207, 196,   2,  81, 122,  98,  66,  85, 110, 182, 249,  18, // ...QzbBUn...
- 109,  74, 126, 224, 223, 236,  55, 235, 139, 161, 210,  99, // mJ~...7....c
- 115, 227, 188,  39, 238, 215, 158,   0, 168, 235, 171,  79, // s..'.......O
- 177, 199,  59, 113,  93, 126, 101, 134,   9, 215,   8,  93, // ..;q]~e....]
- 121, 191, 135, 213, 126, 113, 118, 156,  51,  43,  62, 235, // y...~qv.3+>.
- 227,   1, 176,  73, 230, 185, 157, 161, 168,  29,  67,  86, // ...I......CV
- 181, 186,  76, 214, 121, 121,  38,  63, 176, 111,  65,  64, // ..L.yy&?.oA@
-  84, 156, 117,   6,  86, 159, 221, 113, 116, 208, 227,  53, // T.u.V..qt..5
-  80, 244, 216,  38, 191, 223, 188,  29, 176, 121,  35, 138, // P..&.....y#.
- 126,  71, 138, 161,  88,  23, 255, 142, 117, 187,  93, 253, // ~G..X...u.].
-  97, 155, 153, 186, 139, 168,  72,  54, 180, 202,  30,  18, // a.....H6....
- 213,  52,  73, 207, 172, 186, 188,  25, 179, 207, 196, 152, // .4I.........
-  45, 188,  23, 174, 241,  12, 186, 234,  76, 243,  88, 136, // -.......L.X.
-  50,  86, 153, 169, 187,  98, 161, 245, 149,  58, 222, 195, // 2V...b...:..
- 134, 238, 184, 198, 221, 116, 166, 236, 170, 100, 205, 122, // .....t...d.z
- 174, 190, 253, 227,  89, 101,  10,  69, 156, 143, 180,  62, // ....Ye.E...>
- 166,  78, 161, 227, 201,  70, 177, 234,  79, 204, 209,  42, // .N...F..O..*
-  59, 200, 195, 188, 157,  52, 222, 222, 254, 241,  86, 138, // ;....4....V.
-  37, 214, 237, 153, 120, 251, 122, 178,  43, 228, 153,  77, // %...x.z.+..M
-  32, 177,  99, 165, 196, 187,   2, 208,  75,   6,  50,  61, //  .c.....K.2=
- 163, 160, 234,  20,  68,  86,  15, 114,   6, 254,  37, 173, // ....DV.r..%.
- 190, 123, 211,  17, 110,  45, 111, 173, 152, 205, 154, 247, // .{..n-o.....
- 191,  73,  79, 101, 245, 133, 217, 254, 144, 237,  34,  28, // .IOe......".
- 251, 249,  62, 135, 253, 115, 154, 222, 170, 232, 249,  63, // ..>..s.....?
- 200, 249, 178, 227,  77,  94, 208, 228, 221,  56, 126,  33, // ....M^...8~!
-  48, 215, 202, 202,  61, 170, 108, 250, 131, 186, 124, 166, // 0...=.l...|.
-  19, 214, 246, 254, 184, 110, 152, 243, 159, 243, 251,  87, // .....n.....W
- 126, 105,  47,  65,  95, 200, 194,  78,   8,  27, 238, 231, // ~i/A_..N....
- 230, 212, 147, 215, 225, 216, 131,  42, 215,  64,  69,  60, // .......*.@E<
- 192, 157, 179,  13,  26, 143, 136, 165,  54,  14, 157, 121, // ........6..y
- 150, 141,  55, 206,  60, 158, 101,  25,  66, 233,  56, 237, // ..7.<.e.B.8.
- 118,  59, 217,  53, 131,  73, 195, 117, 102, 109,  78,  15, // v;.5.I.ufmN.
- 118, 249, 149, 101, 189, 206, 238, 174, 173, 187,  40, 252, // v..e......(.
- 242,  77,  74, 211,  80, 111, 119, 135, 134,  79, 213,  95, // .MJ.Pow..O._
-  62,  38,  59, 139,  27,   8, 236, 104, 158,  38, 214, 203, // >&;....h.&..
- 199, 120,  58, 181, 237,  29, 246, 117,  31, 226,  48, 120, // .x:....u..0x
- 249, 184, 225, 115, 106, 231, 153, 108, 105,  84, 229,  81, // ...sj..liT.Q
- 146, 145, 141,  51, 132,  78, 223, 209,  48,  47, 157, 121, // ...3.N..0/.y
- 112, 249, 108, 191, 194, 226, 121, 127,  89, 130,  22,  22, // p.l...y.Y...
- 155, 200, 127, 154, 241,  31, 211, 187, 100, 233,  30,  19, // ........d...
-  94, 184,  95, 159, 234,  27, 197, 122, 102,  79,  48, 181, // ^._....zfO0.
-  63, 220,  90,  69, 163, 191, 108, 175, 126, 245,  26, 185, // ?.ZE..l.~...
-  18,  39, 151, 167, 198, 139, 218, 190,  73, 179,  77,  30, // .'......I.M.
-  66, 147,  67, 134, 158, 152, 119, 204, 151, 180,  88, 102, // B.C...w...Xf
- 125, 204, 122,  69, 201, 106, 187, 249,  49,  92,  30,  94, // }.zE.j..1..^
- 176, 215, 124, 219,  34,  99, 141,   0,  27,  23, 139, 195, // ..|."c......
-  87,  95,  62, 134,   7,  87,  39,  95,  74, 128, 126, 117, // W_>..W'_J.~u
- 160,  79, 249, 216,  42,  46, 250,  78, 208, 119,  90, 239, // .O..*..N.wZ.
-  27,  17, 223, 105,  69, 102, 218, 125, 242, 187, 186,  79, // ...iEf.}...O
- 119,  19, 131,  61, 175,  79, 104,  32, 197, 119, 156,  11, // w..=.Oh .w..
-  26,  80, 198, 131, 209,  97, 109, 208, 123, 188,  51,  95, // .P...am.{.3_
- 139, 149, 135, 176, 136, 238,  76, 167,  89, 140,  88,  77, // ......L.Y.XM
- 150, 233, 165, 232,  85,  70, 193, 107,  37,   3, 227,  79, // ....UF.k%..O
- 239, 237,  53,  16, 212, 182, 100,  52, 241,  78,  87, 243, // ..5...d4.NW.
- 229, 227, 114, 167,  21,  48,  61, 187, 124, 155, 199,  89, // ..r..0=.|..Y
- 124, 224, 119, 179,  63, 206,  77, 180, 137,   1,  56, 254, // |.w.?.M...8.
- 229, 203,   4, 186,  52, 225, 128, 137, 227, 148, 142, 110, // ....4......n
- 137,  32, 194, 237, 106, 188,  54, 199, 120, 145, 104,  28, // . ..j.6.x.h.
-  57, 121,  14, 213, 204,  89,  68,  25,  62, 122,  91, 140, // 9y...YD.>z[.
- 231,  14, 104, 108, 188, 196, 236,  87, 250, 241, 233,  34, // ..hl...W..."
- 224, 217, 211, 131,  63, 113, 164, 169,  38, 103, 130, 185, // ....?q..&g..
-  57, 116,  21, 159, 154,  78, 167,  25,  38, 207, 223,  16, // 9t...N..&...
-  93,   7, 248, 188, 112,  97,  18,  74, 173, 167, 237,   6, // ]...pa.J....
- 210, 178, 202,  87,  72,  47,  60, 147, 178, 201, 180, 244, // ...WH/<.....
- 103,  14, 138, 210, 228,  15,  16,  27, 121,  30, 179, 253, // g.......y...
-  96, 144,  58,  35, 219, 185, 110,  58, 168, 155,  87, 149, // `.:#..n:..W.
-  15, 142, 158, 175, 205, 159,  90,  58, 101, 230, 243,  90, // ......Z:e..Z
- 194, 236, 154,   5, 213, 179, 231,  22, 212,  82, 184, 210, // .........R..
- 133,  74, 178,  43, 254,  36, 168, 145,  78, 167, 165, 175, // .J.+.$..N...
- 169,  16,  87, 189, 137,  15, 132,  14, 197, 183, 105, 207, // ..W.......i.
-  53,  89, 211, 141,   1,   6, 190,  28, 146, 248,   3, 152, // 5Y..........
-  17, 193, 146, 115, 254, 240,  73,  94, 199, 195, 135,  69, // ...s..I^...E
- 132,  49, 196, 233, 116, 193, 104,  32, 243, 167,  39, 173, // .1..t.h ..'.
- 128, 225, 229,  11, 140,  49,  23, 176,  71, 251,  17, 160, // .....1..G...
- 191, 203,  43, 109,  87,  84, 229,  90,  41,  99, 181, 179, // ..+mWT.Z)c..
-  24,  21, 137, 221,  25,  88, 128,  82,  18, 204, 122, 108, // .....X.R..zl
- 223,  68, 139,  69, 152, 216,  76,  61,  76,  57, 130, 181, // .D.E..L=L9..
- 219, 157,   5,  54,  79,  53, 117,   0, 136, 116,  11, 165, // ...6O5u..t..
- 206,  30,  47, 149,  46,  67, 130,  41, 193, 170, 210, 138, // ../..C.)....
-  85, 170, 159, 173,  32, 159,  25, 210, 251, 200, 126, 221, // U... .....~.
- 120, 204, 185,  65,  25, 227,  13, 171,  16, 222, 100, 190, // x..A......d.
- 168, 141,  95,   5, 158, 243,  28, 155,  10,  13, 129, 241, // .._.........
- 235, 191,  87, 233, 189, 205,  96, 212,  85, 223, 164, 215, // ..W...`.U...
- 215, 196,  78, 139,  85, 215, 100, 139, 194, 223,  74, 156, // ..N.U.d...J.
- 171,  24, 219, 109, 249,  83,  48, 117, 229, 158, 190,  89, // ...m.S0u...Y
- 175, 103,  15, 237,  40, 227, 223, 198, 166, 249, 244, 100, // .g..(......d
- 167, 146, 186,  50, 143, 233,  43, 169, 123, 244, 131, 216, // ...2..+.{...
- 207, 225,  67,  70, 213,  36,  34, 120,  48, 249,  16,  58, // ..CF.$"x0..:
-  27, 146,  79, 200,  40, 180, 255, 153,  27, 135, 152, 206, // ..O.(.......
- 153, 120, 195, 110,  31,  35,  68,  99, 227, 195, 127,  57, // .x.n.#Dc...9
- 255, 202,  62,  82, 249, 241,  85, 243,   4,   8, 190,  63, // ..>R..U....?
-   6, 122, 238,   3, 177,  71, 130,  90, 180, 176, 116, 168, // .z...G.Z..t.
- 246,  71, 253,  18, 148, 155, 228, 222, 247, 186,  12, 167, // .G..........
- 252, 113, 112,  30,  30,  73,   2, 109, 142, 109, 199, 207, // .qp..I.m.m..
-  63, 122, 246, 138, 128, 238,  83,  26, 125, 248, 113, 252, // ?z....S.}.q.
-   1, 153,  86, 104,  26, 222, 199, 143,  76,   0, 227,  80, // ..Vh....L..P
- 166, 183, 169, 178, 113,  25, 134,  37, 184,  73, 112,  71, // ....q..%.IpG
- 122,  22,  43,  35, 147,  21, 193,   3, 244,  66, 158, 137, // z.+#.....B..
-  14, 120, 135,  22, 133, 105,  55,  79, 247,  88, 242,  87, // .x...i7O.X.W
- 175, 229,  81,  90,  83,  93, 238, 182,  65,  28, 144,  11, // ..QZS]..A...
-  17,  45, 199, 114, 228,  27, 230,   4,  55,  12,  23, 231, // .-.r....7...
- 135,  33,  59, 218, 138, 100, 130,   6,  95,  85, 232,  44, // .!;..d.._U.,
- 108, 155,  19,  60, 154, 243, 133,  54, 241,  99, 163, 127, // l..<...6.c..
-  20, 220, 129, 251, 193, 177,  92, 102, 130,  35, 206, 180, // .......f.#..
- 214,  91, 249, 185, 220, 190, 138, 183, 230,  14,  14,  89, // .[.........Y
- 110,   0, 245, 234,   4, 241, 233,  16, 247, 159, 127,  70, // n..........F
- 176,  68, 219,  69, 182,   7,  91, 105,  35,   9,  92, 188, // .D.E..[i#...
- 167, 156, 174,  63, 253, 156,  38,  84, 143,  19,  59,  17, // ...?..&T..;.
-  30, 175, 149, 165,  71, 224, 203,  28, 189, 148, 180, 165, // ....G.......
- 100, 209, 240, 194, 206, 171, 176, 121,  66,  63,  78, 134, // d......yB?N.
-  79,   5, 101, 169,  29,  59,  71,  77, 210, 130, 178, 240, // O.e..;GM....
-  59, 162, 109, 201,  39, 229,  54,  79, 221,  32, 200, 234, // ;.m.'.6O. ..
-  41, 180, 221,  38,  50,  28, 237,  93, 230,  52,  20, 232, // )..&2..].4..
- 118,  27, 112, 188, 199,  57, 253, 100, 121, 184, 249, 143, // v.p..9.dy...
- 206,  50, 152, 183, 182,  14,  62, 106, 158, 180, 188, 161, // .2....>j....
- 251, 170, 225, 181, 162, 198, 114, 226,  18, 254, 181, 182, // ......r.....
- 205, 147, 229,  24, 169,  60,  22,  65,   9,  25,  95, 111, // .....<.A.._o
- 167, 219, 113,  56, 153,  79, 231,  99, 124, 104, 205,  51, // ..q8.O.c|h.3
- 121, 251,  23,  60,  40, 207, 109, 242, 231, 204,  71, 176, // y..<(.m...G.
- 247, 227, 168, 209, 115, 143, 187, 238,  43, 174,  60,  79, // ....s...+.<O
-  51,  68,  37, 116,  30, 248, 114, 203,  92, 206, 162, 132, // 3D%t..r.....
-  83,  98, 236,  28, 122, 224, 134, 238,  94, 239, 130,   5, // Sb..z...^...
- 114, 112, 220,  34,   1,  81, 218,  38,  10, 185, 109, 228, // rp.".Q.&..m.
- 137, 133,  92, 231,  83, 144,  78, 205, 197,  60, 116, 235, // ....S.N..<t.
- 191, 178,  99,  68, 108, 181, 138, 240, 252,  86,   1, 200, // ..cDl....V..
- 176,   4, 220, 230, 116, 250, 225, 163, 115,  23, 104,   0, // ....t...s.h.
-  73, 249, 164, 114, 123,  26, 190,  14, 230, 167, 225, 113, // I..r{......q
- 208, 107, 102, 132, 198, 243, 120, 187, 192, 167, 242,   4, // .kf...x.....
- 245,  59, 147,  97, 238,  32,   5, 148,  85, 217,  22, 169, // .;.a. ..U...
- 142,  45, 182, 238,  92, 107, 212,  51, 159, 188, 217,  80, // .-...k.3...P
-  75, 141, 114, 155,  16,  98, 216, 134,   2, 174, 103, 219, // K.r..b....g.
- 235, 240, 121, 169, 199,  28, 112, 173,  34, 162, 228,  61, // ..y...p."..=
- 119, 241, 106, 202,  27, 126, 187, 197,  85, 191, 247,   8, // w.j..~..U...
- 215, 170, 237, 182,  24,  39,  91,  87, 179, 181,  37, 231, // .....'[W..%.
- 140, 153, 190, 125,  34, 104, 126,  75,  28, 170, 196,  25, // ...}"h~K....
- 126, 185, 121,  18,  29, 144,  31, 215, 187, 223, 210,   5, // ~.y.........
- 190,   7, 188, 220,  73,  39,  71,  71, 159, 120,   9,  74, // ....I'GG.x.J
- 223, 143, 127, 224,  88, 175,  31, 131, 208,  89,   7,  37, // ....X....Y.%
- 252, 142,  17,  27, 162, 116, 158,  32,   4, 113,  30, 233, // .....t. .q..
- 119, 235, 172,  17, 219,  87, 206,   9,  91, 230,  38, 240, // w....W..[.&.
- 235,  36,  48,  95, 171, 114, 156,  11, 198, 247,  21,  33, // .$0_.r.....!
-  79,   6,  85, 105, 209,  88,  30,  90,  52, 139, 255, 240, // O.Ui.X.Z4...
- 148, 245, 216, 178,  72,  38,  16, 224,  47,  65, 183,  45, // ....H&../A.-
-  90, 144, 221, 229,  46, 191, 197,  80,  33,  89, 221, 190, // Z......P!Y..
- 223, 241, 207, 195, 142, 160, 243, 242, 177, 235, 238, 180, // ............
- 204,  97,  36,  53, 110, 168, 134, 157,  63, 173, 246, 138, // .a$5n...?...
- 216,  49,  99,  40, 195, 167, 197, 205, 195, 192,  52, 247, // .1c(......4.
- 121, 165,  44, 235, 114, 215, 220,  85,  49, 128, 214, 167, // y.,.r..U1...
-  11,  31,  63, 252,  77,  67, 199,  26, 226,  53,  39,  71, // ..?.MC...5'G
- 112, 128, 174, 210, 105, 207, 115, 112, 179, 231,  59, 184, // p...i.sp..;.
- 212, 243, 105, 192, 176, 122, 100, 160, 252, 116, 109,  33, // ..i..zd..tm!
- 249,  75, 192, 202,  87,  14,   8,  64, 177,   9,  27,  52, // .K..W..@...4
-  97,  90, 138,  29,  55, 227,  54,  15,  24,  66,  61,  53, // aZ..7.6..B=5
- 132, 240,  43,  94, 166, 253, 134,  91, 139, 116, 163, 143, // ..+^...[.t..
- 190, 124, 204,  12,  77, 150, 209, 239, 250, 153, 174, 195, // .|..M.......
- 227, 229, 137,  95, 116,  47,   0, 169,  66, 162, 133, 141, // ..._t/..B...
-  29, 252, 142, 106,  93, 131,  71, 219,   6, 136, 108, 193, // ...j].G...l.
-  88,  58, 222,   7, 104,  71,  45, 207, 107, 249, 175,  36, // X:..hG-.k..$
- 166,  26,  17, 183, 114, 151,  58, 134, 163, 145, 150, 152, // ....r.:.....
-   7, 135,  70, 216, 202, 135,   8,  72,  59, 214, 179, 205, // ..F....H;...
- 210, 216, 161,  14, 189,  62,  65,  91,  12, 195,  19,  50, // .....>A[...2
-  21, 155,  66,  38, 119, 127,  52,  72,  58,  10, 146, 193, // ..B&w.4H:...
- 243,  32,  41, 250,  55, 160, 161,   7,  30, 130, 254, 240, // . ).7.......
-  16,  82, 198, 179, 171,  48, 198,  12,  18, 209,  67, 107, // .R...0....Ck
-   2, 242, 110, 223, 174,  36,  34,  37, 241, 232,  58,  68, // ..n..$"%..:D
- 188,  36,  22, 137,   3, 170, 136,  76, 141, 136,  36, 187, // .$.....L..$.
- 136, 248,  91, 164, 146,  49,  11, 146,  86, 236, 108, 131, // ..[..1..V.l.
- 154, 112,  36, 250,  38, 177, 210,  72,  95, 115,  10, 226, // .p$.&..H_s..
-  73,  50,  77, 198, 105, 179,  21,  55,  79,  50,   8,  25, // I2M.i..7O2..
-   8, 206,  67,  60, 185, 100,  41, 154, 228, 223, 207,  91, // ..C<.d)....[
- 168, 194, 101,  35,  49,  26, 241, 100, 213, 193, 240, 242, // ..e#1..d....
- 145, 198, 254, 106, 187, 251, 250, 148,  14, 215, 211,  75, // ...j.......K
- 124, 249, 122, 205,   3, 196, 189, 245, 238,  82, 180, 232, // |.z......R..
-  90, 119, 204,  18,  13, 160,  15,  12, 167,   0, 104, 186, // Zw........h.
- 251, 250,  16,  68,  31,  26, 143,  98,  96, 134,  98,  25, // ...D...b`.b.
- 110, 156, 217, 124,  30, 174,  54, 164, 126, 179, 139,   7, // n..|..6.~...
- 166,  38, 251, 113, 211, 194, 136,  92, 231, 230, 103, 228, // .&.q......g.
- 148, 116,  29, 178,  51,  57, 110, 203,  22, 240, 158,  43, // .t..39n....+
- 188, 151, 123, 102, 100, 216, 132, 127,  64,  47, 146,   6, // ..{fd...@/..
- 215, 228, 128,  74,  28, 254, 124, 239, 226,  65,  65,  72, // ...J..|..AAH
-  38,  76, 201, 240,  86,  40, 106,  80, 154,  49, 196, 222, // &L..V(jP.1..
- 169, 173, 198,   0, 222,  26, 183,  85, 101,  92, 176, 113, // .......Ue..q
- 199, 105, 182, 106, 214, 221, 162, 200, 181, 234, 228, 199, // .i.j........
- 146, 238, 106,  87, 214,  45, 107,  49, 214,  94, 152, 140, // ..jW.-k1.^..
-  45, 136, 178,  31,  66, 241, 249, 165, 166, 116,  38,  59, // -...B....t&;
- 163, 109, 215,  30, 117,  36, 125, 244, 119, 116, 250,  99, // .m..u$}.wt.c
-  56,  91, 132, 235, 211, 152,  30, 159,  45, 222, 136, 158, // 8[......-...
- 255, 205, 150,  44, 231,  53,  34,   4, 199, 109,  89, 143, // ...,.5"..mY.
- 253,  16,  98, 151, 179,  85, 116,   2, 194, 161,  34,  76, // ..b..Ut..."L
- 246,  34, 184,  75, 162, 238, 230, 238, 242, 244,  91,  34, // .".K......["
- 240, 118, 146, 126, 209,  96,  49, 107, 196, 140,  13, 179, // .v.~.`1k....
- 109, 188,  33, 185, 136, 144, 209, 161,  36,  20, 126, 188, // m.!.....$.~.
-  13,  55,  55, 233,  98, 108, 191, 253, 235,  79, 127, 183, // .77.bl...O..
- 157, 171, 116, 241,  48,  38, 253,  82, 204,  86, 232, 106, // ..t.0&.R.V.j
- 200, 245, 146, 126, 166,  43,  37, 179, 214, 109, 182,  53, // ...~.+%..m.5
- 210, 152,  68,  25, 226,  16, 216, 145, 102,   9, 119, 214, // ..D.....f.w.
- 237, 171, 135,  77, 120, 174,  17, 244, 115,   0,  29,  29, // ...Mx...s...
-  61,  15,  55, 199,  38, 134,  68,  54, 203, 150, 180, 205, // =.7.&.D6....
-  34, 245,  25, 218, 206, 157,  95,  98, 147, 210, 147,  68, // "....._b...D
- 165, 156, 176, 122, 101, 242, 179,  31,  29, 229, 135,  18, // ...ze.......
-  31, 138, 177, 150,  51, 153,  40, 252, 197,  64,  33, 229, // ....3.(..@!.
- 121,  63, 183,   9,  45, 190, 144,  66,  80, 113, 229, 144, // y?..-..BPq..
- 126, 194,   4,   3, 132,  48, 102,  57,  40,   7, 132, 254, // ~....0f9(...
- 156, 255,  64, 245, 134, 104, 202, 225,  58,  34, 152,  77, // ..@..h..:".M
- 141,  69, 123, 153,  60,  61,  45, 242, 241, 153, 161,   1, // .E{.<=-.....
-  13,  52,   7, 112, 174, 204,  20,  32,   9,  25,  60,  48, // .4.p... ..<0
-  46, 131,  13, 194, 142, 237,  20, 187, 201, 190,  47, 153, // ........../.
-  50, 235,  93, 205,  38, 201,  84, 199, 155,  31, 242,  57, // 2.].&.T....9
- 221, 147,  25, 126, 139,  55,   2, 203, 118,   7, 152, 107, // ...~.7..v..k
- 110, 129,  75, 100,  26, 226, 107, 115,  99,  24, 166, 198, // n.Kd..ksc...
-  80, 133,  94, 122, 210, 156,  30, 208, 122, 136,  27, 213, // P.^z....z...
- 213,  15, 238, 166,  80,  67, 107, 170, 139, 113, 221, 229, // ....PCk..q..
- 151, 213,  48,  47, 244, 163,  95, 117, 255, 166, 187,  93, // ..0/.._u...]
-  77, 165,  25, 215,  71, 246,  58, 186, 189, 182, 178, 245, // M...G.:.....
-  92, 156,   6, 198,  21, 162,  60, 186,  58, 144, 146, 103, // ......<.:..g
- 224,  43, 104,  71,  18, 232, 163,  20, 209, 227, 106, 143, // .+hG......j.
-  10,  17,   3,  38, 176, 183, 173, 116, 185, 180, 157,   4, // ...&...t....
-  71, 194, 128, 145, 124, 149,  25,  61, 231, 223,  21,  55, // G...|..=...7
-  50, 178, 240, 218, 250, 233, 177,  51,  11, 108, 254, 164, // 2......3.l..
- 152, 116,  81,  91, 190,  21,  38,  33, 101, 255, 201, 133, // .tQ[..&!e...
- 205,  55,  15, 182, 199,  54, 253,  46,   3, 241, 117, 193, // .7...6....u.
-   7, 102,  19,  19, 181, 115, 103, 144,  77, 220, 179, 240, // .f...sg.M...
- 131, 221, 232, 177, 132, 224, 112, 174, 245,  52,  14, 103, // ......p..4.g
- 120, 142, 132, 252, 226,  42, 214, 124,  43, 159, 224,  49, // x....*.|+..1
-  97, 167,  37, 217,  41, 246,  98, 181, 186,  55, 167, 164, // a.%.).b..7..
- 186,  28,  72,  89, 244,  37,  74, 168,  63, 231,  62, 120, // ..HY.%J.?.>x
- 152,  26, 167, 156,  68, 211, 191, 162,  43, 114,  83, 206, // ....D...+rS.
- 191, 208, 121,  50, 187, 139, 174, 103,   8, 247, 197,  28, // ..y2...g....
-  48,  71, 184,  11, 141, 169, 183, 108, 104,  54, 113,  19, // 0G.....lh6q.
- 220,  70, 237, 115, 184, 246, 136, 255,  33, 104, 214,  44, // .F.s....!h.,
-  74,  50, 118, 114,  72, 190, 121, 132, 118, 203, 155, 249, // J2vrH.y.v...
-  92, 142, 139, 243, 236, 163,  72, 222,  39, 110,  67, 142, // ......H.'nC.
- 149, 107,  30,  62,  55, 185,  27, 144,  22, 136,  22, 157, // .k.>7.......
-   3,  29,  29, 219, 171, 123, 187, 168, 115,  86, 143, 205, // .....{..sV..
- 116, 223, 158,  19,  83, 222, 132,  26, 136, 169, 148, 128, // t...S.......
-  71,  39, 114, 116, 116, 209,  72, 145, 169,  86, 206,  57, // G'rtt.H..V.9
- 115,  32,  13,  35,  92, 111, 190, 225,  56,  42, 116, 147, // s .#.o..8*t.
- 204, 141, 180, 232, 226, 101,  37, 219, 220,  25, 226,  96, // .....e%....`
- 221,  17,  51,  66, 150,  66, 116, 249,  19,  75, 133, 127, // ..3B.Bt..K..
- 134, 179, 207,  23, 179,  85,   1, 192, 191, 243, 192,  56, // .....U.....8
-  17, 151, 177, 247, 101,  51,  35, 134, 238, 102,  31, 111, // ....e3#..f.o
-  48,  17, 199,  62,  78, 240, 219, 180,  79, 163,  23, 193, // 0..>N...O...
-  79, 154,  43, 154, 227,  25, 241, 140, 219, 133, 214,  23, // O.+.........
-  57,  63, 105, 254, 232, 168, 233, 184, 147, 205, 211, 147, // 9?i.........
-  59,  65,  22, 157,  73, 250, 244, 148,  76, 214,  83,  44, // ;A..I...L.S,
-  88, 220,  28, 127, 230,  31,  25, 217, 207, 229, 145,  57, // X..........9
- 127, 174, 156, 189,  13,  30,  87, 200, 208, 125, 135,  40, // ......W..}.(
- 107,  59, 231,  77, 240,  72, 132, 244, 214, 153,  75, 202, // k;.M.H....K.
- 113,  92,  43, 166, 242,  77,   1, 227,   3, 158, 224,  16, // q.+..M......
- 119, 166, 111, 198, 111,  75,  43, 247, 109, 249, 137,  67, // w.o.oK+.m..C
-  14, 225,  67,  15, 253,  88,  91,  74,  56, 178, 105, 150, // ..C..X[J8.i.
-  42,   0, 221, 251, 193,  82, 254,  76, 130,  70, 130, 200, // *....R.L.F..
-  95, 155,  34,  91, 158,  68, 231,  35, 173, 113, 226, 157, // _."[.D.#.q..
-  54, 195, 201, 230,  67,  26, 172, 167, 241, 113,  50, 153, // 6...C....q2.
- 120, 227, 239,  27,  13,  58, 106, 146, 154, 252, 113,  26, // x....:j...q.
-   7,  41,  41, 160, 105, 158, 156, 176, 133, 120,  83,  84, // .)).i....xST
-  61, 249, 216,  10,  73, 157, 140, 139, 193, 252, 103,  49, // =...I.....g1
- 152,  60, 106,  88, 224,  33, 209,   0, 169,  93, 167, 233, // .<jX.!...]..
-   4, 120,  20,  79, 168, 169, 244,  56, 224, 176, 248,  26, // .x.O...8....
-  69, 241,  67, 106,   2,  30,  89, 121,  55, 173,  82, 252, // E.Cj..Yy7.R.
- 251, 247, 117, 124, 133, 160, 230, 104, 139,   9, 199,  56, // ..u|...h...8
- 151, 136, 214,   8,  61, 159,  78,  27, 225,  43, 164, 102, // ....=.N..+.f
-  56,   9, 104,  93,  27, 225,   9, 142, 233,  66,  83,  84, // 8.h].....BST
- 130, 136, 244, 232,  32, 136, 167,  97,  58,  14, 215, 196, // .... ..a:...
- 154,  26, 252, 200, 247, 227, 191,  53,  27,  81, 227, 127, // .......5.Q..
- 144,  18,  13,  54,  51, 174, 174, 167, 127,  27, 127,  47, // ...63....../
-  87,  55, 184, 186,  13, 194, 184,  17,  59, 179,  38,  49, // W7......;.&1
-  45,  62,  42,   2,  44, 115, 147, 156, 134, 102,  70,  37, // ->*.,s...fF%
-  85, 132, 177, 221, 154,  53, 129, 113, 200, 143,  48, 199, // U....5.q..0.
- 149, 185, 211, 202, 208,  14,  45, 129, 143,  17, 144, 162, // ......-.....
- 177, 125,  69,  20,  21, 204,  95, 173,  49, 208,  32, 124, // .}E..._.1. |
- 160,  73, 110,  57,  97, 207,  93, 131, 196,  20,  92, 254, // .In9a.].....
-  52, 235,  82, 190, 228, 191, 212, 161,  80, 128, 165,  20, // 4.R.....P...
- 221,  18, 177, 227,  82,  78,  93,  79, 253,  11,  96,  82, // ....RN]O..`R
- 164, 142, 119,  65, 158,  15,  71,  71, 121, 115, 113, 195, // ..wA..GGysq.
- 132, 135,  91, 132, 119, 209,  60, 124,  27, 221, 135, 241, // ..[.w.<|....
- 143, 208,  60,  78, 195,  23, 146, 236,  60,  72, 144, 212, // ..<N....<H..
- 243, 219, 198,  39, 230,  40, 206,  55,  56,   8,  88,  62, // ...'.(.78.X>
-  94,  32, 219,  90, 227, 178,  65,  70,  74, 139,  69, 248, // ^ .Z..AFJ.E.
- 150,  63, 122, 128, 145, 208, 106, 187, 174, 183,   3, 199, // .?z...j.....
- 109,  90, 179, 100,  97,  53, 200, 128, 169, 215,  57,  46, // mZ.da5....9.
- 234,  92,  54, 209, 244,  21,   7,  95,  68, 203, 140, 242, // ..6...._D...
-  13, 206, 131, 182, 205,  72, 130, 200, 249,  29, 193, 110, // .....H.....n
- 167, 122, 221,  63, 131, 199,  91,   4,  68, 232,  56,  43, // .z.?..[.D.8+
-  82, 223, 219, 222, 206, 121,   7, 186,  92, 140,  93,  39, // R....y....]'
-  75, 151, 202, 182, 185,   6, 209, 232, 119,  84, 153,  12, // K.......wT..
- 169, 119, 108,  70, 189,  43, 209, 231, 127,  23, 208,  52, // .wlF.+.....4
- 136, 253, 115,  35, 110,  78, 255, 170, 252, 115, 220, 120, // ..s#nN...s.x
- 215, 166,  70,   9, 127, 222, 181, 209,  44,  33, 177,  43, // ..F.....,!.+
-  77, 191, 107, 163, 241, 160, 243, 234, 197, 139, 196, 145, // M.k.........
- 234, 223, 149,   3, 165, 254,  80,  97, 125,  18,  59,  52, // ......Pa}.;4
- 156,  34, 213, 116,  94, 197, 116, 146, 103,  35, 161,  49, // .".t^.t.g#.1
-  34, 227,  30,  60,  53, 132, 214,  63,  52,  18, 244, 237, // "..<5..?4...
- 184, 240, 232, 252, 208,  72, 205, 201, 140, 239, 220, 204, // .....H......
- 214,  11, 167,  21, 206, 128, 170, 184, 201, 231,  56, 221, // ..........8.
- 242, 109,  12, 150,  79, 231, 124, 151,  79, 185, 246, 146, // .m..O.|.O...
- 111,  99, 236, 104, 107, 197, 119, 205, 217,  34, 216, 180, // oc.hk.w.."..
-  66, 146, 175,  97, 218,  88,  32, 243,  18, 241,  76, 144, // B..a.X ...L.
- 131, 195, 216,  79, 146, 149,  78, 210, 198, 117, 179, 117, // ...O..N..u.u
- 131, 128, 213,  97, 107,  52,  89,  60,  61, 221,  78,  60, // ...ak4Y<=.N<
-  23, 108, 119,  65,   6, 169, 251,   2, 136,  71,  37, 182, // .lwA.....G%.
-   9,  22,   1, 170,  56, 132, 231, 203, 163, 163,  45, 221, // ....8.....-.
-   1,  93, 172, 129, 129, 116, 105, 117, 116,  52, 127,  17, // .]...tiut4..
- 180, 248,  90, 132,  92, 199, 178, 168, 159,   2, 106, 241, // ..Z.......j.
- 250, 233,   9, 158, 220,  59,  80, 152, 231,  58, 223, 163, // .....;P..:..
- 211,  79, 160, 154,   7, 144,  16,  40, 164, 245, 233,  85, // .O.....(...U
- 131, 176, 122,  49,   5, 166,  79, 219, 222, 216,  27, 175, // ..z1..O.....
- 155, 206, 221,   9, 141, 196,  25,  53,  73, 124, 111,  39, // .......5I|o'
-  33,  53, 242,   2,  61,  55,  58, 244, 243, 244, 244,  48, // !5..=7:....0
- 225,  24, 144,  62, 159, 108,  39,  15, 205, 105,  56,  35, // ...>.l'..i8#
-  83, 238,  10, 115, 156,  57, 247,  19, 162, 137, 112,  18, // S..s.9....p.
- 220,  79, 239, 199,  97, 216, 184, 119,  30, 168, 187,  47, // .O..a..w.../
- 220,  29, 145, 225, 113, 169, 187, 141, 116,  23, 253,  47, // ....q...t../
- 107, 111, 222, 216, 182, 173, 244,  11, 255, 223,  79, 225, // ko........O.
- 232, 248, 228,  33,  35,  72, 150, 228,  56,  73, 169, 210, // ...!#H..8I..
- 186, 137, 179, 182, 217, 157, 164,  73, 117, 124,  93,  90, // .......Iu|]Z
- 130, 108,  38,  20, 169,  82, 148, 151, 216, 250, 238, 239, // .l&..R......
- 252, 102,   0,  18, 148, 229, 180, 231, 185, 111,  23, 139, // .f.......o..
- 196,  78,  96,  48, 152,  25, 204, 226, 116, 247,  42,  44, // .N`0....t.*,
- 118,  71, 220, 221,  76, 186, 155,  93,  93, 141, 118, 207, // vG..L..]].v.
-  76, 119, 244, 114, 182,  59, 242,   7, 244, 173, 193,  72, // Lw.r.;.....H
- 125,  11, 169, 249, 185,  58, 219, 125,  69, 103,  41,  97, // }....:.}Eg)a
- 194, 193, 171, 128,   6, 240,  74, 157, 149, 162, 222, 141, // ......J.....
- 163,  48, 252,  70, 147,  24, 134,  71, 212, 192,  55, 176, // .0.F...G..7.
- 252, 132,   3, 142, 212, 183,   3,  62, 152, 190, 240,  81, // .......>...Q
- 244,  34,  45, 146, 246, 235, 197, 244,  72, 231,  79, 233, // ."-.....H.O.
- 132, 139,  10, 143, 200, 147, 118,  66, 164, 205,   2, 148, // ......vB....
- 110,  67, 167, 173, 143, 251,  68, 193,  61, 131, 212, 249, // nC....D.=...
-  11, 194, 237,  76,  89, 244, 173,  62, 177, 100,  64, 253, // ...LY..>.d@.
-  22, 126, 106, 191, 125, 161, 254, 162, 159, 232, 104, 174, // .~j.}.....h.
- 126, 165, 223,  73, 146, 101, 185, 250,  76,  79, 204, 149, // ~..I.e..LO..
- 171, 119, 244,  52, 210, 113, 130,  32, 242, 159,  24,  50, // .w.4.q. ...2
- 117, 129,   7,   2,  77,  98,  49,  63, 181, 103,  68,  39, // u...Mb1?.gD'
- 233, 148,  30, 160, 208, 168, 116,  70,  79,  73, 118,  76, // ......tFOIvL
- 235,  69,  20,  57,  63, 246, 148, 142,  67,  64, 120, 216, // .E.9?...C@x.
-  37,  34, 159,  58, 154, 199,  41,  49,  94,  91,  68,  62, // %".:..)1^[D>
- 232,  40, 236, 110, 185,   1, 108, 230,  14,  27, 209, 109, // .(.n..l....m
- 122, 157,  43,  90, 114,  79, 255,  95, 189, 187, 187, 221, // z.+ZrO._....
- 245,  91, 158, 252, 214, 220,  16,  47, 236, 222, 177, 219, // .[...../....
-  86, 123, 124, 194, 131, 135, 116, 203, 141, 156,  96, 178, // V{|...t...`.
- 107, 156,  72,  15, 116, 192, 126, 108,  37, 190, 206,   4, // k.H.t.~l%...
- 211, 165, 149, 158, 133, 134,  53, 161,  45,  52, 102, 231, // ......5.-4f.
- 160,  18,  51, 246,  36,  20,  46,  80, 233,  99,  91,   2, // ..3.$..P.c[.
- 167, 142, 210,  83, 174,  72, 208, 162, 186, 119, 221,  56, // ...S.H...w.8
-  70, 135, 245, 104, 187,  83,  15, 101, 166,  60,   9, 254, // F..h.S.e.<..
- 157,  98,  37, 232, 109, 189, 228, 187,  27,  10,  94, 172, // .b%.m.....^.
-  22, 252, 245, 134, 130, 231,  60, 247,  29, 241, 225, 191, // ......<.....
-  95,   5, 250, 220, 208, 230, 234, 172, 219, 185, 115, 167, // _.........s.
- 176,  80, 247, 153,  78, 204, 228, 142, 215, 109,  10,  84, // .P..N....m.T
- 181, 159, 188, 221, 127, 241, 242, 205, 107, 223, 223,  74, // ........k..J
- 100, 110, 142,  24, 240, 106, 116, 154,  62, 171,  38, 215, // dn...jt.>.&.
-  67,  32,  66,  93,  94,  25, 180,  27,  62,  29,  55,  28, // C B]^...>.7.
- 112, 206,  74, 238, 170, 106, 175,  86, 143, 176, 225,   1, // p.J..j.V....
- 161, 187,  84, 132, 119, 103, 126, 121, 155,  16, 135,  68, // ..T.wg~y...D
- 236, 238, 198, 125,  56, 183,  55,  87,  39, 127, 121,  49, // ...}8.7W'.y1
- 135, 124, 161, 143,  75, 132, 158,  43, 124, 231, 246, 161, // .|..K..+|...
- 211,  79, 237, 237, 134, 238, 107,  91,  45,  10, 211, 161, // .O....k[-...
-  62, 184, 147, 224,  80, 167, 227,  25, 228,  95,  76, 152, // >...P...._L.
- 184, 227,  55, 189, 156,  50, 232,   5,  63, 244, 174, 248, // ..7..2..?...
- 216, 142, 112, 170, 103, 114,  89,  65,  71, 177,  62,  98, // ..p.grYAG.>b
- 226, 113,  65, 169,  75, 235,  60,  63, 147,  57, 249, 198, // .qA.K.<?.9..
- 209, 133,  95, 114,  92, 225, 189, 112,  88,   6,  48, 165, // .._r...pX.0.
- 215, 205, 176, 118, 147, 169, 244, 126, 104, 102,  54, 158, // ...v...~hf6.
- 211, 238, 213, 196, 233,  57,  19, 249, 193, 129, 210, 107, // .....9.....k
- 247, 152, 206, 204, 125, 175, 174, 109,  37, 170, 129,  33, // ....}..m%..!
- 157,  28,  54, 161, 242,  66, 220,  47,  66,  57, 118, 136, // ..6..B./B9v.
-  20, 164, 191, 114, 105,  91,   6,  61,  89, 141,  74,  85, // ...ri[.=Y.JU
- 163, 244,   9, 139, 219, 171,  95, 103,  28,  38,   6, 149, // ......_g.&..
- 185, 253,  37, 130, 251, 173, 245, 240, 249, 102, 226, 125, // ..%......f.}
- 140, 211, 226,   1, 127, 171, 187,   1,  30,  50,  16, 234, // .........2..
- 239, 190, 227, 241,  22,  17, 133, 237, 153, 135,  24, 142, // ............
- 233,  24, 242,  22, 251,  37, 166,  72, 138, 184,  72,  30, // .....%.H..H.
- 226,   7,  39,  50, 147, 101, 144, 194, 106, 189,  83,  90, // ..'2.e..j.SZ
- 111, 155, 186, 155, 246,  83,  90, 111, 246,  37, 140,  94, // o....SZo.%.^
- 233,  23,  92,   6, 251, 233,  76, 202, 136, 126, 126, 233, // ......L..~~.
- 184,  83, 215, 220,  19, 191, 245, 157,  50, 253,  50, 150, // .S......2.2.
-  31,   6,  90, 247, 126, 204,  11, 190, 218,  75, 223, 246, // ..Z.~....K..
-  82,  58, 211, 118,  38, 247,  81, 181, 100, 101, 132, 185, // R:.v&.Q.de..
- 242,  11, 104,  19, 246,  45,  45, 190, 155,  72, 144,  74, // ..h..--..H.J
- 199,  89, 111, 205, 235, 103, 234,  99, 249, 225,  21, 116, // .Yo..g.c...t
- 128,  70, 233,  65, 209,  16, 224, 203, 214, 247,   3, 102, // .F.A.......f
- 240, 236, 171,  93,  99, 179,  98, 143, 195, 117,  94,  64, // ...]c.b..u^@
- 235,  14, 178,   7, 180,   2,  70,  44,  83, 201, 170, 140, // ......F,S...
-  44, 204,  15, 234, 101, 149, 126,  31,  14,  27, 191,  70, // ,...e.~....F
- 233,  34, 202,  47,  26, 170, 241,  84,  31, 229, 230, 241, // ."./...T....
-  21, 236,  18, 232, 247, 225,  44, 143,  19, 126,  71, 234, // ......,..~G.
- 175, 139,  84, 243,  79, 130, 183, 135, 139, 227,   5, 188, // ..T.O.......
- 106,  55, 246, 245, 172, 208, 216,  18, 244, 252, 134,   0, // j7..........
-  86, 158,  94,  19, 195,  99,  18,  31, 235, 145,  60, 210, // V.^..c....<.
- 151,  62, 167,  46, 247, 233,  51, 184, 193,  87, 153, 121, // .>....3..W.y
- 248, 176, 208, 115, 121, 250,  93, 143,  83, 251, 252, 225, // ...sy.].S...
- 100, 145, 155, 199, 167, 121,  44,  15, 251,  17,  77,   9, // d....y,...M.
-  30,  93, 239, 247, 127, 212, 226, 148, 203, 242, 119, 212, // .]........w.
- 182, 176, 128, 250,  69, 168, 159,  11,  78, 250, 131, 176, // ....E...N...
- 192, 239, 161, 126,  95, 189,  17, 173, 249, 138, 254,   9, // ...~_.......
- 244, 123, 197,  63, 191, 171, 223, 233, 159,  64,  63,  87, // .{.?.....@?W
- 252, 243, 194,  13, 247, 254, 212, 193, 146, 221, 206, 174, // ............
-  30,  52,  58, 208,  25, 241, 155, 102, 125, 190, 134, 151, // .4:....f}...
-  95, 232, 159, 128, 175,  87, 105,  87,  61, 165, 157, 240, // _....WiW=...
-  69,  71, 240, 218,  46, 169, 222,  74, 114, 147,  67, 167, // EG.....Jr.C.
- 243, 104, 123, 190, 226, 113, 216, 243, 170, 141, 183,  33, // .h{..q.....!
- 151, 167,  73,  42,  78,  60, 255,  64, 173, 230,  95, 203, // ..I*N<.@.._.
- 230, 158, 159, 122, 110, 114, 179,  75,  13, 151,  35,  42, // ...znr.K..#*
-  19, 213, 227, 199, 110, 225, 199,  28, 131, 215,  87, 143, // ....n.....W.
- 203, 146, 146,  34, 147,  81, 246, 137, 183, 161, 201, 190, // ...".Q......
-  64, 151, 171, 185, 181, 204, 231, 207, 221,  46, 158, 103, // @..........g
- 180, 150, 232, 227, 121, 217, 135,  73,  82,  39, 129, 171, // ....y..IR'..
- 223,  81, 101,  56, 108,  80,  49, 232, 246, 130,  98, 183, // .Qe8lP1...b.
- 219,  27,  20,  45,  60,  17, 183, 254,  16, 181, 186, 189, // ...-<.......
-  90,  83, 131, 198, 195,  87, 180,  36, 111,  95,  53,  84, // ZS...W.$o_5T
-  20, 173, 205, 143, 166, 136, 126,  13,  65, 214, 250, 108, // ......~.A..l
- 228,  54, 212, 116,  90, 155, 202,  56,  93,  20, 154,   7, // .6.tZ..8]...
-  63, 173, 166, 210,  38,  42, 104,  66,  84, 133, 247,  53, // ?...&*hBT..5
-  97, 238,  49,  23, 158, 151, 133, 203,  68,  69, 188,  59, // a.1.....DE.;
- 127,  45, 199,  73, 238,  87, 192, 228, 153,  79, 127,  21, // .-.I.W...O..
-  39,   9, 237,  93, 219,   6, 129,  24, 193,  24, 145, 142, // '..]........
- 187,  69,   9, 109, 197, 210,   5,  74, 195, 158,  20,  32, // .E.m...J... 
- 213, 245, 199, 210, 173, 250,  16, 145, 113, 183, 254, 115, // ........q..s
- 233,  13, 163, 214, 247, 131, 166, 255, 159, 229, 213, 240, // ............
- 255,  94,  30,  52, 183, 142,  99,  27, 140,  33, 107, 235, // .^.4..c..!k.
- 115,  38, 171, 250, 126,  42, 135, 100, 227, 146, 208,  74, // s&..~*.d...J
-  66, 220,  38, 253,  55, 208,  95, 135,   9, 212, 103,   2, // B.&.7._...g.
-  36, 148, 107,  97,  87,  42,   9,  27, 141, 202, 151, 184, // $.kaW*......
- 123,  94,  67,  28,  64, 248, 187,  25,  94,  59,   0,  83, // {^C.@...^;.S
-  68,  26, 199, 159,   0, 127, 120, 220,  21, 162, 149,  45, // D.....x....-
- 244,  38, 244,  74, 178,  24,  32,   8,  65, 186,  16, 198, // .&.J.. .A...
- 190,  69, 103, 227,  55, 162,  58,   4, 180,  70, 185, 127, // .Eg.7.:..F..
- 100,  41,  17, 122,  95, 152, 110, 251,  55, 113, 250,  68, // d).z_.n.7q.D
- 211,  61,  11, 135,  93, 213,  83, 189, 246, 142, 218,  57, // .=..].S....9
- 224, 200,  22, 175, 192, 127, 180, 186, 247,  20, 114, 125, // ..........r}
-   4, 207, 144, 164, 142, 162,  52,  78, 249,  11, 161,  10, // ......4N....
- 108,  24, 226,  47, 148, 240, 107, 168,  63, 225,  16,  30, // l../..k.?...
- 129, 222, 254,  13,   1,   5, 194,   6, 111, 239, 101,  67, // ........o.eC
- 233, 119,  97, 227,  63,  41, 145,  73, 159, 149, 238,  80, // .wa.?).I...P
- 242, 171, 229, 214, 229,  99, 164, 119,  77,  58, 117, 211, // .....c.wM:u.
-  11, 117, 183, 217, 216, 186, 148,  10, 219,  84,  42, 138, // .u.......T*.
- 240, 116, 143, 158,  78, 150, 193, 229, 116, 186, 164, 130, // .t..N...t...
- 219,  74, 223,  53, 117, 104,  32,  59,  97,  35, 184, 156, // .J.5uh ;a#..
- 207, 151,  13, 103, 125,  31,  84, 199,  14, 107, 199,  16, // ...g}.T..k..
- 209, 116, 175, 115, 167, 160,  37, 166, 159, 132,  22, 185, // .t.s..%.....
- 119, 247,  78,  74,  84, 215, 118, 231,  78,  70, 236, 229, // w.NJT.v.NF..
- 246, 189, 157,  59,  86, 232,  50, 132, 228, 131,  40,  99, // ...;V.2...(c
- 243, 169, 219, 248,  82, 231,  27,   3,  51,  45, 219,  50, // ....R...3-.2
-  43, 190, 253, 218,  97, 161, 118, 168, 131,  46, 122, 233, // +...a.v...z.
- 226, 105,  27,  79,   9,  37,  38,  72,  76, 144, 152,  32, // .i.O.%&HL.. 
-  17, 122,  11,  61, 234, 124, 155, 254, 199,  32, 238, 209, // .z.=.|... ..
- 255,  15, 232, 255,  46,  18,  51, 202, 202,  40,  43, 163, // ......3..(+.
- 172, 140, 234, 102, 148, 157, 169, 251, 244, 255,   3, 250, // ...f........
- 255, 103, 250, 191, 139,  17, 119, 145, 147,  83, 217, 156, // .g....w..S..
- 202, 230,  84,  54, 167, 114, 185, 138,  41,  37, 166,  90, // ..T6.r..)%.Z
-  49,  74, 209,  11, 158, 118,  58, 252,  74, 127,  15, 136, // 1J...v:.J...
- 145,  26, 198, 180,  36, 202,   9,  53, 191, 230,  79, 247, // ....$..5..O.
-  64,  13, 123, 232, 174,   1,  36, 207,  11, 247, 227, 194, // @.{...$.....
- 153, 194, 210, 253,  77, 161,  84,  97,   5, 101, 241, 122, // ....M.Ta.e.z
- 146, 172, 187, 235,  10,  82, 250, 189, 191,  41,  66,  44, // .....R...)B,
- 199,  14,  21, 105,  54,  54,  24,   2,  76, 201, 250, 235, // ...i66..L...
- 221, 170,  56,  65, 250,  78, 179, 209, 190,  36,  44, 130, // ..8A.N...$,.
- 175, 249, 135, 245,  14, 170, 232, 230,  37, 195,   1, 226, // ........%...
-  88,  45, 212,  72,  77, 212, 204, 198,  49,  24,   3, 107, // X-.HM...1..k
- 156, 132, 147, 221,  48,  86, 199, 248, 201, 111, 223, 142, // ....0V...o..
- 119,  39, 106,  26,  22, 160, 159,  15,  65,  83,  79,   9, // w'j.....ASO.
-   2, 183, 137, 103,  14, 139, 216, 155, 174,  28, 114,  39, // ...g......r'
- 131,  78,  48, 117, 142,  25, 117, 124, 117, 117,  50, 232, // .N0u..u|uu2.
-  74, 154,  61,  98, 152, 247,  63, 229,  86,  64,  33, 162, // J.=b..?.V@!.
- 136,  37, 122, 143,   7, 147, 173,  60, 232,  16, 104, 159, // .%z....<..h.
- 208,  19,   2, 153, 102, 225,  97,  24,  94,  12,  14,   3, // ....f.a.^...
- 170,  67,  29, 158, 174,  28, 159, 169,  58, 117,  79,  53, // .C......:uO5
- 250,  86,  95, 134,  23,  49, 143, 195,  93, 126, 246, 178, // .V_..1..]~..
-  45, 205, 114, 192, 104, 101, 184,  11,  73,  49, 181,  75, // -.r.he..I1.K
- 100, 150,  19,  50,  27,  65, 170, 153,  91,  34,  46, 198, // d..2.A..["..
- 199, 206, 155,  41, 193, 229, 162, 153, 208, 223,  46, 122, // ...).......z
- 136,  91,   5, 184, 192, 152, 123, 244, 251,  94, 134,  15, // .[....{..^..
- 243, 154, 113,  51, 146,  65, 248, 144,  37, 140,   5, 177, // ..q3.A..%...
- 102, 190, 227, 198,  63,  15, 179, 221, 201,  96,  18,  96, // f...?....`.`
- 187,  94,  52, 137, 237,  91, 248, 173,  95,  33,  24, 105, // .^4..[.._!.i
-  18, 243, 120, 216, 186,  80, 185, 223,  55, 245,  98, 145, // ..x..P..7.b.
- 166, 156, 208,   2, 196, 144, 227, 156,  56, 135,  85, 243, // ........8.U.
- 164, 118,  12, 109,  37, 146,  80,  30,  53,  91,  41,  45, // .v.m%.P.5[)-
- 220, 132, 254, 158, 134, 179, 173, 168,  29, 157, 235,  57, // ...........9
- 226, 148,  31, 206, 103, 209, 200, 132, 114, 161, 207, 244, // ....g...r...
-  98,  12,  59, 110,  78, 104, 251, 121,  93, 208, 237, 244, // b.;nNh.y]...
-  45, 144, 229,  78, 119, 187, 246, 198, 246,  87, 124, 231, // -..Nw....W|.
- 113, 115, 170, 238, 249, 254, 191, 123, 119,  17,  81, 132, // qs.....{w.Q.
- 134, 227,  12, 165,  69, 156, 232, 110, 151, 163,  92, 180, // ....E..n....
- 104, 110, 226,  86, 152,  16,   6,  32, 214, 154,  42, 113, // hn.V... ..*q
- 141, 246, 125,  48, 213,  94, 220,  26,  15, 199, 149, 194, // ..}0.^......
- 157, 191,  69, 189, 250, 119,  78, 203, 105, 138,  13,  89, // ..E..wN.i..Y
-  95, 189, 154, 227,  97, 188,  92, 178, 212, 100, 168, 127, // _...a....d..
-  86, 250, 190,  42,  52, 209, 200,  15,  60, 234, 106,  88, // V..*4...<.jX
-  20, 170,  72,  84, 145, 114,   2, 196, 144,  14, 211,  82, // ..HT.r.....R
- 100, 117,  22, 187, 210, 125,  99,  13,  44,   9, 130, 208, // du...}c.,...
- 225,   8,  26,  15, 248, 175, 225, 178,   6,  73,  80,   0, // .........IP.
- 117, 166,  28, 182,  77,  15,  31,  28,  80, 138, 166, 179, // u...M...P...
- 176, 153, 212, 100,  23,  69, 238, 182, 239,  37, 114, 211, // ...d.E...%r.
-  65, 188, 172, 217,  79, 206,  22, 131,  68, 174, 228, 144, // A...O...D...
- 226,  93, 106, 148, 206,  84,  98, 140, 134, 149,   0, 191, // .]j..Tb.....
- 140, 124, 157,  90,  69,  85, 203,  11, 226,  62,  29,  82, // .|.ZEU...>.R
- 197,  58, 248, 102, 146,  98, 247,  90,  46, 175, 134, 110, // .:.f.b.Z...n
- 139, 229, 173, 164, 176,  76, 217, 146, 102,  57, 150, 132, // .....L..f9..
- 138,  46, 153, 134, 233, 173,  48, 186, 125, 123,  60, 236, // ......0.}{<.
-  17, 183, 159, 221,  10, 231, 120, 222, 166, 231, 252,  22, // ......x.....
-  46, 181, 199, 195, 187, 244,  28, 223,  10,  71, 120, 222, // .........Gx.
- 161, 231,  19, 150, 202, 141, 135, 247, 232, 249, 152,  69, // ...........E
- 102, 227, 225, 125, 122,  30,  15, 171,  79, 161, 125,  72, // f..}z...O.}H
-  27,  47, 163, 173, 150, 171,  17,  97, 149,  73, 120, 162, // ./.....a.Ix.
- 102, 225, 177, 154, 122,   9,  71, 224, 168, 166,  50,  94, // f...z.G...2^
-  17,   3, 149, 251,  87, 146, 157, 146, 209, 186,  73,  55, // ....W.....I7
- 146,  29,   8, 250,  27, 173,  86, 131, 214,  79, 131, 231, // ......V..O..
-  92, 210,  17, 215,  83, 173, 157, 109,  69, 255, 209, 184, // ....S..mE...
- 100,  59,  21, 243, 240, 114, 126, 146, 157,  33, 182,  78, // d;...r~..!.N
-  34, 183,  63,  42,  38, 218, 130, 186,  11, 110, 117,  21, // ".?*&....nu.
-   7, 251,   8,  36,  98, 150, 130, 135, 102, 157, 207, 131, // ...$b...f...
- 178, 130, 168, 193, 244, 148, 209,  95,  91,  23, 251,   2, // ......._[...
-  65,  72, 242,  88,  35, 240,  67,  21, 149, 137, 235,  13, // AH.X#.C.....
- 146, 182, 212, 227, 226,  65, 210, 158, 101,  49,  66, 152, // .....A..e1B.
- 219,  76, 243, 234, 150,  97, 253,  14, 184,   4,  76,  86, // .L...a....LV
- 250, 170, 216,  29, 219,  25, 206, 246, 132,  51, 151, 106, // .........3.j
-  12, 123, 213,   6, 125,  84,  60, 110,  44,  85,  60,  62, // .{..}T<n,U<>
-  23,  97,  55,  61, 204, 229, 137,  85,   2, 230, 193, 240, // .a7=...U....
-  96, 169, 138,  69,  56,  36,   2, 193,  97, 168, 138, 145, // `..E8$..a...
- 149, 236,  32,  38, 246, 165,  67, 251,  65,  50, 220,  22, // .. &..C.A2..
- 235,   4, 218,  47,  28,  37, 158,  53,  20,  88,  84, 204, // .../.%.5.XT.
-  97, 160, 156, 165, 154, 220, 212, 202, 250, 138, 188,  54, // a..........6
- 179, 106, 109, 206, 241, 231, 130,  87,   9,  54, 162, 188, // .jm....W.6..
-  52, 167, 245,  41, 119,  32, 166,  88, 224, 154, 132, 208, // 4..)w .X....
- 193,   2, 247,  35, 132,  19,  22,  75,  37, 243, 105,  22, // ...#...K%.i.
- 111, 253,  82, 141, 104, 135, 100, 185, 153, 121,  26, 233, // o.R.h.d..y..
- 166, 217,  61, 243, 248, 187, 172,  64, 255, 165,   7,  16, // ..=....@....
-  35, 252, 139,   7, 108, 239, 190, 200, 162,  90,  94, 188, // #...l....Z^.
- 213, 147, 236,   6, 129, 201, 113, 156, 190, 228, 155, 241, // ......q.....
-  72,  74, 154, 180,  15, 217,  12,  73, 125,  81, 234,  50, // HJ.....I}Q.2
- 112, 192,  67, 143,  75, 234, 151, 246,  26, 215,  56, 226, // p.C.K.....8.
- 152, 188, 191, 203, 253,  59,  66,  76,  46,  21, 134, 241, // .....;BL....
- 247,  11, 111, 225, 134,  10,  47,  13, 132, 118, 254,  33, // ..o.../..v.!
- 132, 154, 186,  21, 160,  30,  74,  61,  92, 101,  31,   2, // ......J=.e..
- 160, 214,   2, 223,  63, 104,   6, 181, 184,  17, 105, 111, // ....?h....io
- 185,  84, 136,  74,  71, 132, 111, 105, 250,  83, 140, 148, // .T.JG.oi.S..
- 181,   9, 162,  71, 209, 212, 162,   7, 123, 235,  95, 230, // ...G....{._.
- 243, 170,  23,  19,  85, 105,   7, 148, 111, 172,  58,  64, // ....Ui..o.:@
- 111,   4, 240, 121, 116,  76,  11,  77,  56,  13,  46,  88, // o..ytL.M8..X
-  93, 240, 233,  66,  35, 172, 160,   9,  89, 164, 177, 192, // ]..B#...Y...
- 190,  52, 111, 181,  86,  10, 218, 111, 217,  12, 225, 192, // .4o.V..o....
- 162, 227,  72, 148,  36, 148, 164, 189, 152,  78, 113,  49, // ..H.$....Nq1
-  86, 232,  90, 230,  82,  29, 158, 163, 213,  67, 180,  77, // V.Z.R....C.M
- 179, 147, 141,  22,   4,  98, 220, 135, 133, 119, 149,   1, // .....b...w..
-  33, 181,  50,   4,   0,  59,  15,  90,  93, 250, 244, 104, // !.2..;.Z]..h
- 142, 251, 171,  19,  86,  64, 187, 156, 127, 139, 103, 193, // ....V@....g.
-  80, 130, 226,  28,  72,  33, 209,  78,  48, 197, 160,  98, // P...H!.N0..b
-  65, 213,  58,  10, 254, 156, 241,  91, 110,  96,  68,  11, // A.:....[n`D.
- 123, 113, 125,  55, 179,  74, 144, 193,  21, 197, 184, 218, // {q}7.J......
-  66,   6,   6,  26, 249, 241,  81, 228, 129,   9, 160, 127, // B.....Q.....
- 219, 157, 251, 126, 195, 226,  49,  42, 126,  18, 234,  71, // ...~..1*~..G
- 222,  37, 234, 169,  75, 227, 122,  84, 207, 150,  52,   7, // .%..K.zT..4.
- 199,  54, 227,  68,  93,  50,  28, 118,  59,  72, 158,  58, // .6.D]2.v;H.:
- 229, 165, 159,  46, 146,  15, 195, 255, 233, 246, 102, 231, // ..........f.
-  27, 243, 139, 121, 161, 167, 173,  69, 172,  54,  90, 209, // ...y...E.6Z.
- 108, 150, 232, 150, 164, 168, 141, 198, 190,  62, 206, 244, // l........>..
- 198, 199,  23,  13, 181, 241,  62,  59, 202, 138, 140, 210, // ......>;....
- 158, 107, 226, 233, 224, 154, 120, 227, 181,  70,  56, 204, // .k....x..F8.
- 141, 135, 121,  28,  37, 148, 241, 154, 242,  55, 246, 163, // ..y.%....7..
- 116,  78, 105, 115, 250, 105,   1, 214,  38, 148, 241,  16, // tNis.i..&...
- 141, 110, 176, 193, 251, 198, 147, 105, 246,  53, 110,  56, // .n.....i.5n8
-  77, 175,  73, 217, 191, 152,  30, 101,  73, 195,  54, 233, // M.I....eI.6.
-  86, 252,  31,  85, 156,  66, 183,  37,  25,  19, 225,  92, // V..U.B.%....
-  28, 170, 226, 194, 153,  58, 134, 163, 198, 121, 195,  78, // .....:...y.N
- 226,  66,  49, 233,  20, 236, 116, 212, 113,  52,  11, 118, // .B1...t.q4.v
- 100, 111, 210,  27, 171, 206,  60, 163,  36, 243, 184, 143, // do....<.$...
- 244, 109, 243, 242, 148, 206, 231, 160,  56, 165, 194,  99, // .m......8..c
-  77, 199, 198, 113,  30, 143,   3, 154,  80, 177, 151,  40, // M..q....P..(
- 142, 149, 236, 249, 160, 152,  18,  32, 161, 228,  33,  60, // ....... ..!<
- 223, 105, 180, 214,  37, 254,  85, 212,  92,   1,  18, 197, // .i..%.U.....
- 249, 186, 161,  69, 139,  34,   3,  44,  18,  10,  43, 244, // ...E.".,..+.
-  56, 232, 178, 154, 169, 142, 248, 122, 180,  69, 191,  12, // 8......z.E..
-  33, 132, 227,  29, 212, 126,  84, 195,  34, 165, 217, 141, // !....~T."...
- 189, 216, 108,  52, 130, 103,  16, 151,  58, 104, 252, 172, // ..l4.g..:h..
-   2, 107, 198, 127,  70,  22,  79, 204, 194,  60, 212,  71, // .k..F.O..<.G
- 172, 176, 145, 193,  24, 195, 145, 223,  39,  97,  12, 154, // ........'a..
- 137, 175, 221, 136,  73, 245,  33, 137,  79, 119,  37,  80, // ....I.!.Ow%P
-  42,  37,  54,  51,  74, 240,  35,  33, 243, 140,  24,  58, // *%63J.#!...:
- 158,  83,  55, 173, 142,  79,  76,  68, 165, 175,  18,  57, // .S7..OLD...9
- 195, 120, 229, 236,  46,  67,  72,  15,  57, 104,  89, 155, // .x...CH.9hY.
- 231,  99,  62, 212,  66, 228,  18,  50, 226, 132,   3,  92, // .c>.B..2....
-  94,  17, 161, 254, 171, 231, 225,  78,  63,  22,  53,   1, // ^......N?.5.
-  31, 134,  21, 253,  12, 119, 146,  49,  80,  53, 103, 221, // .....w.1P5g.
- 190,  45, 183, 253,  76, 195, 103, 124, 219, 111,  17, 118, // .-..L.g|.o.v
- 127, 156, 109, 228,  50,  80, 194, 200, 243, 102, 152, 217, // ..m.2P...f..
-  42, 222,  28, 165, 231, 170, 156,   2, 226,  50, 178,  59, // *........2.;
- 241, 238, 252, 234, 138,  26, 162,  15,  62,  59, 137,  19, // ........>;..
-  34,  67, 118, 233, 217, 124,  78, 238, 124, 206, 183, 235, // "Cv..|N.|...
- 159, 115, 243, 151, 240, 157,  27, 125,  43, 180,  92, 204, // .s.....}+...
-  68,  80, 151,  57, 238, 218,  81,  63,  24, 230,   7, 244, // DP.9..Q?....
- 165, 172,  13, 147, 236, 118,   6, 195, 131, 128,  14,  67, // .....v.....C
-  43,  94, 106, 229, 187,  73, 173,  86,  43, 245,  85,  43, // +^j..I.V+.U+
-  49, 245,  32,  88,  33, 164,  52, 135, 156, 216, 192,  66, // 1. X!.4....B
-  75, 151, 194,   0,   2,  33, 145, 162,  22,  47, 195, 173, // K....!.../..
- 246, 150,  42, 246, 194, 173,  97, 183, 183, 189, 115, 255, // ..*...a...s.
- 128,  94,  54, 249, 101,   7, 143, 251, 225,  86, 151, 126, // .^6.e....V.~
-  62, 132,  78, 128,  49, 109,  77,  29, 128,  14, 239, 178, // >.N.1mM.....
- 246,  66, 135, 163,  33, 103, 255,  78, 195, 176,   3, 173, // .B..!g.N....
-  35,  34,  71, 137,  86, 107,  23, 217, 147, 115,  81,   0, // #"G.Vk...sQ.
- 165, 205, 239, 249, 195, 166, 215, 217, 213,  62,  36, 228, // .........>$.
- 129,  40, 216,  86, 243, 246, 189, 126, 217, 110, 166,  42, // .(.V...~.n.*
- 129, 188,  43, 149, 233,  82, 206,  76,  74,  88,  59,  40, // ..+..R.LJX;(
-  64, 126, 200, 222, 102, 115, 112, 134, 134,   5,  34, 224, // @~..fsp...".
- 141,  33, 255, 200, 192,   9, 198, 222, 207, 244, 208, 154, // .!..........
- 255,  18,  13,  98, 239, 126, 245, 184,  99,  31, 139, 253, // ...b.~..c...
- 160, 216,  12, 138, 189, 160, 120,   9, 182, 117,  65,  31, // ......x..uA.
- 179, 111, 249, 163, 191,  60, 106, 136,  11,  50,  75,  27, // .o...<j..2K.
- 209, 200, 237, 238, 250, 224,  21, 246,  54, 162, 154, 102, // ........6..f
- 149,  67,  61, 162,  32, 110,  82, 189, 243,  34, 112, 167, // .C=. nR.."p.
-  85, 222, 210, 169, 233, 148, 235, 186, 251, 241, 201,  63, // U..........?
- 153, 129, 242,  51,  87,  62, 191,  28, 108,  76, 148, 113, // ...3W>..lL.q
-  86, 221,  86, 231, 187, 244, 145, 235, 135, 187, 173, 138, // V.V.........
- 151,  52, 210, 124,  43, 114,  71,  26,  56,  55,  79, 197, // .4.|+rG.87O.
- 219, 107, 234,  23, 130,  79,  82,  33, 199, 229, 165,  16, // .k...OR!....
- 228,  98, 116, 198, 138, 135, 215,  16, 218, 197,  53,  92, // .bt.......5.
- 187, 253, 191, 199, 181, 219, 255,  15, 184, 246,  17,  13, // ............
- 141, 135, 196, 135, 171,  32, 217, 142,  69, 178, 157,  21, // ..... ..E...
-  36,  75, 229,  31, 135, 181, 147,  63,  83, 197, 251, 234, // $K.....?S...
- 227, 174,  85, 167,  47, 162, 225,  60,  86,  81,  50,  59, // ..U./..<VQ2;
- 137,   8, 103,  79, 232,  75, 137,  74,  29, 154,  99, 245, // ..gO.K.J..c.
- 145, 186,  44,  17,  60,  34, 247, 173, 166,  94,  80,  42, // ..,.<"...^P*
- 168, 246, 231,  97, 149, 114, 189, 147, 114, 106, 103,  81, // ...a.r..rjgQ
- 250,  12,  29, 210,  41, 177, 218, 241, 122, 242, 216, 130, // ....)...z...
- 150, 157,   2,  57,  68, 178,  37, 113, 176, 134, 220, 235, // ...9D.%q....
- 224, 154, 183, 104,  31, 130,  24, 193,  75,  44, 193, 121, // ...h....K,.y
-  25, 196, 188, 124,   8, 125, 165,   3, 154,  10,  34, 250, // ...|.}....".
-  45, 116, 253, 229, 173, 148, 232, 218,  18, 173, 216, 223, // -t..........
- 242, 202, 150, 147, 138, 150, 197, 250, 223, 209, 254, 110, // ...........n
- 136, 194,  45, 180, 185, 180, 158, 209, 133, 206,  49,  28, // ..-.......1.
- 140, 232,   7, 173,  61, 246,  20, 140,  64,  74, 146, 111, // ....=...@J.o
-  38, 245,  28,  84, 242, 199,  10,  11, 145, 108,  17, 133, // &..T.....l..
- 195, 176, 249,  34, 188, 132, 112, 217,  93,  62, 222, 138, // ..."..p.]>..
-  52, 105, 116, 168,  16,  33, 164,  24,  35, 155,   3,  87, // 4it..!..#..W
- 134,  16,  89,  18,  45,  70, 177,  44, 143,  25, 148, 126, // ..Y.-F.,...~
- 183, 212, 210,  11, 101, 154, 148,  60, 166, 153,  62, 134, // ....e..<..>.
- 151, 238, 120, 158,  86, 178, 222, 226, 227,  80, 151, 220, // ..x.V....P..
- 163,  24, 235,  94, 126, 211,  23, 129,  86, 179,  36,  43, // ...^~...V.$+
- 248, 227, 230, 139,  35, 142,  17, 223, 230,  20, 107, 147, // ....#.....k.
- 183,  36,  50, 183, 158,  19, 218,  18,  70, 244,  91, 132, // .$2.....F.[.
- 187,   5,   4,  61, 196,  30, 161,  92, 117, 176, 211, 113, // ...=....u..q
-  88,  42, 250, 205, 195,  78, 223, 214,  51, 130, 253, 121, // X*...N..3..y
- 127, 222, 108, 250,  38, 113,  56,  63,  96, 189, 209, 234, // ..l.&q8?`...
- 181, 125, 189,  53, 162, 249, 203, 107, 104, 143, 191,  40, // .}.5...kh..(
- 132, 254, 145, 139,  56, 190, 174, 226,  50,  86,  97, 202, // ....8...2Va.
-  92, 214, 130,  96, 173,   7,  76, 162,  13, 192,  21,   7, // ...`..L.....
- 129, 121, 116,  14, 127, 194, 108, 196, 151,  30, 101, 231, // .yt...l...e.
- 132, 214, 115, 192, 228,  66,  42, 229,   4,  60,  65, 142, // ..s..B*..<A.
-  86,  70, 146,  16,  15, 179, 182, 108,  56,  42, 101, 142, // VF.....l8*e.
- 215,  32,  30, 234,  10, 182,  77, 162, 154,  92, 171, 208, // . ....M.....
- 117,  42, 100, 182, 216,  44, 140, 218, 160, 215, 213, 152, // u*d..,......
-  30, 136,  94,  87,  39, 244, 203, 212, 181,  58, 166,  39, // ..^W'....:.'
- 209, 161,  86,  83,   7,  11,  63, 135,  40, 181, 124, 251, // ..VS..?.(.|.
- 228,  92, 115, 141, 218,   4,  26, 131, 132,  72,  16,  43, // ..s......H.+
-  57, 154, 170,  67,  72, 143,  20,  53, 166, 138,  95,  85, // 9..CH..5.._U
- 241,  78,  21,  93,  85,  16,  70, 190, 235,   7, 110, 185, // .N.]U.F...n.
-  67,  42,  57, 166, 146, 199,  84, 178, 248, 172,  10,  98, // C*9...T....b
-  29, 122, 170, 184, 167, 138,  29, 247, 228, 120, 237, 114, // .z.......x.r
- 111,  16, 180,  66, 196, 250, 154, 163,  82, 167,  99, 162, // o..B....R.c.
- 100,  94, 214, 117,  48, 178,  53,  58,  24,  57, 237,  71, // d^.u0.5:.9.G
-  64, 102,  53,  95,  64, 236,   8, 210,  10, 184,  47, 147, // @f5_@...../.
- 187,   7, 162, 172, 152,  94,  65,  99, 148,  51,   7, 221, // .....^Ac.3..
- 160, 103, 207, 183,  97, 162,  88, 145, 180,  69, 105, 248, // .g..a.X..Ei.
- 165, 159,  59, 222,  54, 226, 144,  58,  26, 146, 197, 155, // ..;.6..:....
- 181,  36,  82,   9,  23,  14, 233, 215,  11,  13, 232,  12, // .$R.........
- 242, 213, 197, 194, 152, 120, 165,  42,  85,  84, 104, 137, // .....x.*UTh.
- 198,  80, 133,  10, 236,  35, 237,  93, 234,  61, 150, 243, // .P...#.].=..
- 118, 208, 149, 199, 220,  20, 146, 252, 142,  51, 176,  47, // v........3./
-  46,  69,  92, 209, 210,   2, 204, 194, 220, 171, 154, 244, // .E..........
-  79, 157,  88, 161, 224,  49, 150, 148,   6,  59,  59, 127, // O.X..1...;;.
- 207, 234,  89, 167,  33, 173, 123, 196, 235,  94, 188,  11, // ..Y.!.{..^..
- 138,  78, 191, 139,  87, 234, 156,  85, 213,  36, 163,  75, // .N..W..U.$.K
-  60, 160,  63, 240, 142, 195,   4, 114,  58,  63, 160,  39, // <.?....r:?.'
-   8, 119,  19,  33,  82,  47, 194,  67, 111, 225,  21, 195, // .w.!R/.Co...
-  99,  34,   1, 169, 167, 137,  15, 197, 185,  67, 111, 228, // c".......Co.
- 197,  72, 154,  19,  64, 204, 124, 216,   0,  72, 169, 105, // .H..@.|..H.i
-  85, 234, 140,  75, 177, 118, 236, 156,  63, 113, 206, 234, // U..K.v..?q..
-  97, 182, 198,  43,  22, 162, 191,  37,  20, 218, 123,  76, // a..+...%..{L
- 212, 173, 157, 190,  83, 239, 149,  58,  82, 103, 190, 194, // ....S..:Rg..
- 195,  69, 245, 112,  78,  53, 220,  24, 224, 197, 179, 250, // .E.pN5......
-  36, 137,  36, 157,  53, 236, 161, 182,  81,  26,  47, 251, // $.$.5...Q./.
- 151, 177, 211, 145, 145, 173, 240, 149, 111, 209,  13,   8, // ........o...
- 136,  65, 131, 151, 250,  19, 174, 162,  72, 209,  47,  44, // .A......H./,
-  80,  38,  33, 244,  38, 208,  46, 174,  44, 119, 249, 198, // P&!.&...,w..
- 210,  16, 103, 120, 110, 205, 251, 122, 151, 200, 205, 136, // ..gxn..z....
-  72, 254,  57, 141,  71, 171, 180, 153, 227,  74,   0, 165, // H.9.G....J..
-  69, 238, 180,   8, 147, 102,  70, 229,  22,  78, 185, 214, // E....fF..N..
-  14,  45,  32, 149, 108, 118,  59,  37,  93,  22,  59,  31, // .- .lv;%].;.
- 248, 233,  71, 124, 145,  25, 101,  57, 244,  69, 200, 176, // ..G|..e9.E..
- 150,   4,  41, 245,   1, 204,  73, 124, 193, 162, 191,  32, // ..)...I|... 
- 126, 194, 106,  78,  35, 170, 237, 112,  97,   6,  62,  10, // ~.jN#..pa.>.
-  23, 132, 128,  22, 248,  36, 212,  99, 237, 149, 126, 179, // .....$.c..~.
- 185, 248,   5, 170, 188,  78, 233, 190, 143,  82,  44,  53, // .....N...R,5
- 231,  34, 173, 150, 105, 125, 181, 136, 216,   1, 231, 158, // ."..i}......
-  30, 142,  14, 160,  32,  58,  33, 108,  51, 152,   5,  72, // .... :!l3..H
- 152,  28,  64,  66,  60, 106, 101, 253,  89,  24, 239, 118, // ..@B<je.Y..v
- 160,  86, 117, 114, 117, 117,  66, 124, 139,  41, 112,  98, // .VuruuB|.)pb
-   4, 167, 199, 225, 164,  73, 133, 118, 161,  35, 186,  27, // .....I.v.#..
- 163, 220, 241, 213, 213,  49, 202, 141, 185, 220, 241, 129, // .....1......
-  79, 124, 160,  97, 235, 134,   4, 246, 149,  10, 139, 203, // O|.a........
- 200, 253, 230, 104, 107, 176, 226, 167, 158,   4, 124,  83, // ...hk.....|S
- 249,  57, 160, 179,  73,  31,  18,   5, 162,  93,  64, 250, // .9..I....]@.
- 171,  58,  22, 185, 120, 241, 107,  64,  40,  46, 145, 151, // .:..x.k@(...
-  26, 144,  33, 104, 119,  59, 202,  71,  31,  50, 175,  74, // ..!hw;.G.2.J
-  92,   6,  55, 149,  73,  40,  57, 163, 228,  28, 161, 193, // ..7.I(9.....
-  87, 155, 147, 130, 136, 218, 106, 219, 170, 181, 228, 100, // W.....j....d
- 155, 102, 252, 210, 141, 140, 182,  39,  32,   1,  66, 135, // .f.....' .B.
-  78, 162,  14,  10, 195,  81,   1, 243,  63, 139, 129,  83, // N....Q..?..S
- 130,  54, 243,  92,  84,  73, 227, 173, 158, 138, 182, 122, // .6..TI.....z
- 172, 187, 166, 189,  69, 245,  14, 109, 200, 172,  57, 135, // ....E..m..9.
- 193, 119, 194, 143,  49,  85, 229, 191,  77, 104, 184,  85, // .w..1U..Mh.U
- 137, 244, 154, 241, 223, 133,  73, 180,  73,  78, 130, 169, // ......I.IN..
-  62, 231, 112, 233,   8,  90, 135, 109, 199, 129, 162, 121, // >.p..Z.m...y
- 130, 127,  53, 132, 172, 124,  29,   4, 111,  50, 149,  52, // ..5..|..o2.4
-  65, 197, 231, 117, 121,   9,  75, 155, 139, 119, 181,  60, // A..uy.K..w.<
-  80, 213,  85, 189, 206, 186,  60,  83, 175,  27, 210, 234, // P.U...<S....
- 118, 232,  27, 123, 120, 232, 210, 195, 118, 184, 118, 181, // v..{x...v.v.
- 220, 245, 164, 115, 237, 134,  66,  73, 105, 110,  66, 133, // ...s..BIinB.
- 238, 134,  43, 251, 147, 139,  29, 233, 239, 177, 206, 247, // ..+.........
-  22, 185, 253, 180,  50, 155, 170, 236, 252, 131,  42,  22, // ....2.....*.
- 104,  98, 244, 226,  16, 111,  15, 188, 242,  82, 194,  29, // hb...o...R..
-  25,  29,  10, 120, 165, 106, 215, 142,   4, 117, 108,  15, // ...x.j...ul.
-   5, 156, 242, 151, 230,  68,   8,  78,  45,  93, 126, 177, // .....D.N-]~.
-  36, 212, 199, 254,  45, 112,   8, 120, 211, 144,   8, 128, // $...-p.x....
- 195, 176, 216,  38, 152, 161, 231, 207, 120, 190,  39,  27, // ...&....x.'.
- 243,  28, 146, 136,  11, 161,  58, 228,   6, 244,  40, 164, // ......:...(.
- 119,  48,  77,  45, 147, 236, 111, 245,  40, 135,  85, 161, // w0M-..o.(.U.
- 123, 119, 142,  80, 196, 197, 239, 234, 155, 251, 114, 201, // {w.P......r.
- 242, 199, 151,  44, 125, 220,  51, 146, 194,  77, 101, 156, // ...,}.3..Me.
- 138, 237, 131,  17,   0, 165, 213,  47, 186, 222,  55, 245, // ......./..7.
- 178, 117, 166, 246, 232, 255, 205, 102, 239, 206, 153, 218, // .u.....f....
- 199,  95,  25, 211,   7, 118, 148,  81, 170,  54,  70,  68, // ._...v.Q.6FD
-  53, 216,  93, 124, 202, 135, 147, 174,  14, 167, 132, 146, // 5.]|........
- 136, 113,  70, 210, 130,  72, 152,  49, 177, 165,  83,  58, // .qF..H.1..S:
-  84, 138, 230,  17,  36,  28, 135, 120, 164,  57,  60,  82, // T...$..x.9<R
-  29, 213, 187, 243,  27, 193,  42, 208,  98, 238, 231, 208, // ......*.b...
- 135, 126,  18, 141,  78, 188,  15, 126, 133,   2,   5, 237, // .~..N..~....
- 167, 176,  79,  17, 178, 229,  67, 101, 255, 116, 105, 216, // ..O...Ce.ti.
- 203, 243, 221, 206, 224, 149,  80, 235,  44, 220, 126,  37, // ......P.,.~%
- 252, 193,  55,  14, 146,  52,  15, 182, 151, 181, 131, 236, // ..7..4......
- 103,  71, 239, 107,   5,  56, 210,  91, 112, 200, 225, 229, // gG.k.8.[p...
- 108,  97,  17, 243,  95,  27,  58,  93, 229, 156,  23, 243, // la.._.:]....
-  95,  73, 204, 108,  96, 245, 184, 220, 112, 247,  67, 106, // _I.l`...p.Cj
- 190, 120,  71,  83, 160, 249, 169, 227, 136,  58, 146, 162, // .xGS.....:..
-  66, 124,  68, 164,  13, 218,  81,  18,  31,  51,  51, 167, // B|D...Q..33.
-  74, 206, 202,  82, 220,   2, 105, 120, 241, 242, 191, 131, // J..R..ix....
- 180,  83, 162, 199,  44, 249, 113, 129,  85, 194, 122, 232, // .S..,.q.U.z.
- 114,  49, 206,  37,   9, 151,  55, 118,  49, 106,  64, 248, // r1.%..7v1j@.
-  14, 128, 119,  95, 128,  16, 174,  71,  18,  45,  11, 126, // ..w_...G.-.~
-  68, 101,  44, 221,  50, 175, 232,  22, 130,  57,  59, 237, // De,.2....9;.
-  14, 136, 241, 180, 215,  57,  51,   4,  44,  30, 203,  19, // .....93.,...
-  51, 170, 178,  60, 188,  32, 221,  37,  65, 235, 153, 185, // 3..<. .%A...
-  23,  83,   4, 116, 106,  79, 109, 134, 196, 232, 237, 195, // .S.tjOm.....
- 244,  64, 125,   8,  47,   8, 158, 232,   8,  57, 130,  61, // .@}./....9.=
-  60, 157, 102, 223, 195, 231,  94, 196, 235, 212,  60, 242, // <.f...^...<.
- 213, 147, 242, 173, 213, 189,  67, 239, 111, 185, 248, 119, // ......C.o..w
-  42, 247, 144, 159, 158, 208, 211,  35,  54,  41,  46, 193, // *......#6)..
- 199, 182,  69, 116,   3, 214, 212, 192,  82, 120, 100, 151, // ..Et....Rxd.
- 227, 130, 225,  23, 128,  11, 160, 237,  23,  97, 248,  97, // .........a.a
-  96, 108, 233,   6, 222, 203, 240,  28, 222,  59,  54,  67, // `l.......;6C
-  49, 149,  96,  72,  86,  47, 125, 218,  99,  47, 145,  74, // 1.`HV/}.c/.J
- 216, 253, 165, 218, 244, 105, 236, 186, 160, 167, 125, 223, // .....i....}.
-  55, 242,  17,  54,  59, 122, 132, 187, 178, 192, 219,  52, // 7..6;z.....4
- 118,  22, 128, 253,  15, 106,  83, 237, 227, 171, 125, 181, // v....jS...}.
-  23, 126,  40, 141, 246,   6, 182, 101, 238,  14,  45, 239, // .~(....e..-.
- 135, 232, 130,  42,  87,  83, 179, 218, 178,  79, 147,  69, // ...*WS...O.E
- 152, 215,  52,  79,  63, 251, 183, 111, 239, 221,  10,  63, // ..4O?..o...?
- 220, 190,  93, 239,   9,  43,  58, 124, 172, 222,  19, 199, // ..]..+:|....
- 246, 154, 205, 233,  42,  37, 229, 188,  45,  87,  59, 157, // ....*%..-W;.
-  91, 225,  99,  59,  31, 103, 156, 230,  18, 140, 175, 112, // [.c;.g.....p
- 103, 125, 238,  73, 225,  15,  25, 131, 102, 206, 244, 101, // g}.I....f..e
- 206, 182,   7, 143, 121, 143,  23, 234,  33, 182,  10,  30, // ....y...!...
- 222, 226,   4, 133, 189, 122, 222, 182,  50,  11, 105, 125, // .....z..2.i}
-   1, 199,  52, 143, 110, 223,  94,   8,  93, 209, 110, 183, // ..4.n.^.].n.
- 137, 242,   2, 136,  99,  69, 143, 136, 242,   4,  79, 121, // ....cE....Oy
- 214,   6, 204, 132,  11,  26,  29,  30,  74,  70, 116, 129, // ........JFt.
-  44, 128,  88,  72, 244, 232,  66,  49,  92, 150, 123, 194, // ,.XH..B1..{.
-  18,  39, 244,  37, 239, 105, 130, 206, 152,  13,   2, 215, // .'.%.i......
- 247, 126,  48, 100,  26,  95, 218, 120, 165,   0, 198, 181, // .~0d._.x....
- 132, 174, 127,  16, 212,  18, 222,  99,  12,  46, 214, 144, // .......c....
- 155, 216,  10,  91, 208, 124, 139,   6, 191,  37,  95, 187, // ...[.|...%_.
- 165,  78,  59,  27, 157,  86, 124,  55,  17,   0,  48, 170, // .N;..V|7..0.
- 208, 117, 190, 155, 170, 202, 125, 209,  45,  80, 117, 243, // .u....}.-Pu.
-   3, 199,  46,  53, 170, 148, 234,  53, 229, 180, 244,  48, // ...5...5...0
-  34, 130, 109, 177,  91, 176, 253,  26, 204, 229, 255, 242, // ".m.[.......
-  18, 206,  50, 167,  82,  11, 111, 145, 125,  35,  92,  20, // ..2.R.o.}#..
- 133, 243, 229,  26,  10,  55,  73, 215,  49,  96, 134, 176, // .....7I.1`..
- 165, 238, 123, 187, 249,  53,  95,  51,  53,  98,  30,   4, // ..{..5_35b..
-  57,  45, 149,  22,  95,  92,  68, 148, 195, 100,  40, 247, // 9-.._.D..d(.
-  83,  78, 235, 138, 127,  46,  65, 221, 134, 140,  23,  13, // SN....A.....
- 241,  28, 176,  99,  30,  91, 172, 108, 227, 188, 204, 157, // ...c.[.l....
-  23,  71, 255, 186, 211, 167,   4, 163, 122,  29,  13, 147, // .G......z...
-   3,  40,  94,  55, 187,   7, 108, 221, 168,  32,  88,  34, // .(^7..l.. X"
-  22, 129,  19,  52,  18,  82,  36, 160, 216,  22, 178, 250, // ...4.R$.....
-  96,  18, 194,  20,  34, 115,   7,   5, 112, 131, 114, 132, // `..."s..p.r.
-  16,  70,  99, 211,   3,  86,   8, 193,  83,  11,  54,  17, // .Fc..V..S.6.
- 242, 187,  75,  43, 130,  60,  58,  82,  18,  72,  56,  58, // ..K+.<:R.H8:
- 129, 199, 191, 112, 214, 193,   5, 154, 112, 246, 233, 111, // ...p....p..o
- 121, 116, 238, 226, 169,  41, 169, 254, 150,  84, 111, 122, // yt...)...Toz
- 156, 200, 121,  54, 153, 230,  41, 158,  63, 141, 211, 184, // ..y6..).?...
- 208, 220,  22, 156, 167,  73, 219, 184, 151,  24, 210, 184, // .....I......
-  48, 218, 188, 213,  59, 168, 169, 208,  99, 188, 162,  61, // 0...;...c..=
- 159, 241,   4, 167, 232,  43,  61, 216, 218,  86, 176, 238, // .....+=..V..
- 108,  66, 217, 253, 142,  73, 160,  76, 204,  69, 149, 141, // lB...I.L.E..
- 183, 132, 127, 234,  69,  76, 158, 195, 255, 240, 116, 103, // ....EL....tg
- 188, 202, 251, 186, 112,  78, 171, 220, 171, 196,  71, 122, // ....pN....Gz
-  35, 155,  80,  41, 159,  24, 244, 139, 116, 244,  30,  84, // #.P)....t..T
-  50,  33,  31,  24,  44, 122, 143, 188,  70, 174,  65, 153, // 2!..,z..F.A.
-  52, 104, 243,  38,  57, 236,  16,  27, 243,  81, 158,  37, // 4h.&9....Q.%
- 137,  36,  64,  40,  72, 105, 167, 244, 194,  58,  24, 201, // .$@(Hi...:..
-  20, 135,  21, 238,  94,  67, 189,  52, 247,  50,  73,  28, // ....^C.4.2I.
- 194, 245, 129,  74, 162,  16, 116, 151,  51, 136, 249, 170, // ...J..t.3...
-  32, 218,  75,   7,  67, 134,  63,   0, 220,  65, 169, 209, //  .K.C.?..A..
-  89, 170,  93, 251,   1, 103,  95, 203, 129, 153, 146, 189, // Y.]..g_.....
- 190, 192,  93,  70,   2,  67, 165, 148, 233,  88, 119, 151, // ..]F.C...Xw.
-  47, 174, 219,  29, 178, 184, 143,  25,  88,  58, 225, 106, // /.......X:.j
- 156,  76,  50,  90, 213, 114,  49, 114, 113, 189,  23,  12, // .L2Z.r1rq...
-  41, 221, 145, 125,  36, 147, 155, 139,  10,  69, 217, 238, // )..}$....E..
-  98, 166, 156,  26, 179,  27, 100, 240,  92, 231,  15, 174, // b.....d.....
-  83, 202,  75,  82, 185,  28, 187, 229, 222,  43,  36, 227, // S.KR.....+$.
-  31,  53, 240, 226,  31,  52, 112, 226,  89, 225, 146,  74, // .5...4p.Y..J
- 173,  14,  42, 156,   5, 150,  46, 201, 188, 255, 140, 155, // ..*.........
- 254, 236, 124,  75,  81,  99,  32,  89, 188,  36, 252, 236, // ..|KQc Y.$..
- 121, 105, 216, 204, 252,  59, 218, 247, 217, 174, 221, 199, // yi...;......
-   8, 220, 153,  56,  70, 171,  69,  27,  66, 234, 219, 183, // ...8F.E.B...
- 135,  69,  27, 178, 123,  85, 180,  75, 137, 255,  65,  73, // .E..{U.K..AI
-   6,  58,  58,  83, 231,  94,  49, 236,  29,  16, 197,  75, // .::S.^1....K
-  72, 130, 157, 248, 225,  79,  53, 144,  97, 167, 245, 115, // H....O5.a..s
- 251, 160, 137, 161,  36, 166, 215, 130, 213,  70, 106,  40, // ....$....Fj(
-  28, 199, 210,  66,  29, 250, 172, 173, 125, 193, 144,  71, // ...B....}..G
-  36,  46, 157,  84,  15, 213, 115, 245,  81,  61,  85, 111, // $..T..s.Q=Uo
- 212,  23, 245,  76, 253, 170, 116,  10, 107,  57, 177,  99, // ...L..t.k9.c
- 125, 237,  21,  34, 196, 164, 169,  81, 176,  68, 203, 249, // }.."...Q.D..
- 213,  81, 233, 157, 214,  52, 152,  32, 246,  42, 140, 224, // .Q...4. .*..
-  73, 211,  57,  73, 120,  68,   7, 240, 179,  17,  77, 105, // I.9IxD....Mi
-  69, 115,  24, 217, 243, 177,  89, 240, 177, 201, 206,  26, // Es....Y.....
-   9, 104, 239,  58, 149,  88, 119,  74, 174,   8, 225, 231, // .h.:.XwJ....
- 176,  85, 180,  15, 169,   2, 139, 213,  15,  97, 173, 107, // .U.......a.k
- 222,  87, 109, 207, 106,  22, 216, 211, 154,  58, 118, 218, // .Wm.j....:v.
-  76, 238, 176,   1, 118,  33, 130, 187,  86,  22, 100, 110, // L...v!..V.dn
- 253, 107, 134,  95,  63, 174, 159,   5, 212, 130,  91, 127, // .k._?.....[.
- 255,  26, 164,  97, 191,  48, 205, 232, 140,  45, 112, 250, // ...a.0...-p.
-  89, 210,  52, 150, 242, 211,  80,  95,  40, 231,  29,  10, // Y.4...P_(...
- 222, 125,  99, 211,  68,  84,  28, 229, 204, 139, 168,  88, // .}c.DT.....X
-  64, 132, 205, 169, 239, 177,   6, 121, 150,  21, 225, 166, // @......y....
- 215, 128, 187, 247, 162, 225, 247, 141,  39, 132, 118,  60, // ........'.v<
- 134, 105, 244, 123, 250, 229,  23,  98, 139, 232,  77,  21, // .i.{...b..M.
- 226, 166,   1, 138,  32, 236,  69, 133, 202, 160, 110, 139, // .... .E...n.
-  95,  26,  74, 191, 247, 219, 112,  18, 181,  71, 224, 167, // _.J...p..G..
-  83, 128,  56, 103,   8, 114, 210, 207, 195,  61, 175,  49, // S.8g.r...=.1
- 138, 210, 211, 104,  78, 112, 165, 255,  64, 247, 163, 226, // ...hNp..@...
-  28,  86,  40, 199,  90, 234, 156,  23,  94, 163,  55,  70, // .V(.Z...^.7F
- 238,  11,  30,  84,  11, 161,  75, 184, 221,  62, 161,  67, // ...T..K..>.C
- 227, 244,  66, 191,  80, 154,  25,  80, 209, 148, 162, 147, // ..B.P..P....
-  71, 127, 132,  72, 181,  32, 226, 239,   1,  29,  63,  32, // G..H. ....? 
-   2, 127, 246, 111, 223,  78,  39, 198,  43,  11, 160, 133, // ...o.N'.+...
- 128, 238, 150, 113, 115,   8,  83, 151, 188,  13, 147, 161, // ...qs.S.....
-  92,  58, 225,  71, 180,  75, 103, 238, 139, 118,  52, 155, // .:.G.Kg..v4.
- 233, 116, 188,   7, 239, 187, 158, 126, 110, 170, 124,  68, // .t.....~n.|D
-  21, 241, 198, 130,  26, 120, 226,  10,  74,  63,  13, 155, // .....x..J?..
- 175,  61, 152,  41,  60, 132,  17,  49, 225, 228, 135, 224, // .=.)<..1....
-  70, 160,  11, 171, 191, 134, 144, 233,  60, 245, 251,  30, // F.......<...
- 174,   3,  22, 199, 113,  58, 191, 186,  26,  30, 248, 229, // ....q:......
- 198, 148, 207, 200, 102, 197, 156, 221, 135, 202,  35, 134, // ....f.....#.
-  11, 151,  25,  68, 142, 154, 206, 223, 192,  11,  40,  85, // ...D......(U
- 133,  30,  39, 235, 244,  91, 113,  50, 232, 113,  61,  25, // ..'..[q2.q=.
-  16, 118, 183,  55,  69, 104,  95,  21, 180,  31, 158,   3, // .v.7Eh_.....
-   7,   5, 222,  69, 232, 228, 136, 233, 222, 133, 235, 104, // ...E.......h
- 143, 241,  49, 210,   3, 115,  29, 243,  94, 177, 123,   0, // ..1..s..^.{.
- 253,  12, 189, 224,   2,  53, 228, 214, 241,  36, 109,  19, // .....5...$m.
-  93, 249, 144, 207,  34,  24,  16,  24,  25, 242, 156, 205, // ]...".......
- 198, 126, 195,  59,  75, 204, 193,   9, 227,  23,  53, 250, // .~.;K.....5.
-  48,  32, 168, 125,  47, 147, 196, 176, 176,  48,   4, 179, // 0 .}/....0..
- 248, 143, 130, 255, 206, 156, 133, 238, 244,  11, 202, 210, // ............
- 126, 253, 103,  80, 158, 244, 149, 250,  11, 100, 215,  43, // ~.gP.....d.+
- 119,  20,   1, 165, 218, 103, 216,  31,  92,  98, 160, 213, // w....g...b..
- 157,  93, 117, 242, 178, 136, 244, 217, 122,  25, 233,  51, // .]u.....z..3
-  35,  36, 189, 149,  48,  54, 189, 186, 186,   5, 245,  44, // #$..06.....,
- 122, 242, 225, 136,  36,  78,  23,  98,  81, 202, 100,  33, // z...$N.bQ.d!
- 171, 192,  17,  22,  35, 138, 250, 223,  61,  53,  10,  43, // ....#...=5.+
- 205,  69, 172, 154, 154,  64,  92, 150,  95,  93, 109,  67, // .E...@.._]mC
- 122, 220, 234,   6, 108, 196, 152,   8,  82, 182, 228,  40, // z...l...R..(
- 161, 118, 106,  63, 153, 101, 243, 166, 201,  33, 162, 254, // .vj?.e...!..
- 206,   4, 168, 190, 159, 188, 177, 165, 129, 194, 217,  27, // ............
- 167, 106, 140, 140,  39, 152,  30, 235, 113,  22, 217, 172, // .j..'...q...
-   1, 251, 108, 253,  71,  27,  65, 120,  60, 118, 234, 185, // ..l.G.Ax<v..
-  24, 208, 113,   1, 159, 105, 148,  90, 185,  18,  41, 212, // ..q..i.Z..).
- 103, 175, 232,  54, 139, 237, 173, 158, 207,  21, 140, 123, // g..6.......{
-  56,  79, 134, 247,  91, 240,  27, 124,  95,  16, 152, 164, // 8O..[..|_...
-  52, 168, 162, 211,  44, 122,  16, 172, 101,  97, 193, 133, // 4...,z..ea..
- 153,  67, 193, 150,  52,  35,  98, 114, 151,  91, 209, 243, // .C..4#br.[..
-   2, 222,  80, 248, 194, 154, 229, 153,  33,  20, 219, 192, // ..P.....!...
-  56, 227, 115,  97,  74,  94, 159, 185, 147,  80, 127,  26, // 8.saJ^...P..
-  38, 246, 102, 232,  56, 100, 105,  95, 209,  11, 138, 109, // &.f.8di_...m
-  53,  53,  47, 157, 160, 232,  18, 211, 252, 153,  58,  35, // 55/.......:#
-  70, 133, 166, 130, 216, 113, 172,   2, 204, 109, 231, 196, // F....q...m..
- 142, 211, 183, 159,  24, 196,  94, 122, 193,  75, 126,   7, // ......^z.K~.
-  17,  24, 156,  18, 107, 238, 100,  83, 234,  41, 104, 154, // ....k.dS.)h.
-  22,  63,  16,   9,  19, 204, 212,  17, 181, 197, 215, 221, // .?..........
- 196, 117,  39, 109, 185, 239,  38, 214, 249, 136, 215, 123, // .u'm..&....{
- 240, 217,  59,  98, 153,  16, 245,  26, 116, 136,  29, 109, // ..;b....t..m
-  97, 125, 100, 170, 238, 208,  12, 117,  31, 116, 136, 153, // a}d....u.t..
- 212,  95, 145,  74, 139, 134, 177, 237, 133,  47, 155, 222, // ._.J...../..
- 171, 230, 161, 127, 103, 210, 207, 228,  11, 246,  88,  67, // ....g.....XC
- 191, 107,  31, 121,  33,  39, 229,  26,  82, 122,  34, 114, // .k.y!'..Rz"r
- 138,  65, 132, 171,  29, 251,  50,  15, 190, 209, 193,  22, // .A....2.....
-   5, 157, 221, 111, 244, 204,  13, 217, 229,  14, 120, 145, // ...o......x.
- 230,  65, 164, 190,  93,  93, 113, 187, 141, 105,  60,  30, // .A..]]q..i<.
-  19, 158,  13, 106, 128, 192,  51, 188,  25, 154, 222, 136, // ...j..3.....
-  80,  77, 218, 230, 250, 158, 120, 221, 114, 174, 104, 248, // PM....x.r.h.
- 124, 188, 224, 194, 108, 234,  51, 191,  75, 159,  35, 119, // |...l.3.K.#w
- 197, 181, 203, 173,  15, 107,  46, 183, 138, 240,   3, 216, // .....k......
- 121, 215, 227, 143,   8, 108, 195, 125,  24,  22, 103, 252, // y....l.}..g.
-  99, 172, 174, 113, 188,  17,  46, 107,  52, 154, 133, 223, // c..q...k4...
- 142,   9, 179, 158, 191, 153, 120,  48, 229, 241,   7, 184, // ......x0....
- 162,  44, 140,   5, 245, 214, 127, 210, 173, 227, 105, 253, // .,........i.
-  94,  45,  89, 219,  53,  40, 252, 254, 183, 129,  87, 193, // ^-Y.5(....W.
- 123,  13, 198,   9,  40, 155, 250, 206, 166,  11, 222, 223, // {...(.......
- 234, 224,  91,  64, 187, 175,  14, 184, 116, 134, 214,  10, // ..[@....t...
- 216,  70, 150, 203, 229, 145, 161, 168, 146, 119, 222, 190, // .F.......w..
-  58,  42, 237, 130, 114,  48, 212, 196,  31, 159, 251,  68, // :*..r0.....D
- 250, 228, 234,  37, 241, 182,  68,  76,  29, 213, 100, 139, // ...%..DL..d.
- 117,  84, 112, 212, 134, 178,  49, 253, 140, 162, 153,  44, // uTp...1....,
- 210, 119, 104, 151, 231, 241, 184, 255, 221, 237, 227, 251, // .wh.........
- 250,  62, 120, 130, 123,  65,  87,  30, 112, 231, 211,  49, // .>x.{AW.p..1
- 143, 219, 184, 254, 161, 206, 191, 187, 157, 127, 175, 119, // ...........w
- 254,  93,  58, 255, 206, 157,  19, 171,  95, 246,  55, 124, // .]:....._.7|
- 121,   0, 141, 111, 213, 196,  54,  93, 248, 210, 100,  55, // y..o..6]..d7
- 232,   9,  18, 145, 110, 186, 181, 110, 206, 220, 110, 206, // ....n..n..n.
- 234, 221, 156,  73,  55, 103, 220, 205,  50, 125, 225,  53, // ...I7g..2}.5
- 198, 121, 116, 246, 144, 112, 112, 131,  14,  92,  57, 120, // .yt..pp...9x
-  92, 108, 156, 236, 225,  30, 201, 211,  95, 202,  35, 193, // .l......_.#.
- 106, 155, 194,  28,  25, 121, 218,  12, 213,  75,  62, 209, // j....y...K>.
- 186, 192, 147, 189,  60, 116, 124,  35, 179, 209, 180,   9, // ....<t|#....
- 137, 139, 158, 195, 114, 250,   5, 180, 174,  89, 107,   3, // ....r....Yk.
- 141, 254, 209,  62,  78, 178, 163,  40, 121, 136, 132,  48, // ...>N..(y..0
- 121,  97, 243, 172,  43, 109,  57,  70, 134,  29, 181,  32, // ya..+m9F... 
-  64, 196, 169,  81, 154,  24,  56,  90, 188, 165, 215, 240, // @..Q..8Z....
- 133, 151, 108, 182, 104, 246,  85, 178,   7, 246,  58, 225, // ..l.h.U...:.
- 148, 253, 102, 153,  98, 252,  10, 201, 152, 168, 193, 219, // ..f.b.......
- 183, 105, 252, 125, 191, 104, 181, 234,  57,   9, 229, 160, // .i.}.h..9...
-   2, 241, 224,  62,  49, 225,  37, 253,  15, 182, 198, 195, // ...>1.%.....
-  72, 136, 232,  48, 159, 132, 235,  79, 252, 242, 228, 170, // H..0...O....
- 132, 253,  10,  66,  18, 160, 186,  68, 209, 188,  88, 251, // ...B...D..X.
- 137, 116,  76,  66,  23, 230, 239, 230, 243, 159, 207, 149, // .tLB........
- 213,  76,  48,  67, 162, 177, 255,  38, 235, 208,  55, 167, // .L0C...&..7.
- 101,  61, 127,  96,  31, 218, 149, 108,  18, 234,  10,  86, // e=.`...l...V
-  91, 133, 250,  54,  95, 179, 169, 146, 125,  72, 173, 179, // [..6_...}H..
-  42, 183, 130, 123, 236, 192, 132, 232, 164, 244, 234,  42, // *..{.......*
-  19,  31,  87, 166,  72,  53,  49, 242, 238, 206,  15, 183, // ..W.H51.....
-  72,  39, 146, 140, 176,  67, 252, 231, 143, 230,  73,  89, // H'...C....IY
- 232, 220, 103, 168, 108, 224, 162, 133,  93, 240, 193,  86, // ..g.l...]..V
- 145,  40,  28, 100, 189, 193, 185,  64,  68,  75,   3,  84, // .(.d...@DK.T
-  68,  67,  53,   4, 128,  27,   7, 149, 123, 232, 119,  56, // DC5.....{.w8
- 113,  28, 158, 165, 235,  85, 190,   9,  62,  57,  56, 146, // q....U..>98.
-  48, 188, 213, 221,   0, 109, 198,  68, 210, 213, 149, 254, // 0....m.D....
- 230, 179, 180,  68, 127, 171, 112, 105, 218, 158, 228, 217, // ...D..pi....
- 212, 167, 150, 204, 147, 226, 134, 140, 122,  12,  61,  75, // ........z.=K
-  50, 164,  82, 162, 233, 178,  52, 146,  33, 207, 116, 105, // 2.R...4.!.ti
-  75,  18, 176, 125,  30,  20,  47, 130, 226, 119, 226,  11, // K..}../..w..
- 124, 240,  67, 161, 156, 190,   5,  31, 126,  83, 205, 166, // |.C.....~S..
-  49,  28, 226,   2, 154, 128, 155, 184, 187, 166,  81, 120, // 1.........Qx
- 154,  86, 243,  51, 251, 107, 210, 147, 219, 183, 111, 193, // .V.3.k....o.
- 229, 154, 151, 131, 158, 230, 207, 128, 130, 145, 181,   0, // ............
- 130, 198, 145, 207, 234, 160, 151,  86, 189,  71,  10,  12, // .......V.G..
- 126,  15, 132, 201, 235,  42, 184, 233,   9, 144,  38,  94, // ~....*....&^
- 138,  68,  63, 201, 234,   0,  73,  19, 215,  75, 119, 203, // .D?...I..Kw.
- 210, 184, 119, 166, 209,  97, 223, 223, 162,  65, 232, 239, // ..w..a...A..
- 172,  63, 106, 238, 172,  51,  58, 107,  61, 171,  68, 105, // .?j..3:k=.Di
- 141, 146, 152, 241,   7, 109,  66,  36, 190, 249,  60,  16, // .....mB$..<.
- 151,  25, 116, 131,   6, 201,  40, 144, 121, 217, 198, 145, // ..t...(.y...
- 107, 232, 131,  25, 184, 196, 242, 109,  28,  80, 161,  31, // k......m.P..
- 102,  67,  39, 128, 206, 235,  69, 145, 161,  97,  12,  75, // fC'...E..a.K
- 222, 144, 202, 236,  40, 146, 205,  35, 145, 237, 127,  32, // ....(..#... 
-  29, 156,  37,  14,  88, 250, 114, 227, 138, 116,  89, 201, // ..%.X.r..tY.
- 128,  98,   6, 156,   6, 184, 107, 252,  94,  52, 152, 132, // .b....k.^4..
- 195, 236,  59,  27, 153, 105, 229, 174, 103,  36,  11,  62, // ..;..i..g$.>
- 118, 249, 179,  31, 100,  90,  32, 243,  25,  36, 133, 114, // v...dZ ..$.r
- 238,  49, 128, 124,  62, 128, 157, 173, 238, 201,  23, 225, // .1.|>.......
- 206, 130, 158, 249, 210, 130,  89,  58, 226, 102,  78, 190, // ......Y:.fN.
-  55, 216,  27, 208,   5, 100, 239, 175, 136,  28, 180,  25, // 7....d......
- 167, 133, 100, 188,  66, 198, 133, 105, 245,  30,  43, 103, // ..d.B..i..+g
- 213,  62, 230,  83, 137,  53, 121,  15,  24, 241,   8, 216, // .>.S.5y.....
- 115, 123, 227, 206,  92,  58,  45, 137, 190,   7, 136, 101, // s{...:-....e
- 240,  17, 246,  29, 160, 193, 153,  75, 225, 231, 165,  36, // .......K...$
- 207, 153, 113,  83, 112,  23, 108, 228, 119,  24,  61, 161, // ..qSp.l.w.=.
-  62,  45, 124, 101, 194, 168, 183, 244,  27, 230,  86, 118, // >-|e......Vv
-  96,  70,  54,  45, 164, 144, 126, 173, 244,   3, 102, 141, // `F6-..~...f.
- 222,  12,  96,  41, 117, 215,  15, 138,  20,  63, 170, 136, // ..`)u....?..
-  67,  24, 167, 221,  85,  69, 230,  73, 190, 190,  31,  20, // C...UE.I....
-   9, 213, 135, 250, 213,  34, 132,  17, 213,  93, 122, 243, // ....."...]z.
- 140,  73, 115, 235, 242, 213,  43, 250, 243, 248, 241, 114, // .Is...+....r
- 195,  26,  39, 179, 185,  50,  74, 143, 160, 208,  80, 176, // ..'..2J...P.
-  28,  35, 209, 199, 196,  49,  90, 133, 182,  57, 132,  48, // .#...1Z..9.0
- 156, 226, 195, 230, 160, 152,  48,  22, 132,  61,   1,  61, // ......0..=.=
-  26, 187, 169,  62,  61,  66,  25,  47,  44,  70, 148,  33, // ...>=B./,F.!
-   7,  44, 160, 200,  62, 251,  72, 197, 209, 106,  18, 241, // .,..>.H..j..
- 200, 105,  38, 204, 145, 164, 202,  11, 167,  91, 158, 202, // .i&......[..
-  60,  26, 131, 174,  99,  88,  37,  96, 152, 135, 252, 247, // <...cX%`....
- 148, 246, 149,  42,  94,  98, 253, 112,  60,  76, 218, 176, // ...*^b.p<L..
- 242, 178, 155, 139, 217,  43, 195, 100,  57,  42, 132, 117, // .....+.d9*.u
-  31,  29, 197,  49, 109, 192,  83, 123,   6, 248,   3, 166, // ...1m.S{....
-   3, 232,  72, 244, 131, 203, 195, 160, 179, 244, 139, 151, // ..H.........
- 240, 211,   1, 221,  86,  92,  89,  20,  99, 136, 231, 223, // ....V.Y.c...
- 130, 237,  47, 224, 219, 180,   1, 152, 146, 169,  97, 158, // ../.......a.
-  94, 177,  68, 160, 128, 107, 218, 134,  24, 229, 190, 165, // ^.D..k......
- 143, 161,  73, 130, 165,  25,  90, 198, 235, 169, 127, 249, // ..I...Z.....
- 144, 139, 157, 232, 104, 108, 139,  41, 203, 151, 115,  78, // ....hl.)..sN
- 110, 146,  31, 202, 161, 204,  62,   4, 246,  48,  92, 174, // n.....>..0..
- 102,  50,  49,  79, 199, 190,  77, 161, 215, 186, 164,  98, // f21O..M....b
-  79,  76,  44,  95, 121, 111,  49, 200,  56,   5,   9, 221, // OL,_yo1.8...
- 224, 209,  96, 146, 224,  24, 146,  51, 240, 210,  48, 179, // ..`....3..0.
- 187,  89, 234, 178,  46, 161, 231,  93,  26, 125,  64, 219, // .Y.....].}@.
- 251, 154,  47, 161, 162, 244, 148, 200,  70,  95,  34,  30, // ../.....F_".
-  42,  62, 176, 138,  60, 184, 253,  75, 160, 189, 132, 120, // *>..<..K...x
-  19,  34, 153, 105, 139, 152,  35, 142, 157, 222, 177, 112, // .".i..#....p
-  24, 149, 161,  97,  22, 230,  52, 168,  15, 236, 177,   7, // ...a..4.....
- 178,  66, 247,  62, 246, 177, 171, 197,  86, 107, 186,  18, // .B.>....Vk..
- 135, 179, 147,  23, 191, 212,  62,  76, 111,  65, 237, 220, // ......>LoA..
- 123, 236, 177,   4, 119, 152,  66,   5,  70,  83,  65, 189, // {...w.B.FSA.
- 193,  47, 150, 136,  33, 218, 230,  67,  91,  50,  74,  53, // ./..!..C[2J5
- 229, 143, 196, 108,  22,  95, 241, 231,  53, 254, 124, 193, // ...l._..5.|.
- 159, 103, 248, 243,   9, 127, 254, 194, 159,  95, 241, 231, // .g......._..
-  51, 254, 188, 195, 159,  14, 254, 116, 241, 167, 135,  63, // 3......t...?
- 219, 224, 200, 115, 190,  50,   7,  68, 114, 163, 247,  24, // ...s.2.Dr...
-  66, 239, 242, 223,  29, 254, 251, 128, 255, 254, 204, 127, // B...........
- 239, 243, 101, 100,  41, 134, 180,  70, 144, 116,  18, 210, // ..ed)..F.t..
- 166, 191, 133, 157, 200, 155, 135, 112,  48, 191, 200, 197, // .......p0...
-  60,  60, 136,  90, 199,  89,  29,  14, 141, 132, 150,  59, // <<.Z.Y.....;
- 220,  11, 113, 108, 145, 231,  74,  54, 139,  82, 203, 119, // ..ql..J6.R.w
- 195, 220,  79, 245, 109, 171,  33, 125,  49, 125, 106, 161, // ..O.m.!}1}j.
- 202, 150,  67, 250, 124, 250, 238,   4, 223, 205,  95, 157, // ..C.|....._.
-  98, 148,  25, 254, 224,   4,  99, 119, 204, 171,  72, 155, // b.....cw..H.
- 111, 186, 132, 194, 213,  70, 198,  32,  58, 197,  80, 205, // o....F. :.P.
-  46, 212,  33, 235, 115,  39, 203,  80,  43,  34,  91, 154, // ..!.s'.P+"[.
- 214, 253, 145, 240, 223,   3, 243, 203, 186, 221,  29, 191, // ............
-  31,  49,  45,  93, 252, 187,  55, 240, 138, 215, 173,  48, // .1-]..7....0
-  82, 144, 152, 210, 243, 179, 102,   8,  21,  80, 220, 151, // R.....f..P..
- 230, 114, 107,  90, 124,  65, 118,  71, 178,  63,  33, 155, // .rkZ|AvG.?!.
- 161, 144,  24,  55,  38, 155, 232, 248,  72, 206, 248, 170, // ...7&...H...
-   7, 191,  93, 130,  49, 252, 246,  14, 194,  12, 191, 219, // ..].1.......
-   7,  97, 172, 208,  65, 242, 146, 109, 125,  95,  82, 138, // .a..A..m}_R.
-  66,  39, 230, 233,  11, 231, 244,  56,   7, 247,  89, 159, // B'.....8..Y.
-  56, 167, 227,  88, 215,  91,  20,  67, 149, 138, 215, 138, // 8..X.[.C....
- 230, 237,  83, 179, 248,   2, 115, 233, 103,  52, 142, 226, // ..S...s.g4..
-  83, 181, 164, 153, 199,  42, 113, 243, 179,  24, 206, 137, // S....*q.....
-  51, 255, 114,  20, 209, 158, 236,   6, 246,  78, 191,  73, // 3.r......N.I
- 208, 223, 202, 251, 156, 218, 179, 169, 133, 155, 186, 109, // ...........m
-  83, 147,  22, 165,  54,  77, 106, 199, 166, 166, 146, 186, // S...6Mj.....
-  92, 254, 179, 101, 145, 192,  58, 180,  52,  76, 162, 103, // ...e..:.4L.g
- 243,  16, 154,  49,  40,  64,  43,  80,  81, 202, 188,  40, // ...1(@+PQ..(
-  76, 180, 178,  80, 199,  20,  42, 151, 138,  39, 216, 122, // L..P..*..'.z
- 117, 140,  66,   3, 242, 125, 218,  14, 162,  32,  27,  66, // u.B..}... .B
- 179, 235,  25, 177,  87, 237,  29,  31, 251, 131, 181, 101, // ....W......e
-  57, 241, 147,  77, 236,  89, 213,  89,  78, 126, 109, 147, // 9..M.Y.YN~m.
- 183,  75,  61,  90,  78, 255,  34, 233,  75,  22,  15,  22, // .K=ZN.".K...
- 232, 186, 242, 111, 124,  41, 218,  42, 218, 106, 171,  20, // ...o|).*.j..
- 236,  22,  90, 140,  98, 133,  61,  74,  88,  28, 203,  86, // ..Z.b.=JX..V
- 159, 246,  36, 155, 169,  75,  49,  31, 188,   8, 152,  58, // ..$..K1....:
-  92, 226, 140, 150,  34, 190,  67, 232,  18, 173,  36, 214, // ....".C...$.
- 119, 165, 110,  97, 210, 102, 131,  62, 197, 211, 247,  45, // w.na.f.>...-
- 158, 217,  91,  49,  79,  94,  17,  87, 197, 239, 179, 191, // ..[1O^.W....
-  88, 115, 121, 107,  89,  52, 184, 241,  38, 116, 192, 194, // XsykY4..&t..
-  65,  60, 249, 204,  76, 192, 252, 111,  48, 128, 128, 160, // A<..L..o0...
- 236,  42, 180, 170,  98, 134, 215, 233,  64,  25, 208, 154, // .*..b...@...
- 108, 152, 153, 206, 161, 201,  88, 150,  27,  12, 116, 132, // l.....X...t.
- 208,  54, 187,  48, 176, 209, 209, 238,  92, 100, 117, 134, // .6.0.....du.
-  22,  42,  94,   7,   4, 146,  51,  12, 221,  40,  45, 195, // .*^...3..(-.
- 108,  86, 157, 208,  79, 198,  68, 125, 209,  62, 137, 230, // lV..O.D}.>..
- 222,   9,  12, 131, 252,  75, 115,  57, 205,  95, 171, 132, // .....Ks9._..
-  37, 130, 145, 137, 209, 225,  20, 211, 121, 200,  65,  82, // %.......y.AR
- 214,  79, 212,  97, 110,  16,  41,  65, 137, 110, 181,  54, // .O.an.)A.n.6
- 152,  79,  52, 237, 153,  91,  76, 227,  24,  76, 170, 174, // .O4..[L..L..
- 169,   9,  93, 153, 102, 243, 151,  19, 123, 203, 188,  82, // ..].f...{..R
-  63,  51, 245, 141,  10, 132,  16, 236, 183, 194, 204, 174, // ?3..........
- 200, 172, 101,  23, 107, 208, 234, 110, 117, 130, 209, 224, // ..e.k..nu...
- 204,  27, 227, 194,  87, 247, 212,   4, 199,  55, 116, 205, // ....W....7t.
-  66,  75, 242,  15, 170,  34, 153,  91, 164,  53, 235, 235, // BK...".[.5..
- 221,  98,  80, 176,  41,  87,  68, 173,   7, 218,  60,  38, // .bP.)WD...<&
- 198, 145, 195, 198, 232, 246, 237, 191, 188,  89,  11,  85, // .........Y.U
- 243, 178, 170, 207,  14,  98, 101, 210,  28,  19,  54, 185, // .....be...6.
-  50,  77,  37, 112,  80, 210, 102,  91, 205,  80,  47, 177, // 2M%pP.f[.P/.
- 202, 150,  54,  74,  32,  40, 205,  70, 223, 128, 248, 185, // ..6J (.F....
-  52, 159, 145, 198, 166,  54, 201, 121, 203,  50, 245,  45, // 4....6.y.2.-
- 143, 132, 199, 114, 150, 228, 217,  52, 222, 167, 120,  40, // ...r...4..x(
- 201, 166, 242, 133, 211,  75, 194, 203,  62, 115, 170,  37, // .....K..>s.%
- 166, 204, 163,   1, 206,  41,  54,   8,  91, 181, 218, 253, // .....)6.[...
-  33, 111, 116, 192, 138, 225,  72, 123, 123, 137,   1, 115, // !ot...H{{..s
-  34, 181, 115,  24, 226, 138, 150, 128, 152,  32,  78,  37, // ".s...... N%
- 167, 161,  17, 191,  39,  23, 229, 211, 185, 121, 114, 206, // ....'....yr.
-  52,  99, 133,  40, 234, 173, 122,   2,  39, 206, 157, 210, // 4c.(..z.'...
- 207, 141, 225,  17,  62,  13, 181, 181, 127,  99, 182,  46, // ....>....c..
- 177, 129, 184, 250, 230,  23,  55, 147,  31, 224, 229, 181, // ......7.....
- 164, 103,  19, 223,  15,   8,  42, 138,   5, 255, 125, 107, // .g....*...}k
- 209, 147,  69,  94, 204,  43,  53, 224,  84, 168,  17,  52, // ..E^.+5.T..4
-  62, 161, 137,   6, 235, 156, 112, 231, 218, 204, 146,  21, // >.....p.....
- 191, 136,  81, 126,  55,  48,  79, 202,   8,  45, 172, 240, // ..Q~70O..-..
- 226, 234,  42, 137, 233,  56,  30,  43, 109,  84,  92,  42, // ..*..8.+mT.*
-  81, 255,   7,  98, 202, 138,  55,  16, 245, 155,  91,  18, // Q..b..7...[.
-  92, 157, 148,  47,  74,  63, 149,  44, 214, 192, 226, 171, // .../J?.,....
-  19, 155, 133, 244, 106,   9, 237, 115, 117, 115, 112, 211, // ....j..susp.
- 141, 194, 161, 173,  36, 102, 215, 161,  35, 104,  57, 148, // ....$f..#h9.
- 149,  44, 247, 113, 129, 187, 209, 166, 183, 221, 236, 221, // .,.q........
- 129, 163,  77,  58, 184,  13,  64, 208, 118,  36, 114, 127, // ..M:..@.v$r.
- 155,  37,  64,   6, 242, 204, 250, 139, 241, 111,  97,  20, // .%@......oa.
-   1, 185,  82, 187, 119, 135, 232,  12, 163, 214, 101, 199, // ..R.w.....e.
- 105, 108, 182,  40, 139,  13, 111, 230,  65,  18, 169,  67, // il.(..o.A..C
- 171, 250,   5, 212, 113,  88, 106, 125,  45, 149, 237, 131, // ....qXj}-...
- 128, 174, 130, 110,  11, 220,  70,  98,  34, 105, 242, 108, // ...n..Fb"i.l
-  82, 147,  50,  45,  65, 138,   3, 239,  21, 184, 219, 117, // R.2-A......u
-  66, 162, 136, 208, 144, 102,  86, 162, 156, 107,  67, 184, // B....fV..kC.
-  27,  10, 181, 110, 222,  46,  24, 138,  99, 221, 157,  94, // ...n....c..^
-  93, 221,  50, 196, 177, 145,  29,  84, 254,  55, 247, 250, // ].2....T.7..
-  82, 153, 221,  94,  26,   2, 157, 104, 103,  35,  77,  81, // R..^...hg#MQ
- 207, 213, 243,  54,   7, 183, 124, 157, 141, 217,  98, 193, // ...6..|...b.
- 239, 191, 242, 114, 165, 237, 221, 162,  54, 183,  48, 175, // ...r....6.0.
- 216, 144, 211, 104, 207, 184, 164, 188, 156,  62,  96, 128, // ...h.....>`.
- 202, 131,  90, 203, 189, 156, 176,  87,  13,  19, 244, 169, // ..Z....W....
- 220,  59,  68, 106, 156,  88,  15,   3, 144,  91, 246,  19, // .;Dj.X...[..
- 199, 143, 186, 220,   6, 136, 247, 120, 152,  59,  11, 183, // .......x.;..
-  37,   5, 217, 115,  80, 201, 105,  73, 154,   0,  35, 215, // %..sP.iI..#.
-  44,  99, 188, 132, 134, 239, 146,  18, 130, 217,  34,  26, // ,c........".
-  82, 138, 145,  88, 158, 100,  14, 226,  59, 170, 177,  29, // R..X.d..;...
- 102, 255, 169,  66,  72, 185,  19, 243, 229,  94, 100, 122, // f..BH....^dz
- 224,   8,  56, 118, 207, 237, 118,   6,  43,  67,   9, 106, // ..8v..v.+C.j
- 221,  18,  10, 175,  46,  73, 137, 100, 147, 147, 209, 162, // .....I.d....
-  80, 179,  58, 253, 132, 157, 137, 155, 227, 246,  75,  41, // P.:.......K)
- 161, 151, 243, 131, 142, 185,  81, 145,  39, 191, 233,  11, // ......Q.'...
- 248,  80, 159, 234,  34, 162,  71, 255,  22,  56,  87, 227, // .P..".G..8W.
-   9, 164,  98,  23, 219, 243, 108,  90, 198, 184, 224,  15, // ..b...lZ....
-  40, 216, 244, 201,  72,  28, 251, 174,  80, 178,  96, 145, // (...H...P.`.
- 205, 101, 138,  82, 233,  41,  77, 139,  30, 164,  56, 140, // .e.R.)M...8.
-  96,  59,  10,  11,  82,   5,  82, 252,  35, 147,  45,  12, // `;..R.R.#.-.
-  36, 240, 130, 194, 231,  73,  10,  59, 105, 195,  89,  73, // $....I.;i.YI
- 195, 203, 235, 101,  69,  76, 124,  72,   3, 120, 228, 157, // ...eEL|H.x..
- 152,  47, 183, 159, 141, 195,  53, 101,  79,  49, 167,  94, // ./....5eO1.^
- 237, 115,  85, 122, 113, 173,  37, 105, 138,  25, 197, 203, // .sUzq.%i....
- 138, 189,  28,  51, 244,  50, 102, 109,   0, 246, 116, 109, // ...3.2fm..tm
-   9, 193, 236, 170, 172,  52,  51,  51, 226, 221,  92, 101, // .....433...e
-   7,  75, 185, 251,  47, 166, 124, 229,  49, 210, 124,  17, // .K../.|.1.|.
- 145, 177, 186,  87, 113,  88,  79, 131, 144, 183,  48, 241, // ...WqXO...0.
-  72, 140, 201, 154,  72,  64, 100,   1,   5, 206, 139, 145, // H...H@d.....
-  91,  73,  14,  83,  89, 199, 107, 187, 212, 129, 252,  36, // [I.SY.k....$
- 185,  38, 140, 229, 165,  78, 236, 118, 125,  69,  51,  76, // .&...N.v}E3L
- 223,  39, 116,  93, 107,   6, 145,  15, 146, 202, 237,  72, // .'t]k......H
-  39, 137, 106, 177, 159,  56, 240, 122,  68, 239, 195,  61, // '.j..8.zD..=
- 100,  61,  44,  66,  66, 231,  27, 246, 177,  74, 150, 230, // d=,BB....J..
- 163,  13,  33,   2,  57, 254, 169,  59, 106,  96, 167,  11, // ..!.9..;j`..
-  55, 129,   8, 143, 228, 188, 158,  32,  23,   9,  68,  28, // 7...... ..D.
-  58, 146,  90,  92,  70, 219, 132, 149, 207, 181,  94,  96, // :.Z.F.....^`
- 233, 208, 251,  98, 200,  35,  66, 202, 218, 222, 141, 139, // ...b.#B.....
-  38,  18,  95, 137, 211,  25,  40, 111, 140,  69, 138, 247, // &._...(o.E..
-  44,  56, 119, 186,   6, 146, 164,   3, 248,  11, 140, 168, // ,8w.........
- 160, 134,  79, 157,  18, 211, 123, 173,  83, 209,  87,  44, // ..O...{.S.W,
- 107,  66, 163,  69,   1,  99,  86,  11,  88, 203,  57, 116, // kB.E.cV.X.9t
-  95, 205,  89,  83, 193,   4,  18, 161,  96,  71, 220, 187, // _.YS....`G..
- 140, 138,  54, 116,  62,  47,  88, 253,   0,  82,  61,  19, // ..6t>/X..R=.
- 251, 130, 152, 238, 196, 222, 140,  84, 112, 192,  29, 208, // .......Tp...
-   4,  91, 213, 201, 218, 116, 155, 150, 203,  22, 156, 137, // .[...t......
- 151, 122, 231, 238, 171, 111,   4, 228, 246, 123,  27, 144, // .z...o...{..
- 167,  10, 120, 157, 133,  67,  98, 100, 237, 127,  46, 181, // ..x..Cbd....
- 242, 202, 177,  82,  28,  26, 134,  25,  62, 102, 162, 144, // ...R....>f..
- 184,  82,  24, 121,  56,  54, 124, 236,   9, 221, 136, 247, // .R.y86|.....
- 225, 167, 152,  29, 220, 164, 198, 137,  56,  61, 230, 240, // ........8=..
- 112, 240, 217,  43,  68,  61, 127, 107, 219, 103, 161, 104, // p..+D=.k.g.h
- 196, 182, 114, 148,  41, 181, 186,  92, 148, 219, 216, 230, // ..r.).......
- 199, 216, 212, 122,  40, 181, 112, 205,  61,  23, 186, 242, // ...z(.p.=...
-  27, 200, 181,  25,   1,  77, 156,  66, 104, 101,  31, 175, // .....M.Bhe..
- 174, 134, 201,  43, 101, 255, 115,  36, 251,  35, 143,  21, // ...+e.s$.#..
- 122,  95,  97,  38, 146, 151, 168, 124, 104, 107,  39, 223, // z_a&...|hk'.
-  92, 149,   9, 109, 100,  51, 103,   0,  85, 149, 236, 169, // ...md3g.U...
- 100,  83,  56, 128, 100, 223, 252, 126,  48, 176,  39, 186, // dS8.d..~0.'.
-   9, 149,  55, 146, 228, 187,  74, 158, 168, 228, 173,  74, // ..7...J....J
-  30, 170, 228, 145,  74,  30, 171, 228, 189,  74, 158, 171, // ....J....J..
- 228,  15, 149, 188,  80, 201, 239, 166, 250, 199, 186, 152, // ....P.......
- 227, 105, 185, 171,  23, 150,   6, 131,  35,   3, 173, 228, // .i......#...
- 212, 189,  76, 246, 194,  78,  77,  63, 179, 220,   6, 230, // ..L..NM?....
-  30,  53, 217, 107,  18,  27, 163, 157,  43,  47,   8,  53, // .5.k....+/.5
- 216,  82,  52,  92, 136, 255,  53, 220,   2, 150,  97,  65, // .R4...5...aA
- 169, 159, 225, 240,   0, 187, 121,  47, 244, 104,  84, 224, // ......y/.hT.
- 132, 172, 151, 107,  35, 117,  99,   3,  44, 244, 191,  93, // ...k#uc.,..]
-  70,  87, 166,  68, 107,  35,  15, 176,  51, 218, 168, 201, // FW.Dk#..3...
- 222, 202,  21, 239, 158,  25,  84, 193,  55,  23, 203, 106, // ......T.7..j
-  32, 242,  34, 207,  44, 169, 233,   8,  68, 206, 217, 121, //  .".,...D..y
-  87, 212,  96,  29,  89, 189,  13, 248, 135, 252, 198,  39, // W.`.Y......'
-  80, 188,  37, 180,   8, 177, 112,  16, 199,  99,  89, 146, // P.%...p..cY.
- 143, 254,  32, 249, 234, 249,  65, 122, 232, 193,  11, 101, // .. ...Az...e
-  79,  28, 187, 247,  32,  83, 246,  33,  76,  42,  30,  16, // O... S.!L*..
- 125,  42,  60,  30, 200, 114, 136, 148,  68,   8, 228,  74, // }*<..r..D..J
- 129, 190,  86, 225, 128, 250,  88, 141, 142,  21, 207, 123, // ..V...X....{
- 184, 191,  28, 120, 180, 224, 201,   7,  14,  62, 129,  53, // ...x.....>.5
- 167,  71, 104, 200, 237, 181, 136, 102, 228, 185,  26,  38, // .Gh....f...&
- 155, 132,  63, 204, 227, 254, 129, 140,  27, 161,  48, 146, // ..?.......0.
-  77,  74,  78, 246, 253, 192, 132, 242, 216, 230,  12, 142, // MJN.........
- 127, 193,  81,  46,  52,  70, 106, 212,   7, 113,   9,  81, // ..Q.4Fj..q.Q
- 102, 190,  88, 205, 164,  71, 144, 254,   3, 162,  32, 154, // f.X..G.... .
- 159, 189,   7, 247, 238, 118,  58,  16, 133,   7,  82,  92, // .....v:...R.
- 236,  45,  69,  17,  18, 218,  29, 229, 120, 117,   9, 168, // .-E.....xu..
-  50, 104,  65, 157, 216, 250,  50,  93, 202, 117, 176, 158, // 2hA...2].u..
- 188, 174,  27,  42, 106,  98, 193, 137,  35, 163, 191, 250, // ...*jb..#...
- 165,  74, 233, 135, 163, 113, 211, 217, 199, 233,  57,  18, // .J...q....9.
- 152,  22,  34, 204,  65, 152, 255, 187,  92, 195,   9, 181, // ..".A.......
- 178, 207, 113, 153, 146, 239, 196, 165, 170, 140,  50, 159, // ..q.......2.
-  72,  38,  72,  23, 147, 245, 132, 184,  73,   5, 250, 225, // H&H.....I...
- 173, 100,  65, 252, 202,  14, 159,  40,   5, 234,  40,  57, // .dA....(..(9
- 101,  61, 170, 178, 126, 205, 112, 189, 242,   8, 194, 208, // e=..~.p.....
- 148, 114,  30,  87,  57, 123,  17,  49, 241, 143, 137, 127, // .r.W9{.1....
-  86,  56, 127,  30,  18,  57, 242,   7,  14, 248, 151, 148, // V8...9......
- 245,  24, 100,  93, 242,  48, 116, 221, 166,  37, 165,  45, // ..d].0t..%.-
-  45, 225, 239,  27,  70,   6, 109,  24, 202, 122, 111, 178, // -...F.m..zo.
- 232, 220, 167,  23, 124,  10, 122, 120,  46, 169, 160,   8, // ....|.zx....
- 132, 144,  78, 158, 135, 137, 140, 234, 143,  42, 235,  81, // ..N......*.Q
-  52, 215,  24,  29,  37, 134, 174, 198,  97, 226,  88, 204, // 4...%...a.X.
-  26,  87, 246, 165, 195,  88, 190, 188, 117,   0, 187, 188, // .W...X..u...
- 146,  43, 236, 125,  28,  95, 152, 248, 149,  41,  12, 193, // .+.}._...)..
-  87, 199, 231, 192,  26, 201, 190,  74, 203, 235, 109,  56, // W......J..m8
- 238,  50, 220,  63,  42, 224,  46,  76, 155, 235, 173,  85, // .2.?*..L...U
- 159,  97, 114,  99, 169,  35,  26,  77,  75,  71, 142, 239, // .arc.#.MKG..
-  71,  56, 170,  15, 243, 202, 247,  35,   1,  30,  49, 248, // G8.....#..1.
-  86,  91, 144, 239, 190,  49,  62, 214, 173,  79,  49,  99, // V[...1>..O1c
- 197, 110, 198,  55, 133,  68, 150,  90, 154,  40, 101, 154, // .n.7.D.Z.(e.
-   8, 146, 230, 220,  95, 241,  86, 230, 104,  76,  70, 244, // ...._.V.hLF.
-   1, 232,  91,  88, 224, 212, 207, 248, 118,  29,  55, 150, // ..[X....v.7.
- 208,  72, 183, 174, 203,  91, 101,  94,  34, 121, 197,  65, // .H...[e^"y.A
- 221, 212,  41, 149,  33, 139, 222, 119,  57, 228, 212,  25, // ..).!..w9...
- 178, 151, 241, 104,  51,  25, 109, 206, 193,  59, 156, 209, // ...h3.m..;..
-  18, 204, 219, 209, 178,  71,  24, 137,  94, 194, 177,  75, // .....G..^..K
- 168,  43, 190, 170,  66,  76,   6, 155,  74, 175,  49, 147, // .+..BL..J.1.
- 118, 154, 239, 175,  88, 214,   5, 197,  84, 174,  64,  89, // v...X...T.@Y
- 208,  21,  55, 146,  57, 160, 179,  48, 121,  42, 135, 235, // ..7.9..0y*..
- 179, 234,  46, 181, 188,  38, 117, 204, 231, 146,  79,  53, // .....&u...O5
- 161,  62, 142,  20, 109, 125,  65,   4, 252, 210,  47,  93, // .>..m}A.../]
- 137, 213, 116, 209, 152, 225,  19, 174,  55,  41, 121, 132, // ..t.....7)y.
- 154, 210, 245, 111,  34, 235,   6, 103,  82, 186,  38,  16, // ...o"..gR.&.
- 239,  62,  80, 107,  27,  48,  25, 228, 244,  68, 107,  96, // .>Pk.0...Dk`
- 237, 149,  38,  98, 166,  52,  19,  27, 165, 177,  49,  70, // ..&b.4....1F
-  58,  41, 153, 218, 227, 112, 100, 199, 100, 120, 219,  41, // :)...pd.dx.)
-  82, 240, 164,  14, 133,  91,  62, 164,   4, 126,  90,  34, // R....[>..~Z"
- 135, 185, 209,  62,  59,  82,  61,  20,  23, 168,  24, 135, // ...>;R=.....
- 220,  51, 169, 139, 240, 240, 223, 189, 173,  94, 191, 180, // .3.......^..
- 222, 157, 194, 120,  40,  60,  36,  76, 220, 248, 215, 100, // ...x(<$L...d
-  50, 105,   4, 199, 214, 218, 175,  11,  87,   1, 134, 143, // 2i......W...
- 189, 125, 251,  98, 183,   3,  40,  58, 103,  28,  80,  41, // .}.b..(:g.P)
-  12,  93, 168,  11,  58,  60, 146,  82,  40, 221, 105,  29, // .]..:<.R(.i.
- 110, 245,  32, 149, 238, 242,   3, 205, 114, 175, 121,   8, // n. .....r.y.
- 193, 244, 118, 243, 176, 239, 157,  58, 118,  27, 190, 216, // ..v....:v...
- 181, 150, 186, 183, 201,  32, 249, 203,  59,  86, 135, 106, // ..... ..;V.j
-  36, 106,  48,  35, 168, 193, 168,  41,  91, 151, 157, 168, // $j0#...)[...
-  49, 235, 213,  29, 210,  86,  50, 217, 121,  40,   5, 226, // 1....V2.y(..
- 112,  74,  20, 210,  41, 209,  71,  68,  80,  17,  29,  68, // pJ..).GDP..D
-  71, 174, 163,  35, 201,  86,  69, 165,  72, 218, 113,  38, // G..#.VE.H.q&
-  96, 160,  24, 145, 153, 190,  84, 126,  25, 224,  48, 100, // `.....T~..0d
- 138, 227, 221,  77,  56,  12,  61,  59, 171, 172, 116, 192, // ...M8.=;..t.
- 218, 152, 125, 189, 233,  29,   2, 139,  28,  50, 121, 194, // ..}......2y.
-  26, 200, 135, 212, 116, 112,  88, 122, 128, 148,  25, 239, // ....tpXz....
- 143,  12, 165, 121,  88, 197,  81, 178,   8,   2, 219,  11, // ...yX.Q.....
- 168, 166,  96, 194,  29, 152,  70, 233,  10, 209,  96, 199, // ..`...F...`.
-  21, 125, 199,   4, 135, 221, 249, 203, 134, 186, 213, 129, // .}..........
- 206, 165, 217,  93, 183, 186,  75, 111,  42,  26,  28, 254, // ...]..Ko*...
- 128, 230,  88, 151,  32, 154, 248,  68, 212,  33,  96, 148, // ..X. ..D.!`.
- 213,  43,   1, 140, 249,   4,  47, 114, 114,  97, 190,   5, // .+..../rra..
-  90,  79, 205,  52, 195, 106, 191,  80, 135,  48, 128, 185, // ZO.4.j.P.0..
- 213, 193,  85,   6,  36,  80,  85, 177, 184,  42,   6,  27, // ..U.$PU..*..
- 190,  21,  88, 104,  93, 168, 214, 133, 187,  41, 254, 170, // ..Xh]....)..
-  91,  39,  85,   6, 131,  52, 251, 206, 121, 232,  43, 143, // ['U..4..y.+.
- 186,  89,  92,  93,  77, 124, 115, 206, 137, 102, 218, 156, // .Y.]M|s..f..
- 219, 199, 144, 225,  21, 107,  81, 189,  45, 168, 243, 201, // .....kQ.-...
- 192, 219, 190,  29, 249,  97, 184, 205, 202, 108, 156,  62, // .....a...l.>
- 241, 213, 168,  42,  53, 162,  57, 253, 236, 177,  83, 197, // ...*5.9...S.
- 228,  87, 234, 141, 185, 250, 160, 119,  59,  34, 154, 195, // .W.....w;"..
- 164,  59,  21, 157,  34, 221, 219,  81, 109,  28, 127, 219, // .;.."..Qm...
- 188, 171,  12, 231,  54, 228,  93, 239, 223, 253, 212, 154, // ....6.].....
- 242, 103,  53, 107, 191, 150, 231, 135, 200,  49, 220, 216, // .g5k.....1..
-  19, 175, 162, 217, 160, 184, 166, 158, 116, 157,  52,  40, // ........t.4(
-  84, 153,   6,  62,  90, 140, 255,  24,  81, 107,  57, 196, // T..>Z...Qk9.
-  37, 171, 168,  81, 106, 159,  13,  11, 248, 143,  58, 172, // %..Qj.....:.
-  31, 234,  86,  69, 112, 109, 103, 156,  81,  35, 134, 222, // ..VEpmg.Q#..
- 173,   3,  12, 235, 147,  32, 102,   4, 133,  93, 245, 116, // ..... f..].t
-   5, 192,  70,  10, 147, 254,  26, 254, 194,  24, 146,  34, // ..F........"
- 158, 250,  35, 125,  28, 167,  98,  97, 206, 251, 174,  52, // ..#}..ba...4
-  71,  13, 179, 166, 185,   3, 216, 102,  55,  32, 121, 144, // G......f7 y.
- 179, 149, 105,  50, 240, 102,  97, 166,  78, 194,  99,  90, // ..i2.fa.N.cZ
- 162,   9,  61, 141, 233, 233,  71, 113,  66, 204, 247, 208, // ..=...GqB...
- 129, 135, 144, 109, 104,  96,  18, 142, 249,   0,  12, 102, // ...mh`.....f
- 225,   9,  63,  96,  32, 198,  90,  29, 206, 174, 149,  33, // ..?` .Z....!
- 160, 232,  21, 110,  57, 252, 126,  53, 231, 162, 158, 178, // ...n9.~5....
- 250, 105, 173, 145, 106, 141, 220,  41, 234, 128,  53, 174, // .i..j..)..5.
-  75, 125,  24, 147,  25, 160, 176, 178,  87, 185, 141, 167, // K}......W...
-  20,  97, 146,  60,  81, 251,  48, 204, 111, 169, 251,  17, // .a.<Q.0.o...
-  20,  70, 213, 123,  69, 121, 188,  44, 171, 203, 178,  75, // .F.{Ey.,...K
- 152, 234, 201, 173, 116, 210,  85,   9, 161, 240, 109, 149, // ....t.U...m.
- 220,  83, 201,  93, 149, 236, 168, 228, 129,  74, 126,  86, // .S.].....J~V
- 201, 125, 149, 106, 149,  18, 231,  79,  43, 200, 215, 180, // .}.j...O+...
-  41, 223, 211, 166, 240, 149,  87, 157, 182, 105,  76, 148, // ).....W..iL.
-  63, 231, 212,  99, 238, 228, 117, 134, 138, 216,  18,  68, // ?..c..u....D
-  86, 205,  89,  23, 172, 204,  12,  29,  79,  40, 224,  40, // V.Y.....O(.(
-  46, 211,  20,  10,  43, 196, 215, 195, 101,  41,  95, 184, // ....+...e)_.
-  58,   5, 230, 158,   8, 106, 238, 209,  68, 172,  81,  87, // :....j..D.QW
- 255, 129,  94,  13, 171, 208,  84, 196,  32, 102, 196, 222, // ..^...T. f..
- 247,  32, 235,  51,  52,  17,  93, 186, 145,  49,  20, 171, // . .34.]..1..
- 221,  36, 207, 252, 229,  63, 239, 192,  90, 130,  64, 251, // .$...?..Z.@.
- 204, 190,  81, 150,  36,  28, 212,  26, 173, 247,  46, 204, // ..Q.$.......
- 155, 225,  20,  29, 229,   3, 214,  32, 209, 247,  74, 125, // ....... ..J}
- 185, 123,  70, 237, 222, 200, 138,  74, 234, 211, 132, 122, // .{F....J...z
- 161,  33,  33,   4, 204,  19, 247,  98, 139,   9,  94, 253, // .!!....b..^.
- 200,  99, 109, 193,  50, 140, 141, 163, 192, 230, 139, 136, // .cm.2.......
-  58, 217, 179, 196, 130,  81, 170,  51, 135, 125,  42,  10, // :....Q.3.}*.
-  98, 152,  25,  81,  85, 100, 168, 163,  69,  20, 122,  14, // b..QUd..E.z.
-  87, 126, 169, 208, 111, 208,  68,  19,   9, 164, 100,  69, // W~..o.D...dE
-  38,   3, 142, 205,  88,  42,  71, 156, 160,  95, 255, 178, // &...X*G.._..
- 235, 144, 111, 175, 113, 202, 160,  55, 198,  80,  33, 195, // ..o.q..7.P!.
- 199, 167, 142, 178,  96,  86,  74, 103, 197, 152, 212, 100, // ....`VJg...d
- 118,  74,  53,  66,  29, 230, 213, 208,  93, 123,  97,  40, // vJ5B....]{a(
- 136,  84, 131, 207, 203, 193,  67,  42, 241, 222, 147, 146, // .T....C*....
- 204, 192,  43,  98,  10,  36, 133, 106, 113, 138, 223,  74, // ..+b.$.jq..J
-  54,  89, 102, 196, 165, 118,  45, 235,  74,  11, 184, 217, // 6Yf..v-.J...
- 108,  42, 203, 190, 238, 114,  13,  74, 220, 111, 181, 124, // l*...r.J.o.|
- 163, 163, 149, 252,  46,  60,  46, 247, 134, 151, 125,  51, // .....<....}3
-  89, 214,  28,  77,   0, 144,  42, 125, 241, 136, 122,  38, // Y..M..*}..z&
- 196, 185,   0, 157,  78, 185, 236, 134,  13, 119, 191, 144, // ....N....w..
- 138, 128, 174,   1,  79,  44,  47,  96, 162, 247, 203, 248, // ....O,/`....
-  69, 140,  52, 234, 205, 149,  98, 166, 131, 208,  34,   7, // E.4...b...".
- 118, 232,  39, 115,  26, 135, 198, 245, 148,  26,  18, 110, // v.'s.......n
-  62,   8, 185, 199,  17, 179,  41, 106,  66,  63, 177,  37, // >.....)jB?.%
- 253,  71,  60, 172, 145, 162,  37, 200, 161,  85, 137, 149, // .G<...%..U..
-  53, 227,  50,  87, 250,  19,  46,  49,  65, 137, 248,  64, // 5.2W...1A..@
- 193, 153,  84,  86, 150, 144,   9, 200,  42, 211,  51,  60, // ..TV....*.3<
-  71, 231, 172, 133, 235,  58, 221, 193, 197, 181,  11, 224, // G....:......
-  96, 190, 100,  39, 153, 215, 210, 175, 122, 234, 112, 113, // `.d'....z.pq
- 218, 106, 104, 242, 222, 229, 174,   8, 244, 196,  64, 199, // .jh.......@.
-  97,  64,  66, 128,  97, 153,  10, 243,  55,  92,  23, 149, // a@B.a...7...
-  80, 144,  84,  32, 188, 172, 131, 232, 170,  91,  32, 187, // P.T .....[ .
- 173, 170,  61, 130,  38, 228, 221,  25, 186,  12,  81, 122, // ..=.&.....Qz
-  72,  74, 188,  91,  25,  40, 215, 134, 205, 133, 101, 183, // HJ.[.(....e.
- 252,  96,  92,  38, 146, 250, 229, 146, 168,  72,   7, 221, // .`.&.....H..
- 166, 206,  48,  51,  57, 166, 114,  32,  39, 217,  15,  12, // ..039.r '...
- 168, 183, 100, 246, 175, 174,  24,  48, 111, 201, 252, 251, // ..d....0o...
- 151, 185, 179,  48, 121, 181,  48, 125, 187, 123,  68, 251, // ...0y.0}.{D.
-  49,  23, 205, 204, 109, 118, 175, 147,  73, 131,  34, 107, // 1...mv..I."k
- 129, 189, 160, 221,  88, 198, 102, 208, 190, 178,  22, 167, // ....X.f.....
-  83, 133, 186, 115, 171,  32, 152, 165,  83,   5, 159, 141, // S..s. ..S...
- 248,  89,   9, 211, 163,  44, 105,  95,  65, 235,  95, 174, // .Y...,i_A._.
-  17, 251, 162, 154, 110,  96, 254,  66, 116,  73, 170, 211, // ....n`.BtI..
- 146,  14, 195, 242, 202, 247,  90,  30, 116,  63, 125,  81, // ......Z.t?}Q
- 105,  50, 226,  50, 246, 244,  12, 249, 109, 191, 148,  25, // i2.2....m...
-  87,  34,  47, 156, 196,  15,  66, 150, 123, 173,  30,   6, // W"/...B.{...
- 247, 124, 193, 232, 124, 166, 194, 217, 243, 189,  80, 212, // .|..|.....P.
- 165, 234,  71, 148,  76,  40, 244, 177, 140, 220, 177, 127, // ..G.L(......
-  75, 247,  45,  96,  93,  87, 164, 191,  85,  10, 129,  29, // K.-`]W..U...
- 157,  27,  19, 100, 224, 178,  50, 186, 114,  17,  96, 230, // ...d..2.r.`.
- 154,  11,  57,  72, 146,  23, 203, 186, 219, 202, 226, 177, // ..9H........
- 103, 204, 180, 216, 120, 142,   6, 100,  94, 249, 145,  85, // g...x..d^..U
- 189,  96,  22,  45, 105, 236,  41, 208,  45, 210, 177,  69, // .`.-i.).-..E
-  12, 202,  53, 102,  93, 204, 140, 199, 204, 137,  71,  75, // ..5f].....GK
- 162, 179, 134,  68, 180,  29, 132,  55,   8,  43,   0, 154, // ...D...7.+..
- 207, 172, 210, 183, 189, 113, 137,   9, 214, 196, 197, 104, // .....q.....h
- 152, 139, 183,  70,  99, 173,  42, 218, 124, 217, 181, 198, // ...Fc.*.|...
-  28,  31,   2, 196,  91,  34,  82, 164, 210, 115,  14,  72, // ....["R..s.H
-  26, 115, 184, 210, 136, 176, 118, 182, 149, 222, 137, 113, // .s....v....q
- 230, 141,  51, 187, 225, 224, 168, 160,   8, 211,  59, 122, // ..3.......;z
-  43, 150, 187,  78, 232, 136, 116, 239, 239, 134, 121, 211, // +..N..t...y.
- 219, 217,  37, 216,  60,  50,  33, 163, 131, 142, 189, 153, // ..%.<2!.....
- 149,  72, 187, 226, 126, 183, 217, 140, 126, 177, 246,  54, // .H..~...~..6
-  54,  27, 206, 238, 151, 172,  96,  77, 159,  16, 167, 163, // 6.....`M....
- 124,  78, 159, 192, 191, 206,  39, 128,  57, 192,  31, 193, // |N....'.9...
- 212, 153, 113, 145, 111,  85, 111, 140,  25,  88, 152,  65, // ..q.oUo..X.A
- 116,   2,  42,  25, 230, 112, 255, 238, 137, 126, 141,  85, // t.*..p...~.U
- 113,  89, 184, 139,  61, 170, 204, 188, 176,   8, 252, 192, // qY..=.......
- 104, 164, 228, 190, 122,  88, 122, 222, 190, 190,  56,  31, // h...zXz...8.
-  52, 111, 131, 209, 138,  33, 216,  72, 205, 220, 108,  74, // 4o...!.H..lJ
-  29,  89,  67, 176,  17,  27, 130, 205, 137, 110,  46, 173, // .YC......n..
- 158, 232,  73,  30,   4, 215,  86, 198,   8,  19, 234, 123, // ..I...V....{
-   1, 138,  88, 126, 250, 165,  49,  88, 200, 118,  87, 137, // ..X~..1X.vW.
-  53,  51, 162, 162,  99, 148, 161,  25,  54,  86, 110, 137, // 53..c...6Vn.
- 168, 134, 245, 205, 111, 248, 206, 179,  14, 243, 165,  40, // ....o......(
-   2, 174,   8, 202,  61, 129,  18,  57,  23, 226, 103,   6, // ....=..9..g.
-  78, 222, 202,  75,  90,  25, 142, 107, 241, 163, 157, 148, // N..KZ..k....
- 124, 187, 182, 147, 100, 223,  36,  50, 115, 201,  25, 118, // |...d.$2s..v
-  63,  36, 173,  47, 133,   3, 224, 230,  21, 191, 209, 210, // ?$./........
- 112,  55, 132, 154, 105, 234, 182,  89, 156,   8, 209,  10, // p7..i..Y....
- 171,  33,  65, 235, 214, 170, 117, 148,  10, 148, 162,  42, // .!A...u....*
- 233,  47,  25,  39, 236,   8,  78, 184, 203, 212, 235,  75, // ./.'..N....K
-  79, 255,  78, 139,  84,  60, 131, 107, 127, 122, 100, 147, // O.N.T<.k.zd.
-  52,  85, 124,  50, 175, 116, 240, 191,  54, 143,  57, 223, // 4U|2.t..6.9.
-  27, 210, 227, 199, 170, 252, 199, 122, 249, 143,  85, 249, // .......z..U.
- 143,  85, 249,  23,  72, 253, 104,  30,  41, 245,  43, 237, // .U..H.h.).+.
- 142, 231,  70,  35, 229, 179,  87, 124, 132,  53,  30,  37, // ..F#..W|.5.%
-  24,  53,  56,  74, 249, 202,  41,  14, 170, 185,  60, 212, // .58J..)...<.
-  73, 160,  21, 239, 251,  82, 197,  50,  85, 208, 231,  11, // I....R.2U...
-  50, 241, 137, 155,  47, 125, 215,  39, 147,   6,  21, 105, // 2.../}.'...i
- 229,  45,   0, 223,  48, 236, 246,  57, 226, 252, 160,   1, // .-..0..9....
-  52, 218,   8, 100, 224,  89,  11,  34, 124, 152, 123, 194, // 4..d.Y."|.{.
- 253,  69,  62,  72, 177, 213, 148,  41, 200,  67, 164, 146, // .E>H...).C..
-  50, 178,   6, 220, 185, 152,  28, 182, 219, 147, 134, 232, // 2...........
- 181, 248,  20, 152, 249,  64, 158,  41,  29, 152, 234, 200, // .....@.)....
- 255,  18,  96,  86,  36, 120, 187,  85,  82, 230, 103,  90, // ..`V$x.UR.gZ
- 208, 239,  96, 101, 147, 183,  16, 133,  39, 143,  33, 149, // ..`e....'.!.
- 134, 244, 249, 143,  48, 121, 104, 196,  37,  47,  66, 226, // ....0yh.%/B.
- 113, 246, 249,  46, 165, 120,  70, 196, 252,  95,  87,  87, // q....xF.._WW
- 197,  39, 250, 253, 149, 126,  95, 211,  47, 145, 205, 197, // .'...~_./...
-  23, 250, 125,  71,  31, 203, 232, 208,  28, 151, 197, 235, // ..}G........
-  45, 120, 203,  12, 139,  47,  91, 197, 187, 126, 117,   9, // -x.../[..~u.
-  13, 251, 144,   7, 238, 113, 226,  95, 154, 231,  59, 161, // .....q._..;.
- 134, 242,  19, 125, 219,  29, 226, 173, 147, 237, 219, 183, // ...}........
-  63, 120, 196, 135, 125, 246,  76, 190, 175, 202, 219, 227, // ?x..}.L.....
- 228,  30, 103,  34, 234,  24, 103,  83,  29, 223, 228, 213, // ..g"..gS....
-   2,  71,  86,  23, 155, 226, 190,  36, 185,  32, 146, 142, // .GV....$. ..
- 251,  57, 231, 135,   2,  87, 211, 167, 172, 197, 118, 234, // .9...W....v.
- 113,  38,  91,  93, 211, 243, 185, 121, 150,  70, 113,   6, // q&[]...y.Fq.
- 167,  39, 229, 248, 127,  38,  96,  63, 169, 142, 195, 244, // .'...&`?....
- 196, 106,  87, 148, 228, 124, 194, 225,  40,  79, 202, 239, // .jW..|..(O..
- 178,  69, 204, 179, 249,  70, 122, 146, 213, 226, 151,  39, // .E...Fz....'
- 254,  75,  47,  61,   6, 130,  60, 161, 206, 137, 194, 253, // .K/=..<.....
-  11, 234, 173, 197, 175,  97, 241,   9,  58, 208,  24, 201, // .....a..:...
-  59, 154, 206, 165,  61, 163, 225, 232,  67, 118,  86, 119, // ;...=...CvVw
-  89, 124, 228, 131, 255, 171, 216, 198,  65,  88, 163, 163, // Y|......AX..
- 156, 157, 131,  32,  48, 129,   5, 247,  10, 204,  43,  91, // ... 0.....+[
- 166,  61, 148, 132,  25,  73, 199, 101, 147,  57, 160, 148, // .=...I.e.9..
-  45,   2,  99, 133, 242, 235, 241, 241,  94,  58, 165, 233, // -.c.....^:..
- 240,  69, 169, 218,  87, 229, 202,  98,  97, 189, 116,  79, // .E..W..ba.tO
- 174, 161, 233, 124, 228, 125, 254,  64, 182, 251, 196, 150, // ...|.}.@....
- 177, 234, 240, 197, 125,  20, 126,   9, 140, 112, 159, 139, // ....}.~..p..
- 232, 183,  96, 118, 223, 226,  96, 173,  28,  13, 116, 121, // ..`v..`...ty
-  20, 185, 142, 198,  23,  24,   6, 223, 108,  10, 255, 237, // ........l...
- 112, 194,  11,  87, 194, 189, 106,  68, 101,  40,  83, 203, // p..W..jDe(S.
- 213,  85, 161, 196,  75, 114, 211, 245,   2, 161, 193,  89, // .U..Kr.....Y
- 176, 132, 128,  53, 145, 133,  82,   5, 185, 201,  10, 156, // ...5..R.....
-  96, 114,  10,  33,  22,  13, 148,  35, 169, 239, 152, 157, // `r.!...#....
- 152,  42, 218,  48, 120, 221, 138,   9,  46,  77,  89, 110, // .*.0x....MYn
-  73,  73,  58, 106, 117, 171, 123,  79, 218, 107,  21,  14, // II:ju.{O.k..
- 101, 210, 103, 131, 163, 219, 183, 123, 165,  17,  17, 236, // e.g....{....
- 255, 140,   8,   4,  61, 189, 151,  95, 195, 149,  73, 143, // ....=.._..I.
- 156, 102, 249,  50, 195,  99, 216, 142, 248, 135, 192,  95, // .f.2.c....._
-   9, 117,  86,  48,  93, 102,  52, 215, 151, 108, 113,  95, // .uV0]f4..lq_
- 140,  78, 106,  84,   5,  22, 228, 146,  37,  14,  16, 115, // .NjT....%..s
-  20,  10, 243,  68,  64, 128, 120,  70,   5, 125,  69, 238, // ...D@.xF.}E.
- 220,  48, 213,  35, 159, 122, 105,  44, 106,  15, 185,   6, // .0.#.zi,j...
- 232, 216,  24, 208, 151, 132, 245, 233, 148, 224, 235, 255, // ............
-  91, 160, 123, 215, 221, 174,   6,  60,  32, 101, 148, 143, // [.{....< e..
-  65, 186,  17,  14,  18, 187, 249,  17,  47, 251, 132,  53, // A......./..5
- 133, 243, 232,  88, 165, 179,  48, 157, 180, 137, 119,  29, // ...X..0...w.
- 227, 247, 162,  34,  83, 129,  13, 206, 241, 211,  21, 117, // ..."S......u
-  46, 163, 147, 114,  78, 196, 236,  71, 159,  65,  21, 180, // ...rN..G.A..
- 113, 210, 171, 229,  94, 152,  92, 199, 176,  41, 217,  14, // q...^....)..
-  33,   9, 186,  23,  38,  61, 136,  52, 233, 173, 199, 111, // !...&=.4...o
- 176,   2,  44,  74,  29, 223, 148, 149,  99, 128, 125, 100, // ..,J....c.}d
- 152,  39, 226,  88,  33, 161, 141, 199,  26, 126, 214,  85, // .'.X!....~.U
-  56, 199,  38,   1, 193,   8, 239, 127, 157,  50, 142,  12, // 8.&......2..
- 188,   0, 118, 172,  62,  53,  76,  64,  76,  93, 234, 227, // ..v.>5L@L]..
-  56,  52,  59, 110, 192,   3, 149, 244,   6, 182,  33, 218, // 84;n......!.
-  26, 232, 143, 129, 254, 221,  55, 230,  53, 229,  62, 152, // ......7.5.>.
- 150, 247, 252, 169, 213, 108,  91,  97, 222,   8, 181,  64, // .....l[a...@
-  52, 194, 234,  41, 140, 162, 158, 112, 128, 156,  99, 196, // 4..)...p..c.
-  47,  96,  53,  58, 123,  37, 110, 145, 140, 244, 235, 198, // /`5:{%n.....
-  30,  74,  15, 173, 168, 150, 247, 157,  24,  98,  49, 185, // .J.......b1.
-  91, 115, 241, 146, 158, 138, 158,  12, 104, 211,  82,  14, // [s......h.R.
-   4, 133,  73, 247,  70,  64, 244,  96, 110, 133, 111, 236, // ..I.F@.`n.o.
-  73, 105, 196,  71, 196, 209, 193,  16, 115,  42,  22, 165, // Ii.G....s*..
-  53,  61,  48, 227,  32, 180,  82, 111, 205,  64,  54, 227, // 5=0. .Ro.@6.
-  10,  42,  55, 122, 126,   5,  31, 166,  25, 229,  80, 129, // .*7z~.....P.
- 126, 106, 245,  52, 141, 147,  10, 162, 129, 249, 158,  14, // ~j.4........
-  62, 244, 108,   7,  74, 127,  25, 102,   7, 242,  12, 203, // >.l.J..f....
- 133, 146, 231,  57, 165, 100, 214, 136,  65, 182, 232, 211, // ...9.d..A...
- 101,  68, 143, 199, 197,   5,  27, 209, 140, 105, 107,  77, // eD.......ikM
- 165,   8, 255,  94,  43, 194, 134,  17, 111, 240,  61,  52, // ...^+...o.=4
- 163, 188, 219, 188,  82, 235, 223,  74,  38, 214, 124,  28, // ....R..J&.|.
- 211, 242, 253, 206,  46,  62,  66, 179, 151,  67,  67,  85, // .....>B..CCU
-  16, 130,  76,  69, 167,  83, 106, 195,  89, 252, 120, 192, // ..LE.Sj.Y.x.
- 125, 155, 104,  53, 252,  33,  12,  55, 132,  52, 190, 177, // }.h5.!.7.4..
- 250,  99,   0,  91,  76, 209, 132, 172, 107, 250, 124, 144, // .c.[L...k.|.
-  15,  91,  81, 205,  18,  45, 137, 201, 192, 163, 133,  78, // .[Q..-.....N
-  87, 157, 101,  84,  50,  47, 190, 241,  79,  87,  93,  66, // W.eT2/..OW]B
-  59, 249, 172,  65, 145, 174, 169, 198, 170,  18,  70, 249, // ;..A......F.
-  34, 117,  32, 205, 232,  12, 193, 204,   6,  95, 252, 186, // "u ......_..
- 158, 156, 139, 110, 129,  65,  14, 178, 197, 210, 169,  69, // ...n.A.....E
-  22, 162,  96, 149, 158,  42, 209, 242, 122,   4, 111, 115, // ..`..*..z.os
- 117,  29, 175, 127, 236,  52,  68, 233, 223,  74, 141, 174, // u....4D..J..
-  74,  47, 236, 183,  74,  47, 172, 195, 174,  96, 164, 227, // J/..J/...`..
- 117,  29,  61, 242, 244, 111, 240, 183,  89, 233, 127, 173, // u.=..o..Y...
- 148, 146,  13, 193, 220, 255, 111, 165, 228,  55, 168, 186, // ......o..7..
- 101,   7,  71, 130,  80,  46, 194,  75, 137, 130, 116, 171, // e.G.P..K..t.
- 227,  92, 233, 166, 231,  94, 253, 198, 251,  19,  46, 182, // .....^......
-  83, 166, 210, 139,  45, 221,  98, 199, 198,  98, 148, 192, // S...-.b..b..
- 164, 161, 229,  80, 139, 215, 125, 155, 195, 101, 113,  93, // ...P..}..eq]
- 253, 197, 111, 209, 132, 179, 231, 110, 204,   0, 167, 231, // ..o....n....
- 173, 194,  42, 205, 102,  44, 237,  64,  80, 198, 102, 177, // ..*.f,.@P.f.
- 149, 223, 241,  50, 113, 124,  20, 227, 178,  44, 179,  18, // ...2q|...,..
-  17,  97,  41, 136, 144, 157,  15, 116, 130, 200,  31,  17, // .a)....t....
-  75,  55, 230,   3, 190,  59,   9, 187,   4, 211, 159, 218, // K7...;......
- 144, 110, 208, 183, 223,  41, 124,  47,  82, 153, 149, 118, // .n...)|/R..v
-  56, 222, 139,  83, 163, 185, 206, 248,  40,  82, 134, 122, // 8..S....(R.z
- 130, 150,   4, 167, 100,  37,  17,  21, 186, 215,  42, 233, // ....d%....*.
- 153,  83,  75, 136, 106,  33, 176, 202, 138, 121,  69, 103, // .SK.j!...yEg
- 161,  38, 118, 173, 209, 244,  60,  86, 111, 149, 190, 166, // .&v...<Vo...
- 233,  89, 238, 208,  55, 162, 105, 202, 160, 187,  78, 211, // .Y..7.i...N.
- 211,  47,  93,  37, 193, 156, 132,  26, 122,  15, 199, 158, // ./]%....z...
- 114, 133, 143, 184, 103, 115, 201,  88,  27,  99, 236, 189, // r...gs.X.c..
-  71, 139, 168,  17, 104, 149, 102, 159,  13,  69, 228,  42, // G...h.f..E.*
- 115,  89,  86, 253,  20,  37,  97, 122, 238, 122,  99, 170, // sYV..%az.zc.
- 188, 253, 226, 160, 130, 108, 187, 242, 235,  36, 162, 238, // .....l...$..
- 132,  93, 162, 188, 198, 111, 135,  56,   9, 113, 243,  84, // .]...o.8.q.T
- 102, 109, 195,  64,  37, 129, 135, 134, 142, 111, 224, 119, // fm.@%....o.w
-  79, 172, 117,  42,  55, 194, 162,  81, 108, 206,  54, 205, // O.u*7..Ql.6.
-  94, 247,  45,  65, 199,  78, 135,   5,  44,  95,  57, 118, // ^.-A.N..,_9v
-  47, 233,  81, 144, 158, 169, 244,  27,  95,   9,  59,  73, // /.Q....._.;I
-  14, 184, 190, 148,  79,  47, 109,   6, 105, 179,  65,  94, // ....O/m.i.A^
-  59, 144, 159, 107,  23, 109, 197, 136,  15, 169, 165,  31, // ;..k.m......
- 136, 105,  15, 220,  51, 161,  36, 113,  26,  35, 115, 225, // .i..3.$q.#s.
- 134,  87,  38,  42, 233,  55,  44,  70,  28,  71, 217, 189, // .W&*.7,F.G..
- 111,  89,  85,  96, 131, 243,  47, 182, 138,  17,   3, 245, // oYU`../.....
-  83, 191, 126,  47,  93, 250,  86, 227, 139, 113, 132, 123, // S.~/].V..q.{
- 233, 176, 205, 162, 232,  93,  37, 191,   7,  11,  86, 147, // .....]%...V.
-   8, 139, 211,  65, 234, 176, 252, 168,  57,  24,  20,  47, // ...A....9../
- 141, 101, 186,  71,  11,  38, 185, 246, 118, 160, 116, 141, // .e.G.&..v.t.
- 148, 241,  69,   4, 238,  66,  81, 252, 242,  48,  64,  52, // ..E..BQ..0@4
-  49, 171, 236, 201, 119,  32, 172, 245,  58, 226, 251,  32, // 1...w ..:.. 
-  62,  87,  44, 153, 236, 136, 205,  88, 173, 190, 204, 242, // >W,....X....
- 171, 239, 109, 122, 114, 115, 113, 237, 179,  13, 213,  11, // ..mzrsq.....
- 106, 251, 180, 238,  79, 167,   8, 221, 238, 225, 242, 187, // j...O.......
-  46,  64,  45, 252, 226,  16,  10, 127, 196,  53,  29,  56, // .@-......5.8
- 250, 164, 237,  52,  27, 235,  79,  98,  33,  50,  76,  15, // ...4..Ob!2L.
- 132, 161,   7, 249, 174,  86,   8, 135, 151,  98, 163, 235, // .....V...b..
- 110, 212, 189, 154, 138,  80,  63, 185,  31, 226,  54, 141, // n....P?...6.
- 104, 188,  68,  13, 249,  94, 237,   0, 196,  20, 107, 154, // h.D..^....k.
-  98, 250, 144, 194,   4,  27,  99,   1, 122,  21,  74,  11, // b.....c.z.J.
- 197,  29, 106, 175, 226,  18, 211,  27,  25,  68, 180,  99, // ..j......D.c
- 207, 182, 143, 161, 142, 140, 132, 112, 213, 116,  43, 119, // .......p.t+w
-  32, 152,  83,  88, 214, 180, 155,  10,  61, 145, 236,  93, //  .SX....=..]
-  93,  37, 155, 187, 180,  69,  47, 211,  80, 236, 139, 234, // ]%...E/.P...
- 254,  69, 215, 129,  29, 251, 198, 191, 126, 230, 234, 213, // .E......~...
-  51, 183,  15, 132, 180, 130, 107, 172, 221, 108,  13, 233, // 3.....k..l..
-  84, 214, 196, 158, 221,  11, 169, 172,  64, 199, 175, 226, // T.......@...
- 224,  66, 235, 208, 234,  27, 150, 131,  37, 228,  68, 248, // .B......%.D.
- 196, 115,  54, 110,  17, 208,  92, 234, 207,  53, 252,  67, // .s6n.....5.C
- 232, 250, 204, 227, 139, 155, 148, 141, 175,  50, 168, 168, // .........2..
-  58,  60, 245,  26,  80,  19, 214, 218,  72,  46, 105, 255, // :<..P...H.i.
-  36,   8, 152,  69, 160,  12, 239, 160, 230,   0,  53,  55, // $..E......57
-  13, 114,  93, 139, 107, 149,  97, 116,  16, 240, 111,  23, // .r].k.at..o.
- 143, 208,  22,  42, 237, 242,  88, 150, 198, 146,  46,  53, // ...*..X....5
-  49, 213,  71, 215, 170, 143, 170, 234, 163, 131,  62, 124, // 1.G.......>|
-  61, 223, 191, 186, 154, 220,  10, 231,  87,  87, 163,  91, // =.......WW.[
-  97, 164, 184, 251, 112, 196,  43,  61,  11,  71, 184,   9, // a...p.+=.G..
-  47, 130,  51, 207, 182, 208, 169,  90, 224,  71, 251, 165, // /.3....Z.G..
- 125, 123, 109,  20, 187, 134,  33,  32,  99, 205,  72,  38, // }{m...! c.H&
-   3,  90, 180,  96, 223, 155,  40, 163, 159, 251, 105,  24, // .Z.`..(...i.
- 219, 200,  37, 252, 188,  26, 207, 132,  78,  31, 211, 236, // ..%.....N...
- 161, 165, 226,  38, 150, 121, 236, 174,  44,   5, 220, 204, // ...&.y..,...
-  18,  73, 138,  67,  85,  38,  97,  36,   2,  63,  84, 255, // .I.CU&a$.?T.
- 184,  91, 148, 156, 235, 148, 205,  25,  25,  58, 111, 133, // .[.......:o.
-  37,  17, 192, 231, 137,  25,  12,  84, 248,  58, 187, 153, // %......T.:..
- 184,  15, 203, 111, 133,   4, 198,  19, 126, 129, 136, 142, // ...o....~...
- 195,  82, 112, 140, 144, 108, 119,  18,  76, 118, 179, 128, // .Rp..lw.Lv..
-  95, 240,  64,   9,  40, 241, 145,  56, 190, 167, 161, 149, // _.@.(..8....
-  21, 153,  55, 190, 136, 112,  56,  36,  29, 206,  32,  61, // ..7..p8$.. =
-  38, 242, 146, 224, 138, 158,  32, 129, 185,  95, 131, 118, // &..... .._.v
- 255, 242, 214, 122, 237, 192, 162, 153, 244, 211,  91, 225, // ...z......[.
- 119,  35,  94,  38,  40, 253, 206, 230, 232, 240,   7, 186, // w#^&(.......
- 214,  52,  70, 213,  45, 109,  56, 208,  32, 198, 103, 132, // .4F.-m8. .g.
-  55, 149, 129,  66, 165,   3, 228,  36,  86,  42, 109, 137, // 7..B...$V*m.
-  33, 133,  74,  21,  12,  48, 184, 115, 199, 192, 129, 237, // !.J..0.s....
- 106,  75,  41, 222,  28, 118, 154, 198, 110,  80, 135,  34, // jK)..v..nP."
- 229, 245, 251, 185,  61,  33,  99, 123,  64,  90, 243,  26, // ....=!c{@Z..
- 246,  76,  35, 148, 134,  76,  29,  21, 133,   8,  94, 193, // .L#..L....^.
- 177, 154,  51,  30,  35, 207, 133, 187, 154, 155, 148,  24, // ..3.#.......
- 139, 102, 163,  65, 179, 148, 221,  10, 159,  84, 179, 244, // .f.A.....T..
- 196, 204,  82,  86, 205, 146, 161, 107, 196, 213, 102, 153, // ..RV...k..f.
- 106, 200, 164, 122,  98,  21,  73,  21, 122,  33, 197,  86, // j..zb.I.z!.V
- 143, 179, 137,   1, 173,  23, 248,   0,  28,  59, 104,  37, // .........;h%
- 101,  62,  17,  58, 102, 158,  49, 109,  17, 172,   0, 176, // e>.:f.1m....
- 185, 114,  17, 162, 133, 177,  43,  67, 203, 141, 252,  44, // .r....+C...,
- 118, 100, 103, 203, 101,  77, 124, 150, 142, 124,  71,  76, // vdg.eM|..|GL
- 202,  23, 178, 240, 100,  20,   2, 207,  73, 192, 161,  97, // ....d...I..a
-  10,  27,   0, 122, 159,  66,  46,  97,  46,  99, 203, 120, // ...z.B.a.c.x
- 178, 112, 123, 107,  75,  46, 170, 100, 136,   5, 120, 229, // .p{kK..d..x.
- 102, 225, 162, 125, 200, 146,   1, 250, 189,  80, 233, 140, // f..}.....P..
-  40, 125,  99, 140,  86, 249, 109, 191, 100,  78, 252, 132, // (}c.V.m.dN..
-  57, 240,  99, 195, 143,  79,  45,  39, 126, 184, 228,  96, // 9.c..O-'~..`
-  56,  96,  49, 212, 105,  21,   9,  71, 200,  45, 248, 117, // 8`1.i..G.-.u
-  47,   9,  52, 117,  30, 150, 106,  63, 240,  96,  31,  33, // /.4u..j?.`.!
-  60,  64, 105, 184,  18, 123,   9, 162,  51, 158,  83, 222, // <@i..{..3.S.
- 108, 128, 173, 115,  58, 240,  22, 225,   9,  97, 187,  41, // l..s:....a.)
- 237, 154,  69, 120,  76,  79, 135, 192, 114,  66, 161, 165, // ..ExLO..rB..
-  68, 172, 105, 111,  70, 248, 247, 194,  99,  53, 159,   9, // D.ioF...c5..
- 227,  36,  53, 150, 148, 230, 168,  74, 243, 213,  95, 222, // .$5....J.._.
- 184,  53, 131, 106,  54, 213, 226,  72, 123,  71, 212, 203, // .5.j6..H{G..
- 120, 128, 205, 253, 131,  94, 176, 134, 223, 164, 151, 125, // x....^.....}
- 238, 101, 142,  22, 115, 233, 101, 223, 244,  82, 166, 185, // .e..s.e..R..
- 189, 124, 163,  94, 114, 107,  81, 245, 214, 115,  15,  27, // .|.^rkQ..s..
-  96, 173, 251, 173,   4, 206,  81, 232,  49, 213, 173, 100, // `.....Q.1..d
- 199,  55, 186, 183, 130,  43,  74, 201,  92,  95,  67, 246, // .7...+J.._C.
-  68, 168, 196, 136, 111, 136, 249, 221, 197,   3,  48, 158, // D...o.....0.
-  21, 229,  64,  17, 216, 166, 245,  13,  85,   6, 237, 227, // ..@.....U...
-  73, 123, 145, 198, 230, 254, 157,  16, 230,  12, 159, 139, // I{..........
- 227, 141, 232, 252,  93, 130,  65,  96,   9, 254, 229, 229, // ....].A`....
- 198,  93, 221, 174,  30,  80, 226, 173,  78,  64,  69, 160, // .]...P..N@E.
- 197,  30,  72, 143, 210, 135, 103, 192,  66,  90, 224, 114, // ..H...g.BZ.r
-  68, 245, 207,  68, 211, 169, 148,   1, 133, 201,   3,  96, // D..D.......`
- 254,   2,  18, 160,  48, 249,  25, 207,  96,  96, 121, 157, // ....0...``y.
-  56,  16,   1, 125, 110, 139, 149, 223, 169,  71,  51,  69, // 8..}n....G3E
- 120,  49, 154,  73, 127, 211, 204, 183, 235, 205,  96,  80, // x1.I......`P
- 178, 158, 126, 245,  37, 156, 210, 225,  10,  98, 219,   4, // ..~.%....b..
-  40, 159,  16, 140, 135,  41, 225,  30, 122, 184, 160,  15, // (....)..z...
- 176, 244,   2, 147, 124, 137, 163,  63, 153,  62, 149,  61, // ....|..?.>.=
- 198, 106, 253, 229,  30, 235, 211, 147, 161, 254,  58,   7, // .j........:.
- 214,  25, 203,  96,  29, 121, 224,  27, 143,  92, 101, 249, // ...`.y....e.
- 174,  45,  95, 160, 252, 181,  51, 204, 196, 213,  38, 246, // .-_...3...&.
- 125, 162,  44,  25,  39, 152, 192, 120, 161,  79,  14,  75, // }.,.'..x.O.K
-  69, 133,  58, 113,   3, 200,  16, 115, 103, 163,  69, 244, // E.:q...sg.E.
- 102,  64, 167,  30,  77, 194, 169, 247, 212,  16,  69,  52, // f@..M.....E4
-  26,  74,  26, 212,  41,  37,  74, 124, 106, 153, 181, 170, // .J..)%J|j...
- 224, 114, 201,   2, 102, 195,  34, 164,  10, 146, 102, 127, // .r..f."...f.
- 149,  74,  21, 246, 167,  97, 197,  10,  66, 180, 134, 233, // .J...a..B...
-  75,  57,  36,  54, 195,  21, 249, 218, 190, 167,  89,  48, // K9$6......Y0
-  74,  51,  37, 121,   1, 183,  99, 252, 112,  19, 227, 185, // J3%y..c.p...
-  25, 234, 143,  64, 215, 143, 112, 108, 197, 233, 241,  94, // ...@..pl...^
-  18, 235, 180,  96,  57, 188, 171, 116, 152, 126, 168, 219, // ...`9..t.~..
-  69,  84, 252, 103,  58,  42, 101,  61,  18, 209, 147, 233, // ET.g:*e=....
- 225,  41,  53, 242, 121, 229, 253,  11,  32, 227, 123,  77, // .)5.y... .{M
- 165,  16,   2, 119, 235,  82, 162, 244,  45,  49, 112, 229, // ...w.R..-1p.
- 241, 196,  18, 210, 107,  97, 100, 243, 238, 136, 234,  45, // ....kad....-
- 241, 189, 105,   9,  68,  68,  29, 108, 210, 176, 246, 217, // ..i.DD.l....
- 245, 137, 203,  32, 107, 159, 227, 124, 243,  71, 126, 110, // ... k..|.G~n
- 165, 155, 134, 113,  44, 211, 190,  32, 141,  80, 172, 168, // ...q,.. .P..
- 121,  48,  53, 141, 232,   6, 187, 229,  21,  60, 113, 155, // y05......<q.
-  32, 130, 249,  38,  62, 133, 227,  71,  81, 250,  34,  96, //  ..&>..GQ."`
- 141, 221,   3, 129, 200,  73,  23, 251, 155,  43, 245, 200, // .....I...+..
-  64, 164,  26,  18,  86, 199, 171,  61,  62, 216, 157, 104, // @...V..=>..h
- 121, 124, 208,  57,  40,  97,  60,  33, 195, 138, 199, 154, // y|.9(a<!....
- 239, 226, 196, 131, 104, 141, 252, 159, 174, 146, 255, 234, // ....h.......
-  48,  60,  25, 164,  65,  66, 103, 192,   9,  71, 151,   2, // 0<..ABg..G..
- 240,  26, 216,  31,  13, 224,  19, 124, 228,  15, 244,  62, // .......|...>
- 226, 212, 226, 202,  65,  29, 195, 197,   1, 200, 195, 195, // ....A.......
-  45, 239, 100, 144,   7, 153, 127, 231, 216,  16, 142,  68, // -.d........D
- 244,  13, 198, 116,  40,  78, 184, 194,   2,  21, 226,   3, // ...t(N......
-  53, 181,  21,  78,  81,  33,  11, 114, 255, 206,  84, 173, // 5..NQ!.r..T.
-  96,  77, 218,  37, 196, 119, 166, 152, 212, 229,  18,  62, // `M.%.w.....>
-  16,  18, 112,  17, 197, 107, 120,   3,  20, 175,  15, 135, // ..p..kx.....
- 136, 155, 243,  26,   8, 131, 115, 190, 192,  85,  61,  96, // ......s..U=`
-   3,  57,  41,  51,  61, 190, 130, 246, 239, 221, 144,  24, // .9)3=.......
- 167,  29, 106, 106, 200,  10, 141,  53, 102,  11,  88,   8, // ..jj...5f.X.
- 186, 230, 180,   3, 193, 247, 211,  70,  53, 161, 131, 199, // .......F5...
- 122,  18, 167,  28, 164,  91, 231, 197,   5, 138,  54, 114, // z....[....6r
-   6, 245,  75, 130, 242,   0,  94, 228, 175,  67,  72, 186, // ..K...^..CH.
- 105,  29, 239, 166,  79, 194,  75,  43, 235, 182,  82, 110, // i...O.K+..Rn
-  43,   3, 103, 217, 183,  43, 211, 122,  11, 125, 199, 169, // +.g..+.z.}..
- 151,  62, 169, 187,  62,  79,  31, 214, 247,  10, 174,   2, // .>..>O......
-  58,  74, 144, 182, 193, 130, 140,   2,   1, 250, 215, 182, // :J..........
- 131,  92,  65,  85, 114, 135, 226, 145,  55,  86,  68,  27, // ..AUr...7VD.
-  60, 146, 244, 215, 222,  12,  56,  74,  20,  60,  13, 142, // <.....8J.<..
-  98, 209,  37,  70,  47,  36,  66, 204,   3, 141,  12, 137, // b.%F/$B.....
-  48, 183, 159, 177,  88, 134, 233,  73, 255,  11,  29,  56, // 0...X..I...8
- 207, 136, 219, 248,  53,  36,  24,  72, 195, 133, 226, 147, // ....5$.H....
- 177,  26, 250, 163, 107,  67, 255, 219,  17, 119, 173, 143, // ....kC...w..
- 233, 191, 239, 158,  93, 145, 116, 174, 174,  22, 187,  29, // ....].t.....
-  58, 221, 191, 208, 177, 120, 117, 245, 140, 152, 159, 171, // :....xu.....
- 171,  95, 153,  17, 210,  68,  98, 179, 149,  29, 225,  20, // ._...Db.....
- 226,   4, 205, 157,  29, 245, 109, 111,  87, 110, 223,  70, // ......moWn.F
- 142, 133,  51, 168, 204, 207,  17, 118, 133,  96, 109,  81, // ..3....v.`mQ
-  59, 191,  33, 176,   1,  79,   5, 171,  58,  28, 177, 225, // ;.!..O..:...
-  92, 206,  74, 185, 195,  49, 114,  44, 159,  31, 154,   5, // ..J..1r,....
-  30, 113,   6, 250,  63,  84,  19, 101, 143, 129, 149, 103, // .q..?T.e...g
-  55,  81, 107,  43,  68,  55,  11, 225,  83, 248, 146, 129, // 7Qk+D7..S...
-  26,  76, 154, 204,   8, 226,   9, 156, 208, 178,  36,  61, // .L........$=
-  54,  32,  24,  32, 148,  41,  55,  62, 198, 195, 135, 125, // 6 . .)7>...}
-  82,  14,  66, 173, 221,  70,  90, 171,  98, 134, 133, 199, // R.B..FZ.b...
-  30, 251,  73,  37,  40,  24,  95,  59, 169,  24,  10, 156, // ..I%(._;....
- 149, 124, 204,  58,  20, 171,  98,  66, 152, 249, 241, 154, // .|.:..bB....
-  87,  32,  70, 173,  77, 255, 182, 181, 247,   4, 234, 142, // W F.M.......
- 126,  65, 114, 140,  32,  69, 107, 244,  38,  56,  12, 129, // ~Ar. Ek.&8..
-   4, 108,  72, 223, 155,  45, 245,  28, 250, 176, 233, 115, // .lH..-.....s
- 120,  56, 155, 235, 113, 118,  70,   8, 230, 161, 178, 239, // x8..qvF.....
- 216, 207,  97, 250, 161, 124,  95, 208,  54, 121, 132, 183, // ..a..|_.6y..
- 241,  81, 194,  86, 253,  97, 250,  24, 175, 149, 200, 188, // .Q.V.a......
- 228,  59, 194, 221, 203,  22,  29, 142, 132,  81,  60,  22, // .;.......Q<.
- 116,  50, 242,  28, 246,  14, 124,  99, 171,  10,  37,  96, // t2....|c..%`
-  54, 165,  79, 205,  92,  46,  29,  49,  12, 237,  43, 218, // 6.O....1..+.
-  73,  31,  85, 250, 144,  61,   8,  76, 248, 249,   3,  63, // I.U..=.L...?
- 159, 224, 153, 133, 172, 114, 112,  48, 142,  88, 114, 214, // .....rp0.Xr.
-  49, 178,  86,  46, 131, 214, 248,  26, 208, 214, 228,  57, // 1.V........9
-  29,  49, 129,  63, 170, 216, 242, 132, 113,   1, 212,  90, // .1.?....q..Z
- 106, 140, 105, 202, 156, 233,  88,  88, 211,  49, 158, 161, // j.i...XX.1..
- 156,  78,   0,   6, 104,   9, 187,  29,  34,  48,  65,  87, // .N..h..."0AW
-  16, 193,   8,  68, 202,  78, 151, 145, 134,  59,   1, 152, // ...D.N...;..
- 159, 124, 193,  57, 132, 242,   9, 251, 132,  39, 242, 109, // .|.9.....'.m
-  55,  45,   6,  29,  86, 162,   0, 237, 128,  84,  16, 114, // 7-..V....T.r
- 187, 105, 130, 212,  47, 190, 170, 159, 177, 138, 175,  43, // .i../......+
- 151, 230, 112, 147, 115, 109, 181,   8,  91, 185, 141,  32, // ..p.sm..[.. 
- 143, 230, 169, 152, 242, 140,  61,  38,  56, 200, 216, 167, // ......=&8...
-  17, 110,  91, 117,  94, 134, 248,   8, 211, 125, 179, 252, // .n[u^....}..
- 236, 242, 254,  36, 203, 190, 193,  67,  58, 255, 138, 119, // ...$...C:..w
- 182,  18, 182,  94, 148, 183, 115, 217,  32,  53, 225, 213, // ...^..s. 5..
- 135, 156, 116, 224,   7, 188,  23, 211,  63, 232,  27, 254, // ..t.....?...
- 128,  17,  88,  93,  47, 158,  80,  66,  34,  99,  52,  43, // ..X]/.PB"c4+
-  14, 159,  83,  63, 112,  59,  95, 191,  90, 148, 193, 248, // ..S?p;_.Z...
- 212,  48, 209, 153,  30, 255,  72, 149,  50, 250,   7,  23, // .0....H.2...
- 192,  37, 163,  61,  29, 126, 175, 228, 206,  32,  48, 249, // .%.=.~... 0.
- 198,  20, 254,  73, 121,  12,  37, 136,  34, 172, 175, 104, // ...Iy.%."..h
-  86, 205, 131, 203, 217, 226,  40, 208,  39,   8, 208,  75, // V.....(.'..K
-  63,  75, 137, 110, 141, 248, 206, 159, 149, 235, 124, 176, // ?K.n......|.
- 138,  48,  77, 135,  44, 224, 152,  74,  16, 176, 209, 105, // .0M.,..J...i
- 252, 251, 129,  13, 110,  60,  44, 175, 164,  14,   4, 146, // ....n<,.....
- 105, 170, 253,  62,  66, 166,  26, 216,  47, 141, 153, 203, // i..>B.../...
-   4, 113, 170, 240, 187, 111, 139,  83,  81, 249, 144, 167, // .q...o.SQ...
- 168,  68,  35,  87, 233, 215, 176, 120, 234,  17, 201, 237, // .D#W...x....
-  44, 200, 235,  58, 101,  69,  11, 243, 209, 104, 138, 205, // ,..:eE...h..
-  77,  96,  95,  55, 151, 186, 251, 186,  38, 217,  65,  30, // M`_7....&.A.
- 111, 112,  78,  18, 217, 137,  32,  54,  13, 232,  69, 211, // opN... 6..E.
- 120, 158, 122,  11, 120, 219, 224, 200, 189, 172,  74, 193, // x.z.x.....J.
- 122, 244,   3,  92, 208, 126,  54,  47, 126, 192, 216, 170, // z....~6/~...
- 248,  57,  44,  57, 113, 175,  82,  92,  33, 200, 183, 119, // .9,9q.R.!..w
-  36, 187,  29,  49, 115, 102, 187, 102,  66,  75, 133, 193, // $..1sf.fBK..
-  74, 133,  85,  29, 177,   1, 107, 104, 160,  28,  14,  89, // J.U...kh...Y
-  64, 149, 198, 188,  70,  47, 241, 218,  23, 207, 215, 125, // @...F/.....}
- 241, 115, 184,  43, 180, 119,  12,  78, 212,  64, 190,  61, // .s.+.w.N.@.=
- 131, 244, 230,  34, 116, 196, 224, 212, 175,   9, 196, 156, // ..."t.......
- 243, 126,  49,  94,   5, 181, 184,  53, 100, 205,  23, 250, // .~1^...5d...
- 208, 199,  22, 109,  42, 253, 190, 114,  96, 240, 118,  80, // ...m*..r`.vP
-  61, 139, 179,   2, 110,  30, 174, 166, 157, 123, 216, 228, // =...n....{..
- 168, 166, 255, 117, 205,  55, 134, 113, 240,  22, 138,  59, // ...u.7.q...;
-  17, 165,  29,  97,  33, 223,  33,  84, 238, 149,  12,  39, // ...a!.!T...'
- 147, 138, 179,  24,  86, 105, 208, 134,  10, 173, 193,  42, // ....Vi.....*
- 206,  81, 183, 158, 111, 100, 212,  41,  27, 105, 247, 117, // .Q..od.).i.u
- 233, 146,  74,  27, 143,  84,  90,  20,  67,  77,  18,  30, // ..J..TZ.CM..
- 145, 102, 148,  12,  57,  81, 158,  41, 117,  19, 215,  37, // .f..9Q.)u..%
-  80, 193, 132, 245, 149,  60, 213, 119, 254,  17,  59,   2, // P....<.w..;.
- 211,  62, 145,  12,  71,  70, 194, 164, 207,  60,  45,  55, // .>..GF...<-7
-  92,  82,  65, 154, 228,  71,  58, 253, 176,  75, 108, 136, // .RA..G:..Kl.
- 148, 191, 130, 108,  96,  28, 161, 254,  28,  20,  69, 160, // ...l`.....E.
- 127,  21, 247,  54, 162, 142, 105, 134, 135, 103, 248,  24, // ...6..i..g..
- 187, 125, 187, 235,  84, 125,   0, 167, 185, 246, 173, 120, // .}..T}.....x
- 133,  43, 195, 242, 237,  91,  80, 156, 249, 235, 157,  54, // .+...[P....6
-  33,  21,  62, 208, 107,  89,  78,   2, 242, 217,  83, 127, // !.>.kYN...S.
- 173, 128, 155, 130,  18,  34,  73, 172,  21, 169,  37, 217, // ....."I...%.
-  59,  83, 227,  16, 107, 110,  61,  99, 205, 225, 247,  24, // ;S..kn=c....
- 206,  36, 110, 225,  23,  23,  79,   3, 170, 156, 251,  52, // .$n...O....4
-  13, 156,  49,  40, 221, 195, 230, 236,  20,  54, 208,  31, // ..1(.....6..
- 144,  10,  74, 253,  53, 194, 111,  89, 111,  55, 165, 226, // ..J.5.oYo7..
-  41, 149, 198,  92,  83, 201, 156, 246, 112, 204, 127, 143, // )...S...p...
- 196,  35, 149, 113, 212, 100, 159, 105,   6, 183, 119, 205, // .#.q.d.i..w.
-  12,  93,  93, 117,  33, 252, 133,  57, 255, 160, 154,  69, // .]]u!..9...E
- 190, 177, 146, 196, 226,  73, 160, 103,  65, 241, 157,  39, // .....I.gA..'
-  81,  44, 206,  79,  60, 121, 242, 173, 243, 174, 167, 101, // Q,.O<y.....e
- 114, 249, 234,  91, 231, 132, 161,  46, 229, 148, 102, 103, // r..[......fg
- 118,  36,  79, 192, 174,  84, 104, 213,  86, 207,  87,  91, // v$O..Th.V.W[
- 197,  93,  93,  42, 227, 234,  82,  81, 214, 216,  91, 113, // .]]*..RQ..[q
- 203, 172, 200, 148, 156, 225, 156,   0, 167, 222,  62, 212, // ..........>.
- 137, 104, 227,  68, 231, 241, 156,  67, 162, 176, 218, 196, // .h.D...C....
- 225, 224, 208, 181, 201, 123, 254, 225, 213, 203,  39,   9, // .....{....'.
- 179, 190,   3, 239, 176,  30,  98, 133,  54,  57, 208, 162, // ......b.69..
-  31,  28, 242, 112, 223,  16, 151, 251,   6,  38, 140, 249, // ...p.....&..
-  18,  26,  30, 243,  57, 123, 167, 122, 164, 232, 101,  50, // ....9{.z..e2
-  45,  94,  47, 166, 225,  51,  60, 179, 254,  23, 222, 190, // -^/..3<.....
- 150, 111,  47, 179, 227, 240, 143, 242, 237,  33, 174, 168, // .o/......!..
- 195,  23, 120,  39, 194, 130, 125, 188, 114, 209,  50, 104, // ..x'..}.r.2h
-  22,  94, 190, 194, 143, 192,  53,  12, 177, 198,  27,  60, // .^....5....<
- 110,  26, 112, 205,  18,  22, 171,   1, 140,  83, 120, 220, // n.p......Sx.
- 168,  27, 223,  57, 214,  11, 112, 237,  66,  45, 218, 136, // ...9..p.B-..
- 225,  48, 115, 178,  22, 176, 156, 206, 177,  20, 106,  14, // .0s.......j.
-  50, 204, 229,  19,  50,   9, 177, 194, 134,  79, 151,  38, // 2...2....O.&
- 180,  93,  27, 141, 238,  86,   7, 186,  40, 238, 232, 172, // .]...V..(...
- 239, 141, 154,   6, 165, 174, 223, 242,  20, 101, 164,  64, // .........e.@
- 152, 205,  87,   1, 189, 172,  14,  64,  77, 135, 172, 219, // ..W....@M...
-  41,  93,   8, 185, 177, 237, 186, 187, 213,  39, 136, 218, // )].......'..
- 179,  68,  75,  79,  90,  98, 196, 129, 248, 162, 165, 215, // .DKOZb......
- 103, 182,  99, 242, 105,  74, 214, 101, 101, 148, 149, 181, // g.c.iJ.ee...
-  90, 162,  60,  95,  90,  64, 153,  70,  89,  25, 190, 171, // Z.<_Z@.FY...
- 126, 245, 188, 172, 149,  54, 187, 254,  86, 225,  92, 100, // ~....6..V..d
- 137,  37,  63,  28,  47,  54, 115,  52, 138, 175,  11, 115, // .%?./6s4...s
- 199, 126, 197, 177, 109,  73, 141,  63, 164,  48, 173,  38, // .~..mI.?.0.&
- 158,  40,  50, 119,  34,  57,   2,  31,  27,   8, 172,  95, // .(2w"9....._
- 120, 103, 213, 203, 248, 123,  73, 253, 198,  58, 173, 223, // xg...{I..:..
-  28, 166, 236, 220, 164,  47, 118,  69, 214, 200,   3,  11, // ...../vE....
- 201,  97, 247, 236, 241,  48,  60, 112, 190, 104, 125,   0, // .a...0<p.h}.
- 111, 241, 108, 160, 226, 245, 189, 150, 176, 194, 126, 129, // o.l.......~.
- 135, 232, 245, 160, 111,  92,  81, 197, 229,  73, 159,  45, // ....o.Q..I.-
- 217, 152, 160,  16,   3, 201,  42,  64, 221, 223, 116,  45, // ......*@..t-
- 134, 120, 248, 124,  28, 100,  43,  64, 143, 222,  51, 235, // .x.|.d+@..3.
-  94, 134, 105,  94,  14, 207, 183, 148, 138,  67,  30,  45, // ^.i^.....C.-
- 243, 133,  52, 228, 114,  18, 216, 121,  78, 171, 240, 185, // ..4.r..yN...
- 197, 202,  25,  13, 108, 184, 172, 183, 228,  53, 205, 179, // ....l....5..
- 108, 207,  67, 121, 136, 105, 116,  61, 182, 161,  94, 127, // l.Cy.it=..^.
- 141,  41, 183, 152, 241, 106, 224, 194, 120,  77, 124, 145, // .)...j..xM|.
- 121, 200,  17, 119,  23, 102, 134,  51,  95, 110, 161, 140, // y..w.f.3_n..
-  91,  82, 226, 210, 139,   1, 214,  12,  97,  78, 136, 146, // [R......aN..
- 117, 215,  12, 131, 156, 175, 141,  88,  98,  46, 229, 115, // u......Xb..s
- 190, 251, 137, 196,  74, 116,  33, 113, 199,   7,  29,  54, // ....Jt!q...6
-  64, 243,  22,  28, 138,  17, 202,  90, 224, 226, 101, 201, // @......Z..e.
- 160, 117,  37, 233,  75, 111, 245, 234, 173, 196,  54, 208, // .u%.Ko....6.
- 110, 128, 135,  12, 130,  98, 219, 119, 214, 207, 170, 111, // n....b.w...o
-  47, 140, 191, 210, 120,  55, 151,  90, 105,  24,  83, 225, // /...x7.Zi.S.
-  84, 116, 157, 157,  93,  73, 127,  91, 173, 131, 234,  22, // Tt..]I.[....
- 156, 202,  53, 187,   4,  82, 233, 106,  49,  90, 158, 102, // ..5..R.j1Z.f
- 243, 192, 122, 177, 247, 189,   5, 174,  49,   8, 103, 203, // ..z.....1.g.
- 160,  23, 126,  25,  33,  51,  93,  26,  36, 253, 152, 143, // ..~.!3].$...
- 150, 215, 120,  19, 199, 237, 225,  26, 117,  13, 131, 116, // ..x.....u..t
-  26,  31,  63, 236,  53, 216,   8, 161, 241, 164,  24, 109, // ..?.5......m
- 153, 183, 129, 192,  41, 187, 121, 111, 234, 230,  61, 125, // ....).yo..=}
- 247, 142, 198, 108, 194,  69, 229, 247,  44, 213, 111,  38, // ...l.E..,.o&
-  19,  64,   5,  77,  88, 193, 212,  11, 225,  40, 136, 231, // .@.MX....(..
- 203,  58, 184, 218, 123, 153, 129,  24, 219,  47, 242,  56, // .:..{..../.8
-  61, 246,  26,  58, 109, 125, 220, 111, 168,  75,  80, 100, // =..:m}.o.KPd
- 127,  80,  11, 240, 128, 235, 251, 128, 173,  87, 180, 222, // .P.......W..
- 241,  92,  19, 167,  51, 158, 123, 220,  75,  45,   5, 122, // ....3.{.K-.z
- 167, 252,  97, 204,  52,  20,  79, 251, 136, 188,  72,  16, // ..a.4.O...H.
- 255,  44, 154, 133, 235,  47,  72, 245, 176, 114, 137, 192, // .,.../H..r..
- 138,  93, 169,  56, 112,  24, 164, 108, 227,  24, 104, 195, // .].8p..l..h.
- 215,  49,  87, 199,  77, 195,  58,  31, 129,  93, 195, 226, // .1W.M.:..]..
- 153, 225, 150, 113,  80, 177, 141, 215, 165, 241, 192,  81, // ...qP......Q
-  60,  88,  98, 197, 227, 148,   8, 228,  48,  65, 160, 191, // <Xb.....0A..
- 121, 161, 233,  24, 117,  84, 211,  74,  37, 106, 132, 218, // y...uT.J%j..
- 139, 108,  20, 178,  84,  94, 231, 163, 199, 122,  62,  98, // .l..T^...z>b
- 254,  34, 171,  10, 152, 160, 201, 236,  51, 166, 104, 235, // ."......3.h.
- 243, 130, 142, 101,  14, 246,  81, 134, 117,  22,  97, 178, // ...e..Q.u.a.
- 137, 215,  29,  43, 175,  22,  61,  89, 113, 216, 100, 117, // ...+..=Yq.du
-  97, 213,  30, 207, 195,  69,  25,  65,  89,  68,  96,  71, // a....E.AYD`G
-  70, 248, 117, 102, 163,  99, 171,  87, 208, 181,  58, 247, // F.uf.c.W..:.
- 136, 110, 161,  86,  78,  17, 139,  72, 125, 147, 164,  99, // .n.VN..H}..c
-  74,  26, 171,  11, 117,   8,  35,  10,  72, 120, 103,  34, // J...u.#.Hxg"
- 206, 125, 135, 152,  52, 123, 255, 191,  68,  75, 222,  12, // .}..4{..DK..
- 247, 172,  83, 206, 125, 106, 222, 134, 101, 158,  85,  97, // ..S.}j..e.Ua
- 153, 251,  81, 248, 220, 155, 176, 229,  17,   7,  85, 181, // ..Q.......U.
-  47, 173, 174,  13, 223, 253, 205, 155,  32, 166, 242, 254, // /....... ...
-  32,  10, 230,  28,  83, 249, 149,  55, 114,  19, 158, 132, //  ...S..7r...
- 223, 213, 219, 240,  59, 252, 182,  67,  49,  47, 129, 142, // ....;..C1/..
- 238,  38, 165,  28, 169,  15, 208, 105, 219,  84, 223, 233, // .&.....i.T..
- 161,  30,  83, 153, 171,  34, 166, 114, 116, 251, 246, 220, // ..S..".rt...
- 196,  84, 222, 183, 216, 100,  82, 211, 136,  47,  86,  98, // .T...dR../Vb
- 146, 113, 239, 136, 140, 154, 209, 192,  10,  31, 154,  35, // .q.........#
- 201,   0, 189, 164, 212,  75, 128, 135,  39, 216, 173, 146, // .....K..'...
- 146,  33, 236,  83,  70,  35,  76,  25,  83,  63,  12, 159, // .!.SF#L.S?..
-  96, 148, 213,  32,  31, 134,  71, 205,  51, 140,  14,  98, // `.. ..G.3..b
- 252,  71, 234,  49,  71,  57,  46, 140,  55,  77,  57,  79, // .G.1G9..7M9O
-  23,  85, 148, 227,  71, 165, 147, 196, 107,  81, 142,  55, // .U..G...kQ.7
- 225,  28, 228, 155, 183, 176,  81, 142,   1,  58,  11, 209, // ......Q..:..
- 122, 103,  61, 247,  71, 116, 154,  67, 175, 236,  33, 238, // zg=.Gt.C..!.
- 250, 241, 240,  86, 137, 179, 195,  91, 139, 149,  40, 199, // ...V...[..(.
- 108, 160, 159, 187,  33, 142,   1, 127,  88, 145, 125, 245, // l...!...X.}.
-  10,  87, 109,  60,  13, 184,  46,  54,  81, 138, 182, 122, // .Wm<...6Q..z
- 234, 196,  56,  81,  78,   6, 227, 160,  53,  86, 199, 214, // ..8QN...5V..
-  29, 115,  50, 104, 141, 131, 113,  63, 175,  51,  80, 180, // .s2h..q?.3P.
-  57, 155, 225,   9, 199,  65, 109, 134, 199,  68, 187, 238, // 9....Am..D..
-  73, 204, 228, 156, 218, 228, 152, 201, 102,  19, 168,  28, // I.......f...
-  89,  54, 102, 114, 174,  24, 104, 202,  29, 224, 196,  76, // Y6fr..h....L
- 134,  55, 170, 189,  50, 102, 242,  99, 142, 153, 108, 219, // .7..2f.c..l.
- 216, 180,  49, 147, 171,   4,  19,  51, 185,  74, 120,  76, // ..1....3.JxL
- 240, 191, 183, 244, 161,  81, 126,  20, 229, 243, 181,  27, // .....Q~.....
-  28, 186, 162, 226, 218,   5,  68, 185,  26, 182, 239,  41, // ......D....)
-  29,  41, 184, 145, 132,  41,   3, 239, 109,  90,  35, 132, // .)...)..mZ#.
- 114, 195,  55, 224,  49,  71, 192, 209, 104,  28,  47, 230, // r.7.1G..h./.
-  80, 125,  32, 166, 199,  40, 197, 228,   3, 182, 224,  11, // P} ..(......
-  26, 233,  98, 122, 164, 115,  96, 223, 139,  25, 104, 118, // ..bz.s`...hv
- 202, 200, 145, 145,  35, 208, 112, 183, 197, 225, 136, 230, // ....#.p.....
- 240, 248,   2, 235, 114,  29, 249, 116, 102, 226, 165, 199, // ....r..tf...
- 150,  54,  35,  70,  32, 196, 198, 204,  20,  13, 138,  14, // .6#F .......
-  74, 198,  39,  52, 199,  18, 172, 150, 102, 245, 210, 248, // J.'4....f...
-  12,  50, 187, 120, 188,  12,  71,  21, 150,  73,  84, 174, // .2.x..G..IT.
-  78,  44, 150,  73, 148,  87,  98,  22, 117, 174,   8, 133, // N,.I.Wb.u...
- 208,  74,  35, 248, 182, 193,  50, 123, 136, 198,  29,  30, // .J#...2{....
- 151, 152, 134,  64, 250, 142, 166, 125,  56, 167, 191,  79, // ...@...}8..O
- 194, 197,  29,  13, 121, 226,  41, 111, 233,  33, 149,  61, // ....y.)o.!.=
-   8,  99, 182, 199,  15, 134, 155, 106, 207, 190,  48, 212, // .c.....j..0.
- 188, 165,  82,  22,   5, 156,  58, 145, 217,  31,  42, 130, // ..R...:...*.
- 125, 245,  62,  44, 147,  17,  22, 171, 167, 158,  87,   9, // }.>,......W.
- 147,  96,  69,  14,   2, 137, 154,  73, 202, 216, 116,  49, // .`E....I..t1
- 167, 245, 251, 131, 103, 129,  35,  33,  42, 253,  18, 148, // ....g.#!*...
-  69,  58, 102, 251,  28, 215, 175,  15, 109, 128,  23, 244, // E:f.....m...
-  49, 229,  70,  33, 188, 197,  27, 229,  88, 204, 251, 121, // 1.F!....X..y
- 211, 253,  49, 248,   3,   3, 133, 230, 231, 239, 225, 190, // ..1.........
- 119, 228, 189, 160, 153, 121, 169,  94, 177,  74, 220,  55, // w....y.^.J.7
- 245, 148, 210, 142,  45, 252, 251, 234,  43,  46,  39, 222, // ....-...+.'.
-   8, 215, 246,  69, 126, 158, 201, 207,  39,  57, 238, 101, // ...E~...'9.e
- 225, 103, 188, 137, 159, 218, 227,  30, 151, 213,  95, 193, // .g........_.
- 211, 189,  33, 116, 104, 180,  36, 237, 194, 160,  25,  33, // ..!th.$....!
- 209, 148, 245, 228, 254, 166,  46,  78,  44,  69, 232,  95, // .......N,E._
- 172,  46,  80, 229,  53, 137,  22, 255,  41, 179, 141, 207, // ..P.5...)...
- 194, 241, 181, 150,  63,  93, 107, 249, 217,  13,  45, 127, // ....?]k...-.
-  90, 215, 178, 185, 237,  57, 239,   4, 191,  41,  54, 236, // Z....9...)6.
- 251,  11, 112,  85,  98, 171, 223, 236, 133, 236,  95, 254, // ..pUb....._.
- 229,  52, 252, 237,  90, 239, 180,  63, 127, 131, 106,  66, // .4..Z..?..jB
- 193,  46, 165, 166, 150, 173,  47,  74,  29,  17, 239, 172, // ....../J....
- 169, 239, 124,  83, 167,  44,  32, 100, 119, 122,  70, 159, // ..|S., dwzF.
- 232, 175, 213, 182, 250, 143, 176, 219, 255, 226, 214,   6, // ............
-  64,  42, 119, 190,   5, 231,  30, 243,  15, 167,   4, 189, // @*w.........
- 103, 126, 235, 220, 235, 152,  71, 245,  56, 244,  62, 134, // g~....G.8.>.
-  68, 102,   2, 202, 207,  37,  81, 125, 244, 253, 214, 163, // Df...%Q}....
- 230,   7, 185,  32, 185, 161, 192, 157, 168, 249,  65,  61, // ... ......A=
-  10,  63, 182,  30, 247, 187, 187, 192,  51, 143,  67,  68, // .?......3.CD
- 133, 222, 234, 237,  62, 165, 229, 123, 138, 151,  29,  78, // ....>..{...N
- 223, 103,  53,  63,  12, 245, 115, 248, 120, 183,  67, 131, // .g5?..s.x.C.
- 219, 247, 244, 194, 163, 138,  45, 239, 243, 224,  41,  32, // ......-...) 
- 233, 137, 130, 120, 225,  97, 200,  14, 103,   6, 212,  70, // ...x.a..g..F
- 144, 134, 225, 219,  65,  39, 120, 228, 183, 210,  59, 111, // ....A'x...;o
- 239, 120, 146, 241, 129,  50,  58, 126,  19, 181, 248,  73, // .x...2:~...I
-  90, 125,  87,  29, 199, 124, 192, 254,  87,   7, 113, 103, // Z}W..|..W.qg
- 169, 116,  18, 126,  21, 189,  64, 231,  56, 215, 105, 233, // .t.~..@.8.i.
-  67, 223, 192, 189, 175, 129, 206,  32,  25,  29, 254, 225, // C...... ....
-  56, 184,  42,  61,  15,  92,  94, 116,   2, 173,  46, 186, // 8.*=..^t....
-  65, 138, 101, 175, 238, 113, 132, 245,  99,  95,  87, 233, // A.e..q..c_W.
- 181,  69, 215, 105,  41,  23,  42,  19,  77, 172, 161,  44, // .E.i).*.M..,
- 220, 187, 243,   8,  49, 139,  55, 239,  60, 170,  31, 209, // ....1.7.<...
- 111,   7, 121, 112, 130,  35, 154,  14, 204,  19, 115,  68, // o.yp.#....sD
- 191, 181,  20, 223,  97, 237, 136,  78, 171,  35, 186, 210, // ....a..N.#..
- 149,  74,  75, 142,  18, 156, 210,  96, 192, 174, 201, 210, // .JK....`....
-  22, 145, 175, 157, 170, 248, 239, 225,  17, 141,  72, 182, // ..........H.
- 246,  82, 152, 196, 115, 184,  71,  61, 181,  98,  35, 123, // .R..s.G=.b#{
- 127,  61,   5,  63, 162,  45,  52, 229,  84, 237, 181, 151, // .=.?.-4.T...
- 170,  23, 190, 169,  75,  24, 126, 159,  24, 231, 135, 192, // ....K.~.....
- 220, 251, 112, 103, 158, 171, 223, 225,  25,  21,  47, 218, // ..pg....../.
- 188,  44, 194, 168,  53, 175, 241, 201,  70, 177, 118,  55, // .,..5...F.v7
-  29, 232,  60, 208,  25, 107,  33, 210, 115,  22, 232, 188, // ..<..k!.s...
- 255, 117, 224, 241,  30, 150, 194, 207, 216,  65, 204, 123, // .u.......A.{
- 239,  19, 115,  56, 207,  36,  50, 187, 154,  55, 127, 245, // ..s8.$2..7..
- 158,  34, 128,  40, 205,  32,  76,  23,  23, 173, 167,  62, // .".(. L....>
- 223, 157,  90, 141, 124,  83, 235,  11, 215, 122, 243, 119, // ..Z.|S...z.w
- 181, 252, 224, 189, 167, 147,  31, 182, 251,  92, 130, 111, // ...........o
- 171, 184,  69, 249, 116, 118,  62, 106,  62,  85,  14,  67, // ..E.tv>j>U.C
-  66,  35,  30, 188, 179,  66, 194, 175, 131,  79, 129,  78, // B#...B...O.N
- 130, 175, 180,  79, 222,  25, 199, 120,   4, 223,   6, 109, // ...O...x...m
-  14, 142,  37,  41,  56, 182, 142, 235,   6,  54,  73, 189, // ..%)8....6I.
-  51,  10, 121, 180, 101, 222,   9, 161, 243, 117, 240, 133, // 3.y.e....u..
- 154,  82, 239, 228, 140, 134, 184,  44, 213, 107, 100,   7, // .R.....,.kd.
- 175,  61,  61, 168, 145, 217, 246, 188, 211, 198, 236, 159, // .==.........
- 207,  59, 188, 120,  53,  87,  99, 150, 186, 182, 231, 157, // .;.x5Wc.....
-  57,  10, 137, 159, 180,  39,  30, 219,  43,  92, 120,   8, // 9....'..+.x.
- 155,  62, 167, 146,  51,  31, 154, 107, 156, 132,  67, 104, // .>..3..k..Ch
-  65, 132, 249, 216, 103, 191,  81, 115, 185,  84, 155, 134, // A...g.Qs.T..
- 197, 175, 234,  52,  44, 222, 169, 195, 176, 184, 235,   7, // ...4,.......
-  72, 248, 140, 132,  14,  18, 118, 100,  75, 159,  81, 105, // H.....vdK.Qi
- 123,  26, 206,  29, 130,  56,  37,  26,  56, 226, 131, 142, // {....8%.8...
- 121,   7, 251,  98,   9, 226,  87,   4, 162,  49, 232, 223, // y..b..W..1..
- 179,  65,  26, 100,   7, 160, 230,  95,  17, 249,  62,  60, // .A.d..._..><
-  32, 146, 189, 198,  45, 219,  34, 216,  68, 180,  53,  51, //  ...-.".D.53
- 179, 137, 206,  42, 133,  66, 102, 149, 205, 228, 161,  81, // ...*.Bf....Q
-  48, 206,  47, 133, 244, 251,   6,  47, 141, 123, 242, 124, // 0./..../.{.|
-  36,  60, 181, 236, 144, 205,  18,  17,  37, 169, 247,  82, // $<......%..R
- 237,  17, 225, 112,  74, 243, 117, 225, 255, 247, 204, 193, // ...pJ.u.....
- 126, 184, 105, 153, 131, 225,   7, 245, 157, 137,  95, 136, // ~.i......._.
- 110, 170,  77, 146,  87, 196, 239,   7,  59, 208, 205, 107, // n.M.W...;..k
- 196, 239,  62, 136, 176,  35,  47, 183, 103, 186, 102, 135, // ..>..#/.g.f.
-  10, 149, 203, 158,  15, 180,  54, 167,   4, 185, 223, 160, // ......6.....
-  61, 134, 135,  87,  70, 185, 234,  86, 190,  66, 252,  46, // =..WF..V.B..
-  48, 131,  11, 151, 248,   5, 152,  96, 246, 207, 212,  57, // 0......`...9
- 251, 102, 219,  20,  90, 117,   1,  97,   3, 104,  85,   3, // .f..Zu.a.hU.
-  90, 184,  87, 218,  44, 105, 213, 133, 226, 245,  44, 225, // Z.W.,i....,.
- 202, 161,  85, 225, 166, 117, 179, 164,  85, 191,  51, 173, // ..U..u..U.3.
- 106, 219, 216, 183, 180, 106, 149,  96, 104, 213,  42,   1, // j....j.`h.*.
-  71, 200, 230, 178, 218, 114, 201,  20, 145, 110,   8, 161, // G....r...n..
- 205,   1,  80, 235, 174, 148, 172,  84,   2,  20, 172,  92, // ..P....T....
-  46,  12, 108,  76, 216,  70, 187,  65,  12, 189,  63,  44, // ..lL.F.A..?,
-  42, 246,  25,  46,  54,  32, 242, 232, 103, 191,  84, 169, // *...6 ..g.T.
-  44, 239, 128, 160,   3,  87, 151,  48,  59,  30, 226, 229, // ,....W.0;...
-  32,   4, 153, 169,  67, 243, 214, 119,  28, 133, 176,  21, //  ...C..w....
-  10, 241,  56,  38, 182,  21,  75,  15,  37, 253,  22, 167, // ..8&..K.%...
- 123, 154,  29, 182,  16,  38,  93,  18, 127, 234, 250,  58, // {....&]....:
- 201,  70,  16,  22, 167, 184,  99,  57, 177, 163,  28,  52, // .F....c9...4
- 124,  58, 132,  12,  29, 112, 185, 180, 187, 250,   7, 101, // |:...p.....e
- 175, 174,  26,  13, 223,  38, 221, 110,  84,   4,  78,  97, // .....&.nT.Na
- 182, 120,  18, 150, 115,  16,  54, 252, 190,  30, 142, 245, // .x..s.6.....
-  40,  27, 235, 143, 239,  95, 236, 101, 211,  89, 150, 234, // (...._.e.Y..
- 180, 240,  64, 128, 251,   7, 225, 218,  28, 120,  23, 165, // ..@......x..
- 111,  95, 210, 230,  51, 130,  54, 134, 199,  60, 155, 198, // o_..3.6..<..
- 115, 237,  37, 225, 238,  92, 100,  39, 217, 162, 128,  46, // s.%...d'....
-   6, 131,  14, 237, 209,   6,  78, 158, 136, 176,  23,   2, // ......N.....
-  52, 192,  79,  45, 253, 196, 148, 134, 159, 105, 116, 140, // 4.O-.....it.
- 128, 109, 113,  58,  91,  32, 185, 200, 142, 143,  57, 130, // .mq:[ ....9.
- 219,  56, 207, 102, 208,  92,  64, 120, 204,  36, 230, 192, // .8.f..@x.$..
- 233,  13,  49, 247, 198,  67, 116, 170, 225,  21, 152, 155, // ..1..Ct.....
- 136, 120,  22, 233,  33,  43,  34, 250,  59, 203, 179, 227, // .x..!+".;...
-  92, 207,  81, 236,  56,  90, 112, 227, 199, 121,  52,  59, // ..Q.8Zp..y4;
- 129, 119, 253,  89, 146,  33, 184,  91,  35, 201, 142, 227, // .w.Y.!.[#...
- 180, 108, 128, 222, 104, 192, 229,  43, 109,  39, 221, 112, // .l..h..+m'.p
- 188, 181, 237, 121, 152, 126, 187,  15,  95,  86, 190, 253, // ...y.~.._V..
- 219, 224,  96,  74, 169, 118, 241,  11, 219,  94, 135,  77, // ..`J.v...^.M
- 175,  65, 211,  62, 141, 138,   6,  27, 211, 210,   4,  12, // .A.>........
- 139, 131, 165, 128, 234,  38, 192, 145, 125,  17, 117, 212, // .....&..}.u.
- 229, 124, 113,  52,  31, 229, 241, 145, 118, 157, 212, 166, // .|q4....v...
- 165, 241,  87, 193,  33,  60,  61, 118,  96,  13, 136,  43, // ..W.!<=v`..+
- 216, 210, 134, 131, 103,  53, 155,  75, 197, 183, 155, 215, // ....g5.K....
- 235,  39, 254, 165,  13, 160, 198, 245, 169, 230,  16, 151, // .'..........
- 215, 179, 197,  81,  18, 207,  79,  86, 138, 178,  83, 214, // ...Q..OV..S.
- 208, 150, 172,  71,  91,  76,  89, 188, 236,  37, 124, 207, // ...G[LY..%|.
- 178,  95, 218, 104,  91,  48,  98, 194, 102, 208,  94, 196, // ._.h[0b.f.^.
-   3, 218, 214, 180, 236,  39, 122,  74, 123, 164,  49, 214, // .....'zJ{.1.
- 147, 104, 145,  20,  13,  59,  43,  70,  69,  76, 238,  87, // .h...;+FEL.W
-  56, 126, 104, 219,  20,  81,  16, 159, 210, 201, 246, 225, // 8~h..Q......
-   6, 241,  22, 149, 205, 172, 239,  20, 233, 135, 251,  24, // ............
-  12,  36, 132, 157, 155, 193,  17,   4, 244, 124,  48, 104, // .$.......|0h
-  52, 156, 111,  32, 222, 210, 244,  78,  68,  53,  60, 221, // 4.o ...ND5<.
-  88,  45,   3,  55, 181,  12, 251, 153, 132,  25,  79,  67, // X-.7......OC
- 193,  70,  92, 184, 247, 102, 139,  43, 193, 254, 113, 232, // .F...f.+..q.
- 214,  73,  75, 111, 238, 127, 182,  90, 155, 151, 122,  25, // .IKo...Z..z.
- 108, 108,  94, 162, 248, 178, 255, 167, 207, 119,  61,   8, // ll^......w=.
-  68, 189, 177, 209,  40,  97,  67, 183, 115,  61,  75, 224, // D...(aC.s=K.
- 163, 167,  65, 167, 252, 247,  40,  31, 183, 248,  99,  54, // ..A...(...c6
-  46,  27,  42, 111,  82, 225, 149,  84, 174, 221, 140, 155, // ..*oR..T....
-  28, 207, 122,  73,  60, 231,  26, 193, 102, 168, 183, 188, // ..zI<...f...
-  98, 183, 171, 239,  13, 232, 255,   0,  79, 219, 244, 180, // b.......O...
-  29,  84,  82, 181, 215, 204, 105, 183, 227, 249, 139, 180, // .TR...i.....
- 208, 199, 154, 230,  69,  98,  64, 193,  68, 234, 105, 124, // ....Eb@.D.i|
- 174, 199,  94, 207, 216, 179, 251,   3,  58, 215, 154, 166, // ..^.....:...
- 185, 198, 180,  97, 154, 107, 124, 107,   4,  13,  12, 224, // ...a.k|k....
- 137,  93, 126, 185, 145,  36, 116, 242,  29, 193, 199,   6, // .]~..$t.....
-  70, 155, 114, 208, 190,  24,  72, 224,  77, 182,   3, 178, // F.r...H.M...
-  27, 231, 173, 119,  57, 154, 207, 137, 126,  52, 235,  19, // ...w9...~4..
-  20,  10,  36, 118,  64, 199, 148, 142,  18,  72,  72, 131, // ..$v@....HH.
-  84, 241,  23,   7,  25,  47, 247,  12, 213, 230,  65, 142, // T..../....A.
-  23,  58, 135, 226, 165, 149, 157,  19,  53,  22, 181,  23, // .:......5...
- 115, 189,  79,  64,  20,  37, 190,  39, 130, 255, 120, 110, // s.O@.%.'..xn
- 175,  43,   6,  73,  48,  60,   0, 173, 105,  11, 190,  39, // .+.I0<..i..'
- 182, 196, 131, 184,  32, 107, 243, 230, 135,  99, 108,  54, // .... k...cl6
-   8, 185, 186, 202,  56,   4, 175, 121, 105, 252, 107, 251, // ....8..yi.k.
- 231,  81,  67,  77, 106, 200, 152,  17, 238, 112,  46,  16, // .QCMj....p..
-  86,  58, 238, 103, 147, 205, 107, 137, 132,  17, 113, 116, // V:.g..k...qt
- 142,  78, 162, 156, 152,  59, 243,  96, 189,  47, 195, 231, // .N...;.`./..
- 167, 154, 133, 158, 221,  55,  12, 223, 215,  75,  27, 253, // .....7...K..
-   2, 227, 164,  51,  13,  23, 208,  99, 205,   9, 227, 222, // ...3...c....
- 164,  37,  76,  27, 227, 218, 190,  50,  58, 148, 169, 141, // .%L....2:...
-  77,  88,   6,  41, 188, 219,  41, 245,  42,  83, 163, 157, // MX.)..).*S..
- 129,  92, 251, 212, 237, 117, 148,  72, 207,   3, 250, 160, // .....u.H....
-  35,  35,  73, 247,  74,  17,  55, 193,   1, 152, 253, 198, // ##I.J.7.....
- 147,   5, 244,  59, 183,  94, 102, 233, 152, 176, 164, 175, // ...;.^f.....
- 140, 198,  15, 205, 187, 146,  80, 155,  65,  21, 152,  18, // ......P.A...
- 154, 180, 193, 240, 210,  40, 209,  52,  46, 159,  63, 151, // .....(.4..?.
- 160, 166,  13, 225, 157, 123,  59,  52,  92, 147, 249, 100, // .....{;4...d
- 121,  96, 227, 119,  15, 171, 175, 232,  89, 241, 205,  72, // y`.w....Y..H
- 200,  43, 216,  17,  69, 249,  92,  19,  32, 123,  35, 168, // .+..E... {#.
- 135, 204,  69, 220, 222,  69, 192, 164, 238,  61,  24,  21, // ..E..E...=..
- 172, 205, 223,  86,  59, 146, 159, 172, 207, 223,  81, 247, // ...V;.....Q.
-  37, 255, 207, 252, 248, 200, 195,  86,  86, 180, 149,  11, // %......VV...
- 254, 155, 208, 223,  78, 123, 123, 199, 255, 211,  95,  18, // ....N{{..._.
-   2, 205, 219,  56,  61,  10, 160,  31,  31, 151,  95, 242, // ...8=....._.
- 249, 161, 151, 213, 117, 159,  12, 138,  25, 174, 194,  19, // ....u.......
- 235, 161,  65, 137,  12, 194, 178,  10,  32, 194,  27, 215, // ..A..... ...
- 184, 159,  24,  11, 162, 230,  25,  29,  56, 217,  25, 109, // ........8..m
- 181,  60,  75,  18,  86,   1, 129, 186, 116,  61, 249, 139, // .<K.V...t=..
-  37,  15,  46,  89, 129,  42, 184, 132, 226,  79, 144, 192, // %..Y.*...O..
-  78, 150, 182,  59,   7, 201, 163,  57,  28, 103, 163,   5, // N..;...9.g..
- 238, 198, 219,  35, 218, 128, 133,  54,  55, 229,  94,  99, // ...#...67.^c
-  28, 159,  54, 124,  95, 208, 232, 235, 104, 170,  67,  57, // ..6|_...h.C9
-  49,  91,  69, 150, 209,  54, 157,  85, 214,  65, 179, 108, // 1[E..6.U.A.l
-  30, 227, 171, 194,  70, 116,  52, 207, 146,  69,  65, 167, // ....Ft4..EA.
- 107, 217,  40, 226, 171, 214, 175, 220,   9,  80, 161,  77, // k.(......P.M
- 132, 107, 140,  39, 136, 186, 246, 146, 184,  75,  77,  84, // .k.'.....KMT
- 128, 215,  96, 197,  67,  74, 193, 177, 206, 179,  97, 123, // ..`.CJ....a{
- 128, 104,  47, 137,  46, 194, 198,  17,  20, 252,  26, 203, // .h/.........
-  31,  84,  79,  52,  81,   1,  55,  85,  79, 137, 100, 105, // .TO4Q.7UO.di
-  44,  57,  56,  60,  59, 193,  97,  53, 228, 203, 204, 147, // ,98<;.a5....
-  20,  81, 233,  15,  76, 232, 162,  91, 218, 113,  20, 118, // .Q..L..[.q.v
-  25, 143, 207, 131, 108,  89,  42, 147, 223, 232,  60,  83, // ....lY*...<S
- 228,   5, 131,  54, 226,  82, 183, 225,  33,  33, 174, 146, // ...6.R..!!..
- 186, 146,  84, 213, 205, 173,  23, 198, 248, 234, 170,  68, // ..T........D
- 203, 175,  35,  40, 123, 172,  36, 196, 190, 219,  77,  36, // ..#({.$...M$
-  39,  45,  91, 118,  15, 170,  71,  98, 228,  16, 214, 217, // '-[v..Gb....
-  40, 193, 221,  80,  38,  86,   8, 249,  28, 148, 162, 184, // (..P&V......
-  91,  16, 251,  27, 155,  53,  86,  53, 114, 195,  11, 253, // [....5V5r...
- 185, 121, 185,  18, 238,  38, 191, 176, 103,  61, 157,   5, // .y...&..g=..
- 221, 238, 224,  85, 132,  40,  80,  73,   6, 207, 220,  91, // ...U.(PI...[
- 132,  21, 136, 132, 102,  88, 196, 102, 231,  16,   2, 162, // ....fX.f....
-  62, 207, 223, 204, 151, 225,  13, 219,  96,  37, 235, 181, // >.......`%..
-  66, 146, 210, 147,  71, 105,  39, 173, 248, 194, 154, 106, // B...Gi'....j
- 213,  81,  59, 194, 170,  90, 130, 220,  47,   9, 163, 206, // .Q;..Z../...
-  65, 233, 191, 179,  33,  59, 249, 122,  23, 183, 111,  31, // A...!;.z..o.
- 217,  59,  66,  91, 177,  76, 240, 202, 113, 136, 135, 171, // .;B[.L..q...
- 229,   8, 170, 123, 224, 168, 151, 238,  39, 243, 231, 209, // ...{....'...
- 161, 196, 159, 135,  95, 131,  28,   7, 181,  55,  47,  89, // ...._....7/Y
-  55,  53, 126,  80,  98, 208, 100,  80,   4, 192, 162,   5, // 75~Pb.dP....
-   7, 165,  15, 119, 205,  85, 161, 246,  17,  43, 102, 191, // ...w.U...+f.
- 160,  19, 192, 235, 169,  70, 167, 164,  22, 104,  41,  50, // .....F...h)2
-  26,  33, 225, 133, 231,  25, 129,  32, 140,  66, 130,  50, // .!..... .B.2
- 233,  85, 156, 210, 174, 227, 196,  63, 225,  67,  47, 247, // .U.....?.C/.
- 151,  27, 255,  89,  92, 246,  58, 189, 222, 146, 144, 214, // ...Y..:.....
- 119,  90, 245,  98, 221, 177, 188, 252,  83, 221, 176, 197, // wZ.b....S...
- 148, 199,  17, 126, 173,  71, 145,  48, 105, 194, 104,  49, // ...~.G.0i.h1
- 109, 102,  42,  10, 245, 141,  39, 208,  60, 204, 155,  15, // mf*...'.<...
- 232, 192, 141,  91,  54,  54, 104, 235,   1,  29, 183, 117, // ...[66h....u
-  92, 213,  44, 113, 131, 125,  48,  40, 199, 152, 126, 112, // ..,q.}0(..~p
- 228, 141, 254, 188, 105, 162, 142, 238, 142,  56, 250,  78, // ....i....8.N
- 222,  50, 239, 173,   7, 116, 164, 255,  82, 199, 115,  28, // .2...t..R.s.
-  54,  38, 110,  62, 168, 140,  27, 217, 242, 123,  94, 183, // 6&n>.....{^.
-  98, 132,   9, 248, 130, 147, 150, 112,  36, 193,  17, 183, // b......p$...
- 204,  41,  43, 136, 128,  72,  23,  58,  16, 104,   8, 136, // .)+..H.:.h..
-  13, 135, 229, 173, 222, 140, 238,  95, 137, 194,  76,  48, // ......._..L0
- 147, 194, 222,  76,  19, 227,   9,  82,  67, 206, 110, 230, // ...L...RC.n.
- 199, 143, 188,  76, 209,  49,  88,  30, 219, 190, 154,   0, // ...L.1X.....
- 207, 140,  93, 162,  98, 193,  58, 122, 196, 102, 188,  24, // ..].b.:z.f..
- 223, 190, 205, 234, 135, 150,  79, 114, 114, 208, 108, 249, // ......Orr.l.
-  18,  58, 188,  20, 143, 121, 230, 213, 243, 121,  60, 106, // .:...y...y<j
- 135, 214, 214,  18, 124, 134, 248, 121,  50, 153, 192,  63, // ....|..y2..?
-  16, 215, 242,  80,  11,  18,  74, 169, 153, 163,  85, 144, // ...P..J...U.
- 131,  57, 109, 128, 235, 222,  54,   1, 175, 237,  52,  59, // .9m...6...4;
-   3, 214,  14, 117,  11,  80, 235, 229, 237, 115,  86, 116, // ...u.P...sVt
-  34,  82,  97,   7,   7, 169,  33, 129,  68, 213, 198, 186, // "Ra...!.D...
- 118, 100,  19, 118,  81,  94, 250, 165, 232, 251, 208, 249, // vd.vQ^......
- 142,  39,  56, 197,  38,  94,  57,  87,  53, 242, 136, 109, // .'8.&^9W5..m
-  11,  16, 155, 222, 245,  13, 164, 129, 176, 113, 208,  18, // .........q..
-  26, 213, 175, 232,  68, 237,  33,  96, 186,   1, 128, 235, // ....D.!`....
- 167,   0, 113, 121, 112, 111, 166, 104, 222, 120, 130,  76, // ..qypo.h.x.L
-  65,  89, 191, 155, 203,  10,  10,  12, 205, 132, 152, 213, // AY..........
-  40, 231, 196,  36, 131, 207, 229,  56, 213, 235,  38, 245, // (..$...8..&.
-  50,  29,  88,  66,  80, 174, 216, 157, 121, 131,   6, 181, // 2.XBP...y...
- 201,  12, 215, 146, 169,  75, 152,  34, 229,  40,  39, 109, // .....K.".('m
- 159,  20, 211, 196, 255, 115, 227,  23,  58, 132, 127, 218, // .....s..:...
- 160, 127, 114,  61,   9,  55,  47,  23,  75, 126, 225,  35, // ..r=.7/.K~.#
- 217,  28, 199, 160,  76, 192, 226,  44,  27, 156, 197, 144, // ....L..,....
-  30,  54, 104, 246,  90, 134, 188, 219, 184,  79, 159, 222, // .6h.Z....O..
- 223,  64, 138, 144,  81,  27, 221,  14, 167, 108,  34, 168, // .@..Q....l".
-  78,  89, 145,  40, 235, 205, 203,  24, 237, 239, 254, 178, // NY.(........
- 181, 181, 251, 167, 225,  77,  31, 134, 127, 254,  50,  56, // .....M....28
- 159,  38,  27,  68,  44, 204, 249, 140, 239, 182,  59, 141, // .&.D,.....;.
-  13, 157, 142,  50, 142,  78, 213,  88,  20, 147, 214, 131, // ...2.N.X....
- 198,  96, 247, 167,  95, 230, 167, 199,  27, 167, 177,  62, // .`.._......>
- 123, 148, 157, 135, 141, 206,  70, 103, 227,  94, 167, 179, // {.....Fg.^..
- 209, 221, 161, 210,  84, 159, 136, 162, 198,  73,  81, 204, // ....T....IQ.
- 130, 173, 173, 179, 179, 179, 246, 217, 118,  59, 203, 143, // ........v;..
- 183, 122, 157,  78, 103, 139, 234,  53, 118, 169, 223,  95, // .z.Ng..5v.._
-  96,  30, 180, 129, 186, 141, 141,  11, 254,  43, 162, 207, // `........+..
-   6, 181, 211, 216,  48, 214, 202,  13, 110,  48, 167,  82, // ....0...n0.R
-  61, 252,  94, 200, 175, 249, 106,  67,  30, 110, 224, 152, // =.^...jC.n..
- 239, 111,  48, 141, 184, 241,  47, 221, 213,  59, 250, 231, // .o0.../..;..
- 126,  99, 139, 251, 192, 233, 102, 139, 155,   2,  63, 223, // ~c....f...?.
- 125, 184, 253, 232,   1, 149, 167,  67, 175,  53, 137, 166, // }......C.5..
- 113, 114,  17, 108,  60, 204, 227,  40,  81,  27, 243,  40, // qr.l<..(Q..(
- 157, 115, 232, 200, 137, 201, 103,  82, 117, 227, 231, 222, // .s....gRu...
- 236, 188,  63, 206, 104,  78,  35,  74,  59,  50, 241, 117, // ..?.hN#J;2.u
-   2, 154, 228, 241,  56, 161, 174, 209,  75,  43,  74,  71, // ....8...K+JG
-  39,  68,  78, 148, 137,  13, 124, 219,  78, 231, 223, 252, // 'DN...|.N...
- 117, 248, 221, 157,  94, 108,  64, 202, 240, 203,  22, 202, // u...^l@.....
- 211,  12,  98,  42, 118, 255,  84, 143, 194, 134,   9, 254, // ..b*v.T.....
-  21,  16, 173, 121, 127, 135,  87, 235,  56, 154, 225, 109, // ...y..W.8..m
- 167,  92,  76, 187, 188,  61,  78,  49, 232,  59, 216, 152, // ..L..=N1.;..
-  36, 250, 188, 207, 127,  91, 227,  24,  51,  74, 139,  22, // $....[..3J..
- 108, 140, 136,  44, 155, 166,  38, 253,  56,  39, 138, 124, // l..,..&.8'.|
- 163, 219, 223,   0,   5,  72,   7,  20, 189, 192, 195, 117, // .....H.....u
- 191, 161,  30, 135, 151, 134,  15,  15,  46, 143, 142, 153, // ............
-  27,  10,  26, 255,  26,  63,  24, 143, 198, 147,   6, 123, // .....?.....{
- 171,  60, 138, 242,  71, 101, 198, 132, 255,  41,  51,  24, // .<..Ge...)3.
- 113,   7, 141, 222, 221,  14, 176,  46, 190, 137, 105, 172, // q.........i.
-  70, 247, 174, 125, 183,  21, 239, 222, 223, 217, 185, 247, // F..}........
- 115,  67, 205, 162,  84,  39, 181, 246, 108,  90, 101, 172, // sC..T'..lZe.
- 143,   1, 236, 224, 223,  90, 214, 123, 190,  76,  14,  26, // .....Z.{.L..
- 157, 118,  15,  83,  98, 242, 222, 154, 105, 107, 200,  68, // .v.Sb...ik.D
- 217, 217,  51, 185,  31, 226,  34, 209, 175, 216,  82,  61, // ..3..."...R=
- 104, 180,  76, 145, 150,  41,  67, 240, 218,  90,  83, 252, // h.L..)C..ZS.
- 134,  22, 193,   3, 220, 208, 129, 243,  57,  63, 227,  95, // ........9?._
-  55,  15, 106, 178, 191, 203, 186,  49,  84, 175, 100, 201, // 7.j....1T.d.
- 116, 117, 218,  84,  71, 228,  78,  31, 156,  57, 227, 201, // tu.TG.N..9..
- 145, 228, 170, 139, 222, 206, 189, 109, 125,  84, 166, 215, // .......m}T..
- 102, 173, 158, 247,  28, 139, 109, 179, 182, 143,  30, 244, // f.....m.....
-  38, 247, 108, 214, 227, 120,  30,  29,  37, 122,  92,  78, // &.l..x..%z.N
- 119, 151, 166, 187, 172, 232, 204,  64, 175,  87, 251, 102, // w......@.W.f
- 150, 206, 213, 251,  28, 141,  70,  54, 189, 190, 170,  78, // ......F6...N
- 217, 107,  75, 199, 121, 110,  55, 102, 134,  37,  87, 172, // .kK.yn7f.%W.
- 233, 221, 236, 174, 100, 155, 218, 122,  28,  23, 122, 236, // ....d..z..z.
- 116, 183,  67,  29,  98, 106, 141, 196, 239,  38, 120, 169, // t.C.bj...&x.
- 101, 155, 202,  28,  95,  66,  14, 125,  58,  20, 172,  64, // e..._B.}:..@
- 128,  26, 125, 208,  29,  79,  70, 247,  27, 116, 124,  71, // ..}..OF..t|G
- 249,  55, 119, 111, 220, 219, 161, 127, 163,  53, 123,  99, // .7wo.....5{c
- 187,  71, 255,  62, 168, 131, 189, 214, 250,  26, 204, 219, // .G.>........
- 114, 235,   0, 232, 110, 143, 254, 125, 176, 118,  75, 220, // r...n..}.vK.
- 187, 119, 111,  13, 144, 156, 157, 196,  96, 190,  86, 161, // .wo.....`.V.
- 228,  94, 247, 231, 163,   7, 209,  90,  40, 169, 125, 241, // .^.....Z(.}.
-  26,  72, 185, 223, 141, 142, 126, 142, 110, 130, 148, 251, // .H....~.n...
- 247, 239, 175,   5,   3,  78,  95,  55, 127,  75, 245,  62, // .....N_7.K.>
- 252, 243,  39,  28, 110, 106,   3, 156, 225, 198, 229, 134, // ..'.nj......
- 197,  99, 221,  78, 231, 223, 132, 217, 100, 123, 110, 116, // .c.N....d{nt
- 250,  27,  21,  14, 236,  83, 217, 115, 160,  94, 126,  21, // .....S.s.^~.
-  93, 251,  22, 220, 109, 212, 112, 246,  34, 110,  85, 232, // ]...m.p."nU.
-  90, 205,  47, 232, 144, 159, 182,  22, 177, 114,  18,  31, // Z./......r..
- 206, 102, 137, 222, 224,  65, 109,  60, 153, 102,  95,  99, // .f...Am<.f_c
- 181, 175, 143,  51, 189, 241, 241, 197, 234, 235, 254, 197, // ...3........
- 244,  40,  75, 212, 235, 172, 200, 220, 242, 253, 141, 229, // .(K.........
-  79, 215, 199, 125, 122, 130, 244,  72, 109,  68, 193, 105, // O..}z..HmD.i
-  60,   7,  56, 226, 145, 142, 132, 111,  84, 142, 163, 232, // <.8....oT...
- 210,  49, 179, 179,  51,  49,   7,   3, 132, 232, 121,  36, // .1..31....y$
- 136,  89, 142, 170, 229,  79,  63, 221,  81,  63, 221,   9, // .Y...O?.Q?..
- 130,  35,  14, 105, 202, 143, 209, 132, 104, 143, 141,  75, // .#.i....h..K
-  58, 180, 110, 248, 248, 159, 168, 214, 138, 132, 144,  10, // :.n.........
-  59, 167, 212, 105, 148, 123, 173, 150, 197, 195, 126, 159, // ;..i.{....~.
- 114, 205,  96, 170,  28, 254,  54, 206, 170, 156, 166, 216, // r.`...6.....
- 124,   3, 229, 190, 244,  84,  74, 235, 233, 155,  86,  78, // |....TJ...VN
-  27, 100, 235, 233, 172, 184, 104,  57, 133,  86, 154,  92, // .d....h9.V..
- 228, 137, 199,  98, 253, 249,  22, 152, 179,  25,   2, 149, // ...b........
- 158,  30, 251,  68, 216, 204, 116,  84, 108, 140, 152, 237, // ...D..tTl...
- 183,  63,  19, 200,  33,  49, 168, 149, 142, 248,  62, 179, // .?..!1....>.
-  69,  19,  60, 157,   7, 166, 108, 127, 227, 235,  98,  94, // E.<...l...b^
- 196,  19, 233, 155, 146, 202,  12, 170, 238,  28, 163, 114, // ...........r
- 112, 202, 244, 209, 162, 205, 206,  55, 230,  89,  18, 143, // p......7.Y..
-  55, 254,  21,  69, 145, 124,  32, 195, 177, 218,  48, 238, // 7..E.| ...0.
-  59, 248,   3, 108, 247, 113, 138, 243, 189,  37, 131,  48, // ;..l.q...%.0
-  75,  32, 234,  76, 118, 174, 174, 225, 183,  27, 230, 212, // K .Lv.......
- 197, 141, 202, 164, 185,  24, 193, 247, 251,  63,  92, 164, // .........?..
- 107, 227, 191, 214, 253, 106,  97,  75, 245,  17, 105,  61, // k....jaK..i=
- 242, 174, 149,   6, 100, 168, 141, 174, 191, 113,   7, 109, // ....d....q.m
- 114,  53, 226,  35, 132, 154,  17, 216, 188,   9, 250,  54, // r5.#.......6
-   4, 152,  43,  26,  66,  39,  73,  60, 155, 199, 243, 254, // ..+.B'I<....
-   6, 163, 161, 150,   4,  30, 167,  86, 206, 136,  78, 117, // .......V..Nu
- 137, 141,  19,  34, 136, 116,  90, 238, 245, 206,  53, 192, // ...".tZ...5.
- 228, 241, 125, 168, 125, 184,   3, 214, 171,  31,  98,  79, // ..}.}.....bO
-  78,   8, 230,  30, 108, 111, 239, 240, 183, 208, 106,  87, // N...lo....jW
- 245, 206, 204,  86,  93, 169,  36,  39, 177,  79, 139,  47, // ...V].$'.O./
- 107,  79, 128,  93,   2, 140,  83, 212,  28,  61,  62, 224, // kO.]..S..=>.
- 188,   4, 142, 213, 146, 181,  83, 202, 151,  45,  33,  55, // ......S..-!7
-  84, 215, 183, 203,  90,  40,  54, 244,  93,  79, 224, 244, // T...Z(6.]O..
- 250, 100,  45, 203, 246, 118,  55, 120,  88,  67, 136,  54, // .d-..v7xXC.6
- 194,   6, 115,  97, 141,   3, 234, 165,  78, 219, 153,  85, // ..sa....N..U
- 223,   1,  82, 141,  70, 232, 165,  85, 155, 227, 218,  25, // ..R.F..U....
- 225, 223, 220,  62,  95, 204, 161, 121, 211, 224, 182,  29, // ...>_..y....
-  98, 185, 101, 130, 177,  57,  21, 202, 189, 227, 166, 112, // b.e..9.....p
- 145, 246, 181,  34, 181,  20, 238, 215,  73, 185, 252,   1, // ..."....I...
-  50, 218, 184,  21,  79, 103,  89,  94,  16, 225,  77,  59, // 2...OgY^..M;
-  69,  36, 118,   4,  99,  68, 110,  39,  52,  95, 132,  53, // E$v.cDn'4_.5
-  54, 236, 114, 182, 133,  50, 168, 186, 172, 222, 165,  67, // 6.r..2.....C
- 121, 223, 189, 179, 182, 191,  26,  89,  97,  22,  84, 230, // y......Ya.T.
- 236, 102, 204, 224,  46, 236,  77, 216, 201,  93, 111, 131, // .f....M..]o.
- 149, 168,  57, 119, 199, 216,  13, 179, 130, 103,  28, 176, // ..9w.....g..
- 119, 207, 113, 193,  54, 138,  65, 167, 130, 252,  85, 240, // w.q.6.A...U.
- 172, 145, 114,  46, 114, 152, 159,  68,  99,  64, 140, 236, // ..r.r..Dc@..
- 117,  59, 159, 172, 246, 141,  81, 102, 139,  58,  42,  16, // u;....Qf.:*.
- 236, 115, 195,  80,  86, 112,  73,  13,  65,  93,  35,  61, // .s.PVpI.A]#=
- 174, 237,  78, 183,  92, 181,  59,  21, 184, 200,  85, 156, // ..N...;...U.
- 184,  66, 247,  80, 246,  26, 120, 169, 195, 247, 141,  40, // .B.P..x....(
- 164, 234, 240,   6,  28, 178, 180, 235,  30, 156,  96,  87, // ..........`W
- 174,   7, 206,  21, 194, 137,  70, 180,  81, 213, 195,  85, // ......F.Q..U
- 244, 169, 198,  14, 101,  91,  60,  66, 163,  57,  62,  45, // ....e[<B.9>-
-  37, 234, 211,  35,  98,  95,  54, 159,  41, 235, 108,  11, // %..#b_6.).l.
- 183, 215, 235, 233, 237,  27,  74, 150, 233,  63,  24, 104, // ......J..?.h
- 141, 140, 171, 239,  40,   3,  22, 107, 166, 187,  94, 233, // ....(..k..^.
- 198, 189, 247, 147, 113, 191, 222,  26, 197, 249,  40, 209, // ....q.....(.
-  14, 246, 187, 121, 143,  56, 123,  97, 237,  78,  96, 228, // ...y.8{a.N`.
- 228, 182,  74, 104,  78, 235, 212,  33, 174, 122, 163, 157, // ..JhN..!.z..
- 254, 245,  82,  57, 207, 130,  45, 163, 239, 222, 229,   1, // ..R9..-.....
- 254, 212,  22, 117,   2, 222, 199, 246, 238,  34,  32,  66, // ...u....." B
-  36, 137, 176,  78,  37, 234, 236,  89, 214, 187, 164, 244, // $..N%..Y....
- 218, 247, 132, 251,  46, 105,  84, 106, 128, 166, 188, 136, // .....iTj....
-   9, 158,  90, 252,  97, 193,   6, 124, 214, 108, 172, 219, // ..Z.a..|.l..
-  41, 210, 233, 223, 239,  20, 183, 156,  33,  19,  28,  34, // ).......!.."
- 125,  45, 172,  75, 149,  15,  57, 101, 112, 141,  55, 147, // }-.K..9ep.7.
- 137, 250, 193, 218, 185, 251, 127,  13, 118, 113,   7,  80, // ........vq.P
-  97, 151, 251,  46, 118,  89,  33,  17,  86, 209,   6,  53, // a...vY!.V..5
-  79, 187, 250, 232,  91,  76, 144,  49,  35, 242,  46, 135, // O...[L.1#...
-  33, 166,  45, 220, 154, 102, 223, 215,  36,  95,  75, 193, // !.-..f..$_K.
- 198, 147, 161, 184, 180, 112,  73, 228,  53,  26, 125, 103, // .....pI.5.}g
- 241, 236, 197,  83, 127, 131,  13,  63,  48, 171, 125,  44, // ...S...?0.},
- 133, 125, 194,   4, 218, 162,  73,   2, 238, 125, 206, 104, // .}....I..}.h
- 215,   8, 196, 218, 219, 171,  43, 109,  18, 110, 154, 235, // ......+m.n..
- 231,  81,  58,  78, 244,  15, 169, 184, 149,   9, 198,  65, // .Q:N.......A
- 236, 124, 210, 232,  68, 143, 190, 221, 176,  73, 175,  45, // .|..D....I.-
- 103, 170, 214,  34,  53,  65,  28, 245,   6, 203, 185, 146, // g.."5A......
- 111, 134, 206,  73, 176,  81, 134,  77, 252, 236, 241,  58, // o..I.Q.M...:
- 131, 213, 218, 104, 109, 108,  19, 232, 213, 218,  40,  81, // ...hml....(Q
- 138,  73, 248, 239, 113, 201,  15, 208, 194, 136, 248, 148, // .I..q.......
- 235, 116, 147,  43, 182, 185,  62, 105, 238, 204, 214, 104, // .t.+..>i...h
- 235,  27,   9, 225,  85,  86, 121, 237, 126, 169,  45, 149, // ....UVy.~.-.
-   8, 197, 168,  37, 250, 183, 131, 205, 125,  94, 201,  73, // ...%....}^.I
-  65,  60,  45, 205, 208, 119,   9, 145, 157,   6, 105, 113, // A<-..w....iq
- 210,  26, 241,  37,   0, 237, 222,  75, 131,  10, 136,  32, // ...%...K... 
- 166, 169, 152,  58, 244, 219,  90,  10, 248, 166, 150, 122, // ...:..Z....z
- 104, 201,  57, 157, 186, 247, 208, 111, 141, 114, 165,  67, // h.9....o.r.C
- 112,  29,  81, 248, 223,  81, 224,  88,   5, 254, 244,  26, // p.Q..Q.X....
-   5, 243,  55,  18,  67,  87, 238, 184, 150, 163, 169,  79, // ..7.CW.....O
- 230,  15, 120, 148, 235,  75, 243,  35,  30, 197,  41, 189, // ..x..K.#..).
- 134,  71, 249, 167, 112,   2, 118, 102, 117, 214,  92, 190, // .G..p.vfu...
- 112,  29,  16, 174, 231,  26, 184, 140, 195,  53, 220,  76, // p........5.L
-  81, 148,  37,  75, 130, 226, 126, 157,  39, 169,  29, 174, // Q.%K..~.'...
-  34, 247, 113, 120, 157, 165,  93,  36,   1,  19, 118, 160, // ".qx..]$..v.
-  44, 128, 194, 203, 102,  15,  31, 183, 118,  37, 215, 188, // ,...f...v%..
-  78, 249,  93,  19, 101, 186, 243, 103, 225, 246, 159, 236, // N.].e..g....
- 162, 250, 140, 151, 226,  80,  35,  59, 237, 252,   0,  56, // .....P#;...8
-  92, 169, 214,  15, 167, 119,  69,  70, 250, 119, 115,  92, // .....wEF.ws.
- 147, 155,  94, 159, 104, 128,  59,  59,  39,  96, 252, 245, // ..^.h.;;'`..
- 247,  84, 200,  42, 165, 206, 187, 167, 117, 164, 139,  51, // .T.*....u..3
- 173, 237,  70, 232, 150, 172, 143, 149,  31, 150, 156, 145, // ..F.........
-  96, 139,  18, 218, 236,  22,  93,  15, 169, 107, 100, 147, // `.....]..kd.
- 202,  98, 143, 245,  40, 203, 212, 168,  78, 133, 242,  76, // .b..(...N..L
- 168,  78, 131, 242,  60, 172, 104, 153, 255, 254, 179, 109, // .N..<.h....m
- 250,  26,  18, 166,  62, 108,  51, 235, 107, 137, 152,  53, // ....>l3.k..5
- 210,  85,  57, 105, 108,  70, 139,  87, 134,  38, 239, 123, // .U9ilF.W.&.{
- 139,  53,  39, 131, 141, 159, 175, 129, 238,  42,  79,  93, // .5'......*O]
- 223,  55, 118,  66,  28,  46, 224,   6,  88,  49,  37,  43, // .7vB....X1%+
-  72, 233,  58, 164, 204,  58,  88, 116,  42,  24,  72, 116, // H.:..:Xt*.Ht
-  71, 126,  20, 225, 120,  45, 231, 186,  34,  61, 204, 110, // G~..x-.."=.n
- 234, 128, 226,  16,  87, 117, 150,  10, 225, 135, 155,  23, // ....Wu......
- 245,  81, 148, 215, 150, 180, 148, 156, 250, 134, 241, 100, // .Q.........d
- 149,  85,  28, 194, 215, 215, 132, 179, 100, 154, 249, 254, // .U......d...
- 229, 166,  21, 113, 202, 221, 176, 165, 215,  55,  90,   2, // ...q.....7Z.
- 167,  51, 103,  75,  51,  34,  97,  19, 186,  52,  48, 123, // .3gK3"a..40{
- 243, 230,  86, 255, 241,  71, 185,  45, 244, 214, 183, 240, // ..V..G.-....
-  67,  88,  47,  91, 224,  75, 213,  18, 156, 214, 131,   0, // CX/[.K......
- 151,  92, 191, 254, 235, 238,  12, 221,  49,  88, 240, 178, // ........1X..
-  67, 168, 228, 113, 235, 129, 167, 236, 202, 242, 175, 247, // C..q........
- 153, 127,  93, 123,  35, 184, 242,  13,   2,  88,  50, 160, // ..]{#....X2.
- 146,   6, 121,   0, 208, 145,  97,  89,  89, 177, 169,  20, // ..y...aYY...
- 229, 121, 118,  38,  92,  37, 174,  49, 239, 254, 140, 127, // .yv&.%.1....
-  87,  63, 168,  94, 186,  53, 206, 138, 178,   6, 211,   8, // W?.^.5......
-  55, 150, 135, 211,  27, 103,  89, 254,  53, 254,  25, 255, // 7....gY.5...
- 246,  87, 134,  71, 248, 223, 140,  78, 170,  91, 214, 137, // .W.G...N.[..
-   1, 190, 214,  22,  79, 220, 250, 117, 126,  15,  17, 150, // ....O..u~...
-  51, 209, 230,  83, 252,  53, 203, 113, 115, 209, 117, 227, // 3..S.5.qs.u.
- 186,  25,  22, 184,  29, 247, 232, 184,  91, 227, 111, 110, // ........[.on
-  90, 215, 178, 154,  93, 220,  46,  47, 238, 127, 123,  19, // Z...]../..{.
-  76,  91, 122, 104, 180, 232,  14,  92,  84, 226, 240, 160, // L[zh....T...
- 203, 170,  68,  69, 210, 175,  99,  21, 184,  76,  41,  80, // ..DE..c..L)P
- 254, 215, 221, 187, 119, 127, 184, 179, 109, 133,  31, 201, // ....w...m...
- 142, 234, 242, 103, 169, 224, 206, 185, 214, 218, 119, 110, // ...g......wn
- 156, 101, 229,  75, 220, 109, 174, 239, 228, 164,  92, 199, // .e.K.m......
- 161, 157, 203, 156,   8, 187, 108,  79, 155, 234,  24, 160, // ......lO....
- 127, 110,  90,  58, 103,  44,  55,  30, 251, 235, 214, 110, // .nZ:g,7....n
- 165, 158, 165,  46, 234, 147,  44,  87,  47, 255, 205,  44, // ......,W/..,
- 151, 188, 232, 255, 108, 252, 207, 245, 249,  88, 243, 229, // ....l....X..
- 118,  79, 215, 121,  77, 126,  91, 249, 126, 119, 100,  34, // vO.yM~[.~wd"
-   0,  42, 129, 160, 236, 135,  21, 181, 214,  22,  45,  63, // .*........-?
- 229,  71, 101, 203,   6, 203, 207, 136, 138,  34, 247,  76, // .Ge......".L
- 190,  95,  30, 103,  96, 138, 132, 169, 102,  89, 242,  58, // ._.g`...fY.:
- 182, 210, 107,  81, 150, 218, 168, 120, 203,  38, 109,  12, // ..kQ...x.&m.
-  97,  46, 111,  96,  68, 214, 206, 251, 255,  75, 127,  59, // a.o`D....K.;
- 232, 110, 195, 196,  70, 189, 187,  51, 214,  86,   8,  95, // .n..F..3.V._
- 191,  32,  91,  17, 146, 255,  67,  30, 136,  16, 217,  56, // . [...C....8
- 154, 159,  28, 101, 104,   9, 159,  48, 211,  53,  18, 160, // ...eh..0.5..
- 218, 182, 255, 219, 230, 103,  17, 159, 239, 155, 151, 143, // .....g......
- 150, 246, 181,  53,  89,  36, 137, 224, 179,  13, 155, 239, // ...5Y$......
-  94, 137, 178, 168,  77, 110, 157,  91, 194,  20,  84, 252, // ^...Mn.[..T.
-  40, 207, 159,  33, 162,  28, 221,  12,  35, 230,  55, 149, // (..!....#.7.
- 214, 124, 200,  63, 167, 101, 156, 108, 129, 234, 181, 189, // .|.?.e.l....
-  57, 114, 151,  40,  73, 220, 247, 214, 120,  97, 174,  64, // 9r.(I...xa.@
- 183,  59, 157, 233, 188, 182, 227, 187, 221, 157, 127, 151, // .;..........
- 179, 226,  12, 115,  69, 138, 243, 227, 230, 254, 151,  11, // ...sE.......
-  97,  62,  96, 253, 234, 154,  45,  43, 148, 254,  98,  14, // a>`...-+..b.
- 241, 185, 220, 119,  24, 241, 248,  53, 196,  81, 215,  10, // ...w...5.Q..
- 240,  87, 201, 241,  31, 140,   3, 122,  65, 213,  37, 243, // .W.....zA.%.
-  93,  17,  42, 184,  98,   9,  35, 103,  41,  37, 245,  63, // ].*.b.#g)%.?
- 184,  99, 250,  59,  74, 223, 118,   7,   5, 174, 203, 235, // .c.;J.v.....
-   2,  16,  36, 212,  47, 233,  77,   5, 103, 105,  76, 133, // ..$./.M.giL.
-   7,  43,  82, 180, 157, 154, 110, 210, 141,  35, 187, 233, // .+R...n..#..
-   6,  87,  68,  83,  89, 130,   5,  89, 153, 145, 106,  36, // .WDSY..Y..j$
-  22, 156, 209,  98,  43, 137, 231,  32,  50,  86,  20, 155, // ...b+.. 2V..
-  86, 139,  93,  99,   7,  87,  39, 243, 239, 132, 212, 118, // V.]c.W'....v
-  31,  18, 221,  80, 157, 117, 127, 195,  83, 155,   1, 188, // ...P.u..S...
- 160,  70, 107, 194, 221, 117, 148, 173,  29, 172, 128, 151, // .Fk..u......
-  30, 219,  81, 223,   8,  97, 251, 166,  32,  90, 191, 169, // ..Q..a.. Z..
- 221,  21, 161,  45, 230, 214,  34, 212, 214, 121, 171,  83, // ...-.."..y.S
-  19,  25,  86, 168, 150, 182,  56,  19, 255,   6, 181, 210, // ..V...8.....
- 211, 252, 155,  62, 251, 108,  31, 190, 240,   3, 212,  54, // ...>.l.....6
-  63,  67,  34, 198,  79,  95, 232, 137, 219, 111, 185,  29, // ?C".O_...o..
-   0, 157, 221, 208,  71,  11, 139, 249, 191, 238, 197,  64, // ....G......@
- 141,   3, 141,  70, 160, 215,  95,  75,  89, 173, 209,  93, // ...F.._KY..]
- 176,  48, 182, 118, 211, 255, 119, 215,  23,  53,  32,  48, // .0.v..w..5 0
- 251, 168, 187, 158, 251, 187, 134,  28,  86, 180,  21,  42, // ........V..*
- 221, 191, 155,  20,   2, 254, 153, 252, 207, 156, 186, 213, // ............
-  94,  34, 176,  98, 132,  67, 140, 219, 223, 125,  78, 133, // ^".b.C...}N.
- 149, 153, 204, 226,  52, 190, 240, 180, 168, 176, 186,  13, // ....4.......
-  94, 109, 157, 152, 186, 255, 135, 218, 219,  27, 151, 255, // ^m..........
- 221, 196,  59,  77, 140, 227,  83, 115, 241, 254,  95,  12, // ..;M..Ss.._.
- 224, 167,  54, 108,  79,  75, 230,  72, 246,  72, 157,  89, // ..6lOK.H.H.Y
-  65,   1, 179, 185, 140,  78, 183,  93,   7, 195, 124, 160, // A....N.]..|.
- 233,  17, 196,  68, 188, 206, 171,  60,   9, 116,  70, 221, // ...D...<.tF.
- 146,  48,   9,  44, 139, 174,  81, 210, 160, 222,  12, 187, // .0.,..Q.....
- 122, 175,  20, 125, 150, 232, 239, 239,  10, 226,  18,  28, // z..}........
- 218,  54, 255,  13,  82, 255, 169,  45,  66,  43, 151, 112, // .6..R..-B+.p
-  44, 113,   5,  86,  97, 189, 230,  79,   1, 249, 191,  37, // ,q.Va..O...%
- 173, 214, 159, 102,  82, 100,  85, 238, 157, 141, 199, 254, // ...fRdU.....
-  90, 164, 182,  70, 106,  40, 228, 206, 140, 137, 156,  40, // Z..Fj(.....(
- 165,  79, 147,  62, 144, 210,  42, 223,  55, 186, 243, 141, // .O.>..*.7...
-  56, 157, 192, 202,  73, 111, 136, 183,  50,  84, 252,  63, // 8...Io..2T.?
- 223, 244, 197,  36, 143, 166, 122, 190,  90,  30,   2,  85, // ...$..z.Z..U
-  34,  31, 107, 151,  37,  22,   5,  89,  18, 114, 131, 231, // ".k.%..Y.r..
- 103, 109, 153, 237, 123, 101,  41,  86,  15,  48,  26,  95, // gm..{e)V.0._
- 206, 248,  56, 169,  62,  64,  25,  87,  57, 206, 149,   1, // ..8.>@.W9...
- 174,  86, 192,   8, 119, 184, 123,  19,  26, 214, 208, 126, // .V..w.{....~
-  44, 130,  92, 192, 220, 165, 214,  31,  39, 185, 253, 181, // ,.......'...
- 119, 230,  55, 117, 181,  90, 150, 181, 199, 242, 140, 207, // w.7u.Z......
-  25, 232, 252,  24, 205, 128, 142, 252,  75, 167,  89, 126, // ........K.Y~
- 124,  20, 121, 189, 157,  29, 181,  81, 253,  33, 214, 209, // |.y....Q.!..
- 204,  82, 145, 173, 173, 216,  43, 107, 222, 187, 171,  54, // .R....+k...6
- 236, 255,  29,  59, 105, 255, 103, 170, 199, 113, 180, 225, // ...;i.g..q..
-  57,   0, 122,  15, 250, 195,  62,  15,  71,  36, 225, 106, // 9.z...>.G$.j
- 195,  94,  30,  85,  55,  53,  22, 102, 169, 204,  15, 137, // .^.U75.f....
-  96, 153,  45, 167,  84, 117,  74, 148,  44,  87, 183, 219, // `.-.TuJ.,W..
- 177,  42, 134, 102, 232,  56, 187,  59, 230, 255,  21,  93, // .*.f.8.;...]
-  56,  30, 246, 159, 234, 121, 120,  89,   0,  64,   3, 177, // 8....yxY.@..
-  26, 111,  40, 236, 194, 160,   1, 162, 176, 161,  18, 125, // .o(........}
- 170, 147, 160, 163, 254, 191, 246, 174, 117, 189, 109, 227, // ........u.m.
- 104, 255, 207,  85,  64, 120,  84,   5, 136,  55,  20,  37, // h..U@xT..7.%
- 217,  73,  74,  25, 226, 227,  99, 236, 214, 114,  82, 203, // .IJ...c..rR.
- 174, 155, 138, 250,  36, 144,   4,  37, 196,  20, 192, 128, // ....$..%....
- 160, 101, 133, 226, 189, 248,  90, 124, 101, 223, 188, 179, // .e....Z|e...
-   7,  44,  64,  80, 164, 210,  52,  85, 210, 246,  96, 129, // .,@P..4U..`.
- 139, 197,  30, 102, 103, 103, 103,  79, 239, 139, 123, 174, // ...fgggO..{.
-  15,   5, 117,  23,  26, 122,  91, 135,  83, 125, 225, 213, // ..u..z[.S}..
- 190, 248, 142,  40, 110, 217,  89,  93, 228,  13, 185,  43, // ...(n.Y]...+
- 164, 164, 134,  16,  85, 247, 175, 180, 121, 211, 193, 188, // ....U...y...
-  35, 122, 183,  81,  26,  85, 212,  41, 238, 242,   8, 197, // #z.Q.U.)....
- 135, 135, 159,  60,  92, 109,  91, 168, 226, 108, 243,  47, // ...<.m[..l./
- 136, 185, 229, 240, 192, 179,  74, 185,  75,  71, 162, 198, // ......J.KG..
- 184, 253, 116,  93,  22,  86, 138,  56, 164, 212, 210, 120, // ..t].V.8...x
-   1, 252, 167, 245, 160,  16, 170,  84,  66, 233,   3, 106, // .......TB..j
-  23, 181,  81, 222, 234, 189,  91, 147,  60, 110, 118,  46, // ..Q...[.<nv.
-  46, 235, 124, 185, 172, 202,  46,  42, 231, 181, 109,  95, // ..|....*..m_
-  83, 204,  45,  89, 174,  58, 185, 172, 222,  36, 245, 141, // S.-Y.:...$..
-  32, 113,   8,  90, 238, 219, 104, 216,  75, 207, 163,  53, //  q.Z..h.K..5
-  93,  16, 123, 221, 228,  27, 244,   8, 107,  74, 198, 165, // ].{.....kJ..
- 113,  73,  42, 250, 227, 103,  17, 205, 217, 227, 241, 167, // qI*..g......
- 143, 225, 167, 143, 236, 102, 144, 203, 129,  32, 202, 195, // .....f... ..
-  57,  71,  26, 206,  69, 152, 228, 100,  20,  62, 125, 236, // 9G..E..d.>}.
-  71,  18, 144, 192, 161,  57, 184,  19, 145,  20, 146,  30, // G....9......
- 174, 225, 127, 250,  72, 113,  51, 135,  58, 204, 251,  24, // ....Hq3.:...
-   1,  25, 165, 149,  92,  58,  41, 197,  98, 235, 200,  25, // .....:).b...
- 193,  46,  33,  73,  92,  70, 225,  49, 221,  28,  85, 161, // ..!I.F.1..U.
- 210, 101,  60,   7,  27, 115,  38,  89,  20, 246,  29, 181, // .e<..s&Y....
- 148,  64,  61, 146, 186, 228, 233, 167, 143, 113, 210, 184, // .@=......q..
-  94, 202, 219, 150, 151, 163, 171, 126, 183,  82, 117, 237, // ^......~.Ru.
-  35,  64,  43, 142, 174, 215, 140,  82,  15, 210, 221, 106, // #@+....R...j
-  81, 115,  45, 156, 244,  92, 119,  60, 240, 215, 234, 111, // Qs-...w<...o
- 202,  68, 178,  61, 248, 198, 164,  89, 167, 135, 197, 219, // .D.=...Y....
-  95,  67, 231, 112,  85, 223, 129, 185,  44,  84,  78,  74, // _C.pU...,TNJ
- 121, 123, 190,  33,  88,   7,  43,  27, 236, 114, 166, 101, // y{.!X.+..r.e
-  43, 226,  27,  82, 129, 132, 198,  51, 215, 224,   9, 184, // +..R...3....
- 108, 152,  17,  71,  25,   7,   9,  34,  34, 207,  42,  42, // l..G..."".**
- 160, 145,  44,  26,  40, 203, 141,  91,  92,  50,   1,  43, // ..,.(..[.2.+
- 209, 239,  41, 165,  11, 242, 228,  87,  77, 116, 100, 226, // ..)....WMtd.
-  91,   9, 155, 192, 114, 105, 157, 176, 127,  30,  39, 155, // [...ri....'.
- 252, 175, 163, 116, 120,  19, 255,  96,   4,  85, 131,   9, // ...tx..`.U..
-  75,  71, 219, 103,  28,  80,  46,  93,  62, 194, 200,  87, // KG.g.P.]>..W
- 148, 164, 132,  90, 162, 198,  36,  22, 243, 115,  51,  42, // ...Z..$..s3*
- 141,  89, 161,  18, 187, 116,  53, 122, 176, 101, 107, 249, // .Y...t5z.ek.
-  17,   0,   4, 167, 243, 163, 211, 170,  38, 237, 215,  25, // ........&...
- 206, 234, 186, 194,  74, 198, 127, 129, 177, 215,  43,  18, // ....J.....+.
-  55,  58,  71,  94, 241, 121, 151, 140,  14,  37, 231,  67, // 7:G^.y...%.C
- 118, 165, 154, 220, 150,  84,  94, 173, 142, 182, 220, 199, // v....T^.....
-  17,  27,  71, 122, 149, 200, 174, 231, 104, 180,  27, 206, // ..Gz....h...
- 108, 133, 131, 197, 243, 226,  98, 136,  29, 169,  24, 242, // l.....b.....
- 156, 156,  76, 236, 243, 117,   6,  28,  26,  54,  82,  62, // ..L..u...6R>
- 210, 234, 180,  29, 165, 129, 213, 237, 187,  93, 215, 105, // .........].i
- 149, 223,  25, 231, 200, 157, 125, 206, 210, 145,  57, 201, // ......}...9.
- 174, 166,  85, 159, 170, 153,  59, 128,  49,   6,  46, 138, // ..U...;.1...
- 204,   9,  65,   8, 153, 149, 100, 215,  82,  30, 167, 108, // ..A...d.R..l
-  43, 171,  11, 206,  21, 240, 115,  57,  95, 249, 156, 202, // +.....s9_...
- 243, 249, 231,  51, 119,  65, 198,  87, 115, 169, 171, 148, // ...3wA.Ws...
-  23, 196, 223, 191, 116,  70,  89, 218, 159, 244, 114,  30, // ....tFY...r.
- 118,  82, 187, 219, 255, 107,  41, 235,  10, 104, 147,  99, // vR...k)..h.c
-  21, 217, 110,  21, 233,  68, 218,  41,  27, 113, 148, 186, // ..n..D.).q..
- 189,   5,  79, 100, 245, 115,  10,  53,  67, 213, 243, 255, // ..Od.s.5C...
- 117, 225, 223, 162,  11, 175, 170,  69, 178,  85, 118, 129, // u......E.Uv.
- 175,  20,   6,  94, 236, 185,  95, 191, 249, 107, 248, 173, // ...^.._..k..
- 235, 139, 101, 143,  26, 212, 236, 173, 132, 178, 145,  64, // ..e........@
-  29,  12, 210, 240,  33,   7, 162, 205, 155,  18,   0, 160, // ....!.......
- 194, 151, 100,  16,  36,  20,  95, 170, 202, 198, 134, 167, // ..d.$._.....
- 239,  76,  79, 128,  79, 142,  48, 220,  36, 207, 230, 238, // .LO.O.0.$...
- 158,  47, 138,  86,  92, 186, 174, 190, 169, 222,  74,  31, // ./.V......J.
-  68,  64,  78, 112, 195,  81, 188,  41,  51, 119, 125, 224, // D@Np.Q.)3w}.
-  52,  37, 252, 210,  64, 149, 101,  17, 128, 183,  60, 166, // 4%..@.e...<.
-  25, 169,  43, 241,  23,   0,  77, 240, 103, 226, 233,  28, // ..+...M.g...
- 148, 155, 134, 139,  84, 120,  79,  13, 202, 168, 221,  56, // ....TxO....8
- 204, 143,  20,  12,  84,  42, 131,  25, 189, 106,  14,  60, // ....T*...j.<
-  66, 189, 244,  55,  54, 230, 144, 144,  18, 223, 159, 170, // B..76.......
- 215, 128, 100, 139, 202,   4, 237, 247,  51,  77,  68,  96, // ..d.....3MD`
- 161, 237, 103,   0, 134,  50, 164,   0,  64, 200, 202, 113, // ..g..2..@..q
- 207,  29, 158, 250, 248, 109, 156, 147,  16,  38, 241, 177, // .....m...&..
-  11, 178,  88, 157, 112, 116,  20,  48,  15, 195,  76, 162, // ..X.pt.0..L.
-  85, 148, 168, 176,  84, 156,  32,  18, 153, 159,  95, 155, // U...T. ..._.
-  74,  14, 206, 133,  28, 108,  14, 234, 147, 105, 163, 209, // J....l...i..
-  80, 207,  51, 139, 212, 235,  71, 139,  77, 194,  22,  22, // P.3...G.M...
-  27, 162, 182, 129, 203,  34, 139, 195, 147, 214, 118, 187, // ....."....v.
-  41, 134, 118,  76, 200,  80,  36,  37, 160, 171, 161, 175, // ).vL.P$%....
-  72, 101, 188,  68, 193,  67, 164,  26, 106, 192,   5, 210, // He.D.C..j...
- 137,  27,   4,  67,  18,  31, 227, 160,  93,  93, 185,  33, // ...C....]].!
- 164,  94,   9, 235,  81,  63,  77, 207, 237,  64, 174,  27, // .^..Q?M..@..
- 255,  20, 107, 145,  46,  22,  46, 140, 163, 168, 212,  27, // ..k.........
-  65,   1, 212, 128, 147, 127, 172, 203, 233, 223, 151,  20, // A...........
- 104, 105,  96, 107, 143, 234, 115,  84, 245, 118, 174, 245, // hi`k..sT.v..
- 240,   4, 122,   8,   0, 159,  19, 165, 133, 140, 130, 252, // ..z.........
- 227,  24,  16,   7,  42, 100,  24, 236,  61,   5,  25,  38, // ....*d..=..&
- 152,   2,  27,  10, 247,  35, 216,  83,  29,  23,  37, 240, // .....#.S..%.
- 220, 231,   9, 229,  18, 247, 157, 191,  28, 124, 247, 210, // .........|..
- 225, 122,  34,  50,   3,  71, 188, 243, 182, 238,  53, 239, // .z"2.G....5.
- 208, 255, 191,  96, 204, 143,  44, 164,  94, 114, 238,  21, // ...`..,.^r..
- 212,  38,  10,  10, 175, 193,  44, 105,  26,  37,  42, 101, // .&....,i.%*e
- 234, 158, 130, 157, 235, 165,  55,  37, 251,  77, 157, 122, // ......7%.M.z
-   0, 196, 131, 169,   5, 222,  32, 177,   0,  62,   3,  22, // ...... ..>..
- 128, 190, 186, 174,  23, 131, 112, 206, 161, 112,  13, 191, // ......p..p..
- 190, 247, 167, 221,  98, 107, 162, 180, 134,  92,  90,  76, // ....bk....ZL
-  93,  56, 195, 208, 231,  87,  93,  13,  49, 112,  65, 118, // ]8...W].1pAv
- 134, 236,  89, 246,  78, 222, 208,   7,  64, 228, 222,  40, // ..Y.N...@..(
- 189, 136, 112, 178, 190, 123, 233, 220,  15,  29, 210, 209, // ..p..{......
- 211,  40,  15, 220, 227, 238,  48,  76, 222, 185, 206,  25, // .(....0L....
- 144,  10, 248, 170, 255, 184, 181, 185, 121, 158,  38, 167, // ........y.&.
- 105,  74,  85, 191,  24, 155,  91, 250, 213,  59, 144, 188, // iJU...[..;..
- 196, 232, 238, 237, 171, 168,  64,  31, 184, 191,  25, 226, // ......@.....
-  58,  60,  96,   8, 140, 124, 190,  99, 249, 124, 143,  17, // :<`..|.c.|..
-  34,  18,  90,  82, 185, 192,  30, 225, 184,  53,  92,  44, // ".ZR.....5.,
-  49,  85,  19, 181, 254,  35, 235,  49,  31,  94, 108,  31, // 1U...#.1.^l.
- 113,  12,   7,  62,  74, 155, 155, 202, 147,  52, 115, 118, // q..>J....4sv
- 186,  14, 255, 135,  83,  73,  19,  73, 142, 184,  62, 149, // ....SI.I..>.
- 240,  77,  54,  12,  99,  80,   6, 101, 212,  96, 111, 155, // .M6.cP.e.`o.
- 157, 118, 227, 139,  77, 225, 186, 160,  32, 179,  34, 220, // .v..M... .".
-   9,  78, 218, 163,   0,  16,  83,  39, 218,  32,   6, 195, // .N....S'. ..
- 217,  76, 229, 102, 225,  62, 148, 182, 178, 214, 181, 185, // .L.f.>......
-   7, 194, 188,  91, 187, 113,   4, 184, 182, 153, 170,  22, // ...[.q......
-  23,  28,  64,  18,  14,  28,  16, 202,  45, 231, 117, 239, // ..@.....-.u.
- 153, 179,  89, 188,  71,  32,  79,  36, 116, 222, 220,  18, // ..Y.G O$t...
-  62, 126, 225,  73,  11,  80, 163,  40,  24,  87, 129,  92, // >~.I.P.(.W..
- 139,  61,  21,   1,  73,  20, 157,  50,  73,  47, 206, 219, // .=..I..2I/..
- 174, 219, 146,  50, 244, 189, 151, 148,  86, 165, 117, 127, // ...2....V.u.
- 176, 180,  95,  76,  98, 220, 190, 162, 198, 165, 160, 103, // .._Lb......g
-  52,  48, 229,  15, 105, 188, 123,  65, 206, 226,   1,  57, // 40..i.{A...9
- 139,  24, 103,  90, 195, 210, 171, 167,  97,  60, 140, 250, // ..gZ....a<..
- 173, 196,  40, 129, 243,  15, 175,  48,  10, 122,  95,   0, // ..(....0.z_.
-  88, 157,  42,  16, 234,  41, 237,  74, 251, 159, 173, 231, // X.*..).J....
-  52, 254,   0,  98, 146,  35, 129,  22, 207, 208, 251,  89, // 4..b.#.....Y
- 189, 243,  91, 187, 124, 244, 116,  64, 130, 126,  24, 102, // ..[.|.t@.~.f
-  55,  47, 163, 174,  92,  42, 148, 147, 242,  86,  46,  72, // 7/...*...V.H
- 190, 162, 169,  89,  86, 171, 197,  70, 215,  84, 243, 235, // ...YV..F.T..
- 146, 234,   6, 163, 230,  60, 155,  57, 220,  96, 129, 235, // .....<.9.`..
-  58, 104, 206, 192,  61, 143, 146, 137,  91, 209,  78, 213, // :h..=...[.N.
-  36, 193, 154, 122, 176,  26, 125,  81, 131,  46, 217, 176, // $..z..}Q....
- 166,  72, 181,  59,  51, 101, 101, 251, 193, 214,  97,  37, // .H.;3ee...a%
- 197,   0, 176, 106,  86, 176, 148,  10, 133, 166, 118, 168, // ...jV.....v.
-  68,  61, 201, 138, 160, 162, 192, 155,  84,  98, 249, 195, // D=......Tb..
- 134,  43, 249, 123, 224,  77,  85, 165, 169, 157, 210, 132, // .+.{.MU.....
-  33, 193, 248,  80,  12,  44,   5, 249, 147, 212,  40, 168, // !..P.,....(.
-  37, 116,  69,  14,  94, 140,  79, 247, 160, 223, 127,  27, // %tE.^.O.....
- 247, 201, 142,  61, 142,  67,  82,  11, 106, 156,  56, 161, // ...=.CR.j.8.
-  33,  17, 152,  56, 169, 222,  90, 165, 214,  49,  64, 130, // !..8..Z..1@.
- 198, 245, 122, 235, 239, 214, 155, 157, 207,  52,  20, 203, // ..z......4..
- 250,  52,  97, 148,  21, 156,  68,  55, 173,  17, 201, 159, // .4a...D7....
- 166, 116, 232, 135,   8,  82,  45,  92, 220, 162, 174, 220, // .t...R-.....
- 170,   6,  84,  11, 134, 158,  47,  81,  23,  54,  21, 159, // ..T.../Q.6..
-  25, 187, 172, 155, 207, 221, 123, 130, 143,  28, 243,  17, // ......{.....
- 119,  73,  41,  36, 241, 215,  42,  82, 244, 180,  71, 146, // wI)$..*R..G.
- 129, 215,  59,  52, 243, 172,  68, 104,   9, 166,  37,   9, // ..;4..Dh..%.
- 102,  90, 117,  99,  99, 126, 199,  66,  94, 223, 134, 242, // fZucc~.B^...
-  78, 212, 243, 115,  94,  84, 239,   1, 170, 113,  48,  35, // N..s^T...q0#
-  79, 102,  20,  68, 204,  38, 211, 110,  71, 135, 174,  41, // Of.D.&.nG..)
- 188, 123,  36, 250,  26,  52, 168,  50, 112, 139, 179, 192, // .{$..4.2p...
- 194,  74, 205, 197, 105, 176, 118, 182, 177,  65,  74,  43, // .J..i.v..AJ+
- 253, 237, 182, 102, 110,  58,   7, 107, 128, 244, 186, 215, // ...fn:.k....
- 130,   0, 220, 228,  35, 191,  77, 150,  43,  60,   5, 226, // ....#.M.+<..
- 104, 252, 222, 109, 253,  36, 142,   3, 181, 244, 242,  42, // h..m.$.....*
- 188, 104, 229,  13, 243, 172, 180,  96,  40,   1, 216, 100, // .h.....`(..d
- 213,  91, 137, 250, 181, 168, 250,  32,  24,  29, 137,  62, // .[..... ...>
- 206,   0, 102,  20,  60, 188,  60,   0, 106,  18,  73,  24, // ..f.<.<.j.I.
-   4, 115, 173, 179, 246, 244, 248,  24,  26,  96, 242, 161, // .s.......`..
-  98, 124, 250, 232, 206,  36,  30,  27,  21, 171, 197, 133, // b|...$......
- 147, 130, 209, 174,   1, 136,  15, 142,  75, 114,   9,  70, // ........Kr.F
-  26,   2, 200, 247,  78, 169, 222, 253, 246, 223,  91,   0, // ....N.....[.
- 225,  46, 234, 207, 163, 146,  68, 222, 252,   7, 131, 112, // ......D....p
- 159, 172,  79,  71, 179,   6, 123,  56, 160,  58,  17,  61, // ..OG..{8.:.=
-  56,  22, 133,  15, 248, 147,  55,  69, 238, 145, 176,  68, // 8.....7E...D
- 161, 123, 131, 174,  43,  26, 189,  59, 156, 100,  84, 233, // .{..+..;.dT.
-  69,  21, 204, 148, 208,  98, 173,   7,  99,  84, 101, 162, // E....b..cTe.
- 224,  56, 123, 115, 112, 156,  96, 251,  25, 204, 133, 230, // .8{sp.`.....
- 190, 152,  74,  40,  39, 133, 250,   5, 134, 240, 214, 104, // ..J('......h
- 121, 223, 242, 189,  72, 181, 171,  40, 186, 184, 130, 234, // y...H..(....
- 235,  41, 159, 222, 120, 186, 106, 127, 246,  53,  59,  39, // .)..x.j..5;'
- 187,  85, 204,  44,  52,  16, 185, 160, 158, 166,  83,  80, // .U.,4.....SP
- 211, 154,  83, 240, 198,  14,  35,   5, 126,  69, 126, 112, // ..S...#.~E~p
-   5,  25, 145,  79, 127, 226,  35, 117, 161,  24, 184,  96, // ...O..#u...`
-  10,  41,  15,  64, 178,  64,  62, 149,  40,  83,  15, 134, // .).@.@>.(S..
-  67, 142,  59, 246,  56, 144,  60,  50, 249,  41, 243, 226, // C.;.8.<2.)..
-  38, 237,   6,  53,  26, 136, 124,   7, 202,  30,  83,   7, // &..5..|...S.
- 212, 150, 185,  57, 211, 237, 128, 170, 153, 224,  45, 145, // ...9......-.
- 226,  43,  31, 111,  73,  11, 129, 128, 204,  17,  60, 247, // .+.oI.....<.
-   9,  79,  69,   3, 170,  50, 133, 131, 198, 106, 220,  11, // .OE..2...j..
-  71, 145,  14, 128,  87, 109,  37,  66,  29,  49, 139, 128, // G...Wm%B.1..
- 128, 245,  88, 130, 252, 120, 102,  70,  87, 174, 122,  77, // ..X..xfFW.zM
-  61, 116, 214, 147,  17, 103,  60,  34, 103,  89, 119,  82, // =t...g<"gYwR
-  81,  17, 183, 141,  32,   8, 192, 179,   5, 234, 164, 202, // Q... .......
- 101, 122, 141, 146, 198, 140, 244,  76, 141, 140,  80,  50, // ez.....L..P2
- 108,  28, 235, 168, 212, 135, 186, 114, 203,  78, 127, 187, // l......r.N..
- 165, 176,  14,  89,  47, 169,  23, 196, 108, 106, 173, 163, // ...Y/...lj..
-  46, 235,  90, 134, 109, 137, 253, 216, 114,  39, 100, 216, // ..Z.m...r'd.
- 115, 138, 115, 162, 148, 183,  24, 226, 255,  82, 144, 180, // s.s......R..
- 182, 121,  78, 178,  22, 168, 201, 139,   5, 198, 168, 167, // .yN.........
- 138, 185,   1,   8, 214, 177, 131,  64, 206, 126, 218, 145, // .......@.~..
- 154,  86, 181,  34,  51, 191, 194,  76, 173, 132, 165,  44, // .V."3..L...,
- 137, 143,  73,  53, 242,  60, 139, 187, 192, 238,   3,  16, // ..I5.<......
- 253,   9, 205, 242, 184,  23, 211, 203, 130, 231, 176,  50, // ...........2
-  79, 164, 169, 104, 126, 191,  72,  90,  77,  73, 115, 201, // O..h~.HZMIs.
- 218,  40, 235,  80, 176,  25,  26, 234,  70,  57,  60, 254, // .(.P....F9<.
-  35,  40, 129, 161, 171, 233,  91, 172, 129, 155, 121, 106, // #(....[...yj
- 136,  41, 116,  24, 228, 245, 115, 170,  54, 105, 209, 225, // .)t...s.6i..
-  88,  76, 142,   2, 208, 196,  70,   3, 200, 219,  47,   0, // XL....F.../.
- 212, 197,  54, 208, 117, 227, 195, 177, 156, 137,  15, 130, // ..6.u.......
- 158,  42,  39, 141,   2, 102,  34, 216,  99, 113, 109, 108, // .*'..f".cqml
-  88, 235,  46,  48, 223, 152,   2, 150, 103, 234,   3,  51, // X..0....g..3
- 129,  26, 145,  29,  12,  73, 151,   7, 193, 225, 224, 176, // .....I......
- 121, 116, 228, 139,  81, 123,  32, 237, 160, 172, 199, 223, // yt..Q{ .....
-  76, 189, 184,  88,  76, 224, 240, 183,  82,  93, 103, 226, // L..XL...R]g.
- 111,  43,  86, 126, 124, 109, 229, 123, 162, 123,  77, 229, // o+V~|m.{.{M.
-  47,  80,  99, 166, 124, 246,  54, 255, 207, 235,  28, 220, // /Pc.|.6.....
- 241,  59, 135, 242, 207, 209, 250, 166, 191,  11, 230, 228, // .;..........
-  94, 112,   1, 124,  96,  69,  95,  16,  31, 246, 142, 196, // ^p.|`E_.....
- 139,  96, 191,  80,  21, 169,   4, 221, 217,   9,  56,  12, // .`.P......8.
-  94, 180, 219, 214, 171, 238, 209, 238, 190,  81,  54,  41, // ^........Q6)
- 206, 141, 141,  94,  16, 164,  88, 219,  33, 129, 198,  52, // ...^..X.!..4
-  16,  94,  28, 110,  31, 209, 207,  44, 184, 131,  39, 159, // .^.n...,..'.
- 210, 240,  74, 201, 103,  71, 165,  60, 252,  82,   6, 252, // ..J.gG.<.R..
- 178, 171,  10, 183, 142, 207,  10,   5, 229,  55,  44, 160, // .........7,.
- 215,  84, 255,  26, 116, 125,  77, 153,  69,  49, 226,  96, // .T..t}M.E1.`
- 202, 152, 206,  91, 130,  75,  73, 127, 121, 189, 161, 181, // ...[.KI.y...
-  85,  65,  19, 207,  26, 199,  63, 142, 129,  40,  31, 164, // UA....?..(..
-   2, 232, 218, 212, 195, 130, 196,  39,  13,   6, 222,  54, // .......'...6
-  87,  20, 177,  98, 188, 145, 235,  38,  20,  42,  45, 189, // W..b...&.*-.
- 194,  65, 197, 100, 188, 193,  32, 190,  30,  63,  74, 220, // .A.d.. ..?J.
- 207, 120, 112, 137, 201, 181,  25,  99,  21, 240, 126,  35, // .xp....c..~#
- 202, 178,  52,  19, 246,  90,  70, 100, 214,  50, 200, 170, // ..4..ZFd.2..
- 185, 212, 166,  36, 193, 168, 140, 144, 175, 205,  92,  16, // ...$........
-  96,   9,  45,  60,  60,  65,  15, 165,  49, 244, 228, 136, // `.-<<A..1...
-  57,  42, 125,  17,  98,  49, 102,   1,  90, 185,  44,  15, // 9*}.b1f.Z.,.
- 213,  95, 242,  91, 209,  67, 151, 188, 247,  40,  76,  32, // ._.[.C...(L 
-  10, 197,  65,  88, 197,  42,   5, 146, 104,  49,  87,  36, // ..AX.*..h1W$
- 215, 189, 113, 167, 237, 207,  54,  79, 193, 255,  91,  32, // ..q...6O..[ 
- 114, 238,   2, 138,  53, 171, 133,   0, 207, 181,  84, 119, // r...5.....Tw
-  85, 205, 139,   0, 124, 244,  84, 127,  66, 163, 177,  95, // U...|.T.B.._
- 128, 156,  14, 201, 117,  84,  20, 154,  74,  66, 131,  44, // ....uT..JB.,
- 138, 126, 142, 188, 220,  66, 150, 214,  72, 231,  18, 206, // .~...B..H...
-  92,  20,  88, 230,  38,  81, 128,  55, 158,  96,   9,  27, // ..X.&Q.7.`..
-  71, 157, 226,  94, 238, 242,  57, 121, 156, 202, 132, 111, // G..^..9y...o
-  63, 115,   2, 231, 195,  46, 227,  40, 239,  58, 234,  83, // ?s.....(.:.S
- 184, 195, 187,  39,  62,  37,  59, 163, 222, 156, 219,  69, // ...'>%;....E
- 146,  45, 134,  97,  81, 117,  85,  69,  14, 198,  72, 244, // .-.aQuUE..H.
-  58, 235,  24, 240, 229,  38, 166,  47, 226, 118, 134,  21, // :....&./.v..
-  20, 250, 191, 199, 252, 165, 153, 136, 176,  78,  20, 210, // .........N..
-  79, 242, 142, 192, 152,  85, 194, 169, 151, 146, 225, 190, // O....U......
- 236,  55, 200,  19, 198, 147, 248,  25,  62, 132, 133,  31, // .7......>...
-  63,  71, 137,  41,   5, 181, 146, 237,  31,  42, 219, 175, // ?G.).....*..
- 249,  87, 202, 159,  92,  93,  69, 149,  46,  77, 118, 208, // .W...]E..Mv.
-  30,   8, 104, 166, 226, 237, 139, 174,   0, 113, 180, 247, // ..h......q..
- 243, 157, 192, 117,  36,  52, 137,  43, 251, 192, 147, 128, // ...u$4.+....
-  28, 138,  52, 145, 163, 119,  91, 227, 241,   3, 242,  52, // ..4..w[....4
-  29, 193, 181,  10,  79,  67, 229, 207, 212, 140, 254, 246, // ....OC......
- 167,  13, 172, 127, 249, 202,  91, 125,  32,  83, 101,  68, // ......[} SeD
- 139, 118, 116, 195,   4, 229,  87,  13, 184,  59,  50, 181, // .vt...W..;2.
- 135,  37,  27, 123, 221, 218, 227,  43,  51,  57, 173, 174, // .%.{...+39..
- 254, 145,  45, 186, 200, 168, 222, 114, 253,  15, 224, 181, // ..-....r....
- 247, 131, 135, 226,  25, 181, 120,   0, 103,  71, 223,  84, // ......x.gG.T
- 199, 140,  32, 155,  72,   7, 168,   8,  91, 123, 117, 117, // .. .H...[{uu
-  53,  38,   3, 105,  49,  68,  32, 130,  28, 135, 214, 254, // 5&.i1D .....
-  66, 242, 205, 124, 241, 207, 210, 220,   8, 110,  37,   0, // B..|.....n%.
- 145, 247, 141,  47, 160, 154, 171, 106, 129, 245, 104, 235, // .../...j..h.
- 188, 243, 238, 225,  54, 144, 236, 131, 117, 253, 210,  26, // ....6...u...
- 255,  19,  30, 255, 125, 172, 119,   6, 185,  49, 200,   9, // ....}.w..1..
-  25, 228, 118,  27, 191,  19, 154,  30, 169, 190,  91, 122, // ..v.......[z
- 171, 117, 126, 200,  11, 219, 243, 131, 193, 218, 156, 163, // .u~.........
- 146, 205,  13, 171, 218, 222, 155, 130, 219, 203, 147, 197, // ............
-  96,  96, 205,  50, 188,  41,  53, 114, 118,  73,  51,   8, // ``.2.)5rvI3.
- 233, 126, 129, 189, 212, 178, 155, 144,  95,  36,   9,  48, // .~......_$.0
- 124,  95,  83,   1, 148, 150,  94, 163, 217,  38, 175,  52, // |_S...^..&.4
-  33,  10, 205,  81, 166, 231,  81, 126, 150, 246,  91, 238, // !..Q..Q~..[.
-  40,  29,   3, 118,  46, 237,  95, 182,  42, 230, 155,  75, // (..v.._.*..K
-  82,  12,  62, 212, 101, 185,   8,  62, 179, 174, 129, 203, // R.>.e..>....
- 142,  10,  75,  30,  66,  57, 147, 165, 235, 187, 236,  28, // ..K.B9......
- 249, 187, 170, 247, 238,  87,  58, 175, 174, 123, 171,  52, // .....W:..{.4
-  34, 130, 111, 162,  82, 152,   4,  28,  87,  69, 174, 186, // ".o.R...WE..
-  81, 230, 155, 195, 139, 239,   4,  39, 155,  88, 193,  56, // Q......'.X.8
-  33, 119, 159,  11,  27, 175,  82, 251, 148, 170, 185, 188, // !w....R.....
-  42, 240, 114, 102, 216, 228, 155,  67, 236, 117,  31, 134, // *.rf...C.u..
- 227, 184, 231, 184, 119, 186, 121,  26, 122,  86, 163, 234, // ....w.y.zV..
- 157,  71, 230, 132, 185,  67, 238, 240,  29, 235, 165,  62, // .G...C.....>
- 176, 192,  47, 141, 101,  31, 183, 203, 187,  57,  56,  59, // ../.e....98;
-  48,  61, 139, 194, 126, 148, 141,  91, 211,   7,  19, 170, // 0=..~..[....
-  75,  22, 255,  44, 151, 114, 163, 153,  46, 119,  34,  59, // K..,.r...w";
- 174, 223, 146, 189,  98,  38, 222,  86, 123, 151,   2, 220, // ....b&.V{...
- 125, 180, 177,  65, 221, 108, 159, 254, 167, 231, 112,  37, // }..A.l....p%
- 197, 230, 150, 241, 213,  59, 203, 111,   9,  34,  65, 175, // .....;.o."A.
-   3, 253, 162, 123, 100, 248, 117, 230, 227, 238, 106,  88, // ...{d.u...jX
- 240, 185, 174, 171, 230, 139, 251,  86, 115, 179, 169, 206, // .......Vs...
- 231, 115, 202, 237,  60, 236, 247, 210,  61,  47,  10,  18, // .s..<...=/..
- 208,  40, 107, 237, 201, 232, 181,  54, 106, 168,  55,   1, // .(k....6j.7.
- 251,  19, 113,   2, 103,  98,  93,  89,  31, 207,  34,  41, // ..q.gb]Y..")
- 200, 125, 216,  53, 225, 246, 211,   9, 217, 173, 154,  72, // .}.5.......H
-  79, 135, 105, 104, 162, 189, 229,  57,  39, 239, 151, 193, // O.ih...9'...
- 174,   1, 175, 154,  28, 152, 141, 141, 127, 122,  61, 146, // .........z=.
- 247, 203, 192, 195,  70, 153, 222, 161, 225,  69, 152,  44, // ....F....E.,
-  60,  31,  83, 227, 182, 124,  23, 214, 195,  29,  49,  33, // <.S..|....1!
-  78,   0, 130,  82, 114, 125, 200,  43,  25,  35, 207, 196, // N..Rr}.+.#..
- 215,  32, 239, 145, 237,  94, 165, 254,  46, 219, 251, 241, // . ...^......
-  24,  92,  54, 230,  83, 248,   6, 115, 158, 151, 133, 156, // ..6.S..s....
-  94,  81,  34, 213, 105, 134,  11, 140,  64, 106, 169, 253, // ^Q".i...@j..
- 143, 152,  99,  25, 245,  49, 140, 146,  83, 172, 194,  20, // ..c..1..S...
- 235,  22,  79,  74, 107,  52,  15, 204, 186,  10, 213, 211, // ..OJk4......
- 251, 161, 188, 174,  50, 244,   5,   8, 167, 126, 208,   3, // ....2....~..
- 123, 240, 179,  47,  94, 203,   0, 170, 212, 107,  95,  60, // {../^....k_<
- 227,  31, 122, 212,   8, 158,  65, 186,  42,  31, 126, 163, // ..z...A.*.~.
- 215, 239,  76,  40,  34, 168, 163,  26,  28,  65,  61,   7, // ..L("....A=.
-  38, 148, 218, 242, 156, 250,  11, 108,  61,  71, 160,  31, // &......l=G..
- 244, 146, 254, 197, 139, 240, 131, 245,  34, 252, 128,  23, // ........"...
- 225,   7,  31, 124,  70, 209, 168, 120, 131,  95,  65, 196, // ...|F..x._A.
- 127, 248, 157, 242,  21, 181, 102, 172,  51,   5,  43,  19, // ......f.3.+.
-  92, 114,  42, 114,  58,  24, 200,  96,  48, 104, 105, 238, // .r*r:..`0hi.
- 164,  98, 188, 243, 190,  11, 204, 250, 146, 128, 138, 254, // .b..........
-   0, 105, 158,  97, 154, 222, 122,  66,  98, 195,  18, 201, // .i.a..zBb...
-  27, 111, 237, 145, 239,  11, 105,  14,  31,   9, 121, 216, // .o....i...y.
- 163,  76, 239, 195, 195, 232, 152, 204, 177,  98, 109, 170, // .L.......bm.
- 205,  96, 162,  50, 128, 205, 105,  69, 188, 213,  64, 254, // .`.2..iE..@.
-  20,  78, 247, 185, 242,  75, 222, 248, 175, 253, 244, 131, // .N...K......
- 250,  84,  30,  10, 136, 228, 113, 118, 254, 200, 112,  57, // .T....qv..p9
- 213, 126, 247,  94, 125,  87,  46,  59, 185, 115, 124, 114, // .~.^}W.;.s|r
-  31, 176, 226, 220,   2,  18,  90,  28,  34, 227,  52,  37, // ......Z.".4%
-  25,  84, 109, 130, 223, 171,   4,  37,  39, 141,  87, 166, // .Tm....%'.W.
-  60,  58, 224, 159, 204, 123,  91, 203,  73, 148,   6,  37, // <:...{[.I..%
-   6, 165,  10, 251, 208, 176, 150, 125,  40, 209, 236,  67, // .......}(..C
- 121, 144,  48, 251, 208,  16, 155, 204, 152, 125, 164,  60, // y.0......}.<
-  11,  50,  20, 106, 212,  93, 188, 199, 200, 158,  39,  91, // .2.j.]....'[
- 143,  10,   2, 157, 138, 253,  52,  28,  58,  76,  81,  16, // ......4.:LQ.
- 235, 102, 147,  68,  88, 181, 117,  62, 190, 169,  16,   5, // .f.DX.u>....
- 238, 120,  35,   3, 254,  43, 192,  67, 138,  95, 252,  87, // .x#..+.C._.W
- 126, 125,  12, 234, 244, 177,  78,  67, 254, 146,  58, 192, // ~}....NC..:.
-  71, 233, 106, 139,  65,  73, 147,  95,  25,  99,  45, 167, // G.j.AI._.c-.
-  61, 106,  13,  42, 133,  50,  90,  27,  65,  97, 233, 115, // =j.*.2Z.Aa.s
- 185, 252,  36, 135,  17, 122,  43,  15, 231, 209, 203, 183, // ..$..z+.....
-  53,  47, 245,  50, 154,  61,  42,  89,  67,  18, 185, 229, // 5/.2.=*YC...
- 115, 222, 237,  76, 240,  65, 143,  72, 194,  11, 146,  30, // s..L.A.H....
- 243, 218,  51, 215,  65, 145, 145, 213,  86, 162, 175, 138, // ..3.A...V...
- 173,  13,  75, 235, 217, 245, 101, 171, 147,  46, 186, 127, // ..K...e.....
-  75,  90, 129, 213, 170, 207, 165,  50, 108, 105, 181, 229, // KZ.....2li..
-  58, 175, 138, 179, 170,  36,  43, 228,  80, 235,  80,  91, // :....$+.P.P[
- 121, 156, 233,  78, 140, 243,  73, 178, 255, 171,  51, 138, // y..N..I...3.
- 145, 220,  98,  44,  12, 185, 178,  60,  24, 189, 100, 218, // ..b,...<..d.
- 246, 193, 198,  95,  41, 241, 231,  94, 145, 118, 113, 122, // ..._)..^.vqz
- 234,  87,  74, 188, 198,  81, 178, 157,  33, 172,  62, 155, // .WJ..Q..!.>.
-   1,  77, 150,  34, 212,  68,  40, 255, 114, 254,  20, 150, // .M.".D(.r...
- 197, 167, 228, 239,  31, 167, 201,  49,  15, 206, 199,  97, // .......1...a
- 210,  63,  86, 163, 186, 228, 186,  69,  25,  95, 122,  61, // .?V....E._z=
- 225, 242, 103, 228, 225, 233, 161,  83,  46,  39,  95, 159, // ..g....S.'_.
- 130, 252,  88,  46, 174, 169, 209,  95,  17, 205, 168,  68, // ..X...._...D
- 176,  48, 124, 131,  36, 180, 191,  33,  19, 129,  52,  60, // .0|.$..!..4<
- 102, 234, 211, 178,  32, 151,  68, 241, 242,  89,  33, 204, // f... .D..Y!.
- 193, 167, 127, 251,  37, 113,  93,  46,  21,  23,  15,  65, // ....%q]....A
-  61,   1,  44, 212,  17, 245, 188, 134, 124, 208,  93,  26, // =.,.....|.].
- 127, 168,  42, 200,  17, 218,  62, 110, 195, 253,  48, 101, // ..*...>n..0e
- 251, 142,  68,  92, 228, 245,  87, 149,  87, 143,  38,  68, // ..D...W.W.&D
- 106,  27,  69, 237, 136,  36, 214, 193, 132,  98, 103,  44, // j.E..$...bg,
-  45, 237, 140, 101, 156, 160, 181,  61,  19,  69, 246, 222, // -..e...=.E..
-  50, 206,  51,  20, 219,  51,  58,  93, 123, 103,  59,  23, // 2.3..3:]{g;.
- 146,   1, 211, 218, 166, 150,  43,  44,  81,  30,  76,  93, // ......+,Q.L]
- 197, 211,  64, 174, 253,  86, 163, 217, 216, 113,   5, 159, // ..@..V...q..
- 197, 112,  91,  83, 245,  23, 179,  99,  25,  54, 214,  63, // .p[S...c.6.?
-  38, 177, 126, 146,  90, 219,  26, 132, 228, 210, 206, 200, // &.~.Z.......
-  69, 249,  41, 207, 241, 101, 148, 192, 112, 169, 112, 138, // E.)..e..p.p.
- 159,  13,  41, 121, 188, 108, 109, 110, 118, 113, 159,  45, // ..)y.lmnvq.-
- 107, 156, 197, 239, 163, 243, 159, 200, 182, 159, 183, 182, // k...........
- 190, 249, 102, 199, 165, 175,  47, 162, 238,  56, 237, 189, // ..f.../..8..
- 139, 230, 147, 160, 151, 253, 100, 140,  96, 136, 157, 210, // ......d.`...
- 210, 252, 128,  58, 237,  73,  31,  68,  17, 223,  52, 248, // ...:.I.D..4.
- 191, 173, 123, 168,  69,  47,  28, 225,  62, 102, 145, 194, // ..{.E/..>f..
-  56, 145, 213, 170,  20,  78, 166, 216,  44, 167, 132,  65, // 8....N..,..A
- 177, 113, 154, 166, 192, 180, 227,  34, 110, 239,  48, 187, // .q....."n.0.
- 164, 100, 247, 112,  91,  59,  95,  53, 155, 168, 111, 218, // .d.p[;_5..o.
- 239,  78, 198,  53, 137, 226, 206, 129, 219, 186, 215, 220, // .N.5........
-  70, 181, 226,  65, 140,  40, 225, 200, 188,  30, 147, 226, // F..A.(......
- 234, 231, 112, 116, 204, 167, 201, 113,   2, 240, 193, 232, // ..pt...q....
- 101, 132,  74,  81,  24, 230,  86,  56, 135, 193, 145, 139, // e.JQ..V8....
-  24, 244, 158, 102,  92, 239,  84, 176, 138, 180, 127, 249, // ...f..T.....
- 125, 113, 116, 220, 237,  78, 226,  97,  31,  25,  82, 233, // }qt..N.a..R.
- 240,  81,  18,  93,  80, 116, 198,  34, 160,  95, 244, 239, // .Q.]Pt."._..
-  36,  78, 210,  47, 163, 241, 104, 103,  27, 117, 226,  56, // $N./..hg.u.8
-  15, 100,  40, 253, 206, 104, 114, 224, 226, 102,  66,  70, // .d(..hr..fBF
-  30,  73,  78, 117, 157, 161,  56,  92,   1, 156,  36, 142, // .INu..8...$.
- 236,  70,  96,  87, 193, 197,  33,  43, 234,   8, 151,  69, // .F`W..!+...E
- 141, 204, 196, 151, 191,  26,  69,  81, 223, 250,  10, 179, // ......EQ....
-  25, 225, 242, 144, 224, 182,  88, 136, 225, 135, 248, 124, // ......X....|
- 114, 126, 112,  93, 188,  45,  22, 119,  54,  58,  95,  33, // r~p].-.w6:_!
- 161,  87, 223, 239,  47, 138,  69, 150,  20,  17,  79, 163, // .W../.E...O.
-  48, 179, 162,  40,  31, 217, 196, 114, 191, 135, 120, 193, // 0..(...r..x.
- 243, 210, 218, 161, 216, 131,  73,  52, 188,  46,  91,  92, // ......I4..[.
- 226,  24, 226, 172, 233, 194,  72,  58,  53, 196, 238, 145, // ......H:5...
- 163,  31,  38, 249, 113,  30, 157, 143,  86, 168, 204,  35, // ..&.q...V..#
-  25, 253, 245,  53, 177, 183, 238, 113, 252,  56,  89,  53, // ...5...q.8Y5
-  62, 162, 211, 224, 210,  79, 201, 171,  90,  86, 140,  51, // >....O..ZV.3
- 170, 216, 113,  55,  10, 109, 193,  99,  69, 186, 136, 101, // ..q7.m.cE..e
- 250, 126,  24,  39, 199,  44, 135, 241, 210, 184,  56,  41, // .~.'.,....8)
- 123,  28,  39, 253, 152,  60, 217,  52,  91,  26, 157, 209, // {.'..<.4[...
- 111, 111,  16, 127, 144, 158,  30,  15, 178,  52, 201,  87, // oo.......4.W
- 138, 153, 149, 181, 161,  62,  34,  11,  43,  29,  69, 201, // .....>".+.E.
- 242, 152, 227, 222, 210,  56,  97, 119, 185, 140, 200, 145, // .....8aw....
- 234, 119, 179, 240,  93, 180,  52, 102, 124, 154, 240,  29, // .w..].4f|...
- 244, 133,  17,  97, 171,  17,  79,  11, 112, 124, 204, 183, // ...a..O.p|..
-  70, 151,  87,  37,  35,   3, 122,  44, 205, 200, 226, 222, // F.W%#.z,....
- 242,  40,  61,  31, 192, 220, 105,  45,  39, 253, 130, 213, // .(=...i-'...
-  43, 214,  94, 185,   7, 168, 216, 198,  30,  52, 171,  29, // +.^......4..
- 159, 186, 184, 234, 225, 205, 114,  87,  70, 167, 213, 125, // ......rWF..}
- 150, 187, 166, 236, 144, 205,  82, 207, 107,  86, 123,  86, // ......R.kV{V
- 179, 190,  11,  81, 103, 169, 239,  43,  91, 205, 106, 167, // ...Qg..+[.j.
- 104, 150, 180,  95, 217, 182, 146, 150, 171, 176, 170,  54, // h.._.......6
- 171, 224,  57, 173,  85, 225, 150, 118,  90,  33,  82,  11, // ..9.U..vZ!R.
-  85, 128, 165, 109,  58,   4,  90, 165, 237, 107, 183, 200, // U..m:.Z..k..
- 219, 210,  18,  21,  82, 104, 131,  28, 162, 231,  91,  93, // ....Rh....[]
-  39, 105, 181, 174, 105,  68,  52,  29,  77,  26,  34, 180, // 'i..iD4.M.".
- 241, 177, 116, 119, 165, 103,  86, 178, 205, 134,  43, 185, // ..tw.gV...+.
-  56,  96, 203, 242,  42,  55, 250, 204, 248,   7, 117,  67, // 8`..*7....uC
- 198, 194, 207, 170,   3, 136, 185,  22, 117, 141,  14,  22, // ........u...
- 202,  71, 153, 154,  11,  90, 171, 125,  48, 171,  25, 194, // .G...Z.}0...
- 140, 182,  22, 153, 227, 147,  34, 101, 151,  37, 197,  27, // ......"e.%..
-  19,  86,  54, 242, 119, 181,   2, 250, 214, 202,  74, 229, // .V6.w.....J.
-  97,  99,  46,  47, 172,  92, 223, 159, 103,  86,  41, 139, // ac./....gV).
-  28, 144, 144, 254,  90,  70, 155,  73, 127, 109, 234,  22, // ....ZF.I.m..
-  27, 211, 166, 154,  93, 156,  60, 102,   7, 194, 121, 200, // ....].<f..y.
- 143, 114, 162,  67,  33, 101,  14, 175,  14, 124, 195, 142, // .r.C!e...|..
- 197, 226, 213, 145,  52,  94,  29, 183, 189, 215,  73,  74, // ....4^....IJ
-  68,  94,  29, 155, 201, 171, 163, 169, 188,  58, 215, 112, // D^.......:.p
- 121, 117, 220,  61,  16,  21, 107,  54,  47,  74, 160,   3, // yu.=..k6/J..
- 198,  43, 249,  87,  50, 122, 117,  64, 126, 212,  49, 156, // .+.W2zu@~.1.
-  94,  29,  87, 166, 157,  33, 246,  54,  63,  93, 234,  39, // ^.W..!.6?].'
- 121, 168, 173, 115,  45, 181,  87, 199, 221, 148,  89,  90, // y..s-.W...YZ
- 228,  94, 157, 223, 154, 221,  11, 178, 161,  92, 239,  53, // .^.........5
- 255, 164, 170, 203,  79,  21, 138,  47,  18,  46, 115, 124, // ....O../..s|
- 185, 197, 121,  83, 106, 201,  30, 123, 125, 149,  59,  58, // ..ySj..{}.;:
- 174,  60, 237, 229, 182,  14,  41, 130,  92, 176, 116,  75, // .<....)...tK
-  87,  85, 234,  62, 235,  36, 139, 175, 234, 172, 154,  96, // WU.>.$.....`
-  57, 166, 218, 252,  38, 139,  18, 102, 143, 134, 148, 120, // 9...&..f...x
- 148, 125, 250,  88, 100,  94, 185, 192,  41,  47, 214,  92, // .}.Xd^..)/..
- 155, 252, 252, 229, 154,  78,  82, 127,  71, 168,  40, 134, // .....NR.G.(.
- 186, 205, 228, 158, 225,  48,  45, 217, 111,  10, 219, 166, // .....0-.o...
-  94, 105,  46, 138, 176, 149, 225,  53,  55,  18,  39, 156, // ^i.....57.'.
-  50, 147,  63, 152, 223, 113,  64, 156, 235,  34, 175, 112, // 2.?..q@..".p
-  82,  85, 100,  61,  52, 221,  60, 166,  31, 227, 119, 121, // RUd=4.<...wy
-  58,  66, 150, 198, 104, 201, 210, 206, 241, 176, 117,  18, // :B..h.....u.
- 251, 202, 107,  39, 153,  99,  98, 235,  36, 229, 187,  70, // ..k'.cb.$..F
- 157, 100, 193, 221,  89, 245, 162, 104, 186,  57,  54, 182, // .d..Y..h.96.
-  27, 169,  64,  93,   6, 229, 162, 206,  95, 207, 253, 133, // ..@]...._...
-  58,  86,  77, 168, 156, 209, 162, 100,  25, 202, 225, 218, // :VM....d....
-  36, 169, 167, 197,  99, 235,  14, 242, 234,   5, 188,  38, // $...c......&
- 127, 126,  95, 135,  66, 215,  73,  22, 161, 231,  80, 113, // .~_.B.I...Pq
- 236, 123, 200,  95,  55, 155,  72, 212, 244,   4, 118, 112, // .{._7.H...vp
-  58, 137, 210, 117,  61,   2, 200,   5,  64, 193, 103,  72, // :..u=...@.gH
-  90, 114, 110, 213, 144, 190, 145, 212,  84, 172, 148, 233, // Zrn.....T...
-  49,  28,  75, 255, 184,  13,  40,  99, 217, 126, 211, 204, // 1.K...(c.~..
-  85, 235, 255,  52, 125, 119, 229, 230,  65, 203, 109, 206, // U..4}w..A.m.
- 117, 171,  63, 140,  44, 201,  35, 236,  36,  43, 201,  18, // u.?.,.#.$+..
- 174, 228, 138, 146, 164,  68, 109,  57, 130, 103, 239, 143, // .....Dm9.g..
-  47,  73, 125,  76, 221,  97, 207, 186,  36,  79, 179,  12, // /I}L.a..$O..
-  92, 150,  40,  71,  36, 247,  66,  46, 246, 194,  25,  23, // ..(G$.B.....
- 175, 196,  75, 241,  88,  28, 136,  45, 177,  45, 118, 196, // ..K.X..-.-v.
-  93, 113,  79, 124,  37, 190,  22, 223, 136,  63, 139, 173, // ]qO|%....?..
- 230, 156, 244,  21,  26, 194, 255,  44, 199, 202, 109, 244, // .......,..m.
- 148, 102,  58, 206,  79,  19, 242,  42, 226, 252, 114,   5, // .f:.O..*..r.
- 157, 231, 153, 209,  34, 165, 151, 122, 253, 223, 100,  44, // ...."..z..d,
-  30, 234, 249,  97,  65, 160, 179, 130,  16, 139,  89, 229, // ...aA.....Y.
- 239,  90, 146, 197, 253, 231, 230, 159, 119, 180,  47, 242, // .Z......w./.
- 171, 138,  87, 205, 159,  29,  76, 151, 163,  44, 204,  39, // ..W...L..,.'
-  89, 180, 130, 120,  75, 211, 244,  21,  13, 180,  53,  83, // Y..xK.....5S
-  47,  25, 106,  35, 122,  19, 127, 110, 102,  63, 251,  47, // /.j#z..nf?./
- 107, 148, 239, 228,  26, 198,  13,  27, 165, 180, 242, 177, // k...........
- 168,  81, 238, 214, 106, 253, 151,  59,  77, 119, 101, 203, // .Q..j..;Mwe.
- 254, 187,  50, 229,  21, 132, 155,  78,  82, 223, 122,   5, // ..2....NR.z.
- 249, 211,  86, 243, 238, 214, 221, 173, 237, 157, 123,  59, // ..V.......{;
- 247, 182, 238, 125, 245, 111, 104, 220,  39,  31, 104,  26, // ...}.oh.'.h.
-  18,  83, 235, 170,  21, 168, 229,  82, 159, 155, 222, 149, // .S.....R....
-  73,  42, 110, 230, 242, 155, 114,  60, 163, 236,  29,  94, // I*n...r<...^
-  23, 179,  20,  75, 157,  27,  41,  43,  86, 177, 130,  86, // ...K..)+V..V
- 227,  13, 252,  71, 202, 190,  31, 226, 178, 132, 146, 223, // ...G........
- 146, 210, 219, 171, 125, 183, 165, 252,  47, 104,  34, 236, // ....}.../h".
-  20, 171, 138, 203, 170,  80,  89, 156, 188,  45, 181, 120, // .....PY..-.x
- 197, 195, 242, 234, 213, 168,  46, 166, 222, 150, 122,  60, // ..........z<
- 197,  66, 174,  51,  72,  79,  87,  85, 169,  98, 245, 247, // .B.3HOWU.b..
- 182,  84, 225,  21, 208,  37, 111,  88, 131,  76,  78,   5, // .T...%oX.LN.
- 150, 249, 247, 127,  24,  79, 242, 185,  89,  68, 255, 143, // .....O..YD..
- 217, 220, 199,  24, 213, 121,  79,  96,  89,   3,  21, 187, // .....yO`Y...
-   7, 183,  69, 197,  30,  31,  60,  90,  94, 234, 113, 239, // ..E...<Z^.q.
- 214, 148, 247, 193, 195, 131, 165, 229, 197,  46, 204, 109, // ...........m
-  41, 239,  51, 179,  11, 180, 116,  60,  54,  49, 111, 119, // ).3...t<61ow
- 239, 253,  13,  28, 101, 224,  70, 254, 231, 186, 243, 115, // ....e.F....s
- 189,  77, 183, 172, 197, 204, 126, 222, 109,  81, 182, 195, // .M....~.mQ..
- 191, 191,  61, 114,  10, 131,  40,  17, 136, 151,  87, 163, // ..=r..(...W.
- 186,  13, 121, 107, 170, 243, 112, 255, 173, 243, 244, 200, // ..yk..p.....
- 121, 140, 237,  80, 135, 183,  67, 151,  47, 133,  89, 123, // y..P..C./.Y{
- 167, 246, 130,  24,   8, 168,  24, 145,  64, 109, 167, 138, // ........@m..
- 131, 145, 249, 247, 142,  32,  43, 232, 164, 131, 129, 120, // ..... +....x
- 210,  75,   1, 245,  85, 223,   3, 255, 128, 243, 168, 127, // .K..U.......
- 127,  95, 126, 208, 147,  45, 176,  92, 122, 117,  59,  71, // ._~..-..zu;G
- 139,  55, 193, 110, 166,  82, 213, 205, 113, 189, 125, 116, // .7.n.R..q.}t
- 160, 246, 211,  29,  69,   7, 142, 185, 179, 218,  72, 178, // ....E.....H.
- 212, 170, 126, 207,  29, 219,  81, 184, 133, 193,  83, 238, // ..~...Q...S.
- 223,  71, 245, 182, 127,  89, 245, 182, 127,  39, 213, 219, // .G...Y...'..
- 249, 101, 213, 219, 169,  89,  36, 249,  99, 119, 202, 231, // .e...Y$.cw..
- 124, 105, 131, 171, 108, 194,  94, 166,  57, 243,  41, 235, // |i..l.^.9.).
- 179, 172,  99,  39, 204,  34,  39, 124,  31, 198,  67,  70, // ..c'."'|..CF
- 252,  39, 249, 226, 117,  79, 110, 184, 142, 215,  44, 116, // .'..uOn...,t
- 217,  98,  59, 150,  19,  54, 141,  16, 203,  95, 183, 118, // .b;..6..._.v
- 251, 181, 166, 145, 127,  55, 147,  30, 131, 169,  93, 109, // .....7....]m
- 199,  98, 115,  31, 168, 110,  89, 179,  57, 140,  27, 157, // .bs..nY.9...
- 228, 126,  55, 115, 112, 178,  66, 255, 253,  54, 206, 207, // .~7sp.B..6..
-  38, 221, 150, 115,  63, 220, 211, 248, 110, 167,  28, 132, // &..s?...n...
-  51, 181, 155, 252, 213, 102, 145,  18,  48, 220, 230, 211, // 3....f..0...
- 120,  27, 117, 157,  55, 207,  29,  28, 106, 205, 157, 201, // x.u.7...j...
-  24,  29,  81,   3, 191, 149,  18, 182, 128, 227, 100,  66, // ..Q.......dB
-  74, 117, 236,  51,  72,  74, 127, 212, 157,  68, 173,  64, // Ju.3HJ...D.@
-  18,  61, 117, 249,  78, 126,  25, 187, 122,  78, 145,  86, // .=u.N~..zN.V
- 229, 140,  42,  35, 165, 254, 107, 123, 248,  43,   0, 174, // ..*#..k{.+..
- 174, 154, 222, 237,  36,   2,  88, 181, 244,  55, 165,   3, // ....$.X..7..
- 168,  49, 252,  10,  82,  86, 253, 253, 223,   9, 168, 219, // .1..RV......
- 119,   2, 170, 118,  85, 254, 198,  52,  13,  43, 219, 215, // w..vU..4.+..
- 101,  84,  13,  55, 233, 169, 191,   9,  97,  67, 237, 244, // eT.7....aC..
- 166,  32, 109, 176, 143,  96,  45, 165, 109, 176, 214,  22, // . m..`-.m...
- 126,  55, 196,  13, 215, 203, 251, 151,  81,  55,  92, 219, // ~7......Q7..
- 178, 183, 133, 190,  97,  85,  77, 252, 141,  72,  28, 106, // ....aUM..H.j
- 245, 208,  16,  57,  44,  56,   9, 120,  19,  42, 135,  34, // ...9,8.x.*."
- 213, 130, 204, 193, 170, 184,  97,  94,  40, 110,  53,  48, // ......a^(n50
- 247, 130, 250, 171, 129, 183, 149, 239,  62,  79, 234,  80, // ........>O.P
-  36,  95, 208,  58, 220,  36, 249, 130, 220, 161, 148, 133, // $_.:.$......
-  77, 239,  80, 170, 193,  42,   4,  15,  74, 106,  75,  41, // M.P..*..JjK)
-  30, 138, 147, 200,  22, 201,  67,  49, 151, 209,  52,  15, // ......C1..4.
- 218, 247,  49,  68,  15, 118,  73, 107, 245, 165,  74, 246, // ..1D.vIk..J.
- 224, 194, 200, 171,  35, 148, 230,  58, 214, 108, 182,  27, // ....#..:.l..
- 229, 141,   9, 240, 151, 248, 175,   5, 134,   5, 164,  29, // ............
-   5,  74,  30,  13, 229, 205, 184, 177,  66, 248, 139,   0, // .J......B...
-  75, 144, 148, 195,  40,  50, 255, 206, 162, 132, 140, 129, // K...(2......
- 239, 233, 171, 116, 230, 246, 237,   2, 244,  87, 134, 251, // ...t.....W..
- 101,  32, 213, 215,  97, 183, 149,   8,  12, 202,  64,   9, // e ..a.....@.
-  80,  80,  83, 115, 144, 131,   6, 177,  15, 112,   2, 141, // PPSs.....p..
- 222,  48,   6, 192,  42,  58, 193, 213, 213, 194,  87, 123, // .0..*:....W{
-  95, 221,   5, 106, 208,   2,  24, 105,  49,  14,  98,  64, // _..j...i1.b@
-  43,  84, 129,  99, 197, 100,  62, 247,  38, 208, 207, 170, // +T.c.d>.&...
- 161, 124,  67, 175,   6,   8,  17, 240, 136, 163, 218, 208, // .|C.........
- 254, 124, 168, 157, 191, 194, 196, 241, 197, 153, 137, 247, // .|..........
-  42,  26,   0,   6, 254, 180,  26, 112,  94, 133,   6, 201, // *......p^...
-  53, 214, 161,  70,  30,  22, 128, 139, 162, 218, 230,  41, // 5..F.......)
- 233, 162, 129, 157, 146, 119,   5, 133, 123,  49,   6,  74, // .....w..{1.J
- 200, 230, 166, 123,  39, 111, 156, 165, 227, 156, 254, 224, // ...{'o......
-  98,  34, 122, 214,  29, 235, 126, 159,  72,  24, 157,  97, // b"z...~.H..a
-  87, 165,  61,   6, 204, 159, 188,  90, 231,  89, 249,   3, // W.=....Z.Y..
- 243, 227, 234, 106, 173, 175, 238,  15, 203, 251, 140, 187, // ...j........
- 234, 158, 123, 116, 225, 208, 212, 224, 128, 211, 243, 134, // ..{t........
- 254, 110, 222,  72,  19, 236, 121, 216,  21,  88, 111, 140, // .n.H..y..Xo.
-  38, 221,  97,  60,  62, 243, 244, 153, 120, 190, 120,  63, // &.a<>...x.x?
-  19,  57,   3,  50, 208, 108,  97,  81, 236, 193, 192,  68, // .9.2.laQ...D
- 231,  43, 157, 252, 197,  57,  13, 105, 164,  94, 197,  55, // .+...9.i.^.7
- 185,  63,   5, 244,   5, 224, 249, 135,  54, 244,  69, 222, // .?......6.E.
- 192,  61,   7, 137, 236, 147,   4,   6, 157,  92, 227, 197, // .=..........
- 165, 193, 218,  86,  25, 214,  12, 173, 126,  24,  29,  85, // ...V....~..U
- 129, 158,  74,  97,   6, 235, 137, 163, 106, 184, 103, 122, // ..Ja....j.gz
-  68, 122, 212,  93, 128, 233,  22,  89,  56,  34, 234,  89, // Dz.]...Y8".Y
-  80, 174, 184,  14,  42, 172, 234,  81,  43, 137, 161,   5, // P...*..Q+...
- 186,  81,  11,  91, 126,  49, 118, 152, 247, 173, 229,  10, // .Q.[~1v.....
-  89,  31, 160,  98, 205, 102,   2,  24, 251, 226, 250, 134, // Y..b.f......
-  75,  54,  54,  18, 122, 151, 244,  61, 215, 245, 103,  98, // K66.z..=..gb
- 135, 190, 152, 137, 227, 224,  90, 160, 127,  96,  70, 245, // ......Z..`F.
-  11, 228,  73, 141,  82, 223, 164, 146, 191, 103,  24,  20, // ..I.R....g..
- 224,  43,  81,  43, 188, 243, 237, 104,  19, 243, 168, 112, // .+Q+...h...p
-  60, 102, 185,   2, 191, 145, 169, 230, 118, 170,  77, 113, // <f......v.Mq
- 225,  89,  72, 245, 234, 250, 134, 238, 196, 102,  36, 201, // .YH......f$.
- 249, 217,  95,  22,  89, 206,  23, 129, 178, 138,   7,  67, // .._.Y......C
-  73,  96, 203, 126,  38, 222, 144, 120, 197, 161, 203,  23, // I`.~&..x....
- 158,   1, 144,  73,  93,  68, 225,   8, 208,  19,  57,  75, // ...I]D....9K
- 233,  16,  75,   3, 121,  58, 233, 157, 177, 239, 231,  30, // ..K.y:......
- 149, 160, 228, 140,   9, 162,  89, 216,  19,  64,  11, 188, // ......Y..@..
- 136, 105, 166, 156,   0,  78,  82,  72, 212,  13,  74, 158, // .i...NRH..J.
-  26, 127, 102, 224, 127,  16,  10,   8, 255,   2, 242,   8, // ..f.........
-  33, 133, 152, 252, 217, 174, 238, 242,  79,   6,   3,  26, // !.......O...
- 216, 125, 187, 225, 198,  27,  27, 139, 174, 164, 191, 247, // .}..........
- 197, 248, 234,  10,  73,  23,  25,  89, 201,  42,  93, 223, // ....I..Y.*].
- 247, 252, 221,   4,  16,  21,   3, 157, 146, 252, 181,  16, // ............
- 156,  40,  71, 136,  66,  53, 165, 222, 214,   0,  46, 138, // .(G.B5......
- 110, 123,   3, 115,  67, 193,  62,  25, 220, 194, 170,  26, // n{.sC.>.....
-  75, 210, 110, 200, 139, 183,  27,  27, 231,  94,  41,   6, // K.n......^).
- 108, 178,  57, 253,  15, 180, 147, 121, 248,  65, 145, 249, // l.9....y.A..
-  10, 208, 177, 222, 144, 215,  26, 241, 208, 138,  92, 100, // ...........d
-  64,  54, 191, 185, 187, 216, 138,  81, 185, 214, 234, 200, // @6.....Q....
-  20, 108, 172,  68, 163,  82, 100, 241, 210, 121, 139,  71, // .l.D.Rd..y.G
- 249,   6, 123,  39, 140,  30,  69,  70, 166, 127,   0, 101, // ..{'..EF...e
- 241, 182, 133, 219, 116, 125, 141,  30, 116, 117, 229, 229, // ....t}..tu..
- 133, 170,  91, 237,  88, 220, 130,  40, 154, 225, 110, 115, // ..[.X..(..ns
-  39,  96, 148,  24, 144,   3, 181,  51, 207, 111, 205,  55, // '`.....3.o.7
- 140,   2,   2, 130, 169, 125,  28, 230, 145,  97, 142,   8, // .....}...a..
- 189,  20, 248, 175, 207, 200, 169,   7, 208,  43, 163,  66, // .........+.B
- 169, 176, 253,  56,  65, 117,  42, 161,   7,  17, 233,  64, // ...8Au*....@
-  31, 161, 212, 194,  22, 184, 236,  66, 136,  55, 105, 173, // .......B.7i.
- 169,  66, 215, 244,  65, 101, 209,  25,  24, 183, 174, 239, // .B..Ae......
- 249,  64, 237, 147, 179, 247, 181,   0, 192, 108,  12, 211, // .@.......l..
-  41,   3,   4, 244, 184, 254, 171, 153, 166, 115, 128,   0, // )........s..
- 146, 149,  76, 135,  41, 201, 214, 181,  70, 195,  92, 210, // ..L.)...F...
- 210, 198, 173, 190,   4,  51,  11, 173, 172, 208,  34, 211, // .....3....".
- 178,  91,  51,  64, 235, 146,  17, 254,  34, 244,   1,  80, // .[3@...."..P
-  56,  18,  61,  49,  16, 125, 113, 236,  87, 176,  98, 173, // 8.=1.}q.W.b.
-  81,  71, 227, 201,  89,  69,  59, 204, 143,   0, 233, 180, // QG..YE;.....
- 230, 169,  75, 100,  60,   8, 145, 144,  12,  33, 135, 134, // ..Kd<....!..
-  80, 144,  87, 218, 172,   0,  67, 207,  33,  65,  21, 252, // P.W...C.!A..
- 105, 121,  36, 211,  53, 154,  81,  45,  45, 253, 166, 113, // iy$.5.Q--..q
- 207,  31,  22, 132,  38, 246,  59,  51, 154, 237,  86, 210, // ....&.;3..V.
- 182,  76, 193, 161, 122,   0,  11,  74, 206,  52, 239, 228, // .L..z..J.4..
- 176,   4, 103, 212, 196, 234,  90,  20, 126, 158, 194,  24, // ..g...Z.~...
- 163, 151,   6, 239, 229,  19,  13,  47, 193, 177, 208, 137, // ......./....
- 220, 111,  94,  93, 169, 199, 189, 192,  51, 242, 225,  78, // .o^]....3..N
- 143,  43,  63,  26,  26,  23,  84,  33, 190, 149,  55, 208, // .+?...T!..7.
- 164,  14,  21, 196, 233, 101, 240, 218, 123,  37,  14, 188, // .....e..{%..
- 199,   2, 173, 231,  67, 132, 147,  82, 103, 117,  93, 142, // ....C..Rgu].
- 247,  33,  56, 225,  52,  27, 235,  83, 205, 177, 114,  34, // .!8.4..S..r"
- 186, 208, 163, 119, 248, 231,  69, 217, 228, 200, 220,  21, // ...w..E.....
-  62,  30, 233, 157, 167,   6,  21,   9,  90, 232,  93, 211, // >.......Z.].
-  81, 108,  44,  68, 223, 103, 252, 215, 134, 145, 149,  13, // Ql,D.g......
-  34,  25, 183, 199, 128,   6,  87, 120, 117, 202, 207,  15, // ".....Wxu...
- 130,  20,  21, 237, 162,  55, 190, 195,  63,  31,   2,  61, // .....7..?..=
-   3, 120,  84,  42, 161, 194,  84, 124, 166, 129, 198,  21, // .xT*..T|....
- 108,  61, 175,  27, 237, 173,  79,  47, 103,  18,  50, 222, // l=....O/g.2.
- 226,  28, 184, 136, 127,  14, 179, 254, 151, 114, 130,  96, // .........r.`
- 144, 237, 201, 128, 117, 193, 235, 224,  26,  50, 107, 118, // ....u....2kv
- 168,  91,  77, 154,  89,   0, 140, 217, 181,  86,  85, 183, // .[M.Y....VU.
- 154, 205, 247, 103, 187, 152, 133, 148, 194, 254,  68,  81, // ...g......DQ
-  79, 102,  85,  82, 142, 126,  56,  62,  99, 132,   3,  77, // OfUR.~8>c..M
- 215, 234,  86, 208, 242,  37, 157,  65,   1,  53,  41,  97, // ..V..%.A.5)a
-  48,  52, 115,   7, 224, 186, 230, 233,  58, 214, 167, 223, // 04s.....:...
-  22,  68,   2,   5, 133,  67, 153,  96, 160, 150, 158,  96, // .D...C.`...`
-  17, 197,   3, 197, 234, 213, 199, 146, 108,  15, 244, 126, // ........l..~
-  80, 188,  55,  20,   7, 121,  17,  54, 199,   1,  65, 175, // P.7..y.6..A.
-  79, 245, 107,  69, 118, 112,  50, 155, 163, 128,  80, 159, // O.kEvp2...P.
-  25, 233, 104,  86,   4, 106, 143, 186, 170, 215,  51, 158, // ..hV.j....3.
- 104,  38,  92, 170, 191, 198, 200,  46,  17, 194, 163,  93, // h&.........]
- 171,   4, 238,  37,  30,  17, 150, 233, 119,  51,  71, 205, // ...%....w3G.
- 211, 152, 143, 192,  97, 237, 167, 199,  23, 179, 146,  44, // ....a......,
- 109, 126,  17, 197,  17,  98, 213, 173,  92,  64,  36,  81, // m~...b...@$Q
-  87, 186,  50, 209,  47,  54, 236, 102, 244, 122, 141,  84, // W.2./6.f.z.T
- 144, 191,  64, 249,  36, 135, 176,  59,  79, 120,  18, 149, // ..@.$..;Ox..
- 216,  38, 212,   4, 151,  74, 182, 214, 180, 195,  71, 178, // .&...J....G.
-  26, 143, 202,  97,  76, 181, 240, 225,  38,  36,  22, 249, // ...aL...&$..
-  60, 137, 197,  89,  45, 137, 197, 102,  65,  97, 161, 217, // <..Y-..fAa..
-  85,  20,  83,  67,  49,  33,  30, 154, 137, 112, 100, 216, // U.SC1!...pd.
-  67, 166,  52, 174, 136, 210, 140, 214, 223, 189, 191, 137, // C.4.........
- 229, 186,  81, 190, 247, 217, 103, 255,  15, 225, 133, 234, // ..Q...g.....
-  65, 206,  37,   2,   0, 0 // A.%..
+  31, 139,   8,   0,   0,   0,   0,   0,   2,   3,  61, 142, // ..........=.
+ 187, 114, 194,  48,  20,  68, 123, 127, 133,  66,  27,  44, // .r.0.D{..B.,
+ 204, 192,  16,  10,  73,  77,  66,  77, 138,  52, 148,  66, // ....IMBM.4.B
+ 186, 182, 110, 162, 215,  72,  23,  19, 255, 125,  28, 156, // ..n..H...}..
+  73, 185,  59, 231, 236, 172, 120, 122,  59, 191, 126,  92, // I.;...xz;.~.
+ 222,  79, 204,  81, 240,  74,   4,  32, 205, 140, 211, 165, // .O.Q.J. ....
+   2, 201,  27, 245, 237, 241, 175, 139,  58, 128,  28,  17, // ........:...
+ 238,  57,  21,  98,  38,  69, 130,  72, 114, 117,  71,  75, // .9.b&E.HruGK
+  78,  90,  24, 209,  64, 251,   8, 107, 134,  17,   9, 181, // NZ..@..k....
+ 111, 171, 209,  30, 228, 150, 119,  43,  37,  60, 198,  47, // o.....w+%<./
+  86, 192,  75, 156,  85, 230,  10, 244, 210, 167,  33, 241, // V.K.U.....!.
+  58,  14, 140, 166,  12,  18, 131,  30,  96,  51, 199, 231, // :.......`3..
+ 239, 223,  31, 255, 124, 165, 201,  67, 117,   0, 180,  88, // ....|..Cu..X
+  58, 103, 254, 178, 235,  14,   7, 123, 221, 115,  83, 171, // :g.....{.sS.
+  18, 215, 100,  39, 213, 136, 106,  10, 102,  90, 198,  66, // ..d'..j.fZ.B
+ 178,  55,  15, 172,  22, 243, 224, 123, 216, 118, 123, 179, // .7.....{.v{.
+  59, 242, 207,  25, 223,  44, 160, 106, 154,  31,  87, 153, // ;....,.j..W.
+  24,  13, 252,   0,   0,   0, 0 // ......
+};
+
+static const unsigned char v2[] = {
+  31, 139,   8,   0,   0,   0,   0,   0,   2,   3, 149,  84, // ...........T
+ 219, 142, 211,  48,  16, 253, 149, 192,  10,   9,  86, 113, // ...0......Vq
+ 149,   2, 123, 145,  35,  33, 173,  16,  18, 188, 236,   3, // ..{.#!......
+  43,  62, 192,  73,  38, 137,  89, 199, 182, 236,  73, 219, // +>.I&.Y...I.
+ 108, 196, 191,  51,  94, 167,  73, 187,  45,   8, 250, 208, // l..3^.I.-...
+ 140, 199, 115,  59, 103, 102, 188, 234, 173,  50, 152, 174, // ..s;gf...2..
+ 158,  63, 201, 229,  94, 224,   5, 212, 198, 193, 124,  20, // .?..^.....|.
+  53, 130,  27,  11, 179,  99,  94,  62,  73, 221, 240, 194, // 5....c^>I...
+ 184,  10,  28,  35, 205, 175, 104,  51, 110, 101, 133,  45, // ...#..h3ne.-
+ 239, 164, 102, 165, 209,   8,  26, 243, 154, 190, 172,  22, // ..f.........
+ 157,  84,   3, 247, 131,  71, 232,  88,  47,  83,  38, 172, // .T...G.X/S&.
+  85, 192, 162,  34, 125, 128, 198,  64, 242, 227,  91, 250, // U.."}..@..[.
+ 221,  20,   6,  77, 250,  21, 212,   6,  80, 150,  34, 185, // ...M....P.".
+ 135,  30, 210,  59,  39, 133,  74, 239, 233,  38, 121,  16, // ...;'.J..&y.
+ 218, 167, 158, 254, 152,   7,  39, 235, 244,  46, 132,  73, // ......'....I
+  62,  27, 101,  92, 242, 165,  51,  63, 229,  28, 235, 229, // >.e...3?....
+ 241,  97, 232,  10,  51,  69,  57, 176, 207, 149, 212, 192, // .a..3E9.....
+  90, 144,  77, 139, 124, 189, 186,  34,  32,  12,  37,  42, // Z.M.|.." .%*
+  24,  17, 118, 200, 132, 146, 141, 230,  37,   1,   1,  23, // ..v.....%...
+ 161,  16, 116, 224, 235,  91, 187, 139, 199, 109, 244, 188, // ..t..[...m..
+ 201, 178, 224, 185, 117, 194, 142,  61, 149,  70, 229,  41, // ....u..=.F.)
+  40, 145, 107, 163,  33, 183, 198,  75, 148,  70, 115,   7, // (.k.!..K.Fs.
+  74, 160, 220,  64,  48,  53,  27, 112, 196,  44, 235,  53, // J..@05.p.,.5
+  81,  56, 206,  38, 162, 240,  70, 245, 248, 108,  18, 175, // Q8.&..F..l..
+ 130,  97, 173, 204, 150, 183, 178, 170,  64,  79,  76,  39, // .a......@OL'
+ 165, 208,  27, 225,  39, 194, 215,  89, 246,  38, 223, 131, // ....'..Y.&..
+   8, 114,  37, 189,  85,  98, 224, 133,  50, 229, 227, 249, // .r%.Ub..2...
+   2, 196,  78, 250, 243, 121,  21,  52, 160, 171,  51,   4, // ..N..y.4..3.
+ 116, 194,  53, 146, 108, 123,  52, 135, 100, 124, 180, 161, // t.5.l{4.d|..
+ 255,  76, 234, 192, 229, 120, 148, 122, 209,  39, 151, 243, // .L...x.z.'..
+  77,  84, 176, 151,   6, 232, 198, 152, 128, 185,   8, 228, // MT..........
+  58, 198, 141, 229,  36, 216, 142, 135, 140,  95,  71, 198, // :...$...._G.
+ 231, 203,  79, 151,  35,  17,  21, 134,  70,  77,  69, 119, // ..O.#...FMEw
+ 196, 151, 130, 252,  79,  89,  39,  79, 146,  40, 235,  35, // ....OY'O.(.#
+  17,  61,  81,   9, 221, 204,  36, 137,  71,  21,  17, 208, // .=Q...$.G...
+ 188,  16, 229,  99, 227,  12, 245, 134, 149,  74,  90, 110, // ...c.....JZn
+  69,  85, 209,  46, 132,  37, 120,  37,  59, 107,  28,  10, // EU...%x%;k..
+ 141,  11, 170, 144, 136,   8, 167,   2, 167, 245, 153, 246, // ............
+ 130, 191, 230, 175, 243, 179,   5,  47, 190,  52,  61, 248, // ......./.4=.
+ 118,  10, 240,  46,  20, 186,  17, 170,  95,   8,  14, 179, // v......._...
+  21, 140, 195,  38, 128,  39, 252,  83,  41, 124, 234,  71, // ...&.'.S)|.G
+ 212,   7, 222, 202, 222, 121, 227, 184,  53,  50, 180, 241, // .....y..52..
+  24, 188, 169, 107, 114,  53,  86, 148,  18,   7, 190, 250, // ...kr5V.....
+  16,  61, 195, 240, 142, 147,  61, 131,  13,  21, 236, 227, // .=....=.....
+  44,  47, 240, 249,  69, 246, 252,  91, 191, 207, 207,  78, // ,/..E..[...N
+  81,  76, 202, 118, 233,  34,  15, 103,  67, 110, 165,  82, // QL.v.".gCn.R
+ 172, 108, 133, 110, 128, 163, 163, 221, 166,  71, 167,  59, // .l.n.....G.;
+ 141, 153, 163, 177,  60, 203,  21, 212, 200, 159,  91, 223, // ....<.....[.
+  62,  37,  47, 210, 108,  48,  57,  76,  54,  61,  79, 211, // >%/.l09L6=O.
+  52, 217,  93,  82,   9, 223,  66, 149,  92,  92, 103,  55, // 4.]R..B...g7
+ 213, 109, 113, 184,  48,  39, 241, 134, 147, 120, 187, 113, // .mq.0'...x.q
+ 126, 238,  16,  77, 119,  46, 224, 178, 140,   7,   4,  88, // ~..Mw......X
+ 252,  15, 212,  49,   5, 207,  18, 194,  44, 171, 124, 143, // ...1....,.|.
+  64,  84, 178, 247, 252, 138,  22, 251, 239, 180, 252, 251, // @T..........
+ 116, 134, 237, 143, 221,  79, 231, 134,  47, 231,  61, 228, // t....O../.=.
+  19, 205, 112, 162, 177, 147, 219, 241,  88, 254,   6, 144, // ..p.....X...
+ 143, 129,  97,  82,   6,   0,   0, 0 // ..aR...
+};
+
+static const unsigned char v3[] = {
+  31, 139,   8,   0,   0,   0,   0,   0,   2,   3, 180, 189, // ............
+ 121, 127, 218,  72, 214,  40, 252, 247, 157,  79, 129, 245, // y..H.(...O..
+ 100,  60,  82,  40,  48,   2, 175,  34, 101, 126, 105,  39, // d<R(0.."e~i'
+ 233, 164, 199,  78, 210, 113, 210,  75,  24, 143,  91,  64, // ...N.q.K..[@
+   1, 106,  11, 137, 150, 132, 151,  54, 188, 159, 253,  61, // .j.....6...=
+  75, 149,  22, 192, 221,  61, 207, 157, 219,  29, 139, 218, // K....=......
+ 151,  83, 167, 206,  86, 219, 120,  17,  13, 179,  32, 142, // .S..V.x... .
+ 106, 202,  86,  34,  19, 161, 136, 156, 199,  15, 131,  95, // j.V"......._
+ 213,  48, 107, 142, 212,  56, 136, 212, 199,  36, 158, 171, // .0k..8...$..
+  36, 123, 160, 232, 199, 137, 202, 188,  80, 164, 240, 141, // ${......P...
+ 132, 138,  22,  51, 149, 248, 131,  80, 121,  59,  45,  49, // ...3...Py;-1
+ 140, 163, 113,  48,  89,  24, 255, 202,  89, 221, 250,  73, // ..q0Y...Y..I
+ 141,  74, 148, 147,  48,  30, 248, 225, 231, 105, 144, 138, // .J..0....i..
+  88,  62, 174,  68, 130, 159,  64,  70, 205, 185, 159,  12, // X>.D..@F....
+  85, 248,  73, 253, 182,   8,  18, 117, 178,  63, 108, 119, // U.I....u.?lw
+ 163,  69,  24,  74,  25, 236, 238, 218, 118,  32, 199, 186, // .E.J....v ..
+ 113, 182, 114,  30, 131, 177, 173, 106,  65,  84, 139, 157, // q.r....jAT..
+  68, 101, 139,   4,  28, 125, 117, 213,  84, 247, 243,  56, // De...}u.T..8
+ 201, 210, 174, 137,  77, 156,  71, 170,  86,  38,  16, 219, // ....M.G.V&..
+  29, 169,  80, 101, 170,  70, 110,  12,  14, 229,  99,  48, // ..Pe.Fn...c0
+ 242, 148, 208, 185, 188, 199, 213, 170,  91,  42,  77, 134, // ........[*M.
+  34, 107,  14, 253,  48, 180,  67,  83,  48,  52,  63, 119, // "k..0.CS04?w
+  59, 133, 147, 250,  22, 201, 215,  73,  18,  39, 182, 117, // ;......I.'.u
+ 230,  71,  81, 156, 213,   0,  90, 163, 218,  44,  30,  45, // .GQ...Z..,.-
+  66,  85, 251, 135,  85,  87, 117, 235,  31, 150, 211, 205, // BU..UWu.....
+ 166,  73, 124,  87, 139, 154, 195, 120, 164, 164, 117, 241, // .I|W...x..u.
+ 225, 213, 151, 243, 215, 215, 239,  63, 124, 190, 126, 243, // .......?|.~.
+ 225, 203, 251,  87, 150, 136,  86,  78,  51,  81, 147,  32, // ...W..VN3Q. 
+ 205,  84,  82, 234, 176, 200, 156,  71, 108, 183, 204,  86, // .TR....Gl..V
+  98,  11, 156, 100, 224,   8, 187,  37, 130,  60, 171,  99, // b..d...%.<.c
+  91,  71,  95, 254, 233, 127, 107, 137, 188,  12, 128, 189, // [G_...k.....
+ 243,   8,   0, 168,  69,  34, 238,  42,  59, 203, 251, 100, // ....E".*;..d
+  37,  42,  26, 169, 196,  18, 182,  35,  79, 223,  57, 162, // %*.....#O.9.
+  18,  55,  76, 148, 159, 169, 179,  56, 202, 212, 125, 198, // .7L....8..}.
+  73, 126,  92,  75,  50, 205, 102,  33, 199, 124, 187,  22, // I~.K2.f!.|..
+ 179,  72, 213, 235, 241,  24, 144, 135, 163,  85, 188,  25, // .H.......U..
+ 255,  73, 141, 117, 100, 178,  25, 121, 161, 102, 177, 142, // .I.ud..y.f..
+  13,  54,  99,  43, 141,  82, 254,  90, 130, 129, 159,  13, // .6c+.R.Z....
+ 167,  58, 238, 245,  90,  92,  26,  76,  34,  95, 183,  89, // .:..Z..L"_.Y
+ 189, 221,  44, 249, 178,  28, 255, 253, 122, 119,  57, 252, // ..,.....zw9.
+ 194,  33,  28,  74,  68,  32, 124, 145, 138, 133,  24, 138, // .!.JD |.....
+ 177, 152, 139, 145, 152, 138, 137, 152, 137, 107, 196, 233, // .........k..
+  91, 217, 191,  18,  15, 114, 207,  31,   6, 217,  82, 221, // [....r....R.
+ 219,  61,  47,  93,  78, 150, 209, 114, 190, 124, 230,  44, // .=/]N..r.|.,
+ 147, 249, 116,  57,  73, 130, 209,  50, 190,  75, 151, 179, // ..t9I..2.K..
+ 104, 184, 140, 178, 187,  37, 204, 176, 254, 112, 122, 181, // h....%...pz.
+ 252,  61, 142, 151, 255, 142, 147, 209,  50, 128, 193, 244, // .=......2...
+ 247,   2, 113,  47,  95,  38, 137, 255, 208,  12,  82, 250, // ..q/_&....R.
+ 237, 154,  97, 173,  13,  24,  57, 198, 128, 121, 132, 211, // ..a...9..y..
+ 136, 246, 153, 163, 250,  33, 224,  10, 124,  12,  66, 171, // .....!..|.B.
+  85, 158, 227,  14, 231, 143, 218, 221,  85, 136,  71,  42, // U.......U.G*
+ 202, 222,   3,  42,  86, 125, 128,  70, 179, 248,  86, 157, // ...*V}.F..V.
+  77, 131, 112,   4, 137, 139, 172,  23,  76,  21, 120,  86, // M.p.....L.xV
+   1,  30,  97, 231, 161, 163,  93, 172,  61, 224, 154, 173, // ..a...].=...
+  27, 245,  96, 193, 148, 237,  69,  80, 127, 112, 229,   1, // ..`...EP.p..
+ 118, 141, 201,  31, 179, 223, 135,  15, 185, 112, 146, 250, // v........p..
+ 201,   4, 136,  70, 148, 165, 205,  80,  69, 147, 108, 122, // ...F...PE.lz
+ 218, 134, 153, 238,  55, 135,  88,  49,  52,  70, 110, 196, // ....7.X14Fn.
+ 119, 122,   9,  79, 201,  60,  70, 180,  29,  47, 116, 132, // wz.O.<F../t.
+ 101, 218,   8, 117, 101,  15, 115,  21, 143, 107, 208,  41, // e..ue.s..k.)
+  36,  31,  59,  82,  33, 237, 242,  23,  97, 134, 196,  43, // $.;R!...a..+
+ 117, 242, 198, 174, 133, 223, 198, 193, 168, 214, 146,  82, // u..........R
+  98,  19, 177,  29, 216, 210, 106,  26,   8, 113,  12,  68, // b.....j..q.D
+ 111,   0,  22, 190,  64,  32,  96,  45,  37,  32, 221,  24, // o...@ `-% ..
+ 210,  41,  98,   6,  20, 208,  55, 108,  18,  80, 154,  57, // .)b...7l.P.9
+  22, 226, 101,   2,  96,   4, 116,  19,  32,   3, 116, 243, // ..e.`.t. .t.
+ 250, 250, 198, 195,  18, 192,  97, 126,   7,  94,  11, 190, // ......a~.^..
+ 202, 120, 135, 236,   0, 146, 154, 102, 201,  98, 152, 197, // .x.....f.b..
+ 137, 199, 109, 133, 184,  91, 143,  73, 100, 220, 171, 215, // ..m..[.Id...
+ 125,  47, 134, 144, 192, 107, 184, 240, 179, 240,  90,  57, // }/...k....Z9
+  53, 211,  73,  12,  60, 130, 230, 109,  68,  99, 174,  29, // 5.I.<..mDc..
+  54,  76, 189, 164, 104, 255,  57, 226, 135,  65, 155, 124, // 6L..h.9..A.|
+  44, 138, 248,  51, 198, 184,  12, 232, 119, 147,  58,  36, // ,..3....w.:$
+ 193, 143, 158,  33,  79,  72, 160,  81, 121, 218, 103, 156, // ...!OH.Qy.g.
+  22, 134, 154, 219, 144,  57, 121, 193, 215, 215,  61, 136, // .....9y...=.
+ 133,  31, 129, 159, 160, 238,  58, 212, 149, 110, 142, 201, // ......:..n..
+ 221, 236,   5, 198, 220, 232, 177, 239, 102, 245, 186, 163, // ........f...
+  11, 218, 145, 118,  40,  41, 178, 159,  93,  57, 166,  95, // ...v()..]9._
+  33,   4,  40,  83,   1, 121,  52,   0, 182,  33,  71,  19, // !.(S.y4..!G.
+  29, 216,   2, 174, 182, 104, 242,  37, 118, 223, 222, 193, // .....h.%v...
+ 210,  71, 128,   5, 244,  43, 119,  90,  80,  11, 116, 119, // .G...+wZP.tw
+ 145,  78,  33, 122, 119, 119, 231,  51,   4,  39, 245, 250, // .N!zww.3.'..
+ 114, 185, 216,   1, 228,   6,  36,  25, 196,  80,   0, 144, // r.....$..P..
+  51,  36, 165,  65,  52, 113, 144, 101,  45, 182, 198,  44, // 3$.A4q.e-..,
+ 151,  67, 199, 254,  92,  66, 152, 207,  54, 227,  73, 142, // .C...B..6.I.
+  54,  34,   1, 204,  90,  16,  36, 210, 102,  10, 100, 199, // 6"..Z.$.f.d.
+  30,  59,  93,  37, 193,  61,  13, 198, 153, 237, 116,  29, // .;]%.=....t.
+ 211, 186,  76, 154, 169,   1, 124,  85,  35,  69,  34, 237, // ..L...|U#E".
+ 152, 224, 227,  64, 162,  91, 252,   0, 162,  34,  37,  90, // ...@.[..."%Z
+ 224,   7, 225, 242,  17,  27,  23, 201, 129,  13,  52,  42, // ..........4*
+ 118,  40, 153, 140, 241,  91, 119, 197,   6, 114,  68, 142, // v(...[w..rD.
+ 120, 101,  83,  46, 106,  26, 186,  34,  46, 165,  25, 249, // xeS.j.."....
+  51, 149, 206, 253, 161, 250, 242, 233, 157, 232, 180, 119, // 3..........w
+ 177, 140,  69, 175, 159,  92,  49, 194, 250, 130,   7,  61, // ..E...1....=
+   1,  48, 199, 142, 151, 136, 157,  29, 219, 164, 114,   4, // .0........r.
+ 252, 139, 138, 154, 201,  77,   3, 138,  14, 152, 120, 145, // .....M....x.
+ 248, 100, 227, 244, 210, 201, 212, 142,  76, 118, 119, 199, // .d......Lvw.
+ 133, 120, 146,  49, 204,   0,  94, 221,   2,  41,   0, 247, // .x.1..^..)..
+  32, 109, 142,  16, 232,  25,  50, 109,  68, 167, 226, 128, //  m....2mD...
+ 230, 192,  79, 149, 164,  22, 134, 178, 213,  13,  95, 100, // ..O......._d
+ 101,  44,  11,  43,  88,  22,  81, 150,  27,  32, 164, 121, // e,.+X.Q.. .y
+ 161, 212,  26,  64, 255, 141,   2,   9, 225,   6, 192,  47, // ...@......./
+ 111,  86,   6, 201, 161, 149, 171,  21,  64, 208,  17,  57, // oV......@..9
+   5, 203,  16, 143, 244, 152,  58,  93,  66,  35, 217,  42, // ......:]B#.*
+ 112, 225, 119, 187, 138,   5, 154, 179, 112, 103,  11, 246, // p.w.....pg..
+ 242,  32,   6,  50, 130,  22,  97, 227, 150, 203,  91, 113, // . .2..a...[q
+   1,  45, 209,  29, 192, 222,  46,  42, 162,  67, 133,  22, // .-.....*.C..
+  21, 101, 194, 124, 209, 168,  51, 151,  99,  49,   2,  80, // .e.|..3.c1.P
+  96,  86, 154,  85, 204, 108,  96, 208,   0, 153,  90, 221, // `V.U.l`...Z.
+ 228,  69, 220,   5,  92, 119,  52,  76, 124,  32, 223,   9, // .E...w4L| ..
+ 194, 195,  26, 196, 113, 168, 252, 200, 218,  49, 179, 202, // ....q....1..
+ 135, 192, 124, 174,  21, 161,  61, 104,  80,  82,  31,   9, // ..|...=hPR..
+ 200, 202, 147,  54, 185, 146,  22, 208,  50, 152,  13, 197, // ...6....2...
+ 140, 244, 151,  75,  11,  68, 200,   1,  72,  34, 149, 176, // ...K.D..H"..
+  65,  48,   9, 162, 172,  18, 230,  55,  75, 180,  80, 202, // A0.....7K.P.
+  75,  42, 169, 119,  99, 151, 176, 174, 248,  56, 222, 189, // K*.wc....8..
+ 237,  59,  16, 123,  46,  30,  13,  49, 243, 252, 213,  70, // .;.{...1...F
+ 170, 130, 252, 151,  75, 223, 221, 245, 161, 197, 131, 211, // ....K.......
+  22,  20, 224,  19, 205,  16,  62,  83,  61, 248,   5,  50, // ......>S=..2
+  14,  95,  32, 227,  61, 250, 106, 172, 167,  89, 231, 249, // ._ .=.j..Y..
+  56, 173, 164,  34, 239, 128, 186,  61, 128, 217, 149,  50, // 8.."...=...2
+ 222,  53,  92, 160,  26, 246,  80,  98, 100, 176,  49,  86, // .5....Pbd.1V
+  60,  82,  56, 254,   1, 100, 164,  74,  36, 211,  43, 200, // <R8..d.J$.+.
+  79,  76,  61, 167, 167,  50,  93,  46,  83, 152, 171, 224, // OL=..2].S...
+ 192, 132, 208,  90,  12, 163, 180, 187, 187, 208,  25, 187, // ...Z........
+  13, 216, 134, 211,  45,  39, 139, 148, 247, 180, 174,  17, // ....-'......
+  60,  93,  75,  69, 204,  49, 150,  33, 176, 144,  68, 134, // <]KE.1.!..D.
+ 117, 183,  27, 159, 202, 214, 114, 153, 188, 200, 209, 139, // u.....r.....
+ 136,  57, 134, 146, 195, 198,   6, 197, 136,  12, 229,  98, // .9.........b
+ 182,  55,  40, 151, 212, 187, 113, 163, 177, 130, 204,  69, // .7(...q....E
+ 169,  69,  89, 201, 127,  86,  86, 130, 136, 185,  50, 243, // .EY..VV...2.
+ 173, 225, 174, 128, 102, 132, 128, 222, 115,   7,   9, 240, // ....f...s...
+ 188, 209,  16,  80, 106, 216,  31,  98, 169,  54,  21, 184, // ...Pj..b.6..
+ 148, 109, 152, 142,  12,  61,   0, 158,   1,  35,  14,  90, // .m...=...#.Z
+ 207, 110, 184,  82,  14, 119, 119,  71, 144, 111,  27,  30, // .n.R.wwG.o..
+ 107, 184, 218,  62,  23, 180, 239,  56, 222, 112,  71,  46, // k..>...8.pG.
+  32, 100,  40, 229, 162, 225, 246,  32, 163, 135, 206,  58, //  d(.... ...:
+  56, 235, 117, 207,  30, 158,  46,  40,  12,  60, 162, 200, // 8.u....(.<..
+ 228, 120, 249,  44,  32, 142,   7, 125, 159,  19, 224, 121, // .x., ..}...y
+ 178, 141, 203, 147,  13,  91, 191,   5,  38, 212,  23,  37, // .....[..&..%
+ 145,   6,   0, 141, 122, 102, 167, 208, 167,  50, 113, 172, // ....zf...2q.
+ 160,  17,  86,  16,  52,  23, 209,  12,  24,  81, 134, 132, // ..V.4....Q..
+  93,  59, 129,  58,   9,  24, 236,  12, 113,  23, 203, 140, // ];.:....q...
+ 155, 195,  69, 130,  50, 224, 238, 110, 238,   4,  60,  37, // ..E.2..n..<%
+  74, 183,  92, 190, 181,  89, 210,   1, 241, 143, 225, 183, // J....Y......
+  35,  41,  51, 146,  88,  70,  10, 152,  55, 179, 121,  28, // #)3.XF..7.y.
+  65, 174,  31, 131,  48, 252, 194, 149,  56,  89, 242, 240, // A...0...8Y..
+ 184,  61, 202, 118,  86,  67, 148, 210,  73, 159, 195,  74, // .=.vVC..I..J
+  96,   2, 128,  32,  21,  51,  61,  69, 182, 240, 145,   0, // `.. .3=E....
+ 132, 184, 194,  53, 221, 148, 192,  20,  27, 140,  68, 104, // ...5......Dh
+ 197,   0,  36, 144,  97, 109, 252, 197, 190,   3, 221, 216, // ..$.am......
+  28, 191, 140,  81, 167,  11, 177, 119, 204,  16,  28,  65, // ...Q...w...A
+ 237, 167, 178, 185, 159, 154, 137, 174, 236,  84,   0,  76, // .........T.L
+ 115,   1, 106, 101, 131,  50,  40,   6, 128,  89,  23,  14, // s.je.2(..Y..
+ 144, 203,  86, 119, 254, 226, 162,  59,  47, 134, 105,  74, // ..Vw...;/.iJ
+ 194, 199,  77, 127,  78, 136,  54, 146, 136,  72, 114, 138, // ..M.N.6..Hr.
+ 179, 187, 119, 237,  13, 250, 228, 186,  90,  46, 175,   5, // ..w.....Z...
+ 185, 228,  28, 180, 130,  87, 208, 219,  41,  16, 244,  42, // .....W..)..*
+ 157,  23,  19, 202,   6,  81,  56,  42, 128, 138, 248, 179, // .....Q8*....
+  35, 181, 207,  30, 241, 239,  91, 118, 240, 120,  76,  97, // #.....[v.xLa
+ 232,  89,  50, 161,  84,  84, 197, 112, 185, 156,  64, 132, // .Y2.TT.p..@.
+  65, 244, 153,  97,  94,  19,  40,  99,  38,  39, 142, 216, // A..a^.(c&'..
+ 223, 157,  18,  62,  46,  71,  68, 239, 185, 177,  55, 189, // ...>.GD...7.
+ 130, 113, 108, 197, 162,  45, 130, 148,   6, 234,  35,  19, // .ql..-....#.
+  14,  26,  36,  98,  26,  32, 109, 110,  29,  35,  26,  34, // ..$b. mn.#."
+   2,  55, 112, 223,  98, 192,  10,  88, 135, 171, 140, 249, // .7p.b..X....
+ 125,   8, 137, 225,  47, 211, 179, 110,  39,  34,   1, 211, // }.../..n'"..
+  15, 162, 212,  14,  17, 202,  33, 224, 125, 134,  93, 108, // ......!.}.]l
+  66, 144,  74, 178, 111,  20, 180,  65, 241, 192, 138, 144, // B.J.o..A....
+ 167,  54,  40, 233,  60, 174,  78, 119,  20, 131, 194,  15, // .6(.<.Nw....
+ 229, 133, 205,   8, 132, 212, 203,  96,  16,   2, 211, 232, // .......`....
+ 222,   1,  71,  80, 154,  24,  66, 228, 177, 132, 129,  68, // ..GP..B....D
+ 177, 231, 115, 137, 200, 132,  43, 123,  10, 195,   3, 146, // ..s...+{....
+ 226, 150, 254,  79, 117, 243,  24, 111,  96, 186,  60,   0, // ...Ou..o`.<.
+  16,  31,  60,   4, 244,  66,  78, 202, 117,  57,  52,  50, // ..<..BN.u942
+ 139,  93, 217,  56,  42,  58,  75,  56,  55,  19, 139,  66, // .].8*:K87..B
+   2, 120, 173, 181, 125,  78,   0,  18, 205, 114,   9,  98, // .x..}N...r.b
+  27, 143, 163,  66, 126, 168, 153, 110,  33, 202,  46, 151, // ...B~..n!...
+ 246,  61, 204, 161, 158,   2, 185,  98, 166, 236, 178, 153, // .=.....b....
+ 132,  11,  91,  57,  94, 102, 100,  87,  64, 249, 162, 174, // ..[9^fdW@...
+ 143,  70, 159, 179,  26,  88,  94, 191, 117, 133, 133, 168, // .F...X^.u...
+  44, 183, 242, 100, 186, 226, 176, 103,  89, 160, 102, 121, // ,..d...gY.fy
+  10, 228, 109,  89,  10,  50,  28,  59, 159,  99,   0, 247, // ..mY.2.;.c..
+ 135, 102, 166,  82,  36,  46, 189, 208,  11, 235, 214, 252, // .f.R$.......
+ 222,  42,  42, 124, 185,  33, 143, 116, 149, 135, 136, 149, // .**|.!.t....
+ 102,  15, 161, 194,  54,  56, 236, 171, 202,   6,  33,   8, // f...68....!.
+ 188, 148, 162,  57,  76, 211, 207, 168,  99, 132,  93,  21, // ...9L...c.].
+ 166, 234, 113,  91, 226, 136, 164, 246, 106, 242,  72,  90, // ..q[....j.HZ
+  22,  96,  10, 145, 143,  12, 117, 191, 200,  65, 212,  66, // .`....u..A.B
+  23, 180, 248, 163,  73,  15, 109, 131, 116, 136, 233,  97, // ....I.m.t..a
+ 145,  52, 116, 160, 196,  16,  59,  14, 244,  22, 126, 170, // .4t...;...~.
+ 233,  49, 194,  89,  97,  99, 106, 216, 152,  88, 195,  17, // .1.Yacj..X..
+   4,  33,  26, 162, 190, 123, 229,  36,  50, 211, 178, 105, // .!...{.$2..i
+ 162, 230,  33, 136, 203, 246,  92,  88, 207,  92,  11, 199, // ..!....X....
+   2,   2, 179, 248,  60, 190,  83, 201,  25,  16,  61, 219, // ....<.S...=.
+  65, 181,  20,   6,  57, 142, 222, 196, 195,  69, 250,  97, // A...9....E.a
+  65, 130,  79,  17, 240, 142,  10, 237, 173, 101, 106, 166, // A.O......ej.
+  97,   0, 165, 182, 113, 152, 141,  19, 180,  42, 232,  25, // a...q....*..
+  52,  52,   4,   5, 157, 124, 253, 172, 158, 160,  81,  43, // 44...|....Q+
+ 236,  69, 189, 176, 185,   0, 129, 117, 225, 217, 232,  24, // .E.....u....
+  65, 172,  63,  26, 189, 190,   5, 242, 124, 142, 230, 163, // A.?.....|...
+  72,  65, 215,  69, 210, 155, 120,  83, 145,  16, 187,  98, // HA.E..xS...b
+ 131, 192,  83,  41, 138, 177, 152, 102, 217, 220, 219, 219, // ..S)...f....
+ 187, 187, 187, 107, 222, 117, 154, 113,  50, 217, 107, 183, // ...k.u.q2.k.
+  90, 173, 189, 244,  22, 199,  39, 118, 202,  48, 216, 187, // Z.....'v.0..
+ 135,  73, 113,  99, 191,  93, 122,  83, 103,  15, 205,  42, // .Iqc.]zSg..*
+  78,  17, 149, 190,   7, 205, 226,  25, 132, 166,  22,  23, // N...........
+  78, 176, 189,  11,  70, 217,  20,  81,  13, 128,  59,  85, // N...F..Q..;U
+ 193, 100, 154,  25,  15, 218,  24, 216,  25,  66, 235, 180, // .d.......B..
+  19,   6, 112, 166, 157, 153,  63, 120,   7, 234, 215, 189, // ..p...?x....
+ 246, 142, 226, 187,  40, 140, 253, 145, 246,  38, 241, 221, // ....(....&..
+ 229, 156, 197,  88, 240,  13, 227, 176, 228,  75,  96, 178, // ...X.....K`.
+ 105, 231,  60, 158,   3,  12,  18, 246,  17, 102,  40,  98, // i.<......f(b
+ 110, 235, 115,  34, 100,  37, 160, 166,  10, 238, 182, 218, // n.s"d%......
+  66,  56, 112, 116, 116, 174, 229, 114,   7, 249,   5,  96, // B8ptt..r...`
+  36, 204,  67,  40, 190, 191, 143, 243, 144,  97, 254,  50, // $.C(.....a.2
+   3, 244,  30,  44,  50, 212,  37,  60, 154, 156, 165,  16, // ...,2.%<....
+ 145,  55,  74,  98, 163, 220, 124, 162, 130, 218, 145, 207, // .7Jb..|.....
+ 185, 111,  74, 250, 124,  97,  13,  36, 150,  77, 106, 187, // .oJ.|a.$.Mj.
+  54, 231,   0, 161,  36,  95, 159,   9, 110,  93, 149, 196, // 6...$_..n]..
+  76,   8, 114, 224,  79, 130,  28, 147,  15,   7, 248,  95, // L.r.O......_
+   0, 246, 104,  34, 153,  19,  52, 144,  52,  20, 162,  73, // ..h"..4.4..I
+  79, 255,  98, 179,  81,  11,  42, 218, 243, 170, 164, 226, // O.b.Q.*.....
+  60, 169, 224, 220, 130, 138, 115,  33, 110, 196, 165, 248, // <.....s!n...
+  44,  94, 139, 143, 226,  27, 241,  74, 124,  18, 111, 197, // ,^.....J|.o.
+  59, 201, 205, 195, 182, 229,  36,  55,  43,  75, 236,  78, // ;.....$7+K.N
+ 201, 232, 209, 117, 219, 199, 187,  33,  81,  93, 148, 209, // ...u...!Q]..
+  88, 255,  12,  89, 255,   4, 149, 120, 161, 121,  62,  81, // X..Y...x.y>Q
+ 225,  43,  16, 134, 230,  18, 229, 144,   1, 112, 151,  57, // .+.......p.9
+ 180,  91, 147, 166, 205, 161, 123,  71, 227,  14, 113, 168, // .[....{G..q.
+ 118, 177,  50, 112,  35,  45, 112, 100,  49, 166, 176,   0, // v.2p#-pd1...
+  53, 222, 237, 238, 190, 107, 230,  33,  77,  54, 177, 138, // 5....k.!M6..
+  75,   9,  85, 188,  51, 134,  18, 226,  49, 192, 153, 251, // K.U.3...1...
+ 115, 228, 216,  87, 226, 179, 156, 247,  46, 123, 151,  92, // s..W.....{..
+  98, 243, 214,  15,  23, 202, 195,  40, 143, 245, 237,  97, // b......(...a
+ 239,  65, 130, 104, 193,  18,  11,   5, 144, 138, 129,  12, // .A.h........
+ 252, 181, 103, 223, 244,  56,  98,  36,  35, 117,  87, 123, // ..g..8b$#uW{
+ 103,  95, 136, 207, 142, 103, 151, 195, 206,  40,  76, 140, // g_...g...(L.
+  42, 202, 211,  59,  49, 210, 141, 147,  95,  29, 113, 185, // *..;1..._.q.
+ 187, 123, 217,  76,  23,   3, 123, 132, 233, 216, 184, 115, // .{.L..{....s
+   1, 174,  52, 243,  51, 100,  51, 218,  69,  20, 101, 148, // ..4.3d3.E.e.
+ 219, 123,  62,  11, 108,  67,   4,  42, 251, 148,  90, 131, // .{>.lC.*..Z.
+ 230,  18,  10, 154, 162, 193,   1,  28, 233,   0,  28, 142, // ............
+ 184,  97,  41,  68,  82, 162, 148, 164,  25, 248, 149, 186, // .a)DR.......
+ 208,  60, 126,   7,  32,  52,  81, 217,  43, 149,   4, 183, // .<~. 4Q.+...
+ 106, 116, 137, 113, 111, 146, 120,  70,   6, 184,  60, 147, // jt.qo.xF..<.
+ 201, 149,   7, 144,  49, 131, 156,  64,  86,   7,  28,  40, // ....1..@V..(
+ 158,  46, 200, 190,  48, 137,  81, 228, 210, 125,  21,  51, // ....0.Q..}.3
+  83,  44,  69, 222, 130, 140,  50, 117, 242,  86, 255,  81, // S,E...2u.V.Q
+ 171, 184, 221, 163, 170, 152, 123, 193, 242, 246, 182,  80, // ......{....P
+ 187, 212, 219,  82, 252, 171,  96, 148, 103,   2, 240,  49, // ...R..`.g..1
+ 207, 222,  18,  95,  80, 220, 191, 212, 186,  11, 152,  35, // ..._P......#
+ 147,  39,  26, 249,  73,  13,  21, 228, 209,  41, 255,  32, // .'..I....). 
+ 146, 177, 103,   7,  27, 134,  80,  55, 133, 165, 211, 120, // ..g...P7...x
+  17, 142, 206,  76, 174,  47, 243,  17, 141,  10,  17, 180, // ...L./......
+  39,  98,  13, 236, 161, 188, 229,  50,  35,  64,  19,  62, // 'b.....2#@.>
+ 223,  58, 133, 173, 230, 150, 205, 121, 183,  52, 190, 107, // .:.....y.4.k
+ 136, 200, 248,  35,  52, 170, 185,  44, 196, 235,  89,  76, // ...#4..,..YL
+ 238,  27, 150, 198, 217, 189,  41,  20,  41, 109, 214, 147, // ......).)m..
+  40,  25, 137, 215,  32, 172, 190, 126,  65,  88, 106, 164, // (... ..~AXj.
+ 213, 215,  32, 173,  86,   6,   0, 226, 250, 175, 175,  64, // .. .V......@
+ 134, 212, 184, 204, 216, 173, 147, 231, 134, 193, 145, 147, // ............
+  83, 254, 173, 160,  54, 176, 217,  26,  92,   2, 202,  83, // S...6......S
+ 168,  81, 228, 207, 155, 150, 119, 203, 121, 220, 150, 214, // .Q....w.y...
+  38,  82,  10, 189,  68,  21, 170,  58,  97,  11, 152, 162, // &R..D..:a...
+ 154, 197,   8, 175,   0, 154, 226,  35, 209, 192,  68, 124, // .......#..D|
+  35,  91, 226, 134,   7, 100,  59, 220, 197, 199, 221, 221, // #[...d;.....
+ 143, 168,  67, 206, 165, 161,  33, 102, 172,  68,  49, 141, // ..C...!f.D1.
+ 116, 157, 142, 120,   5, 112, 126,  85, 133, 243, 171, 109, // t..x.p~U...m
+ 112, 126,  85, 130,  51, 203,  85,  32, 185, 255,  47, 235, // p~U.3.U ../.
+ 172,  52,  92, 203, 250,  35,  54, 157, 214, 235, 223, 188, // .4...#6.....
+ 104,  31,  56, 213, 174,  25, 168, 195,  84, 162, 197,  15, // h.8.....T...
+ 189, 196,  68,  74, 246, 192,  38,  18,  19,  97, 169, 107, // ..DJ..&..a.k
+ 241,  54,  82,  17,  24, 180, 157, 105,  49, 112, 144, 228, // .6R....i1p..
+  50, 242, 231,  48,   1, 180,  98,  98,  70, 207, 190, 125, // 2..0..bbF..}
+  58,  22, 199,  11, 138,  90,  72,  52,   3, 222, 219, 159, // :....ZH4....
+  36, 151,  54,   7, 126,  68,  92,  15, 230, 212, 185, 153, // $.6.~D......
+ 240, 115, 180, 137, 244, 230, 154,  91, 228, 150, 173, 185, // .s.....[....
+ 211, 251, 228, 245,  63,  93, 109,  97, 177, 208, 112, 210, // ....?]ma..p.
+ 172, 179, 124, 162, 160,  50, 226,  30, 186,  79, 161, 179, // ..|..2...O..
+ 120, 208, 228, 245,  53, 193,  71, 242,  66,  71, 161, 179, // x...5.G.BG..
+ 143, 121, 170, 178,  77, 107, 200,  26, 215, 142, 244,  81, // .y..Mk.....Q
+ 132,  87, 205, 108, 170, 162,  98,  62,  47, 150, 114, 216, // .W.l..b>/.r.
+ 115,  15,  91,  30, 112, 228, 238, 130,  20, 173,  69, 174, // s.[.p.....E.
+ 104, 237, 238,  46,  42,  74, 153, 179, 144, 213,   0, 191, // h...*J......
+ 239, 131, 146,   7,   2, 220, 135, 177, 189, 112,  88, 218, // .........pX.
+ 210, 179, 126, 193,  56, 130, 245, 188, 149, 190, 193, 172, // ..~.8.......
+ 183, 141,  70, 215, 185, 179, 253, 254, 219,  43,  45,  64, // ..F......+-@
+  62,  65,  35, 186, 198, 240, 128, 106,  16,  23, 197, 224, // >A#....j....
+ 245,  81, 243,  44,  72,  83, 207,  94,  39,  44, 186,  48, // .Q.,HS.^',.0
+ 199,  51,  82, 196, 166, 201, 213, 192, 158, 133, 155, 242, // .3R.........
+ 242,  32, 136,  55, 144, 157, 241, 118, 144,  11,  17,  23, // . .7...v....
+  37, 225, 198,  98, 153, 249, 162,  23, 203,  63, 146, 170, // %..b.....?..
+  61, 107, 230, 131,  80, 252, 100,  66, 247, 228, 228, 120, // =k..P.dB...x
+ 239,   2, 146, 208, 231, 226, 220, 242,  98, 224, 227,  79, // ........b..O
+  37,  61, 217, 187, 167, 213,  92,  99, 224, 241, 121,   0, // %=.....c..y.
+ 199, 104,  27, 126, 145,   3, 119, 204,  38, 114, 123,  34, // .h.~..w.&r{"
+ 253, 254, 152,  12, 193, 101, 169,  20, 165, 159, 137,   4, // .....e......
+  89, 235,   2, 144, 231, 162,  55, 105, 134, 241, 208,  15, // Y.....7i....
+  81, 160, 135,  70, 122,  29, 137,  74, 177,  81, 176, 129, // Q..Fz..J.Q..
+  22, 203, 137, 192,  82, 216,  18, 198, 214, 243,  85,  46, // ....R.....U.
+ 119, 170, 210, 210, 209, 133,  17, 236,  70, 160,   8, 225, // w.......F...
+ 210,  95, 147, 215, 166,  81, 191, 195,  69,  75, 123, 128, // ._...Q..EK{.
+ 107,  36, 107, 145, 175,  67, 133, 190, 247, 151, 118,  12, // k$k..C....v.
+ 226, 228, 160,  25,   0, 143,  27, 192,   4, 131, 166, 225, // ............
+ 192, 207, 208,  26,   6,  63,  32,  73, 251,  56, 237, 144, // .....? I.8..
+ 153, 248, 185, 205,  73, 219,   6,  47, 156,   7, 248,  14, // ....I../....
+ 150, 203,   5, 174, 146, 194,  52, 245, 217, 107, 107, 207, // ......4..kk.
+ 160, 224, 198,  62, 162, 141,  94, 161, 212,  75, 103, 216, // ...>..^..Kg.
+ 180, 212,  41, 134,  27, 141,  64,  59,  11,  67,  39, 124, // ..)...@;.C'|
+  82,  51,  31, 112, 177, 152, 129,  12, 154, 152,   1, 100, // R3.p.......d
+  90, 134, 247,  67,  31, 192,  93, 142,  68, 200, 211,   2, // Z..C..].D...
+ 204,  21,   0, 148, 100,  69,  50, 223, 143,  81,  47, 121, // ....dE2..Q/y
+ 192, 225, 153, 200,   7,  72,  35,  44,  67,  25,   0,  71, // .....H#,C..G
+ 198,  37, 101, 106, 228,  71,  19, 149, 196, 139,  52, 124, // .%ej.G....4|
+ 184,  84, 217, 187,   8,  52, 186, 183, 159,   1,  63,  48, // .T...4....?0
+ 213,  72,  78, 242, 132,  59,  92, 228, 128, 109, 124,  22, // .HN..;...m|.
+ 213, 132, 137,  80, 141, 226, 149, 209,  31,  40,   8, 211, // ...P.....(..
+ 128, 158,  58, 156, 170, 225, 141,  26,  85,  83, 156, 233, // ..:.....US..
+  64,  42,   7, 137, 115,  16,  65, 115, 209,  22, 160,  77, // @*..s.As...M
+  88,  19,  17,  59, 171, 188, 249,   3, 103,  34,   7,  27, // X..;....g"..
+ 109, 239,  77, 229, 196, 251, 163, 102, 247, 230, 152,  32, // m.M....f... 
+ 111,  96, 111, 134, 222,  82, 123, 122, 183,  16, 176, 216, // o`o..R{z....
+ 186,  66,  49,  89,  46,  17,  88,  48, 174, 224, 226, 118, // .B1Y..X0...v
+  77,   4, 129,  47, 118, 216,  60, 139, 150,  50, 180,  40, // M../v.<..2.(
+  35, 161, 132,  25,  34,  89, 136,  69, 231, 114,  89,  10, // #..."Y.E.rY.
+  84,  64, 166, 116, 147,  28, 194, 144, 220,  43,  77,  42, // T@.t.....+M*
+  71, 147, 159, 254,  85,  14,  99,  94, 103,  44, 146, 162, // G...U.c^g,..
+ 173, 130,  57, 192, 212, 233,  77, 189, 254, 212,  80, 115, // ..9...M...Ps
+ 212, 105,  65, 241, 141, 120,  75,  14, 205, 250,  63, 158, // .iA..xK...?.
+ 200,  30, 211,  32, 191, 231, 247,  91,  87,  30,  17, 175, // ... ...[W...
+ 221, 221, 103, 118,  40,  90,  14,  17,  38,  81,  70, 195, // ..gv(Z..&QF.
+ 113,  65,  63, 199, 134, 126,   2, 150, 117, 161, 239,  16, // qA?..~..u...
+ 167,  33,  43,  80, 207, 153,  36,  42,  77, 177, 122, 195, // .!+P..$*M.z.
+ 140, 102,  91, 244,  85, 157, 161, 180, 178,  50,  91,  46, // .f[.U....2[.
+ 103,   8,  36,  40,  21, 122,  92,  20, 180,  35,  47,  32, // g.$(.z...#/ 
+   6, 109, 122,  86,  60, 215,  35, 115, 193, 105, 113,  16, // .mzV<.#s.iq.
+  28,  51,  38,  51,  51,  38,  48,  89, 242, 145,  21, 185, // .3&33&0Y....
+  26,   8, 194,  34, 136, 141, 186, 120, 206, 113, 107, 114, // ..."...x.qkr
+  56, 249, 154, 220, 202, 214,  76, 160,  68, 163, 145,  59, // 8.....L.D..;
+ 106,  13, 150, 116, 192,  81,  48,  30, 171, 145,  86,   3, // j..t.Q0...V.
+   5,  42, 145, 196, 195, 122,  92, 149,  87, 178, 214, 125, // .*...z..W..}
+  50,  22,  52, 179, 108,  29, 193,  52, 142,  94, 152, 165, // 2.4.l..4.^..
+ 181, 110,   4, 115, 247, 173,  29, 246, 163,  43,  17, 246, // .n.s.....+..
+ 235, 245, 252, 199,  33, 198,  51, 100, 250,  51,   4, 250, // ....!.3d.3..
+ 163, 208,  70,  83,  21,  85, 113, 145,  29, 237,  11, 196, // ..FS.Uq.....
+  95, 166, 132,  54, 164,  81, 109, 177, 243,  41, 166,  57, // _..6.Qm..).9
+  40, 208, 110, 218, 212, 137, 143, 129,  10,  94,  90, 114, // (.n......^Zr
+ 126, 107, 154, 173,  21, 217, 109,  43, 228, 122, 151, 135, // ~k....m+.z..
+ 220, 186, 122,  14, 208, 232,  70,  72,  15, 193,   1, 202, // ..z...FH....
+  76, 100,  16,  33,  35, 172, 135,  64, 137,   6,  11, 205, // Ld.!#..@....
+  81, 149,  89,  77, 144, 217,  86, 139, 127, 209, 174, 175, // Q.YM..V.....
+ 166,  93, 198, 252, 169, 247,  21,  24, 125, 149, 211, 231, // .]......}...
+ 201, 223, 173, 239,  71, 129, 193, 236, 102,  50, 231,   2, // ....G...f2..
+ 180,  66, 158, 179,   4, 227, 208,  76, 193,  17, 216,   4, // .B.....L....
+  30,   1,  50, 147, 138,  24,  23, 124, 183, 153, 106, 156, // ..2....|..j.
+  30, 246, 206,  35, 235,  49, 173, 184, 178, 157, 155,  86, // ...#.1.....V
+ 213,  83, 252, 188, 194,  17, 148, 246,  14,  90,  10,  33, // .S.......Z.!
+ 214, 161,  25, 126,  97, 159,  51, 121, 235, 163, 113,  33, // ...~a.3y..q!
+  70, 202, 127,  13, 131,  81,  89,  53, 167,  28, 189, 126, // F....QY5...~
+ 120, 229, 197,  92,  71, 214,  28,   7,  73, 202, 226, 165, // x...G...I...
+ 217, 236, 146, 149,  89, 137,  89,  91, 231, 156,  33, 228, // ....Y.Y[..!.
+ 195, 149,  18,  85, 201,   8, 136,  13,  60,   7,  23, 208, // ...U....<...
+  21,  56,  10, 120, 253, 200, 182, 101, 189, 249,  13, 119, // .8.x...e...w
+ 150, 100, 210, 130, 159,  51, 171,  62, 171, 215, 113,   7, // .d...3.>..q.
+ 138,  18,  32, 211, 166, 184, 147, 207,  91, 219, 125, 182, // .. .....[.}.
+ 190,  33,   4, 145,  77, 128, 102, 120,  27, 140,  42, 137, // .!..M.fx..*.
+ 139, 117, 249, 242,  24, 174,  73, 204, 128,  37,  33,  25, // .u....I..%!.
+  37, 128, 136,  11,   0, 250, 227, 202,  65,  43,  26,  38, // %.......A+.&
+  21, 219, 210, 203, 146, 162, 147, 175, 201, 152,  93,  39, // ..........]'
+ 155,  43,  75, 229, 228,  33, 243, 115,  78, 188,  85,  31, // .+K..!.sN.U.
+ 173, 108,  44,  44, 182, 181,  48,  87,  69, 130, 194,  46, // .l,,..0WE...
+  28, 124, 152, 229, 175, 253, 225, 116, 109, 238, 145, 230, // .|.....tm...
+ 212,  18, 184, 115,   4,  38, 153, 174, 105,  49, 168, 148, // ...s.&..i1..
+  27, 162, 137,  21,  28,  93, 222, 144, 168, 182, 182, 187, // .....]......
+ 171, 254, 188,  59, 216,  12, 222, 201, 104, 227, 250,  21, // ...;....h...
+ 138, 169,  44, 111, 224,  12,  23, 165,  13,  59, 171,  98, // ..,o.....;.b
+ 145, 193,  12,  19,  10, 241,  97, 211, 140, 112, 217,  14, // ......a..p..
+  37, 195,  85,  34, 111, 217, 122,  44,   2, 196,  13, 229, // %.U"o.z,....
+ 109, 174,  75,  27,  34,  71, 107, 211,  93, 222, 109, 209, // m.K."Gk.].m.
+  37,  89, 208, 172,   4, 130,  18, 132, 232, 104,  12, 100, // %Y.......h.d
+ 118,  34, 227, 138, 113, 206,   8,  62, 201,  54, 115,   5, // v"..q..>.6s.
+ 109, 160, 164, 133,  72,  16,  40,  41, 212, 126,  58,  29, // m...H.().~:.
+ 173, 101,   4, 180,  76,  56,  50, 124,  44, 174, 232, 192, // .e..L82|,...
+ 103,  72, 106, 120,  93, 115,  61,  20, 186,  20,  45, 151, // gHjx]s=...-.
+ 104, 198, 202,  75,   8, 242, 245, 105,  82, 120,  98,  77, // h..K...iRxbM
+ 169,  50, 148,  81, 179,  21, 239, 219,  84, 171,  21,  76, // .2.Q....T..L
+ 250, 150,  56,  43, 153, 246,  76,  83, 215, 118, 107, 242, // ..8+..LS.vk.
+  22, 166,  80, 107, 112, 132,  18, 100, 244,  50,  46,  52, // ..Pkp..d.2.4
+  91,  18, 158,  96, 222, 158,   9, 245, 140, 131, 237,  89, // [..`.......Y
+  69, 138, 167, 118, 184, 217,  10,   8,  45, 165,  69, 193, // E..v....-.E.
+  34, 199,  93,   0,  13,  68,  14, 128, 209,  43,   3,  27, // ".]..D...+..
+ 149, 215, 141,  70, 149, 204, 248,  64,  27,  39, 109,  15, // ...F...@.'m.
+ 200, 223,  37, 217, 131, 129, 104,  87, 250,   7,  99,  62, // ..%...hW..c>
+  84,  79,  77,  20,  93,  24,  59, 105,  18,  20, 213,  76, // TOM.].;i...L
+ 205, 146, 211,  19,   5, 107, 179, 227,  57,  83, 208, 225, // .....k..9S..
+  54, 194,  11, 120,  59,  11,  82, 213, 211, 191, 165, 204, // 6..x;.R.....
+ 168,  93,  54,   7, 160,  19, 218,  38,  14,  36, 137,  56, // .]6....&.$.8
+ 188,  85, 160, 139, 123,  48,  36, 159, 131, 153, 138,  23, // .U..{0$.....
+  25,   8,  10,  79, 144,  49, 104,  57, 154, 122,  27, 153, // ...O.1h9.z..
+ 113, 173, 132, 222, 140,  35, 230, 114, 207, 254,  24,   7, // q....#.r....
+  48,  55, 146,  51, 127,  14, 233, 149, 243, 108, 169,  93, // 07.3.....l.]
+ 207, 246,   2, 220,  42,  35, 166, 242,  27,  27, 181, 133, // ....*#......
+   9, 254, 130,  48,  53,   3, 182, 143,  67, 254,  69, 188, // ...05...C.E.
+  17, 191, 138, 247, 226, 195,  83, 187,  58, 186, 184,  58, // ......S.:..:
+ 164, 247, 218, 240, 230,  64, 183,  91, 218,  94, 129,  11, // .....@.[.^..
+ 165, 148,  48, 192, 205,  16, 245, 250, 149, 224, 237,  54, // ..0........6
+ 160, 127,  66, 190, 165,  12, 122, 174, 215, 198,  69,  39, // ..B...z...E'
+ 138, 188, 114, 188,  12, 196, 137, 228, 170,  11, 122,  21, // ..r.......z.
+ 238, 185, 196, 178, 125, 111,  95, 123, 220,  43, 169,  55, // ....}o_{.+.7
+ 111, 251,  41, 238, 121, 181,  49,   8, 209,  30, 180,  29, // o.).y.1.....
+ 239, 128,  18,  81, 144,  52, 225,  64, 132, 169,  56,  44, // ...Q.4.@..8,
+ 228,  48,  47, 196,   4, 214, 165,  95, 183,  44,  15,  50, // .0/...._.,.2
+ 197, 168, 138, 204, 231, 225,   3, 112, 152,  15, 180,  15, // .......p....
+  18, 152, 156, 101,  17, 166,  93, 209, 146,  44,  13,  61, // ...e..]..,.=
+   8, 106,  40, 119, 246, 184, 233, 109,  15, 250, 144,  52, // .j(w...m...4
+ 218, 208, 123, 129,  93, 146,  32, 149, 121,  58, 165, 159, // ..{.]. .y:..
+ 203, 103,  64, 214, 127,  38, 206, 112, 225, 207, 197, 183, // .g@..&.p....
+ 210,  94, 103,  44, 153, 252,  25,  73,   2,  99,  84, 206, // .^g,...I.cT.
+  98, 128, 159, 100, 121, 174, 159, 113,  78, 218, 204,  75, // b..dy..qN..K
+ 160,  49,  16, 243,  65, 251,  40, 167,  66, 201,  60, 163, // .1..A.(.B.<.
+  52,  48,  52,  21, 156,  54, 131, 194, 251, 212,  93,  16, // 404..6....].
+   8, 160,  83,   9, 126,   2,   9, 125, 128, 177,  40, 167, // ..S.~..}..(.
+  70,  19,  39,  45,  54, 146,  70,  29,  23, 203,  87, 255, // F.'-6.F...W.
+ 254,  87, 250, 252,  95,  17, 124, 150, 198, 241, 108, 111, // .W.._.|...lo
+ 130,  43, 139, 142, 211,  11, 184, 195,  48,  81,  64,  42, // .+......0Q@*
+  69, 117, 216,  20,  17,  59,  61,  91,  71, 118,  40,  18, // Eu...;=[Gv(.
+  90, 208, 118, 188,  54, 167, 176, 154, 205,  38, 204,  11, // Z.v.6....&..
+ 220, 196, 169,  76,  25, 251, 144, 172, 149, 167, 128, 152, // ...L........
+ 157,  60, 234,  64, 180,   4,  76,  70, 168,  33,  58, 149, // .<.@..LF.!:.
+   7, 184, 221,  15, 196, 143,  29, 152, 155,  56, 234, 145, // .........8..
+  67, 234,  47,  37, 140,  32,  97, 140, 180,  35, 146, 135, // C./%. a..#..
+  68,  51, 138,   8,  40, 220,  68,  56,   4, 137,  21, 204, // D3..(.D8....
+ 212,  86,  55,   5,  29,  85,  35, 107, 138, 200, 138,  54, // .V7..U#k...6
+ 121,  13,   9,  31,  36,  65,  31, 247, 162, 228, 216, 189, // y...$A......
+ 128,  12, 139,  23, 170, 159,  94, 153,  60,  11, 200,   3, // ......^.<...
+ 236,  15,  66, 250, 139,  43,  65,  25, 123, 214,  11, 236, // ..B..+A.{...
+  90, 214, 179, 177,   0, 128, 116, 112,   5, 181, 118,  28, // Z.....tp..v.
+  47, 174, 203, 140, 144,  25, 146,  52,  26, 186, 251, 214, // /......4....
+ 169,  78, 108,   6,   8, 210, 201, 172,  30, 163, 130, 147, // .Nl.........
+ 244,  64, 248, 147,  73,  15, 135, 140, 115, 255, 195, 250, // .@..I...s...
+ 135, 228,  21, 212, 127, 112, 182,   4,   2, 243,  34, 176, // .....p....".
+  62,  40,   6, 160, 132, 186, 135, 204,  11,  62,  16, 161, // >(.......>..
+ 140, 117, 225, 214,  30,   5, 163,  13, 240, 197,   1, 148, // .u..........
+  67, 121, 185, 253, 117, 247, 202, 225,  66, 204,  56,   6, // Cy..u...B.8.
+  50, 128, 118,  96, 161, 129,  48,  30, 134, 103,  27, 160, // 2.v`..0..g..
+  25,  97,   4, 140, 152,  85, 179, 116, 163, 254, 143, 113, // .a...U.t...q
+ 252,  43, 202,  93,  73, 165, 113, 109,   6,  67,  94, 133, // .+.]I.qm.C^.
+ 181, 147,  67,   2,  26, 186,  47, 116,  37, 102, 250,  16, // ..C.../t%f..
+   4,  87, 188, 206,  15, 131, 145, 239, 146, 238, 195, 180, // .W..........
+  52,  91,  16, 221,  94, 230, 225, 148,  92,  57,  76,  65, // 4[..^....9LA
+  47,  28, 241,   3, 204, 201, 127,  34,  25, 254,  13,  26, // /......"....
+ 254, 157, 252,  13,   9, 162, 248, 137, 126,  19, 241,  61, // ........~..=
+ 252, 178,  70,  36, 148, 162, 176, 161,  80,  25,  56, 244, // ..F$....P.8.
+  62,  34, 161,  66,  10,  45,  54, 165,  43,  77, 109,  49, // >".B.-6.+Mm1
+  20,  56,  48, 253, 216, 111,   0, 163, 126,  64, 225,  24, // .80..o..~@..
+ 107, 211,   7,  48, 222,  64, 204,  91, 152,  62, 244, 139, // k..0.@.[.>..
+  82, 135,   7, 109, 128, 196, 240, 179, 202, 103, 183,  58, // R..m.....g.:
+  37,  83,  91, 110, 159,  36,  15,   1,  21,  25,  56, 250, // %S[n.$....8.
+  64, 192,  46, 132,  92,  21, 151, 165,  92, 104, 202,  23, // @........h..
+  16, 109,  59,  78, 119, 231,  55, 230, 192, 106,  78,  26, // .m;Nw.7..jN.
+ 224,  91,  72, 131, 187,  72, 120, 155,  94, 216,   4, 130, // .[H..Hx.^...
+  43, 168,  25,   5, 235, 194, 117, 212, 162, 216, 164, 180, // +.....u.....
+ 142, 250,   3, 160, 136,  10, 236,  13, 169, 244,  81,  43, // ..........Q+
+  58,  30,  74,  10,   0, 243,  82, 246,  96,  75, 171, 138, // :.J...R.`K..
+ 141,  32, 219,  26, 101, 115, 231, 222, 226,  86,  25, 210, // . ..es...V..
+ 253,  20,   7, 148,  10, 245,  11, 178, 248, 198, 136, 115, // ...........s
+ 125, 197, 203, 137, 121,  45,  39, 165, 237,  38,  67, 220, // }...y-'..&C.
+ 172, 221,  51,  11, 207, 164, 255, 112, 109,  64,  45,  50, // ..3....pm@-2
+  90, 250, 123, 131, 168,  83, 150, 128, 121, 187,  90, 169, // Z.{..S..y.Z.
+ 210, 212,  46,  40, 165, 234,  42, 249, 207,  98,  95,  50, // ...(..*..b_2
+  89, 126, 105, 131,  49, 254, 188, 229, 245, 241,  28, 168, // Y~i.1.......
+  70, 122,  86,  67,  71, 108,   9,  29, 151,  66, 209, 248, // FzVCGl...B..
+  95,   8,  96, 165,  80, 241,  27, 233, 141,  25,  37,  69, // _.`.P.....%E
+ 173, 150, 112, 181,  66, 151, 223, 176, 125, 248, 187, 221, // ..p.B...}...
+ 221, 239,  80,  42, 166,  28, 107,  98, 128,  98, 235, 238, // ..P*..kb.b..
+ 141, 254,  97,  83,  32,  53, 125,  38, 243,  16, 104,  14, // ..aS 5}&..h.
+  72, 219,  42, 228,  61,  52,  84,  76,  82, 169, 232, 167, // H.*.=4TLR...
+ 221, 221, 159,  80, 190, 249, 162, 241,  57, 147, 246,  27, // ...P....9...
+ 218, 234,  73,  43, 179, 111, 187,  72,  52, 126, 133, 185, // ..I+.o.H4~..
+ 250, 134, 173, 199, 212, 252,  55, 198, 129,  33,  79, 234, // ......7..!O.
+  19, 239, 205,  18,  21, 121,  16,  46,   1,  59, 205, 254, // .....y...;..
+  52,  71,  47, 238,  86, 129, 154, 109,   0,  52, 175,  23, // 4G/.V..m.4..
+ 218,   8,   3, 251, 171, 124, 131,  29, 225, 217,  92, 233, // .....|......
+ 203, 247, 187, 187, 223, 151, 213,  19, 232,  68,  55,  99, // .........D7c
+ 240, 188,  69,  17,  47,  31,  46,  51,  11, 109, 220, 195, // ..E./..3.m..
+ 250,  79,  35,  60, 238, 238, 190, 135, 142, 254,   6,  60, // .O#<.......<
+ 240, 183, 133,  74, 179, 151,  81,  48, 243, 177, 232,  55, // ...J..Q0...7
+   9, 104, 187,  48, 193, 237, 247,  79,  69,   2,  55, 222, // .h.0...OE.7.
+ 224, 241, 128, 187, 165, 169,  53,  12, 149, 159, 104, 129, // ......5...h.
+  14, 183, 163, 171, 197, 238, 238, 208, 143, 134,  42, 172, // ..........*.
+ 150, 132,  50, 108,  33, 250, 209, 208,  71, 178,  20,  16, // ..2l!...G...
+  10, 183, 213, 114, 186, 152,  29, 100, 130, 173, 141, 161, // ...r...d....
+  41, 239, 216,  42, 117,  24, 116, 111, 159,  30, 164,  64, // )..*u.to...@
+  15, 209,  91,  52, 250, 241,   8, 229,  99, 131, 112, 214, // ..[4....c.p.
+ 106,  39, 145, 203,  53, 236, 203,  54,  13,  56, 102, 162, // j'..5..6.8f.
+ 108,  78, 146, 169, 212, 225,  65,   8,   2, 105,  37,  19, // lN....A..i%.
+ 207, 106,  58, 170, 176,  92, 170,  49, 171, 159,  60, 107, // .j:....1..<k
+ 194, 173, 181,  40, 166, 199, 182, 210,  88, 129, 235, 159, // ...(....X...
+  89,  49, 169, 194, 124,  82,  65, 213, 120,  38,  72, 229, // Y1..|RA.x&H.
+ 168, 191,  88, 215,  68, 177,  52, 192,  15, 146, 167, 186, // ..X.D.4.....
+ 102, 208,  24, 109, 180, 153, 228, 173,  38,  45,  79, 194, // f..m....&-O.
+ 144, 250,  60, 196,  86, 231,  70,  33, 192, 188, 213, 202, // ..<.V.F!....
+ 144,  61, 125, 158,  33,  99,   6,  66, 251,  17, 121, 149, // .=}.!c.B..y.
+ 120,  69,  21, 170, 197,  54, 149,  97, 235, 176, 150,  56, // xE...6.a...8
+ 211, 176,  68,  49, 243,  22, 111, 179, 249, 104,  48,  13, // ..D1..o..h0.
+  77,  51,  66, 208,  44, 196, 155, 242, 225,  22, 130, 184, // M3B.,.......
+  41, 171, 203, 137, 241, 107, 175, 167, 155, 151, 117, 143, // )....k....u.
+  29, 152,  14,  70, 130, 162, 189,  43, 236,  68, 155, 210, // ...F...+.D..
+ 154, 249, 175, 108,   7,  35, 187, 102, 120, 165, 207,  81, // ...l.#.fx..Q
+ 194, 220, 197,  83,  87, 121,   5, 211, 255, 248,  16, 152, // ...SWy......
+ 154, 172, 233,  67, 137,  31, 221, 128,  26, 130,  63, 160, // ...C......?.
+  98, 176, 255,  84, 251,  27,  24,  64, 235, 111, 160,  46, // b..T...@.o..
+ 209, 111, 169, 160, 217,  90,  65,  20,  47, 145,  62,  99, // .o...ZA./.>c
+  94, 169,  52,  43, 209,  75,   1, 189, 150, 167, 174, 109, // ^.4+.K.....m
+  19,  56, 247, 179, 169, 211, 156, 249,   0, 160,  91, 167, // .8........[.
+ 249,  43, 232,  92,  54, 218, 190, 117, 116, 169, 146, 235, // .+..6..ut...
+ 202, 153, 164,  92, 208, 182, 255, 253, 175, 189, 250,  18, // ............
+ 254, 158,  57,  44,  96,  55, 211, 121,  24, 100,  54, 200, // ..9,`7.y.d6.
+ 108, 101, 214, 123,  91, 228, 182,  60,  11,  13,  58, 195, // le.{[..<..:.
+ 169, 159, 188, 204, 236, 150, 211, 115, 235, 214, 243, 122, // .......s...z
+ 207, 202, 151,  23, 243,  56,  51,  70,  13, 215,   1,  18, // .....83F....
+ 181, 239,  29,  48, 228, 105, 173,   6,  58, 136, 118,  88, // ...0.i..:.vX
+ 218,  10, 160, 238, 152, 221, 168,  11, 249, 184,  72,  66, // ..........HB
+  79, 157, 219,  48,  99, 212, 141, 252, 209,  86,  23,  78, // O..0c....V.N
+ 105, 144, 206, 205,  49,  31, 115,  42, 201, 170, 219, 168, // i...1.s*....
+ 190, 223, 193,  44, 186, 163,  85,  50,  76, 215,  43, 185, // ...,..U2L.+.
+  61,  29, 135, 198,  48, 150,  43, 206,  75, 169,  54,  67, // =...0.+.K.6C
+ 109,  16,  45,  23,  17,  31, 212,  29, 149, 246, 100, 154, // m.-.......d.
+  76,  69, 185,  15,  14, 193,  62,  34, 226,  12, 112, 171, // LE....>"..p.
+ 227, 142,  70, 160, 178, 195,  41, 121,  75, 176,  59, 171, // ..F...)yK.;.
+ 232,  69, 184,   4, 207, 135, 102, 212, 125, 249, 196, 140, // .E....f.}...
+ 186,   7,  52, 107,  38,  64, 101, 213, 231, 152,  78,  72, // ..4k&@e...NH
+   1, 133,   5, 189,  56,  87, 208,  74,  37,  62, 211, 107, // ....8W.J%>.k
+ 199,  59,   8, 235,  44,   9, 255, 169,  30, 112,  70, 204, // .;..,....pF.
+  84, 230, 107, 167,  31, 102, 218,  69, 130, 133, 118,  15, // T.k..f.E..v.
+  22,  89,  22,  71, 142, 153, 113, 170, 153, 129, 120, 171, // .Y.G..q...x.
+  50, 220, 216, 139,  22, 108, 159, 196, 230,  98, 181,  17, // 2....l...b..
+ 121, 215, 164, 188,  91, 142, 183,   9,  58, 122, 221, 122, // y...[...:z.z
+ 234, 167, 165,  40,  92, 200, 107,  68,   0, 156,  91, 101, // ...(..kD..[e
+ 209, 166, 148, 106, 180, 137,  49, 155, 221, 160, 132, 245, // ...j..1.....
+ 195, 200,  40, 241, 148, 171, 203,  57,  25,  31, 229, 145, // ..(....9....
+ 106, 107,  99, 232, 132,  71,  53, 130, 123, 197, 187,  80, // jkc..G5.{..P
+  19,  92,  77, 156,  17, 113,   4, 165, 114, 111, 143, 142, // ..M..q..ro..
+ 149, 237,   4, 203, 101, 144, 135,  94, 247,  82,  21, 142, // ....e..^.R..
+ 159, 237,   5,  78, 126, 198,  35,  95, 111, 161,  29, 212, // ...N~.#_o...
+ 180, 168, 105,  54, 201,  26, 156,  64, 254, 231,  32, 132, // ..i6...@.. .
+   0,  99,  41,  81, 190,  47, 147, 182, 164,  66, 104, 113, // .c)Q./...Bhq
+ 158, 160, 138,   0, 197, 184, 103, 184,  70, 132,  93, 191, // ......g.F.].
+ 239, 103,  87,  77,  96, 200, 159, 112, 248,  81, 245, 208, // .gWM`..p.Q..
+ 132, 174, 165,  71, 127, 199,  93, 145, 132, 128, 167, 169, // ...G..].....
+  64, 169,  10, 123, 150, 174,  11,  38,  35, 138,  15, 150, // @..{...&#...
+  96,  60, 239, 199,  87,  61, 250,   2, 147, 223, 138, 200, // `<..W=......
+ 160, 195, 103, 113, 242, 176, 187, 171,  29, 253, 184, 110, // ..gq.......n
+ 145, 237, 205, 186, 218,  22, 102, 151, 142, 248, 160,  65, // ......f....A
+ 236, 140, 143,  99, 101,  78, 113,   8,  17, 178, 204, 223, // ...ceNq.....
+ 205, 102, 106,  20,  64,  14, 220, 230, 228,  79, 104, 134, // .fj.@....Oh.
+ 224, 104,  62,  21, 103, 211,  74,  13,  68, 110,  73, 191, // .h>.g.J.DnI.
+ 158, 108, 158, 208,  38, 200,  87,  76, 252,  32,   8,  96, // .l..&.WL. .`
+ 193, 219,  80,  16, 204, 197, 137,  91, 104,  23, 145, 134, // ..P....[h...
+  75,  24, 173,  46, 144, 243,  53, 174, 157, 119, 220,   6, // K.....5..w..
+ 106, 147, 123, 157, 146, 125,  80, 211,  30,  28,  57, 152, // j.{..}P...9.
+  43,  72, 130,  64, 187, 203, 205, 101, 188, 255,  79,  60, // +H.@...e..O<
+ 110,  53, 127, 123,  91,  68, 138,  22, 153, 189, 177, 228, // n5.{[D......
+  96, 136, 115,  15, 138,  53,   6,  75, 166, 220,  92,  79, // `.s..5.K...O
+  51, 142, 206, 166, 184,  34,  91, 141,  52, 161,  43,  97, // 3...."[.4.+a
+ 176, 194, 219,  52, 227, 188, 182,  75,  57, 140, 209,  58, // ...4...K9..:
+  39,  24, 197, 222,  78,  90,  13, 160,   5, 178, 149, 208, // '...NZ......
+   4, 198, 219, 176,  67, 230, 246,  98,   6, 195, 202, 200, // ....C..b....
+ 177, 188,  66,  80, 160, 102, 101,  77,  98,  14,  19,  29, // ..BP.feMb...
+ 127,  75,  22,  78,  27, 183, 199, 139, 205, 253, 122,  94, // .K.N......z^
+  73,  28, 229, 188,  64, 221,  74,   9, 205, 198, 188, 114, // I...@.J....r
+  58,  26,  80, 106,  65,  87,  93, 226, 178, 216,  37, 217, // :.PjAW]...%.
+  71, 239, 150, 203, 141, 205, 214, 184, 141, 151, 134, 177, // G...........
+ 116,  94,  31, 198,  29, 104,  47, 140,  36,  10, 105, 155, // t^...h/.$.i.
+  57, 134,  97,  48, 188, 129, 153, 243,  12,  49, 251,  94, // 9.a0.....1.^
+ 139, 225, 104,  19, 163, 201, 196, 176,  93,  72, 100,  38, // ..h.....]Hd&
+ 148, 165, 178, 170, 168, 183, 251, 230, 124,   6, 224,   0, // ........|...
+ 226, 139, 161, 222, 200, 151, 194, 117, 246,  16, 150, 217, // .......u....
+ 131, 131,  34, 174,   1, 131, 187,   6,  47, 189, 102,  81, // .."...../.fQ
+ 134, 196, 182,  99,  35, 212,  62, 109,  43, 198,  21,  68, // ...c#.>m+..D
+ 232,   3, 242, 110, 224, 234, 224,  50, 204, 152,  59, 228, // ...n...2..;.
+  58, 235,  85, 172, 225, 237, 147,  99, 242, 116,  66, 104, // :.U....c.tBh
+ 245, 100, 109, 133,  11,  88, 177,  17, 178, 213, 204, 225, // .dm..X......
+  51, 154, 106,  82, 216, 178,  52, 223,  43, 179,  61, 189, // 3.jR..4.+.=.
+  66, 138, 130,  22,  16, 182, 170, 197,  55,  95, 148, 148, // B.......7_..
+ 123, 118, 207, 251,  87, 207, 238, 255, 251, 127, 174, 158, // {v..W.......
+  59,  78, 207, 254, 159, 230, 115, 167, 247, 108, 143, 152, // ;N....s..l..
+   2, 147, 241,  24,  25,   1,  72, 116, 154, 228, 227, 161, // ......Ht....
+   1,  83, 171,  47, 209, 107, 228, 154,  93,  96,  25, 108, // .S./.k..]`.l
+ 132, 243,  43,  70,  56, 182, 181, 249, 104, 103, 211,  41, // ..+F8...hg.)
+  37, 114, 144, 254,  72, 225,  69,  19,  95,  62, 189, 203, // %r..H.E._>..
+ 231, 188, 189,  64, 115, 209, 149, 220,  22, 163,  15,  15, // ...@s.......
+ 184,  70,  20, 147,  56, 212,   0,  22,  20, 216, 140, 204, // .F..8.......
+  21, 147,  29,  19, 184,   4, 132, 102, 132,  13,  57, 128, // .......f..9.
+ 134,  18, 247,  24,  65, 151, 238, 115, 225,  73, 228,  39, // ....A..s.I.'
+ 252, 244, 254, 150, 161, 217,  61, 148, 209,  42,  61, 137, // ......=..*=.
+  99,  18, 221, 133,  72, 166, 183, 130, 115, 104,  73, 212, // c...H...shI.
+ 243, 150, 253, 250, 243, 222,  85,  46, 235, 137, 145, 164, // ......U.....
+  82,  12,  43, 212, 177, 123, 192, 191, 213, 200,  65, 147, // R.+..{....A.
+  51, 180,  78,  76, 229, 255,  55, 202, 241, 201, 170,  91, // 3.NL..7....[
+ 104, 178,  47, 135,  60, 183, 208, 120, 143, 123,   6,  48, // h./.<..x.{.0
+  57, 142, 192, 206, 108, 119, 119,   7, 207, 239, 180,  78, // 9...lww....N
+  75, 233, 122,  40,  23,  76, 161, 113,  17, 146, 104, 222, // K.z(.L.q..h.
+ 168, 132, 231, 234, 250, 243, 173, 176, 156,  57,   2, 230, // .........9..
+ 202,   4, 100,   3,  76, 160,  52, 100, 199,  44, 236, 110, // ..d.L.4d.,.n
+ 166,  55,  16,   7, 185, 213, 108, 130, 202, 247, 217,  67, // .7....l....C
+ 211, 244, 174, 134,  74, 229, 122, 187, 194,  14,  49, 122, // ....J.z...1z
+  35,  94, 227,  73, 130,  29, 182, 240,   6,  43,  60, 189, // #^.I.....+<.
+  83,  18, 180, 141, 135,  36,  11, 115, 111,  74,  31,  16, // S....$.soJ..
+ 244, 106,   5, 148, 149,  22,  99, 188,  45, 107,  88,  40, // .j....c.-kX(
+ 191, 200, 130, 210,   3, 162, 146, 124, 128, 235,  18,  68, // .......|...D
+  92, 241,  76,  42, 211, 232, 215, 118, 177, 250, 136, 235, // ..L*...v....
+ 105,  88,  79,  74, 108, 255, 137, 153, 193, 119, 103, 240, // iXOJl....wg.
+  82, 151,  50, 141,  43,  93, 207, 192,  39, 171, 248, 183, // R.2.+]..'...
+ 114,  15,   3, 158, 193, 148,  91, 194, 209, 232, 249, 103, // r.....[....g
+  23,  80, 224,  37,  14,  50,  23, 145,  50, 186, 235,  33, // .P.%.2..2..!
+ 231,  54, 184,  81,   6, 210, 208, 253,  20, 198, 162, 186, // .6.Q........
+ 237, 142, 138, 244, 127, 115,  71, 197, 141, 109,  78, 241, // .....sG..mN.
+ 226, 226,  35, 159, 236, 141, 209,  97, 142, 242,  57,  43, // ..#....a..9+
+  59, 197, 101,   6, 212, 231, 166, 204, 202,   2,  65, 216, // ;.e.......A.
+ 173,  82,  47, 148,  41,  16,   2,  90, 231, 123, 196, 251, // .R/.)..Z.{..
+  35, 204, 105, 127,  53, 246, 114, 187,   3,  64,  29,  15, // #.i.5.r..@..
+  22, 251, 120, 106,  25, 101,  56,  32, 106,  80, 212,  69, // ..xj.e8 jP.E
+  62,  86,  82, 151, 137,  98,  73,  16,  47,  82, 207, 164, // >VR..bI./R..
+  20, 198, 110,  25,   9,  68,  21,  47, 234, 149,  49, 135, // ..n..D./..1.
+ 183,  28, 228,  13,  65, 126, 196, 220,  34, 225,  21, 123, // ....A~.."..{
+ 191, 233,  15,  81,  64, 150,  81, 175,  31,  93, 121, 253, // ...Q@.Q..]y.
+ 171, 146, 253,  95, 229, 187, 125,  23,  40,  47, 170,  65, // ..._..}.(/.A
+ 127, 113, 133, 118, 219, 109,  58, 119, 188, 187,  27, 151, // .q.v.m:w....
+ 150, 130,  46, 108, 117, 147,  47,  93, 139,  71,  62,  16, // ...lu./].G>.
+ 129,  39, 183,  81, 184, 233, 226,  85,  54, 234, 179, 188, // .'.Q...U6...
+ 124, 152,  13,  98,  90, 152, 199,  13,  69,  10,  26, 210, // |..bZ...E...
+ 224, 235,  93, 240, 232,  80, 161, 116, 252, 110, 179, 152, // ..]..P.t.n..
+ 254, 241, 212, 173, 136, 201, 234,  35, 180, 138, 138,  18, // .......#....
+ 168, 220,  80, 195, 187,  57,  58, 196,  93, 190,  50,  39, // ..P..9:.].2'
+   4,  23,  31, 112, 212,  80,  87,  47, 235, 245,  34,  89, // ...p.PW/.."Y
+ 168, 147,  69,  48,  17,  99,  58,  61, 214, 204,  83,  66, // ..E0.c:=..SB
+ 211, 118, 101, 163,  35, 118, 108,  60, 137, 130, 231, 108, // .ve.#vl<...l
+ 213,  87, 180,  50, 161, 241,  35, 108,  14, 237, 178, 193, // .W.2..#l....
+   6, 133,   4, 188, 117,   8,  53, 167,  85,  40,  35, 218, // ....u.5.U(#.
+   9, 169,  94,  74, 168,  15, 154,   9, 184, 109,  86, 161, // ..^J.....mV.
+ 139, 126, 189,  54, 250, 199, 199, 211,  86,  46, 214, 218, // .~.6....V...
+  78,  87, 125, 132,   6,  98,  29,  69, 216,  10, 164, 105, // NW}..b.E...i
+  64, 203, 135,  71,   4, 198, 106,  69, 157, 254, 136, 101, // @..G..jE...e
+  83,   5, 223,  32, 121, 206, 139, 125, 165, 139, 205, 231, // S.. y..}....
+  73, 100,  84,  31, 204, 134, 202,  87, 212,  93, 215,  54, // IdT....W.].6
+  50, 212, 155, 208,  80,  17, 245,  64, 186, 125,  12, 188, // 2...P..@.}..
+ 150, 184, 196,  59,  79, 188, 168,   9,   8, 111, 240, 149, // ...;O....o..
+ 174, 138,  50, 158, 251,  28, 139,  61,  16, 187, 114, 120, // ..2....=..rx
+  66,   6,  36,  27, 205, 180,  25, 225, 202,   7,  56, 200, // B.$.......8.
+ 158, 128, 234,  67, 167, 189,  27,   1,  68, 129,  40,  92, // ...C....D.(.
+ 162, 185,  47, 115,  60,  58, 106, 155,  53,   3, 180, 177, // ../s<:j.5...
+   6, 208, 147, 210, 169, 160, 136,  12, 151, 128, 201,  40, // ...........(
+ 107, 151,  35, 230,  20,  49, 199,  18, 155,  17, 153, 187, // k.#..1......
+ 177,  78, 220, 155,  99, 134,  77,  87, 206, 117,  83,  61, // .N..c.MW.uS=
+ 122, 146,  21,  48, 250, 148,  75, 159, 183, 230,   6,  20, // z..0..K.....
+ 172, 159,  28, 121,  57, 228, 203, 228,  70, 230, 183,  37, // ...y9...F..%
+ 131,   6,  10, 231,  84,  90,  41, 254, 171, 209, 186,  12, // ....TZ).....
+ 188, 211,   2, 221,  50, 218, 121,  17,  17,  23, 109,  94, // ....2.y...m^
+  54,   3, 234,  18,  40, 133,  59, 232, 155, 218, 164, 191, // 6...(.;.....
+ 230, 193,  91, 148, 177, 162, 150, 119, 127, 161,  22,  61, // ..[....w...=
+   1, 176, 200, 168, 114, 234,  42,  36,  32,  38, 146, 118, // ....r.*$ &.v
+  52,  94,  18, 180, 112,   4,  26, 174,  40,  80,   2, 243, // 4^..p...(P..
+  43,   4, 161, 225, 106, 165, 202, 127, 164, 109,  49,  88, // +...j....m1X
+  49, 217, 225, 210, 181, 185, 103,  38,  21, 238, 179, 158, // 1.....g&....
+ 119, 105, 148,  67,  28, 229,  16, 234, 250,   2, 211, 165, // wi.C........
+  24,  79,  62, 207, 129, 147,  47,  42, 133, 134,  52, 252, // .O>.../*..4.
+  33,  13,  63, 232, 164,  94, 134,  71,  31, 169, 157,  97, // !.?..^.G...a
+  51,  41,  39,  75,  40,  89, 162, 199,   8,  79,  12, 171, // 3)'K(Y...O..
+  21, 181, 185, 212, 214,  47, 164, 135, 125, 210, 219, 177, // ...../..}...
+ 144, 230, 153, 212,  52, 192, 247,   6,   1, 210, 202, 184, // ....4.......
+  79, 164, 250,   6, 192, 193,  74, 134, 220,  47, 149, 247, // O.....J../..
+  38, 239,  59, 244, 124,  65, 247, 149, 129, 180, 174, 243, // &.;.|A......
+ 110,  19, 151, 161, 118, 156, 209,  60,  22,  81, 215, 224, // n...v..<.Q..
+  23,  77, 241, 226,  32,  61,  93, 203,  67,  36, 130, 168, // .M.. =].C$..
+  78,  27,  38, 205, 120,  41, 143, 133, 250, 149, 246,  10, // N.&.x)......
+ 229,  20,   0,  96,  32, 152,  10, 148, 218, 244, 235,  95, // ...` ......_
+  64, 134, 140, 128, 143, 231, 143, 160, 207, 134,  22,  22, // @...........
+ 189, 166, 126, 149, 138, 124, 175, 201,  72, 164,  21,  57, // ..~..|..H..9
+  77, 192, 244,  69, 105,  31,  22,  89,  35,  30,  55, 226, // M..Ei..Y#.7.
+   4, 200, 123,  77, 241,  69,  97,  80, 242, 143,  90, 236, // ..{M.EaP..Z.
+ 143,  12,  80, 185,  43, 199, 187, 218, 179,  11,  45, 213, // ..P.+.....-.
+ 154,  14, 118, 161, 168, 237,  67,  62,  33, 243, 241,  88, // ..v...C>!..X
+  84, 198, 163,  58,  58, 113, 197,  55, 150, 157, 118, 169, // T..::q.7..v.
+ 172, 159, 139,   1, 162, 233, 137, 101,  51, 176,  75,  52, // .......e3.K4
+  91,  25, 112, 103, 205,  17, 170,  48, 134, 113, 129, 151, // [.pg...0.q..
+  87,  86,  51,  16, 159,  63, 149, 118, 173,  12,  18,  63, // WV3..?.v...?
+  26,  73, 245,  89,  84,  66, 167, 155, 187, 219,  80, 145, // .I.YTB....P.
+ 169, 164, 185, 220, 220, 123, 147,  49, 234, 231, 147,  77, // .....{.1...M
+  53, 121,  34, 220,  51, 179, 207,  68,  85, 135, 206, 140, // 5y".3..DU...
+  86, 152,  53,  21, 174,  36, 106, 202, 132, 106, 117, 165, // V.5..$j..ju.
+ 166,  47, 235, 247, 236, 173,  21,  83, 224, 173, 162, 121, // ./.....S...y
+ 123,  95, 194,  18, 162,   8, 247, 136,  92,  77, 149, 207, // {_.......M..
+ 167,  10, 193,   8,  33,   2, 105, 249, 125,  30, 141, 135, // ....!.i.}...
+  90, 214,  26,  40, 113,  79, 104, 181,  85, 233,  98, 144, // Z..(qOh.U.b.
+  14, 147,  96,  80, 221, 131, 100, 152, 219, 207,  54,  94, // ..`P..d...6^
+ 201, 166,  27, 198,  36,  25, 133,   5, 177,  49,  85, 232, // ....$....1U.
+  70, 158, 210,  44, 192,  77, 177, 213, 138,  40, 227, 135, // F..,.M...(..
+ 241, 150,  13, 135,  69, 185, 107,  89, 178, 152, 111, 160, // ....E.kY..o.
+ 249, 195,  60, 117, 220,  63, 177, 150, 237, 187, 203,  15, // ..<u.?......
+ 239, 255, 147, 138, 230,  74, 221,  84, 246,   2,  18, 121, // .....J.T...y
+  92, 235, 226, 102,  33,  69, 127, 113,  85, 250, 137, 235, // ...f!E.qU...
+  28,  75, 245,   8, 179, 213,  27, 239, 119, 204, 171,   1, // .K......w...
+ 153, 160, 178, 231, 102, 141, 252,   6,  12, 247,  64,  35, // ....f.....@#
+ 214, 237,  74, 208,   6,  27,  22,  78,  12, 242, 220, 178, // ..J....N....
+ 247, 229,  41,  46, 196,  85, 104, 193, 217, 195,  48,  84, // ..)..Uh...0T
+ 181, 145, 202, 160, 109, 106,  68,  23,  37,  86,  24, 107, // ....mjD.%V.k
+ 189,  14,  34,  10, 126, 140,  92,  99,   8, 149, 210, 200, // ..".~..c....
+  83,  96,  33,  46,  73,   3, 130,  57,   0, 225, 230, 251, // S`!.I..9....
+  13, 177,   7, 151, 151, 108, 245, 101, 205,  54, 166,  62, // .....l.e.6.>
+  57, 213, 105, 104,  14,  71, 179, 240, 230, 106, 218,  99, // 9.ih.G...j.c
+ 152, 169, 139,  20, 187, 211,   6,  81, 187, 115, 104, 162, // .......Q.sh.
+ 112,  83, 145, 201, 113,  96, 232,  63, 180, 230, 155, 146, // pS..q`.?....
+  61, 212, 148, 138, 140,  65, 147, 157, 165, 212,  12,  34, // =....A....."
+  56, 109, 225,  14, 158, 175, 122, 175,  92, 121,  24, 153, // 8m....z..y..
+   0,  66, 126,  51, 224, 132, 202, 239, 114,  58,  73,  54, // .B~3....r:I6
+ 166,  18,  48, 238,  65,   0, 180,  93, 211,  50, 109, 229, // ..0.A..].2m.
+ 162, 173, 241, 203, 101, 203,  76, 183, 192,  49, 243, 237, // ....e.L..1..
+ 182,  76, 104, 221, 163,  28, 226,  21,  50,  87,  73,   7, // .Lh.....2WI.
+ 141,  62, 204, 147, 229,  59, 183,  32,  58,  39, 222, 149, // .>...;. :'..
+ 118,   3,  26, 127, 121, 146, 150, 149, 165,  76,  67,  97, // v...y....LCa
+  76,  45, 157, 195, 238, 218,  56, 167, 235, 227,  28, 193, // L-....8.....
+  56,  95,  54, 105, 235, 109, 149,  96, 150, 120,  53, 209, // 8_6i.m.`.x5.
+ 184,  47, 255,   1, 141,  67, 140, 174, 208, 196,  74,  97, // ./...C....Ja
+  98, 189, 189, 166, 193, 136,  43, 157, 191, 216, 226,  47, // b.....+..../
+ 180,  97, 183, 218, 172, 247, 107,  24, 184,  99, 183,  13, // .a....k..c..
+ 118,  21,  48, 217,   0, 201,  31, 160, 254, 147, 179, 253, // v.0.........
+ 203, 211, 179,  29, 234, 205, 209, 253, 143, 167, 232,  26, // ............
+  93,  48, 200,  13,  18, 168, 120, 146,  56, 228,  88, 169, // ]0....x.8.X.
+ 203, 102, 196, 170, 152, 101, 111, 105, 249, 249,  67,   9, // .f...eoi..C.
+  46, 195,  77, 162,  71,  41,  47, 109, 230, 201,  80, 243, // ..M.G)/m..P.
+ 113, 142, 236, 213, 193, 185,  47, 235,  45, 165, 233, 241, // q...../.-...
+ 196, 110,  90,  99,  54,  45,  81,  13,   2,  99, 165,  57, // .nZc6-Q..c.9
+ 151, 107, 195, 244,  23, 193, 181,  54, 223,  17,  91,  78, // .k.....6..[N
+  80,  98, 210, 178, 140, 153, 206, 185, 156, 135,  19,  61, // Pb.........=
+ 159,  90, 140, 122, 239, 181,  88, 145,  35, 245, 135, 167, // .Z.z..X.#...
+ 176, 167, 157, 195, 195,  54, 245, 182, 141, 216, 131,  59, // .....6.....;
+ 219, 168, 174, 181,   2,  70, 114, 221,  80,  74, 194, 163, // .....Fr.PJ..
+ 155,  23, 101,   4, 175,  21, 183, 239,  91, 161, 126,  16, // ..e.....[.~.
+  10, 183, 141, 149,  52, 199, 223, 244, 141, 143, 116,  89, // ....4.....tY
+  45,  55, 151, 172,   7,  24, 128, 251,  64, 144,  79, 175, // -7......@.O.
+  42, 251, 170, 190,  35, 217, 250,   7, 144, 235, 126,  64, // *...#.....~@
+  33, 234,   7, 169,  88, 189,  43, 167, 249, 201, 126, 196, // !...X.+...~.
+  37,  58, 180, 236,  27, 241, 131, 118, 171, 100, 204, 226, // %:.....v.d..
+   0, 241,  33, 180,  31, 138, 232,  74, 170, 160,  16,   6, // ..!....J....
+ 120, 192,  69, 104, 246,  95, 223, 178, 142,  17, 210, 206, // x.Eh._......
+  39,  90, 188, 226, 123,  20,  30, 233,   7, 254, 158,  65, // 'Z..{......A
+ 143, 247, 181, 174, 194,  26,  61, 113, 135,  47, 149,  34, // ......=q./."
+ 185,  78, 125, 232,  78, 143,  16,   9,  96, 189, 150, 183, // .N}.N...`...
+ 195,  14, 203, 242, 200, 114, 190, 194, 157, 147, 229,  34, // .....r....."
+ 202,  11, 192, 250, 164, 169, 141, 119,   7, 242,  78,  43, // .......w..N+
+ 115, 132,  86, 149, 247, 204, 175, 240,  22,  62,  16, 113, // s.V......>.q
+ 182, 112, 167, 247,  82, 185,  34, 214, 153, 141, 184, 170, // .p..R.".....
+  27, 166, 232, 176, 239, 238, 110, 135,  68,  67, 116, 151, // ......n.DCt.
+ 206, 219, 218,  58, 132,  14,  48, 102, 180, 225,  35,  48, // ...:..0f..#0
+  64, 122, 182, 104, 142,  42,  19, 146, 131,  42, 130,  10, // @z.h.*...*..
+ 238,  50,  44, 104,  34,  32,  82,  63,   6, 216, 211, 150, // .2,h" R?....
+ 183,  98, 175,  25, 181,   3,  13,  73,  32, 182, 216, 184, // .b.....I ...
+ 213,  87, 139,  35, 249, 168, 126,  95, 150, 225, 120, 216, // .W.#..~_..x.
+  72,  49,  94, 219,  57, 215, 194, 181, 144, 215, 165,  33, // H1^.9......!
+ 224,  81, 132,  81,  47, 237,  60,  83, 223, 230, 199,  32, // .Q.Q/.<S... 
+ 202, 121,  93, 155, 247, 233, 170, 127, 150, 150,  72, 104, // .y].......Hh
+ 151, 235,  83,  59, 149,  20, 212,   2,  49,  11, 117,  17, // ..S;....1.u.
+  12,  97, 106, 248, 233,  13, 215, 188,  22,  70, 245,  56, // .aj......F.8
+ 142, 173,  90, 192, 120,  42, 131, 163, 190, 101,  72, 190, // ..Z.x*...eH.
+  95,  57, 136, 207,  63,  53,  71,  65,  58,  15, 253,   7, // _9..?5GA:...
+  58,   2, 107,  93, 167, 153, 181, 149,  42,   7,  42, 173, // :.k]....*.*.
+  74,  97, 143, 229,  11,  95,  31, 215,  46, 212,  22, 108, // Ja..._.....l
+  13, 211, 118,   5,  65, 247, 203,  62, 145,  70, 253, 180, // ..v.A..>.F..
+ 210,  23, 207, 110,  36,  96, 138, 175, 183,  46, 210,   4, // ...n$`......
+ 195, 150, 131, 140,  68, 151, 208,  62,  81, 158,  75, 244, // ....D..>Q.K.
+ 249,  55, 219, 130,  52, 150, 160, 233,  14, 224, 217, 118, // .7..4......v
+  19, 147, 185,  27, 140, 237, 107, 161,  57, 231, 156,  51, // ......k.9..3
+ 176, 136, 175,  87, 162, 188, 165, 163, 158,  50,  42,  14, // ...W.....2*.
+ 137,  98, 178,  88, 226, 249, 185, 110,  12, 169, 211,  12, // .b.X...n....
+ 247, 125,  33, 177, 254, 164,  55,  94, 227,  46, 173,   8, // .}!...7^....
+  52, 124, 190, 229,   8, 210,   1, 121,  11, 233,  71, 227, // 4|.....y..G.
+  29,  32,  55,  73, 253, 166, 205,  73, 209, 102,  32,  61, // . 7I...I.f =
+ 204, 197, 112, 183,  55, 157,  95, 161,  43, 111, 116, 131, // ..p.7._.+ot.
+ 187,  17,  17,   4, 146,  97, 114, 166, 130, 199, 150, 104, // .....ar....h
+  66,  32,  18, 173, 141,  59,  13,  59, 159, 193, 145, 132, // B ...;.;....
+  50, 145, 166,  40,  46, 154, 145, 242,  21,  74,  84,  57, // 2..(.....JT9
+ 184,  12, 137, 151, 180, 174, 160,  21,  33, 221,  49,  93, // ........!.1]
+ 180,  81, 113,  27, 233, 216, 128, 110, 167,  48, 247, 177, // .Qq....n.0..
+ 233,  68, 188, 133, 175, 232,  11, 117, 131,  12,   9, 152, // .D.....u....
+ 248, 137, 161, 208,  75, 253, 120, 108,  61, 103, 164,   4, // ....K.xl=g..
+  63, 234,  63,  15,  78,  48,  46,  84, 223, 176, 249, 133, // ?.?.N0.T....
+ 216, 186,  99,  70,  76, 239,  44, 210, 214,  78, 218,  91, // ..cFL.,..N.[
+  84, 152,   8, 151,  75, 138, 198,  81, 137,  72,  33, 198, // T...K..Q.H!.
+ 120, 163, 231, 241, 122,  70, 134, 187, 103, 160,  84, 153, // x...zF..g.T.
+ 229,  72,  16, 243,  77,  74,  84, 100,  66, 183,  73, 226, // .H..MJTdB.I.
+ 166,   8, 248,  41,  74,  78, 122, 118, 178, 229,  60,   5, // ...)JNzv..<.
+ 227,   6, 223, 196,  84, 209, 131, 227, 187,  72,  37, 151, // ....T....H%.
+  63, 124, 171,  15, 250,  33, 249, 124,  11,  48, 214, 148, // ?|...!.|.0..
+ 233,  49, 246,  12, 208,  18, 195,  62, 176, 255,  43,  49, // .1.....>..+1
+ 242, 170,  35, 154, 211,  88, 109, 119,  73,  42, 148,  31, // ..#..XmwI*..
+ 239,   2, 211,  90,  45,  58,  65, 235, 141, 123, 116,  23, // ...Z-:A..{t.
+  84, 232, 133, 189, 141, 155, 154, 194, 226,  26, 173, 242, // T...........
+ 149,  78,  72,  69, 240, 114,  65,  92,  11,  65,  75,  36, // .NHE.rA..AK$
+ 244,  91,  38, 142, 151,  52,  99,  59,  32,  67, 119,  25, // .[&..4c; Cw.
+ 121, 245,  38, 188, 255,  96, 210, 241,  96,  87, 198,  84, // y.&..`..`W.T
+ 109,  29,  83, 148, 137, 141,  57,  36, 207, 139, 195,  75, // m.S...9$...K
+ 204, 120,  68, 154,  19, 157, 114,  47, 138,  29, 174,  21, // .xD...r/....
+ 139,  24,  77,  91,  94, 217, 153,  23, 135, 185, 215,  39, // ..M[^......'
+ 225, 180, 138, 224, 118, 244, 162, 179,  92, 158, 152, 179, // ....v.......
+   9, 153, 158,  55, 237,  10, 214,  87,  14,  93, 253, 201, // ...7...W.]..
+  57,  62, 211, 137, 176,  96, 106,  48, 196,  97, 105, 165, // 9>...`j0.ai.
+  39, 108,  22, 116,  72,  49,  86, 111, 168, 105, 215, 215, // 'l.tH1Vo.i..
+ 227, 109,  23, 238, 153, 181, 235, 157,  92, 202,  92,  24, // .m..........
+ 144, 181, 205, 225, 167, 103,  99,  90,  74, 180, 113, 161, // .....gcZJ.q.
+ 103, 185, 220,  47, 130, 129, 199, 187,  37,  95, 110, 238, // g../....%_n.
+  41, 206, 219,  71, 235, 233,  59,  91, 210, 231, 109, 215, // )..G..;[..m.
+  23, 145,  33,  38,  92,  95, 167, 241,  34,  25, 226, 125, // ..!&._.."..}
+ 101, 104, 138,  81, 140, 159, 197,  46,  11, 188, 169, 110, // eh.Q.......n
+ 123, 254, 210, 193,  49, 106, 130,  46, 116, 139, 237,  88, // {...1j..t..X
+ 148, 246, 229, 252, 241, 158, 203, 229, 114, 107, 176, 222, // ........rk..
+ 154, 225,  75,  59,  48, 111,  20, 128,  44, 241,  39,  78, // ..K;0o..,.'N
+ 167,  75, 188, 176, 150, 202,  71,  90, 105,  10, 178,   7, // .K....GZi...
+ 239,  31,  47, 112, 105, 170,  54, 146, 214, 197, 126, 205, // ../pi.6...~.
+  61, 172, 157, 187,  46, 254, 184, 251, 181, 246,  73, 205, // =.........I.
+  61, 174, 117, 106, 109,  10, 104,  31, 195, 215, 170, 237, // =.ujm.h.....
+ 157, 254,  67,  88, 254, 104, 212, 240, 199, 153,  74, 172, // ..CX.h....J.
+ 114, 118, 202,  86,  59, 167, 196, 110, 237, 162, 118,  80, // rv.V;..n..vP
+ 115, 209, 219,  62, 194,  95, 244, 130, 139, 188, 244, 235, // s..>._......
+ 158, 212, 218,  29,   8,  46, 249,  59, 174, 149,  23,  63, // .......;...?
+ 160, 235,  92, 176, 252,  73,  45,  75, 252,  40, 197, 107, // .....I-K.(.k
+ 232, 164, 149, 130, 112, 162, 106, 118, 195,  21,  53, 215, // ....p.jv..5.
+ 177, 138, 152,  70, 156, 224, 253, 198, 210,  26,  42,  60, // ...F......*<
+ 111, 102, 157, 254, 183, 155, 245,  98,  98,  90,  22,  68, // of.....bbZ.D
+  89, 140, 237,  74,  64, 244, 168, 221,  75, 203, 181, 106, // Y..J@...K..j
+  15, 210, 218, 183, 106, 116, 175, 158, 236, 180, 106, 124, // ....jt....j|
+ 169, 158, 108, 239,   3, 180, 106, 213, 134,  28, 235, 134, // ..l...j.....
+ 236,  67,  21, 199,   4, 110, 116,  27, 192,  66, 223, 146, // .C...nt..B..
+ 172,  12,  82,  72, 208, 169, 157,  67, 145,  48,  22, 109, // ..RH...C.0.m
+ 252, 124, 173,  97,  24, 118,   0, 127,  78, 200,   7, 237, // .|.a.v..N...
+  69,  95, 251,  64,  23, 146, 128,  12, 112, 171, 214,   6, // E_.@....p...
+ 182,  85,  59, 223, 199,  49, 204, 255,  65, 200,  69, 187, // .U;..1..A.E.
+ 182,  95,  59, 111, 163,  19, 170, 224, 239,  62,  85,   1, // ._;o.....>U.
+  97,   7,  16,   3, 129,   7, 102, 200,  65,  27, 187, 107, // a.....f.A..k
+  12, 226,  44, 139, 103, 149,  81, 135, 138, 219,  84,  63, // ..,.g.Q...T?
+ 182, 146,  60,  23, 236, 161,  54,  85, 114, 135, 106, 156, // ..<...6Ur.j.
+  85, 242,  66, 149, 135, 212, 128,  67, 172,  29, 114,  95, // U.B....C..r_
+ 144,  27,  59,  92, 224,  26, 101,  77, 232, 154, 194, 114, // ..;...eM...r
+  94, 168, 200, 164, 196,  74,  49,  51, 123, 168, 188,  74, // ^....J13{..J
+ 230,  44, 158, 175,  53, 217, 213, 205, 195, 108,   8,   8, // .,..5....l..
+ 114, 115,  39,  56, 231, 192,  31, 222, 220, 249, 201,  40, // rs'8.......(
+  93,  27, 141, 182, 105,  46, 117,  49, 119, 240,  63,  19, // ]...i.u1w.?.
+ 243, 213, 148,  49,  41, 231,  62, 168, 157, 212, 206,  15, // ...1).>.....
+ 104,  36, 143, 244, 151, 199, 179,   5, 191, 103, 244, 197, // h$.......g..
+  33, 160,  18, 177,  71, 244,  57, 161, 143,  41,  47, 130, // !...G.9..)/.
+ 242, 134,  65, 130,  10, 241,  16,  49,  15, 186,  57, 124, // ..A....1..9|
+ 224, 223,   4, 126, 246, 173,  42, 194,  29,  18, 116, 161, // ...~..*...t.
+ 209,  26,  28,   3,  21, 134, 229,  22,   1,  18,  28, 213, // ............
+ 206, 224, 139, 245,  80, 203,   9, 153,   8,  61,  33,  12, // ....P....=!.
+ 191,  71, 248,  69, 240, 130, 227,  64, 127, 177,  19,   7, // .G.E...@....
+ 181,  51, 250,  30,  99,  36, 149,   3,  61,   1, 124, 193, // .3..c$..=.|.
+   8, 254, 105,  19, 210,  34, 200,  78, 168,  48, 254,  30, // ..i..".N.0..
+ 232, 175, 198, 108, 172,  82, 183,  45, 142, 111, 214,  96, // ...l.R.-.o.`
+  13, 109, 163,  47, 228, 172, 181,  25,  81,   0, 111, 207, // .m./....Q.o.
+ 104, 130,  26, 130,  84, 124,  33,  16, 254, 225,  40,  28, // h...T|!...(.
+  19,  90,  28,  66,  67,  32,  93, 141, 138, 160,  15, 207, // .Z.BC ].....
+ 157,  35,  30, 249, 227, 162, 218, 153, 159, 220, 172,  97, // .#.........a
+  52, 131,  13, 177,  67,  35,  24, 150,   7,  78,  61, 178, // 4...C#...N=.
+  72, 132, 162, 145, 159,  84, 240, 145,  91, 152,  35,   3, // H....T..[.#.
+  53, 225,  43,  97, 244,   1, 227,  41, 244, 250,   8,  59, // 5.+a...)...;
+ 141,  61, 186, 112,  59, 212, 255,  14, 185,  79, 200, 125, // .=.p;....O.}
+ 130, 110, 128,  13, 184, 225, 123,  98, 170, 194, 215, 128, // .n....{b....
+ 170,  21,  33,  17,  57, 169, 209, 184, 237,  99, 211, 246, // ..!.9....c..
+ 177, 231, 199,  88, 227, 177, 153, 133, 248, 249, 202, 232, // ...X........
+ 240,  52, 194, 152, 185,  61, 244, 129,  47, 109, 155, 219, // .4...=../m..
+  76,  21,   8,  94,  88, 166, 155,   3,  64, 103, 217, 152, // L..^X...@g..
+ 208, 109,   2, 192, 249, 161, 153, 148, 107, 233,  55, 103, // .m......k.7g
+  49,  19,  29, 132, 182, 166,   1, 107,  57, 214, 167,  46, // 1......k9...
+ 118, 143, 103,  42, 117, 178,  93, 140,  72, 149, 112,  30, // v.g*u.].H.p.
+ 106, 226, 112,  72, 116,  30,  33, 139, 196,  18, 241,  23, // j.pHt.!.....
+  33, 221, 194, 159,   3,  44, 128,  41,  84,   5,  72,  72, // !....,.)T.HH
+  71,  17,  72, 237,  35,   2, 210, 102,   2, 183, 189, 153, // G.H.#..f....
+   0,  90, 128, 247, 168, 172, 163,  82,  27, 135, 231, 220, // .Z.....R....
+  37, 196,  69, 226, 106, 250,  54,  85, 183,  73,  28,  61, // %.E.j.6U.I.=
+   5, 114, 238,  32,  78, 188, 154, 219,  94, 203, 178,   9, // .r. N...^...
+ 114, 134, 224, 177,  70, 211, 245, 244,  91,  64, 206,  99, // r...F...[@.c
+  68, 108, 135, 102, 227,  90, 142, 109,  32, 103,  36,  56, // Dl.f.Z.m g$8
+  70, 120, 105,   2, 201, 240, 248,  83, 122,  52,  14, 194, // Fxi....Sz4..
+  16, 152,  50, 239, 138,  57, 139, 195,  56, 209, 217, 195, // ..2..9..8...
+  96,  62, 136, 129, 192, 174, 181, 172,  77, 208, 210,  19, // `>......M...
+ 174,  77,  36, 149, 208,   8,  38, 137, 139, 204, 234,  16, // .M$...&.....
+  62, 134, 213, 240, 119,  31, 185, 250, 190,  41,  53,  30, // >...w....)5.
+ 222, 252, 103,  52, 146, 121,  50, 211, 109, 172, 175, 149, // ..g4.y2.m...
+ 151, 148, 170, 234,  72,  34, 208, 136, 200,  95, 116,  52, // ....H"..._t4
+ 210,  26, 208, 225,  46, 180,  53, 164,   6,  82, 223,  65, // ......5..R.A
+ 170, 232,  18,  45, 188,  32,  74, 126, 142,  52, 240, 136, // ...-. J~.4..
+ 230,   5,  18, 192,  99,  34,  69, 208, 252,  35,  83,  74, // ....c"E..#SJ
+  24, 250, 243, 106, 173,  71, 205, 206, 193,  17, 164,  57, // ...j.G.....9
+ 105, 186, 251, 237, 227, 195,  31, 220, 195, 183,   7, 205, // i...........
+  67, 118, 182, 154, 199,  16, 247, 182, 213,  60, 248,  65, // Cv.......<.A
+  71, 191, 213, 201, 191,   2, 176, 200,  85, 107, 253, 112, // G.......Uk.p
+ 160, 163, 220,  67,  72, 119,  72,  89, 246, 223, 158, 232, // ...CHwHY....
+  50,  90, 111, 117, 194, 175, 214, 134, 144, 101, 183,  69, // 2Zou.....e.E
+  27,  36,  44,  80, 139, 226,  27, 213,  96, 217, 198, 106, // .$,P....`..j
+ 153, 128, 245,  49, 221,  50, 206, 220,  39, 208,  44, 214, // ...1.2..'.,.
+   0, 121, 196, 178, 197,  17, 115,  76, 250,  28,  32,  92, // .y....sL.. .
+  14,   8, 176, 154,  99, 241, 132,  37, 118, 227,  18,  97, // ....c..%v..a
+ 255,  90, 211,  28, 159,  57,  54, 120,  41, 197, 185, 142, // .Z...96x)...
+  53,  32, 156,  63, 108, 167, 201,  60,  75, 218, 154,  38, // 5 .?l..<K..&
+  51,  82, 157, 107,  38, 135,  17, 252, 205, 203,  73, 212, // 3R.k&.....I.
+  40, 200, 134, 107, 232, 217, 198,   1, 163, 193, 235, 180, // (..k........
+ 244, 151, 152, 202,   1, 138, 201, 231,  36,  44, 131, 187, // ........$,..
+ 237, 146,   8, 221, 118, 215,  16, 173,  77,  82,  91,  27, // ....v...MR[.
+ 187, 131, 115, 156, 191,  46, 214, 248, 212,  28,  25, 169, // ..s.........
+ 244,   6,  38, 227,  26, 102, 181,  89,  88, 104, 147, 180, // ..&..f.YXh..
+ 192, 147,  88, 179, 104, 254, 158, 232, 239,  57,  39,  34, // ..X.h....9'"
+  14, 196, 188, 147, 185,  99, 135,  57,  19,   6, 234, 222, // .....c.9....
+ 154, 107, 156, 203,  21,  81,  41, 103, 148, 220, 101, 249, // .k...Q)g..e.
+ 192, 237,  48, 201, 237,  48, 221,  69, 194, 141,   0, 233, // ..0..0.E....
+ 180,  53, 231,  37, 193, 207, 197,  25, 105, 132,  65, 242, // .5.%....i.A.
+  92, 240, 212,  42, 203,  86,   8, 219,  53,   2, 115,  68, // ...*.V..5.sD
+  44,  15,  17, 129,   5,  31, 238,  28,  11,  21, 174,  25, // ,...........
+ 117, 151, 129,  77, 244, 159,  99, 117, 121, 104,   4,  92, // u..M..cuyh..
+ 167, 161,  60, 169, 177,  76, 247, 152,  96, 208, 102,  46, // ..<..L..`.f.
+ 108, 164, 100,  11, 100, 161,  96, 158,   6, 105,  99,  10, // l.d.d.`..ic.
+ 170, 195, 239, 120,  35, 126, 104,  85,  73, 199, 145,  38, // ...x#~hUI..&
+ 243, 251, 134, 204, 111,  31, 168, 156,  55, 108, 139,  46, // ....o...7l..
+ 147, 160, 162, 160, 191, 144,  41, 231,  66, 251, 101,  38, // ......).B.e&
+  83, 180, 250,  22,  77, 157, 195, 141,  54, 155, 186, 142, // S...M...6...
+ 254,  98, 155, 183, 144, 200, 255,  44,  19, 182, 243, 143, // .b.....,....
+  50, 193, 240,  68, 213,  89, 180,  79, 226, 213, 126, 206, // 2..D.Y.O..~.
+ 240,  89,   4, 200,  49,  57, 199, 146, 251, 185,  95, 205, // .Y..19...._.
+   9, 148,  14, 210, 228, 196, 174, 221, 108, 131, 227, 228, // ........l...
+   7, 119, 191, 217,   6, 178, 102, 136,  31, 210,  72,  72, // .w....f...HH
+   9,  52, 112, 191, 121,   4, 225,  53,  77, 244, 126, 112, // .4p.y..5M.~p
+ 155,  71, 152, 190,  76, 252, 202,  52,  81,  39,   7, 156, // .G..L..4Q'..
+ 250, 127,  67,  10, 249, 225, 187,  10,  36,  72, 120,  62, // ..C.....$Hx>
+ 215, 162,   1, 127, 180, 250, 180, 111,  36, 128, 139,  99, // .......o$..c
+  35,  14, 236, 179,  84, 110, 128,   3,  74, 110, 228,  87, // #...Tn..Jn.W
+ 164, 121, 100,  19, 200, 117,  78, 120,   2, 181, 205,  23, // .yd..uNx....
+ 201,  18, 252, 237,  83,  77, 164,   3,  66, 202,  11, 114, // ....SM..B..r
+  35, 251, 113, 181,  36, 172,  30, 214, 185, 185, 198, 127, // #.q.$.......
+ 151,  71, 216, 253,  51, 188,  57, 220,  36, 120,  40, 131, // .G..3.9.$x(.
+ 179, 236, 109, 180, 139, 131, 154,  17, 169, 203,  95, 156, // ..m......._.
+ 251, 204, 129,  49,  45, 203, 154, 250, 163, 231, 248,  88, // ...1-......X
+ 169,  81, 181, 121,   6, 255, 254,  20, 105, 203,  90,  48, // .Q.y....i.Z0
+ 104,  39, 104, 222,  32, 126, 131, 102, 141,  35,   4, 199, // h'h. ~.f.#..
+   5, 138,  20, 103,  46,  54,  18,  91,  65, 109,  49, 250, // ...g.6.[Am1.
+   1,  20, 170,  54, 116, 131, 170,   0, 226,  18, 181,  97, // ...6t......a
+  25, 229, 152,   4, 152,  99, 173, 205, 186, 173, 188,  16, // .....c......
+  24, 174,  42,  43,  65,  61, 169,  70, 208, 208,  10,  31, // ..*+A=.F....
+ 126, 160, 192,   3, 254, 160,  54, 128, 229, 144, 154, 152, // ~.....6.....
+ 179,  12,  42, 255, 192, 128,  36, 172, 234, 151,  69, 211, // ..*...$...E.
+ 114, 197, 143,  68,  26, 151, 181, 220,  99,  28,   3, 221, // r..D....c...
+  43, 107,  28, 135,  35, 149,  52, 226, 185, 138, 172, 170, // +k..#.4.....
+ 161,   0, 181,  39,  54,  16, 176,  36, 234, 146,  42, 232, // ...'6..$..*.
+ 182,  72, 248,  59,  38, 130, 204,  40,  73,   8, 196, 255, // .H.;&..(I...
+  27,  88,  81, 161, 107, 226,  47, 139, 225,  12, 172,  35, // .XQ.k./....#
+  44, 141, 100,  34, 164,   1, 100, 105, 208, 226, 110,  33, // ,.d"..di..n!
+ 232, 194, 180, 123,  66, 239,  46, 235, 219,  90,  94,  99, // ...{B....Z^c
+ 166, 189, 166, 118,  91, 227,  69,  24, 166, 192, 194,  85, // ...v[.E....U
+ 212,  80, 247,  65, 182, 214,  65, 151,  69,  76, 254, 183, // .P.A..A.EL..
+  79,  74, 235,  62, 155,  58,  72,  74, 135, 239, 197, 126, // OJ.>.:HJ...~
+  46, 181, 155,  80, 154, 171,  45,  74, 166, 255, 153,  62, // ...P..-J...>
+ 231, 117, 109, 214, 130, 160, 169, 212,  97, 166,  95,  94, // .um.....a._^
+ 133, 241, 150, 107,  96, 251,  76,  81, 195,  36,  24, 103, // ...k`.LQ.$.g
+ 107, 101, 239,  99,  78, 214, 116, 249,  75,  19, 154,  36, // ke.cN.t.K..$
+  76, 116,  34, 124, 232, 107, 204,  69,  32,  49, 212, 232, // Lt"|.k.E 1..
+   7, 130,  73,  71,  36, 238, 207,  33, 197, 231, 184, 198, // ..IG$..!....
+ 114,  16, 203,   7,  69,   4, 151,  80, 102, 224, 147,  32, // r...E..Pf.. 
+ 155,  46,   6, 166,  81,  27, 100, 113, 219,  68,  36, 182, // ....Q.dq.D$.
+ 220, 134,  26, 206, 168,  13,  45, 110,  10, 133,  28, 116, // ......-n...t
+  16, 205,  15,  73, 170,  56,  36,  49,  70, 127,  93, 250, // ...I.8$1F.].
+ 178, 170, 114, 112,  64,  51, 244, 128,  80,   8, 115, 128, // ..rp@3..P.s.
+ 254, 214,  42, 190, 251,  39,  40,  30, 236,  51, 110,  33, // ..*..'(..3n!
+ 222, 239, 147, 201,  11, 191,  29, 250,  30, 212, 246, 143, // ............
+ 205, 247, 184, 118,  64, 149,  29,  80,   5,   7, 212, 107, // ...v@..P...k
+   8,  71,  93, 226,  80, 127, 145,  94, 146, 169,  98, 159, // .G].P..^..b.
+ 208, 164,  67,  50,  16, 207, 196,  54, 149, 214, 110, 155, // ..C2...6..n.
+  47, 205,  74, 151, 196,  84, 254, 182,  91,  38,  25, 153, // /.J..T..[&..
+  16,  33, 176,  67, 223, 253,  22, 134, 232,  38, 157,  20, // .!.C.....&..
+  95, 108,  70,  11, 221,  80,  26, 127, 117, 195, 168, 198, // _lF..P..u...
+   3, 170, 253, 128,  90,   2,  77, 130, 127, 157,  99, 108, // ....Z.M...cl
+  97, 231,   4, 187, 187,  79,  25, 225, 123, 128, 248, 214, // a....O..{...
+  66, 104, 157, 225, 143, 139,  97, 135, 148, 233, 144, 242, // Bh....a.....
+ 193, 247, 144,   0,   7, 223,  14, 185,  93, 234, 186,  30, // ........]...
+   3,  61, 117,  38,  73, 124, 247, 151, 237, 115,  52,  94, // .=u&I|...s4^
+ 185, 209, 141, 109, 112,  92, 204,  84, 173, 105, 227, 196, // ...mp..T.i..
+ 219, 207,  24, 136,  53,  36, 241, 108,  95,  66, 168,  28, // ....5$.l_B..
+ 178,  85, 148, 169, 175, 203, 134, 139, 125, 236, 242, 161, // .U......}...
+ 129, 250, 177, 225,  16, 173,  45,  86, 159,  35, 182, 127, // ......-V.#..
+  20, 179, 127,  26, 207, 212, 186,  78, 201, 147, 185,  96, // .......N...`
+ 178, 174, 102,  47, 249, 228,  43,  43,   8, 237,  28,  26, // ..f/..++....
+ 193, 236, 127, 203, 177,  15, 115,   5, 190, 176, 237,   6, // ......s.....
+ 209,  32, 190, 175,  18,  71, 210, 131,  42, 250,   4,  51, // . ...G..*..3
+ 159, 163, 154,  54,  87, 113,  18, 183, 197, 140, 139, 126, // ...6Wq.....~
+  92, 215,   0, 130,  37, 236,  86,   9,  21, 141, 157, 201, // ....%.V.....
+  84,  56, 142, 255,  99,  93, 216, 213, 253, 232, 212,  74, // T8..c].....J
+ 154, 177, 158, 246,  33, 154,  18, 162,  32, 170, 112,  29, // ....!... .p.
+  68, 254, 142, 214, 217, 200, 137,  12, 227,  68, 235, 232, // D........D..
+ 228, 252, 106, 114,  71,  55, 107,  25, 143, 161,  83, 248, // ..jrG7k...S.
+  37, 145,  16, 113, 157,  77,  88, 218,  84, 200,  18, 226, // %..q.MX.T...
+ 137, 233, 174,  75,  37,  31, 213,  80, 206, 129, 184,  51, // ...K%..P...3
+ 254,  57, 102, 118, 137, 134,  29,  38,  94, 237,  22, 219, // .9fv...&^...
+ 213, 177,  37, 140, 184,  46,  79,  80, 221,  10, 115, 116, // ..%...OP..st
+ 127,  59,  96,  92,   2, 204,  58,  92, 120, 202, 159,  33, // .;`...:.x..!
+ 184, 219, 235, 162,  11, 107, 113, 108,   4,  61, 168, 161, // .....kql.=..
+  65, 212, 109,  25, 241, 133,  44,  96, 208, 180,  99,  77, // A.m...,`..cM
+  52, 190, 230, 109, 184, 169,  26, 134,  93,  50, 170, 118, // 4..m....]2.v
+  72, 169, 225,  47, 166,  38,  21, 247,   0,  13, 158, 248, // H../.&......
+  63, 202, 190, 216, 211,  14, 127,  88, 180,  99,  67, 170, // ?......X.cC.
+  54, 207, 180,  59,  79,  75, 233, 251, 133,  12, 247,  15, // 6..;OK......
+  49, 243, 131, 240,  15, 216, 180,  86,  14, 181, 226, 152, // 1......V....
+ 243,  92, 141, 199,  51,  21,  45, 170, 115, 155,  37,   6, // ....3.-.s.%.
+ 146, 163, 200, 252,  78, 240, 191, 160, 225,  33, 118, 182, // ....N....!v.
+ 111,  50, 166, 169,  63,  89,  51, 170, 236,  83, 189, 204, // o2..?Y3..S..
+ 205, 218, 154, 168,  16,   6,  28, 107, 232, 229,  58, 249, // .......k..:.
+  12, 183, 140, 204, 167, 113, 164,  54,  68, 131,  51,  38, // .....q.6D.3&
+  38, 196, 212, 184, 205,  44, 123, 106,   4, 104, 151, 102, // &....,{j.h.f
+ 140, 249, 199,  94, 106,  46, 155, 138,  11, 123, 211,  33, // ...^j....{.!
+ 203, 114, 185, 113, 220, 140, 159, 153, 208, 122,  90,  31, // .r.q.....zZ.
+ 233,  47,  90, 114,  73, 221,  62, 193, 159,  11,  78,  70, // ./ZrI.>...NF
+ 195, 113,  98,  26,  30,  45, 210, 181, 137,  95,  93, 227, // .qb..-..._].
+ 152, 197, 131,  53,  49, 147,  40,  33, 153,  17,  88, 217, // ...51.(!..X.
+  39, 161, 254,   4, 161, 117,  98, 108, 224,  39, 102, 217, // '....ubl.'f.
+ 198, 101,  99,  20, 253, 156, 177,   1,  54, 151, 253,  73, // .ec.....6..I
+ 154,   3,  70,  67, 182, 240, 142,   6, 169, 203,  29,  68, // ..FC.......D
+ 148,  58,  39, 116, 186,  32,  41,  19, 221, 198,  22,  53, // .:'t. )....5
+ 139, 227, 104,  77, 183, 104, 159,  33, 206,  65,  33, 104, // ..hM.h.!.A!h
+ 195,  70, 166, 166, 177, 144, 109,  90,  39,  68, 161,  79, // .F....mZ'D.O
+  10,  11, 131,  22,  94,  15, 106,  71, 154,  40, 180, 205, // ....^.jG.(..
+  56, 198, 213, 181, 169,  14, 143,   2,   9,  27, 197, 170, // 8...........
+   0, 129, 178, 173, 141, 245,  52, 171, 143,  40,   0, 181, // ......4..(..
+ 120, 142, 110, 107, 203, 218,   1,  11, 144,  39,   5, 151, // x.nk.....'..
+ 184,  56, 162, 160,  14, 107,  30, 198, 162,  55,  91, 164, // .8...k...7[.
+ 193, 176, 210,  39, 151,  75, 115, 121, 193, 131,  88,  54, // ...'.Ksy..X6
+ 209,  61, 151,  41, 218, 190,  38, 124, 181,  23, 172, 116, // .=.)..&|...t
+  87, 141,   2, 168,  20, 221,  19, 169,  72,  30, 180,  37, // W.......H..%
+ 189, 154,  16, 235, 165, 148, 157, 205, 148, 216, 154,  76, // ...........L
+ 173,  89, 113,  93,  70,  67, 162,  35,  76, 210, 201, 170, // .Yq]FC.#L...
+ 171,  85, 228, 182, 158,  25,  20, 131,  35, 205,  63, 109, // .U......#.?m
+ 162, 178, 156,  91,   3, 152, 175, 254,  78, 215, 248, 214, // ...[....N...
+  33, 202, 140, 135,  44, 189, 147, 219, 101,  79, 155,  60, // !...,...eO.<
+ 196, 218, 247, 107, 220, 237,  19,  66, 254,  14, 213, 126, // ...k...B...~
+ 194, 171,  58,  29,  22, 125,  53,  70, 207, 253, 185,  74, // ..:..}5F...J
+ 208, 130, 187, 105, 244, 100, 155,  20, 225, 236, 177, 209, // ...i.d......
+  91, 152,  72, 158, 232,  57, 206,  60, 148, 104,  67, 155, // [.H..9.<.hC.
+ 102,  94, 155, 199, 183, 205, 218,  13, 235, 125, 216,  20, // f^.......}..
+ 119, 159, 166,  50,  13, 138, 166, 246,  46, 173,  57, 241, // w..2......9.
+  64, 187, 108,  28, 228, 185, 121, 204, 118, 253, 227,  90, // @.l...y.v..Z
+ 222, 194, 197, 154, 213, 177,  67,  86,   7, 106,  16, 162, // ......CV.j..
+  59,  78,  36,  35, 206,   2,  81, 201, 226, 181, 193, 160, // ;N$#..Q.....
+  57, 108, 200,  56, 125,  10, 115, 229, 126,  78, 116, 219, // 9l.8}.s.~Nt.
+  70, 222, 110, 183, 243,  37,  64,  86,  73, 246,  55,  73, // F.n..%@VI.7I
+ 177, 198, 135,  19, 162, 196,  29,  93, 117, 232,  63, 172, // .......]u.?.
+ 219, 247,   8, 136, 185,  69, 228, 171,  73, 184, 216, 162, // .....E..I...
+  18,  49, 104,  55,   9,  10, 202,  45, 160, 141,   5, 213, // .1h7...-....
+  94, 209,  76, 197, 153, 210,  38,  21,   0,  63,  72, 191, // ^.L...&..?H.
+ 104,  61, 201, 172,  29,  33,  18, 106, 233, 110, 191, 160, // h=...!.j.n..
+ 147, 199,  37, 210, 200,  43, 172, 199,  90, 181, 208, 139, // ..%..+..Z...
+  49, 104,  99, 160, 116, 103,  38,  53,  53,  94, 235,  63, // 1hc.tg&55^.?
+ 110, 155,  23, 171, 180,  70,  51,  79, 130, 168,  34,  86, // n....F3O.."V
+ 241, 170,  34,  77, 110, 162, 116,  45, 254, 180,  15, 244, // .."Mn.t-....
+ 191,  11,  90, 194,  57,  63,  42, 228,  36,  28, 121, 182, // ..Z.9?*.$.y.
+ 109, 210, 170,  42, 101,  60, 162, 191,  19, 178,  19, 163, // m..*e<......
+  24, 131, 105,  52, 235,  73, 212,  56,  81, 233, 244, 143, // ..i4.I.8Q...
+ 165,  33, 194, 134, 242, 106,  61,  27, 165,  81, 234,  32, // .!...j=..Q. 
+ 231,   5, 201,  32,   7,  90, 153,  70, 225, 244, 192, 148, // ... .Z.F....
+ 190, 110,  61, 173, 185,  77, 236, 117, 243, 224, 164, 246, // .n=..M.u....
+ 146, 132, 182,   3, 214, 121, 160, 233,  77, 100,  72,  77, // .....y..MdHM
+  18, 152,   1, 252,  46, 184,  46,  42, 161,  29,  92, 230, // .......*....
+  48,  65,  39, 205, 125,  87, 151, 160, 181,  38,  46, 153, // 0A'.}W...&..
+ 194, 207, 113,  89, 244, 184, 118,  81,   9,  58, 110, 118, // ..qY..vQ.:nv
+ 114, 138, 135, 103, 254,  31,  54, 197, 121,  22, 209,   8, // r..g..6.y...
+ 103,  47,  58,  44, 240, 145,   6, 121, 214,  62,  52, 218, // g/:,...y.>4.
+ 163,  94,  70,  52, 197, 164, 170, 106,  94, 117,  49, 251, // .^F4...j^u1.
+  75, 119, 223, 180, 138, 134, 252,   8, 169,   6, 124, 195, // Kw........|.
+ 198,  33,   4, 104, 119, 167, 121,  80, 107,  80,  27,  73, // .!.hw.yPkP.I
+ 179,  10,   9,  16, 122, 246, 104,  15,  79, 182, 176,  69, // ....z.h.O..E
+ 196, 233,  16,   1,  29, 230, 178, 198,  93, 226, 207,  55, // ........]..7
+ 151,  62,  25, 209, 176, 239, 199,   2, 190, 240, 183,  47, // .>........./
+  52,  33,  60, 103,  49, 240,  92, 155, 167,  47,  74,  94, // 4!<g1..../J^
+  99, 251,  72, 253,  42, 255, 225,  85, 192,  14, 171,   3, // c.H.*..U....
+  71, 102, 127, 132, 254, 228,  72, 213, 110, 241,   7, 203, // Gf....H.n...
+  60, 226, 148,  76, 116, 248, 107, 148, 117, 190, 220,  99, // <..Lt.k.u..c
+  13, 207, 246,  53, 158, 105,  25, 172, 189,  46,  93,  18, // ...5.i....].
+  39,  61,  39, 250,  97,  74,  89,  51, 153, 154, 249, 157, // '='.aJY3....
+  75, 159,  36, 210, 176, 249, 164, 173,  45,  21,  38, 107, // K.$.....-.&k
+ 150, 129, 132,  94, 165,  21,  68, 251, 200, 126,  15, 152, // ...^..D..~..
+ 140, 226,  12,  25, 109, 106, 180,   1, 134,  36, 229, 182, // ....mj...$..
+ 254, 208,  46,   0,  90, 118, 113, 107,  90, 188,  70,  50, // ....ZvqkZ.F2
+ 238, 154, 101, 152,  67,  67, 210,  79, 244, 183, 205,  74, // ..e.CC.O...J
+ 219,   1,  81,  11, 134, 220,  62, 121, 201, 246, 159,  39, // ..Q...>y...'
+  99, 235,  21, 103, 111, 179,  14, 163, 229, 126,  90, 189, // c..go....~Z.
+  59, 202, 107, 110, 255, 249, 162, 181,  89,  67, 197, 211, // ;.kn....YC..
+ 233, 141, 160, 106, 190, 210, 178,  68, 135, 101, 137, 131, // ...j...D.e..
+ 218, 177, 241, 184, 212, 194,  11, 234,  22,  82,  64, 218, // .........R@.
+ 220, 132, 173, 117, 243, 161, 227,   2, 227, 197, 218, 234, // ...u........
+  42, 179,  75,  22, 105,   9, 241, 180, 124, 219, 214, 140, // *.K.i...|...
+ 192, 229, 253,   6,  76,  78, 137,  84, 232,   6, 166,  89, // ....LN.T...Y
+ 117, 127, 128, 222,  60,  66, 131, 167, 135, 176, 173,  69, // u...<B.....E
+  36,  77, 112,  73, 180, 162,  21, 119, 130,  68, 110, 164, // $MpI...w.Dn.
+ 250,  90,  20, 152,  85, 183, 111, 180, 205, 186, 175,  22, // .Z..U.o.....
+ 149,  59,  90, 249,  57, 206,  81,  41,  35,  27,  97, 121, // .;Z.9.Q)#.ay
+ 117,  91,  99, 227, 113, 121,  45, 162, 140, 105, 199,  68, // u[c.qy-..i.D
+  15,  10, 118, 199, 211, 188, 216, 251, 144, 169,  80, 109, // ..v.......Pm
+ 136, 225, 164, 108, 157, 161,  44, 233, 182, 114,  77, 133, // ...l..,..rM.
+ 150, 115,  78, 248, 195,  59,  64, 180, 182, 234, 234,  47, // .sN..;@..../
+ 105, 182,  46, 107, 182,  46,  75,   1,  84,  16, 175, 246, // i..k..K.T...
+  34,  73, 226, 159,  67, 198,  15,  18, 102, 233, 231, 140, // "I..C...f...
+ 145, 139, 117,  66, 254, 158, 115, 210, 167, 209, 167, 237, // ..uB..s.....
+ 150, 209,  39,  75, 124, 226,   7, 107,  34,  18, 154, 142, // ..'K|..k"...
+ 142,  75,  11, 130, 100,  74, 170, 233,  85, 172, 124,  89, // .K..dJ..U.|Y
+  30, 241, 200, 229, 193, 212,  56, 160, 141, 138, 228,  99, // ......8....c
+  13,  68, 207,  39, 154, 168, 154, 154, 101, 119,  65,  86, // .D.'....ewAV
+ 178,   3, 255, 101, 187, 217,  33,  43,  42,   7, 164, 110, // ...e..!+*..n
+ 156,  31, 176, 249, 245, 128,   1, 180, 223, 214,  54, 197, // ..........6.
+   3,  90, 137, 219, 167,  45,  51,  52, 113,  13, 211, 229, // .Z...-34q...
+ 253,  61,  36, 246, 179, 177, 227, 156,  72, 241, 217,  33, // .=$.....H..!
+ 102,  64,  50,  73,  52, 183, 115, 204,  98, 199,  49, 137, // f@2I4.s.b.1.
+  90, 251,  52, 173, 243, 239,  25, 255, 160, 126, 139,  19, // Z.4......~..
+   8,  62, 103, 157, 163, 218,  33, 153, 227, 192, 113,  64, // .>g...!...q@
+  99, 160, 209,  99,  17, 253, 231, 234, 237,  17, 169,  55, // c..c.......7
+  44, 232, 119, 248, 115, 204, 218, 197, 255,  70, 187,  93, // ,.w.s....F.]
+ 204, 255, 107, 139, 153, 122,  21,  81,  35, 217, 113, 173, // ..k..z.Q#.q.
+ 108,  33, 209, 146,  38, 200, 153, 201, 218,  14,  24,  68, // l!..&......D
+ 105,  86, 102,  11, 235,  69, 203,  88,   6,  91, 218, 152, // iVf..E.X.[..
+ 230,  18,  19,  37, 172,  50,  93, 111, 177, 134, 118, 168, // ...%.2]o..v.
+ 103, 199,  87, 212, 161,  59,  45,  99, 110,  58, 211, 228, // g.W..;-cn:..
+ 170, 164, 205, 186,  45, 189, 251, 199, 173, 149, 103,  40, // ....-.....g(
+ 222, 243,  17, 175, 183, 169,  83, 200, 120, 188,  80, 172, // ......S.x.P.
+ 229,  39, 162, 104, 149,  21, 228, 227, 188, 156,  56,  92, // .'.h......8.
+ 204, 254, 251,  90,  74, 141, 181, 219,  51, 182, 246,  29, // ...ZJ...3...
+ 240, 170,  80, 190,   8, 196, 122,  44, 127, 113, 175,   0, // ..P...z,.q..
+ 202,  37,  71, 220, 189, 227,  66, 155, 192, 210, 152,  87, // .%G...B....W
+  31, 229,   4, 252,  46, 174, 238, 189, 233,  48, 181, 230, // .........0..
+  93,  43, 102, 177, 230, 235,  95, 146,  83,  73, 124,  33, // ]+f..._.SI|!
+ 178, 127,  76, 122,  17, 186, 219, 249,  58, 135, 245, 123, // ..Lz....:..{
+  28, 207,  52, 235, 249, 191, 224, 243, 181, 138, 122,  77, // ..4.......zM
+ 251, 172, 246,  25, 201,  90, 133,  84,  86, 174,  81, 243, // .....Z.TV.Q.
+ 166, 255,  82, 149,  79,  84,  66, 210, 222, 127, 175,  26, // ..R.OTB.....
+ 162, 252, 231, 180, 255, 170,  93,  90,  75, 208,  27, 178, // ......]ZK...
+ 112,  37, 132,  20, 247, 115, 227, 117, 121,  59,  28,  89, // p%...s.uy;.Y
+  80,  57,  12, 103,  17,  53, 112,  37,  22, 210, 126, 196, // P9.g.5p%..~.
+ 187, 212,  60,  37, 134, 105, 234, 101,  98,  24, 250, 105, // ..<%.i.eb..i
+ 138,  87, 233, 136, 102, 179,  25, 173,  28, 121, 106, 183, // .W..f....yj.
+ 132, 223, 164, 231, 193, 126, 249,  91, 173, 246,  34, 189, // .....~.[..".
+ 157, 212, 110,   3, 117, 247,  77,  12, 221, 208, 214, 238, // ..n.u.M.....
+  14,  52,  31, 146,  63, 123, 140,  86,  53,  42,  64,  90, // .4..?{.V5*@Z
+ 193,  48, 142, 106, 207,  30, 195,  94, 207, 178,  86, 184, // .0.j...^..V.
+ 174, 251,  16,  42, 249, 236,  49,  35,  63, 148, 243, 196, // ...*..1#?...
+ 107, 105, 144, 228, 145,  31,  35, 243,  82, 188,  58, 125, // ki....#.R.:}
+   5, 205, 252,  69,  12, 229,  47,  79, 214, 203,  36, 158, // ...E../O..$.
+ 214, 151, 249, 210, 194,  98,  17, 249, 127, 124, 250, 207, // .....b...|..
+ 212, 206, 175, 116, 123, 128,  23, 173, 191, 119, 245, 142, // ...t{....w..
+  98, 237, 179,  78, 177, 107, 255, 117, 109,  21,  11, 253, // b..N.k.um...
+  99, 125, 245, 111,  47, 240, 173, 196, 211,  95, 186, 198, // c}.o/...._..
+ 138, 218, 156, 198, 105, 150,  95, 161,  73,  87, 134, 238, // ....i._.IW..
+ 153,  61, 230,  99,  24,  44,  51,  62, 102, 188, 130, 104, // .=.c.,3>f..h
+ 190, 200,  62, 169, 241, 246,   1, 123,  65, 209,  53,  80, // ..>....{A.5P
+ 214,   0, 176,  97,  49,  56,  20, 250, 236,  81, 109,  29, // ...a18...Qm.
+ 157, 124,  40,  17, 244, 243,  45, 117, 242,  97, 171, 176, // .|(...-u.a..
+ 168,  59, 194, 186, 227, 245, 186, 241, 198, 119,  24,  17, // .;.......w..
+  95,  87,  31, 253,  71, 213, 199, 171,  83, 131,  61,  47, // _W..G...S.=/
+ 246, 160,  33, 197,  57, 206,  17,  52,  40, 165, 198, 232, // ..!.9..4(...
+ 102, 101,  88, 123, 184,  50, 167, 197, 202,  77,  24,   5, // feX{.2...M..
+ 183, 166, 210,  52, 196, 187, 154, 106, 166, 150, 162,  86, // ...4...j...V
+ 110,   5, 141,  21,  55, 140, 142, 222,  91,   9,  34, 168, // n...7...[.".
+  85, 227, 214, 132,  43,  61, 154, 207,  30, 199,  43, 157, // U...+=....+.
+   0, 187, 103, 149, 163, 169, 157, 197,   1, 191, 233, 102, // ..g........f
+  59, 179,  32,  11,  17, 112, 244,  75, 193,   0, 186,  56, // ;. ..p.K...8
+ 162,  11,  19, 189,  24,  92,  51, 152,  16, 106,  49, 247, // ......3..j1.
+  18, 227, 198, 141,  68,  94,  32, 242,  55,  84,  83,  49, // ....D^ .7TS1
+  10,  82,  60, 244,  54, 242, 134,   2, 231, 152,  55, 198, // .R<.6.....7.
+ 222, 207, 245, 225, 211, 145, 164, 222,  67, 198,  75, 186, // ........C.K.
+ 105, 202, 161, 151,  96, 166, 219,  66, 241, 168, 105, 175, // i...`..B..i.
+ 151,  98, 231, 233,  12, 209,  68, 226, 241, 194, 145, 121, // .b....D....y
+  80,  42, 233,  53, 109, 124, 150, 149,  79,  33, 237, 184, // P*.5m|..O!..
+ 230, 201,  38,  83, 210, 107, 186,  20, 197, 161,   3, 136, // ..&S.k......
+ 118, 254, 142, 217, 230, 101, 144, 186,  71, 150, 152,  56, // v....e..G..8
+   2, 211, 230,  73, 249, 192, 209, 211, 169, 233, 168, 165, // ...I........
+  40,  19, 159,  23, 124, 205, 174,  25,  80, 237, 123, 106, // (...|...P.{j
+  64, 107,  26, 174,  16,  80, 121, 236, 138, 142,   4, 217, // @k...Py.....
+ 113, 175,  87,  58,  77, 133, 247, 170,  59, 120,  64, 104, // q.W:M...;x@h
+ 219, 253,  54, 205, 161, 126, 172, 105, 106, 128, 129,  39, // ..6..~.ij..'
+ 135, 248, 254,   1, 236,  17, 192, 146, 222, 252,  33,  79, // ..........!O
+ 158, 198, 197, 131,  69, 128,  49,  64, 233, 244, 128,  65, // ....E.1@...A
+  67, 134, 203, 165,  78, 128, 205, 203,   7,  24, 219,  92, // C...N.......
+ 192,  30, 203,  15,  16, 250, 171,  60, 209,  98,  14,  73, // .......<.b.I
+  38, 122, 102, 204,  87,  53,  66,  69,  32, 119,   6,  22, // &zf.W5BE w..
+  56,  83,  34, 236, 181, 103,  77, 131, 209,  72,  69,  22, // 8S"..gM..HE.
+ 205,  30, 154,  57, 140, 181, 139,  85,  13, 201,  60, 164, // ...9...U..<.
+ 212,  13, 192, 155, 110,  81, 168, 179, 188, 177, 158, 151, // ....nQ......
+  10,  96,  10, 176, 170, 148,  82,  43, 165,  79, 231, 200, // .`....R+.O..
+ 159,   9, 210, 155, 200,  62, 177,  31, 115, 106,  80, 198, // .....>..sjP.
+ 120,  67,  42, 152,  54, 153,  19, 181, 225, 115, 233, 138, // xC*.6....s..
+ 167, 200, 148,  50,  19, 140, 182, 255,  14, 226, 123, 139, // ...2......{.
+ 192, 168,  71,  61, 139,  39,  19,  32, 167, 197, 168, 235, // ..G=.'. ....
+ 199,  22, 153, 190, 149,  40,  87, 209, 182,  89, 249,  40, // .....(W..Y.(
+ 152,  54, 229, 118,  95,  38, 137, 255, 208,  12,  82, 250, // .6.v_&....R.
+ 181,  51, 103, 185, 180,  98, 126, 186,  50, 191, 211, 151, // .3g..b~.2...
+ 159, 238, 209,   7,  98, 111, 212,  67,  10, 201, 248,  70, // ....bo.C...F
+ 112, 121, 218,  87,  34,   3, 254, 132,  47,  10, 109,  30, // py.W".../.m.
+ 115, 163,  43, 166, 115,  34, 110,  91, 205,  58,  94, 209, // s.+.s"n[.:^.
+ 104, 247, 255,  45, 254, 149,  94, 193, 247, 234, 185, 179, // h..-..^.....
+ 135,   8, 190, 217,   6, 200, 215,   7, 242,   8,  80,  11, // ..........P.
+  70,  53, 221,  84, 235,  74, 159,   4, 165,  34, 169, 246, // F5.T.J..."..
+ 141,  42,  85, 143,  14,   7, 231, 215,  35, 241,  69, 155, // .*U.....#.E.
+ 158,  37, 218, 249, 161, 103, 183, 184, 208, 189,   7, 173, // .%...g......
+  87,  87,  94,  31,  95,  90, 129, 110, 184,  87,  87,  52, // WW^._Z.n.WW4
+   1,  60, 197, 221, 203, 170, 100, 156, 155,  81,  99, 220, // .<....d..Qc.
+   4, 184, 227, 243,  44, 181,  20,  84,  86, 188,  60,  64, // ....,..TV.<@
+   7, 228,  47, 209,  33, 222,  97, 137,  76, 180, 157, 238, // ../.!.a.L...
+   6,  73, 254, 219,  11, 206,  10,  99, 170, 135, 187, 105, // .I.....c...i
+  16,   7, 167,  11,  76,  90, 186, 203, 145,  34, 140,   7, // ....LZ..."..
+  35,  12,  21, 167, 204, 200,  59, 154,  26, 201,  24,  13, // #.....;.....
+ 254,  86, 153, 103, 170, 105,  60, 152,  53, 167,  11,  77, // .V.g.i<.5..M
+ 160, 199,  70, 254,  40, 168,   3, 213, 131, 110,  14, 166, // ..F.(....n..
+   9,   7, 148,  41, 209,  81, 185, 159, 163,   7, 225, 194, // ...).Q......
+ 196, 160, 147, 248,   6, 162, 222, 250, 132, 184, 222,  70, // ...........F
+ 253, 135,  55, 120,  89, 162, 213, 194, 215,  30,  44,  61, // ..7xY.....,=
+  55,  34, 217, 194, 125, 202, 113, 114, 253, 123,  28,  65, // 7"..}.qr.{.A
+  58, 122, 216,   9, 240,  56, 209,  36,  61,  64, 186,  76, // :z...8.$=@.L
+ 183, 151, 130, 180,  20, 141, 108,  87, 117, 158,  43, 103, // ......lWu.+g
+  15, 126,  68, 138,  71,   5, 121, 168, 133, 149, 163,  38, // .~D.G.y....&
+  72,  65, 169, 122,   3, 115, 155, 223, 147, 106,  57, 221, // HA.z.s...j9.
+ 150, 148, 233, 250,  19, 218,  45,   7,  95,  56, 218,   8, // ......-._8..
+ 166, 103,  40, 176, 218, 133, 164, 251,  30, 135, 240, 147, // .g(.........
+ 230, 215, 205,  95, 137, 177,  28,  54,  22,   2,  15,  53, // ..._...6...5
+ 159,  54, 220, 227, 214, 115, 219, 109,   4, 246, 248, 180, // .6...s.m....
+   5, 248, 215,  88,  56, 123,  99,  15, 159, 242,  24, 201, // ...X8{c.....
+  18,  50, 190,  88, 244,  22, 158,  58,  29, 246, 134,  30, // .2.X...:....
+  30, 180, 166, 158, 124, 124, 135,  25,  57,  95, 150, 231, // ....||..9_..
+  51, 135,  96, 239, 189, 192,  62, 104, 213, 247,  91, 207, // 3.`...>h..[.
+  41, 241,  48,  78, 241,  86,  66, 241,  64, 193,  13,  19, // ).0N.VB.@...
+ 156,   6,  17,  61, 137, 177,  18, 144,  97,  10, 177, 147, // ...=....a...
+ 149,  28, 225,  27,  28,  51, 124, 128,  40, 110, 194,  12, // .....3|.(n..
+ 153, 217, 249, 195,  66,  45, 113,  45, 227, 158,   9, 204, // ....B-q-....
+ 175, 110, 253,  87,  90, 199,  27,  91, 107, 197, 245, 252, // .n.WZ..[k...
+ 181,   2, 144, 170,   4,  92, 167, 215, 235,  95, 137,  91, // ........._.[
+ 169,  47, 144, 228,  35, 149, 139, 174, 122,  33, 135,  93, // ./..#...z!.]
+  85, 151,   7,  78,  10, 104,  60,  12,  23,  35,  60,  42, // U..N.h<..#<*
+  15,  80, 191,  53,  47, 204, 109, 157,   1, 101,  81, 182, // .P.5/.m..eQ.
+   1, 162,  99, 131, 180, 187,  86, 237, 228, 192,  28, 121, // ..c...V....y
+ 179,  80,  44,  53, 194, 109,   4, 136,  97, 153,  25,  48, // .P,5.m..a..0
+ 241,  23,  19, 245,  52, 215,  35,  10, 152, 104,  22,  81, // ....4.#..h.Q
+ 178, 158, 183, 112, 107, 202,  75, 218, 221, 210, 210, 118, // ...pk.K....v
+ 239,  19,  12, 171, 150, 219,  32, 156, 108,  12, 252, 164, // ...... .l...
+ 198, 126, 194, 204, 182, 181, 199, 104,  62,   3,  10,  85, // .~.....h>..U
+ 162,  12, 127,  92,  60, 176,  14, 228,  31, 147, 213,  95, // ....<......_
+ 169,   2, 207,   3, 254, 178, 226,  74, 118, 119, 175, 105, // .......Jvw.i
+   8,  74, 231, 199, 251, 116, 215, 235, 149,  84,  34, 145, // .J...t...T".
+  37, 252,  14, 241, 110, 136, 146,  63, 194,  43, 136, 243, // %...n..?.+..
+ 155, 126,  23,  34, 193, 187, 125, 217,  15, 216,  50,  52, // .~."..}...24
+  23, 191, 158,  74, 115,  90, 149, 238, 185,  32, 124, 159, // ...JsZ... |.
+   3, 242, 164,  40,  42, 141, 236, 241, 182,  65, 171, 209, // ...(*....A..
+ 127, 212, 101, 237, 174, 213, 128,  39,   0, 224, 127, 193, // ..e....'....
+ 121, 219, 128,   1,  89, 253, 178, 202, 163,   8,  42, 192, // y...Y.....*.
+ 171, 155, 247,  43, 250, 121,  88,   1, 116, 158,  61, 238, // ...+.yX.t.=.
+ 183,  86, 250, 155, 195, 136,  83,  76,  33, 133, 149, 231, // .V....SL!...
+ 214, 250,  10, 235,  49,  30,  10, 195, 221,  34, 114,  59, // ....1...."r;
+  48,  77,  60, 141,  84, 173, 246, 203, 202,  89,  85,  49, // 0M<.T....YU1
+   0, 198, 103,  31, 109, 252, 104, 111,  58,  22, 181,  99, // ..g.m.ho:..c
+ 220, 230,  36,  24,   7,  32,  20, 188,   7, 174, 192, 200, // ..$.. ......
+ 131, 182, 192, 160, 131,  54,  52,  24, 181,  30, 110,  40, // .....64...n(
+ 229,  94,  27,  72,  58,   9,  88,  57, 229, 128,  23,  80, // .^.H:.X9...P
+ 100, 202, 134,  14, 195,  80, 172, 168, 152, 150, 179,  69, // d....P.....E
+  17,  58, 208, 138,  16, 254, 178, 149, 105, 179, 224, 198, // .:......i...
+  40, 206, 116, 214, 103, 143, 169, 153, 147, 101, 244, 155, // (.t.g....e..
+  60,  81, 181, 170, 143, 247, 218,  69, 245,  12, 144,  42, // <Q.....E...*
+  36,  26, 184, 176, 131, 191,  39, 107,  85,  35, 141, 182, // $.....'kU#..
+  12,  16,  73, 131, 169, 233, 246,  62, 160, 116, 212, 112, // ..I....>.t.p
+ 221,  70, 251,  57, 223, 169,   6, 147,  91,  83, 151, 213, // .F.9....[S..
+ 150,  66,  26, 172,  30, 108, 107,  97,  35, 111,  34,  66, // .B...lka#o"B
+  90, 212, 158,  44,  22, 218, 142, 226, 208, 139,  61,  44, // Z..,......=,
+ 139,  96, 184,   7, 170, 162, 195, 211, 228, 246, 191,  13, // .`..........
+ 146, 142,   6, 201, 209, 211,  32,  41, 234,  55, 160, 129, // ...... ).7..
+  12,  15, 242, 240, 120,  27,  82, 134, 254,  64, 133, 216, // ....x.R..@..
+ 131, 136, 229, 208,  53,   6, 121, 187, 169,  87, 194,  36, // ....5.y..W.$
+   5, 246, 216,  18,  48, 121, 129,  45,   2,   5, 212,  44, // ....0y.-...,
+  50,  54,  44,  18, 244,  34, 160, 111, 129, 230, 140, 169, // 26,..".o....
+ 140,  26, 161,  88, 200,  53, 230,   8, 243,  27, 216, 138, // ...X.5......
+  29, 191, 160,  39, 136,  79, 163,  94, 228, 197,  78,  35, // ...'.O.^..N#
+ 116, 246,  82, 100,  50, 200,  56, 183, 209, 228, 146, 166, // t.Rd2.8.....
+ 104,  30, 255, 126,  90,  67, 101,  42,  27, 176, 210, 136, // h..~ZCe*....
+  57, 171,   6, 134, 103, 143, 208, 246, 231, 139, 213, 223, // 9...g.......
+ 187, 224,  76, 122, 191, 224, 201, 215,   9,  53,  16, 227, // ..Lz.....5..
+ 146, 213,  47,  44,  69, 175,  85,  71,  36, 209,   0, 122, // ../,E.UG$..z
+  75, 115,  10, 128, 198, 171, 191, 111, 131, 232, 131, 253, // Ks.....o....
+ 200,  10, 166,  98, 205,  48,  19, 254, 112, 168, 230,  25, // ...b.0..p...
+ 136, 223, 100, 226,  65,  85, 147, 236, 184, 113, 161,  68, // ..d.AU...q.D
+  38, 185, 250,  25, 136, 146, 172,   3, 122,  38, 221, 219, // &.......z&..
+ 178,  64, 120,  15,  53, 188, 199,  27, 106, 164, 114, 208, // .@x.5...j.r.
+  62, 160,   3,  65, 130, 115, 232,  66,  37, 186, 254, 124, // >..A.s.B%..|
+  35, 112,  43,  35,   4,  21, 166, 164, 120, 107,  40, 234, // #p+#....xk(.
+  75, 105,  60, 100, 123,  93,  75,  43,   3, 184, 107, 220, // Ki<d{]K+..k.
+ 210,  34, 227, 136, 148,  59, 122, 102, 107,  77, 187,  27, // ."...;zfkM..
+  21, 111, 173, 138, 220, 205, 207,  93, 173, 202, 178, 229, // .o.....]....
+ 218,  29, 107,  59, 230, 197,  22, 188, 101,  95, 161, 224, // ..k;....e_..
+ 243,  71,  69, 233, 158, 172, 140, 180, 189, 150,  85, 240, // .GE.......U.
+ 243, 209, 111, 192, 251,  73, 249,  35, 149, 116,  67, 200, // ..o..I.#.tC.
+ 238, 143,  94, 178, 156, 255, 205,   2,  52, 231,   4, 111, // ..^.....4..o
+   8,  14, 155,  60,  30, 155,  87, 136, 253, 226, 207, 131, // ...<..W.....
+  61, 156,  56, 240,  81, 209, 198,  13, 238, 252,  80, 183, // =.8.Q.....P.
+ 179, 250, 165, 251,  10,  38, 120,  51, 138, 239, 244, 101, // .....&x3...e
+  49,   9, 222,  25, 171, 210,  69, 152,   1,  95, 196,  43, // 1.....E.._.+
+ 163,  21,  63,  40, 252,  56,  83, 217,  52,  30, 121, 214, // ..?(.8S.4.y.
+ 199,  15, 151, 159,  45,  49, 136,  71,  15,  30, 200, 151, // ....-1.G....
+ 172, 182, 162, 172, 134, 111, 189, 196,  55,  16,  82,  82, // .....o..7.RR
+ 107,  91,  78,  83, 223,  52, 198, 183,  12, 209,  21, 216, // k[NS.4......
+ 129, 126,  37,  92,  36, 205, 193,  67, 166, 206, 245,  13, // .~%.$..C....
+ 250,  57, 128, 118, 119, 159, 134, 155, 176, 128,  32, 129, // .9.vw..... .
+ 206, 178,   0, 105, 179, 120, 250,  12, 203, 206, 141,  95, // ...i.x....._
+ 172, 147,  66,  78, 152, 165, 244,  96, 245, 220, 188, 207, // ..BN...`....
+ 190, 187, 155,  59, 249, 126,  40, 194,  90, 122, 201,  68, // ...;.~(.Zz.D
+ 195, 159,  21,  20,  16, 158,  55, 223,  54, 129, 193, 231, // ......7.6...
+ 169,  32,  43, 166,  28, 144,  79, 104, 194,  32,  66,  24, // . +...Oh. B.
+ 181,  28, 103,  14,  78, 244, 167, 236,   7,  90, 110,   8, // ..g.N....Zn.
+ 122, 116,  93,  71, 128, 106, 147,  61, 106, 142, 163, 229, // zt]G.j.=j...
+ 114, 148, 183, 207,  52,  13, 209,  64, 191,   1, 156,  11, // r...4..@....
+  51,   5,  72,  20, 129,   7, 149,  75, 153, 225, 181,  99, // 3.H....K...c
+  43, 141, 221, 160, 223, 151,  84, 153, 100, 181, 166, 147, // +.....T.d...
+ 164,  90, 198,  27, 110, 179,  57, 221, 131,  26,  62, 195, // .Z..n.9...>.
+  29, 129, 101, 189,   3, 137, 107, 174, 129, 243, 205,  52, // ..e...k....4
+  64, 215, 134, 221, 252,  81, 105, 173, 168, 162,  92, 186, // @....Qi.....
+ 231, 244, 182,  72,  61,  64, 141, 214, 197,  15, 170, 166, // ...H=@......
+  16,  67, 215,  68,  23,  99, 186, 203, 131, 181,  98,  94, // .C.D.c....b^
+ 200,  71, 127, 106, 254, 141,  87, 171,  53, 145, 198,  91, // .G.j..W.5..[
+ 111, 217, 139,  96,  54, 169, 165, 201, 144, 141,   6, 198, // o..`6.......
+  20, 162, 105, 116, 181,  33,  37, 203, 192, 223,  80,  58, // ..it.!%...P:
+ 226, 139,  62,  74,  55, 122,  12,  54, 102,  33, 222,   1, // ..>J7z.6f!..
+  35, 173,  69,  35,  30, 143,  45,  17, 161, 139,   9,  48, // #.E#..-....0
+  62, 190,  74, 132, 158, 222, 223, 101,  51,  50, 190, 194, // >.J....e32..
+ 107, 233, 163, 199, 194, 151,  22,  29,  41,   6,  89, 212, // k.......).Y.
+ 226, 179, 194, 192, 164, 172, 255, 105, 161, 206,  55, 148, // .......i..7.
+ 139, 186,   5, 191,  99, 201, 182,  46, 180, 129,  89,  64, // ....c.....Y@
+  68, 173, 220,  24, 100,   1, 245,  44, 236,  96,  83, 237, // D...d..,.`S.
+ 230,  43,  56, 196,  68, 123,  67, 229,  99,  62,  96, 242, // .+8.D{C.c>`.
+ 163,  65, 168, 223,  91, 185,  70, 139,   9,  25,  45,  65, // .A..[.F...-A
+  79, 177,  70, 243, 249, 189, 241, 130, 232, 178, 229, 201, // O.F.........
+ 162, 187,  32, 130, 250, 196, 189, 124, 232,  25, 163,  28, // .. ....|....
+ 223, 166,  63, 128,  16, 142, 100, 255,  29, 248,  35, 255, // ..?...d...#.
+  54, 152, 248, 120, 221,  23,  81, 192,  28, 225,  46, 244, // 6..x..Q.....
+ 157, 122,  99,  91, 191,  38, 110,  46, 183, 209, 250,  57, // .zc[.&n....9
+ 154, 246, 128, 254, 225, 165,  89, 126,  16, 165, 100, 228, // ......Y~..d.
+ 224, 247, 230, 241, 106, 183, 188, 152, 155, 242, 189,  56, // ....j......8
+  79, 102, 197, 199, 251, 216, 108,  72, 119, 229, 154, 204, // Of....lHw...
+ 231, 230, 237,   6, 124,  22,   8,   6, 157,  46,  58, 170, // ....|.....:.
+  91, 243, 123, 171,  72, 115, 182, 126,  55, 211, 125, 115, // [.{.Hs.~7.}s
+   8,  68,  57,  83, 250,  34, 166, 210,   3,  60, 186,  35, // .D9S."...<.#
+ 187, 187,  23, 118, 140,  47, 213, 178, 159,  94,  14, 132, // ...v./...^..
+ 102, 168,  36, 251, 134, 238,  81, 129,  72,  80,  55, 226, // f.$...Q.HP7.
+ 162, 138, 103, 149, 215, 230, 206, 240,  30, 172,  91,  32, // ..g.......[ 
+  70, 248,  74,  33,  86, 121,  73,  92, 225,  71, 229, 223, // F.J!VyI..G..
+  92, 248, 243,   2, 128, 159, 169,  97, 244,  16, 151, 209, // .......a....
+ 247, 121,  49,  35,  68, 217, 205, 170, 103, 216,  17,  97, // .y1#D...g..a
+ 213,  35, 252, 117, 172, 110, 176,  35,  47, 245,  91, 209, // .#.u.n.#/.[.
+ 116, 159,  17, 245, 184,  89,  72, 125, 129, 184, 212, 239, // t....YH}....
+  71,   7, 142, 104, 157, 102, 203, 101, 235,  20,  95, 209, // G..h.f.e.._.
+  57, 141, 151, 203, 232,  52, 233, 225, 128, 133, 142, 119, // 9....4.....w
+  67,  63, 220, 178, 223, 203,  45,  19, 175,  43, 190, 143, // C?....-..+..
+ 242, 113, 142,  47, 116, 223, 226,  45, 107,  43, 241,  82, // .q./t..-k+.R
+  62, 194,  68, 250,  40, 134, 252, 228,  56, 134,  21,  93, // >.D.(...8..]
+ 249, 166, 128, 241,  22,  75, 176, 194, 152, 222,  75, 239, // .....K....K.
+  99, 105, 228,  94, 149, 115, 108,  51,   8, 111, 203, 244, // ci.^.sl3.o..
+ 105, 109,  40, 209, 144,  13, 189, 212,  12, 176, 117, 127, // im(.......u.
+  52, 230, 255,  78, 165,  29, 225, 205,  95,  89, 241,  90, // 4..N...._Y.Z
+  30, 223, 206,   7,  82, 227, 169, 219, 117, 212, 105, 214, // ....R...u.i.
+ 143, 101, 210,  11, 235, 209, 233, 169, 235, 125, 103, 219, // .e.......}g.
+ 224, 114,  64,  76, 190, 234, 133,  50,   6,   1,  52, 206, // .r@L...2..4.
+  31,  39, 108, 224, 125,  83, 144,  60, 186, 106,  40,  16, // .'l.}S.<.j(.
+  39, 195, 162,  49, 111, 139, 198, 228, 183, 134,  73,  23, // '..1o.....I.
+  31,  26,   0, 177, 171,  27, 159,  34,  30, 133, 167,  80, // ......."...P
+  84,  92, 151, 116,  45, 190, 190,  69, 177,  31, 155,  11, // T..t-..E....
+ 143, 106, 121,  53, 141, 210, 253, 247,  95, 215, 241,  21, // .jy5...._...
+  25,  53, 221, 182,  24, 209,  29, 231, 124, 163,  53,  94, // .5......|.5^
+  61,  31, 247, 108, 245,  28, 159, 102, 216, 147,  48, 174, // =..l...f..0.
+ 182, 218,  67,  55,   4,  56,  44,  18,   4,  32,  71,  75, // ..C7.8,.. GK
+  25, 246,  84, 236, 169,   4,  72, 147,  77,  89, 190, 243, // ..T...H.MY..
+ 190, 119, 236, 192, 254,  13, 159,  68,  67, 157,  25,  67, // .w.....DC..C
+ 147, 222, 247, 222, 119,  28, 154,  97, 232,  66, 170, 208, // ....w..a.B..
+  14, 133, 239,   0, 209,  34,  87, 113, 193,  50,  21,  73, // ....."Wq.2.I
+ 207, 208, 248, 240, 133, 132, 168, 108,  55, 124,   7,  49, // .......l7|.1
+  14, 223,  71,  24,  98, 200,  80,  52,  82,  44,   7, 134, // ..G.b.P4R,..
+ 160, 141,  45,   0,  65,  99, 241,  28, 102, 148,  28,  62, // ..-.Ac..f..>
+  79, 176, 161,  82,  61,  64,  39,  23, 244,  96, 207, 173, // O..R=@'..`..
+  13, 108,  10,  77, 254, 208, 235, 210, 123, 201, 239, 214, // .l.M....{...
+ 161,  80, 128, 165, 116, 187,  37, 222,  29,  23, 211, 211, // .P..t.%.....
+ 245,  80,  63,   3,  38, 198, 167, 227,  91,  56,  61,  31, // .P?.&...[8=.
+ 118, 119, 243, 226,  66, 219,  92,  15,  55,  82, 183, 193, // vw..B...7R..
+  80, 125,  12, 238,  85, 248,   9,  37, 143, 174, 218, 225, // P}..U..%....
+ 199, 206, 101, 132, 143, 122, 190, 178, 175, 137, 162, 136, // ..e..z......
+ 111, 208,  33, 137,  63,  94, 224, 107, 107, 246,  47,  54, // o.!.?^.kk./6
+  40,  41,  13,  98, 225,  11,  58, 244, 128,  74,  66, 163, // ().b..:..JB.
+ 217, 106, 185,  43, 164, 184,  78, 205, 143,  70,  53,  27, // .j.+..N..F5.
+  20, 152, 245,  52, 245,  34, 205,  47,  14,  22,  61, 160, // ...4."./..=.
+ 203,  23, 177, 100,  66, 121, 155, 222,  65,  91, 164, 192, // ...dBy..A[..
+  65, 216, 127,  11, 176,  91, 105, 185, 238,  71, 249,  56, // A....[i..G.8
+ 195,  11,  17,  58,  98,  14, 226, 123, 211,  93, 137,  47, // ...:b..{.]./
+  56,  47,  71,  94,  75, 164, 241,  88, 147, 109,  74,   1, // 8/G^K..X.mJ.
+ 115, 244,  13,  36,   6,  69, 234,  11, 169,  81,  95,  74, // s..$.E...Q_J
+ 243, 243, 215,   2, 154,   6, 177, 127, 183,  67, 167, 247, // .........C..
+  65, 211,  79, 207, 254, 210, 132,  66,   1, 127, 190,  52, // A.O....B...4
+ 177,  88,  64, 226,  22,  23, 253, 165, 137, 133, 203, 206, // .X@.........
+ 243, 157, 157,  72, 112, 242,  55, 229, 139,  82, 223,  87, // ...Hp.7..R.W
+  72,  31, 223,  29, 170, 122, 248, 212, 116, 158, 196,  84, // H....z..t..T
+ 146, 191,  70,   2, 109, 196,  23, 247, 208,  82,   3, 104, // ..F.m....R.h
+ 253, 222, 142, 176, 110, 209,  66, 139, 206, 123,  59,  54, // ....n.B..{;6
+  30, 159,  98, 166, 126,  50,  18,  13, 229,  35, 170,  98, // ..b.~2...#.b
+  36, 249, 209, 187, 160, 104, 108,  44, 121, 135,  20,  75, // $....hl,y..K
+  94,  74,  61, 166, 104, 108,  59, 150,  53, 167,  88, 227, // ^J=.hl;.5.X.
+  27, 201, 172, 161, 128, 191, 170, 216,  30, 225, 203,  75, // ...........K
+  64,  51, 113,  58,   8, 194, 126, 224, 172, 224, 137, 237, // @3q:..~.....
+ 137, 211, 152, 226, 133, 213, 170, 113, 114,  58,  90,  46, // .......qr:Z.
+ 103, 167, 110,  11, 201, 238,   8,  20, 210, 214,  14,  34, // g.n........"
+  30, 124, 113, 153,  96,  36,  49, 137,   0,  60,  31, 239, // .|q.`$1..<..
+ 238,  46,  32,   6, 231,  69, 130,  24,   8,  65, 243, 221, // .. ..E...A..
+ 221, 225, 142, 108,  80,  88, 128, 111,  29, 243, 160,  94, // ...lPX.o...^
+  75,  40, 113, 178,  92, 162,  37, 247,  22, 103, 152, 219, // K(q...%..g..
+  18, 223,  97, 165, 215,  56, 107,  30, 112,  10, 225,  12, // ..a..8k.p...
+ 105,  92,  63, 183,   1, 171,  71,  61, 196, 244,  94, 211, // i.?...G=..^.
+ 245,  92,  47, 113, 196, 237,  30, 180,  68, 156,  56, 192, // ../q....D.8.
+ 190,  23, 167,  10,  10, 217, 193, 154, 237,  14, 252,  44, // ...........,
+ 151,  15, 167, 116,   7, 100, 155,  60, 139, 211,   7, 167, // ...t.d.<....
+ 167, 124,  80, 229,   6, 216,  71,  95, 220, 159, 194, 156, // .|P...G_....
+  80, 167, 242, 190, 119, 239,  41, 101, 223, 139,   7, 168, // P...w.)e....
+ 238, 142, 170, 131, 105,  88,  47,  85, 151, 113, 117,  65, // ....iX/U.quA
+ 169, 186,  11, 153, 157,  14, 169, 186,  57,  87,  55,  95, // ........9W7_
+  46, 135, 167, 119, 186,  58, 240, 220, 157,  14, 157,  30, // ...w.:......
+ 244, 213,  27, 138,  27,   9, 197, 167, 226, 238, 244,   2, // ............
+ 120,  41,  80, 194, 222, 133,   7,  13, 184,  16, 119, 185, // x)P.......w.
+ 169, 183,  54, 144, 242,   6, 128,  40, 229,   0,  10, 184, // ..6....(....
+  65, 149,  31, 104, 192,  64, 220,  92,  17,  99, 250, 153, // A..h.@...c..
+  88, 209, 187,  40,  11, 155, 239,  23, 179, 129,  74, 222, // X..(......J.
+   0, 135, 243,  51,  27, 196, 147, 102,   8, 162, 205,   2, // ...3...f....
+  37,  93,  75,  69, 141,  47, 151,  32, 193, 125, 139,  86, // %]KE./. .}.V
+ 231, 159, 241, 185, 157,  25, 153, 190, 197,  15, 100,  25, // ..........d.
+  16, 255, 148,  63,  52,  63, 190,  19, 191, 193, 143,  63, // ...?4?.....?
+  72, 197, 119, 240,  59,  14, 227,  56,  17,  63, 129, 139, // H.w.;..8.?..
+ 180, 114, 241,  61, 184, 134,  42,   8, 241,  17, 249,  31, // .r.=..*.....
+   8,  51,  85, 134,  14,  64,  77,  80,  49, 127, 104, 206, // .3U..@MP1.h.
+  65,  78,  82,  17,  56, 112,  67, 163,  80,  49, 184, 194, // ANR.8pC.P1..
+ 120,   2, 227,   5,  18,  57,  57, 219,  66,   5,  18,  49, // x....99.B..1
+  92, 186,  32, 228,  67,  69, 105,  16, 129, 226, 181,   7, // .. .CEi.....
+ 226, 131, 242, 165, 187,  87, 126, 192,  38,  45, 169,  17, // .....W~.&-..
+ 110, 221, 110,  45,  97, 200, 109, 245, 111, 117, 122, 218, // n.n-a.m.ouz.
+ 113, 157, 134, 205, 191, 149, 107, 136,  23, 102, 238, 152, // q.....k..f..
+ 105, 171, 108, 226, 240, 168,  67, 150, 211,  13,  75, 143, // i.l...C...K.
+ 201, 110, 185,  68, 186, 167,  60, 186, 199, 150, 223, 215, // .n.D..<.....
+  25,  35, 184, 148,  80, 115, 169,  85,  19, 152,  66,  35, // .#..Ps.U..B#
+ 186,  28, 148, 223, 140, 157,  74, 214,   2, 133, 154, 152, // ......J.....
+  20, 200, 117, 132, 154,  81,  70, 192,  22, 225, 238, 151, // ..u..QF.....
+ 223,  49, 186, 174, 190, 182,  59, 179,  49, 205, 140, 128, // .1....;.1...
+ 224,  60, 207, 214,  30, 189, 173, 166, 252, 254, 137, 132, // .<..........
+  15, 235,   9, 191, 123,  34, 225,  61, 193, 190, 197, 119, // ....{".=...w
+ 248,  95,  22,  15, 125, 214, 148,  94,  58, 115,  91, 207, // ._..}..^:s[.
+ 159, 103,   6, 235, 126,   2, 142,  25,  62, 183, 221,  58, // .g..~...>..:
+  99,  85, 243, 245, 199, 203, 119, 231,  31, 222,  59, 206, // cU....w...;.
+  94, 200, 176,  25,  16, 226,  85, 228,  52, 117,  87,   0, // ^.....U.4uW.
+ 215, 198, 135,   8,  85, 190, 100, 208, 180,  28,  96,  55, // ....U.d...`7
+ 244, 224, 156, 177, 220,  21, 217,  46, 214,  89,  88, 255, // .........YX.
+  10, 200,  93, 196, 198, 187,  59,  39,  95,  77,   8,  36, // ..]...;'_M.$
+   8, 187, 167,  65,  23,  47, 183, 215,  75,  39, 191, 217, // ...A./..K'..
+   1,  61, 249,   2, 157,  11,  89, 158, 203, 156, 210, 234, // .=....Y.....
+  67, 171,  27, 153, 213,  13, 213,  85,  38, 155,  47, 163, // C......U&./.
+ 190, 186, 122,  30,  34,  83,   7, 246, 140, 226,  95,   0, // ..z."S...._.
+ 148, 184, 229, 212, 237,   4,  34, 192, 131,  63, 224,  23, // ......"..?..
+ 196, 182, 125, 228, 234,  49,  47,  86,   0,  43,  86,   3, // ..}..1/V.+V.
+  18,  30,  23,  16, 186,  50, 151, 231, 199,  12, 147,  27, // .....2......
+ 122,  93, 248, 156, 222,  21,  62, 147, 253, 252,   1,  83, // z]....>....S
+ 240,  62, 147, 149, 149,  76, 161,  46, 165, 134, 108, 144, // .>...L....l.
+ 194, 236,  85, 160, 233, 149,   0, 249, 185, 132, 165,  27, // ..U.........
+ 235, 152, 171, 242, 187,  88, 249, 178,  45, 191, 106, 160, // .....X..-.j.
+  69, 167, 146, 154,  80, 220,  66, 220, 205,  36, 179,  29, // E...P.B..$..
+  16,   5, 225, 203, 139, 182, 171,  45,  79, 252, 190,  46, // .......-O...
+ 191, 110, 196,   5, 238, 238, 154, 165, 223,  82,  59, 244, // .n.......R;.
+  27,  84, 122, 245,  23,   4, 238, 143, 230, 134, 207,  15, // .Tz.........
+  99, 251,  75,  16, 101, 199, 212, 215, 242,   4, 120,  73, // c.K.e.....xI
+  72, 168, 126, 119,  74,  55, 222, 226, 139, 194, 134, 231, // H.~wJ7......
+ 225,  27, 142, 209,   8, 237,  45, 166,  39,  58,  73, 132, // ......-.':I.
+ 239,  34, 217, 248, 126, 112, 200, 144, 204,  31,  41,  44, // ."..~p....),
+ 198,  59, 130, 241,  54, 161, 167,  81,  55, 130, 241, 166, // .;..6..Q7...
+ 187, 132, 177,  86, 248,  69,  45, 131, 238, 233,  12, 243, // ...V.E-.....
+  23, 253, 156, 252, 226,  78,  85, 185, 158, 248, 163,  83, // .....NU....S
+  74, 211, 205, 223, 242, 195, 134,  86, 111,  63, 166,   1, // J......Vo?..
+  95, 175, 165, 107, 106, 201,  47, 211,  46,   1, 247, 155, // _..kj./.....
+  98, 200, 242,  23, 230, 242,  30, 192,  36, 236,  26,  89, // b.......$..Y
+ 252,  52, 228,  71,  42,  75, 151, 245,  86, 110, 253, 140, // .4.G*K..Vn..
+  28,  28, 126, 188,  21, 180, 135, 133, 130,  67,  64,  19, // ..~......C@.
+ 240,  46,  91, 199, 241,  72, 193,  51, 222,  85, 254, 128, // ..[..H.3.U..
+  56, 141, 216,  43, 185, 237,  22, 208, 234,   5, 217,  61, // 8..+.......=
+  24,   1, 109, 150,  41, 108,  85, 218,  22, 230, 120, 213, // ..m.)lU...x.
+ 180,  66, 125, 146, 125, 235,  59,  63,  90, 248, 201, 131, // .B}.}.;?Z...
+  37, 172,  55, 106, 144, 104, 231,   5, 158,  75, 128, 223, // %.7j.h...K..
+ 151, 243,  36,   8, 201, 143, 161, 223,  45,  34,  69,  63, // ..$.....-"E?
+  33, 250,  94,  46,  38,  11, 188,  85, 219, 186,  84, 243, // !.^.&..U..T.
+  76, 225, 148,   0, 247,   7,  64,  88, 118, 189,   7, 133, // L.....@Xv...
+  71,   7, 190,  82,  67, 118,  66,  79, 223,  66, 149, 151, // G..RCvBO.B..
+ 208,  13,  42, 240,  34, 214, 142, 207,  11, 149, 178, 235, // ..*.".......
+  71,  53, 138, 140, 251, 243, 116, 145, 104, 231, 155,  36, // G5....t.h..$
+  96, 199, 165,  15,  32,  65, 103, 249, 246, 251, 175, 149, // `... Ag.....
+ 119, 202, 121, 248,  91, 162, 195,  42, 160, 122,  39, 213, // w.y.[..*.z'.
+  91, 166,  73,  95, 129,  10, 252,  40, 213, 167, 194,   7, // [.I_...(....
+ 178, 230,   5, 252, 231, 169,  79, 130, 126, 126,  20,  63, // ......O.~~.?
+ 194, 127, 158, 122,  43, 232, 231,  93, 249, 185, 247,  55, // ...z+..]...7
+  37,  42, 233, 182,  78,  85, 207, 106, 225, 158,  17, 167, // %*..NU.j....
+ 174, 199, 231,  87, 249, 248,  51, 252, 231, 209, 242,  42, // ...W..3....*
+ 204, 170,  55,  48,  19, 126,  86,  62, 222, 218, 206, 161, // ..70.~V>....
+ 246,  90, 112, 157, 158,  78, 167, 214, 182,  29,  65, 237, // .Zp..N....A.
+  48, 252, 170, 137, 190,  62, 165,   7,  32, 101,  83, 219, // 0....>.. eS.
+ 185,  18, 235, 241,  27, 209,  84, 243,  27, 187,  28,  92, // ......T.....
+ 119, 161, 224, 188,  69, 121, 160, 120, 245, 170, 156, 248, // w...Ey.x....
+  21, 189, 193, 235, 136,  87, 121,  74,  14,  97,  96, 228, // .....WyJ.a`.
+ 117, 162, 175, 175, 163,  31, 176, 202, 245, 216,  74, 228, // u.........J.
+ 219, 183, 229,  42, 222, 198,  48, 150,  88, 199, 219, 188, // ...*..0.X...
+  14,  29,  36, 166,  94, 121, 127,  71,  17,  81,  82, 131, // ..$.^y.G.QR.
+ 178, 158, 219, 246, 178,  83, 183, 221, 203,  26, 232,   2, // .....S......
+ 109, 253,  37, 230, 114, 219, 149, 162, 122, 214, 203,  11, // m.%.r...z...
+  24, 146, 143,  23, 150, 240, 253, 173, 241, 254,  12,  95, // ..........._
+ 191,  70,  67, 214, 246, 104, 140, 181, 196, 108,  86,   1, // .FC..h...lV.
+ 101,  16,  45,  50,  69, 141, 159,  21, 160,  52, 129,   2, // e.-2E....4..
+ 119,  66,  20, 137,  47,  21,  80, 238,  17,  37,  78, 243, // wB../.P..%N.
+ 196, 121, 160,   0, 221, 157, 122,  75, 239,  36, 119,  11, // .y....zK.$w.
+ 100, 178, 117, 215,  47, 130,  48, 132, 185, 107, 202,   0, // d.u./.0..k..
+  20,   3,  28,   3, 209, 241,  52, 203, 177,  45,  91, 149, // ......4..-[.
+ 145,  82, 171,  39,  25, 138, 234, 234,  75, 126, 173, 122, // .R.'....K~.z
+  31,  95, 198, 221, 251, 215, 163, 221, 247,  27, 191,  95, // ._........._
+ 213, 157, 127, 173, 150, 253, 127,  63,  94, 213, 247,  38, // .......?^..&
+ 129, 121, 140,  33, 110, 170, 123,  18, 171, 186,  78, 196, // .y.!n.{...N.
+  76, 210, 122,   4, 178,  18, 130, 182,   9, 255, 122, 234, // L.z.......z.
+ 215, 126, 136, 219, 103,  60,  12, 200, 199, 194, 140,  84, // .~..g<.....T
+  40,  45, 171, 184,  75, 188, 204, 175, 209,  28,   0, 244, // (-..K.......
+ 187,  46,  55,  24,  96, 132,  47, 141, 227, 199, 195,  15, // ..7.`./.....
+ 181, 187,  32, 180,  60, 133,  62,  72,  59,  23, 139,  17, // .. .<.>H;...
+   5, 209, 144, 206, 130, 177,  99, 200, 217, 232,   3, 111, // ......c....o
+  29,  66, 178,   6, 177,  95, 227,   8,   4, 189, 159,  73, // .B..._.....I
+ 110, 251,  59, 104, 250,  32, 211, 125,  43, 251, 174, 104, // n.;h. .}+..h
+ 139, 118, 243,  64,  28,  92, 209, 203,  22,  23, 168, 127, // .v.@........
+  52, 220,  67, 129, 177,  14,  62, 158, 193,  65,  45,   1, // 4.C...>..A-.
+  97,  20, 242,  27,  62,  85,  96, 158,  33, 254,  25,   2, // a...>U`.!...
+ 190, 147, 234,   7, 100, 194,  67, 148, 183, 255, 137,  15, // ....d.C.....
+  10,  72, 139, 166, 247, 202,  18, 234, 123, 105, 253,  43, // .H......{i.+
+   2,  49, 233,  39, 161,  90,  16, 124, 177, 218, 123, 124, // .1.'.Z.|..{|
+ 133, 225, 174,  14, 135, 106, 218,  82, 185, 117, 107, 239, // .....j.R.uk.
+ 145,  51, 116,  32, 149, 239, 163, 235,  16,  92, 211, 149, // .3t ........
+ 247,  56, 155, 173,  32,  97,  71, 168, 125, 157,   7,  26, // .8.. aG.}...
+ 114,  32,  45, 239,  49,  77,  87,  86, 105, 124, 143,  11, // r -.1MWVi|..
+ 182,  67, 187,  99,  64, 104,  58, 108,  61, 207,  96, 136, // .C.c@h:l=.`.
+ 225,  39, 132,  65, 110, 239,  63, 143,  64, 234, 234, 180, // .'.An.?.@...
+ 158, 199, 160,  94, 118,  14,  15, 158,  27, 163,  75,  31, // ...^v.....K.
+  45,  31,  32,  25, 235, 174, 118, 176, 167, 165,  62, 122, // -. ...v...>z
+  26,  44,  29, 134, 138,  99, 122, 219, 207, 196,   1,  84, // .,...cz....T
+ 224,  98,  45,  46, 186,  58, 232,  10,  33,  48, 196, 192, // .b-..:..!0..
+  16,   3,  67,  12, 196, 125,  11, 109, 168, 188,   3, 127, // ..C..}.m....
+ 216, 136,  67, 248,  59, 134,  63,  23,   3,  99, 136, 138, // ..C.;.?..c..
+  33,  42, 134, 168,  24, 242, 198,  16,  29, 139,  35, 248, // !*........#.
+  59, 134, 191,  19, 248, 115, 177, 197,  46, 198,  36, 144, // ;....s....$.
+  54, 129, 180,   9, 164,  77,  32,  93,  34,   2,   8,   9, // 6....M ]"...
+  32,  87, 128, 169, 192, 131, 174, 131,  22, 121, 225, 123, //  W.......y.{
+   5, 138,  84,  63, 128,  33,  17, 165, 167, 230, 183, 124, // ..T?.!.....|
+ 220,  43, 209, 111,  99, 117,  22,  18, 121,  26, 184,  63, // .+.ocu..y..?
+  78,  28,  11,  28, 186,  63,  73,  20,   9,  28,  65,  30, // N....?I...A.
+ 188,  54,   7,  43, 119,  91,  66,   8,  63, 252, 147,  36, // .6.+w[B.?..$
+ 160, 114,  28,  64, 146, 186,  85,  35,  12, 208,  41, 171, // .r.@..U#..).
+ 222, 253,  34,  57,  96, 250,  65, 221, 106,  62,   2,  21, // .."9`.A.j>..
+ 193, 222, 252, 197, 124,  87, 162, 252,  10, 185, 166,  57, // ....|W.....9
+  32,  28, 139, 133,  24, 138, 177, 152, 155, 119,  12,  70, //  ........w.F
+  72,  53, 166, 114, 124,  42,   3,  49, 193, 159, 100, 119, // H5.r|*.1..dw
+  55,  56,  29, 139, 153, 204,  80, 126, 190,  70, 153, 122, // 78....P~.F.z
+   6,  24, 216,   1, 157,  89, 102, 129,  61,  91,  99, 114, // .....Yf.=[cr
+ 211,  94, 203, 155, 149, 216, 140, 152,  44, 151, 211, 158, // .^......,...
+ 203,  97, 134, 197, 144, 238, 127,  75, 165, 160, 132, 136, // .a.....K....
+  73, 140, 208,  59, 233, 141, 247,  18, 175,   5, 168,  61, // I..;.......=
+   5,  23,  62, 100,  26, 203, 107,  41,  31, 122, 215,  30, // ..>d..k).z..
+ 228, 129,  10, 111, 215, 216, 103,  36, 110, 203,  92,  13, // ...o..g$n...
+ 250, 234, 112, 243, 124, 210, 113, 168, 202, 159, 236, 120, // ..p.|.q....x
+  79, 145,  29, 208,  95, 107, 238, 130,  67, 116, 238, 156, // O..._k..Ct..
+ 152,  37,  64, 204, 134, 104, 213,  76, 140,  16,  23,  96, // .%@..h.L...`
+ 103, 211, 122,   4, 120, 185, 168, 135, 240, 117, 177, 134, // g.z.x....u..
+ 160, 145, 161,  22,  24,  80, 141,  78, 215, 142, 177,  99, // .....P.N...c
+ 118,  61, 168, 251, 220,   8,   7, 109,   9,  35,  38, 172, // v=.....m.#&.
+ 177,  83, 186, 198,  63, 145, 241, 233, 184,  55, 246, 112, // .S..?....7.p
+ 186,  62, 212,  65, 237,  91,  56, 141, 239, 208,  48,  82, // .>.A.[8...0R
+   7, 229, 241, 186, 241,  32,  18, 167, 171, 243,   5, 108, // ..... .....l
+  77, 153, 194,   0,   4, 104, 199, 153, 150, 152,  85, 125, // M....h....U}
+  90,  97,  67, 123,  33,   7, 228, 172, 102,  47, 130, 129, // ZaC{!...f/..
+  27, 195, 247,  86, 206, 247, 252, 166, 127, 175,  82, 124, // ...V......R|
+ 167, 252,  58, 157, 251,  67, 253, 148,  11, 116, 211,  14, // ..:..C...t..
+ 176, 217,  65, 125,  12, 211, 207, 118,  81, 110, 135, 190, // ..A}...vQn..
+ 160,  45, 119, 118, 234, 154,  21, 219, 239, 176, 159, 147, // .-wv........
+ 250,  76,  28,  58, 206, 223, 219, 251, 248, 162,   8,  52, // .L.:.......4
+ 167, 212, 148,   6, 104, 162, 167,  46, 189, 114, 209,   0, // ....h....r..
+ 216,   4,  13,  25,   2,   5,   0, 213,  26,  50,  81, 142, // .........2Q.
+ 230,  17,  42, 213, 118, 208,  24, 245,  71, 197, 134,  59, // ..*.v...G..;
+ 103,  15, 106, 117, 158, 223, 230,  96,  10, 180,  88,  95, // g.ju...`..X_
+ 120,  53, 123,  24, 173,  86, 100,  53, 233, 171,  19, 161, // x5{..Vd5....
+ 142,  68, 166,  64,  70,  62, 182, 161, 170, 126, 150, 137, // .D.@F>...~..
+  44,  20,  89,  68,   1, 104, 134,  44,  41,  45,  89,  92, // ,.YD.h.,)-Y.
+  85, 177, 139, 189, 111, 180,   3, 139,  31,  65, 104, 209, // U...o....Ah.
+  11,  26, 199, 244, 213,  90,  86,  47, 244,  50,  36, 157, // .....ZV/.2$.
+  17,  61, 219, 166, 250, 199,  87,  16, 162, 128,  23, 214, // .=....W.....
+ 195, 138, 237,  34,  75, 202, 229, 219,  33, 175, 116, 128, // ..."K...!.t.
+  46, 171, 231,  83, 105, 138, 161,  69,  46, 215, 144, 130, // ...Si..E....
+  83,  40,  20, 120,  42,  40,  70, 253, 194, 128, 159, 191, // S(.x*(F.....
+ 124,  29, 153, 141, 170,  70,  23, 196, 245, 116, 180,  42, // |....F...t.*
+  86, 209,  55, 230,  16,  51, 215,  18, 246, 106, 185,  45, // V.7..3...j.-
+  96,  95,  46,  97, 233, 180, 185, 204,  50, 225, 128,  66, // `_.a....2..B
+  46, 153, 201, 104,  71, 250, 187, 187, 163, 126,  27, 180, // ...hG....~..
+ 253, 120,  71, 166, 232, 238, 128,  59, 217, 193,  69, 237, // .xG....;..E.
+  81, 127,  31, 220, 193, 142,  28, 162, 251,   0, 220,  83, // Q..........S
+ 178, 202, 141, 250, 135, 224, 158, 144, 201, 108, 212,  63, // .........l.?
+   2, 247, 168,  95, 116,   5, 230,  33,  76, 188,  24, 166, // ..._t..!L...
+  90,  34, 134,  64,  85, 198, 114,  42, 230, 114,  34, 102, // Z".@U.r*.r"f
+ 118,  72,  47, 112,  20, 160,  12, 214, 204,  64, 249, 252, // vH/p.....@..
+ 229, 224,  82,  74, 127,  27, 208, 181, 101,   7,  13, 253, // ..RJ....e...
+  86, 163,  97, 193, 248,  41, 212,  57,  87, 192, 226, 218, // V.a..).9W...
+ 162, 113, 208,  17, 240,  15, 218, 197, 211,  41,  75, 229, // .q.......)K.
+  99,  58, 141, 239, 240, 109, 157, 144,  87, 127,  68,   0, // c:...m..W.D.
+ 178,   5,  84, 231, 237, 184, 130,  30, 251, 240, 248, 197, // ..T.........
+  44, 129,  55,  52, 171,  36, 245, 242,  12, 188,  13, 166, // ,.74.$......
+  45, 244, 254, 181, 109, 111,  95, 224,  35,  36,  73, 160, // -...mo_.#$I.
+ 240, 225, 135, 226,  85,  38, 202, 215,  11, 155, 156, 143, // ....U&......
+ 146, 123,  97, 115,  30,   7, 248, 132, 185, 137, 212, 222, // .{as........
+ 114,  26, 218, 223, 129,  87,   2, 134, 107, 117,  21, 234, // r....W..ku..
+ 142, 169,  12, 121, 123,  72, 145,  43,  49, 194, 243, 170, // ...y{H.+1...
+  22, 116,  42,  24,  89,  43,  17, 140, 238, 217, 216,  13, // .t*.Y+......
+ 142, 148,  93, 180,  37,  32, 245, 250,  87,  43, 145,  45, // ..].% ..W+.-
+ 100,  31,   4, 132, 146,  66, 149,  13, 141, 101,   7, 223, // d....B...e..
+ 196, 126,  44, 201, 126, 104,  25, 110, 242, 233,   4, 152, // .~,.~h.n....
+  47, 244,  74,  60, 237,  80,  32,  83,  49,  61,   3,  85, // /.J<.P S1=.U
+  26, 170, 241,  83, 165, 108, 207,  72,  99,  51,  47, 198, // ...S.l.Hc3/.
+ 230,  30,  63,  15,  52,  74, 120,  70, 148, 134, 230, 182, // ..?.4JxF....
+  10, 242,  18, 198, 100,  11,  92,  38,   1, 114, 176, 192, // ....d..&.r..
+ 245,  17, 160,   9, 139, 149,  96, 120, 234, 193, 219,  62, // ......`x...>
+  84,  67, 152,  33, 113, 162,  33,  15,  45, 125, 166, 103, // TC.!q.!.-}.g
+  79,  26, 252, 206,  35, 208,  61, 183,  17, 197, 128, 254, // O...#.=.....
+ 162,   3, 167, 119, 151, 109,  81,  13,  59, 216, 107, 115, // ...w.mQ.;.ks
+ 180,   5, 104,  50,   9, 162, 115,  90,  25, 247,  57, 165, // ..h2..sZ..9.
+  14, 251,  28, 207,  49, 168, 203, 155, 186,  52,  30,  80, // ....1....4.P
+ 211, 131,  92, 250, 133, 185,  70,  57,   6, 244,  38, 239, // ......F9..&.
+ 143, 188, 254, 142,  79,  76, 174,   4,  54, 227, 207,   7, // ....OL..6...
+ 222, 224,  13,  36,  94, 105,  12, 109, 253,  69,  12, 213, // ...$^i.m.E..
+ 121,  11,  68, 189, 230, 124, 184, 148, 125, 141,   8, 181, // y.D..|..}...
+  21, 249, 254,  66,  49, 152, 139,  10, 225, 242,  86,  43, // ...B1.....V+
+ 129, 175, 210, 129, 224, 155,  31, 253, 201, 134, 194, 156, // ............
+   9,   2,  39, 239, 212,   2, 135,  89, 245, 207, 227, 105, // ..'....Y...i
+ 212, 179, 177,  40, 118,   7, 228,  62, 218,  58,   0,  62, // ...(v..>.:.>
+  64, 248, 196, 159, 192,  64,   3,  77, 195,  43,  88, 203, // @....@.M.+X.
+ 232, 227, 226, 142, 176,  12,   0, 178, 136,   2, 198, 125, // ...........}
+  46, 222, 236,  90, 201,  96, 190, 197, 115, 124,  14, 204, // ...Z.`..s|..
+ 159, 248, 188,  73,  66, 112, 216, 187, 217,  12,  23, 198, // ...IBp......
+  50,  85, 137,  92, 137, 235, 123,  44, 245,  26, 203,   6, // 2U....{,....
+ 232, 196, 195,   5, 160,  24, 213,  97, 240,  93, 196,  72, // .......a.].H
+ 144,  26,  49,  62,   0, 118, 239,  53,  92, 232, 186, 159, // ..1>.v.5....
+ 226, 250, 213, 148,  54, 160,  61, 166,  55, 193, 220, 235, // ....6.=.7...
+ 243, 163,  56,  87, 156, 136, 119,  39, 232, 100, 184, 197, // ..8W..w'.d..
+   2, 178, 181,   4, 222, 231, 140, 191, 249,   4, 198, 215, // ............
+ 194, 222, 109, 206, 102, 218,  18, 164, 105,  69,  54,  42, // ..m.f...iE6*
+ 166, 144, 198,   1,  43, 153,  12, 124,  27, 149,   0, 248, // ....+..|....
+ 191, 217,  58, 114,  44,  67, 199,  32, 249,  84, 170, 111, // ..:r,C. .T.o
+ 236,  71, 204,  39,  30, 245, 213, 163, 106, 190,   2,  24, // .G.'....j...
+  76,  76, 196,  84,  60,  18,  30, 186,  45,  12, 158, 149, // LL.T<...-...
+ 210, 115,  61,  46,   6,  95, 203, 127, 184, 237, 249, 125, // .s=.._.....}
+  45, 125,  72,  51,  53, 107,  44,   2,  81, 107, 248, 243, // -}H35k,.Qk..
+ 121, 168,  26,  28,  34, 106, 214, 165, 154, 196, 170, 246, // y..."j......
+ 229, 157,  37, 106, 159, 226,  65, 156, 197,  16, 246,  86, // ..%j..A....V
+ 129,  78, 135,  87,  19, 215, 222,  43, 124,  14, 179, 246, // .N.W...+|...
+  50,   9, 252,  16,  34, 222,  67, 124, 237, 210, 143,  82, // 2...".C|...R
+   8,  75, 225, 167, 129, 184,  54, 134, 136, 151,  88, 104, // .K....6...Xh
+ 141,  14, 188, 215,  94, 207, 226,  95,   3, 171,  84, 244, // ....^.._..T.
+ 150, 144, 203, 135, 217,  32,  14,  45,  83, 100,  57, 227, // ..... .-Sd9.
+  63,  68, 118, 139, 123,  91, 194,  17,   8, 206, 217, 181, // ?Dv.{[......
+ 200,  30,  74, 160,  35,  60, 178, 238,  45,   3, 196, 133, // ..J.#<..-...
+  32, 209, 201,  59, 104, 137, 137,  63, 247,  14, 120, 110, //  ..;h..?..xn
+ 130, 143, 182, 206, 124,  11,  65, 218, 121, 137, 225,  29, // ....|.A.y...
+ 237, 121,   3, 252, 217, 203, 110,  33, 241,  72,   1, 219, // .y....n!.H..
+ 152,  36, 193, 200,   3, 128, 242, 121, 137, 108,  34, 120, // .$.....y.l"x
+ 206, 123, 217,  12,  16,   9,  83,  94, 227, 205, 119,  10, // .{....S^..w.
+  75, 115,  65, 127, 229, 109, 174, 136,  18, 217, 253, 182, // KsA..m......
+ 166, 249, 139,  44,  70,  92,   4,  18, 150, 169, 145, 231, // ...,F.......
+ 210,  54,  83, 229, 211, 242, 104,   3, 126,   9,  67, 128, // .6S...h.~.C.
+ 198, 151,  72, 251, 160,  66,  69, 242,  99,  55, 102,  97, // ..H..BE.c7fa
+ 211, 178, 188, 111, 209,  92,  90,  34, 227, 119,   5,  90, // ...o..Z".w.Z
+  19, 253, 211, 182, 120,  80,  22,  82, 169,   6, 180,  97, // ....xP.R...a
+  35, 198, 195,  24,  37, 251, 125,  40,   3, 148, 153, 104, // #...%.}(...h
+ 217,  13, 148,  84,   7,  45, 241, 209,  41,  63, 148,  10, // ...T.-..)?..
+ 129, 245,  24,   2,  28, 159, 197,  60, 109, 134,  14,  82, // .......<m..R
+ 168, 166, 209, 114,  64, 137,  40, 246, 171, 248, 165, 102, // ...r@.(....f
+  92, 148, 102, 151,  22, 164, 251, 244, 104,  89, 147, 224, // ..f.....hY..
+ 145, 246,  21,  11, 185,  64, 140,  40, 224,  10,  23, 175, // .....@.(....
+  64,  80, 255, 206, 182, 113,  77,  63, 224, 109,   2,  14, // @P...qM?.m..
+  30, 172, 232, 198, 184,  38,  25,  32, 169, 166, 168, 221, // .....&. ....
+  93,  94, 237,  39,  25,  62, 166, 213, 126,  67, 176, 187, // ]^.'.>..~C..
+ 163, 184, 150, 112,  67, 129,  34, 167, 117,  25, 155,  44, // ...pC.".u..,
+ 118, 138, 169,  83, 145, 131,   0, 180, 140, 248, 121, 112, // v..S......yp
+ 154,  46, 151,  80,  16, 116, 248, 110,  26, 132,  32, 134, // ...P.t.n.. .
+ 156, 130,  91, 119,  39,  41, 117, 231, 102, 179,  59,  79, // ..[w')u.f.;O
+ 247, 132, 214, 220, 160, 175, 184, 203,  69,   3,   2, 170, // ........E...
+  76, 112, 173,  29, 243, 123, 253, 228,  10, 122,  74, 187, // Lp...{...zJ.
+  97, 194, 211,  86, 175, 127, 229,   1,  51,  52, 230, 165, // a..V....34..
+  70, 114,  26,  86, 114,  53,  34,  71,  52,  66, 157,  15, // Fr.Vr5"G4B..
+  13,  43,  64, 148,  82, 180,  19, 107,  92, 104, 168, 220, // .+@.R..k.h..
+  24,   0,  40, 196,  86, 212, 236,  92, 238,  53, 247,  68, // ..(.V....5.D
+ 118,  38, 247, 250, 110, 187, 115, 112, 116,   5, 158, 103, // v&..n.spt..g
+ 228,  57,  64, 231, 165, 220, 115, 225, 231, 179,  44,  61, // .9@...s...,=
+  48, 166, 204,  81,   7,  36, 135, 251, 180, 123, 161,  69, // 0..Q.$...{.E
+ 175,  33, 199, 127, 143, 164, 108, 225, 174,  35,  16,  71, // .!....l..#.G
+  65,  86, 107, 102, 241, 235, 123, 222,   0,  10, 147, 223, // AVkf..{.....
+ 118, 250, 117, 187, 117, 170,  28, 180, 144, 123, 188, 193, // v.u.u....{..
+ 182, 128, 219, 239, 213, 197, 118,  13, 170,  16, 237,  93, // ......v....]
+  17, 131,  75, 148,  32, 201, 207, 218, 225,   6, 200, 207, // ..K. .......
+ 241, 199,  56,  69, 205,  80, 171,  64, 128, 188,   1, 218, // ..8E.P.@....
+  63,  98, 212,   4,   3, 251,   4,  28, 141, 244, 133, 223, // ?b..........
+  11, 236, 163, 194, 121,  96, 156, 217, 165, 151,  61, 243, // ....y`....=.
+ 178,  51,  47,  59,  71, 181, 117,   1, 157, 185,  52, 250, // .3/;G.u...4.
+ 209, 111,  54,  20,  68,   9,  73, 165, 245, 161, 229, 102, // .o6.D.I....f
+ 118, 125, 182,  51, 179,  26,  81, 128,  89,  36, 184,  61, // v}.3..Q.Y$.=
+  34,   3, 109,  82, 124, 111, 251, 168, 157,  22, 113, 171, // ".mR|o....q.
+  82, 206,  82,  58, 183,  60,  31,  95, 255,  21,   8, 228, // R.R:.<._....
+ 221,  92, 235, 126, 222, 216,   0,  36, 227, 184,  88, 173, // ...~...$..X.
+  78,  78, 161, 147, 219, 155, 219,  17, 217,  57, 180,  52, // NN.......9.4
+ 217, 243, 203,  45, 245,  74,  43,  79, 217, 199, 141, 237, // ...-.J+O....
+  23,  76,  79,  34,  22, 199, 217, 147,  49, 113, 209, 123, // .LO"....1q.{
+ 198, 178, 151,  27,   4, 237,  97, 131, 214, 118, 254, 247, // ......a..v..
+ 180, 182, 243, 127,  65, 107, 191, 129, 166,  81, 147, 136, // ....Ak...Q..
+ 185,  50, 145, 109,  25,  34, 219,  90,  35, 178, 144, 254, // .2.m.".Z#...
+ 149, 172, 112, 254,  88, 100, 159, 138, 206, 109, 100, 135, // ..p.Xd...md.
+  30,  65, 115,  94,   9,  63, 156,  79, 125, 160, 217,  99, // .As^.?.O}..c
+ 232,  41,  72, 169, 125, 205,  86, 191,  17, 143,  57, 129, // .)H.}.V...9.
+ 199, 151, 251, 214,  67,  31,  32,  20, 165, 246, 183, 178, // ....C. .....
+   8, 217, 172,  36,   7, 237, 220, 143, 190, 197,  10, 129, // ...$........
+  75, 172,  87, 188,  93,  60,  54, 168, 101,  64, 192,  76, // K.W.]<6.e@.L
+  36,  94, 129,   6, 171, 197, 189,  22,  46, 243, 102, 205, // $^........f.
+ 107,  20,  70, 208,  19, 240, 227, 188, 132,  98, 118, 210, // k.F......bv.
+ 199, 253,  74,  87,   0,  10,  16, 250,  13, 118, 253, 102, // ..JW.....v.f
+ 175, 165, 112,  77, 138,  70, 224, 236, 217, 121, 201,  97, // ..pM.F...y.a
+  33, 203, 226, 248,  63,  87, 206, 169, 196, 196,  13,  44, // !...?W.....,
+ 115, 101, 110,  70, 103,  57,  71, 107,  48, 188,  63, 104, // senFg9Gk0.?h
+  43, 219,  19, 120,   8,  36,  23, 249, 230, 156, 175,  68, // +..x.$.....D
+  74, 190, 174, 169,  16, 225,  30,  72,  56, 132, 155, 239, // J......H8...
+ 228,  35,  26, 151, 203, 195,  71,  83,  17, 128,   6,  76, // .#....GS...L
+   5,   4,  33,  65,  20,  89,  51,  92, 110, 130, 111,  68, // ..!A.Y3.n.oD
+ 180,   0, 147, 197,  73,  64, 168, 244, 163, 145, 150, 222, // ....I@......
+   9,  93,  36, 199, 145, 204, 244,  69,  62, 150, 219, 243, // .]$....E>...
+ 166, 176, 245, 102,  95, 250,  42, 215,  30, 249, 176, 238, // ...f_.*.....
+ 227, 141, 122, 240, 148, 152, 135, 113,  70, 157,  75,  23, // ..z....qF.K.
+   3, 122,  35, 190,  73,  33, 230,  76, 222,  10, 196, 220, // .z#.I!.L....
+ 106, 140,  52,  41, 180, 233,  55, 147, 167,  25,  26, 122, // j.4)..7....z
+  64,  61, 194, 116,   5,  99,   7, 118, 152, 111, 244,  75, // @=.t.c.v.o.K
+ 101, 171, 107, 242, 105, 195, 126, 218,  77, 235, 117,  71, // e.k.i.~.M.uG
+   7, 246, 211,  43, 218,  55,  90, 120, 155, 155, 165, 129, // ...+.7Zx....
+ 204, 159,  47,  67, 219, 212,  35, 137, 251, 143, 202, 132, // ../C..#.....
+ 227, 215, 117,  90,  70,  91, 152, 226, 178, 106,   1, 184, // ..uZF[...j..
+ 214,  70,  74, 162,  52, 194, 101,  87, 158, 118, 150, 152, // .FJ.4.eW.v..
+  63,  80,  54, 208,  75,   7, 241,  61, 144, 245,   4, 113, // ?P6.K..=...q
+ 114, 193, 153,  18,  64,  30,  47, 193,  82, 134,  28,  16, // r...@./.R...
+ 244, 227,  38,  79,  56,  72, 165, 217, 171,  23, 244,  85, // ..&O8H.....U
+ 129, 219,  58,  80, 140,  55,  50, 184, 165,  12, 177,  73, // ..:P.72....I
+  54, 151, 126,  19, 229, 117,  49,   2,   7, 200, 235,  98, // 6.~..u1....b
+  10, 191,  36,  93, 139,   9, 184, 120,  15, 181, 152, 149, // ..$]...x....
+ 168, 240,  91,  52, 165, 230, 190,  31,  74, 203,  92, 195, // ..[4....J...
+  38, 160,  70,  47,   4,  17, 196,  88, 142, 102, 226,  26, // &.F/...X.f..
+ 173,  71,   2,  10,  19, 217, 119,  34, 251,  94, 100, 174, // .G....w".^d.
+ 200, 128,  34, 239,  59,  94,  57, 221,  53, 164,  28,  65, // ..".;^9.5..A
+ 202,   9, 164, 204, 126,  18,  25, 168,  14, 109, 145,  29, // ....~....m..
+ 138, 236, 160, 204,  57, 222, 151, 181,  55,  52, 180, 162, // ....9...74..
+ 137, 245,  61, 189,  74,  29, 141,  64, 146,  57, 175, 238, // ..=.J..@.9..
+ 193, 136, 183, 236, 193,  72,  96,  62,  34, 102,  22, 240, // .....H`>"f..
+  66, 194, 142, 143, 180,  34, 222, 231, 193, 238,  21, 111, // B....".....o
+  86, 140, 150, 184,  99, 148,  34, 123, 174, 215,  54, 252, // V...c."{..6.
+ 173,  31,  10, 218,  72, 218, 128,  48, 252, 133, 159, 231, // ....H..0....
+ 118,   7, 223,  33,  45, 237, 144, 204,  62, 108,  21, 145, // v..!-...>l..
+ 114, 188,  40, 137, 126, 109, 169,  81, 167, 151, 172,  15, // r.(.~m.Q....
+  22, 182, 137,  70, 170, 216, 138, 138, 187,  68,   3, 220, // ...F.....D..
+  10, 229,  25,  39, 204,  93, 168,  61,  96, 126, 219, 115, // ...'.].=`~.s
+ 217, 153, 232,  68,  28, 223,  42,  53, 236, 231, 178,  68, // ...D..*5...D
+  92, 200, 210, 140, 204, 172, 220, 139, 138, 245,  79,  76, // ..........OL
+ 141,  81, 112, 130,  67,  10, 141, 157, 223, 127, 162, 237, // .Qp.C.......
+  89, 183,  18, 198, 221, 167, 113, 207, 190, 247, 178,  86, // Y.....q....V
+ 215,  69,  47,  84,  78,  91, 213,  56, 194,   5,  29, 208, // .E/TN[.8....
+ 233, 217,  19,  25, 162, 157, 206, 241, 192, 133, 198, 221, // ............
+ 144, 133, 212,   7, 121, 109,  47, 236, 172,  63,   1,  17, // ....ym/..?..
+  16, 106,  26,  59, 184, 113, 238, 218,  30, 218,   1,   6, // .j.;.q......
+ 165, 128,  16, 115,   7, 207,   0, 112, 170,  89, 145, 234, // ...s...p.Y..
+ 142,  82, 209, 238, 216, 148, 186, 152, 210, 246,  48, 147, // .R........0.
+ 227, 130, 140, 232,  31, 129, 132, 182,  95, 129, 116, 107, // ........_.tk
+ 192, 119, 107,  95, 136, 129, 184, 115,   4,  58,  30,  10, // .wk_...s.:..
+ 199,  61, 228,  40, 191,   1, 158, 125,  91,   5,  18,  91, // .=.(...}[..[
+ 210, 105, 135,  61, 110, 219, 200,  15,  47,  59, 143,  65, // .i.=n.../;.A
+ 169,  34, 109,  91, 161,  37, 223, 204, 245,   0, 137,  81, // ."m[.%.....Q
+   6, 207, 247,  79, 148,  55, 138, 100, 221, 204,  32, 101, // ...O.7.d.. e
+  40, 113, 223,   4, 150, 139,  75, 150, 167, 180,  98, 169, // (q....K...b.
+ 133,  51, 116,  55, 210, 174,  58,   5, 113, 211,   7, 145, // .3t7..:.q...
+  63, 133, 246,  40,  17, 213,  19,  92,  18, 192, 212, 108, // ?..(.......l
+ 119,  90, 200, 176,  30,  67, 186,  69,  41,  93, 227,   0, // wZ...C.E)]..
+   6,  16,  82, 214, 221,  86,  46, 151,   5, 165,  14, 254, // ..R..V......
+ 240,  71, 122, 145, 110, 101, 222, 244, 133,  36,  92,  11, // .Gz.ne...$..
+ 189,   8, 234,  64, 202,   9, 122, 193, 162, 187,   0, 125, // ...@..z....}
+ 194, 236, 156, 198,  87, 109, 251,  11, 221, 240, 161,  92, // ....Wm......
+   0,   1,  90,  96, 151,  48,  31, 237,  94, 233, 214, 235, // ..Z`.0..^...
+ 139,  23, 184, 149, 183, 148, 186, 235,  96,  42, 178, 154, // ........`*..
+  83, 146,  70,  67, 151, 190, 158, 132, 207,   1,  39, 182, // S.FC......'.
+ 234,  15, 175, 112, 131, 232,  24, 168,  77, 111, 238,  97, // ...p....Mo.a
+ 192, 248,  10,  45, 196, 195,  70, 220, 157, 203, 224, 180, // ...-..F.....
+ 133, 219, 170, 166, 203, 229,  20, 244,  22, 157,  96, 170, // ..........`.
+  13, 167,  19,  57, 174,  67, 162,  83, 220,  35, 122,  26, // ...9.C.S.#z.
+  96, 186, 201, 114,  57, 193, 116,  35,  74,  55, 185, 114, // `..r9.t#J7.r
+  64,  15, 212, 106,  93,  31, 208, 190, 216, 194,  82,  86, // @..j].....RV
+ 228, 254,  89, 218, 173,  65,  27,  63, 213, 216, 163, 149, // ..Y..A.?....
+ 202, 159,  60, 224,  77, 234,  26,  36,  16,  85,  70, 164, // ..<.M..$.UF.
+ 223,  10, 182,  72, 201, 179, 239,  60,  32, 113,  33, 123, // ...H...< q!{
+  42,  72, 134, 143, 118,  55, 253, 100, 248,  57, 182, 139, // *H..v7.d.9..
+ 192, 149, 247,  84, 154,  16, 130,  99,   8,  78, 240, 105, // ...T...c.N.i
+ 240, 245, 226,  56,  33, 190, 218, 106, 202, 170, 148,  84, // ...8!..j...T
+ 138, 214, 197,  56, 249,  53,  50, 202, 112,  64,  64, 132, // ...8.52.p@@.
+  22, 112, 162,  22,  38, 198, 139,  10,  72, 255,  89, 244, // .p..&...H.Y.
+  74,  41,  96,  50, 167, 188, 149,  52, 216, 107,  11, 127, // J)`2...4.k..
+ 175,  77, 123, 215, 148, 189,  40, 252, 184,  27,  50, 174, // .M{...(...2.
+ 167, 120, 224,  59,  36, 103,   0,  89, 233,  91, 199,  29, // .x.;$g.Y.[..
+ 110,  69,  32, 120,  99, 250,  46, 116, 160,   9,  42,   5, // nE xc..t..*.
+ 232, 236,  41,  61, 151, 142, 143, 214, 225, 180, 163, 135, // ..)=........
+ 162,   9, 192, 223, 105,  65, 150, 123, 135, 134,  55,   6, // ....iA.{..7.
+  37,   0,  40, 251, 105,  91,  92,  72, 214, 230, 236, 251, // %.(.i[.H....
+  74,  28,  74, 213,  69, 190, 214, 182,  56, 157, 207, 149, // J.J.E...8...
+  48, 186,  45, 232,  99,  27,  29,  46,  56,  58, 114, 235, // 0.-.c...8:r.
+ 104, 149, 199,  19, 248, 218,  19, 137, 194, 252, 184,   9, // h...........
+  36, 218, 151, 107, 243, 147, 146,  13, 212, 239, 129,  74, // $..k.......J
+ 206,  22, 137, 233,  90,  30,  13,  89,  14, 254,  66,  22, // ....Z..Y..B.
+ 131,  52,   1, 214,  82,  18, 222, 142, 237, 124,  81, 162, // .4..R....|Q.
+ 220,  50,  96,  10, 232, 133, 108,  27,  44,  65,  76,  12, // .2`...l.,AL.
+  83,  64,  46, 255, 168,  57, 130, 119, 107, 228, 242, 135, // S@...9.wk...
+  21, 144,  62, 186, 223,   2, 153, 128,  61, 147,  32,   0, // ..>.....=. .
+  92, 203, 172,   3,  56,   3, 238, 159, 208, 125, 200,  19, // ....8....}..
+ 243,  30,  45,  17,  15,  44, 117, 240,  10, 232,  64, 130, // ..-..,u...@.
+  31, 149, 166, 134,  14, 118, 246, 218,  16,  67,  91, 161, // .....v...C[.
+ 219, 207,   7, 152, 164,  76, 223, 197,  77, 217, 243,  72, // .....L..M..H
+ 246, 199, 115, 178,  62, 158, 105,  75, 225,  51, 161,  47, // ..s.>.iK.3./
+  21, 187,  68,  69,   0,  37, 173, 110, 230, 218,  55, 226, // ..DE.%.n..7.
+ 188, 113,  39, 206, 224, 239,  89, 189, 253, 252,  78,  92, // .q'...Y...N.
+ 226, 151, 219, 244, 153,  46, 202, 200, 183,  54, 250,  32, // .........6. 
+  53, 152,  89, 124,  75, 204,  73,  21, 204,  41, 132,  32, // 5.Y|K.I..). 
+  80, 156,  49, 104,   1,  34, 204,   8, 212, 210,  25,  48, // P.1h.".....0
+ 149, 172,  62,  64,  11, 199,  53,  58,   1, 134,   3, 209, // ..>@..5:....
+  18, 237, 231, 255,   4,  92,  69, 178, 152,  56,   9, 238, // ......E..8..
+ 135, 126, 237,  15, 167, 246, 103, 167,  32, 129,  76, 246, // .~....g. .L.
+  35,  60, 159, 194,  98, 203, 231, 226, 252, 211, 163,  86, // #<..b......V
+  47, 239,  79,  91, 189,  11, 150, 214, 201, 184, 125, 193, // /.O[......}.
+ 250, 193,  13,  61, 146, 148, 122, 157,  85, 133, 145, 157, // ...=..z.U...
+ 148, 246, 125, 173,  33,  71, 180, 131,  23, 114, 216,   9, // ..}.!G...r..
+ 157, 176,   8, 232, 107, 158,  78,  23,   9, 197,   5, 244, // ....k.N.....
+ 229, 192, 216,  60, 172,  30, 228,  19, 238,  72,  66, 241, // ...<.....HB.
+ 217, 247,   0,   2,  69, 174,  86, 201, 212,  17, 102,   5, // ....E.V...f.
+ 225,   3,  33, 173, 215, 244, 195,  96,  66, 202, 156, 200, // ..!....`B...
+  53,  43,  35, 113,  51, 166, 161, 199,  78, 254,  12, 211, // 5+#q3...N...
+ 110,  65,  30,  51, 226, 199,   3, 142,  18, 142, 135, 202, // nA.3........
+   7, 227, 158, 131, 112, 241, 198,  12,  70,   5,   9, 191, // ....p...F...
+  71, 196,  59,  98,  36, 196, 171,  71,  66, 197,   3,  62, // G.;b$..GB..>
+ 128,  52,  70, 110,  73,  11, 185,   5, 112, 206, 128, 189, // .4FnI...p...
+ 132,  98,   4, 246, 170, 102, 134,  15,  22, 143, 216,  69, // .b...f.....E
+ 138,  42,  15,  15,  13, 136, 187,   2, 108, 189, 211, 235, // .*......l...
+  98,   2, 144,  78, 156, 137, 103,  18,  20, 189,  75,  60, // b..N..g...K<
+ 122,  32,  62, 203,   7, 192,  39,  96,  33,   3,  60,  15, // z >...'`!.<.
+  15, 220, 236, 119, 249, 214, 246, 105, 156, 234,   3,  71, // ...w...i...G
+ 188, 206, 125,  13, 247,  57, 248,  63,  82, 242, 223,  33, // ..}..9.?R..!
+ 221,  75, 114, 189,   6, 215,  55, 116, 164,  56,  71,  31, // .Kr...7t.8G.
+  83,  22, 200,  13,  56, 166,  26, 151, 228, 192,  12, 199, // S...8.......
+   3, 225,  47,  34,  46,  34, 109,  55, 147, 242, 115,  79, // ../"."m7..sO
+ 159, 165, 235, 217, 231, 242,  30, 111, 239, 120,  38, 249, // .......o.x&.
+ 168,   4,  97, 178,  56, 119,  96, 142, 157,  99,  40,  80, // ..a.8w`..c(P
+ 247, 115, 241, 204, 129, 182, 171,  12,  92, 151, 142, 163, // .s..........
+ 237,  35, 116, 236, 232,  27,  92,  43, 243, 236, 103, 250, // .#t....+..g.
+ 156,   5, 226, 254, 103, 241,  76,  92,  98, 175,  29, 113, // ....g.L.b..q
+  38,  63, 231, 135, 246, 122, 166, 100, 170,  14,  75, 190, // &?...z.d..K.
+ 148,  88,   5, 100,  46,  64, 179,  94, 178,   3, 192,   2, // .X.d.@.^....
+ 202, 171, 139, 135, 159, 203, 221, 221, 179,  29, 249, 121, // ...........y
+ 119, 183,  90,  19, 142, 104, 255, 149, 248,   4,  26, 219, // w.Z..h......
+ 123,  58,  78,  87, 108,  82,  78, 154, 188, 180, 211, 218, // {:NWlRN.....
+ 145, 175,  12,  60, 238,  40, 172,  44,  48,  94, 224, 154, // ...<.(.,0^..
+ 245, 189, 205, 137,  63, 199, 132, 154,   9, 201, 151,   9, // ....?.......
+ 157,  61, 120,  69, 115,  60,  19,  47, 113, 170, 160, 227, // .=xEs<./q...
+  35, 114,  80,  60, 175, 158,  52, 141, 205, 130,  75,  95, // #rP<..4...K_
+ 224, 197,  52, 223, 236, 238,  46,  88, 174, 104,  54, 155, // ..4....X.h6.
+  32, 121,  33, 138, 227, 136,  14,  64, 242,  68, 157, 242, //  y!....@.D..
+ 174, 137,  56,  35,  23, 208,  58, 116, 228, 138, 232,   2, // ..8#..:t....
+ 163,  16, 197,  36, 200, 163,  11,  65, 120, 153, 207,   9, // ...$...Ax...
+  35, 156,  64,  79,  62,   1, 128, 238,  72,  13,  66, 173, // #.@O>...H.B.
+ 239,  83, 175,  79,  50,  62, 151, 113,  33,  16, 141,  43, // .S.O2>.q!..+
+   1, 174, 115, 229,  85,   2,  62,  97,  27, 202,  84, 131, // ..s.U.>a..T.
+  87,  98,  11, 106,   1, 240, 230,  29, 252,  70, 124, 117, // Wb.j.....F|u
+ 243,  61, 237, 116, 232, 180, 208, 187,  65,   0, 192,  67, // .=.t....A..C
+  21, 170, 170, 119,  67,  86,  94,  47, 218,  65, 169,  46, // ...wCV^/.A..
+ 189,  42, 157,  75, 245, 139,  77, 245,  10,  98,  26, 170, // .*.K..M..b..
+ 239, 131, 192, 182,  56, 205, 232, 252,  26,  30, 151, 255, // ....8.......
+ 205,  14,  41,  74, 115, 165,   6, 250, 124, 227,   3,  90, // ..)Js...|..Z
+ 228, 203, 116, 181,  69, 194,  13, 163, 109,  10, 152,  22, // ..t.E...m...
+ 108, 161, 250, 246, 105, 178, 113, 215,  76,  69, 152,  71, // l...i.q.LE.G
+ 129,  28, 134,  74, 241,  93,  92,  32, 148, 227, 145, 161, // ...J.]. ....
+ 196, 137,  40, 204, 229, 251, 185, 152, 116, 107,  49, 158, // ..(.....tk1.
+ 119, 136,  39, 136,  59, 218, 217, 160, 205,  54,  37,  79, // w.'.;....6%O
+  90, 242, 148, 246,  95, 183, 186,  16, 160, 183,  94, 251, // Z..._.....^.
+ 253, 240,  10,  55,  94, 215, 221,  43,  58, 221,  40, 208, // ...7^..+:.(.
+ 176,   4,  42,   2,   5,  40,  12, 136,  48,   0, 147, 237, // ..*..(..0...
+  97,  84,  23, 149,   4,  25, 161, 201, 188,  68,   2, 168, // aT.......D..
+  64, 102,  33,  64, 209, 232, 232,   1, 109,   8,  65,  87, // @f!@....m.AW
+   3, 207,  68, 240, 239,  41, 140,   8, 198,   1,  75,   9, // ..D..)....K.
+ 209, 194, 209, 242, 108, 250, 197, 203,  58,  40,  65,  29, // ....l...:(A.
+  47, 251, 116, 246, 108, 224, 187, 232, 170, 115, 168, 179, // /.t.l....s..
+ 199, 217, 235,  54,   5,  82, 156,   9,   6,  56,   5, 233, // ...6.R...8..
+ 155,  32,  10,  50,  69, 101, 225, 229, 105,  92,  54, 174, // . .2Ee..i.6.
+  75, 244, 161,  93, 216, 218, 164, 209, 190, 170, 108, 161, // K..]......l.
+ 199, 246, 242, 238, 249, 152,   0,  28,  97,  93, 209, 213, // ........a]..
+  94,  71, 224, 233, 206,  58, 110, 118, 127, 174,   3,  32, // ^G...:nv... 
+  18,  97,  81,  68, 163,  47, 164, 159, 106,  18,  29,  87, // .aQD./..j..W
+ 210, 127,   8, 220,  49, 141, 242, 165, 202,  74, 220,  42, // ....1....J.*
+ 177,  11, 243, 145, 170, 197,  99,  72, 229, 128, 130, 254, // ......cH....
+  16,  13,  63, 161, 148,  12, 196,   7,  15,  44, 218, 223, // ..?......,..
+ 216,  86, 162,  80,  50, 177,  96, 242, 134,   9, 158,  67, // .V.P2.`....C
+ 180, 210,  97,  18, 135,  33,   7, 160,  81,  16, 194, 110, // ..a..!..Q..n
+ 193,  67, 123,  48, 194,  25,  50,  43,  92, 123, 149, 106, // .C{0..2+.{.j
+ 165, 215, 101, 194,  64, 226, 213,   7,  34, 244,  37, 202, // ..e.@...".%.
+  93, 165,  70, 164, 235, 134, 104,  59, 234, 245,   9, 255, // ].F...h;....
+  16, 225, 174, 242,  29, 157, 249, 182, 107, 199, 163, 232, // ........k...
+ 141,  24,  60, 166, 100, 150,  47, 112,  45,  35, 196, 131, // ..<.d./p-#..
+  74,  17, 201, 177, 229,  89, 190, 216,  60, 119,  72, 230, // J....Y..<wH.
+  62,  82,  96, 129, 195,  85,  52, 153, 112, 184, 190, 203, // >R`..U4.p...
+  69, 219, 197, 213, 153, 215, 135, 240, 146, 237,  35,  28, // E.........#.
+  63, 157, 148,  37, 202, 166, 139, 144,  42, 229, 152,  63, // ?..%....*..?
+  97, 131, 167,  60,  95,  41,  79, 110,  47, 137, 120, 113, // a..<_)On/.xq
+ 108, 167, 188, 174,  16, 142, 254, 168, 128, 119, 127, 161, // l........w..
+ 128, 169, 109, 140,  75,  34,  50, 123,  80, 241, 178, 192, // ..m.K"2{P...
+ 252,  74,  50, 251,  95, 163, 186,  51, 191, 223,  19,  80, // .J2._..3...P
+  24, 138,  44, 118,  40, 127, 178, 237,  72, 214,  99, 231, // ..,v(...H.c.
+ 185, 114,  28,  58, 215, 238,  96,  11, 202, 144, 152,  96, // .r.:..`....`
+ 169,  89,  19, 141, 212, 187, 187, 253, 172, 137, 182, 123, // .Y.........{
+ 145,  53, 115, 139, 255,  85,  46,   6, 150, 246,  76, 221, // .5s..U....L.
+ 219,  89, 191, 125,   5,  18,  47,  16,   9, 186, 196,  15, // .Y.}../.....
+  63,  69,  67, 250, 173, 198,  73, 243, 170, 142,  77,   9, // ?EC...I...M.
+ 117, 173,  25, 109,  27, 169, 144, 112, 100,  75,  11, 113, // u..m...pdK.q
+ 237, 208, 110, 237,   7, 194,  60,  16, 113, 129,  83, 189, // ..n...<.q.S.
+  20, 111, 197,  23, 241,  70, 124,  16,  63, 139, 111, 197, // .o...F|.?.o.
+ 119,  66,  69, 120,  90, 142, 207, 177, 190, 183,  51,  54, // wBExZ.....36
+  98,   2, 104,   4, 158,  68,  75, 200,  91, 218, 210,  59, // b.h..DK.[..;
+ 171, 236,  96,  66, 179,  87, 166,  13,  79,  10, 248,  36, // ..`B.W..O..$
+ 208,  17, 229, 225,  61,  27, 254,  12,  70,  52, 193,  67, // ....=...F4.C
+ 246, 196,  54,  51,  98, 155, 116,  89,  35,  32, 237, 126, // ..63b.tY# .~
+  41,  19, 237, 157, 226,  37,  66, 188, 231, 176, 145,  53, // )....%B....5
+ 175,  33,   3, 153, 213, 175, 241, 180, 174, 246, 175, 159, // .!..........
+  61, 171, 156, 192, 158,  85, 182,  99,  71, 245, 240,  57, // =....U.cG..9
+  29, 192, 206, 216, 112, 215, 136, 189, 216, 249, 163, 131, // ....p.......
+  95, 127, 156,  63, 246, 160, 132, 114, 254, 203,  13,  76, // _..?...r...L
+ 195, 249,  66,  50,  99, 169, 109,  94, 169, 158,  21, 128, // ..B2c.m^....
+  49, 183, 159,  74, 245,  32,  74, 126, 220, 224, 221, 213, // 1..J. J~....
+ 103, 154,  64, 138, 131, 152,  52, 243, 179,   5, 154, 176, // g.@...4.....
+  41, 244,  19, 142,  65,  18, 199, 153, 124, 102,  91, 120, // )...A...|f[x
+ 221, 123, 102,  57,  93, 125,  19,  66,  51,  24, 225, 209, // .{f9]}.B3...
+ 232,  79, 240,  75,  30,  80, 139, 192,  39,  50, 190, 166, // .O.K.P..'2..
+   1,  55, 130, 208,  45,  42, 144,   6, 243,  54, 200,  99, // .7..-*...6.c
+   9, 245, 201, 105, 226,  37,  81, 103, 128, 126,  42,  66, // ...i.%Qg.~*B
+  20, 167,   8,  38,  78, 234, 173,  60, 179, 173, 161,  31, // ...&N..<....
+ 221, 250,  41, 224, 149, 250, 138, 213,  15, 179, 123,  60, // ..).......{<
+ 133,  50,  81, 156, 231,  62, 179, 173, 246,   8,  99, 223, // .2Q..>....c.
+  81, 163,  26, 248, 116,   9, 149, 219,   5, 114, 168,  47, // Q...t....r./
+ 189,  80, 239, 132,  34,   5, 148, 119,  74,   1, 231,  81, // .P.."..wJ..Q
+  95, 208, 164, 154, 129, 240, 119,  12, 236,   7, 133, 192, // _.....w.....
+  19, 103, 119,  55,  26, 235,  91,  89,  16,  91,   0, 233, // .gw7..[Y.[..
+ 118, 244,  53, 135, 120, 212,  37, 105, 226, 145, 161, 132, // v.5.x.%i....
+  43,  33,  39, 150,  11,  60, 247,  93, 211, 255, 255, 219, // +!'..<.]....
+ 123, 243, 197, 182, 113, 100,  95, 248, 255, 126,  10, 153, // {...qd_..~..
+ 227, 201, 144,  49, 100,  75, 118, 156, 164, 169, 166, 117, // ...1dKv....u
+ 179,  39, 221, 217,  58, 206, 218, 142,  63,  71, 150,  40, // .'..:...?G.(
+  91,   9,  77, 170,  41, 202,  75, 108, 189, 203,  60, 203, // [.M.).Kl..<.
+  60, 217,  87, 191,  42,   0,   4, 181, 216, 206, 156, 115, // <.W.*......s
+ 207, 237, 115, 238, 157,  76,  91,  36,   0,  98,  45,  20, // ..s..L[$.b-.
+ 170,  10, 181,  12, 135, 113, 218, 123,   0, 239, 187, 126, // .....q.{...~
+ 252,  84, 127, 242,  14, 159, 136,  55,  22, 124, 129,  39, // .T.....7.|.'
+ 254,  64, 197, 143, 163, 149, 151,  62, 204,  20, 238, 193, // .@.....>....
+ 136, 152, 112, 242,  61, 112,  35, 208, 133, 141, 191,  70, // ..p.=p#....F
+ 144, 233,  60,  14,  90,  62, 174,   3, 198,   7, 131, 116, // ..<.Z>.....t
+ 116, 113, 177, 179,  27, 216, 141,  41, 195, 200, 134, 197, // tq.....)....
+ 136, 221, 135, 202,  35, 186,  11, 151,  25,  68, 142, 234, // ....#....D..
+ 198,  95, 193,  11,  40, 125,  10,  61,  78, 214, 233,  55, // ._..(}.=N..7
+ 226, 100, 208, 227, 113, 191,  77, 216, 221, 220,  20, 161, // .d..q.M.....
+ 126,  85, 208, 126, 120,  10,  28,  20, 250, 103, 145, 147, // ~U.~x....g..
+  35, 166, 123, 103, 174, 163,  61, 198, 199,  72,  15, 245, // #.{g..=..H..
+ 117, 204,  27, 197, 238,   1, 226,  39, 104,   5,  23, 168, // u......'h...
+  17, 215, 142,  39, 169, 155, 232, 202, 123, 124,  22, 193, // ...'....{|..
+ 128,  64, 203, 144,  71, 108,  54, 246,  27, 222,  89,  98, // .@..Gl6...Yb
+  14,  78,  24, 191, 248, 162,   5,   3, 130, 202, 120, 153, // .N........x.
+  36, 134, 133, 133,  38, 152, 197, 127,  20, 252, 119, 230, // $...&.....w.
+  44, 116, 167,  95,  80, 150, 102, 244,  31,  65, 121, 210, // ,t._P.f..Ay.
+  40, 227,  79, 144,  93,  79, 221,  81, 132, 148, 106, 158, // (.O.]O.Q..j.
+  97, 127, 112, 142, 142, 134, 142,  91, 151, 138, 136, 244, // a.p....[....
+ 201, 124,  25, 233,  19,  45,  36,  93,  74,  24, 155,  94, // .|...-$]J..^
+  92,  44,  65,  61, 139, 158,   2,  56,  34,  25, 164,  99, // .,A=...8"..c
+ 177,  40, 101, 178, 144,  85, 224,   8, 139,  17,  69, 253, // .(e..U....E.
+ 247, 117, 213, 141,  74, 205,  69, 172, 154, 234,  67,  92, // .u..J.E...C.
+ 150,  95,  92, 108,  64, 122,  92, 111, 134, 108, 196, 152, // ._.l@z.o.l..
+   8,  82,  54, 228,  40, 161, 118, 170,  63,  25, 102, 163, // .R6.(.v.?.f.
+  21, 157,  67,  68, 253, 205,  62,  80, 125,  43, 121, 101, // ..CD..>P}+ye
+  74,   3, 133, 179,  55,  78, 229, 117, 181,  39, 152, 117, // J...7N.u.'.u
+ 214, 227,  44, 178, 161,   7, 251, 236, 248, 143,  85,   4, // ..,.......U.
+ 225, 241, 217, 169, 231, 184,  77, 199,   5, 124, 166,  81, // ......M..|.Q
+ 106, 233,  74, 164,  80,  31, 253, 162, 185,  82, 108, 172, // j.J.P....Rl.
+ 173,   7, 252, 129, 118,  15, 231,  75, 247, 126,  11, 127, // ....v..K.~..
+ 131, 239,  11,   2, 147, 148,  58,  85,  52,  86, 138, 117, // ......:U4V.u
+   8, 214, 178, 168, 224, 194, 204, 161,  96,  75, 234,  30, // ........`K..
+  49, 185, 203, 181, 196, 163,   2, 222,  80, 248, 194, 154, // 1.......P...
+ 229, 153,  17,  20, 219, 192,  56,  99, 184,  48,  37, 175, // ......8c.0%.
+ 206, 220,  97,  20, 191, 223,  73, 204, 205, 208,  65, 196, // ..a...I...A.
+ 210, 190,  98,  61,  44,  54, 212, 145, 126, 105, 132,  69, // ..b=,6..~i.E
+ 147, 152, 230, 143, 212,  24,  49,  42,  52,  21, 196, 142, // ......1*4...
+  99,  21,  96, 110,  59,  34, 118, 156, 198, 126, 168,  17, // c.`n;"v..~..
+ 187, 245, 130, 151, 124,   0,  17,  24,  30,  19, 107, 238, // ....|.....k.
+ 100,  83, 234,  49, 104, 154,  58,  63,  16,   9,  19,  14, // dS.1h.:?....
+ 213,  62, 213, 197, 215, 221, 196, 117,  39, 171, 114, 223, // .>.....u'.r.
+  77, 172, 243,  62, 175, 119, 251, 163, 191, 207,  50,  33, // M..>.w....2!
+ 106,  53, 108,  16,  59,  90, 199, 250, 200,  84, 221, 164, // j5l.;Z...T..
+  25, 106, 222, 109,  16,  51,  25, 127,  69,  42,  45,  26, // .j.m.3..E*-.
+ 250, 246,  32, 122, 190, 226, 191,  88, 217,  11, 110, 246, // .. z...X..n.
+  91, 153, 140, 224,   1, 107, 232,  55, 205,  35,  47, 100, // [....k.7.#/d
+ 223, 174,  33, 165,  39,  34, 167, 104, 119, 112, 181,  99, // ..!.'".hwp.c
+  94,  70, 225,  55,  58, 216,  58,  97,  99, 235,  27,  61, // ^F.7:.:ac..=
+ 115,  69, 102, 185,  67,  94, 164,  81, 216,  81, 223,  46, // sEf.C^.Q.Q..
+  46, 184,  94, 239, 104, 208, 235,  17, 158,  13,  43, 128, // ..^.h.....+.
+ 192,  51, 188,  28, 233, 214, 136,  80,  77,  86, 245, 245, // .3.....PMV..
+  61, 241, 186, 118, 174, 168, 251, 124, 188, 224, 194, 236, // =..v...|....
+  40,  96, 126, 151, 134,  35, 119, 197, 149, 203, 173, 183, // (`~..#w.....
+ 115,  46, 183, 138, 232,  45, 216, 121, 215, 227, 143,   8, // s....-.y....
+ 108, 163, 109,  24,  22, 103, 252, 163, 173, 174, 113, 188, // l.m..g....q.
+  17,  46, 243, 188, 149,  34,  88,  29,  16, 102,  61, 125, // ....."X..f=}
+ 213, 247,  97, 202,  19, 180, 113,  69,  89, 104,  11, 234, // ..a...qEYh..
+ 181, 207, 233, 218, 193,  81, 245,  94,  45, 153, 219,  52, // .....Q.^-..4
+  40, 252, 214, 183, 182,  95, 194, 123,   5, 198,   9,  40, // (...._.{...(
+  87, 226, 155, 203,  46, 120, 127, 171, 130, 111,   1, 237, // W....x...o..
+ 190,  42, 224, 210,  25,  90,  41,  96,  42, 153,  76,  38, // .*...Z)`*.L&
+ 251, 154, 162,  74, 126, 247, 183, 213, 190, 181,  11, 202, // ...J~.......
+ 193,  80,  19, 127, 124,  26,  16, 233, 147, 171, 231, 196, // .P..|.......
+ 219,  18,  49, 181,  95, 145,  45,  86,  81, 193, 254,  42, // ..1._.-VQ..*
+ 148, 141, 233, 167, 219,  25, 202,  34, 125, 135, 118, 121, // ......."}.vy
+  62, 232, 181, 190, 187, 109, 124, 159, 223,   6,  79, 240, // >....m|...O.
+ 122, 216, 148,   7, 220, 249,  52, 244, 227,   6, 174, 127, // z.....4.....
+ 168, 241, 239, 110, 227, 223, 171, 141, 127, 151, 198, 191, // ...n........
+ 115, 227, 196, 234, 219, 246, 118, 158, 239,  66, 227,  91, // s.....v..B.[
+ 173,  96, 155, 142,   3, 169, 178,  25, 174,  11,  18, 145, // .`..........
+ 102, 154, 149, 102,  78, 220, 102,  78, 170, 205, 156,  72, // f..fN.fN...H
+  51,  39, 220, 204,  36, 125, 230, 123, 189, 188, 115, 114, // 3'..$}.{..sr
+ 143, 112, 176,  71,   7, 174,  28,  60,  46,  54,  78,  30, // .p.G...<.6N.
+ 224,  30, 201, 143,  63, 217,  35, 193, 104, 155, 194,  28, // ....?.#.h...
+  25, 121, 177, 238, 170, 159, 188, 167, 117, 129,  39, 123, // .y......u.'{
+ 121, 104,   4,  90, 102,  19, 211,  38,  36,  46, 122,   4, // yh.Zf..&$.z.
+ 203, 233, 103, 208, 186, 102, 173,  13,  84, 250, 199, 234, // ..g..f..T...
+  65, 146, 237, 119, 146, 123,  72, 136, 146, 103,  38, 207, // A..w.{H..g&.
+ 184, 210, 150,  99, 100, 167, 161, 198,   4, 136,  56,  53, // ...cd.....85
+ 172, 137,  65,  56, 235,  45,  62,  30, 251, 201, 114, 157, // ..A8.->...r.
+ 102,  95,  37,  15, 192,  94,  39, 156, 178, 189,  98,  83, // f_%..^'...bS
+ 180,  95,  33, 233,  19,  85, 120, 227,   6, 245, 191,  21, // ._!..Ux.....
+  20, 245, 122,  53,  39, 161,  28, 124,  64,  60, 120,  64, // ..z5'..|@<x@
+  76, 184, 165, 255, 193, 214, 248, 232,   9,  17,  29, 122, // L..........z
+  72, 184, 254, 196,  47,  79, 174,  74, 216, 175,  32,  36, // H.../O.J.. $
+   1, 170,  73,  20, 205, 179, 185,  67, 164,  99,  18, 186, // ..I....C.c..
+  48,  87, 205, 231, 245, 231, 202, 104,  38, 232,  46,  81, // 0W.....h&..Q
+ 223, 127, 147, 117, 104, 233, 211, 178, 154, 223,  54,  15, // ...uh.....6.
+ 171, 165, 108,  18, 234,  10,  70,  91, 133, 218, 214, 163, // ..l...F[....
+  89,  86, 201,  54, 164, 214,  89, 153,  91, 194,  61, 118, // YV.6..Y.[.=v
+  96,  66, 116,  82, 122, 113, 145, 137, 143,  43,  93, 164, // `BtRzq...+].
+ 156,  24, 121, 119, 231, 135, 107, 164,  19,  73, 122, 216, // ..yw..k..Iz.
+  32, 254, 243, 178, 121,  82,   6,  58, 183,  25,  42,  61, //  ...yR.:..*=
+  92, 180, 176,  11,  62, 216,  42,  18, 133, 131, 172,  87, // ....>.*....W
+  56,  23, 136, 104, 241,  64,  69, 120, 202,  19,   0, 246, // 8..h.@Ex....
+ 118,  75, 247, 208, 191, 227, 196, 113, 120, 150, 166,  95, // vK.....qx.._
+ 250,  38, 120, 239, 224,  72, 194, 240,  70, 119,   3, 180, // .&x..H..Fw..
+  25,  19,  73,  23,  23, 241, 183, 128, 165,  37, 241, 183, // ..I......%..
+  18, 151, 166, 171, 253,  60,  59,  10, 168,  38, 253, 164, // .....<;..&..
+ 184,  34, 173,  30,  67, 207, 146,  12, 169, 148, 104, 186, // ."..C.....h.
+  76, 180, 100, 200, 215,  77, 154, 146,   4, 108,  31, 219, // L.d..M...l..
+ 197, 179, 176, 248,  64, 124,  65,   0, 126,  40, 146, 211, // ....@|A.~(..
+ 183, 224, 195, 239,  40, 102, 211,  24,  14, 113,   1,  77, // ....(f...q.M
+ 192, 101, 220,  93,  83,  47, 252, 152,  86, 243,  35, 251, // .e.]S/..V.#.
+ 107, 138, 251,  55, 110,  44, 193, 229, 154, 159, 131, 158, // k..7n,......
+ 230,  97,  64, 193, 200,  88,   0,  65, 227,  40,  96, 117, // .a@..X.A.(`u
+ 208, 115, 163, 222,  35,   5, 218,  31,  66,  97, 242, 154, // .s..#...Ba..
+  10, 110, 122,  66, 164, 137, 151,  34, 209,  79,  50,  58, // .nzB...".O2:
+  64,  82, 197, 108, 233, 166,  45, 141, 123, 103, 234,  29, // @R.l..-.{g..
+ 246, 253,  18, 117,  34, 254, 206, 250, 163, 250, 206,  58, // ...u"......:
+ 163, 179, 214,  55,  74, 148, 198,  40, 137,  25, 127, 208, // ...7J..(....
+  38,  68, 226, 235, 225, 129, 184, 204, 160,  27, 212,  78, // &D.........N
+ 186, 161, 204, 203,   6, 142,  92,  77,  31,  12, 193,  37, // .......M...%
+ 218, 183,  94,  72, 133,  46, 205, 134,  78,   0, 157, 215, // ..^H....N...
+ 227,  34,  67, 197, 232, 150, 188,  33, 149, 217,  81,  36, // ."C....!..Q$
+ 235,  71,  34, 219, 255,  64,  58,  56,  75,  28, 176,  52, // .G"..@:8K..4
+ 114, 237, 138, 116,  82, 202, 128,   6,  12,  56,  30, 184, // r..tR....8..
+ 107, 252, 158, 121,  76, 194,  97, 246, 157, 141, 204, 180, // k..yL.a.....
+ 114, 211, 215, 146, 133,   0, 187, 252, 201,  37, 153,   6, // r........%..
+ 200,   2,   6,  73, 161, 156, 215,  25,  64,  62, 238, 194, // ...I....@>..
+ 206,  54,  94, 151,  17, 225, 206, 130, 158, 249, 210, 130, // .6^.........
+  89,  58, 226, 102,  14, 191, 123, 236,  13, 232,  12, 178, // Y:.f..{.....
+ 247,  23,  68,  14, 154, 140, 227,  66,  50,  94,  32, 227, // ..D....B2^ .
+  76, 215, 122, 155, 149, 179,  42, 131, 121, 111, 177,  38, // L.z...*.yo.&
+ 239,   1,  45,  30,   1, 123, 110, 110, 220, 153,  75, 167, // ..-..{nn..K.
+  37, 137, 111,   3,  98,  25, 124, 132, 125,   7, 104, 112, // %.o.b.|.}.hp
+ 230,  68, 248, 121,  41, 201, 115, 166, 221,  20, 220,   2, // .D.y).s.....
+  27, 249,  29,  70,  79, 248, 158,  22, 190,  52,  97, 140, // ...FO....4a.
+ 215, 226,  87, 204, 173, 108, 194, 140, 236, 168, 144,  66, // ..W..l.....B
+ 241,  75,  21, 223, 101, 214, 232,  85,  27, 150,  82, 183, // .K..e..U..R.
+ 130, 176,  72, 241, 163, 138,  65,   4, 227, 180,  91, 170, // ..H...A...[.
+ 200, 124, 201, 143, 239, 132,  69,  66, 223,  67, 253, 106, // .|....EB.C.j
+  28, 193, 136, 234,  22, 189, 249, 218, 164, 185, 126, 254, // ..........~.
+ 226,   5, 253, 121, 248, 112,  82,  51, 198, 201, 108, 174, // ...y.pR3..l.
+ 140, 210,  93,  40,  52,  20,  44, 199,  72, 226,   3, 226, // ..](4.,.H...
+  24, 141,  66, 219,   8,  66,  24,  78,   9,  96, 115,  80, // ..B..B.N.`sP
+ 244,  25,  11, 194, 158, 128,  30, 181, 221,  84, 139,  30, // .........T..
+ 161, 140,  23,  21,  93, 202, 144,   3,  22,  80, 100, 158, // ....]....Pd.
+   3, 164, 226, 104, 213, 137, 120, 228,  52,  29, 230,  72, // ...h..x.4..H
+  82, 229, 133, 211,  13,  79, 165,  31, 181,  65, 215,   1, // R....O...A..
+ 172,  18, 208, 205,  61, 254, 123,  76, 251,  74,  21, 207, // ....=.{L.J..
+ 177, 126,  56,  30, 250, 171, 176, 242,  50, 155, 139, 217, // .~8.....2...
+  43, 205, 100,  57,  42, 132,  85,  31,  29, 197,   1, 109, // +.d9*.U....m
+ 192,  99, 115,   6,   4, 109, 166,   3, 232,  72,  12, 194, // .cs..m...H..
+ 243, 189, 176,  49,   9, 138, 231, 240, 211,   1, 221,  86, // ...1.......V
+  92,  89,  20,  61, 136, 231,  95, 131, 237,  47, 224, 219, // .Y.=.._../..
+ 212,   3,  76, 201, 212,  48,  79, 175,  88,  34,  80, 192, // ..L..0O.X"P.
+  53, 173,  39,  70, 185, 175, 105,  48,  52,  73, 176,  52, // 5.'F..i04I.4
+  67, 205, 120,  61,  14, 206, 239, 113, 177, 195, 184, 211, // C.x=...q....
+  51, 197, 148, 225, 203,  57,  39, 215, 201, 247, 228,  80, // 3....9'....P
+ 102,  31,   2,  15, 208,  93, 254,  76, 103,  98, 158,  14, // f....].Lgb..
+   2, 147,  66, 175,  85,  73, 197,   3,  49, 177, 124, 225, // ..B.UI..1.|.
+ 191,  70,  39,   7,  41,  72, 104, 143, 123, 131,  73, 130, // .F'.)Hh.{.I.
+  99,  72, 206, 192, 139, 167, 103, 119, 217, 234, 178,  78, // cH....gw...N
+ 160, 231, 109, 141,  62, 160, 237,  61, 227,  75, 168, 184, // ..m.>..=.K..
+  95,  49, 250,  18, 241,  80, 241, 150,  85, 228, 193, 237, // _1...P..U...
+ 159,   3, 237,  37, 196, 155,  16, 201,  76,  91,  68,  31, // ...%....L[D.
+ 113, 236, 244, 142, 133, 195, 248,  24,  26, 102,  81,  78, // q........fQN
+ 157, 122, 203,  30, 123,  32,  43, 116, 239,  99,  31, 186, // .z..{ +t.c..
+  90, 108, 149, 170,  91,  85,  39,  47, 129, 213,  62,  76, // Zl..[U'/..>L
+ 151, 160, 118, 238,  63, 244,  89, 130, 187, 147,  66,   5, // ..v.?.Y...B.
+  38, 166, 130, 113, 141,  95,  12,  17,  67, 180, 205, 219, // &..q._..C...
+  85, 201, 176, 106, 202, 239, 136, 217,  44, 190, 226, 207, // U..j....,...
+  75, 252, 249, 132,  63,  79, 240, 231,  61, 254, 252, 137, // K...?O..=...
+  63, 191, 226, 207,  71, 252, 249,  29, 127,  26, 248, 211, // ?...G.......
+ 196, 159, 117, 252, 217,   0,  71, 158, 243, 149,  57,  32, // ..u...G...9 
+ 146,  43, 189, 205,  16, 122, 139, 255, 110, 242, 223, 187, // .+...z..n...
+ 252, 247, 103, 254, 123, 135,  47,  35, 173,  24, 210,  24, // ..g.{./#....
+  65, 210,  73,  72, 155, 126,   9,  59, 145,  55,  15, 225, // A.IH.~.;.7..
+  96, 126, 145, 139, 121, 120,  16,  53, 142, 179,  26,  28, // `~..yx.5....
+  26,   9,  53,  55, 184,  21, 226, 216,  58, 190,  43, 217, // ..57....:.+.
+  44, 252,  82, 233,  82, 238, 167,  90, 166, 214, 136,  70, // ,.R.R..Z...F
+  76,  67,  45, 148, 173,  57, 162, 225, 211, 184,  19, 140, // LC-..9......
+ 155,  71, 157, 162, 151,  25, 254, 224,   4,  99, 119, 204, // .G.......cw.
+ 211,  72, 155, 111, 186, 132, 194, 141, 181, 140,  65, 116, // .H.o......At
+ 138, 161, 154,  93, 168,  61, 214, 231,  78,  38,  81, 172, // ...].=..N&Q.
+ 136, 108,  89,  49, 238, 143, 132, 255, 110, 235,  95, 214, // .lY1....n._.
+ 237, 110,   4, 173,  14, 211, 210, 197, 223, 215, 219, 126, // .n.........~
+ 241, 178,  30, 117,  20,  36, 166, 244, 252, 100,  37, 130, // ...u.$...d%.
+  10,  40, 238,  75, 115, 185,  53,  45,  62,  33, 187,  33, // .(.Ks.5->!.!
+ 217, 239, 145, 205,  80,  72, 140,  27, 147,  77, 116, 124, // ....PH...Mt|
+  36,  39, 124, 213, 131, 223,  38, 193,  24, 126, 215, 119, // $'|...&..~.w
+ 163,  12, 191,  27, 187, 209,  64, 161, 129, 228,  57, 219, // ......@...9.
+ 250,  62, 167,  20, 133,  70, 244, 211,  39, 206,  89, 231, // .>...F..'.Y.
+  28, 220, 103, 189, 231, 156, 134,  99,  93, 111,  80,  12, // ..g....c]oP.
+ 125,  84, 188,  84,  52, 111, 239,  87, 138,  79,  48, 151, // }T.T4o.W.O0.
+ 126,  66, 253,  40, 222, 151,  75, 154, 249, 172,  18,  55, // ~B.(..K....7
+  58,  25, 192,  57, 113,  22, 156, 119,  59, 180,  39, 155, // :..9q..w;.'.
+ 161, 185, 211,  95,  33, 232, 175, 231,  45,  78,  93,  55, // ..._!...-N]7
+ 169, 133, 155, 186,  97,  82, 147,  58, 165, 174, 232, 212, // ....aR.:....
+ 134,  73,  77,  37, 117,  50, 185, 222, 178,  72,  96,  29, // .IM%u2...H`.
+  90,  26,  38, 209, 179,  81,   4, 205,  24,  20, 160,  21, // Z.&..Q......
+  40,  41, 101,  94,  20,  38,  90,  89, 168, 163,  11, 217, // ()e^.&ZY....
+ 165, 226,   9,  54,  94,  29,  59, 145,   6, 249,  22, 109, // ...6^.;....m
+   7,  81, 144, 141, 160, 217, 245, 132, 216, 171, 213, 205, // .Q..........
+   0, 251, 131, 181, 101,  57, 241, 189,  73,  92,  55, 170, // ....e9..I.7.
+ 179, 156, 252, 210,  36, 111,  88,  61,  90,  78, 255,  36, // ....$oX=ZN.$
+ 233,  19,  22,  15,  22, 104, 186, 244, 111, 124,  46, 218, // .....h..o|..
+  42, 177, 209,  86,  41, 216,  45, 180,  24, 197,  10, 123, // *..V).-....{
+ 148, 176,  56, 150, 173,  62, 205,  73,  54,  84, 231,  98, // ..8..>.I6T.b
+  62, 120,  22,  50, 117,  56, 193,  25,  45,  69,   2, 135, // >x.2u8..-E..
+ 208,  37,  90,  73, 172, 239, 172, 110,  97, 178, 202,   6, // .%ZI...na...
+ 125, 138, 167, 239, 219,  96, 104, 110, 197, 124, 121,  69, // }....`hn.|yE
+  92, 149, 160, 197, 254,  98, 245, 229, 173,  97, 209, 224, // .....b...a..
+ 198, 155, 208,   1,  11,   7, 241,  20,  48,  51,   1, 243, // ........03..
+ 191, 118,  27,   2,   2, 219,  84, 100,  84, 197,  52, 175, // .v....TdT.4.
+ 211, 128,  50, 160,  49, 217, 208,  51, 157,  67, 147, 209, // ..2.1..3.C..
+ 150, 107, 183, 227,  14,  66, 219, 108, 193, 192,  38, 238, // .k...B.l..&.
+ 108, 141,  68,  86, 167, 105, 161, 226, 101,  72,  32,  57, // l.DV.i..eH 9
+  68, 215, 181, 210,  50, 204, 102, 213,  33, 253, 100,  76, // D...2.f.!.dL
+ 212,  23, 171, 135, 157, 145, 127,   8, 195, 160, 224,  92, // ............
+  95,  78, 139, 203, 104,  97, 137,  96, 100, 162, 117,  56, // _N..ha.`d.u8
+ 197, 116,  30, 114, 144, 148, 245,  19, 227,  40, 215, 136, // .t.r.....(..
+ 148, 160,  36, 174, 215, 107, 204,  39, 234, 250, 244,  45, // ..$..k.'...-
+ 166, 118,  12,  38, 159, 206, 249,  18, 186,  50,  43,  43, // .v.&.....2++
+ 191,  28, 154,  91, 230, 169, 239,  51, 253, 189,  86, 129, // ...[...3..V.
+  16, 130, 125,  41, 202, 204, 138,  12, 235, 102, 177, 218, // ..}).....f..
+ 245, 230,  90,  35, 236, 182,  79, 252,  30,  46, 124, 227, // ..Z#..O...|.
+ 117, 213, 199, 241,  13,  93, 179, 200, 144, 252, 237, 178, // u....]......
+  72, 230,  22, 169,  15,  91, 241,  86, 209,  46, 216, 148, // H....[.V....
+ 171,  67, 181, 135, 177, 126,  76, 180,  35, 135,  90, 247, // .C...~L.#.Z.
+ 198, 141,  63, 253,  97,  29, 159, 230, 246, 211, 128,  29, // ..?.a.......
+ 196, 202, 164,  57,  38, 108, 114, 101, 154,  74, 224, 160, // ...9&lre.J..
+ 100, 149, 109,  53, 163, 120, 130,  85,  54, 180,  81,   2, // d.m5.x.U6.Q.
+  65, 105, 214, 253,   6, 196, 207, 165, 249, 140, 212,  54, // Ai.........6
+ 181,  73, 206,  91, 150, 169, 111, 121,  36,  60, 150, 179, // .I.[..oy$<..
+  36, 207, 164, 241,  62, 197, 131,  37, 155, 236,  11, 167, // $...>..%....
+  91, 194, 203,  60, 115, 170,  33, 166, 244, 163,   6, 206, // [..<s.!.....
+  35, 108,  16, 182, 106,  53, 251,  67, 222, 232, 128,  21, // #l..j5.C....
+ 195, 145, 213, 141,   9,  58, 204, 137,  84, 207,  94, 132, // .....:..T.^.
+  43,  90,   2,  98, 130,  56, 149,  28,  71,  90, 252, 158, // +Z.b.8..GZ..
+ 156, 217, 167,  83, 253, 228, 156, 105, 251, 214, 183,  54, // ...S...i...6
+ 115,   4, 112, 226, 220, 176, 126, 110,  52, 143, 240, 126, // s.p...~n4..~
+  39,  54, 246, 111, 204, 214,  37,  38,  16,  87,  75, 255, // '6.o..%&.WK.
+ 226, 102, 242,  45, 188, 188,  90, 122,  54,   9, 130, 144, // .f.-..Zz6...
+ 160, 162,  24, 243, 223, 215,   6,  61,  25, 228, 197, 188, // .......=....
+ 146,   7, 167,  66,  94, 232, 189,  71,  21,  30, 235, 156, // ...B^..G....
+ 112, 227, 177, 158,  37,  35, 126,  17, 163, 252, 102, 168, // p...%#~...f.
+ 159, 148,  22,  90,  24, 225, 197, 197,  69,  50, 160, 227, // ...Z....E2..
+ 184, 167,  98, 173, 226,  82, 138, 250, 223,  18,  83,  86, // ..b..R....SV
+ 188, 130, 168,  95, 223, 146, 224, 234, 196, 190, 168, 248, // ..._........
+ 177, 100, 177,   6,  22,  95, 157, 152,  44, 164, 151,  75, // .d..._..,..K
+ 104, 158, 203, 155, 131,  69,  55,  10, 123, 230,  35,  49, // h....E7.{.#1
+ 187, 142,  28,  65, 203, 158, 172, 164, 221, 199,   5, 238, // ...A........
+  70,  87, 252, 141, 149, 245, 155, 112, 180,  73,   7, 183, // FW.....p.I..
+   6,   8, 218, 142,  68, 238, 111, 176,   4,  72,  67, 158, // ....D.o..HC.
+  94, 127,  49, 254,  45, 180,  34,  32, 127, 180, 186, 126, // ^.1.-." ...~
+ 147, 232,  12, 173, 214, 101, 250, 169, 109, 182,  40, 139, // .....e..m.(.
+  13, 111,  70,  97, 210,  81, 123,  70, 245,  11, 168,  99, // .oFa.Q{F...c
+ 207, 106, 125,  77, 148, 105, 131, 128, 174, 132, 110,   3, // .j}M.i....n.
+ 220,  90,  98,  34, 105, 242, 172,  83,  19, 155, 150,  32, // .Zb"i..S... 
+ 197, 129, 247,  18, 220, 205,  58,  33,  81,  68, 104,  72, // ......:!QDhH
+ 211,  43,  97, 231,  90,  19, 238, 154,  66, 173, 154, 183, // .+a.Z...B...
+  11, 134, 226,  88, 119, 199,  23,  23,  75, 154,  56, 214, // ...Xw...K.8.
+ 178, 131, 210, 255, 230, 131, 150, 227, 246,  82,  19, 232, // .........R..
+  68,  59, 107, 105, 138, 122, 170, 158, 174, 114, 112, 203, // D;ki.z...rp.
+ 151,  89, 143,  45,  22, 130, 214,  11,  63,  87, 177, 185, // .Y.-....?W..
+  91, 140, 245,  45, 204,  11,  54, 228, 212, 218,  51,  46, // [..-..6...3.
+  41,  47, 167,  15,  24,  32, 123,  80, 199, 114,  47,  39, // )/... {P.r/'
+ 236, 149, 167, 131,  62, 217, 189,  67, 164, 198, 161, 241, // ....>..C....
+  48,   0, 185, 101,  43, 113, 252, 168, 203, 109, 128, 120, // 0..e+q...m.x
+ 143, 135, 185, 179, 112,  91,  82, 144,  61,   7,  89,  78, // ....p[R.=.YN
+  75, 210,   4,  24, 249,  75,  27, 227,  37, 210, 124, 151, // K....K..%.|.
+ 148,  16, 204, 214, 161,  46, 165, 232, 137, 225,  73,  70, // ..........IF
+  32, 190,  59,  21, 182,  67, 239,  63,  85,   8,  41, 119, //  .;..C.?U.)w
+ 168,  71, 238, 119, 116,  11,  28,   1, 199, 236, 185, 173, // .G.wt.......
+  70, 123, 170,  43,  97, 165,  89,  66, 225, 229,  37,  41, // F{.+a.YB..%)
+ 145, 108, 114,  50,  26,  20, 170,  87, 167, 149, 176,  51, // .lr2...W...3
+ 113, 125, 220, 126, 178,  18, 122,  57,  63, 232, 152, 235, // q}.~..z9?...
+  22, 121, 242,  91, 124,   6,  31, 234,  71, 113, 209, 161, // .y.[|...Gq..
+ 199,  96,   9, 156, 171, 246,   4,  82, 178, 139, 171, 163, // .`.....R....
+ 236, 200, 198, 184, 224,   1,  20, 108, 250, 164,  37, 142, // .......l..%.
+  45,  87,  40,  89, 176, 200, 230,  60,  69, 169, 244, 152, // -W(Y...<E...
+ 166,  37, 110, 167,  56, 140,  96,  59,  10,  11,  82,   5, // .%n.8.`;..R.
+  82, 252,  29, 147,  45,  12,  36, 240, 130, 194, 231,  73, // R...-.$....I
+  10,  59, 105, 205,  89,  73, 197, 147, 217, 178,  34,  38, // .;i.YI...."&
+ 222, 163,  14, 220, 247,  15, 245, 200, 205, 176, 113, 184, // ..........q.
+ 166, 236,  41, 230, 216, 175,  12,  87, 165, 103,  51,  53, // ..)....W.g35
+  73,  85, 204,  40, 158, 151, 236, 101, 143, 161, 151,  49, // IU.(...e...1
+ 171,   7, 216, 139,  43,  75,   8, 102,  87, 101, 214, 204, // ....+K.fWe..
+  76, 139, 119, 115, 149, 237,  78, 228, 238, 191,  56, 226, // L.ws..N...8.
+  43, 143, 110, 204,  23,  17,  25, 171, 123,  21, 123, 213, // +.n.....{.{.
+  52,   8, 121,  11,  29, 143,  68, 155, 172, 137,   4,  68, // 4.y...D....D
+  22,  80, 224, 188, 232, 186,  31, 201,  97,  42, 235,  56, // .P......a*.8
+ 179,  75,  29, 200,  79, 146,  25,  97,  44,  47, 117,  98, // .K..O..a,/ub
+ 182, 235,  11, 154,  97,  26, 159, 208, 117, 245,  33,  68, // ....a...u.!D
+  62,  72, 178, 219, 145,  78,  18,  85, 103,  63, 113, 224, // >H...N.Ug?q.
+ 245, 136, 222, 135, 123, 200, 106,  88, 132, 132, 206,  55, // ....{.jX...7
+ 236,  99, 149,  76, 244, 160, 109,   0,   5,  63,  57, 118, // .c.L..m..?9v
+ 123,  13, 236, 116, 230,  38,  16, 225, 145, 156,  86,  19, // {..t.&....V.
+ 228,  34, 129, 136,  67,  71,  82, 139, 203, 104, 147,  48, // ."..CGR..h.0
+  53,  92, 227,   5, 150,  14, 189,  79, 154,  60,  34, 164, // 5......O.<".
+  28, 155, 187, 113, 209,  68, 226,  43, 113,  58,   3, 229, // ...q.D.+q:..
+ 141, 177,  72, 241, 134,   5, 231,  78, 211,  64, 146, 116, // ..H....N.@.t
+   0, 127, 130,  17,  21, 212, 240, 169,  81,  98, 122, 103, // ........Qbzg
+  26,  21, 125,  69, 251,  37,  52,  90,  20,  48, 102, 185, // ..}E.%4Z.0f.
+ 128, 149, 156,  61, 247,  85, 159,  53,  37,  76,  32,  17, // ...=.U.5%L .
+  10, 118, 196, 189,  75, 175, 104,  67, 231, 163, 130, 213, // .v..K.hC....
+  15,  32, 213, 211, 177,  47, 136, 233,  78, 204, 205,  72, // . .../..N..H
+   9,   7, 220,   0,  77, 176,  81, 157, 172,  76, 183, 174, // ....M.Q..L..
+ 217, 214, 224,  76, 188, 124, 119, 234, 190,   6,  90,  64, // ...L.|w...Z@
+ 110, 198, 235,  65, 158,  42, 224, 117,  18, 237,  16,  35, // n..A.*.u...#
+ 107, 254, 239,  82,  43,  47,  28,  43, 197,  29, 205,  48, // k..R+/.+...0
+ 195, 199,  76,  39,  34, 174,  20,  70,  30, 142,  13,  31, // ..L'"..F....
+ 123,  66, 215, 226, 125, 248,  41, 102,   7,  55, 169, 118, // {B..}.)f.7.v
+  34,  78, 143,  57,  60,  28, 124, 244,  11,  81, 207,  95, // "N.9<.|..Q._
+ 219,   8,  88,  40, 218,  97,  91,  57, 202, 148, 175, 154, // ..X(.a[9....
+  92, 148, 235, 216, 224, 199, 129, 254, 234, 158, 124, 133, // ..........|.
+ 107, 238, 145, 208, 149, 223,  64, 174,  13,   9, 104,   6, // k.....@...h.
+  41, 132,  86, 230, 241, 226,  98,  39, 121, 161, 204, 255, // ).V...b'y...
+  29, 201, 126, 215, 103, 133, 222,  23, 152, 137, 228,  57, // ..~.g......9
+  62, 222,  51,  95,  39, 223,  92, 149, 137,  88, 203, 102, // >.3_'....X.f
+  78,   0, 170,  42, 121, 160, 146, 101, 225,   0, 146, 109, // N..*y..e...m
+ 253, 251,  86, 195, 158, 232,  38, 148, 222,  72, 146, 239, // ..V...&..H..
+  42, 121, 164, 146, 215,  42, 185, 167, 146, 251,  42, 121, // *y...*....*y
+ 168, 146,  55,  42, 121, 170, 146,  63,  84, 242,  76,  37, // ..7*y..?T.L%
+  31, 244, 231, 239, 170,  98, 142, 199, 118,  87, 143,  13, // .....b..vW..
+  13,   6,  71,   6, 177, 146,  83, 247,  60, 121,  16,  53, // ..G...S.<y.5
+  42, 250, 153, 118,  27, 232, 123, 212, 228, 193,  10, 177, // *..v..{.....
+  49, 177, 115, 229,   5, 161,   6,  91, 138,  70,  99, 241, // 1.s....[.Fc.
+ 191, 134,  91,  64,  27,  22, 148, 218, 217, 217, 217, 197, // ..[@........
+ 110, 126,  16, 249, 212,  43, 112,  66, 198, 203, 117, 203, // n~...+pB..u.
+  68, 193, 132, 154,  43, 181, 191,  97, 163,  43,  83, 162, // D...+..a.+S.
+ 177, 145,   7, 216, 105, 109, 212, 228, 193, 212,  21, 239, // ....im......
+   3, 221, 169, 130, 111,  46,  38, 101,  71, 228,  69, 158, // ....o.&eG.E.
+  89,  82, 211,  16, 136,  28, 177, 243, 174, 142, 199,  58, // YR.........:
+ 178, 241,   6, 224,  31, 242, 155, 128,  64, 113,  73, 104, // ........@qIh
+  17,  98, 225,  32, 142, 199, 178,  36, 239, 130, 118, 242, // .b. ...$..v.
+ 213,  15, 194, 116, 207, 135,  23, 202, 117, 113, 236, 190, // ...t....uq..
+  14, 153, 114,   0,  97,  82, 113, 151, 232,  83, 225, 241, // ..r.aRq..S..
+  64, 150,  67, 164,  36,  66,  32,  87,  10, 244, 181,  12, // @.C.$B W....
+   7, 212, 194, 106,  52, 140, 120, 222, 199, 253, 101, 219, // ...j4.x...e.
+ 167,   5,  79, 222, 114, 240,   9, 172,  57,  61,  66,  67, // ..O.r...9=BC
+ 238,  65, 157, 104,  70, 158, 171, 157, 100, 153, 240, 135, // .A.hF...d...
+ 126, 220, 222, 149, 126,  35,  20,  70, 178,  76, 201, 201, // ~...~#.F.L..
+ 118,  16, 234,  80,  30,  27, 156, 193, 241,  47,  56, 202, // v..P...../8.
+  69, 140, 158, 106, 245,  65,  92,  66, 216, 204, 103, 211, // E..j.A.B..g.
+ 153, 244,   8, 210, 191,  77,  20, 196, 202,  71, 255, 238, // .....M...G..
+ 237,  91, 141,   6,  68, 225, 161,  20,  23, 123,  75,  81, // .[..D....{KQ
+ 132, 132, 118, 135, 237, 111, 108,   1,  85,  58,  45, 168, // ..v..ol.U:-.
+  19,  91,  95, 166,  75, 185,  14, 214, 147, 151,  85,  67, // .[_.K.....UC
+ 197, 152,  88, 112, 226, 200, 232, 111, 252,  92, 165, 244, // ..Xp...o....
+ 195, 209, 184, 233, 236, 227, 244,  28,   9,  76,  11,  17, // .........L..
+ 230,  32, 204, 255,  93, 174, 225, 132,  90, 217, 230, 184, // . ..]...Z...
+  76, 201, 119, 226,  82,  85,  70, 153, 143,  36,  19, 164, // L.w.RUF..$..
+ 139, 206, 122,  68, 220, 164,   2, 253, 240,  90, 178,  32, // ..zD.....Z. 
+ 126, 101, 135,  79, 148,   2, 117, 148, 156, 178, 238, 151, // ~e.O..u.....
+  89, 191, 102, 184,  94, 185,  15,  97, 104,  74,  57,  15, // Y.f.^..ahJ9.
+ 203, 156,   7,  29,  98, 226,  31,  18, 255, 172, 112, 254, // ....b.....p.
+ 220,  35, 114, 228,  15,  28, 240, 207,  41, 235,  33, 200, // .#r.....).!.
+ 186, 228,  94, 228, 186,  77,  75,  94,  57, 225, 104,  22, // ..^..MK^9.h.
+ 244,  12, 218,  48, 148, 245,  70, 103, 209, 185,  79,  47, // ...0..Fg..O/
+  24,  10,  90, 120,  42, 169, 160,   8, 132, 144,  78, 158, // ..Zx*.....N.
+  70, 137, 244, 234, 143,  50, 235, 126, 103,  20, 163, 119, // F....2.~g..w
+ 148,  24, 185,  26, 135, 137,  99,  49, 171,  93, 217,  91, // ......c1.].[
+ 135, 177, 124, 121, 235,   0, 182, 189, 146,  43, 204, 125, // ..|y.....+.}
+  28,  95, 152,   4, 165,  41,  12, 193,  87,  35, 224, 192, // ._...)..W#..
+  26, 201, 182,  74, 203,  16,  56, 106,  96,  28, 165, 227, // ...J..8j`...
+   3, 220, 133, 197, 250, 122, 107, 218, 103, 152, 182,  54, // .....zk.g..6
+ 239,  80, 111, 234, 113, 199, 241, 253,   8,  71, 245,  81, // .Po.q....G.Q
+  94, 250, 126,  36, 192,  35,   6, 191, 101, 227,  38,   9, // ^.~$.#..e.&.
+   1, 155, 178, 110, 125, 138,  25,  43, 182,  50, 190,  41, // ...n}..+.2.)
+  36, 178, 212, 208,  68,  41, 211,  68, 144,  52, 231, 193, // $...D).D.4..
+ 148, 183,  50,  71,  99, 178,  67,   3,  64, 219, 194,   2, // ..2Gc.C.@...
+ 167,  65, 198, 183, 235, 184, 177, 132,  70, 186, 113,  93, // .A......F.q]
+  94, 183, 121, 137, 228,  21, 187,  85,  83, 167,  84, 186, // ^.y....US.T.
+  44, 122, 223, 182, 203, 169, 211, 101,  63, 227, 222, 102, // ,z.....e?..f
+ 210, 219, 156, 131, 119,  56, 189,  37, 152,  55, 189, 101, // ....w8.%.7.e
+ 143,  48,  18, 189, 132,  99, 151,  80,  83, 124,  85, 133, // .0...c.PS|U.
+ 152,  12,  38, 149,  94,   7,  76, 218, 197, 124, 127, 197, // ..&.^.L..|..
+ 178,  46,  40, 166, 242,   7, 148,   5,  93, 113,  45, 153, // ..(.....]q-.
+   3,  58, 139, 146, 199, 114, 184,  62,  41, 239,  82, 237, // .:...r.>).R.
+  53, 169,  99,  62, 151, 188, 175,   8, 245, 113, 164, 196, // 5.c>.....q..
+ 198,  23,  68, 200,  47,  45, 235,  74, 172, 162, 139, 198, // ..D./-.J....
+  12, 159, 112, 189, 137, 229,  17,  42,  74, 215, 191, 137, // ..p....*J...
+ 172,  27, 156, 137, 117,  77,  32, 222, 125, 160, 214, 214, // ....uM .}...
+ 102,  50, 200, 105, 137, 214, 192, 216,  43, 245, 197,  76, // f2.i....+..L
+ 105,  40,  54,  74,  61, 109, 140, 116, 104, 153, 218, 131, // i(6J=m.th...
+ 168, 107, 250, 164, 121, 219,  35, 164, 224,  73, 237,   9, // .k..y.#..I..
+ 183, 188,  71,   9, 252,  52,  65,  14, 115, 163,  45, 118, // ..G..4A.s.-v
+ 164, 186,  39,  46,  80, 209,  15, 185, 103,  82, 103, 209, // ..'.P...gRg.
+ 222, 223, 215, 215, 214,  91, 214, 122, 247,   8, 198,  67, // .....[.z...C
+ 209,  30,  97,  98, 239, 111, 253, 126, 223,  11,  15, 140, // ..ab.o.~....
+ 181,  95,  19, 174,   2,  52,  31, 123, 227, 198, 217,  86, // ._...4.{...V
+   3,  80, 116, 202,  56, 160,  84,  24,  58,  83, 103, 116, // .Pt.8.T.:Sgt
+ 120,  36,  86,  40, 221, 168, 239, 173, 173,  67,  42, 221, // x$V(.....C*.
+ 228,   7, 154, 229, 245, 149,  61,   8, 166,  55,  86, 246, // ......=..7V.
+  90, 254, 177,  99, 183,  17, 136,  93, 171, 213, 189,  77, // Z..c...]...M
+ 218, 201, 159, 254, 129, 218,  83,  93,  81, 131, 233,  66, // ......S]Q..B
+  13,  70,  29, 177, 117, 217, 161, 234, 177,  94, 221,  30, // .F..u....^..
+ 109,  37, 157, 157,  71,  82,  96,  16,  29,  17, 133, 116, // m%..GR`....t
+  76, 244,  17,  17,  84,  68,   7, 209, 145, 235, 232,  72, // L...TD.....H
+ 178,  85, 145,  21,  73,  59, 206,   4,  52,  20,  35,  50, // .U..I;..4.#2
+ 211, 167, 210,  47,   3,  28, 134,  28, 225, 120, 119,  19, // .../.....xw.
+ 246,  34, 223, 204,  42,  43,  29, 176,  54, 102,  43,  94, // ."..*+..6f+^
+ 246, 247, 128,  69, 246, 152,  60,  97,  13, 228,  61, 170, // ...E..<a..=.
+  58, 220, 179,  30,  32, 101, 198,  91,  93,  77, 105, 238, // :... e.[]Mi.
+ 149, 113, 148,  12, 130, 192, 246,   2, 170,  41, 152, 112, // .q.......).p
+   7, 166,  81, 177,  19, 107, 139, 118,  92, 209, 114,  76, // ..Q..k.v..rL
+ 112, 216, 157, 191, 108, 168, 165,   6, 116,  46, 245, 238, // p...l...t...
+  90, 106,  78, 252,  35, 209, 224,   8, 218,  52, 199, 177, // ZjN.#....4..
+   5, 209,  36,  32, 162,  14,   1, 163, 140,  94,   9,  96, // ..$ .....^.`
+  44,  32, 120, 145, 147,  11, 243,  45, 208, 122, 172, 167, // , x....-.z..
+  25,  86, 251, 133, 218, 131,   1, 204,  82,   3,  87,  25, // .V......R.W.
+ 144,  64, 149, 197,   6, 101,  49, 216, 240,  77, 193,  66, // .@...e1..M.B
+ 253,  76, 213, 207, 220,  77, 241, 103, 213,  58, 169,  52, // .L...M.g.:.4
+  24, 164, 217, 119, 206, 195,  64, 249, 212, 204, 248, 226, // ...w..@.....
+ 162,  31, 232, 115,  78,  52, 211,  70,  92,  63, 186,  12, // ...sN4.F.?..
+ 175,  88, 227, 242, 109,  76, 141, 247, 219, 254, 198, 141, // .X..mL......
+  78,  16,  69,  27, 172, 204, 198, 233, 253,  64, 117, 203, // N.E......@u.
+  82,  93, 154, 211, 143,  62,  59,  85,  76, 126, 165, 214, // R]...>;UL~..
+ 152, 171,  15, 215, 111, 116, 136, 230, 208, 233, 206, 135, // ....ot......
+  78, 145, 230, 141,  78, 165,  31,  87,  86, 239,  42, 195, // N...N..WV.*.
+ 185,  21, 249, 179, 237, 187,  67, 173,  40, 127, 150, 179, // ......C.(...
+ 246, 171,  61,  63,  68, 142, 225, 198, 158, 120, 209,  25, // ..=?D....x..
+ 182, 139,  25, 245, 164,  89, 210, 160,  80,  54,  13, 124, // .....Y..P6.|
+ 180,  24, 255,  49, 162, 142, 229,  16, 151, 172, 162,  66, // ...1.......B
+ 169, 125, 212,  44, 224, 181,  26, 172,  30, 234,  70,  69, // .}.,......FE
+ 112, 110,  99, 156,  81,  33, 134, 126, 159,   7,  24, 198, // pnc.Q!.~....
+  39, 193, 128,  17,  20, 118, 213, 227,  41,   0, 235,  42, // '....v..)..*
+  76, 250,  75, 248,  11,  99,  72, 234, 240, 212, 239, 199, // L.K..cH.....
+   7, 131,  84,  44, 204, 121, 223,  89, 115, 212,  40,  91, // ..T,.y.Ys.([
+ 209, 119,   0,  27, 236,   6,  36,  15, 115, 182,  50,  77, // .w....$.s.2M
+ 218, 254,  48, 202, 212,  97, 116,  64,  75, 212, 167, 167, // ..0..at@K...
+  30,  61,  93,  22,  39,  68, 143, 135,  14,  60, 132, 108, // .=].'D...<.l
+  67,   5, 253, 168, 199,   7,  96,  56, 140,  14, 249,   1, // C.....`8....
+  29, 209, 214, 234, 112, 118, 173,  52,   1,  69, 175, 112, // ....pv.4.E.p
+ 203,  17, 180, 202,  57,  23, 245, 148, 233, 161, 213, 187, // ....9.......
+ 170, 222, 117, 167, 168,   1, 214, 184,  42, 245,  97,  76, // ..u.....*.aL
+ 166, 129, 194, 200,  94, 229,  54, 158,  82, 132,  73, 242, // ....^.6.R.I.
+  69, 237,  67,  51, 191,  86, 247,  35,  44, 180, 170, 247, // E.C3.V.#,...
+ 148, 242, 184,  45,  27, 219, 178,  19, 152, 234, 201, 173, // ...-........
+ 116, 210,  84,   9, 161, 240,  13, 149, 220,  86, 201,  45, // t.T......V.-
+ 149, 108, 170, 228, 174,  74, 126,  86, 201,  29, 149, 198, // .l...J~V....
+  42,  37, 206, 159,  86, 144, 175, 105,  83, 190, 167,  77, // *%..V..iS..M
+ 225,  43, 175,  60, 109, 211,   1,  81, 254, 156,  83, 141, // .+.<m..Q..S.
+ 185, 147,  87,  25,  42,  98,  75,  16,  89,  53, 103,  93, // ..W.*bK.Y5g]
+  48, 155,  25,  57, 158,  80, 192,  81, 156, 167,  41,  20, // 0..9.P.Q..).
+  86, 136, 175, 135, 203,  82, 190, 112, 117,  10, 140, 124, // V....R.pu..|
+  17, 212, 220, 166, 137, 152, 163, 174, 126, 137,  94,  13, // ........~.^.
+ 171, 208, 148, 196,  32, 102, 196, 220, 247,  32, 235,  35, // .... f... .#
+  52,  17,  93, 186, 145,  49,  20, 171, 221,  36,  79, 130, // 4.]..1...$O.
+ 201, 245,  27,  48, 150,  32, 208,  62,  51, 111, 148,  37, // ...0. .>3o.%
+   9, 187, 149,  74, 171, 173,  11, 243, 166,  57,  69,  71, // ...J.....9EG
+ 249, 128,  53,  72, 226, 219,  86,  95, 238, 182,  86, 187, // ..5H..V_..V.
+ 215, 178,  34,  75, 125, 234,  80,  47, 212,  37, 132, 128, // .."K}.P/.%..
+ 121, 228,  94, 108,  49, 193,  27, 223, 247,  89,  91, 208, // y.^l1....Y[.
+ 134, 177, 113,  20, 216,   2,  17,  81,  39,  15,  12, 177, // ..q....Q'...
+ 160, 149, 234, 244,  97, 159, 138, 130,  24, 102, 166, 116, // ....a....f.t
+  56,  15, 113, 149, 208, 115, 184, 242,  75, 133, 126, 131, // 8.q..s..K.~.
+  38, 154,  72,  32,  37, 171, 163,  51, 224, 216, 140, 165, // &.H %..3....
+ 114, 196,   9,   6, 213, 145, 205,  66, 190, 185, 198, 177, // r......B....
+  65, 111, 180, 161,  66, 134, 193, 167, 142, 178,  96, 102, // Ao..B.....`f
+ 165, 179,  98,  76, 170,  51,  27,  86, 141,  48, 142, 242, // ..bL.3.V.0..
+ 178, 235, 174, 189,  48,  20,  68, 202, 206, 231, 182, 243, // ....0.D.....
+ 144,  74, 188, 241, 165,  36,  51, 240, 138, 152,   2,  73, // .J...$3....I
+ 161, 175,  56,  37, 168,  39, 203,  44,  51, 226,  82,  91, // ..8%.'.,3.R[
+ 134, 117, 165,   5,  92,  94,  89,  81, 134, 125, 221, 226, // .u...^YQ.}..
+  47,  40, 113, 187,  94,  15, 180, 142,  86, 242,  65, 120, // /(q.^...V.Ax
+  92, 110,  13,  47, 219, 122, 178, 140,  57, 154,   0,  32, // .n./.z..9.. 
+ 125, 244, 201,  39, 234, 153,  16, 231,  24, 116,  58, 229, // }..'.....t:.
+ 178,  27,  54, 220, 253,  66,  42,   2, 186,   6,  60, 177, // ..6..B*...<.
+ 188, 128, 137, 222, 182, 241, 139,  24, 105,  84, 171, 179, // ........iT..
+  98, 166, 221, 200,  32,   7, 118, 232,  39, 115,  58, 136, // b... .v.'s:.
+ 180, 235,  41, 181,  67, 184, 121,  55, 226,  22, 187, 204, // ..).C.y7....
+ 166, 168,  62, 253,  12,  12, 233, 223, 229, 110, 117,  21, // ..>......nu.
+  45,  65,  14, 173,  74, 172, 172, 238, 151, 190, 210, 239, // -A..J.......
+ 115, 137,  62,  74,  12, 118,  21, 156,  73, 101, 182, 132, // s.>J.v..Ie..
+  76,  64,  86, 154, 158, 225, 185, 115, 202,  90, 184, 174, // L@V....s.Z..
+ 211,  29,  92,  92, 187,   0,  14, 230,  75, 118, 146, 126, // ........Kv.~
+ 181, 126, 213,  83, 135, 139, 139, 141, 134,  38, 239,  93, // .~.S.....&.]
+ 110, 138,  64,  79,  12, 116,  28,   6,  36,   2,  24, 218, // n.@O.t..$...
+  84, 152, 191, 225, 186, 200,  66,  65,  82, 130, 240, 164, // T.....BAR...
+  10, 162, 211, 110, 129, 204, 182,  42, 247,   8, 170, 144, // ...n...*....
+ 119, 167, 235, 210,  69, 105,  33, 177, 120, 183,  52,  80, // w...Ei!.x.4P
+ 174, 116, 155,  11, 203, 110, 185, 164,  95,  58, 146, 250, // .t...n.._:..
+ 249, 132, 168,  72,   7, 221, 166,  78,  55,  51,  57, 166, // ...H...N739.
+ 114,  32,  39, 217,  15,  12, 168,  75,  50, 251,  23,  23, // r '....K2...
+  12, 152,  75,  50, 255, 193, 121, 238,  44,  76,  94,  46, // ..K2..y.,L^.
+  76, 203, 236,  30, 209, 126, 204,  69,  51, 115, 131, 221, // L....~.E3s..
+ 235, 100,  82, 161, 200,  90,  96,  47, 104,  54, 150, 182, // .dR..Z`/h6..
+  25,  52, 175, 172, 197, 233, 124,  66, 205, 185, 159,  32, // .4....|B... 
+ 152, 165, 243,   9, 134, 141, 248,  89,   9, 211, 163,  44, // .......Y...,
+ 105, 159,  66, 235, 159, 102, 136, 125,  81,  77, 215,  48, // i.B..f.}QM.0
+ 127,  38, 186,  36, 229, 105,  73, 135, 161, 189, 242, 157, // .&.$.iI.....
+ 201, 131, 238, 103,  32,  42,  77,  90,  92, 198, 158, 158, // ...g *MZ....
+  33, 191, 109,  89, 153, 113,  41, 242, 194,  73, 124,  55, // !.mY.q)..I|7
+  98, 185, 215, 244,  97, 112,  59,  16, 140, 206, 103,  42, // b...ap;...g*
+ 156,  61, 223, 142,  68,  93, 170, 122,  68, 201, 132,  66, // .=..D].zD..B
+  31,  75, 203,  29,  91,  75, 113, 203,   0, 214, 172,  34, // .K..[Kq...."
+ 253, 146,  21,   2,  59,  58,  55,  58, 200, 192, 121, 105, // ....;:7:..yi
+ 116, 229,  34, 192, 204,  53,  23, 114, 144,  36,  47, 150, // t."..5.r.$/.
+ 113, 183, 149,  13, 122, 190,  54, 211,  98, 227,  57, 234, // q...z.6.b.9.
+ 144, 126, 229,  71,  86, 245, 130,  89, 180, 164, 177, 167, // .~.GV..Y....
+  64, 183,  72, 195,  20, 209,  40,  87, 155, 117,  49,  51, // @.H...(W.u13
+  62,  96,  78, 188,  51,  33,  58, 107, 135, 136, 182, 221, // >`N.3!:k....
+ 104, 129, 176,   2, 160, 249, 196,  40, 125, 155,  27, 151, // h......(}...
+   1, 193, 154, 184,  24, 141, 114, 241, 214, 168, 173,  85, // ......r....U
+  69, 155,  47, 155, 169, 204, 241,  33,  64, 188,  37,  34, // E./....!@.%"
+  69, 170, 120, 196,   1,  73,   7,  28, 174, 180,  67,  88, // E.x..I....CX
+  59,  91,  75, 111,  14, 112, 230, 245,  50, 235, 191, 171, // ;[Ko.p..2...
+   3,  33,  99, 122,  51,  94,  27, 200,  93,  39, 116,  68, // .!cz3^..]'tD
+ 154, 119, 182, 162, 124, 197, 223, 220,  34, 216, 220, 215, // .w..|..."...
+  33, 163, 195, 134, 185, 153, 149,  72, 187, 226, 126, 119, // !......H..~w
+ 101, 165, 243, 139, 177, 183,  49, 217, 112, 118,  63,  97, // e.....1.pv?a
+   5, 107,  26, 194,  32, 237, 230,  35,  26,   2, 255,  58, // .k.. ..#...:
+  67,   0, 115, 128,  63, 130, 169,  51, 237,  34, 223, 168, // C.s.?..3."..
+ 222, 104,  51, 176,  40, 131, 232,   4,  84,  50, 204, 225, // .h3.(...T2..
+ 254, 190,  46, 250,  53,  70, 197, 101, 236,  46, 118, 183, // ....5F.e..v.
+  52, 243, 194,  34, 240,   3, 163,  17, 203, 125, 173,  99, // 4..".....}.c
+ 233, 121, 251,   6, 226, 124,  80, 191, 181, 187,  83, 134, // .y...|P...S.
+  96,  93,  53, 116, 179,  41, 181, 107,  12, 193, 186, 108, // `]5t.).k...l
+   8,  54,  34, 186, 217,  90,  61, 209, 147,  60,   8, 174, // .6"..Z=..<..
+  45, 141,  17, 250, 212, 246,  24,  20, 177, 252, 180, 172, // -...........
+  49,  88, 196, 118,  87, 137,  49,  51, 162, 162,  61, 148, // 1X.vW.13..=.
+ 161,  25, 214,  86, 110, 137, 168, 134, 181, 244, 111, 244, // ...Vn.....o.
+ 187, 111,  28, 230,  75,  81,   4,  92,  17, 148, 123,   8, // .o..KQ....{.
+  37, 114,  46, 196, 207,  12, 156, 188, 149,  39, 180,  50, // %r.......'.2
+  28, 215, 226, 178, 157, 148, 124, 155, 217,  73, 178, 111, // ......|..I.o
+  18, 153, 185, 228,   4, 187,  31, 146, 214, 231, 194,   1, // ............
+ 112, 245, 138, 223, 104, 105, 184,  25,  66, 205,  52, 117, // p...hi..B.4u
+  27,  44,  78, 132, 104, 133, 213, 144, 160, 117, 107, 212, // .,N.h....uk.
+  58, 172,   2, 165, 168,  74,   6,  19, 198,   9, 155, 130, // :....J......
+  19, 110,  49, 245, 250, 220, 143,  63, 208,  34,  21,  79, // .n1....?.".O
+ 224, 218, 159,  30, 217,  36,  77,  21, 239, 245,  43,  29, // .....$M...+.
+ 252,  47, 245,  99, 206, 247, 134, 244, 248, 174,  44, 255, // ./.c......,.
+ 174,  90, 254,  93,  89, 254,  93,  89, 254,  25,  82, 223, // .Z.]Y.]Y..R.
+ 233,  71,  74, 253,  74, 187, 227, 169, 214,  72, 249, 232, // .GJ.J....H..
+  23, 239,  96, 141,  71,   9,  90,  13, 142,  82, 190, 114, // ..`.G.Z..R.r
+ 138, 131, 106, 206, 247, 226,  36, 140,  21, 239, 123, 171, // ..j...$...{.
+  98, 153,  42, 232, 243, 133, 153, 248, 196, 205,  39, 129, // b.*.......'.
+ 235, 147,  41,   6,  21, 105, 228,  45,   0, 223,  40, 106, // ..)..i.-..(j
+ 182,  56, 226, 124, 219,   3,  26, 245,  66, 233, 120,  86, // .8.|....B.xV
+ 135,   8,  31, 230, 158, 112, 127, 145, 183,  83, 108,  53, // .....p...Sl5
+ 165,  11, 114,  23, 169, 164, 244, 204, 131,  59,  23, 157, // ..r......;..
+ 195, 118, 123,  82,  17, 189,  22, 239,  67,  61,  31, 200, // .v{R....C=..
+ 211, 165,  67, 253,  57, 242,  63, 133, 152,  21,   9, 222, // ..C.9.?.....
+ 110, 148, 148, 249, 153,  22, 244,  59,  88, 217, 228,  53, // n......;X..5
+  68, 225, 201,  67,  72, 165,  33, 125, 254,  35,  74, 238, // D..CH.!}.#J.
+ 105, 113, 201, 179, 136, 120, 156, 109, 190,  75,  41, 158, // iq...x.m.K).
+  16,  49, 255, 231, 197,  69, 241, 158, 126, 127, 165, 223, // .1...E..~...
+ 151, 244,  75, 100, 115, 241, 137, 126, 127, 167, 193,  50, // ..Kds..~...2
+  58, 212, 199, 101, 241, 114,  13, 222,  50, 163, 226, 211, // :..e.r..2...
+  90, 241, 123, 171, 188, 132, 134, 125, 200,  93, 247,  56, // Z.{....}.].8
+   9, 206, 245, 243, 205,  40, 134, 242,  19, 141, 237,  38, // .....(.....&
+ 241, 214, 201, 198, 141,  27, 111, 125, 226, 195,  62, 250, // ......o}..>.
+  58,  63,  80, 246, 246,  56, 185, 205, 153, 136,  58, 198, // :?P..8....:.
+ 217, 244,  77, 160, 243,  42, 129,  35, 203, 139,  77, 113, // ..M..*.#..Mq
+  95, 146, 156,  17,  73, 199, 237, 156, 242,  67, 129, 171, // _...I....C..
+ 233,  99, 214,  98,  59, 246,  57, 147, 173, 174, 233, 249, // .c.b;.9.....
+  84,  63,  75, 165,  56, 131, 211,  67, 219, 255, 159,   9, // T?K.8..C....
+ 216,  15, 203, 227,  48,  61,  52, 218,  21, 150, 156,  79, // ....0=4....O
+  56,  28, 229, 161,  29, 151,  41, 162, 159, 245,  24, 233, // 8.....).....
+  73,  86, 139,  95,  30,   5, 207, 253, 244,   0,   8, 242, // IV._........
+ 144,  26,  39,  10, 247,  79, 168, 183,  22, 191,  70, 197, // ..'..O....F.
+ 123, 232,  64, 163,  39, 191, 211, 116,  78, 204,  25,  13, // {.@.'..tN...
+  71,  31, 178, 179, 154, 147, 226,  29,  31, 252,  95, 197, // G........._.
+  54,  14, 194, 154, 184, 147, 179, 115,  16,   4,  38,  48, // 6......s..&0
+ 224,  94, 130, 121, 105, 203, 244,   0,  37,  97,  70, 210, // .^.yi...%aF.
+ 112, 217, 100,  14,  40, 101, 138, 192,  88, 193, 142,  30, // p.d.(e..X...
+ 131, 247, 211,  35, 154, 142,  64, 148, 170,   3, 101,  87, // ...#..@...eW
+  22,  11, 235, 167,  15, 228,  26, 154, 206,  71, 222, 231, // .........G..
+ 119, 101, 187, 247,  77,  25, 163,  14,  95, 220,  65, 225, // we..M..._.A.
+ 231, 192,   8, 119, 184,  72, 252,  26, 204, 238, 107,  28, // ...w.H....k.
+ 172, 165, 163, 129,  38, 247,  34, 143,  59, 189,  51, 116, // ....&.".;.3t
+ 131, 111,  54, 133, 255, 118,  56, 225, 113,  37, 116, 198, // .o6..v8.q%t.
+ 148,  17, 149, 166,  76,  13,  87,  87, 134,  18, 183, 228, // ....L.WW....
+ 166, 235,   5,  34,   6, 103, 193,  18,   2, 214,  68,  22, // ...".g....D.
+  74,  21, 228,  38,  43, 112, 130, 201,  41, 132,  88, 212, // J..&+p..).X.
+  80, 142, 164, 150,  99, 118, 162,  63, 137,  53, 131, 215, // P...cv.?.5..
+  44, 153,  96, 107, 202, 178,  36,  37, 233, 168, 141, 235, // ,.`k..$%....
+ 205, 219,  82,  95, 189, 112,  40, 147,  22,  27,  28, 221, // ..R_.p(.....
+ 184, 177, 110, 141, 136,  96, 255, 167,  69,  32, 104, 233, // ..n..`..E h.
+ 141, 252, 106, 174,  76,  90, 228,  52, 195, 151, 105,  30, // ..j.LZ.4..i.
+ 195,  52, 196,  63,   4, 254,  74, 168, 179, 130, 233,  50, // .4.?..J....2
+ 173, 185,  62,  97, 139, 251, 162, 123,  88, 161,  42, 176, // ..>a...{X.*.
+  32, 231,  44, 113, 128, 152, 163,  80, 152,  39,   2,   2, //  .,q...P.'..
+ 196,  51,  42, 104,  20, 185, 115, 195,  84, 141, 124, 234, // .3*h..s.T.|.
+ 167,   3,  81, 123, 200,  99, 128,  78, 100,  67, 129, 108, // ..Q{.c.NdC.l
+ 226, 148, 224, 235, 255,  37, 208, 189, 243, 110,  87,  67, // .....%...nWC
+ 238, 144, 210, 202, 199,  32, 221,   8,   7, 137, 221, 124, // ..... .....|
+ 151, 151, 189, 207, 154, 194, 121, 231,  64, 165, 195,  40, // ......y.@..(
+ 237, 175,  18, 239, 218, 195, 239,  89,  73, 166,   2,  27, // .......YI...
+ 156, 226, 167,  41, 234,  92,  90,  39, 229, 148, 136, 217, // ...)..Z'....
+ 119,   1, 131,  42, 104, 227, 100, 189, 146, 123, 166, 115, // w..*h.d..{.s
+  29, 195, 166, 100,  35, 130,  36, 232, 118, 148, 172,  67, // ...d#.$.v..C
+ 164,  73, 111, 235, 252,   6,  43, 192, 194, 234, 248, 166, // .Io...+.....
+ 172,  28,   3, 236,  35, 221,  60,  20, 199,  10,   9, 109, // ....#.<....m
+  60, 214, 240,  51, 174, 194,  57,  54,   9,   8,  70, 120, // <..3..96..Fx
+ 255, 107, 216,  56,  50, 240,   2, 216,  48, 250, 212,  48, // .k.82...0..0
+   1, 209, 223,  82,  27,   7, 145, 222, 113, 109, 238, 168, // ...R....qm..
+ 164, 123, 216, 134, 168, 171,  29, 191,  11, 227,  15, 129, // .{..........
+  54, 175, 177, 251, 224, 200, 222, 243, 167,  70, 179, 109, // 6........F.m
+ 138, 121,  35, 212,   2, 209,   8, 171, 167,  48, 138, 122, // .y#......0.z
+ 196,   1, 114,  14,  16, 191, 128, 213, 232, 204, 149, 184, // ..r.........
+  65,  50, 210, 174,  27, 123,  40, 221,  51, 162,  90, 222, // A2...{(.3.Z.
+ 119,  98, 136, 197, 228, 110, 197, 197,  75, 122,  44, 122, // wb...n..Kz,z
+  50, 160,  77, 173,  28,   8,  10, 147, 238, 141, 128, 232, // 2.M.........
+ 193,  44,  69, 175, 204,  73, 169, 197,  71, 196, 209, 193, // .,E..I..G...
+  16, 243,  72,  44,  74,  43, 122,  96, 218,  65, 104, 169, // ..H,J+z`.Ah.
+ 222, 154, 129, 108, 198,  21,  84, 174, 245, 252,  10,  62, // ...l..T....>
+  76,  51, 202, 161,   2, 173, 212, 232, 105, 106,  39,  21, // L3......ij'.
+  68,   3, 243,  61,  29, 124, 232, 153,   6,  84, 252, 105, // D..=.|...T.i
+  39, 219, 149, 103,  88,  46,  88, 158, 231, 152, 146,  89, // '..gX.X....Y
+  35,   6, 217, 162,  79, 151,  17,  61,  62,  40, 206, 216, // #...O..=>(..
+ 136, 166,  71,  91, 235,  72, 138, 240, 239,  76,  17,  54, // ..G[.H...L.6
+ 140, 120, 133, 241, 208, 140, 242, 110, 243, 173, 214, 191, // .x.....n....
+ 145,  76, 204,  25,  28, 211, 242, 173, 198,  22,   6,  17, // .L..........
+ 179, 151,  67,  77,  85,  16, 130,  76,  69, 167,  83, 190, // ..CMU..LE.S.
+ 134, 179, 248,  94, 155, 219, 214, 209, 106, 120,  32,  12, // ...^....jx .
+  55, 132,  52, 190, 177, 250,  99,   8,  91,  76, 209, 132, // 7.4...c.[L..
+ 172, 106, 250, 188, 149, 129,  77, 169, 102, 137, 150,  68, // .j....M.f..D
+ 191, 237, 211,  66, 167, 211, 206,  50,  74, 153,  23, 223, // ...B...2J...
+ 248, 167, 211,  46, 161, 157, 124, 214, 160,  72, 231, 124, // ......|..H.|
+ 198, 170,  18,  90, 249,  34, 117,  32,  77, 235,  12, 193, // ...Z."u M...
+ 204,   6,  35, 126,  89,  77, 206,  69, 183,  64,  35,   7, // ..#~YM.E.@#.
+ 217,  98, 233, 145,  65,  22, 162,  96, 149,  30,  43, 209, // .b..A..`..+.
+ 242, 186,  15, 111, 115,  85,  29, 175, 107,  59,  13,  81, // ...osU..k;.Q
+ 241, 111,  86, 163, 171, 212,  11, 251, 173, 212,  11, 107, // .oV........k
+ 176,  43,  24, 105, 120,  94,  67, 247, 253, 248,  55, 248, // .+.ix^C...7.
+ 219,  44, 245, 191, 166,  74, 201, 134,  96, 238, 255,  55, // .,...J..`..7
+  43, 249,  13, 203, 102, 217, 193, 145,  32, 148, 179, 232, // +...f... ...
+  92, 162,  32,  45,  53, 156,  43, 221, 244, 212, 175, 222, // .. -5.+.....
+ 120, 191, 199, 197, 118, 202,  84, 122, 177,  22, 215, 217, // x...v.Tz....
+ 177, 177,  24,  37,  48, 105, 104,  56, 212, 226, 101, 203, // ...%0ih8..e.
+ 228, 112,  89,  92,  87, 127,  10, 234,  52, 225, 236, 185, // .pY.W...4...
+  27,  51, 192, 233, 121, 189,  48,  74, 179,  25,  75,  59, // .3..y.0J..K;
+  16, 148, 113, 165,  88, 203, 111, 250, 153,  56,  62,  26, // ..q.X.o..8>.
+ 224, 178,  44,  51,  18,  17,  97,  41, 136, 144,  29, 181, // ..,3..a)....
+ 227,   4, 145,  63,  58,  44, 221,  24, 181, 249, 238,  36, // ...?:,.....$
+ 106,  18,  76, 191,  95, 133, 116, 131, 198, 126, 179,   8, // j.L._.t..~..
+ 252, 142, 202, 140, 180, 195, 241,  94, 156, 106, 205, 117, // .......^.j.u
+ 198,  71,  29, 165, 169,  39, 104,  73, 112,  74, 102, 137, // .G...'hIpJf.
+ 168, 200, 189,  86,  73,  79, 156, 175, 132, 168,  22,   2, // ...VIO......
+ 203, 126, 152, 151, 116,  22, 190, 196, 174, 213, 154, 158, // .~..t.......
+   7, 234, 181, 138, 103,  52,  61, 237,  14, 125,  37, 154, // ....g4=..}%.
+ 166,  12, 186, 243,  52,  61,   3, 235,  42,   9, 230,  36, // ....4=..*..$
+  84, 209,  27,  56, 246, 148,  43, 124, 196,  61,  27,  73, // T..8..+|.=.I
+ 198, 220,  24,  99, 111, 124,  90, 196,  24, 129,  86, 105, // ...co|Z...Vi
+ 246, 217,  80,  68, 174,  50,  39, 246, 211, 247, 157,  36, // ..PD.2'....$
+  74,  79,  93, 111,  76, 165, 183,  95,  28,  84, 144, 109, // JO]oL.._.T.m
+ 151, 126, 157,  68, 212, 157, 176,  75, 148, 151, 248, 109, // .~.D...K...m
+  16,  39,  33, 110, 158, 108, 214,   6,  12,  84,  18, 120, // .'!n.l...T.x
+ 104, 104,   4,  26, 126,  31, 136, 181,  78, 233,  70,  88, // hh..~...N.FX
+  52, 138, 245, 217,  22, 179, 215, 125,  67, 208, 177, 211, // 4......}C...
+  97,   1, 203,  23, 142, 221,  75, 186,  31, 166,  39,  42, // a.....K...'*
+ 253, 198,  87, 194,  78, 146,   3, 174, 207, 101, 232, 101, // ..W.N....e.e
+ 196, 130, 152, 229, 181, 109, 249, 153, 185, 104,  43, 186, // .....m...h+.
+ 124,  72,  77, 130,  80,  76, 123, 224, 158,   9,  37, 137, // |HM.PL{...%.
+ 211, 232, 234,  11,  55, 188,  50,  81,  73, 191,  81, 209, // ....7.2QI.Q.
+ 229,  56, 202, 238, 125, 203, 180,   2,  27, 156, 127, 177, // .8..}.......
+  85, 140,  24, 168,  31,   7, 213, 123, 105, 235,  91, 141, // U......{i.[.
+  47, 198,  17, 238, 165, 193,  54, 139, 162, 119, 149, 124, // /.....6..w.|
+   8, 199, 172,  38,  17,  21, 199, 237, 212,  97, 249, 241, // ...&.....a..
+ 101, 187,  93,  60, 215, 150, 233,  62,  45, 152, 228, 154, // e.]<...>-...
+ 219,   1, 235,  26,  41, 227, 139,   8, 220, 133, 162, 248, // ....).......
+ 249,  94, 136, 104,  98,  70, 217, 147, 239,  64,  88, 235, // .^.hbF...@X.
+ 181, 203, 247,  65, 124, 174,  24,  50, 217,  17, 155, 177, // ...A|..2....
+  90, 189, 205,  10, 202, 241, 174, 248, 114, 115,  49,  51, // Z.......rs13
+ 108,  77, 245, 130, 218,  62, 174, 250, 211,  41,  34, 183, // lM...>...)".
+ 121, 184, 252, 174,  10,  80, 139, 160, 216, 131, 194,  31, // y....P......
+ 113,  77, 187, 142,  62, 233, 106, 154, 245, 226, 247,  98, // qM..>.j....b
+  33, 178, 147, 238,  10,  67,  15, 242,  93,  77,  17,  14, // !....C..]M..
+ 207, 197,  70, 215, 221, 168,  15,  42,  42,  66, 173, 228, // ..F....**B..
+  78, 132, 219,  52, 162, 241,  18, 181, 195, 247, 106, 187, // N..4......j.
+  32, 166,  88, 211,  20, 211, 135,  20,  38, 216,  24,  11, //  .X.....&...
+ 208, 171,  80,  90,  40, 238,  80, 123,  37, 151, 152,  46, // ..PZ(.P{%...
+ 100,  16,  81, 143,  57, 219, 222,  69, 113,  71,  75,   8, // d.Q.9..EqGK.
+ 167,  77, 183, 114,   7, 130,  57, 133, 101,  77,  91, 169, // .M.r..9.eM[.
+ 208,  19, 201, 131, 139, 139, 100, 121, 139, 182, 232, 121, // ......dy...y
+  26, 137, 125,  81, 213, 191, 232,  60, 176,  99, 223, 248, // ..}Q...<.c..
+ 179, 103, 110,  60, 125, 230, 182, 128, 144, 166, 112, 141, // .gn<}.....p.
+ 177, 155, 173,  32, 157, 210, 154, 216,  55, 123,  33, 149, // ... ....7{!.
+  21, 104,   4, 101,  28,  92, 104,  29,  26, 125,  67, 219, // .h.e..h..}C.
+  89,  66,  78, 132,  79, 124, 103, 227,  22,  33, 205, 101, // YBN.O|g..!.e
+ 252, 177, 130, 127,   8,  93, 159, 248, 124, 113, 147, 178, // .....]..|q..
+ 241,  85,   6,  21,  85, 135, 167, 158,   3, 106, 194,  90, // .U..U....j.Z
+ 107, 201,  37, 237, 159,   4,   1, 179,   8, 148, 225,  29, // k.%.........
+  84,  31, 160, 250, 166,  65, 174, 107, 113, 173, 178, 211, // T....A.kq...
+ 217,  13, 249, 183, 137,  71, 104,  11,  89, 187,  60, 150, // .....Gh.Y.<.
+ 165, 177, 164,  75, 245, 245, 231, 221, 153, 207, 187, 229, // ...K........
+ 231, 221, 221,  22, 124,  61, 223, 185, 184, 232,  47,  69, // ....|=..../E
+ 163, 139, 139, 238,  82, 212,  81, 220, 124, 212, 213, 190, // ....R.Q.|...
+ 249, 187, 184,   9,  47, 194,  19, 223, 212, 208,  40, 107, // ..../.....(k
+ 224,  71,  51, 210, 150, 185,  54,  26, 184, 134,  33,  32, // .G3...6...! 
+  99, 117,  79, 250, 109,  90, 180, 112, 219, 239,  43, 173, // cuO.mZ.p..+.
+ 159, 251, 126, 103,  96,  34, 151, 240, 243, 116,  60,  19, // ..~g`"...t<.
+  58, 125, 116, 181, 123, 134, 138, 235,  27, 230, 177,  57, // :}t.{......9
+ 181,  20, 112,  51,  75,  36,  41,  14,  85, 153, 132, 174, // ..p3K$).U...
+   8, 252, 240, 249, 187, 173, 194, 114, 174,  71, 108, 206, // .......r.Gl.
+ 200, 208, 185,  20,  89,  34, 128, 207,  19, 221,  25, 168, // ....Y"......
+ 240,  53, 182,  50, 113,  31, 150,  47,  69,   4, 198, 125, // .5.2q../E..}
+ 126, 129, 136, 142, 195,  82, 112, 140, 144, 108, 171,  31, // ~....Rp..l..
+ 246, 183, 178, 144,  95, 240,  64,   9,  40, 241, 142,  56, // ...._.@.(..8
+ 190, 199, 145, 145,  21, 233,  55, 190, 136, 112,  56, 164, // ......7..p8.
+  56,  26,  66, 122,  76, 228,  37, 193,  21,  61,  65,   2, // 8.BzL.%..=A.
+ 115, 167,   2, 237, 193, 249, 210, 124, 237, 192,  98,  37, // s......|..b%
+ 105, 165,  75, 209, 119,  45,  94,  38,  40, 253, 206, 230, // i.K.w-^&(...
+ 232, 240,   7,  58, 215,  52,  70,  85,  45, 109,  56, 208, // ...:.4FU-m8.
+  32, 250, 167, 133,  55, 165, 129,  66, 169,   3, 228,  36, //  ...7..B...$
+ 150,  42, 109, 137,  38, 133, 172,  10,   6,  24, 220, 145, // .*m.&.......
+  99, 224, 192, 118, 181,  86, 138,  55, 130, 157, 166, 182, // c..v.V.7....
+  27, 140,  35, 145, 242,   6, 173, 220, 156, 144,   3, 115, // ..#........s
+  64,  26, 243,  26, 246,  76,  35, 148, 134,  76,  29,  21, // @....L#..L..
+ 133,   8,  94, 193, 177, 154, 211,  31,  45, 207, 133, 187, // ..^.....-...
+ 154,  69,  74, 140, 197, 138, 231, 209,  44, 101,  75, 209, // .EJ.....,eK.
+ 163, 114, 150,  30, 233,  89, 202, 202,  89, 210, 116, 141, // .r...Y..Y.t.
+ 184, 218, 180, 169, 154,  76, 170,  38, 150, 145,  84, 161, // .....L.&..T.
+  23,  82, 172, 173, 115,  54,  49, 160, 213,   2, 111, 129, // .R..s61...o.
+  99, 219, 245, 196, 230,  19, 161, 163, 231,  25, 211, 214, // c...........
+ 129,  21,   0,  54,  87,  46,  66, 180, 104, 224, 202, 208, // ...6W.B.h...
+ 114,  45,  63,  27,  56, 178, 179, 201, 164,  34,  62,  75, // r-?.8....">K
+ 187, 129,  35,  38, 229,  11,  89, 120,  50, 138, 128, 231, // ..#&..Yx2...
+  36, 224, 208,  78,  10,  27,   0, 122,  63, 130,  92,  66, // $..N...z?..B
+  95, 198, 218, 120, 178, 112, 123, 107,  74, 142, 203, 100, // _..x.p{kJ..d
+ 136,   5, 120, 229, 134, 209, 120, 117, 143,  37,   3, 244, // ..x...xu.%..
+ 123, 166, 210,  33,  81, 250, 218,  24, 173, 244, 219,  46, // {..!Q.......
+ 126, 248,  15, 153,   3,  63, 208, 252, 248, 145, 225, 196, // ~....?......
+ 247,  38,  28,  12,   7,  44, 134,  58,  46,  35, 225,   8, // .&...,.:.#..
+ 185,   5, 191, 238, 150,  64,  83, 167, 145,  85, 251, 129, // .....@S..U..
+   7, 251,  14, 194,   3,  88, 195, 149, 129, 159,  32,  58, // .....X.... :
+ 227,  41, 229,  13, 219, 216,  58, 199, 109, 127,  28,  29, // .)....:.m...
+  18, 182,  59, 162,  93,  51, 142,  14, 232, 105,  15,  88, // ..;.]3...i.X
+  78,  40, 180, 148, 136, 181, 216,  31,  18, 254,  61, 243, // N(........=.
+  89, 205, 167, 207,  56,  73, 245,  36, 101, 165,  91, 166, // Y...8I.$e.[.
+   5, 234,  79, 191,  87,  31,  66,  53, 155, 190, 226,  72, // ..O.W.B5...H
+ 123, 251, 212,  74, 175, 141, 205, 125,  73,  43,  88, 195, // {..J...}I+X.
+ 111, 210, 202,  54, 183,  50,  66, 141, 185, 180, 178, 173, // o..6.2B.....
+  91, 177, 105, 110,  43, 223, 168, 149, 220,  88,  84, 189, // [.in+....XT.
+ 246, 221, 195,   6,  88, 235,  78,  61, 129, 115,  20, 122, // ....X.N=.s.z
+  76, 227, 122, 178,  25, 104, 221,  91, 193,  21,  86,  50, // L.z..h.[..V2
+ 215, 138,  33, 123,  34,  84, 162, 197,  55, 196, 252, 110, // ..!{"T..7..n
+ 225,   1,  24, 207, 136, 114, 160,   8, 108, 210,  90, 154, // .....r..l.Z.
+  42, 131, 246, 113, 127, 117, 156,  14, 244, 253,  59,  33, // *..q.u....;!
+ 204,  33, 134, 139, 227, 141, 232, 252,  45, 130,  65,  96, // .!......-.A`
+   9, 254, 229, 229, 198,  93, 221,  86, 220, 166, 196, 165, // .....].V....
+  70,  72,  69, 160, 197,  30,  74, 139, 210, 134, 175, 193, // FHE...J.....
+  66, 106, 224, 114,  68, 245,  15,  69, 211, 201, 202, 128, // Bj.rD..E....
+ 162, 228,  46,  48, 127,   1,   9,  80, 148, 252, 140, 103, // ...0...P...g
+  48, 176, 188,  78,  28, 136, 128, 134,  91, 103, 229, 119, // 0..N....[g.w
+ 106,  81,  79,  17,  94, 180, 102, 210,  21, 213, 124, 155, // jQO.^.f...|.
+ 173,   6, 157, 146, 245,  12, 202, 145, 112,  74, 131,  63, // ........pJ.?
+  16, 219,  38,  64, 121, 159,  96,  60,  74,   9, 247, 208, // ..&@y.`<J...
+ 195,  25,  13, 192, 208,  11,  76, 242,  37, 142, 254, 100, // ......L.%..d
+ 250,  88, 246,  24, 171, 245, 219,  61, 214, 162,  39,  77, // .X.....=..'M
+ 253,  53, 118, 141,  51, 150, 246,  60, 242,  32, 208,  30, // .5v.3..<. ..
+ 185, 108, 249, 166,  41,  95, 160, 252, 204,  25, 166, 227, // .l..)_......
+ 106,  19, 251, 222,  87, 134, 140,  19,  76, 160, 189, 208, // j...W...L...
+  39, 123,  86,  81, 161,  74, 220,   0,  50, 196, 220,  89, // '{VQ.J..2..Y
+ 107,  17, 189, 106, 211, 169,  71, 147, 112, 236,  63, 214, // k..j..G.p.?.
+  68,  17, 245, 134, 146, 218,  85,  74, 137,  18,  31,  27, // D.....UJ....
+ 102, 173,  44,  56, 153, 176, 128,  89, 179,   8, 169, 130, // f.,8...Y....
+ 164,  57, 152, 166,  82, 133, 253, 241, 140,  88,  65, 136, // .9..R....XA.
+ 214,  40, 125,  46, 135, 196, 114,  52,  37,  95, 219, 246, // .(}...r4%_..
+  99,  22, 140, 210,  76,  73,  94, 200, 245, 104,  63, 220, // c...LI^..h?.
+ 196, 120,  46,  71, 241,  59, 160, 235, 251,  56, 182,   6, // .x.G.;...8..
+ 233, 193, 131, 100,  16, 167,   5, 203, 225,  93, 165, 195, // ...d.....]..
+ 244, 237,  84,   0,  39, 203, 127, 166,  93,  43, 235, 145, // ..T.'...]+..
+ 136, 158,  76,  15,  31,  81,  37,  31, 167, 222,  63,   1, // ..L..Q%...?.
+  50, 190,  87,  84,  10,  33, 112,  55,  46,  37, 172, 111, // 2.WT.!p7.%.o
+ 137, 182,  43, 143,  39, 150, 144,  94,  11,  45, 155, 119, // ..+.'..^.-.w
+ 123, 244, 125,  86,  57, 209,   2,  17,  81,   7, 203, 212, // {.}V9...Q...
+ 173, 109, 118, 125, 226,  50, 200, 113, 192, 113, 190, 121, // .mv}.2.q.q.y
+ 144,  31, 235, 233, 178, 102,  28, 109, 218,  39, 164,  17, // .....f.m.'..
+ 138,  21,  53,  15, 166, 166,  17, 221,  96, 203,  94, 193, // ..5.....`.^.
+  19, 183,   9,  34, 152, 111, 226,  83,  56, 126,  20, 165, // ...".o.S8~..
+  47,   2, 214, 129, 123,  32,  16,  57, 233,  98, 127, 125, // /...{ .9.b.}
+ 165, 222, 209,  16, 169, 118,   8, 171, 227, 213,  28,  31, // .....v......
+ 236,  78, 212,  30,  31, 116,  14,  74,  24,  79, 200, 176, // .N...t.J.O..
+   6, 189, 152, 239, 226, 196, 131, 104, 133, 252,  63, 154, // .......h..?.
+  38, 255, 213,  94, 116, 216,  78, 195, 132, 206, 128,  67, // &..^t.N....C
+ 142,  46,   5, 224, 213, 176, 223, 109, 195,  39, 120,  55, // .......m.'x7
+ 104, 199, 219, 136,  83, 139,  43,   7, 117,   0,  23,   7, // h...S.+.u...
+  32,  15, 247, 214, 252, 195, 118,  30, 102, 193, 205,   3, //  .....v.f...
+  77,  56,  18, 209, 215, 238, 209, 161, 216, 231,  15, 198, // M8..........
+ 248,  96, 176, 171, 142, 204,   7, 199, 248,  32,  11, 243, // .`....... ..
+ 224, 230, 145, 154, 194, 154, 180,  75, 136, 239,  76,  49, // .......K..L1
+ 169, 147,   9, 124,  32,  36, 224,  34, 138, 151, 240,   6, // ...| $."....
+  40,  94,  31, 246,  16,  55, 231,  37,  16,   6, 231, 124, // (^...7.%...|
+ 130, 171, 122, 192,   6, 114,  82, 102, 122,   2,   5, 237, // ..z..rRfz...
+ 223,  91,  17,  49,  78, 155,  84, 213,  14,  43,  52,  86, // .[.1N.T..+4V
+ 152,  45,  96,  33, 232, 154, 211,  14,   4, 223,  79,  27, // .-`!......O.
+  85, 135,  14, 238, 197, 253,  65, 202,  65, 186, 227, 188, // U.....A.A...
+  56,  67,  81,  47, 103,  80,  63,  39,  40,  15, 225,  69, // 8CQ/gP?'(..E
+ 126,  22,  66, 210, 101, 227, 120,  55, 125,  20, 157,  27, // ~.B.e.x7}...
+  89, 183, 145, 114,  27,  25,  56, 203, 190,  93, 153, 214, // Y..r..8..]..
+ 107, 232,  59,  30, 249, 233, 163, 170, 235, 243, 244,  94, // k.;........^
+ 117, 175, 224,  42, 160, 161,   4, 105, 107,  44, 200,  40, // u..*...ik,.(
+  16, 160,  63, 179,  29, 228,  10, 202, 137, 148, 120, 223, // ..?.......x.
+ 239,  41, 162,  13, 238,  75, 250,  75, 127,   8,  28,  37, // .)...K.K...%
+  10, 158,  26,  71, 177, 232,  18, 189,  23,  18,  97, 192, // ...G......a.
+  29, 237, 104,  18,  97, 100, 134,  49, 158,  68, 233,  97, // ..h.ad.1.D.a
+ 235,  19,  29,  56,  79, 136, 219, 248,  53,  34,  24,  72, // ...8O...5".H
+ 163, 177, 226, 147, 177, 236, 250, 253, 153, 174,  95, 217, // .........._.
+ 227, 166, 241,  49, 125, 117, 243, 236, 138, 164, 113, 113, // ...1}u....qq
+  49, 222, 106, 208, 233, 254, 137, 142, 197, 139, 139,  39, // 1.j........'
+ 196, 252,  92,  92, 252, 202, 140,  80,  76,  36,  54,  91, // .......PL$6[
+ 217,  17,  78,  33,  78,  80, 223, 217,  81, 219, 230, 118, // ..N!NP..Q..v
+ 229, 198,  13, 228,  24,  56, 131, 202, 252,   8,  97,  87, // .....8....aW
+   8, 214, 198, 149, 243,  27,   2,  27, 240,  84, 176, 170, // .........T..
+ 195,  17,  27, 141, 228, 172, 148,  59,  28,  45, 199,  10, // .......;.-..
+ 248,  97, 165, 192,  35, 206, 192, 224,  82,  53,  81, 246, // .a..#...R5Q.
+  24,  88, 122, 118,  19, 181, 182,  66, 116, 179,  16,  62, // .Xzv...Bt..>
+ 133,  47,  25, 168, 194, 100, 133,  25,  65,  60, 129,  19, // ./...d..A<..
+ 154,  88, 210, 163,   6, 193,   0, 161,  76, 185, 241, 209, // .X......L...
+  30,  62, 204, 147, 114,  16, 106, 229,  54, 210,  88,  21, // .>..r.j.6.X.
+  51,  44,  60, 244, 217,  79,  42,  65,  65, 111, 230, 164, // 3,<..O*AAo..
+  98,  40, 112,  86, 242,  33, 235,  80,  76, 139,   9,  97, // b(pV.!.PL..a
+ 230, 199, 107,  94, 130,  24, 213, 118, 116, 101, 109, 111, // ..k^...vtemo
+   8, 212,  29, 253, 130, 228,   0,  65, 138, 230, 232,  77, // .......A...M
+ 112,  24,   2,   9, 216, 144, 190, 209,  91, 234,  41, 244, // p.......[.).
+  97, 211, 167, 240, 112,  54, 138, 123, 217,   9,  33, 152, // a...p6.{..!.
+ 123, 202, 188,  99,  63,  71, 233,  91, 251,  62, 166, 109, // {..c?G.[.>.m
+ 114,  31, 111, 189, 253, 132, 173, 250, 163, 244,  33,  94, // r.o.......!^
+  75, 145, 185,  19,  83, 250, 188,  78, 135,  35,  97,  20, // K...S..N.#a.
+ 159,   5, 157, 140,  60, 119, 214, 119,   3, 109, 171,  10, // ....<w.w.m..
+  37,  96,  54, 165,  79, 245,  92,  78,  28,  49,  12, 237, // %`6.O..N.1..
+  43, 218,  73, 239,  84, 122, 143,  61,   8, 244, 249, 249, // +.I.Tz.=....
+  45,  63,  31, 226, 153, 133, 172, 114, 112,  48, 142, 152, // -?.....rp0..
+ 112, 214,   1, 178, 166,  46, 131, 230, 248,  26, 136, 141, // p...........
+ 201, 115, 218, 101,   2, 191,  91, 178, 229,   9, 227,   2, // .s.e..[.....
+ 168, 181,  84,  24, 211, 148,  57, 211, 158, 176, 166,  61, // ..T...9....=
+  60,  67,  57, 157,   0,  12, 208,  18,  53,  27,  68,  96, // <C9.....5.D`
+ 130, 174,  32, 130,  17, 136, 148, 157,  46,  35,  13, 119, // .. ......#.w
+   2,  48,  63, 249, 132, 115,   8, 229,  19, 246,   9,  79, // .0?..s.....O
+ 228, 219,  86,  90, 180,  27, 172,  68,   1, 218,   1, 169, // ..VZ...D....
+  32, 228, 182, 210,   4, 169, 159,   2,  85,  61,  99,  21, //  .......U=c.
+  95,  87,  78, 244, 225,  38, 231, 218, 116,  17, 182, 114, // _WN..&..t..r
+ 235,  66,  30, 205,  83, 113, 196,  51, 246, 144, 224,  32, // .B..Sq.3... 
+  99, 159,  70, 184, 109, 141, 115,  27, 226,  35,  74, 183, // c.F.m.s..#J.
+ 245, 242, 179, 203, 251, 195,  44, 251,   6,  15, 233, 252, // ......,.....
+  43, 222, 217,  44, 108,  61, 179, 183, 115,  89,  59, 213, // +..,l=..sY;.
+ 225, 213, 119,  56, 105,  55,   8, 121,  47, 166, 127, 208, // ..w8i7.y/...
+  24, 254, 128,  17,  88,  85,  47, 158,  80,  66,  34, 125, // ....XU/.PB"}
+ 212,  43,  14, 159,  83, 151, 184, 157, 175,  94,  45,  74, // .+..S....^-J
+ 103,   2, 170, 152, 232,  76, 159, 127, 228,  19,  27, 253, // g....L......
+ 131,  11, 224, 146, 209, 156,  14,  31,  74, 185,  51,   8, // ........J.3.
+  76, 190,  49, 133, 127,  82, 238, 131,   5,  81, 132, 245, // L.1..R...Q..
+  21, 205, 170,  81, 120,  62,  28, 239, 135, 241,  33,   2, // ...Qx>....!.
+ 244, 210, 207,  68, 162,  91,  35, 190, 243,  71, 229,  58, // ...D.[#..G.:
+  31,  44,  35,  76, 211,  33,  11,  56, 166,  18,   4, 108, // .,#L.!.8...l
+ 116,  26, 127, 216,  53, 193, 141, 119, 236, 149, 212, 174, // t...5..w....
+  64,  50,  77, 117, 208,  66, 200,  84,  13, 251, 214, 152, // @2Mu.B.T....
+ 217,  38, 136,  83, 133,  15, 129,  41,  78,  69, 101,  32, // .&.S...)NEe 
+ 143, 241,  17, 245,  92, 165,  95, 163, 226, 177,  79,  36, // ......_...O$
+ 183, 179,  32,  47, 167,  99,  89,  82,  89,  61,  30,  29, // .. /.cYRY=..
+ 216, 215, 205, 165, 230, 190, 206,  73, 118, 144, 199,  43, // .......Iv..+
+ 156, 147,  68, 118,  34, 136, 141,   7, 189, 104, 234, 207, // ..Dv"....h..
+  99, 127,  12, 111,  27,  28, 185, 151,  85,  41,  88, 143, // c..o....U)X.
+ 190, 141,  11, 218, 143, 250,  37,   8,  25,  91,  21,  63, // ......%..[.?
+  71, 150,  19, 247,  75, 197,  21, 130, 124, 115,  71, 178, // G...K...|sG.
+ 213,  16,  51, 103, 182, 107,  38, 180,  84, 104, 172,  84, // ..3g.k&.Th.T
+  24, 213,  17,  19, 176, 134,  58, 202, 225, 144,   5,  84, // ......:....T
+ 169, 207, 115, 244,  18, 103,  70,  60, 154,  55, 226, 167, // ..s..gF<.7..
+ 112,  87, 104, 238,  24, 156, 168, 129, 124, 123,   6, 233, // pWh.....|{..
+ 205,  89, 228, 136, 193, 169,  93,  29, 136,  57, 231, 253, // .Y....]..9..
+ 162, 189,  10, 198, 226, 214, 144,  53,  95, 104, 160,  15, // .......5_h..
+  13, 218,  84, 241, 155, 210, 129, 193, 235, 118, 249,  44, // ..T......v.,
+ 206,  10, 184, 122, 184, 154, 118, 238,  97, 147, 253, 138, // ...z..v.a...
+ 254, 215, 140, 111,  12, 237, 224,  45,  18, 119,  34,  42, // ...o...-.w"*
+ 118, 132, 133, 124, 135,  80, 186,  87, 210, 156,  76,  42, // v..|.P.W..L*
+ 206,  98,  88, 165,  33, 214,  84, 104,   5,  86, 113, 142, // .bX.!.Th.Vq.
+ 186, 223,   5,  90,  70, 157, 178, 145, 118,  43, 182,  46, // ...ZF...v+..
+ 169,  98, 237, 145,  42,  22, 197,  80, 157, 132,  71, 164, // .b..*..P..G.
+ 105,  37,  67,  78, 148, 103,  74,  93, 198, 117,   9,  84, // i%CN.gJ].u.T
+  48,  97, 125,  37,  79, 213, 157, 191, 207, 142, 192, 226, // 0a}%O.......
+ 128,  72, 134, 125,  45,  97, 138,  79, 252,  88, 110, 184, // .H.}-a.O.Xn.
+ 228,   3, 169, 146,  31, 233, 244, 195,  46,  49,  33,  82, // .........1!R
+ 254,  12, 179, 182, 118, 132, 250, 115,  88,  20,  97, 252, // ....v..sX.a.
+ 171, 184, 183,  17, 117,  76, 221,  61,  60, 195, 199, 216, // ....uL.=<...
+ 141,  27,  77, 231, 211, 187, 112, 154, 107, 222, 138,  23, // ..M...p.k...
+ 184,  50, 180, 111, 223, 194, 226,  36, 152, 239, 180,   9, // .2.o...$....
+ 169, 240, 129,  94, 201, 114,  18, 144, 207, 158, 250,  43, // ...^.r.....+
+   5, 220,  20, 148,  16,  73,  98, 165,  72,  37, 201, 220, // .....Ib.H%..
+ 153, 106, 135,  88,  35, 227,  25, 107,   4, 191, 199, 112, // .j.X#..k...p
+  38, 177, 132,  95,  92,  60, 181, 233, 227,  60, 160, 105, // &.._.<...<.i
+ 224, 140, 182, 117,  15, 155, 179,  83, 216,  48, 126, 139, // ...u...S.0~.
+  84,  80, 234,  47,  17, 126, 203, 120, 187, 177, 138, 167, // TP./.~.x....
+  84,  26, 115,  77,  37, 115, 218, 195,   3, 254, 187,  47, // T.sM%s...../
+  30, 169, 180, 163,  38, 243,  76,  51, 184, 177, 165, 103, // ....&.L3...g
+ 232, 226, 162,   9, 225,  47, 204, 249, 219, 229,  44, 242, // ...../....,.
+ 141, 149,  36,  22, 143, 194, 120,  24,  22, 223, 121,  18, // ..$...x...y.
+ 197, 226, 252, 208, 151, 167, 192,  56, 239, 122, 108, 147, // .......8.zl.
+ 237, 107,  96, 156,  19,  70, 177, 149,  83, 234, 157, 217, // .k`..F..S...
+ 144,  60,   1,  59, 171, 208,  26,  27,  61, 223, 216,  40, // .<.;....=..(
+ 238, 198,  86,  25,  55, 182, 138, 178, 218, 222, 138, 107, // ..V.7......k
+ 102,  69, 166, 228,   4, 231,   4,  56, 245, 213, 189,  56, // fE.....8...8
+  17, 109, 156, 206, 233,  96, 196,  33,  81,  88, 109,  98, // .m...`.!QXmb
+ 175, 189, 231, 218, 228,  61, 125, 251, 226, 249, 163, 132, // .....=}.....
+  89, 223, 182, 191,  87,  13, 177,  66, 155,  28, 104,  49, // Y...W..B..h1
+   8, 247, 184, 187, 175, 136, 203, 125,   5,  19, 198, 124, // .......}...|
+   2,  13, 143, 209, 136, 189,  83, 221,  87, 244, 210,  63, // ......S.W..?
+  42,  94, 142, 143, 162,  39, 120, 102, 253,  47, 188, 125, // *^...'xf./.}
+ 181, 111, 207, 179, 131, 232,  15, 251, 118,  15,  87, 212, // .o......v.W.
+ 209,  51, 188,  19,  97, 193,  62,  94, 185, 168,  13, 154, // .3..a.>^....
+ 133, 151, 175, 240,  35,  48, 131,  33, 230, 120, 131, 199, // ....#0.!.x..
+  77,   3, 174,  89, 162,  98,  58, 128, 113,  10, 143,  27, // M..Y.b:.q...
+  85, 227,  59, 199, 122,   1, 174,  93, 168,  70,  19,  49, // U.;.z..].F.1
+  28, 102,  78, 198,   2, 150, 211,  57, 150,  66, 197,  65, // .fN....9.B.A
+ 134, 190, 124,  66,  38,  33,  86, 216, 240, 197, 214, 132, // ..|B&!V.....
+ 182, 105, 162, 209,  45,  53, 160, 139, 226, 246, 206, 248, // .i..-5......
+ 222, 168, 104,  80, 198, 213,  91, 158, 194,  70,  10, 132, // ..hP..[..F..
+ 217, 124,  25, 208, 203, 232,   0,  84, 116, 200, 154,  13, // .|.....Tt...
+ 235,  66, 200, 141, 109, 215, 220,  42, 135,  32, 106, 207, // .B..m..*. j.
+  18,  45,  61, 169, 139,  17,   7, 226, 139,  90, 175, 207, // .-=......Z..
+ 108, 199,  20, 208, 148, 204, 203, 202,  40,  43, 171, 215, // l.......(+..
+  69, 121, 222,  90,  64, 233,  74,  89,  25, 190, 169, 126, // Ey.Z@.JY...~
+ 245, 253, 172, 158, 174,  52, 131, 181, 194, 185, 200,  18, // .....4......
+  75, 126,  56,  94,  92, 201,  81,  41,  70,  23, 229, 142, // K~8^..Q)F...
+ 253, 138,  99, 219, 146, 106, 127,  72,  81,  90,  78,  60, // ..c..j.HQZN<
+  81, 100, 238,  68, 114,   4,  62,  54,  16, 152, 191, 240, // Qd.Dr.>6....
+ 206, 170, 219, 248, 123,  73, 245, 198,  58, 157,  50,  16, // ....{I..:.2.
+ 100, 231,  38,  45, 177,  43,  50,  70,  30,  88,  72,  14, // d.&-.+2F.XH.
+ 187,  23,  88, 247, 104,  87,   6, 240,  22, 207,   6, 106, // ..X.hW.....j
+  48, 191,  85,  11,  43, 236,  23, 120,   7, 173, 238, 182, // 0.U.+..x....
+ 180,  43, 170, 129,  61, 233, 179,   9,  27,  19,  20,  19, // .+..=.......
+ 237, 191, 223,   4, 168, 187, 162, 105,  49, 196, 195, 240, // .......i1...
+ 113, 144,  77,   1,  61,  90, 207, 140, 123,  25, 166, 121, // q.M.=Z..{..y
+  57,  60, 223,  68,  62, 220, 225, 222,  50,  95,  72,  93, // 9<.D>...2_H]
+ 182, 147, 192, 206, 115, 234,  69, 192,  53, 150, 206, 104, // ....s.E.5..h
+  96, 195, 101, 188,  37, 207, 169, 158, 101, 123,  62, 202, // `.e.%...e{>.
+  67,  76,  19,  87,  99,  27, 198, 243, 175,  49, 229,  22, // CL.Wc....1..
+ 115,  48,  29, 184, 112,  48,  39, 190, 200,  40, 226, 136, // s0..p0'..(..
+ 187,  99,  61, 195,  89,  32, 183,  80, 218,  45,  41, 113, // .c=.Y .P.-)q
+ 233,  69,  27, 107, 134,  48,  39,  68, 201, 186, 107, 134, // .E.k.0'D..k.
+  78, 142, 230,  70,  44, 209, 151, 242,  57, 223, 253, 116, // N..F,...9..t
+ 196,  74,  84, 199,  29, 111,  55, 216,   0, 205,  31, 115, // .JT..o7....s
+  40,  70,  40, 107, 129, 139, 151,  37, 131, 214, 149, 164, // (F(k...%....
+  79, 252, 121, 118, 247, 250, 238, 139, 182,  91,  78,  76, // O.yv.....[NL
+  73, 203, 192, 228,  86, 214, 202, 202, 177,  23, 218,  95, // I...V......_
+ 233,  96,  43, 151, 175, 210, 104,  64, 133,  83, 209, 117, // .`+...h@.S.u
+ 118, 118,  37, 253, 173, 215, 119, 203,  91, 112,  42, 183, // vv%...w.[p*.
+ 210,  36, 144,  74, 167, 139, 209, 242, 172, 172, 236,  26, // .$.J........
+  47, 246, 129,  63, 198,  53,   6, 225, 108, 233, 244,  56, // /..?.5..l..8
+ 176,  17,  50, 211, 137,  70, 210,  15, 249, 104, 121, 137, // ..2..F...hy.
+  55, 113, 220,  30, 205,  81, 215, 208,  72, 199, 123, 247, // 7q...Q..H.{.
+ 246, 129, 199,  70,   8, 222, 163, 162, 187, 166, 223, 218, // ...F........
+   2, 167, 236, 230, 125,  37,  94, 185,  29, 223, 186,  25, // ....}%^.....
+  99,  54, 225, 162, 242, 123, 150, 198, 175, 250, 125,  64, // c6...{....}@
+   5,  77,  88, 193, 212,  11, 225,  40, 136, 231, 237,  55, // .MX....(...7
+ 184, 218, 123, 158, 129,  24, 219,  46, 242,  65, 122, 224, // ..{......Az.
+ 123, 113,  90, 127, 183, 237, 169, 115,  80, 100, 127,  80, // {qZ....sPd.P
+  13, 240, 128,  27,   4, 128, 173,  23, 180, 222, 131,  81, // ...........Q
+  76, 156,  78, 111, 228, 115,  43, 149,  20, 232, 157, 242, // L.No.s+.....
+ 192, 152, 105,  40,  30, 183,  16, 121, 145,  32, 254,  73, // ..i(...y. .I
+ 103,  24,  45, 112, 159, 178,  83, 186,  68,  96, 197, 174, // g.-p..S.D`..
+  84,  28,  56, 180,  83, 182, 113,  12,  99, 205, 215,  49, // T.8.S.q.c..1
+  87, 199,  85, 195,  58,  31, 129,  93, 163, 226, 137, 137, // W.U.:..]....
+ 216, 112, 164, 189,  53, 158, 107,  15,  28, 197, 221,   9, // .p..5.k.....
+  86, 124, 144,  18, 129,  28,  37,   8, 244,  55,  42,  98, // V|....%..7*b
+  58,  70,  29, 213,  52, 171,  68, 141,  80, 123,  29,  19, // :F..4.D.P{..
+ 133,  44, 149, 215,  81, 247,  97,  60, 234,  50, 127, 145, // .,..Q.a<.2..
+ 149,   5, 116, 208, 100, 246,  25,  83, 172, 198, 167,   5, // ..t.d..S....
+  29, 203,  28, 236, 195, 134, 117,  22,  97, 178, 142, 215, // ......u.a...
+  61,  80, 126,  37, 122, 178, 226, 176, 201, 234, 204, 168, // =P~%z.......
+  61, 158,  70,  99,  27,  65,  89,  68,  96, 251,  90, 248, // =.Fc.AYD`.Z.
+ 117,  98, 162,  99, 171,  23, 208, 181,  58, 245, 137, 110, // ub.c....:..n
+ 161,  90, 142,  17, 139,  72, 125, 147, 164,   3,  74, 234, // .Z...H}...J.
+ 169,  51, 181,   7,  35,  10,  72, 120, 135,  34, 206, 253, // .3..#.Hx."..
+  29,  49, 105,  30, 252, 167,  68,  75,  94, 142,  30,  24, // .1i...DK^...
+ 167, 156, 219,  84, 189,   9, 203,  60,  44, 195,  50, 183, // ...T...<,.2.
+  58, 209,  83, 191, 207, 150,  71,  28,  84, 213, 188, 212, // :.S...G.T...
+ 155,  38, 124, 247,  55, 191, 143, 152, 202, 219, 237,  78, // .&|.7......N
+  56, 226, 152, 202,  47, 252, 174, 155, 240,  40, 250, 174, // 8.../....(..
+  94,  71, 223, 225, 183,  29, 138, 121,   9, 116, 116, 151, // ^G.....y.tt.
+  41, 101,  95, 189, 133,  78, 219, 178, 250,  78,  15, 213, // )e_..N...N..
+ 152, 202, 252,  41,  98,  42, 119, 110, 220,  24, 233, 152, // ...)b*wn....
+ 202, 219,   6, 155, 244,  43,  26, 241, 197,  84,  76,  50, // .....+...TL2
+ 110,  29, 145,  81,  51, 234,  88,  17,  64, 115,  36, 105, // n..Q3.X.@s$i
+ 163, 149, 148,  90,   9, 241, 240,   8, 187,  85,  82,  50, // ...Z.....UR2
+ 132, 125, 202, 168, 135,  41,  99, 234, 123, 209,  35, 244, // .}...)c.{.#.
+ 178, 236, 228, 189, 104, 127, 229,   4, 189, 131,  24, 255, // ....h.......
+ 190, 122, 200,  81, 142,  11, 237,  77,  83, 206, 211, 113, // .z.Q...MS..q
+  25, 229, 248, 190, 117, 146,  56,  19, 229, 120,  25, 206, // ....u.8..x..
+  65, 190, 249,  99,  19, 229,  24, 160,  51,  22, 173, 119, // A..c....3..w
+ 214, 115, 191,  79, 167,  57, 244, 202, 238, 225, 174,  31, // .s.O.9......
+  15, 175, 149,  56,  59,  92,  26,  79,  69,  57, 102,   3, // ...8;..OE9f.
+ 253, 220,  13, 113,  12, 248, 195, 138, 108, 171,  23, 184, // ...q....l...
+ 106, 227, 105, 192, 117, 177, 142,  82, 180, 182, 174,  14, // j.i.u..R....
+ 181,  19, 229, 164, 221,  11, 235,  61, 117,  96, 220,  49, // .......=u`.1
+  39, 237, 122,  47, 236, 181, 242,  42,   3,  69, 155, 115, // '.z/...*.E.s
+  37,  58, 228,  56, 168,  43, 209,   1, 209, 174,  15,  36, // %:.8.+.....$
+ 102, 114,  78, 117, 114, 204, 100, 189,   9,  84, 142,  44, // frNur.d..T.,
+  19,  51,  57,  87,  12,  52, 118,   7,  56,  49, 147, 225, // .39W.4v.81..
+ 141, 234, 129, 141, 153, 252, 144,  99,  38, 155,  58, 150, // .......c&.:.
+  77, 204, 228,  50,  65, 199,  76,  46,  19,  30,  18, 252, // M..2A.L.....
+  63, 152,   4, 208,  40, 223, 239, 228, 163, 185,  27,  28, // ?...(.......
+ 186, 162, 226, 218,   5,  68, 185, 218,  89, 189, 173, 226, // .....D..Y...
+ 142, 130,  27,  73, 152,  50, 240, 222, 166,  53,  66,  40, // ...I.2...5B(
+  55, 140,   1, 143,  57,   2, 142, 118, 122, 131, 241,   8, // 7...9..vz...
+ 170,  15, 196, 244, 104, 165, 152, 188, 205,  22, 124, 161, // ....h.....|.
+ 151, 142, 143, 246, 227,  28, 216, 247, 108,   8, 154, 157, // ........l...
+  50, 114, 100, 228,   8,  52, 220, 172, 115,  56, 162,  17, // 2rd..4..s8..
+  60, 190, 192, 186,  60, 238,   4, 116, 102, 226, 101, 157, // <...<..tf.e.
+  45, 109, 186, 140,  64, 136, 141,  25,  42, 234,  20,  29, // -m..@...*...
+ 148, 140,  79, 104, 142,  37,  88,  45, 205, 234, 185, 246, // ..Oh.%X-....
+  25, 164, 119, 113, 111,  18, 117,  91,  78, 240, 248,  92, // ..wqo.u[N...
+  29,  26,  44, 147,  40, 223,  98,  22, 117, 170,   8, 133, // ..,.(.b.u...
+ 208,  74,  35, 248, 182, 198,  50,  15,  16, 141,  59,  58, // .J#...2...;:
+ 176, 152, 134,  64, 250, 102,  76, 251, 112,  68, 127,  31, // ...@.fL.pD..
+  69, 227, 155,  49, 228, 137, 199, 188, 165, 119, 168, 236, // E..1.....w..
+ 110,  52,  96, 123, 252, 112, 103,  89,  61,  48,  47,  12, // n4`{.pgY=0/.
+  53, 175, 169, 148,  65,   1, 199,  78, 100, 246, 123, 138, // 5...A..Nd.{.
+  96,  95, 189, 137, 108,  50, 194,  98, 173, 171, 167, 101, // `_..l2.b...e
+  66,  63, 156, 146, 131,  64, 162, 166, 147,  50,  54,  93, // B?...@...26]
+ 204, 105, 253, 254, 224,  89, 224,  72, 136,  42, 126,  14, // .i...Y.H.*~.
+ 202,  34, 237, 177, 125, 142, 235, 215, 135,  54, 192,  51, // ."..}....6.3
+  26, 140, 221,  40, 132, 183, 120, 163,  28, 136, 121,  63, // ...(..x...y?
+ 111, 186,  63, 218, 127, 160, 163, 208, 252, 252,  16, 109, // o.?........m
+ 251, 251, 254,  51, 154, 153, 231, 234,   5, 171, 196, 125, // ...3.......}
+  83, 143,  41, 237, 192, 192, 127, 160, 190, 226, 114, 226, // S.).......r.
+ 149, 112, 109, 159, 228, 231, 137, 252, 188, 151, 227,  94, // .pm........^
+  22, 126, 200, 155, 248, 177,  57, 238, 113,  89, 253,  21, // .~....9.qY..
+  60, 221,  43,  66, 135,  90,  75, 210,  44,  12, 170,  17, // <.+B.ZK.,...
+  18,  77,  25,  79, 238, 175, 170, 226,  68,  43,  66, 255, // .M.O....D+B.
+ 100, 116, 129,  74, 175,  73, 180, 248, 143, 153, 109, 124, // dt.J.I....m|
+  18, 245, 102, 106, 126,  63,  83, 243, 147,   5,  53, 191, // ..fj~?S...5.
+ 159,  87, 179, 190, 237,  57, 109, 132, 191,  41,  54, 236, // .W...9m..)6.
+ 251,  19, 112, 101, 177, 213, 111, 230,  66, 246, 207, 224, // ..pe..o.B...
+ 252,  40, 250, 109, 166, 117, 218, 159, 191,  65,  53, 161, // .(.m.u...A5.
+  96, 151,  82,  71, 134, 173,  47, 172, 142, 136, 127, 178, // `.RG../.....
+  18, 223, 252, 166, 142,  89,  64, 200, 238, 244, 180,  62, // .....Y@....>
+ 209, 159, 211, 117, 181, 238,  99, 183, 255, 201, 181, 181, // ...u..c.....
+ 129,  84, 110, 126,  11,  79, 125, 230,  31, 142,   9, 122, // .Tn~.O}....z
+  79, 130, 250, 169, 223, 208, 143, 234,  97, 228, 191, 139, // O.......a...
+ 136, 204,   4, 148, 159,  74, 162, 122,  23,   4, 245, 251, // .....J.z....
+  43, 111, 229, 130, 100,  65, 129, 155, 157, 149, 183, 234, // +o..dA......
+ 126, 244, 174, 254, 176, 213, 220,   2, 158, 121,  24,  33, // ~........y.!
+  42, 244, 218, 250, 214,  99,  90, 190, 199, 120, 217, 228, // *....cZ..x..
+ 244, 109,  86, 243,  67,  87,  63,  70,  15, 183,  26, 212, // .mV.CW?F....
+ 185, 109,  63,  30, 251, 244,  97, 221, 255, 216, 126,  12, // .m?...a...~.
+  72, 122, 164,  32,  94, 184,  23, 177, 195, 153,  54, 213, // Hz. ^.....6.
+  17, 166,  81, 244, 186, 221,   8, 239,   7, 245, 244, 230, // ..Q.........
+ 235, 155, 190, 100, 188, 165, 140,  70, 176, 130, 175, 248, // ...d...F....
+  73, 106, 253, 189,  60, 142, 249, 128, 253, 161, 131, 184, // Ij..<.......
+  49,  81, 113,  18, 125,  21, 189,  64, 231,  56, 143,  83, // 1Qq.}..@.8.S
+ 235,  67,  95, 195, 125,  16,   3, 157,  65,  50, 186, 243, // .C_.}...A2..
+ 135, 227, 224, 202, 122,  30,  56,  63, 107, 132, 177,  58, // ....z.8?k..:
+ 107, 134,  41, 150, 189, 188, 199,  17, 214, 143, 125,  93, // k.).......}]
+ 165,  51, 139,  30, 167,  86,  46, 100,  19, 117, 172, 161, // .3...V.d.u..
+  44, 122, 112, 243,  62,  98,  22,  47, 223, 188,  95,  61, // ,zp.>b./.._=
+ 162,  95, 183, 243, 240,  16,  71,  52,  29, 152, 135, 250, // ._....G4....
+ 136, 126, 109,  40, 190, 189, 202,  17, 157, 150,  71, 116, // .~m(......Gt
+ 169,  43, 149,  90, 142,  18, 156,  82, 187, 205, 174, 201, // .+.Z...R....
+ 210,  58, 145, 175, 141, 178, 248, 135, 104, 159, 122,  36, // .:......h.z$
+  91, 123,  34,  76, 226,  41, 220, 163,  30,  27, 177, 145, // [{"L.)......
+ 185, 191,  62,   2,  63,  18,  27, 104, 202, 233, 179, 151, // ..>.?..h....
+ 126, 170, 158,   5, 250,  91, 194, 240, 219, 196,  56, 223, // ~....[....8.
+   3, 230, 222, 134,  59, 243,  92, 125, 128, 103,  84, 188, // ....;..}.gT.
+ 196, 250, 101,  28, 117, 234, 163,  10, 159, 172,  21, 107, // ..e.u......k
+ 183, 210, 118, 156, 135, 113, 198,  90, 136, 244, 156, 133, // ..v..q.Z....
+ 113, 222, 250, 218, 246, 121,  15,  75, 225,  39, 236,  32, // q....y.K.'. 
+ 230, 141, 255, 158,  57, 156,  39,  18, 153,  93, 141,  86, // ....9.'..].V
+ 126, 245,  31,  35, 128,  40, 205,  32,  76,  23, 199, 245, // ~..#.(. L...
+ 199,   1, 223, 157,  26, 141, 124, 253, 213,  39, 254, 234, // ......|..'..
+ 213,  85,  95,   5, 225,  27,  63,  78,  46, 173, 247, 169, // .U_...?N....
+   4, 223,  86, 131,  58, 229, 211, 217, 121, 127, 229, 177, // ..V.:...y...
+ 114,  24,  18, 234, 113, 251, 119,  35,  36, 252, 218, 126, // r...q.w#$..~
+  31, 198,  73, 248, 149, 246, 201, 239, 218,  49,  30, 193, // ..I......1..
+ 183,  70, 155, 237,   3,  73,  10,  15, 140, 227, 186, 182, // .F...I......
+  73,  82, 191, 107, 133,  60, 218,  50, 191,  11, 161, 243, // IR.k.<.2....
+ 181, 253, 137, 170,  82, 191, 203,  25,  13, 113,  89,  26, // ....R....qY.
+ 207, 145,  29, 188, 244, 227, 118, 133, 204,  54, 231,  93, // ......v..6.]
+ 172, 205, 254, 249, 188, 195, 139,  95, 113,  53, 102, 168, // ......._q5f.
+ 107, 115, 222, 233, 163, 144, 248,  73, 115, 226, 177, 189, // ks.....Is...
+ 194, 153, 143, 176, 233,  35,  42,  57,  12, 160, 185, 198, // .....#*9....
+  73,  56, 132, 198,  68, 152, 247,   2, 246,  27,  53, 146, // I8..D.....5.
+  75, 181, 163, 168, 248,  85,  29,  71, 197, 239, 106,  47, // K....U.G..j/
+  42, 110,   5,  33,  18,  62,  34, 161, 129, 132,  77, 217, // *n.!.>"...M.
+ 210,  39,  84, 218, 156, 134,  35, 135,  32,  78, 137,   6, // .'T...#. N..
+ 238, 240,  65, 199, 188, 131, 121,  49,   4, 241,  11,   2, // ..A...y1....
+ 209,   1, 232, 223, 147, 118,  26, 102, 187, 160, 230,  95, // .....v.f..._
+  16, 249, 190, 179,  75,  36, 123, 133,  91,  54,  69, 176, // ....K${.[6E.
+ 137, 104, 107, 102, 122,  19, 157, 148,  10, 133, 204,  42, // .hkfz......*
+ 235, 201,  67, 165,  96, 156, 159,  11, 233, 247,  13,  94, // ..C.`......^
+  26,  31, 200, 243, 190, 240, 212, 178,  67, 150,  45,  34, // ........C.-"
+  74,  82, 255, 185, 122,  64, 132, 195,  49, 205, 215,  89, // JR..z@..1..Y
+ 240, 227, 204, 193, 118, 180, 108, 152, 131, 157, 183, 234, // ....v.l.....
+  59,  19, 191,  16, 221, 148, 155,  36,  47, 137, 223, 183, // ;......$/...
+ 166, 163, 203,  51, 196, 239,  54, 136, 176, 125,  63,  55, // ...3..6..}?7
+ 103, 122, 204,  14,  21,  74, 151,  61, 111, 105, 109, 142, // gz...J.=oim.
+   9, 114, 191,  65, 123,  12,  15,  47, 180, 114, 213,  82, // .r.A{../.r.R
+  62,  69, 252, 142,  49, 131,  99, 151, 248,   5, 152,  96, // >E..1.c....`
+ 246,  79, 212,  41, 251, 102,  91,  22,  90, 117,  12,  97, // .O.).f[.Zu.a
+   3, 104,  85,  13,  90, 184,  87,  90, 182, 180, 234,  88, // .hU.Z.WZ...X
+ 241, 122,  90, 184, 114, 104,  85, 184, 105,  93, 182, 180, // .zZ.rhU.i]..
+ 234, 119, 166,  85,  77,  29, 219, 134,  86,  45,  19,  52, // .w.UM...V-.4
+ 173,  90,  38, 224,   8,  89, 158, 148,  91,  46,  57,  66, // .Z&..Y..[.9B
+ 164,  27,  66, 104,  35,   0, 212, 188,  43,  37,  35, 149, // ..Bh#...+%#.
+   0,   5,  43, 151,  11, 109,  19,  19, 214,  91, 245, 136, // ..+..m...[..
+ 161,  15, 118, 138, 146, 125, 134, 139,  13, 136,  60,  90, // ..v..}....<Z
+ 217,  47, 101,  42, 203,  59,  32, 232, 192, 213,  37, 204, // ./e*.; ...%.
+ 142, 119, 240, 178,  27, 129, 204, 140,  35, 253, 214, 114, // .w......#..r
+  28, 133, 176,  21,  10, 241,  56,  58, 182,  21,  75,  15, // ......8:..K.
+  37, 125, 137, 211, 253, 152,  29, 182,  16,  38, 157,  16, // %}.......&..
+ 127, 234, 250,  58, 201, 186,  16,  22, 167, 184,  99,  57, // ...:......c9
+  52, 189, 108, 123,   1,  29,  66, 165, 127,  43,  19, 113, // 4.l{..B..+.q
+ 104, 113, 217, 139,  11, 207,  11,  76, 210,  13, 175,  36, // hq.....L...$
+ 112,  10, 189, 197, 147, 200, 206,  65, 228,   5, 173, 120, // p......A...x
+ 167,  23, 119, 179,  94, 252, 238, 205, 179,   7, 217, 209, // ..w.^.......
+  48,  75, 227, 180, 240,  65, 128,   7, 187, 209, 220,  28, // 0K...A......
+ 120,  23, 165, 177,  79, 104, 243, 105,  65,  27, 195,  99, // x...Oh.iA..c
+ 158,  29,  13,  70, 177, 159,  68,  91,  35, 145, 157, 100, // ...F..D[#..d
+ 227,   2, 186,  24,  12,  58, 180,  71,  61, 156,  60,  29, // .....:.G=.<.
+ 194,  94,   8, 208,   0,  63, 181, 244,  51, 160,  52, 252, // .^...?..3.4.
+  28, 117,  14,  16, 176, 109, 144,  14, 199,  72,  46, 178, // .u...m...H..
+ 131,   3, 142, 224, 214, 203, 179,  33,  52,  23,  16,  30, // .......!4...
+  51,  25, 112, 224, 116,  79, 204, 189, 241, 208,  57, 142, // 3.p.tO....9.
+ 225,  21, 152, 171, 232, 240,  44, 210,  67,  86, 116, 232, // ......,.CVt.
+ 239,  48, 207,  14, 242, 120, 132,  98,   7, 157,  49,  87, // .0...x.b..1W
+ 126, 144, 119, 134, 135, 240, 174,  63,  76,  50,   4, 119, // ~.w....?L2.w
+ 243, 146, 236,  96, 144, 218,  10, 232, 141,  58, 108,  95, // ...`.....:l_
+ 105,  59, 197, 158, 227, 173, 237, 129, 143, 233,  55, 251, // i;........7.
+ 240, 121, 233, 219, 127,  21,  28, 140, 149, 106,  23, 191, // .y.......j..
+ 176, 237, 117, 180, 226, 123,  52, 237,  71, 157, 194,  99, // ..u..{4.G..c
+  99,  90, 154, 128, 157,  98, 119,  34, 160, 186,  12, 112, // cZ...bw"...p
+ 100,  95,  68,  13, 117,  62,  26, 239, 143, 186, 249,  96, // d_D.u>.....`
+  63, 118, 157, 212, 166, 214, 248, 171, 224,  16, 158,  62, // ?v.........>
+  59, 176,   6, 196,  21, 108, 105, 195, 193, 179,  86,  86, // ;....li...VV
+  38, 138, 111,  55, 103, 191,  79, 130, 115,  19,  64, 141, // &.o7g.O.s.@.
+ 191, 167,  47, 119, 112, 121,  61,  28, 239,  39, 131, 209, // ../wpy=..'..
+ 225,  84,  81, 118, 202,  26, 153, 146, 213, 104, 139,  41, // .TQv.....h.)
+ 139, 151, 253, 132, 239,  89, 182, 173, 141, 182,   1,  35, // .....Y.....#
+  38, 108, 218, 171, 227,  65, 155, 182,  53,  45, 251,  97, // &l...A..5-.a
+ 124,  68, 123, 196, 235, 197, 253, 206,  56,  41,  60,  51, // |D{.....8)<3
+  43,  90,  69,  76, 238,  87,  56, 126, 232, 170,  46, 162, // +ZEL.W8~....
+  32,  62, 165, 147, 237, 237,   2, 241,  22, 149, 205, 140, //  >..........
+ 239,  20, 105, 135, 219, 104, 183,  37, 132, 157, 155, 193, // ..i..h.%....
+  17,   4, 226,  81, 187, 237, 121, 206,  24, 136, 183, 212, // ...Q..y.....
+ 173,  19,  81,  13,  79,  55,  70, 203, 192,  77, 181,  97, // ..Q.O7F..M.a
+  63, 147,  40, 227, 105,  40, 216, 136,  11, 247, 222, 108, // ?.(.i(.....l
+ 113,  37, 216, 127,  16, 185, 223, 164, 214, 155, 251, 151, // q%..........
+ 122, 125, 249,  60, 158, 132, 181, 229, 115,  20, 159, 180, // z}.<....s...
+ 190,   4, 124, 215, 131,  64, 212, 181, 154, 103,  97,  35, // ..|..@...ga#
+  94, 205, 227,  97,   2,  31,  61,  30, 157, 242, 223,  59, // ^..a..=....;
+ 121, 175, 206, 131, 169, 157, 123,  42,  95, 161, 194,  83, // y.....{*_..S
+ 169, 252, 245, 202,  96, 133, 227,  89,  79, 136, 231, 156, // ....`..YO...
+  35, 216, 140, 226,  53, 191, 216, 106, 198, 183, 219, 244, // #...5..j....
+  95, 136, 167,  13, 122, 218,   8,  75, 169, 218,  75, 230, // _...z..K..K.
+ 180,  87,   7, 163, 103, 105,  17,  31, 196,  52,  47,  18, // .W..gi...4/.
+   3,  10,  38,  82, 143,   7, 167, 113, 207,  95, 215, 246, // ..&R...q._..
+ 236,  65, 155, 206, 181,  21,  93, 157, 119, 228, 233, 234, // .A....].w...
+ 188, 111,  94, 232, 161,   3, 143, 162, 202, 141,  36, 161, // .o^.......$.
+ 147, 239,   8,  62, 214, 214, 218, 148, 237, 213, 179, 182, // ...>........
+   4, 222, 100,  59,  32, 179, 113,  94, 251, 231, 221, 209, // ..d; .q^....
+ 136, 232,  71, 189,  62,  97, 161,  64,  98, 135, 116,  76, // ..G.>a.@b.tL
+ 197, 157,   4,  18, 210,  48,  85,  60, 226,  48, 227, 229, // .....0U<.0..
+  30, 226, 179,  81, 152, 227, 133, 206, 161, 193, 196, 200, // ...Q........
+ 206, 137,  26, 235, 172, 142,  71, 241,  54,   1,  81,  39, // ......G.6.Q'
+   9, 124,  17, 252,  15,  70, 230, 186, 162, 157, 132,  59, // .|...F.....;
+ 187, 160,  53,  77, 193,  55, 196, 150, 248,  16,  23, 100, // ..5M.7.....d
+ 171, 188, 249, 225,  24, 155,  13,  66,  46,  46,  50,  14, // .......B..2.
+ 193, 171,  95, 188, 191, 109, 252, 220, 245,  84,  63, 154, // .._..m...T?.
+ 113,  60, 181,  51,  18,   8, 179, 142, 251, 217, 100, 115, // q<.3......ds
+  38, 145,  48,  34, 142, 206, 238,  97,  39,  39, 230,  78, // &.0"...a''.N
+  63,  24, 239, 203, 240, 249, 169, 134, 145, 111, 246,  13, // ?........o..
+ 195, 247, 108, 105, 173,  95, 160, 157, 116, 166, 209,  24, // ..li._..t...
+ 122, 172,  57,  97, 220,  69,  90, 194, 180,  49, 102, 246, // z.9a.EZ..1f.
+ 149, 214, 161,  76,  77, 108,  66,  27, 164, 240,  86, 195, // ...LMlB...V.
+ 234,  85, 166,  90,  59,   3, 185, 230, 169, 185, 222,  80, // .U.Z;......P
+  34,  61,  15, 105,  64, 251,  90, 146, 238,  91,  17,  55, // "=.i@.Z..[.7
+ 193,   1, 152, 125, 239, 209,  24, 250, 157, 107, 207, 179, // ...}.....k..
+ 180,  71,  88,  50,  80,  90, 227, 135, 230,  93,  73, 168, // .GX2PZ...]I.
+ 205, 176,  12,  76,   9,  77, 218, 112, 231,  92,  43, 209, // ...L.M.p..+.
+ 120, 231,  79, 159,  74,  80,  83,  79, 120, 231, 245,  77, // x.O.JPSOx..M
+ 234, 174, 206, 124,  52, 217,  53, 241, 187, 119, 202,  81, // ...|4.5..w.Q
+ 172,  27, 241,  77,  87, 200,  43, 216,  17, 117, 242,  81, // ...MW.+..u.Q
+  76, 128, 236, 119, 161,  30,  50,  18, 113, 123,  19,   1, // L..w..2.q{..
+ 147, 154, 183,  97,  84,  48,  55, 127,  67, 109,  74, 126, // ...aT07.CmJ~
+  50,  63, 127,  83, 221, 145, 252,  47, 249, 193, 190, 143, // 2?.S.../....
+ 173, 172, 104,  43,  23, 252,  55, 161, 191, 141, 213, 141, // ..h+..7.....
+ 205, 224,  75,  48,  33,   4, 154, 175, 226, 244,  40, 128, // ..K0!.....(.
+ 126,   2,  92, 126, 201, 240,  35,  63, 171, 234,  62, 105, // ~..~..#?..>i
+  20, 179,  51,  13,  79, 172, 135,   6,  37,  50,   8, 203, // ..3.O...%2..
+  74, 128, 136,  22, 174, 113,  43, 209,  22,  68,  43,  39, // J....q+..D+'
+ 116, 224, 100,  39, 180, 213, 242,  44,  73,  88,   5,   4, // t.d'...,IX..
+ 234, 210, 213, 228,  79, 134,  60,  56, 103,   5, 170, 240, // ....O.<8g...
+  28, 138,  63,  97,   2,  59,  89, 218, 238,  28,  36, 143, // ..?a.;Y...$.
+ 230, 176, 151, 117, 199, 184,  27,  95, 237, 210,   6,  44, // ...u..._...,
+  98, 125,  83, 238, 123, 189, 193, 177,  23,   4, 130,  70, // b}S.{......F
+  95, 118, 142, 226,  72,  78, 204, 122, 145, 101, 180,  77, // _v..HN.z.e.M
+ 135, 165, 117, 208,  48,  27,  13,  48, 170, 200, 235, 236, // ..u.0..0....
+ 143, 178, 100,  92, 208, 233, 106,  43,  69, 124, 213, 234, // ..d...j+E|..
+ 149,  59,   1,  42, 180, 137, 112, 141, 241,   8,  81, 215, // .;.*..p...Q.
+ 158,  19, 119,  25,  19,  21, 224, 123, 172, 120,  72,  41, // ..w....{.xH)
+  56, 214, 121,  54,  76,  11,  16, 237,  37, 157, 179, 200, // 8.y6L...%...
+ 219, 135, 130, 159,  55, 185, 228, 243,  36,  38,  42,  96, // ....7...$&*`
+ 209, 231,  41, 145,  44, 222, 132, 131, 195, 179,  19,  28, // ..).,.......
+  86,  67,  62, 207, 124,  73,  17, 149, 254,  80, 135,  46, // VC>.|I...P..
+  90, 138,  29,  71,  97, 231, 131, 222, 105, 152,  77, 172, // Z..Ga...i.M.
+  50, 249,  66, 231, 153,  34,  47, 104, 175,  34,  46, 245, // 2.B.."/h."..
+  42,  60,  36,  12, 202, 164, 166,  36, 149, 223, 230, 198, // *<$....$....
+  11, 227, 224, 226, 194, 162, 229, 151,  29,  40, 123,  76, // .........({L
+  37,  12,   2, 183, 153, 142, 156, 180, 108, 217, 221,  46, // %.......l...
+  31, 137, 145,  67,  88, 103, 173,   4, 183, 160, 204,  64, // ...CXg.....@
+  33, 228, 115, 104,  69, 113,  75,  16, 251, 107, 155,  53, // !.shEqK..k.5
+  86,  53, 114, 195,  11, 125,  89,  62, 159,  10, 119, 147, // V5r..}Y>..w.
+ 159, 153, 179, 158, 206, 130, 102, 179, 253, 162, 131,  40, // ......f....(
+  80,  73,   6, 207, 220, 107, 132,  21, 136, 132, 102,  88, // PI...k....fX
+ 196, 102, 231,  16,   2, 162,  62, 207,  99, 230, 203, 112, // .f....>.c..p
+ 207,  84,  88, 202, 122, 141, 144, 196, 122, 242, 176, 118, // .TX.z...z..v
+ 210, 138,  47, 172, 233, 171,  42, 106,  71,  88, 213, 162, // ../...*jGX..
+ 234,  62, 174, 134, 123, 116, 235, 191, 211, 147, 157,  60, // .>..{t.....<
+ 219, 196, 141,  27, 251, 230, 142, 208, 124, 104,  19, 124, // ........|h.|
+ 219,  15, 241, 112,  53, 233,  66, 117,  15,  28, 245, 196, // ...p5.Bu....
+  29,  50,  15, 143,  14,  37,  30,  30, 126,  53, 114, 108, // .2...%..~5rl
+  87, 222, 252, 100, 222, 212,   4, 161, 197, 160,  73, 187, // W..d......I.
+   8, 129,  69,  11,  14,  74,  31, 109, 233, 171, 194,  56, // ..E..J.m...8
+  64, 172, 152, 237, 130,  78,   0, 127,  93, 121,  13,  75, // @....N..]y.K
+  45, 208,  82, 100, 212,  67, 194,  11,  79,  51,   2,  65, // -.Rd.C..O3.A
+  24, 133, 132,  54, 233, 197,  32, 165,  93, 199, 137,  95, // ...6.. .].._
+ 224,  67,  47,  15,  38, 181, 207, 227, 243, 245, 198, 250, // .C/.&.......
+ 250, 132, 144, 214, 119,  90, 245,  98, 222, 177,  60, 249, // ....wZ.b..<.
+ 162,  22, 108,  49, 229, 115, 132,  95, 227,  81,  36,  74, // ..l1.s._.Q$J
+  86,  96, 180, 152, 174, 100, 170,  19, 197,  11,  79, 160, // V`...d....O.
+  81, 148, 175, 220, 165,   3, 119,  80,  55, 177,  65, 235, // Q.....wP7.A.
+ 119, 233, 184, 173, 226, 170,  21, 139,  27, 204, 131,  70, // w..........F
+  57, 218, 244, 131,  35, 111, 180,  70,  43,  58, 234, 232, // 9...#o.F+:..
+  86, 151, 163, 239, 228, 117, 253,  94, 191,  75,  71, 250, // V....u.^.KG.
+  47,  85,  60, 199,  97,  99,   6,  43, 119,  75, 227,  70, // /U<.ac.+wK.F
+ 182, 252,  30,  85, 173,  24,  97,   2,  62, 230, 164,   9, // ...U..a.>...
+  28,  73, 112, 196,  45, 125, 202,  10,  34,  32, 210, 133, // .Ip.-}.." ..
+  14,   4, 234,   2,  98, 195,  97, 121, 203,  55, 173, 251, // ....b.ay.7..
+ 103,  81, 152,  14, 102,  82, 152, 155, 105,  98,  60,  65, // gQ..fR..ib<A
+ 106, 200, 217, 205, 252, 248, 190, 159,  41,  58,   6, 237, // j.......):..
+ 177,  29, 168,  62, 240,  76, 207,  37,  42, 198, 172, 163, // ...>.L.%*...
+  71, 108, 198, 179, 222, 141,  27, 172, 126, 104, 248,  36, // Gl......~h.$
+  39,   7, 213, 218, 151, 200, 225, 165, 184, 207,  67, 191, // '.........C.
+ 154,  47, 129, 252,  54, 105, 109,  13, 193, 167, 137, 159, // ./..6im.....
+  71, 253,  62, 252,   3, 241,  87,  62, 190, 130, 132,  82, // G.>...W>...R
+ 190, 204,  81,  43, 200, 193, 156,  54, 192, 172, 183,  77, // ..Q+...6...M
+ 192, 235, 106, 154, 157,   0, 107,  71, 113,  29,  80, 235, // ..j...kGq.P.
+ 231, 171, 167, 172, 232,  68, 164, 194,  38,  14,  82,  77, // .....D..&.RM
+   2, 137, 170,  77, 226, 248, 120,  74,  68, 121, 233, 151, // ...M..xJDy..
+ 162,  21,  64, 231, 123, 208, 199,  41, 214, 247, 237,  92, // ..@.{..)....
+  85, 200,  35, 182,  45,  64, 108, 122, 215,  55,  80,  12, // U.#.-@lz.7P.
+ 132, 141, 131, 150, 208, 104, 252, 130,  78, 212, 117,   4, // .....h..N.u.
+  76, 215,   0,  48, 123,  10,  16, 151,   7, 247, 102, 138, // L..0{.....f.
+ 230, 141,  39,  72,  23, 148, 245,  91,  92,  86,  80,  96, // ..'H...[.VP`
+ 164,  39,  68, 175, 134, 157,  19, 157,  12,  62, 151, 227, // .'D......>..
+  84, 207, 155, 212, 243, 180, 109,   8,  65, 185,  98, 119, // T.....m.A.bw
+ 230,  13,  26, 212,  58,  51, 154,  75, 166,  78,  96, 138, // ....:3.K.N`.
+ 148, 163, 156, 212, 125,  88,  28,  37, 193, 151, 218,  47, // ....}X.%.../
+ 116,   8, 255,  84, 163, 255, 229, 113,  63,  90,  62,  31, // t..T...q?Z>.
+  79, 248, 133, 143, 100, 125,  28, 131,  50,   1, 139,  51, // O...d}..2..3
+ 241,  56, 139,  33,  61, 242, 104, 246, 234, 154, 188, 171, // .8.!=.h.....
+ 221, 161, 161, 183, 106,  72,  17,  50, 170, 214, 108, 112, // ....jH.2..lp
+ 202,  50, 130, 234, 216,  15, 137, 178,  94,  62,  31, 160, // .2......^>..
+ 254, 173,  95, 214, 214, 182, 190, 104, 222, 244,  94, 244, // .._....h..^.
+ 229, 151, 246, 233,  81,  82,  35,  98,  97, 196, 103, 124, // ....QR#ba.g|
+ 115, 181, 225, 213, 226, 180, 155, 113, 116,  42, 111,  92, // s......qt*o.
+ 244, 235, 119, 189, 246, 214,  79, 191, 140, 142,  15, 106, // ..w...O....j
+ 199, 131, 248, 228, 126, 118,  26, 121, 141,  90, 163, 118, // ....~v.y.Z.v
+ 187, 209, 168,  53,  55, 169,  52, 125,  79,  68, 145, 119, // ...57.4}OD.w
+  88,  20, 195, 112, 109, 237, 228, 228, 100, 245, 100,  99, // X..pm...d.dc
+  53, 203,  15, 214, 214,  27, 141, 198,  26, 125, 231, 109, // 5........}.m
+  81, 187, 191, 192,  60, 168, 134, 111, 189, 218,  25, 255, // Q...<..o....
+  21, 209, 167,  71, 245, 120,  53, 109, 173, 236, 113, 133, // ...G.x5m..q.
+  57, 149,  90, 199, 239, 153, 252, 234,  81, 107, 242, 176, // 9.Z.....Qk..
+ 134,  99, 190,  85,  99,  26, 177, 246, 183, 184,  25, 111, // .c.Uc......o
+ 198,  63, 183, 188,  53, 110,   3, 167, 155,  41, 174,  11, // .?..5n...)..
+ 252, 124, 235, 222, 198, 253, 187,  84, 158,  14, 189, 122, // .|.....T...z
+ 191, 115,  52,  72, 206, 194, 218, 189, 124, 208,  73,  84, // .s4H....|.IT
+ 109, 212,  73,  71,  28,  58, 178, 175, 243, 153,  84, 173, // m.IG.:....T.
+ 253, 188,  62,  60, 109, 245,  50, 154, 211,  14, 165, 237, // ..><m.2.....
+ 235, 248,  58,  33,  77, 114, 175, 151,  80, 211, 104, 165, // ..:!Mr..P.h.
+ 222,  73, 187, 135,  68,  78, 216,  68,  15,  99, 219, 108, // .I..DN.D.c.l
+ 252, 157,  71, 135, 223, 173, 163, 179,  26, 164,  12, 191, // ..G.........
+ 172, 161,  60, 205,  32, 166,  98, 235, 139, 186,  31, 121, // ..<. .b....y
+  58, 248,  87,  72, 180, 230, 157,  77,  94, 173, 131, 206, // :.WH...M^...
+  16, 111, 155, 118,  49, 205, 242, 174, 115, 138,  70, 223, // .o.v1...s.F.
+  97, 173, 159, 196, 167,  45, 254,  91, 239,  13,  48, 163, // a....-.[..0.
+ 180, 104,  97, 173,  75, 100, 217,  81, 170, 211,  15, 114, // .ha.Kd.Q...r
+ 162, 200, 107, 205,  86,  13,  20,  32,  29,  80, 244,   2, // ..k.V.. .P..
+  15, 215,  45,  79,  61, 140, 206,  53,  31,  30, 158, 239, // ..-O=..5....
+  31,  48,  55,  20, 122, 127, 235, 221, 237, 117, 123, 125, // .07.z....u{}
+ 143, 189,  85, 238, 119, 242, 251,  54, 163, 207, 255, 179, // ..U.w..6....
+  25, 140, 184,  67, 111, 253,  86,   3,  88,  23,  99,  98, // ...Co.V.X.cb
+  26, 203, 107, 222,  50, 239, 230, 195,  91, 119,  54,  55, // ..k.2...[w67
+ 111, 255, 236, 169,  97,  39, 141, 147,  74, 125,  38, 173, // o...a'..J}&.
+  52, 214,  71,   7,  54, 241, 175, 146, 245, 134,  47, 147, // 4.G.6...../.
+  67, 175, 177, 186, 142,  41, 209, 121, 175, 245, 180, 121, // C....).y...y
+  50,  81, 102, 246, 116, 238, 219,  65, 145, 196,  47, 216, // 2Qf.t..A../.
+  82,  61, 244, 234, 186,  72,  93, 151,  33, 120, 173, 207, // R=...H].!x..
+  41, 190, 160,  70, 240,   0,  11,  26, 112, 134, 243,  51, // )..F....p..3
+ 254, 185, 121,  80, 147, 253,  32, 235, 198,  80,  61, 149, // ..yP.. ..P=.
+  37, 211, 213,  88, 165, 111,  68, 238, 244, 214, 153,  51, // %..X.oD....3
+ 158,  28,  73,  46, 155,  88, 223, 188, 189,  17, 239, 219, // ..I..X......
+ 244, 202, 172,  85, 243, 158,  98, 177,  77, 214, 198, 254, // ...U..b.M...
+ 221, 245, 254, 109, 147, 245, 112,  48, 234, 236,  39, 113, // ...m..p0..'q
+ 207,  78, 119, 147, 166, 219, 126, 232, 204, 192, 250, 122, // .Nw...~....z
+ 101, 204,  44, 157, 171, 182, 217, 237, 118,  77, 122, 117, // e.,.....vMzu
+  85, 157, 178,  51,  75, 199, 121, 110,  51, 122, 134,  37, // U..3K.yn3z.%
+  87, 172, 233, 221, 236, 166, 100, 235, 175, 227, 222, 160, // W.....d.....
+ 136, 123,  78, 115, 155, 212,  32, 166,  86,  75, 252,  22, // .{Ns.. .VK..
+ 193,  75,  37,  91, 127, 204, 241,  37, 228, 208, 167,  67, // .K%[...%...C
+ 193,   8,   4, 168, 210, 187, 205,  94, 191, 123, 199, 163, // .......^.{..
+ 227, 187, 147, 127, 115, 247, 198, 237,  77, 250, 215, 153, // ....s...M...
+ 179,  55,  54, 214, 233, 223, 221,  42, 216, 199, 113,  60, // .76....*..q<
+   3, 243, 166, 220,  60,   0, 186, 181,  78, 255, 238, 206, // ....<...N...
+ 221,  18, 183, 111, 223, 158,   3,  36,  39, 135,   3,  48, // ...o...$'..0
+  95, 211,  80, 114, 187, 249, 243, 254, 221, 206,  92,  40, // _.Pr.......(
+ 169, 140, 120,  14, 164, 220, 105, 118, 246, 127, 238,  44, // ..x...iv...,
+ 130, 148,  59, 119, 238, 204,   5,   3,  78, 159,  55, 127, // ..;w....N.7.
+  19, 245,  38, 250, 242,  19,  14,  55,  85,   3, 103,  88, // ..&....7U.gX
+  59, 175,  25,  60, 214, 108,  52, 254,  78, 152,  77, 182, // ;..<.l4.N.M.
+ 103, 173, 209, 170, 149,  56, 176,  69, 101,  79, 129, 122, // g....8.EeO.z
+ 249,  85, 116, 237, 235, 112, 183,  81, 193, 217, 227,  65, // .Ut..p.Q...A
+ 189,  68, 215, 106, 116,  70, 135, 252,  81, 125,  60,  80, // .D.jtF..Q}<P
+  78, 226, 189, 225,  48, 137, 107, 220, 169, 218, 163, 163, // N...0.k.....
+ 236, 235,  64, 109, 199,   7,  89,  92, 123, 247, 108, 250, // ..@m..Y.{.l.
+ 117, 251, 236, 104,  63,  75, 212, 203, 172, 200, 220, 242, // u..h?K......
+ 173, 218, 228, 167, 217, 126,  31,  31,  34, 189, 163, 106, // .....~.."..j
+ 157, 240, 120,  48,   2,  56, 226, 145, 142, 132, 111,  84, // ..x0.8....oT
+ 142, 163, 232, 210,  49, 179, 185, 217, 215,   7,   3, 132, // ....1.......
+ 232, 121,  71,  16, 179,  28,  85, 147, 159, 126, 186, 169, // .yG...U..~..
+ 126, 186,  25, 134, 251,  28, 210, 148,  31,  59, 125, 162, // ~........;}.
+  61, 106, 231, 116, 104,  45,  24, 252,  79, 244, 213, 148, // =j.th-..O...
+ 132, 144,  10,  59, 167, 212, 113,  39, 247, 235, 117, 131, // ...;..q'..u.
+ 135, 131,  22, 229, 234, 206, 148,  57,  60,  54, 206,  42, // .......9<6.*
+ 157, 166, 152, 124,  13, 229, 129, 180, 100, 165, 245,  52, // ...|....d..4
+ 166, 169, 211,   6, 217, 241, 209, 176,  56, 171,  59, 133, // ........8.;.
+ 166, 170,  28, 231, 137, 207,  98, 253, 209,  26, 152, 179, // ......b.....
+  33,   2, 149,  30,  31,   4,  68, 216,  12, 227,  78,  81, // !.....D...NQ
+ 235,  50, 219, 111, 126, 250, 144,  67, 162,  83,  83,  13, // .2.o~..C.SS.
+ 241, 125, 102, 157,  38, 248, 104,  20, 234, 178, 173, 218, // .}f.&.h.....
+ 215, 241, 168,  24, 244, 165, 109,  74, 178,  25, 244, 185, // ......mJ....
+ 115, 140, 202, 193,  41, 211,  71, 139,  54,  60, 173, 141, // s...).G.6<..
+ 178, 100, 208, 171, 253, 173, 211, 233, 200,   0,  25, 142, // .d..........
+  85,  77, 187, 239, 224,   1, 152, 230,   7,  41, 206, 247, // UM.......)..
+ 186, 116,  66,  47, 129, 168,  51, 153, 185, 154, 193, 111, // .tB/..3....o
+  11, 230, 212, 197, 141,  74, 167, 185,  24,  33,   8,  90, // .....J...!.Z
+ 151,  46, 210,  76, 255, 103, 154, 159,  46, 108, 168,  62, // ...L.g...l.>
+  34, 173, 187, 254,  76, 105,  64, 134, 170,  53, 131, 218, // "...Li@..5..
+  77, 212, 201, 159,  17,  31,  33, 212, 140, 192, 230,  34, // M.....!...."
+ 232, 171,   9,  48, 151,  52,  68, 156,  36, 131, 225, 104, // ...0.4D.$..h
+  48, 106, 213,  24,  13, 213,  37, 240,  56, 213, 114,  66, // 0j....%.8.rB
+ 116, 170,  75, 108,  28,  18,  65,  20, 167, 118, 175,  55, // t.Kl..A..v.7
+ 102,   0, 147, 251, 247, 182,  50, 112,   7, 172, 167,   7, // f.....2p....
+  98,  78,  78,   8, 230, 238, 110, 108, 108, 242,  88, 104, // bNN...nll.Xh
+ 181, 203, 239,  78, 244,  86, 157, 250,  72,  78, 226, 128, // ...N.V..HN..
+  22,  95, 214, 158,   0, 219,   2, 140,  83,  84,  31,  61, // ._......ST.=
+   1, 224, 220,   2, 199, 116, 201, 202,  41,  21, 200, 150, // .....t..)...
+ 144,  27, 170, 217, 237,  50,  23, 138,  53, 125, 183,  46, // .....2..5}..
+ 112,  58,  59,  89,  19,  91, 223,  86, 141, 187, 181,   3, // p:;Y.[.V....
+ 209,  70, 228,  49,  23, 230, 237,  82,  43,  85, 218,  78, // .F.1...R+U.N
+ 175, 250,  38, 144, 106, 167, 139,  86, 234, 149,  57, 174, // ..&.j..V..9.
+ 156,  17, 193, 226, 250, 249,  98,  14, 213, 235,  10,  55, // ......b....7
+  76,  23, 237, 150,   9, 123, 250,  84, 176, 123, 199,  77, // L....{.T.{.M
+ 225,  34, 171,  51,  69,  42,  41, 220, 174, 147, 114, 126, // .".3E*)...r~
+   9,  50, 170,  45,  13, 142, 134,  89,  94,  16, 225,  77, // .2.-...Y^..M
+  59,  69,  36, 118,   4,  99,  68, 110,  39,  52,  95, 132, // ;E$v.cDn'4_.
+  53, 106, 102,  57,  87, 133,  50,  40, 155,  44, 223, 165, // 5jf9W.2(.,..
+  65, 121, 223, 186,  57, 183, 189,  10,  89, 161,  23,  84, // Ay..9...Y..T
+ 230, 108,  49, 102, 112,  23, 118,  17, 118, 114, 215,  91, // .l1fp.v.vr.[
+  99,  37, 170, 206, 221,  49, 102, 195,  76, 225,  25,   7, // c%...1f.L...
+ 236, 221, 115,  92, 176, 141,  98, 208,  41,  33, 127,  26, // ..s...b.)!..
+  60,  43, 164, 156, 139,  28,  70, 135, 157,  30,  32,  70, // <+....F... F
+ 246, 186, 153,  79,  86, 251,  70,  47, 179, 113,  21,  21, // ...OV.F/.q..
+   8, 246,  89, 208, 149,  41,  92,  82,  65,  80,  51, 164, // ..Y..).RAP3.
+ 199, 204, 238, 116, 203, 149, 187,  83, 129, 139, 156, 198, // ...t...S....
+ 137,  83, 116,  15, 101, 207, 129, 151,  42, 124,  47,  68, // .St.e...*|/D
+  33, 101, 131,  11, 112, 200, 196, 172, 123, 120, 136,  93, // !e..p...{x.]
+  57,  31,  56, 167,   8,  39, 234,  81, 173, 252,  14,  87, // 9.8..'.Q...W
+ 209, 199,  49, 118,  40, 219, 226,  17,  26, 205,  49, 180, // ..1v(.....1.
+ 148, 168,  79, 159, 136, 125, 217, 124, 186, 172, 179,  45, // ..O..}.|...-
+ 220,  86, 103, 211,  87,  23, 148, 180, 233, 151, 116, 180, // .Vg.W.....t.
+  66, 198,  85, 119, 148,   6, 139,  57, 211,  93, 253, 104, // B.Uw...9.].h
+ 225, 222, 251,  73, 187,  95, 175, 119,   7, 121,  55, 137, // ...I._.w.y7.
+  29, 236, 183, 120, 143,  56, 123,  97, 238,  78,  96, 228, // ...x.8{a.N`.
+ 228, 214,  74, 104,  46, 142,  83, 135, 184,  90, 239, 110, // ..Jh..S..Z.n
+ 182, 102,  75, 229,  60,  11, 166,  76, 124, 235,  22, 119, // .fK.<..L|..w
+ 240, 167,  85,  81,  39, 224, 125, 108, 238,  46,  66,  34, // ..UQ'.}l..B"
+  68, 146,  14, 214, 201, 162, 206, 117, 195, 122,  91,  74, // D......u.z[J
+ 111, 245, 182, 112, 223, 150,  70, 165,  10, 104, 202, 139, // o..p..F..h..
+   1, 193,  83, 157,   7,  22, 214, 224, 179, 166,  54, 111, // ..S.......6o
+ 167,  72, 163,  87, 239,  20, 183, 156,  38,  19,  28,  34, // .H.W....&.."
+ 125,  46, 172, 203,  39, 111, 115, 202, 224,  47,  94, 245, // }...'os../^.
+ 251, 234, 146, 181, 115, 247, 255,  28, 236, 226, 118, 160, // ....s.....v.
+ 196,  46, 119,  92, 236,  50,  69,  34,  76, 163,  13, 170, // ..w..2E"L...
+ 158, 118, 245, 254, 183,   1,  65, 198, 144, 200, 187,  28, // .v....A.....
+ 134, 152, 166, 112, 253,  40, 251,  62,  39, 121,  38,   5, // ...p.(.>'y&.
+  27,  79, 186, 226, 210, 194, 150, 200, 243, 188, 150, 179, // .O..........
+ 120, 230, 226, 169,  85,  99, 195,  15, 204, 106,  11,  75, // x...Uc...j.K
+  97, 158,  48, 129, 166, 104, 146, 128, 123,  31,  49, 218, // a.0..h..{.1.
+ 213,   2, 177, 213, 141, 233, 149, 214,   9, 139, 230, 250, // ............
+ 105,  39, 237,  37, 241, 165,  84, 220, 212,   4, 227,  32, // i'.%..T.... 
+ 118, 134, 212,  61, 140, 187, 223,  22, 108, 210, 153, 229, // v..=....l...
+  76, 213,  92, 164,  38, 136, 163,  90, 161, 157,  43,  25, // L...&..Z..+.
+  51, 116,  78, 194, 154,  13, 155, 248, 209, 231, 117,   6, // 3tN.......u.
+ 171,  85, 171, 215,  54,   8, 244,  42, 117,  88, 148, 162, // .U..6..*uX..
+  19, 126,  28, 151,  92, 130,  22, 186, 196, 167, 204, 210, // .~..........
+  77, 174, 216,  38,  88,  64,  91, 207, 136, 125, 130, 214, // M..&X@[..}..
+  66,  66, 120, 154,  85, 158, 187,  95,  42,  75,  37,  66, // BBx.U.._*K%B
+  49, 170, 137, 254,  53, 176, 185,  79,  75,  57,  41, 136, // 1...5..OK9).
+ 167, 137, 238, 250,  22,  33, 178, 227,  48,  45,  14, 235, // .....!..0-..
+  93, 190,   4, 160, 221, 123, 174,  81,   1,  17, 196,  52, // ]....{.Q...4
+  21,  71,  14, 253,  54, 151,   2,  94,  84, 211,  58, 106, // .G..6..^T.:j
+ 114,  78, 167, 230, 109, 180,  91, 161,  92, 233,  16, 156, // rN..m.[.....
+  71,  20, 254,  24,   5, 142,  85, 224, 161,  87,  40, 152, // G.....U..W(.
+  43,  36, 134, 174, 220, 113,  46,  71,  83, 157, 204,  75, // +$...q.GS..K
+ 120, 148, 217, 165, 185, 140,  71, 113,  74, 207, 225,  81, // x.....GqJ..Q
+ 174,  11,  39,  96, 103, 166, 103, 205, 229,  11, 231,   1, // ..'`g.g.....
+ 225, 124, 174, 129, 203,  56,  92, 195,  98, 138, 194, 150, // .|...8..b...
+ 180,   4, 197, 157,  42,  79,  82,  57,  92,  69, 238, 227, // ....*OR9.E..
+ 240,  58,  19, 179,  72,   2,  38, 236,  64,  89,   0, 133, // .:..H.&.@Y..
+ 151, 205,  28,  62, 238, 215, 165,  92, 115, 150, 242, 155, // ...>....s...
+  17, 101, 186, 243, 103, 224, 246,  58, 187, 168,  58, 227, // .e..g..:..:.
+  86,  28, 170, 101, 167, 141,  75, 128, 195, 149, 106,  93, // V..e..K...j]
+  58, 189,  83,  50, 210, 171, 230, 184,  34,  55, 157, 157, // :.S2...."7..
+ 104, 128,  59,  59,  39,  96, 252, 117,  53,  21,  50,  77, // h.;;'`.u5.2M
+ 169, 243, 238, 169, 239, 199, 197,  73,  28, 155, 141, 208, // .......I....
+ 180, 172, 143, 145,  31,  90, 206,  72, 176, 133, 133,  54, // .....Z.H...6
+ 179,  69, 231,  67, 234,  28, 217, 164,  50, 216,  99,  62, // .E.C....2.c>
+ 202, 210,  95, 148, 167, 130, 154,  98, 140,   2, 231,  60, // .._....b...<
+  44, 105, 153,  31,  31, 182,  73, 159,  67, 194,  84, 187, // ,i....I.C.T.
+ 173, 103, 125,  46,  17,  51,  71, 186,  42,  39, 141, 201, // .g}..3G.*'..
+ 168, 243, 202, 208, 228, 125, 175, 179, 230, 100,  88, 251, // .....}...dX.
+ 185, 117,  21,  79,  93, 221,  55, 102,  66,  28,  46,  96, // .u.O].7fB..`
+   1, 172, 232, 146,  37, 164,  52,  29,  82, 102,  30,  44, // ....%.4.Rf.,
+  58,  31, 104,  72, 116, 123, 190, 223, 193, 241, 106, 231, // :.hHt{....j.
+ 186,  36,  61, 244, 110, 106, 128, 226,  16,  87, 117, 134, // .$=.nj...Wu.
+  10, 225, 135, 197, 139, 122, 191, 147,  87, 150, 212,  74, // .....z..W..J
+  78,   3, 205, 120, 178, 202,  42,  14, 225, 217,  53, 225, // N..x..*...5.
+  44, 153, 102, 190, 127,  89, 180,  34,  78, 185,   5,  91, // ,.f..Y."N..[
+ 122, 126, 165,  22,  56, 157,  57, 155, 232,  30,   9, 155, // z~..8.9.....
+ 208, 164, 142, 153, 155,  55, 247, 243, 203,   7, 229, 214, // .....7......
+ 176,  62, 191, 134,  75,  97, 221, 214, 192, 151, 170,  22, // .>..Ka......
+ 156, 230, 131,   0, 151, 156, 191, 254, 243, 238,  12, 221, // ............
+  62,  24, 240,  82,  51, 242, 184, 249, 192,  99, 155,  50, // >..R3....c.2
+ 252, 235,  29, 230,  95, 231, 222,   8,  78, 141,  65,   0, // ...._...N.A.
+  75,  58, 100, 105, 144, 187,   0,  29, 233, 150, 145,  21, // K:di........
+ 235, 143,  58, 121, 158, 157,   8,  87, 137, 107, 204,  91, // ..:y...W.k.[
+  63, 227, 223, 244, 128, 170, 165, 235, 189, 172, 176,  95, // ?.........._
+  48, 141, 176, 176,  60, 156, 222,  56, 203, 242, 183, 222, // 0...<..8....
+ 207, 248, 215, 154, 234,  30, 225, 127, 221,  59, 249, 220, // .........;..
+ 176,  78,  12, 240, 149, 186, 120, 226, 230, 175, 243,  27, // .N....x.....
+ 136, 176, 156, 137, 214,  67,   9, 230,  44, 199, 226, 162, // .....C..,...
+ 243, 250, 181,  24,  22, 184,  30, 247, 232, 184,  85, 225, // ..........U.
+ 111,  22, 173, 171, 253, 204,  44, 110, 147,  23, 247,  71, // o.....,n...G
+ 111, 130, 105,  75, 239, 104,  45, 186,  93,  23, 149,  56, // o.iK.h-.]..8
+  60, 232, 164,  44,  81, 146, 244, 243,  88,   5,  46,  99, // <..,Q...X..c
+   5, 202, 127, 187, 117, 235, 214, 165,  59, 219, 124, 112, // ....u...;.|p
+ 153, 236, 168,  42, 127, 150,  15, 220,  57, 143, 227,  56, // ...*....9..8
+ 112, 110, 156, 101, 229,  45, 238, 214, 215, 119, 114,  82, // pn.e.-...wrR
+ 206, 227, 208,  78, 101,  78, 132,  93,  54, 167,  77, 121, // ...NeN.]6.My
+  12, 208, 255,  22,  45, 157, 211, 151, 133, 199, 254, 188, // ....-.......
+ 181, 155, 250, 206,  80,  23, 213,  73, 150, 171, 151,  31, // ....P..I....
+ 153, 101, 203, 139, 254, 163, 246, 143, 217, 249, 152,  51, // .e.........3
+ 114, 179, 167, 171, 188,  38, 191,  77, 141, 223, 237, 153, // r....&.M....
+   8, 128,  44,  16, 216, 118,  88,  81, 107, 110,  81,  59, // ..,..vXQknQ;
+ 148, 203, 202, 218,  10, 237,  48,  58,  69, 145, 251,  58, // ......0:E..:
+  63, 176, 199,  25, 152,  34,  97, 170,  89, 150,  60, 143, // ?...."a.Y.<.
+ 173, 244, 235, 148, 165, 106,  37, 111, 185,  66,  27,  67, // .....j%o.B.C
+ 152, 203,   5, 140, 200, 220, 121, 255, 143, 180, 183, 137, // ......y.....
+ 230, 106,  58,  54, 234, 173, 205,  94, 108, 132, 240, 213, // .j:6...^l...
+  11, 178,  41,  33, 249,  53, 121,  32,  66, 100, 189, 206, // ..)!.5y Bd..
+ 232, 112,  63,  67,  77,  24, 194,  48, 174, 144,   0, 229, // .p?CM..0....
+ 182, 253, 119, 171,  31, 118, 248, 124,  95,  62, 191,  63, // ..w..v.|_>.?
+  49, 175, 245, 254,  56,  73,   4, 159, 213,  76, 190, 123, // 1...8I...L.{
+  37, 202, 162,  54, 185, 117, 174,  11,  83,  80, 242, 163, // %..6.u..SP..
+  60, 127, 154, 136, 114, 116,  51, 180, 152,  95, 127,  52, // <...rt3.._.4
+ 103,  32, 215, 167, 101, 156, 108, 129, 234, 185, 173,  57, // g ..e.l....9
+ 114, 151,  78, 146, 184, 239, 245, 222,  88,  95, 129, 110, // r.N.....X_.n
+  52,  26,  71, 163, 202, 142, 111,  54,  55, 255, 110, 103, // 4.G...o67.ng
+ 197, 233, 230, 148,  20, 231, 242, 234, 254, 205, 133, 208, // ............
+   3, 152, 191, 186, 122, 203,  10, 165,  63,  30,  65, 124, // ....z...?.A|
+  46, 247,  29,  90,  60,  62, 131,  56, 170,  90,   1, 193, // ...Z<>.8.Z..
+  52,  57, 126,  73,  63, 160,  23,  84,  94,  50, 223,  18, // 49~I?..T^2..
+ 161, 130,  43, 150, 208, 114,  22,  43, 169, 191, 228, 142, // ..+..r.+....
+ 233,  42,  74, 223,  52,   7,   5, 174, 243,  89,   1,   8, // .*J.4....Y..
+  18, 170, 151, 244, 250,   3, 103, 105, 244,   7, 119, 167, // ......gi..w.
+ 164, 104, 155,  21, 221, 164, 133,  61,  91, 116, 131,  43, // .h.....=[t.+
+ 162, 169,  44, 193, 130,  76, 205,  72, 217,  19,   3, 206, // ..,..L.H....
+ 168, 177, 158,  12,  70,  32,  50, 166,  20, 155, 166, 139, // ....F 2.....
+ 205, 176, 131, 211, 147, 121, 149, 144, 218, 236,  67, 162, // .....y....C.
+  27, 202, 179, 238,  10, 158,  90, 119, 224,  25,  85,  90, // ......Zw..UZ
+  17, 238, 206, 163, 108,  77, 103,   5, 188, 226, 158, 233, // ....lMg.....
+ 245,  66,   8, 219, 214,   5,  81, 251, 162, 122, 167, 132, // .B....Q..z..
+ 182, 152,  91, 131,  80, 235, 167, 245,  70,  69, 100,  88, // ..[.P...FEdX
+ 162,  90, 218, 226,  76, 252, 107, 212,  74,  79, 163, 111, // .Z..L.k.JO.o
+ 241, 201,  71, 243, 240, 137,  31, 160, 182, 249,  17,  18, // ..G.........
+  49, 126, 250,  68,  79,  92, 127, 221, 109,   0, 232, 108, // 1~.DO...m..l
+  65,  27, 117,  44, 230, 191, 221, 138, 134,  26,   7,  26, // A.u,........
+ 181,  64, 175,  53, 151, 178, 154, 163, 187,  96,  96, 236, // .@.5.....``.
+ 252, 223, 227, 160,  93, 200, 168,   0, 129, 222,  71, 205, // ....].....G.
+ 249, 220, 223,  12, 114, 152, 210,  86,  40, 117, 255,  22, // ....r..V(u..
+  41,   4,  92,  79, 254, 167,  79, 221, 114,  47,  17,  88, // )..O..O.r/.X
+  49, 194,  33, 198, 237, 170, 225, 148,  88, 153, 201,  44, // 1.!.....X..,
+  78, 227,  11,  79, 131,  10, 203, 219, 224, 233, 218, 137, // N..O........
+ 169, 251,  15, 124, 189,  81,  59, 255, 177, 137, 119, 170, // ...|.Q;...w.
+ 232,  13, 142, 245, 197, 251,  15, 116, 224, 167,  85, 216, // .......t..U.
+ 158,  90, 230,  72, 246,  72, 149,  89,  65,   1, 189, 185, // .Z.H.H.YA...
+ 180,  78, 183,  89,   7, 205, 124, 160, 234,  46, 196,  68, // .N.Y..|....D
+ 188, 206, 211,  60,   9, 116,  70, 221, 146,  48,   9, 180, // ...<.tF..0..
+  69, 231,  40, 105,  80, 107, 154,  93, 189, 109,  69, 159, // E.(iPk.].mE.
+  22, 253,  93,  85,  16, 151, 224, 208, 182, 249,  17, 164, // ..]U........
+ 254, 211, 170,   8, 173,  92, 194, 209, 226,  10, 172, 194, // ............
+ 124, 205, 159,   2, 242, 127,  67,  90, 205,  63, 205, 164, // |.....CZ.?..
+ 200, 180, 220,  59, 235, 245, 130, 185,  72, 109, 142, 212, // ...;....Hm..
+  80, 200, 157,  33,  19,  57, 157, 148, 134,  38, 109,  32, // P..!.9...&m 
+ 165, 110, 223, 107, 205,  81, 109, 144, 246,  97, 229,  20, // .n.k.Qm..a..
+ 215, 196,  91,  25,  62, 252,  95, 223, 226, 179, 126, 222, // ..[.>._...~.
+  57, 138,  71, 211, 229,  33,  80,  37, 242, 177, 114,  89, // 9.G..!P%..rY
+  98,  80, 144,  33,  33, 107,  60,  63, 115, 203, 108, 220, // bP.!!k<?s.l.
+ 182, 165,  88,  61,  64, 107, 124,  57, 253, 227, 164, 106, // ..X=@k|9...j
+   7, 165,  95, 182, 159,  83,  29, 156, 254,   0,  61, 220, // .._..S....=.
+ 228, 230, 117, 104,  88,  77, 251, 177,   8, 114,  12, 115, // ..uhXM...r.s
+ 151,  74, 123, 156, 228, 182, 183, 186,  57,  90, 212, 212, // .J{.....9Z..
+ 116,  89, 214,  30, 203,  51,  62, 103, 160, 243, 163,  53, // tY...3>g...5
+   3,  26, 242, 143,  78, 179, 252,  96, 191, 227, 175, 111, // ....N..`...o
+ 110, 170,  90, 249, 135,  88,  71,  61,  75,  69,  54, 247, // n.Z..XG=KE6.
+ 195, 117, 251, 229, 237,  91, 170, 102, 254, 107, 152,  73, // .u...[.f.k.I
+ 251,  95,  71, 113, 111, 208, 169, 249,  14, 128, 222, 134, // ._Gqo.......
+ 254, 112, 192, 221,  17,  73, 184, 170, 153, 203, 163, 242, // .p...I......
+ 166, 198, 192,  44, 149, 185, 148,   8, 150, 217, 114,  74, // ...,......rJ
+ 149, 167, 132, 101, 185, 154, 205, 134,  81,  49, 212,  93, // ...e....Q1.]
+ 199, 217, 221, 208, 255,  77, 233, 194, 113, 183, 191, 168, // .....M..q...
+ 167, 209, 121,   1,   0,  13, 197, 106, 220,  83, 216, 133, // ..y....j.S..
+ 161,   7, 162, 208,  83,  73, 124,  28,  39,  97,  67, 193, // ....SI|.'aC.
+ 206, 245, 190, 162, 237,  66,  71, 111, 184, 115, 110,  12, // .....BGo.sn.
+  94,  93, 195, 119,  20, 241, 170, 196, 234,  34, 106, 200, // ^].w....."j.
+ 187,  70,  77, 250,   8, 209,  99, 191, 109, 208, 155,  73, // .FM...c.m..I
+ 230,  27, 209,  91, 171, 149,  83,  69, 107, 113,  87,  79, // ...[..SEkqWO
+  40,  86,  30, 126, 116, 255, 122, 215,  66,  83, 196,  54, // (V.~t.z.BS.6
+ 191,  97, 154, 195,  26,  31,  60, 215, 233, 119,  69,  37, // .a....<..wE%
+ 106,   4, 235, 167, 203, 154, 112, 106, 132, 146,  82, 104, // j.....pj..Rh
+ 252,   5, 240,  79, 120, 175, 156,  84,   1,  66, 161,   1, // ...Ox..T.B..
+  13, 137, 186,  90, 189, 234, 189,  53, 167, 122,  88, 118, // ...Z...5.zXv
+  46, 238, 235, 108, 191, 156, 193,  46, 234, 231, 165, 107, // ...l.......k
+  63, 167, 155,  77, 233, 215, 188, 121, 185, 254, 146, 204, // ?..M...y....
+  95,   4, 241,  67,  16, 122,  31, 226, 164, 155,  29, 197, // _..C.z......
+  75, 166,  35, 174, 220, 228,  46, 118, 132, 195, 146, 113, // K.#....v...q
+ 111,  60, 154,  21, 243, 241, 211, 152, 120, 246, 193, 232, // o<......x...
+  95, 255, 236, 252, 235, 159,  76, 102,  16, 201, 129,  36, // _.....Lf...$
+ 106, 163, 118, 132,  58, 106,  39, 157, 180,  32, 164, 240, // j.v.:j'.. ..
+ 175, 127, 246,  98, 113,  72,  80,  35,  30, 188,  22, 211, // ...bqHP#....
+  44, 164,  93, 152, 225, 255, 235, 159,  84,  54, 175, 209, // ,.].....T6..
+ 134,  57,  30,  32,  33, 167, 186, 210, 179,  90,  70, 165, // .9. !....ZF.
+  24,  59, 114,  67, 192,  75, 168,  18, 198,  40, 124, 166, // .;rC.K...(|.
+  91,  85,  21, 234,  93, 206,  60, 216, 136,  27, 201, 227, // [U..].<.....
+  78, 175, 166,  69,   9, 180,  35, 105,  75,  30, 252, 235, // N..E..#iK...
+ 159, 131, 116, 245, 242,  89,  94, 119, 168,  28,  51, 244, // ..t..Y^w..3.
+  91,  83,  67,  55,  52,   2, 160,  98, 247, 114, 200, 168, // [SC74..b.r..
+ 236,  32, 179, 173,  22,  45, 215,  66, 166, 231,  50, 245, // . ...-.B..2.
+ 192, 255, 172, 253, 166,  81,  36, 227, 131, 187, 182, 206, // .....Q$.....
+ 121, 112,  88, 230, 254, 103, 192,  28,  76, 245, 107,  64, // ypX..g..L.k@
+ 151,  37, 200, 201,  44, 175, 207,  46,   4, 195, 224, 212, // .%..,.......
+   5, 187, 112,  90,  46,  32, 190,  35,  16,  72, 233,  60, // ..pZ. .#.H.<
+ 243, 172,  63,   1, 143,  17,  51, 202, 104, 228,  32,  78, // ..?...3.h. N
+  68,  68,  87,  81,  59,  26, 201, 227, 190, 198, 220, 176, // DDWQ;.......
+ 226, 146,  10, 156,  74,  95,  83,  77,  39,  68, 201,  95, // ....J_SM'D._
+ 183, 210, 161,  45, 239,  84, 108,  19, 171, 189, 173, 117, // ...-.Tl....u
+ 122,  71, 131, 116, 141, 255, 214,  52,  12, 175, 225,  15, // zG.t...4....
+  78,  80, 125, 152, 240, 236,  24, 252,  12,   5, 229, 138, // NP}.........
+ 241,  17,  78, 190, 178,  39,  21, 175,  37, 250,  76, 226, // ..N..'..%.L.
+ 105, 126, 102,  79, 165,  17,   3,  84, 234, 246, 110,  14, // i~fO...T..n.
+  28,  52,  93,  40, 223, 133,   3, 193, 243, 217, 211, 201, // .4](........
+ 251,  47,  61, 206, 230, 109, 133, 107,  33, 255,   5, 200, // ./=..m.k!...
+ 222,  72,  36, 126,  72, 143, 124, 138, 230, 189, 226, 116, // .H$~H.|....t
+ 168,  16,  31, 178, 149, 230, 180, 118, 197, 224, 181, 116, // .......v...t
+  52, 244,  30, 198, 140,  28,  41,  43, 149, 173,  87,  51, // 4.....)+..W3
+ 222, 110, 184, 177, 107,  40,  22, 207,  78,  23, 187, 216, // .n..k(..N...
+  17, 192,  16,  61,  57, 169, 236,  31, 203, 236, 112,  40, // ...=9.....p(
+  89, 205,  88, 165, 181, 214, 174, 105,   8, 156, 190, 190, // Y.X....i....
+ 107, 121, 181, 176, 154, 103, 137,  35, 111, 242,  15, 158, // ky...g.#o...
+  29, 105,  73, 182, 154,   1, 125,  26, 102,  81, 131,  27, // .iI...}.fQ..
+  99, 248,  69, 145, 150, 144, 132, 148,  73, 101, 238,  66, // c.E.....Ie.B
+  77, 113, 202,  90,  57,  91, 112, 166, 131, 255,  16, 126, // Mq.Z9[p....~
+ 229,  31, 212, 159, 127, 252,  99, 226,  45, 104, 248,  98, // ......c.-h.b
+ 166, 118,  93, 243, 130, 242,  47, 206, 106, 195,  60, 235, // .v].../.j.<.
+ 141, 187,   5,  31,  59, 153, 187, 237, 255,  99,  53, 155, // ....;....c5.
+   1,  24, 148, 227, 116, 217,  93,  21,  33,  34, 221, 154, // ....t.].!"..
+ 237, 116,  84, 182, 189, 227, 158, 200, 217, 231, 148, 106, // .tT........j
+ 143, 170, 103, 255, 111,  11, 255,  87, 108, 225, 235,  66, // ..g.o..Wl..B
+ 145, 172,  74,  11, 254, 149,  58, 145,  63, 240, 189,  59, // ..J...:.?..;
+ 239, 126, 235,  60, 241,   2, 117, 213, 163, 113, 106, 246, // .~.<..u..qj.
+  65,  92, 217, 136, 163,  14, 118, 210, 112,  90, 192, 163, // A.....v.pZ..
+ 205, 187, 138,   3,  64, 237,  95, 146, 157,  32, 161, 251, // ....@._.. ..
+   2,  42,  55, 110, 248, 198, 102, 122,  12, 255, 228,  72, // .*7n..fz...H
+ 131,  37, 121,  62,  99, 123, 190, 168,  88, 105, 116,  61, // .%y>c{..Xit=
+ 157,  51, 109, 149, 222, 143, 225,  57, 193, 235,  12,   7, // .3m....9....
+ 107, 210, 184,  23, 192,  79,  83, 202, 153, 214,  85,  89, // k....OS...UY
+  30, 195, 241, 150, 207,  97,  70, 230, 245, 248,  38, 156, // .....aF...&.
+  38,   4,  19, 245,  56,  90,  20, 234,  88, 251, 123,  90, // &...8Z..X.{Z
+ 165, 134, 218, 171,  59, 197, 174, 118,   3, 149,  73,  50, // ....;..v..I2
+ 123, 175, 154, 113,  30, 161,  51, 131,  27,  55, 102,  60, // {..q..3..7f<
+  33, 165,  65, 112, 174, 179, 225, 146,  45, 174,   6, 104, // !.Ap....-..h
+ 255,  37,  55, 129,   8,  28, 111, 251,  57,  28,  67, 217, // .%7...o.9.C.
+ 160,   0, 240, 144,  85, 192, 206,  29, 148, 250, 232, 195, // ....U.......
+ 160, 160,  73,  24,  15, 246,  60,   4, 139,  53,  21, 199, // ..I...<..5..
+ 187,  17, 199,  97, 152, 136, 183, 138,  74,  40,  44,  93, // ...a....J(,]
+  38, 138,  85,  30,  20, 151, 214,  82,  32, 230,  66, 129, // &.U....R .B.
+ 104,  14, 250, 147, 243, 213, 213,  85, 253,  60, 113, 130, // h......U.<q.
+ 122, 125, 117, 162,  73, 184, 147, 197, 136, 168, 109, 221, // z}u.I.....m.
+ 101,  17, 198,  97, 166, 181, 221, 110, 168, 196,  45, 137, // e..a...n..-.
+  57,  84, 105, 197, 209,  85,  18, 232, 160,  50, 126, 170, // 9Ti..U...2~.
+ 221,  67, 100, 198, 213, 128,   7,  79,  39,  94,  20,  37, // .Cd....O'^.%
+  52, 125, 236,   7, 237, 226, 194, 235,  96, 214, 167, 210, // 4}......`...
+ 186, 180,  79, 179,  35,  55, 145, 199, 198, 175, 106,  41, // ..O.#7....j)
+  54, 221, 130, 193,  56, 186,  74, 187,  17,  33, 128,  86, // 6...8.J..!.V
+  65, 228, 239, 153, 126,   6, 191,  72,   8, 180,  44, 114, // A...~..H..,r
+ 161,  71, 239,  57,  26, 122, 187,  48, 112, 248,   5, 112, // .G.9.z.0p..p
+   8,   7,  62,  95,  52,  20, 178,  23, 228, 175,  35, 184, // ..>_4.....#.
+  56, 208,  41,  73, 180, 245,  24, 193,  48,  17,  41, 112, // 8.)I....0.)p
+  85, 251, 253, 136, 182, 244, 198,  69,  15, 124, 239,  89, // U......E.|.Y
+  74, 173,  12, 122, 181,  95, 183,  95, 189, 172, 241,  56, // J..z._._...8
+  81, 152,  29,  71, 124, 243, 155, 155, 141,  21, 250, 239, // Q..G|.......
+  38, 251, 252, 200,  59, 180,  75, 142, 252,  50, 180, 137, // &...;.K..2..
+ 118, 133, 183, 202,  81, 210, 140, 151, 168, 140,  67, 247, // v...Q.....C.
+ 148, 209, 185,  94, 250, 231, 132, 191, 105,  83, 247, 225, // ...^....iS..
+ 241, 224, 220, 113, 222,  32, 190,   0, 126, 130,  47,   0, // ...q. ..~./.
+  99, 186, 110, 132,  65, 208, 115,  40,  73, 195,  59, 155, // c.n.A.s(I.;.
+ 127, 111, 149,  87,  19,  21,  25, 114,  69, 152, 186, 144, // .o.W...rE...
+ 195,  48, 250, 171, 158, 113,  49, 112,  66, 120, 134, 240, // .0...q1pBx..
+  89, 254,  77,  44, 244, 225,  32, 114, 107, 152, 157, 196, // Y.M,.. rk...
+ 208, 172, 223,  63, 171, 253, 210, 169,  17, 140,  30, 196, // ...?........
+  69, 228, 237, 237,  39, 157, 244, 155,  87,  59, 132, 167, // E...'...W;..
+   2,  54, 245,  31, 133, 107, 107,  71,  89, 122, 144, 101, // .6...kkGYz.e
+  52, 244, 147, 145, 181, 210, 159, 182, 129, 100,  17, 163, // 4........d..
+ 183, 245,  66,  23, 133, 247, 129,  95, 214,  58,  48, 135, // ..B...._.:0.
+ 135,  27,   2,  59,  63, 175, 120, 126,  94, 227, 132, 136, // ...;?.x~^...
+ 149, 153, 169,  66, 225, 142, 112,  20,  38, 139, 103,  76, // ...B..p.&.gL
+ 143,  68, 203, 127, 100,  28, 179, 233, 229, 245,  17, 151, // .D..d.......
+ 168, 129,  70, 105, 243,  82, 249,  18, 102, 206, 173, 183, // ..Fi.R..f...
+ 198, 255, 227,  90, 178,  84, 130,  35,  46, 159, 139, 251, // ...Z.T.#....
+  38, 215,  13,  99,  84, 117, 202, 104, 156, 189, 173, 125, // &..cTu.h...}
+ 110, 175, 222,  92,  83, 158, 135,  16, 100,  78, 129, 149, // n...S...dN..
+ 232,  75, 123,  24, 193, 197, 212,  23, 131,  16, 163, 100, // .K{........d
+  50, 209, 173,  57, 126,  31,  42,  87,  89, 203,   6, 221, // 2..9~.*WY...
+ 195, 195, 188,  55, 247, 226,   8, 238, 218,  38, 122,  88, // ...7.....&zX
+ 220, 113,  56, 146, 168, 129,   0, 161, 214,  10, 150, 123, // .q8........{
+  79, 106, 107, 101,  62,  18, 153, 145,  48, 109, 243,  74, // Ojke>...0m.J
+   4, 120, 195, 147, 153,  64, 227,  69, 193, 146,  10,  68, // .x...@.E...D
+  90, 108, 233,   2, 168, 162, 220, 148, 105, 118, 114, 212, // Zl......ivr.
+ 246, 188,  80, 230,  48, 240,  95,  82,  93,  83, 171, 251, // ..P.0._R]S..
+ 201, 129, 126,  53,  30, 192, 250, 138,  22, 151, 146, 158, // ..~5........
+ 210, 193,  84, 220, 167, 243, 238,  57,  17, 139, 219,  68, // ..T....9...D
+  44, 226, 156,   9, 147,  74, 214, 227, 206,  32, 137, 123, // ,....J... .{
+  97, 106, 129, 160, 246, 209,  47, 145, 130, 185,  23, 128, // aj..../.....
+ 175,  78, 157,   8, 240,  20, 188, 210, 254,  35, 124,  70, // .N.......#|F
+ 231,  15,  92,  76, 114,  33, 132, 197, 179, 225, 253, 156, // ...Lr!......
+ 221, 249, 196, 237,  31,  61, 109, 211,  68, 223, 239, 228, // .....=m.D...
+  63, 222,  71,  51, 184,  76, 105,  34, 229, 131,   8,  36, // ?.G3.Li"...$
+ 223,  16, 107, 150, 207, 133,  98,  11, 107, 122, 249,  77, // ..k...b.kz.M
+  79, 205, 130, 209, 114,  30,  78, 106, 188,  96, 145, 231, // O...r.Nj.`..
+ 213, 176, 156, 145, 119,  20, 167,  99, 111,  10,  58, 245, // ....w..co.:.
+ 146,  68,  75, 250, 193,  89, 244,  69,  11, 122, 197, 133, // .DK..Y.E.z..
+  53,  21, 154, 123,  51,  83,   5, 182,  79,  46,  12, 235, // 5..{3S..O...
+  89, 140, 224,  86, 205,  73, 150,  89, 161, 212, 204,  77, // Y..V.I.Y...M
+  21, 175,  39, 121, 153,  84, 118, 120, 141, 122,  44,  47, // ..'y.Tvx.z,/
+ 174, 187, 146, 247, 145, 127, 174,   7,  77, 235, 148, 165, // ........M...
+ 236,  18, 140, 149,  98, 128,  41, 136, 158, 164,  69, 193, // ....b.)...E.
+  40,   1,  43, 114, 120, 177, 127, 186, 123, 189, 222, 135, // (.+rx...{...
+  65, 143, 240, 216, 195,  65, 135, 192, 130,  22, 103, 144, // A....A....g.
+ 210, 145,   8, 159,  56, 153, 185,  90, 165, 213, 177, 142, // ....8..Z....
+   4,  45, 233, 245,  33, 104, 205,  71,  59,  63,  25,  87, // .-..!h.G;?.W
+  44, 203, 231,  41, 123,  89, 129,  38, 186,  93, 141,  88, // ,..){Y.&.].X
+  94, 109, 239, 176,  15, 145, 164,  87, 184, 180, 162, 158, // ^m.....W....
+ 178, 170, 134, 171,  22,  28,  61, 117, 140, 133,  81, 197, // ......=u..Q.
+  79,  22,  47, 155, 229, 243, 182,  30, 225, 163, 154, 253, // O./.........
+ 136, 183, 164,  76, 146, 250, 109, 218,  83, 244, 121, 151, // ...L..m.S.y.
+ 102,   6,  84, 111,  98, 249, 172,  84, 153,  25, 204,  42, // f.Tob..T...*
+  51, 152,  27, 208,  29,  88, 244,  59,  82,  98, 190,  13, // 3....X.;Rb..
+ 224,  29, 235, 231, 103,  44,  84, 239, 194,  85,  99, 127, // ....g,T..Uc.
+  66, 148, 204,  48, 138,  57, 154,  76, 187,  29, 239, 120, // B..0.9.L...x
+ 182, 243, 222, 174, 234,  25, 167,  65,  83,   7, 183,  58, // .......AS..:
+ 140,  28,  95, 169, 133,  58, 136, 150,  14, 111, 220,  32, // .._..:...o. 
+ 160,  21, 122, 187, 109,  34,  55,  29,  33, 106, 128,  80, // ..z.m"7.!j.P
+ 221,  75,  81, 132, 216, 228, 195, 160,  77, 152, 171, 115, // .KQ.....M..s
+   0, 143, 163, 131,  99,  47, 252,  83, 237,  69,  90, 244, // ....c/.S.EZ.
+ 242, 166, 115,  18,  22, 171, 246,  89,  67,  65,  34,  14, // ..s....YCA".
+ 216, 100, 232,  97, 170, 223,  22,  13,  31,   1,  70, 135, // .d.a......F.
+ 170,   7,  29, 192, 156, 146, 147, 179, 109, 120,  77, 162, // ........mxM.
+  25,  70, 128, 185, 240, 176, 125, 190, 183,   7,   8, 176, // .F....}.....
+ 237,  80,  55, 254, 245,  79, 111,  34, 254, 216, 168,  91, // .P7..Oo"...[
+  33, 119,  78,  38, 198, 144,   6,   8, 124, 176,  87, 153, // !wN&....|.W.
+ 151, 104, 104,  92,   0,   5, 254,   1, 141, 187, 215, 126, // .hh........~
+  31, 194,   9, 119,  57, 126,  62, 149, 196, 243, 230,  71, // ...w9~>....G
+ 118, 194, 253, 101, 249, 124,  56,  89, 101,  10,   7, 161, // v..e.|8Ye...
+  78,  84,  23, 132,  69,  73,   3, 254, 233, 159, 163, 245, // NT..EI......
+  88,  57,  83,  97, 118, 131,  25,  43,  22, 125,  63,  25, // X9Sav..+.}?.
+ 231,  52, 232,  69,   3, 204, 245, 164,  13,  12,  28, 140, // .4.E........
+  48, 148, 177, 118, 199, 217, 157, 113, 199, 137, 104,  63, // 0..v...q..h?
+ 253, 153, 212,  34,  80, 231, 226, 202,  73, 123, 253,  66, // ..."P...I{.B
+ 132, 240, 112, 120, 245, 222,  10, 252,  88, 175, 171,  42, // ..px....X..*
+ 183, 184, 118, 213, 215, 213,  52, 189, 165, 116, 245, 253, // ..v...4..t..
+ 236,  91,  38,  78,  90, 211,  62, 179, 176,  64,  68, 130, // .[&NZ.>..@D.
+ 250,  38, 156, 130, 102, 107,  14,  16,  55,  54, 137, 181, // .&..fk..76..
+ 243,  43, 162, 131, 167,  60,  35, 178, 246,  39,  62, 210, // .+...<#..'>.
+   6, 197, 240,  11, 166,  61, 229, 193, 145,  44,  60, 159, // .....=...,<.
+ 138, 151, 169, 123,  73, 194, 101,  71,  62,  39,  18,  69, // ...{I.eG>'.E
+  38, 159, 114,  92, 220, 180, 189,  74, 139, 134,  64, 190, // &.r....J..@.
+ 125, 141, 143, 105,   3,  26, 204, 220, 152, 152, 117, 192, // }..i......u.
+ 208, 108, 114,  83, 101, 248,  42,  64,  46,  65,  33,  60, // .lrSe.*@.A!<
+  32, 115,   1, 223, 123, 196, 172, 104,  68,  67, 166, 116, //  s..{..hDC.t
+ 132, 177,  26, 117,  59, 195, 216,  36, 128, 170, 118,  42, // ...u;..$..v*
+ 161, 141, 152, 199, 240, 128, 245,  80, 156, 252, 248, 150, // .......P....
+ 163, 171,  14, 125, 206,  56,  76, 211, 227,  33,  55,  60, // ...}.8L..!7<
+  36,  98, 217, 108,  82,  53,  53, 221, 174,   7,  65,  56, // $b.lR55...A8
+  60,  91,   0,  78, 186,  95, 118, 215, 232, 217, 152,  16, // <[.N._v.....
+ 156, 233, 147,  17,  64, 134, 139,  99,  83, 148, 246, 208, // ....@..cS...
+ 190,  92, 217, 153, 111, 155, 218, 215,  33, 195,  37, 237, // ....o...!.%.
+ 130,   1, 163,  90,  71, 213, 101, 217, 204,  97,  91, 124, // ...ZG.e..a[|
+  63, 134, 222, 152,  16, 123,  65, 101, 190, 104, 224,  45, // ?....{Ae.h.-
+ 143, 248,  95, 203,  32, 173, 109, 230,  73, 150,  34, 205, // .._. .m.I.".
+ 188,  56, 206,  24,  13, 171,  88,  88,   7, 193, 166, 116, // .8....XX...t
+  20,   9, 247, 211, 142,  53,  91,  21, 198, 150, 191,   2, // .....5[.....
+ 167,  86, 241, 165,  44, 129, 143,   9,  52, 138,  34,  31, // .V..,...4.".
+ 236, 195, 119,  31,  28, 209, 127,  33,  46, 143, 119,  49, // ..w....!..w1
+ 101, 150, 113,  14, 167, 248,  68,  98,  69, 139,  95, 202, // e.q...DbE._.
+ 170,  53,  75,  90,  72, 212,  70,  25,  67,  25, 205, 208, // .5KZH.F.C...
+ 134, 110, 148, 227, 241,  99,  84, 113, 134, 174, 217, 183, // .n...cTq....
+ 129, 113, 220, 204, 172,  33,  88, 232,  78,  84, 204, 231, // .q...!X.NT..
+ 169, 218,   4,  69,  59,  35,  53, 222, 141,  16,  38,  54, // ...E;#5...&6
+ 238,  99, 190, 131, 210, 129, 186,  90, 135, 119, 221, 193, // .c.....Z.w..
+ 206,  72,  56, 241, 126, 212, 213, 253, 164,  83, 192,  50, // .H8.~....S.2
+ 130,  93, 158, 174,  27,  55,  28, 185,  11, 208,  55,  88, // .]...7....7X
+ 192,  42, 167, 222, 183,  12, 212, 144, 240,  96, 135,  96, // .*.......`.`
+ 185,  31, 237, 244, 119,  26, 187, 187, 129,  26, 182, 251, // ....w.......
+ 130,   7, 101,  28, 191, 219, 113, 113, 183,  56, 128, 195, // ..e...qq.8..
+ 239, 149, 177,  78, 212, 239, 215,  28, 252, 232, 210, 193, // ...N........
+ 119, 213, 254,  37, 131,  63, 193, 136,  57, 228, 179, 191, // w..%.?..9...
+ 246, 255, 249, 159, 183,  87, 130, 207,  59, 242, 179, 187, // .....W..;...
+ 188,  22, 180,  16,  57, 185,  27, 157, 192,  63, 176,  14, // ....9....?..
+  95,  48, 216, 233, 238, 170, 231, 209, 139,  18,  84,   4, // _0........T.
+   8, 246,  39,  95,  16, 195, 224, 121, 187, 237, 100, 237, // ..'_...y..d.
+ 239, 182,  94,  88,  96, 147, 233, 188, 113, 163,  27,  69, // ..^X`...q..E
+  25, 100,  59,  52, 161,   3,  58,   8,  79, 118, 214, 119, // .d;4..:.Ov.w
+ 233,  53, 143,  86, 240,  20,  80,  29, 126, 165, 250, 124, // .5.V..P.~..|
+ 183, 210,  70,  80, 105, 128,  51, 247, 117, 231, 150, 241, // ..FPi.3.u...
+  89,   9, 160, 156, 195,  19, 244, 150, 198,  63, 199, 187, // Y........?..
+ 190,   9, 153,  69,  37,   6, 209,  57, 251, 116, 110,  42, // ...E%..9.tn*
+ 238,  37, 253, 178, 188,  33, 108,  78, 121,  19, 207,  87, // .%...!lNy..W
+ 247, 190, 142, 224,  81,  62, 202,  20, 188, 107, 211,  14, // ....Q>...k..
+ 139, 210, 128,  32,  24, 254, 182, 121, 160,  40,  53,  64, // ... ...y.(5@
+ 142, 200,  77,  40,  85,  48, 189, 246, 131,  10, 102, 124, // ..M(U0....f|
+ 149, 157, 248, 250, 252,  40, 126,  63,   7, 253,  51,  48, // .....(~?..30
+ 215, 246, 140, 213, 142, 247,  87, 227,  60, 207, 114, 229, // ......W.<.r.
+ 202,  50,  98,  43, 203,  32, 172, 230, 209, 154, 210,  12, // .2b+. ......
+ 198,  85,  15, 249,   6, 205,  69,  17,  68, 104, 157, 157, // .U....E.Dh..
+  47, 216, 161, 116, 134, 126, 217, 229,  24, 149, 129, 234, // /..t.~......
+  64,  24, 179, 192,  91, 185, 244, 135, 198,  47, 241, 173, // @...[..../..
+ 232,  97, 159, 168, 247, 184, 147,  98,  42, 116,  12, 194, // .a.....b*t..
+ 105,  95, 165, 240,  36,  90, 242, 138,  68, 186, 175, 174, // i_..$Z..D...
+ 180, 131, 201, 218,   1, 226, 255, 150,  30,  57,  91, 112, // .........9[p
+ 197, 154, 207, 117,   1,  94, 152,  89, 109, 233, 145, 151, // ...u.^.Ym...
+   9, 248, 232, 177, 249, 132,  78, 227, 160, 116, 114, 154, // ......N..tr.
+  16, 233, 168,  67, 104, 234,  25, 234, 231, 113, 252,  61, // ...Ch....q.=
+ 246,  11, 199, 179, 180, 241, 116,  46, 238, 204,  85, 233, // ......t...U.
+ 203, 220,  86,  10, 231, 141,  95,  32, 194, 134, 170, 211, // ..V..._ ....
+ 160,  91, 120, 172,  39,  15, 173,  76, 208, 246, 147,  90, // .[x.'..L...Z
+  84,  59, 109, 177,  31, 229,  86,  77, 127,  10, 114, 184, // T;m...VM..r.
+ 245,  37, 160, 106,  39, 180, 155,  11, 183,  75, 178,  98, // .%.j'....K.b
+  56,  22, 245,  86, 213, 193, 193, 216,  19, 189, 105, 122, // 8..V......iz
+   0, 247, 229, 182, 100, 160,   6, 237,  28,  18,  20, 250, // ....d.......
+ 207, 231, 248, 165, 185, 138,  33,  39, 234, 208,  43,  81, // ......!'..+Q
+  71, 136, 152,  85, 241,  83,  47,  51, 195, 123,  57,  88, // G..U.S/3.{9X
+  37,  74,  24,  79, 234,  59, 104,   8, 199, 127, 188,  63, // %J.O.;h....?
+ 127, 125, 175, 133, 251,  19, 141, 251,  77, 252, 149, 234, // .}......M...
+  39,  23,  23, 241, 212, 150,  38,  60, 232,  30,   4, 196, // '.....&<....
+ 169, 248,  47, 212, 190,  66, 224, 104, 255, 251,  74, 228, // ../..B.h..J.
+ 213, 196,  53, 137,  39, 123, 224,  81,  68,   4,  69, 150, // ..5.'{.QD.E.
+ 202, 233, 221,  54, 254, 248, 225, 242,  52,  27, 130, 180, // ...6....4...
+ 234,  28, 116,  52,  61,  51, 231, 244, 119,  63,  93, 133, // ..t4=3..w?].
+ 252,  43, 208, 212, 234,  61, 169, 149,  61,  90, 180, 227, // .+...=..=Z..
+  31, 172,  80, 190,  90,   5, 185,  35, 181, 221, 175, 224, // ..P.Z..#....
+ 216, 203, 100, 143, 111,  44, 115,  58,  45, 253,  35,  92, // ..d.o,s:-.#.
+ 116, 146, 211, 184,  69, 254,   7, 231, 181, 191,  68, 247, // t...E.....D.
+ 213,  83,  90, 241,   8, 196, 142, 177,  84,   7,  71, 144, // .SZ.....T.G.
+ 143, 133,   0,  42, 211, 150, 222,  92,  92, 140,   8,  65, // ...*.......A
+  58,  17,  34,  80,  64, 206, 161, 165,  95, 105, 126, 243, // :."P@..._i~.
+  64, 253,  81, 225, 141,  64,  86, 194,  33, 242,  11,  75, // @.Q..@V.!..K
+  11, 232, 229, 154, 198, 192, 230, 180, 173, 125, 243,  55, // .........}.7
+  97,  13,  36, 123, 112, 222, 190, 116, 206, 255, 148, 207, // a.${p..t....
+ 255,   0, 242, 206, 168, 176,   8,  57,  37, 132, 220, 110, // .......9%..n
+ 227,  61,  37, 246,  72, 239, 221,  74, 174, 129, 249, 132, // .=%.H..J....
+   5, 219, 179, 135, 193, 210,  12, 161, 146, 207,  28, 171, // ............
+   6, 223, 219, 142, 187, 226, 201, 242,  48, 112, 184,  12, // ........0p..
+ 255, 156,  22,  57,  63,  35,  14,  66, 200,  47,  68,  47, // ...9?#.B./D/
+ 117, 240,  38, 230,  47, 150,   0,  24,  65,  96,  66,   1, // u.&./...A`B.
+  84,  68, 175, 241, 100, 141,  37,  77,  40,  66,  60, 202, // TD..d.%M(B<.
+ 249,  81,  92,  28, 102, 189, 208,  27, 102,  35, 184, 157, // .Q..f...f#..
+ 203, 122, 103, 225,  20, 250, 230, 158, 148, 135,  15, 109, // .zg........m
+  89, 238,  66, 192,  81, 215,  16, 203, 142,  58,  75,  20, // Y.B.Q....:K.
+  66, 181, 145,  43, 229, 187,  76,  28,   5,  45, 189, 123, // B..+..L..-.{
+  95,  76, 109,  94,  51, 246, 176, 114,  34,  34, 222, 196, // _Lm^3..r""..
+  84, 103,  82, 196, 184,  42,  91,  53, 139,  50, 187,  28, // TgR..*[5.2..
+ 254,  96,  37, 250, 178,   6,   9, 198,  23,  34, 247, 185, // .`%......"..
+ 179, 131, 235, 140,  62, 163,  97,  94,  61,  20,  80,  57, // ....>.a^=.P9
+  19,  92, 242, 205, 120, 236, 245, 238, 119,  70, 131, 110, // ....x...wF.n
+ 205,  91, 217,  47, 178, 142, 239,  44, 170, 185, 121, 228, // .[./...,..y.
+ 152,  48,  43,  68,  14, 175,  56, 153,  70,  97, 129,  51, // .0+D..8.Fa.3
+  45, 102,  31, 181, 171, 183,  57, 208,  29,  56,  63, 140, // -f....9..8?.
+  59, 189,  56,  31, 133, 231, 247, 198,  52, 150, 124, 240, // ;.8.....4.|.
+  93,  68, 185, 241, 196, 244,  59, 149, 141,  27, 132, 178, // ]D....;.....
+  43,  38, 234, 195, 244, 238, 210,  14, 119,  31, 220, 184, // +&......w...
+  65, 219, 236,   5, 253, 223, 240, 112,  21, 192, 230, 149, // A......p....
+   9, 116, 158,  67, 183,  68, 177, 162, 236, 200, 100, 236, // .t.C.D....d.
+ 239, 218, 248,  58, 179, 101,  91, 198,  45, 248, 204, 214, // ...:.e[.-...
+ 213, 252, 226,  11, 103, 185,  25,  85,  23, 179,  45,  21, // ....g..U..-.
+ 110,  27, 110, 190, 144, 231, 101,  71,  34,  58, 101, 157, // n.n...eG":e.
+  59,  25,  35, 107, 163, 133, 122,  23,  49,  61,  49,  72, // ;.#k..z.1=1H
+  65,  76,  44, 107, 236, 227,  59,  65,  10, 138,   0, 120, // AL,k..;A...x
+  77, 121, 189, 108,  76, 120, 107,  78, 161, 199,  73, 214, // My.lLxkN..I.
+ 177, 197,  62,  48, 207, 201, 247, 101, 192, 107, 240,  87, // ..>0...e.k.W
+  77,   4, 204, 141,  27, 127, 248,  93, 154, 239, 151, 145, // M......]....
+ 143, 139,  50, 115,  67, 195,  66, 152, 188, 115,  52, 162, // ..2sC.B..s4.
+ 197,  13,   3,  15, 216, 195,  27, 114,  64, 156,   8,   1, // .......r@...
+  74, 137, 244,  33, 170, 100, 132,  54, 211, 192,  56, 121, // J..!.d.6..8y
+ 143,  93, 242,  42,  11,  90, 140, 239,  71,  35, 196, 178, // .].*.Z..G#..
+ 177, 159, 130,  54, 152, 161, 188,  28, 207, 233,  83,  64, // ...6......S@
+ 164,  55,  77, 178,   0,   9, 100,  14, 216, 127,   5, 143, // .7M...d.....
+ 101, 193, 199,  70, 148,  60, 135,  20, 166, 148,  91,  60, // e..F.<....[<
+ 170, 200, 104, 238,  89, 185,  10, 141, 211, 255,  84, 149, // ..h.Y.....T.
+ 171,  36, 129,  66, 192, 169,  79, 230,  96, 143, 190,   7, // .$.B..O.`...
+ 234, 173,  36, 208, 160, 222,   6, 234,  41, 191, 152,  83, // ..$.....)..S
+  35, 122, 138, 217, 213, 237, 112, 142, 145, 223, 217,  84, // #z....p....T
+  20, 208, 170,  26,  92,  64,  63,  71,  54, 149, 214, 242, // .....@?G6...
+ 136, 246,  11, 112,  61,  23, 160,  23, 202, 164, 191, 200, // ...p=.......
+ 232, 156,  58,  25, 157,  83, 100, 116,  78,   3, 196,  51, // ..:..SdtN..3
+ 138, 135, 101,  14, 222, 162, 152, 127,  56,  79, 211, 138, // ..e.....8O..
+   6,  50, 150,  57,   4,  43,   7, 184, 228,  90, 132,  29, // .2.9.+...Z..
+ 140,  36,  25,  17, 180,  76, 236, 164, 242, 188, 243,  95, // .$...L....._
+  69,  86, 190, 164,   0, 162, 159,  48, 155, 135,  96, 211, // EV.....0..`.
+ 195,  71,  52, 109,  16, 145, 188, 243, 151,  30,   4, 129, // .G4m........
+  18, 116, 248,  64, 137, 178,  71,  53, 188,  15,  31, 163, // .t.@..G5....
+  35,  66, 199,  58, 106, 211, 220,   6, 198, 186,   1, 224, // #B.:j.......
+ 156,  48, 230, 171,   6, 162, 167, 160, 221, 231, 201, 151, // .0..........
+ 124, 241,  63, 247, 211,  83, 253, 169,  40,   5, 196, 162, // |.?..S..(...
+ 206, 206,  31, 217,  88,  78, 115, 191,  59, 214, 223,  85, // ....XNs.;..U
+ 251,  78, 228,  28, 107, 238, 195, 173,  56, 175, 128, 184, // .N..k...8...
+  22, 199, 148, 113, 157,  18,  12, 106, 110, 133, 175, 117, // ...q...jn..u
+ 133,  18, 147, 198, 175, 134,  60, 218, 230,  87, 142, 123, // ......<..W.{
+  59,  55,  38,  81,  22,  85,  34,  40,  77,  69,  31,  74, // ;7&Q.U"(ME.J
+ 230,  70,  31,  74,  77, 244, 161,  34,  74,  57, 250,  80, // .F.JM.."J9.P
+ 130,  75, 102, 112,  31,  25, 115,  65,  54, 132,  26, 109, // .Kfp..sA6..m
+  23, 255,  33, 154, 103, 102, 235,  65,  25,  64, 103,  10, // ..!.gf.A.@g.
+ 127, 218,  24,  58,  28, 162,  96,  96, 150,  77,   2,  97, // ...:..``.M.a
+ 205,  29, 243, 222, 143,  78, 162, 130, 141,  55,  26, 224, // .....N...7..
+  95, 133,  56, 164, 120, 227,  95, 249, 122,  15, 161, 211, // _.8.x._.z...
+  71, 166,  14, 121,  19,  24,  96,  85, 186, 185, 221, 160, // G..y..`U....
+ 170, 137, 174,  28,  64, 150, 211,  30, 134, 253, 169,  78, // ....@......N
+  89, 168, 141,   1, 176, 244, 185, 136, 159, 228,  24, 161, // Y...........
+  92,  81, 206, 163, 204,  15, 115,  50, 141,  24, 205,  61, // .Q....s2...=
+ 149, 156,  35, 137, 200, 242,  25, 234, 118, 162,  88, 209, // ..#.....v.X.
+  35,  22, 247, 130,   4, 199,  44, 123, 230,  49, 232,  96, // #.....,{.1.`
+ 100, 115,   7, 209, 211, 221,  54, 136,  37, 124, 122, 121, // ds....6.%|zy
+ 223, 230, 205,  46, 182, 127,  40,  88, 224, 122, 195, 231, // ......(X.z..
+  94, 217, 104, 105, 115, 251, 117,  52,  61, 157, 211,  64, // ^.his.u4=..@
+ 114, 141,  22, 230,  18, 212,  78,  27, 135, 102,  19,  67, // r.....N..f.C
+  63,  73, 246, 191, 214,  81, 140, 229, 138, 177,  68, 228, // ?I...Q....D.
+  26, 243, 224, 244, 146, 186,  93, 197, 198, 255, 164, 202, // ......].....
+ 159, 249, 101, 221, 165, 246, 212, 127,  82, 229, 115,   8, // ..e.....R.s.
+  37, 151,  24, 130, 244, 217,  30, 104, 210, 139, 142,   9, // %......h....
+ 132, 242,  31, 110, 159, 210, 242, 193,   1, 209, 251, 123, // ...n.......{
+  89, 186, 199, 135, 243,  94,  39, 237, 237, 233,  83,  93, // Y....^'...S]
+  98, 221, 162, 143,  47, 253, 174, 242, 248,  51, 162, 240, // b.../....3..
+ 204, 209,  41, 226, 228, 203, 107, 144, 143,  69, 184, 166, // ..)...k..E..
+  79, 127,  29, 104,  70,  87,   2, 193, 240,  15,  84,  97, // O..hFW....Ta
+ 232,  13, 169,   4, 179, 225, 115, 164,  62,  51,  23,  68, // ......s.>3.D
+ 146, 232, 184, 124,  78,  10, 199, 224,  51, 239,  65, 101, // ...|N...3.Ae
+ 186, 206, 174, 156,  46,  62, 130, 186,  10, 190,  80, 135, // .....>....P.
+ 180, 243,  86, 229, 193, 108, 105, 252, 208,  80, 208,  34, // ..V..li..P."
+ 160, 125, 212,   6, 249,  97, 251, 246, 138, 166, 184, 108, // .}...a.....l
+ 235,  55, 221,  86, 151,  24,  34, 125, 141, 162, 111,  68, // .7.V.."}..oD
+  82,  71,  49, 161, 188,  25, 203,  42,  55,  99,  57,  87, // RG1....*7c9W
+ 232,  92, 207, 196, 177, 123, 183,  12, 125, 134, 242, 122, // .....{..}..z
+ 198, 212, 235, 222, 108,  23,  74,  34,  96,  58, 215, 212, // ....l.J"`:..
+  34,  97, 137, 139, 232, 220, 211, 113,  26, 136, 180, 111, // "a.....q...o
+ 174,  54,  86,  55,  60, 197, 186,  24,  94, 120, 174, 127, // .6V7<...^x..
+ 193,  29,  75, 218, 200, 188, 140,   7, 230,  73, 160,  54, // ..K......I.6
+ 236, 119, 136, 164, 157,  16, 137, 242, 103,  81, 224, 203, // .w......gQ..
+  56,   5, 226, 210, 233,  84,  62,  79, 168, 122, 100, 134, // 8....T>O.zd.
+ 107, 107, 251, 176, 103, 203,  87,  15,   7, 199, 241, 209, // kk..g.W.....
+ 159, 132, 219, 143, 194, 230, 221, 187,  27,  30, 125, 125, // ..........}}
+  18, 239, 143, 178, 238, 183, 184,  82,   5, 218, 161, 188, // .......R....
+  94,  58,  66,  42, 102, 157, 170,  50, 225,   1,  77, 213, // ^:B*f..2..M.
+ 227,  30, 226,  68, 220,  93, 229, 127, 225,  38,   6, 209, // ...D.]...&..
+ 237,  12,  97, 142,  89, 246, 109, 148, 202, 168, 166, 250, // ..a.Y.m.....
+  38,  53,  54, 170,  53, 225,  76,  92,  61, 200,  50, 184, // &56.5.L.=.2.
+ 180, 227,  30, 174, 111, 112, 112,  73,   9, 238, 225, 133, // ....oppI....
+  27, 183,  27,  13,  12,  55, 235, 237, 143,  71, 115,  42, // .....7...Gs*
+ 133, 201, 129,  23, 110,  54, 214,  49, 170,  65, 127, 128, // ....n6.1.A..
+  34, 157, 161, 205,  30,  17, 220, 154, 231, 206, 112, 143, // ".........p.
+ 149, 201, 161,   0, 120, 111, 248,  50, 198, 160,  40,  13, // ....xo.2..(.
+ 172,  21, 212,  48, 184, 112,  89, 130, 242, 137, 225, 250, // ...0.pY.....
+ 166, 147, 117, 161,  23, 103, 175,  75, 205, 113, 111, 127, // ..u..g.K.qo.
+  60,  72, 122, 104, 144, 122, 135, 143, 210, 248, 132, 138, // <Hzh.z......
+ 179,  43,   2, 122, 163, 191, 227,  65, 154, 213, 227, 209, // .+.z...A....
+ 112,  99,  29,  99, 226,  50, 247,  36, 149, 222, 115, 226, // pc.c.2.$..s.
+  13,  60,  24,  38, 228,  68, 144,  20,  52, 214,   9, 186, // .<.&.D..4...
+ 195,   3, 128,  34, 113, 236,  46,   2,  83,  10,  30, 116, // ..."q...S..t
+ 172, 104,  31, 156, 149,  35, 178, 124,  47, 127,  53, 140, // .h...#.|/.5.
+ 227, 158, 243,  21, 152,  25, 229, 241, 137, 224, 133,  60, // ...........<
+ 137, 157, 211, 193, 209, 248, 104, 251, 178, 114,  77, 158, // ......h..rM.
+ 238, 124, 120, 116, 141, 138, 222, 188, 126, 177, 168,  20, // .|xt....~...
+  33,  82,  20,  60, 136,  59, 185,  83,  68, 147, 200, 182, // !R.<.;.SD...
+ 148, 247,  26, 211, 139,  48,  47, 225,   6, 149, 238, 143, // .....0/.....
+ 227, 228, 178, 102,  97, 195, 145,  64, 213, 116,  97,  33, // ...fa..@.ta!
+  83,  27,  74, 119, 137, 206, 239, 164, 197,  94,  17,  31, // S.Jw.....^..
+  13, 175,  49, 152,   7,  82, 252, 237,  37, 165, 155, 155, // ..1..R..%...
+  92, 126, 144,  94, 183,  60, 138, 211, 217, 210, 203, 136, // .~.^.<......
+ 168, 186, 170,  27, 135,  52, 176, 189, 253, 184, 227,  78, // .....4.....N
+  60,   4, 210, 101,  41, 187, 245,  59, 131, 116, 143, 231, // <..e)..;.t..
+  97, 116, 101,  89,  40, 202, 238,  13, 210, 222, 128,   8, // ateY(.......
+ 217,  44, 191, 178,  56,  59, 191, 253, 129, 242, 253, 236, // .,..8;......
+  96, 175, 159, 103, 105, 113, 173, 146, 121,  21,  26, 230, // `..giq..y...
+  23, 228, 201, 202, 134, 113, 122, 117, 201,  81, 247, 202, // .....qzu.Q..
+  50, 157, 253, 171, 231, 136, 232, 168, 222, 126, 222, 249, // 2........~..
+  22,  95,  89, 114, 112, 144, 178,   9, 250, 194, 130,  26, // ._Yrp.......
+ 133, 218,   9,  28, 237, 177, 209, 232, 213,  67, 201,   9, // .........C..
+ 129, 238,   9,  26,  89, 188,  91,  30, 100,  71, 125, 160, // ....Y.[.dG}.
+  59,   3, 229,   4,  95, 192, 122, 165, 232, 149, 119, 128, // ;..._.z...w.
+  46, 109, 241,  65,  99, 122, 227, 211,  22, 215,  59, 188, // .m.Acz....;.
+  81, 221, 202, 216, 180, 102, 207, 242, 214, 148,  13, 217, // Q....f......
+ 168, 236, 188, 198, 244, 206, 106, 204, 223,  66, 180,  89, // ......j..B.Y
+ 230, 239, 149, 102,  99, 122,  83,  52,  42, 208, 175, 113, // ...fczS4*..q
+  91,   5, 202, 117, 218,  52,  52, 235, 228,  25, 168, 213, // [..u.44.....
+ 233,  14, 116,  58,  41,   2, 133,  58, 193, 129,  54, 147, // ..t:)..:..6.
+   2, 168,  50, 248, 117, 191, 108, 219, 129,  18, 157,  82, // ..2.u.l....R
+  66, 131, 156, 208, 179, 171, 110, 170, 116,  86, 215,  46, // B.....n.tV..
+  34, 150, 142, 120, 134,  24, 107, 188,  39, 212, 174,  16, // "..x..k.'...
+ 102,  21, 220, 108,  67,  37, 151, 250, 181,  60,  95, 213, // f..lC%...<_.
+  69, 159,  88, 242,  96, 222, 145, 177, 240, 179, 233,   3, // E.X.`.......
+ 196,  90,  69,  93,   2, 131,  37, 240,  81, 163, 214,  62, // .ZE]..%.Q..>
+ 235, 122,  31,  76, 230,  28,  97,  22,  90, 203, 198, 241, // .z.L..a.Z...
+  73,  89, 179, 199,  51, 197, 247,  18,  78,  51, 242,  62, // IY..3...N3.>
+  61,   0,  99, 180, 114, 173, 254,  48,  50,  23, 123, 149, // =.c.r..02.{.
+ 203, 247, 243, 196, 233, 101, 217,   2,  42,  50,  95,  75, // .....e..*2_K
+ 177, 137, 144, 107, 231,  94, 121,  47, 109, 135, 185,  15, // ...k.^y/m...
+ 197,  99,  38,  32, 106, 247, 249,  81, 248,  28,  74, 169, // .c& j..Q..J.
+ 134, 240, 250,  12, 210, 240, 179,  19, 196, 235, 179,  68, // ...........D
+ 241, 250, 236, 181, 183,  62, 167, 149,  56,  94, 159, 221, // .....>..8^..
+  64,  94, 159,  77,  36, 175, 207, 151, 132, 242, 250, 236, // @^.M$.......
+ 109,  33,  78, 177,   9, 230,  69,  21, 124,  70, 192,  43, // m!N...E.|F.+
+ 249, 149, 128,  94, 159,  17, 251, 232, 179,  13, 233, 245, // ...^........
+ 217, 147, 186, 115, 148,  94, 231, 167,  51, 243,  36,  58, // ...s.^..3.$:
+ 109, 159,  47, 141, 236, 245, 217,  91, 147,  38, 157, 216, // m./....[.&..
+  94, 159, 255, 171, 131, 123,  97, 110, 168, 213, 205, 198, // ^....{an....
+ 223, 245, 112, 249, 105,  42, 194,  23,  77,  46, 135, 248, // ..p.i*..M...
+ 242,  74, 117,  83,  90, 201,  46,  83, 125,  83,  38,  58, // .JuSZ..S}S&:
+ 158,  40, 123, 121, 225,  14,  21,  16, 121, 165,  87, 177, // .({y....y.W.
+  84, 153, 247, 217, 231, 116, 177, 165, 206, 117,  43, 172, // T....t...u+.
+ 150, 212, 119, 223, 132,  81,  58, 249, 131, 132,  42, 143, // ..w..Q:...*.
+ 243, 127, 253, 179, 108, 124, 202, 126,  83, 236, 106,  46, // ....l|.~S.j.
+ 173, 126, 214, 182, 230, 115,  58, 223,  68, 168, 236, 134, // .~...s:.D...
+  54, 102, 242,  14, 161,  75,  75, 248, 155, 210, 214, 105, // 6f...KK....i
+  87,  90,  59,  17, 198,  50,  44, 114, 163, 233,   4,  81, // WZ;..2,r...Q
+ 102, 219,  71, 224, 119, 232, 135, 243,  88, 196, 130, 147, // f.G.w...X...
+ 134,  34, 227,  48, 209, 230, 193, 126, 140, 190,  21, 217, // .".0...~....
+  16,  77,  90, 164,  37, 189, 157,   9, 195, 246,  57, 117, // .MZ.%.....9u
+  45,  94,  63, 167,  51, 129, 216,  62, 167,  85,  83, 163, // -^?.3..>.US.
+ 207, 233,   2, 211,  89, 157,  81,  46, 221,  76,  48, 182, // ....Y.Q..L0.
+  31,   2, 129, 121,  13,  84, 187,  58, 107, 157, 251, 111, // ...y.T.:k..o
+ 194, 216, 116,  69, 213, 134,  22,  85, 203, 158,  28,  46, // ..tE...U....
+ 173, 146, 118, 218,  96, 228, 152,  32,  95, 191, 131, 151, // ..v.`.. _...
+ 180, 207, 249, 243, 156, 208, 125,  78,  23,  57, 207, 161, // ......}N.9..
+ 238, 184, 102, 200, 119,  26,  13,  84, 106, 119,   2,  19, // ..f.w..Tjw..
+  56, 159,  83,  13, 235, 230,   4,  16, 249, 159,  98,  21, // 8.S.......b.
+ 146,  80, 120, 171,  85, 161, 141,   4,  82,  33,  40,  51, // .Px.U...R!(3
+ 103,  56,  36, 255,  48,   6, 148,  82,  46, 221,  52, 241, // g8$.0..R..4.
+ 180, 248, 159, 184, 119,  79, 238,  14,  66, 175,  49, 179, // ....wO..B.1.
+ 173, 254, 199, 204,  37,  81, 132, 159, 211, 107, 205,  37, // ....%Q...k.%
+  72, 201, 107, 206,  36,  85, 234, 206,  35, 194, 236, 253, // H.k.$U..#...
+ 207, 159,  73, 163, 165,  94,  99, 202, 186,  50, 159,  86, // ..I..^c..2.V
+  10,  92, 157,  81,  46,  72, 228, 133, 200, 122,  65, 140, // ...Q.H...zA.
+ 171,  55, 234, 165, 122, 168, 182,  85,  83, 173, 171,  13, // .7..z..US...
+ 117,  75, 109, 170, 219, 234, 142, 186, 171, 126,  86, 205, // uKm......~V.
+ 198, 204, 236, 107, 103,   8, 255,  15, 115,  92, 123, 141, // ...kg...s.{.
+  30,  19, 167,  83, 251, 115,  76,  84, 197, 160,  56, 187, // ...S.sLT..8.
+   6, 204,  51, 103, 180,   8, 232,   5, 174, 255, 111,  66, // ..3g......oB
+  22, 247,  13, 127,  88, 198, 207, 185, 198,  36, 150,  92, // ....X....$..
+ 229, 127, 235, 153,  44, 205, 159,  27,  63, 111,  24,  90, // ....,...?o.Z
+ 228,  63, 117, 122,  53, 255,  92,   3, 187,  28, 231, 157, // .?uz5.......
+  98, 156, 199, 215, 152, 222,  10, 155, 126,  77,   4, 237, // b.......~M..
+ 112, 234,  21,  68, 109, 167, 222, 150, 159, 225, 236,  39, // p..Dm......'
+ 255, 151,  45, 202,  43, 145,  97, 252, 224, 162,  84,  36, // ..-.+.a...T$
+  31, 139,  22, 229, 214,  92, 168, 175, 111,  52, 188, 107, // ........o4.k
+  99, 246, 255,  86, 168, 124, 202, 193, 205, 231, 116, 254, // c..V.|....t.
+ 234, 149, 177, 159, 154, 141,  91, 205,  91, 205, 245, 141, // ......[.[...
+ 205, 141, 205, 230, 230, 237, 255,  13, 139, 251, 232, 148, // ............
+ 216, 144,   1, 173, 174, 150,  64,  93,  61, 235,  51, 236, // ......@]=.3.
+  93,  53,  70, 197, 143, 145, 252, 182,  31,  79, 169, 249, // ]5F......O..
+  26, 203, 197,  28, 192, 210, 106,  35,  85, 192,  42,  37, // ......j#U.*%
+ 104, 115, 168, 129, 255,  35, 125, 127, 209, 129, 173, 132, // hs...#}.....
+ 158, 191,  43, 122, 239,  74, 251, 254,  42, 253, 127,  78, // ..+z.J..*..N
+ 140, 112, 173, 148,  42,  94,  53, 132,  41, 225, 228,  95, // .p..*^5.).._
+ 101,  20, 111, 248,  88, 190, 254,  48, 166, 133, 169, 127, // e.o.X..0....
+ 149, 113,  60, 134,  32, 183, 214, 207,  14, 174,  11,  82, // .q<. ......R
+ 165, 244, 247,  47, 179,  20, 112,  46, 249, 131,  35, 200, // .../..p...#.
+ 133,  21, 184, 138, 190, 255,  31,  67,  73,  62, 179,  66, // .......CI>.B
+ 244, 255,  99,  56, 247,  33,  78, 117, 190,  19, 184, 106, // ..c8.!Nu...j
+ 129, 202, 219, 131, 191,  10, 136,  61, 220, 126, 112, 117, // .......=.~pu
+ 175,  71, 221, 191,  76, 127, 239, 221, 223, 190, 178, 191, // .G..L.......
+ 184, 133, 249, 171, 244, 247, 169, 189,   5, 186, 242,  60, // ...........<
+ 182,  37, 255, 218, 187, 247, 191, 128,  80, 134, 219, 200, // .%......P...
+ 255, 115, 219, 249, 153, 185, 166, 187, 106, 197, 236, 125, // .s......j..}
+ 222,  95,   5, 216, 118, 222, 127, 216, 173, 149,   8,  81, // ._..v......Q
+  28,  16,  95,  61, 140, 233, 107, 200, 191, 204, 112, 238, // .._=..k...p.
+ 191, 248,  80, 123, 188,  91, 123, 136, 235, 208,  26,  95, // ..P{.[{...._
+ 135,  94,  45,  10, 115, 238,  78,  93, 129,  24, 226,  79, // .^-.s.N]...O
+ 177,  67,   2, 125, 157, 170, 182, 135, 246, 239, 138,  34, // .C.}......."
+  44,  88, 203, 250, 125, 245, 168, 155, 193, 211, 215, 252, // ,X..}.......
+  29, 248,  63, 144, 143, 250, 223, 191, 151, 239, 117, 101, // ..?.......ue
+   5, 174, 158, 189, 121,  55,  71, 139,  47, 193, 126,  12, // ....y7G./.~.
+ 164, 166,  47, 199, 205, 245, 209, 182, 190,  79, 175, 233, // ../......O..
+ 104, 224, 205, 242,  34, 201,   1, 171, 249, 119, 238, 184, // h..."....w..
+ 142, 130,  17,   6, 179, 220, 255,  61, 134, 183, 254, 239, // .......=....
+  13, 111, 253, 191, 201, 240,  54, 254, 189, 225, 109, 120, // .o....6...mx
+ 255, 183,  29, 176, 207, 216, 102, 131, 135, 108, 211,  94, // ......f..l.^
+ 102,   5, 135,  83,  54, 170, 172, 163,  90,  39, 143, 107, // f..S6...Z'.k
+ 157, 227, 206,  32,  97, 135, 255,  52, 191, 200, 238, 202, // ... a..4....
+ 133, 235, 104, 201, 113,  46,  91,  94, 199, 114, 197, 118, // ..h.q.[^.r.v
+  17,   6, 242, 246, 151, 189, 126, 157, 179, 200, 255, 109, // ......~....m
+ 152,  30, 235,  82, 123, 122,  29, 203, 203, 125,  56, 117, // ...R{z...}8u
+ 203,  27, 141, 100, 176, 250,  57, 253, 101,  63, 175,  65, // ...d..9.e?.A
+ 179, 194, 252,  62,  25,  20, 135, 227, 253, 176, 246,  75, // ...>.......K
+ 103, 203, 184, 119,  59, 224,  36, 232, 212, 174, 241,  87, // g..w;.$....W
+ 107, 101,  77, 112, 225,  54,  91, 199, 135, 120, 191, 246, // keMp.6[..x..
+ 238,  89,  13,  74, 173,  69, 109,  60, 194,  70,  52, 126, // .Y.J.Em<.F4~
+ 223,  42,  21,  59, 126, 227, 164,  34,  13,  58, 174,  14, // .*.;~..".:..
+ 146, 134,  31, 109, 146, 104,   0,  72, 156, 167,  94, 125, // ...m.h.H..^}
+ 147,  95, 117,  93,  61,   3,  72, 215,  13,  25,  85, 117, // ._u]=.H...Uu
+ 148, 250,  31, 187, 195, 191, 134, 191, 213, 235, 214, 247, // ............
+ 215, 140,   3, 112, 221, 222, 255, 104,  52, 128,  57, 136, // ...p...h4.9.
+  95, 123, 148, 213, 191, 255,  79,   3, 234, 175, 167,   1, // _{....O.....
+  53,  87,  42, 255, 195,  81,  26, 174, 141,  95, 175, 138, // 5W*..Q..._..
+ 212, 240,  35,  59, 245, 191,  36,  94, 195,  92, 246, 166, // ..#;..$^....
+ 140, 217, 224, 170,  96,  93,  25, 181, 193, 145,  45, 252, // ....`]....-.
+ 183, 137, 219, 112, 249, 124, 255, 123, 145,  27,  46,  93, // ...p.|.{...]
+ 217, 191,  74, 244, 134, 235,  66, 226, 127,  81,  12, 135, // ..J...B..Q..
+ 185, 112, 104, 227,  56,  44, 208,   4, 252, 145,  72,  14, // .ph.8,....H.
+ 101, 173, 101,  44,   7, 103, 224,  54, 240,  66, 105, 213, // e.e,.g.6.Bi.
+ 192, 161,  23, 244, 175, 241, 187, 173, 105, 247, 217, 152, // ........i...
+  14, 101, 245, 101,  84, 135,  31, 169, 190, 140, 237,  80, // .e.eT......P
+ 105, 194, 141, 238,  80,  25, 193, 117, 226,  59, 232,  89, // i...P..u.;.Y
+ 187,  50, 194,  67, 169, 137, 236, 196, 120,  40, 121,  25, // .2.C....x(y.
+  19, 229, 193, 208,  62,  54, 206, 131, 219, 211, 185, 240, // ....>6......
+  50,  29, 235, 193,   3, 146, 215,  42, 148, 214,  28, 107, // 2......*...k
+  50, 105, 197, 197, 234,  24, 238, 151, 248, 215, 241, 133, // 2i..........
+   5,  71,  59, 218,  39, 121, 156, 136,  97, 220,  72,  59, // .G;.'y..a.H;
+ 248, 139, 225, 149,  32, 173, 166,  81,  97, 126, 207, 227, // .... ..Qa~..
+ 148, 144,  65, 224,  27,  75,  58, 107, 124, 187, 192, 249, // ..A..K:k|...
+  43, 123, 251, 101,  63, 170, 111,  59, 251,  97, 170, 112, // +{.e?.o;.a.p
+  40, 195,  73, 128, 246,  52,  53, 227, 113, 208,  58, 236, // (.I..45.q.:.
+ 131,  55, 129, 213, 110,  50, 128, 127,  85, 108, 130, 139, // .7..n2..Ul..
+ 139, 133,  89,  91, 183, 111, 193, 105, 208,   2,  47, 210, // ..Y[.o.i../.
+ 106,  20,  13, 224,  89,  97, 218, 111, 172,  26, 207, 182, // j...Ya.o....
+ 222, 128, 243, 179, 233,  84,  54, 208, 155, 227,   7,  17, // .....T6.....
+ 222,  17, 135, 115,  83, 123, 179, 169, 110, 251, 218,  37, // ...sS{..n..%
+  78, 160,  14, 109, 185,  55, 113,  31,  94, 224,  15, 166, // N..m.7q.^...
+  19,  78,  70, 207,   7, 199, 113,  53,  21,  45,  28,  77, // .NF...q5.-.M
+ 123,  12,  41, 140,  11,  68, 227, 144,  88, 193, 139,  20, // {.)..D..X...
+ 205,  66, 145,  17, 140,  90, 111,  84,  98,  66, 168, 188, // .B...ZoTbB..
+ 147,  17, 156, 135, 172, 173, 121,  43, 197, 234,  97,  54, // ......y+..a6
+  42, 232,   7, 246, 138, 216, 113,  43, 142, 217, 159,  74, // *.....q+...J
+ 217, 105,  67,  75, 215,  61, 130, 247,  63,  49, 185, 243, // .iCK.=..?1..
+ 157, 246, 225,  10, 228, 226,  98, 169, 167, 205, 138, 197, // ......b.....
+ 204, 177, 165, 205, 223, 227, 147,  26, 177,  12, 219,  92, // ............
+ 159, 159,   4, 173,  98,  53,  75, 113,  23, 226,  14,  96, // ....b5Kq...`
+ 121, 117,  56, 222,  79,   6, 163,  67, 223, 232, 202, 179, // yu8.O..C....
+  61, 190,  30, 189, 241,  77, 200, 190,  21,  11, 246, 220, // =....M......
+  64, 124, 197, 162, 239, 251, 125,  91,   1, 155,  87,  78, // @|....}[..WN
+ 215, 209, 148,  58, 142, 232,  56,  36, 208,  44, 107,  41, // ...:..8$.,k)
+ 130, 115, 120, 205, 128, 103, 255, 196, 245, 154,  81, 172, // .sx..g....Q.
+ 194,  70,  66, 156,   2, 165, 145, 117, 108, 110,  92, 205, // .FB....uln..
+ 101,  84,  99, 213,  35,  26,  32, 102,  39, 222, 157, 246, // eTc.#. f'...
+  17,  85,  73, 179, 110, 162, 184, 168, 246,  53, 146,  26, // .UI.n....5..
+ 143, 105, 214, 157,  13, 140,  84, 203,   2, 112, 119,   8, // .i....T..pw.
+  63,   2, 147,  16, 127, 209,  50, 109,  74,  56, 142, 139, // ?.....2mJ8..
+  29, 103,  37, 250,  89,  81, 255,  96, 115, 170, 156, 169, // .g%.YQ.`s...
+ 161,  53,  87, 137, 227, 217,  99, 174, 111, 244, 147,  81, // .5W...c.o..Q
+ 141, 131, 203, 133, 158, 146, 145, 195, 245, 214, 100, 162, // ..........d.
+ 224, 200,  95,  93,  14,   6, 233, 141,  27,  41, 229, 165, // .._].....)..
+  61, 223, 243, 130, 137, 218, 160,  47,  38, 106,  47, 186, // =....../&j/.
+  52, 154,   0,  28,  83, 245,  74, 247, 150, 198,  21, 126, // 4...S.J....~
+ 131, 122, 126, 204, 190,  86, 224, 196, 137, 214, 235,  91, // .z~..V.....[
+ 224,  22,  27, 219,  71, 237,  44, 100,  82, 104,  15,  59, // ....G.,dRh.;
+  82, 107, 225, 214, 218,  80,  39, 190, 227,  14,  95,  27, // Rk...P'..._.
+ 137,  24,  84,  97, 207, 171, 130, 159, 131, 171,  10,  11, // ..Ta........
+  87,  10,  87, 174, 120, 176, 113,  15, 220, 185, 159, 168, // W.W.x.q.....
+ 119,  52, 189, 106, 199,  99, 171, 106, 120, 225, 164,  13, // w4.j.c.jx...
+ 167, 157,  21,  64,  97, 167, 155, 103,  73, 194,   6,   4, // ...@a..gI...
+ 227, 238,  33,  83, 152, 222, 110, 197,  95, 157,  69, 116, // ..!S..n._.Et
+ 196, 235,  61, 130, 255, 130, 231,   3, 226, 199,  83, 248, // ..=.......S.
+ 172,  84, 226, 218, 131, 170, 167, 197, 159,  88,  31,  67, // .T.......X.C
+  72,  69, 156, 128, 210, 175,  18,  82, 202, 105,  10,  38, // HE.....R.i.&
+  45, 131,  66,  30, 245, 251,  68,  62,   4, 238, 194, 141, // -.B...D>....
+ 110, 220,  88, 100, 247, 126,  28, 168, 209, 197,   5, 170, // n.Xd.~......
+  46,  27, 114, 170, 213, 187, 226, 133,  31, 180,  82, 248, // ..r.......R.
+ 193, 232, 155, 154, 228, 109, 161,   7, 164,   2,  41, 218, // .....m....).
+ 117,  42, 237, 212,  85,  56,  95,  49, 107, 111, 125, 233, // u*..U8_1ko}.
+  80, 114,  64, 104, 189, 196, 221,  22,  47, 181,  87, 197, // Pr@h..../.W.
+ 188, 247, 198, 141,  35, 191,  82,   2, 152, 223, 218,  24, // ....#.R.....
+ 192, 165, 202, 172, 143,  67, 149,   7, 218, 107, 228, 252, // .....C...k..
+ 227,  98, 238,  81, 209, 113,  10, 151,  13, 208, 201, 210, // .b.Q.q......
+ 104,  45, 198, 137, 212, 175, 165, 121,  17,  27,  92, 135, // h-.....y....
+ 140,  22, 164,   8, 127, 102, 179, 248, 147, 218, 141, 182, // .....f......
+ 190, 176, 139,  42,  66,  71, 189, 109,   0, 139, 191, 174, // ...*BG.m....
+ 188, 134,  23,  24,  23,  69,  23,  23, 126,  81, 130, 186, // .....E..~Q..
+ 179, 142, 165, 173,  69, 185,  12, 183,  26,  27,  17, 187, // ....E.......
+ 162,  65,   4, 162, 118, 238,   7, 225, 236, 194, 104, 111, // .A..v.....ho
+  67,  64, 220,  15,  59,  69, 108, 195,  83, 116, 252,  12, // C@..;El.St..
+  78, 102, 159,  18, 235,   0, 111, 178, 236, 122,  74, 167, // Nf....o..zJ.
+ 189,  24, 164,  24, 206,  84, 234, 118,  76,  48, 208,  67, // .....T.vL0.C
+  42, 173, 176, 227, 193, 118, 161,  31,  57, 193, 253,  52, // *....v..9..4
+ 160,  75, 246, 160,  62,  31, 216, 251, 238, 188, 189,  23, // .K..>.......
+ 192,  53, 160, 200,   8, 150,  34, 120, 127,  99,  95, 160, // .5...."x.c_.
+ 146,  48, 117,  22,   8,  92, 207, 175, 101,  98,  98,  72, // .0u.....ebbH
+  96,  66, 210, 107, 161,  18, 219, 179, 230, 165,  72, 196, // `B.k......H.
+ 154, 134,  25, 100,  55, 191,   7,  19, 199,  69,  90,   9, // ...d7....EZ.
+  85, 118, 165, 155,  19, 248, 243,  37, 164, 124, 179,  19, // Uv.....%.|..
+ 192,  43, 226,  80, 117,  85,  95, 245, 212,  94,  48, 229, // .+.PuU_..^0.
+ 160, 214,  57, 175, 140,  19,  59, 167, 107,  59, 197,  46, // ..9...;.k;..
+ 252,  72,  45, 249, 218, 116, 141, 143,  47, 154,  52,  27, // .H-..t../.4.
+   5, 196, 248, 109,  16,  67,  58,  39, 193, 198,   4,  17, // ...m.C:'....
+  79,  14, 193, 121, 245,  12,  52,  35, 154, 208,  40,  29, // O..y..4#..(.
+ 120, 167,  19,  51,  72, 202,  40,  42, 110, 158,  61, 230, // x..3H.(*n.=.
+  90,  83, 117,  59, 168,  97,  71,  63,  32, 244,  74, 193, // ZSu;.aG? .J.
+ 177, 229, 137,  32, 138,  14, 105, 201, 181,  49,  22,  94, // ... ..i..1.^
+  15, 128, 156, 177, 107, 163,  99, 121, 162, 227,  38, 218, // ....k.cy..&.
+  83, 166, 146,  95,  26,  23,  23, 250, 113,  43, 242,  99, // S.._....q+.c
+ 215, 231,  15,  27,  26,  25, 127, 188, 136,  79,  18,  56, // .........O.8
+ 109, 195, 133, 213, 142, 246, 171, 122,  22, 189, 245, 223, // m......z....
+ 168, 109, 255, 161, 194, 234,   5, 152, 194, 113, 101, 243, // .m.......qe.
+ 122,  30, 151,  59, 141, 190, 112, 157, 171, 203, 231,  38, // z..;..p....&
+ 176, 203,  23, 181,  15,  56, 250, 134,  63, 207, 171,  40, // .....8..?..(
+  72,  90, 215,  78, 249,   8, 238, 124, 125, 200, 136, 167, // HZ.N...|}...
+  68, 255, 154, 193,  95, 130, 128, 157, 206, 174, 218, 185, // D..._.......
+ 114,  61,  87,  14, 218,  35, 248,  35, 215,  78, 242,  52, // r=W..#.#.N.4
+ 119,  17,  69,  25,   6, 186, 143, 221, 249,  13, 127,  78, // w.E........N
+  35, 195, 119,  60, 168, 244,  80,  59, 114, 124, 106, 188, // #.w<..P;r|j.
+ 155, 107,  95, 249,  44, 173, 218,  90,  62,  63, 155, 136, // .k_.,..Z>?..
+ 159, 122,  39, 208, 193, 201, 224, 123,  39, 239, 213, 133, // .z'....{'...
+  45, 177, 238, 244,   9, 161, 237,  35, 152, 132, 103,  35, // -......#..g#
+ 104,  51,  25,  31,  54, 136, 159, 129,   7, 104, 207, 145, // h3..6....h..
+ 229,  54,  27, 141, 227, 195,  22, 120, 159,  74, 218, 223, // .6.....x.J..
+ 169, 232, 151, 201, 116,  36, 144,  94, 103, 116, 200, 126, // ....t$.^gt.~
+  21,  76, 140,  88, 111, 202,  69, 191, 196,  80,  40, 253, // .L.Xo.E..P(.
+  91, 138, 239,  13,  19,  46,   4,  62, 194, 102,  99, 132, // [......>.fc.
+  44, 159,  63,  41, 163,  23, 148, 113,  35, 170,  81,  13, // ,.?)...q#.Q.
+ 230, 198,  68,  88,  20,  87, 130,  74, 117, 231, 151, 146, // ..DX.W.Ju...
+  16,  19, 148, 223,  47, 243, 109,  92, 133, 162,  76, 155, // ..../.m...L.
+   9,  60,  65, 217,   7,  38,  91,  71,  88, 248,  50, 153, // .<A..&[GX.2.
+ 137,  59,  49,  21, 103, 221, 198, 120, 160, 245, 152,  55, // .;1.g..x...7
+ 244, 249,  97,  86,  76, 248,  93,  26, 191, 113, 204,  93, // ..aVL.]..q.]
+ 137,  66, 143, 117, 157, 142,  26,  95,   9,  94, 194, 115, // .B.u..._.^.s
+ 250, 106,  82, 211, 220,  33,   7,  65, 168,  49, 244, 211, // .jR..!.A.1..
+ 227, 243,  73, 101,  46, 221, 160,  38,  58,  48, 137,  51, // ..Ie...&:0.3
+ 182, 106,   7,  81, 197, 188, 222,  85, 163,  11, 179, 169, // .j.Q...U....
+  48, 101,  47,  17,   8, 242,  23, 232, 159,   4,  46, 158, // 0e/.........
+  19, 101,  37, 174, 132, 184, 208, 108,  53, 245, 140,  88, // .e%....l5..X
+  17,  39, 125,  40, 195, 120,  80,  77, 227, 248,  14, 167, // .'}(.xPM....
+  63,  18,  57, 163, 152, 141, 156, 113,  56,  55, 114, 198, // ?.9....q87r.
+  90,  25,  55, 195, 132, 116, 209, 225,  33,  74,  54,  60, // Z.7..t..!J6<
+ 177, 236, 119, 108,  67, 150, 156, 211, 185, 162,  42, 124, // ..wlC.....*|
+ 116, 208, 250, 255,   1,  15,  61, 155, 188,  37,  31,   2, // t.....=..%..
+   0, 0 // .
 };
 
 static const struct packed_file {
@@ -4209,7 +4228,9 @@ static const struct packed_file {
   size_t size;
   time_t mtime;
 } packed_files[] = {
-  {"/web_root/index.html.gz", v1, sizeof(v1), 1766159076},
+  {"/web_root/index.html.gz", v1, sizeof(v1), 158725144},
+  {"/web_root/app.73066db4.css.gz", v2, sizeof(v2), 120612571},
+  {"/web_root/app.fe104c38.js.gz", v3, sizeof(v3), 266405059},
   {NULL, NULL, 0, 0}
 };
 
@@ -5,7 +5,7 @@
 // Default mock implementation of the API callbacks
 
 #include "mongoose_glue.h"
-static struct state s_state = {0, 100, 0, 5000, "P", 0, 0, 0, 150, 10, 0, false, false, false, false, false, false, false, false, false, false, true, false, "Comfort"};
+static struct state s_state = {0, 100, 0, 5000, "P", 0, 0, 0, 150, 10, 0, false, false, false, false, false, false, false, false, false, false, true, false, "Comfort", 0, 0, false};
 void glue_get_state(struct state *data) {
   *data = s_state;  // Sync with your device
 }
@@ -30,3 +30,17 @@ void glue_set_login(struct login *data) {
   s_login = *data; // Sync with your device
 }
 
+void glue_reply_bus(struct mg_connection *c, struct mg_http_message *hm) {
+  (void) hm;
+  mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{}\n");  // Sync with your device
+}
+
+void glue_reply_timing(struct mg_connection *c, struct mg_http_message *hm) {
+  (void) hm;
+  mg_http_reply(c, 404, "", "Build with CAN_FRAME_TIMING=1\n");  // Sync with your device
+}
+
+void glue_reply_telemetry(struct mg_connection *c, struct mg_http_message *hm) {
+  (void) hm;
+  mg_http_reply(c, 200, "Content-Type: application/json\r\n", "{}\n");  // Sync with your device
+}
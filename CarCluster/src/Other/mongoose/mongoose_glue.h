@@ -16,7 +16,7 @@ extern "C" {
 #define WIZARD_ENABLE_HTTP_UI 1
 #define WIZARD_ENABLE_HTTP_UI_LOGIN 0
 
-#define WIZARD_ENABLE_WEBSOCKET 0
+#define WIZARD_ENABLE_WEBSOCKET 1
 
 #define WIZARD_ENABLE_MQTT 0
 #define WIZARD_MQTT_URL ""
@@ -53,6 +53,9 @@ extern struct mg_mgr g_mgr;  // Mongoose event manager
 void mongoose_set_http_handlers(const char *name, ...);
 void mongoose_add_ws_handler(unsigned ms, void (*)(struct mg_connection *));
 void mongoose_add_ws_reporter(unsigned ms, const char *name);
+// Sends the attributes of data API `name` that differ between previous and current to every websocket client, which
+// merges them into its copy; clients that connected or fell behind since the last call get all of them instead
+void mongoose_ws_publish(const char *name, const void *previous, const void *current);
 
 struct mongoose_mqtt_handlers {
   struct mg_connection *(*connect_fn)(mg_event_handler_t);
@@ -118,6 +121,9 @@ struct state {
   bool ignition;
   bool indicators_blink;
   char drive_mode[10];
+  int odometer;
+  int range;
+  bool cluster_online;
 };
 void glue_get_state(struct state *);
 void glue_set_state(struct state *);
@@ -125,6 +131,10 @@ void glue_set_state(struct state *);
 void glue_start_steering_button_pressed(struct mg_str);  // Start an action
 bool glue_check_steering_button_pressed(void);  // Check if action is still in progress
 
+void glue_reply_bus(struct mg_connection *, struct mg_http_message *);  // Reply to GET /api/bus
+void glue_reply_timing(struct mg_connection *, struct mg_http_message *);  // Reply to GET /api/timing
+void glue_reply_telemetry(struct mg_connection *, struct mg_http_message *);  // Reply to GET /api/telemetry
+
 struct login {
   char password[1];
   char username[1];
@@ -22,6 +22,18 @@
 #define NO_CACHE_HEADERS "Cache-Control: no-cache\r\n"
 #define JSON_HEADERS "Content-Type: application/json\r\n" NO_CACHE_HEADERS
 
+// Tools/pack_web_root.py moves the UI's script and styles into files named
+// after their content (/app.3f2a9c1b.js) and stamps every packed file with a
+// content hash instead of a date, so the ETag mongoose derives from it only
+// changes with the content. Hashed files never change under their name and are
+// cached without revalidation; pages are revalidated with If-None-Match and
+// answered with 304 when unchanged. The .gz variant is chosen per request.
+#define STATIC_HEADERS "Cache-Control: no-cache\r\nVary: Accept-Encoding\r\n"
+#define IMMUTABLE_HEADERS                                   \
+  "Cache-Control: public, max-age=31536000, immutable\r\n" \
+  "Vary: Accept-Encoding\r\n"
+#define ASSET_HASH_LEN 8  // Hex digits pack_web_root.py puts in a name
+
 // How to create a self signed Elliptic Curve certificate, see
 // https://github.com/cesanta/mongoose/blob/master/test/certs/generate.sh
 #define TLS_CERT                                                       \
@@ -46,6 +58,7 @@
 #define CONN_FILE_UPLOAD 'F'
 #define CONN_ACTION 'A'
 #define CONN_HANDLED 'Z'
+#define CONN_WS_SYNCED 'S'  // Websocket client holding a full copy of published data
 
 typedef void (*data_func_t)(void *);
 typedef bool (*array_get_func_t)(void *, size_t);
@@ -172,6 +185,9 @@ struct attribute s_state_attributes[] = {
   {"ignition", "bool", NULL, offsetof(struct state, ignition), 0, false},
   {"indicators_blink", "bool", NULL, offsetof(struct state, indicators_blink), 0, false},
   {"drive_mode", "string", NULL, offsetof(struct state, drive_mode), 10, false},
+  {"odometer", "int", NULL, offsetof(struct state, odometer), 0, true},
+  {"range", "int", NULL, offsetof(struct state, range), 0, true},
+  {"cluster_online", "bool", NULL, offsetof(struct state, cluster_online), 0, true},
   {NULL, NULL, NULL, 0, 0, false}
 };
 struct attribute s_login_attributes[] = {
@@ -182,11 +198,17 @@ struct attribute s_login_attributes[] = {
 
 struct apihandler_data s_apihandler_state = {{"state", "data", false, 0, 0, 0UL}, s_state_attributes, sizeof(struct state), (void (*)(void *)) glue_get_state, (void (*)(void *)) glue_set_state};
 struct apihandler_action s_apihandler_steering_button_pressed = {{"steering_button_pressed", "action", false, 0, 0, 0UL}, glue_check_steering_button_pressed, glue_start_steering_button_pressed};
+struct apihandler_custom s_apihandler_bus = {{"bus", "custom", true, 0, 0, 0UL}, glue_reply_bus};
+struct apihandler_custom s_apihandler_timing = {{"timing", "custom", true, 0, 0, 0UL}, glue_reply_timing};
+struct apihandler_custom s_apihandler_telemetry = {{"telemetry", "custom", true, 0, 0, 0UL}, glue_reply_telemetry};
 struct apihandler_data s_apihandler_login = {{"login", "data", false, 0, 0, 0UL}, s_login_attributes, sizeof(struct login), (void (*)(void *)) glue_get_login, (void (*)(void *)) glue_set_login};
 
 static struct apihandler *s_apihandlers[] = {
   (struct apihandler *) &s_apihandler_state,
   (struct apihandler *) &s_apihandler_steering_button_pressed,
+  (struct apihandler *) &s_apihandler_bus,
+  (struct apihandler *) &s_apihandler_timing,
+  (struct apihandler *) &s_apihandler_telemetry,
   (struct apihandler *) &s_apihandler_login
 };
 
@@ -436,27 +458,62 @@ static void handle_action(struct mg_connection *c, struct mg_http_message *hm,
   }
 }
 
+static size_t print_attribute(void (*out)(char, void *), void *ptr,
+                              const struct attribute *a, const char *attrptr,
+                              bool first) {
+  size_t len = mg_xprintf(out, ptr, "%s%m:", first ? "" : ",", MG_ESC(a->name));
+  if (strcmp(a->type, "int") == 0) {
+    len += mg_xprintf(out, ptr, "%d", *(int *) attrptr);
+  } else if (strcmp(a->type, "double") == 0) {
+    const char *fmt = a->format;
+    if (fmt == NULL) fmt = "%g";
+    len += mg_xprintf(out, ptr, fmt, *(double *) attrptr);
+  } else if (strcmp(a->type, "bool") == 0) {
+    len += mg_xprintf(out, ptr, "%s", *(bool *) attrptr ? "true" : "false");
+  } else if (strcmp(a->type, "string") == 0) {
+    // We don't use MG_ESC cause the buffer may not be 0-terminated, so the
+    // length stops at the first NUL or the end of the attribute
+    const char *end = (const char *) memchr(attrptr, 0, a->size);
+    int n = end == NULL ? (int) a->size : (int) (end - attrptr);
+    len += mg_xprintf(out, ptr, "%m", mg_print_esc, n, attrptr);
+  } else {
+    len += mg_xprintf(out, ptr, "null");
+  }
+  return len;
+}
+
 size_t print_struct(void (*out)(char, void *), void *ptr, va_list *ap) {
   const struct attribute *a = va_arg(*ap, struct attribute *);
   char *data = va_arg(*ap, char *);
   size_t i, len = 0;
   for (i = 0; a[i].name != NULL; i++) {
-    char *attrptr = data + a[i].offset;
-    len += mg_xprintf(out, ptr, "%s%m:", i == 0 ? "" : ",", MG_ESC(a[i].name));
-    if (strcmp(a[i].type, "int") == 0) {
-      len += mg_xprintf(out, ptr, "%d", *(int *) attrptr);
-    } else if (strcmp(a[i].type, "double") == 0) {
-      const char *fmt = a[i].format;
-      if (fmt == NULL) fmt = "%g";
-      len += mg_xprintf(out, ptr, fmt, *(double *) attrptr);
-    } else if (strcmp(a[i].type, "bool") == 0) {
-      len += mg_xprintf(out, ptr, "%s", *(bool *) attrptr ? "true" : "false");
-    } else if (strcmp(a[i].type, "string") == 0) {
-      // We don't use MG_ESC cause the buffer may not be 0-terminated
-      len += mg_xprintf(out, ptr, "%m", mg_print_esc, a->size, attrptr);
-    } else {
-      len += mg_xprintf(out, ptr, "null");
-    }
+    len += print_attribute(out, ptr, &a[i], data + a[i].offset, i == 0);
+  }
+  return len;
+}
+
+static size_t attribute_size(const struct attribute *a) {
+  if (strcmp(a->type, "int") == 0) return sizeof(int);
+  if (strcmp(a->type, "double") == 0) return sizeof(double);
+  if (strcmp(a->type, "bool") == 0) return sizeof(bool);
+  return a->size;
+}
+
+static bool attribute_changed(const struct attribute *a, const char *previous,
+                              const char *current) {
+  return memcmp(previous + a->offset, current + a->offset,
+                attribute_size(a)) != 0;
+}
+
+// Like print_struct, but only the attributes that differ from previous
+static size_t print_changed(void (*out)(char, void *), void *ptr, va_list *ap) {
+  const struct attribute *a = va_arg(*ap, struct attribute *);
+  const char *previous = va_arg(*ap, const char *);
+  const char *current = va_arg(*ap, const char *);
+  size_t i, len = 0;
+  for (i = 0; a[i].name != NULL; i++) {
+    if (!attribute_changed(&a[i], previous, current)) continue;
+    len += print_attribute(out, ptr, &a[i], current + a[i].offset, len == 0);
   }
   return len;
 }
@@ -655,6 +712,32 @@ struct custom_api_handler *find_custom_handler(struct mg_http_message *hm) {
   return NULL;
 }
 
+#if WIZARD_ENABLE_HTTP_UI
+// True for names like /app.3f2a9c1b.js: a content hash before the extension
+static bool is_hashed_asset(struct mg_str uri) {
+  size_t end = uri.len, i;
+  while (end > 0 && uri.buf[end - 1] != '.' && uri.buf[end - 1] != '/') end--;
+  if (end < ASSET_HASH_LEN + 3 || uri.buf[end - 1] != '.') return false;
+  end--;  // Drop the dot before the extension
+  for (i = end - ASSET_HASH_LEN; i < end; i++) {
+    char ch = uri.buf[i];
+    if ((ch < '0' || ch > '9') && (ch < 'a' || ch > 'f')) return false;
+  }
+  i = end - ASSET_HASH_LEN - 1;
+  return uri.buf[i] == '.' && uri.buf[i - 1] != '/';  // A base name first
+}
+
+// Immutable caching only for hashed files that exist, never for a 404
+static const char *static_headers(struct mg_str uri, const char *root) {
+  char path[MG_PATH_MAX];
+  if (!is_hashed_asset(uri)) return STATIC_HEADERS;
+  mg_snprintf(path, sizeof(path), "%s%.*s.gz", root, (int) uri.len - 1,
+              uri.buf + 1);
+  return mg_unpack(path, NULL, NULL) != NULL ? IMMUTABLE_HEADERS
+                                             : STATIC_HEADERS;
+}
+#endif  // WIZARD_ENABLE_HTTP_UI
+
 // Mongoose event handler function, gets called by the mg_mgr_poll()
 static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data) {
   if (ev == MG_EV_HTTP_HDRS && c->data[0] == 0) {
@@ -722,7 +805,7 @@ static void http_ev_handler(struct mg_connection *c, int ev, void *ev_data) {
       memset(&opts, 0, sizeof(opts));
       opts.root_dir = "/web_root/";
       opts.fs = &mg_fs_packed;
-      opts.extra_headers = NO_CACHE_HEADERS;
+      opts.extra_headers = static_headers(hm->uri, opts.root_dir);
       mg_http_serve_dir(c, hm, &opts);
 #else
       mg_http_reply(c, 200, "", ":)\n");
@@ -825,6 +908,42 @@ void mongoose_add_ws_handler(unsigned ms, void (*fn)(struct mg_connection *)) {
 }
 #endif  // WIZARD_ENABLE_WEBSOCKET
 
+void mongoose_ws_publish(const char *name, const void *previous,
+                         const void *current) {
+  struct apihandler *ah = get_api_handler(mg_str(name));
+  struct apihandler_data *h = (struct apihandler_data *) ah;
+  struct mg_connection *c;
+  bool changed = false;
+  size_t i;
+
+  if (ah == NULL || strcmp(ah->type, "data") != 0) {
+    MG_ERROR(("No data handler for %s", name));
+    return;
+  }
+  for (i = 0; h->attributes[i].name != NULL && !changed; i++) {
+    changed = attribute_changed(&h->attributes[i], (const char *) previous,
+                                (const char *) current);
+  }
+
+  for (c = g_mgr.conns; c != NULL; c = c->next) {
+    if (c->is_websocket == 0) continue;
+    if (c->send.len > 2048) {
+      // Slow client: skip this update and resend once it catches up
+      c->data[0] = 0;
+      continue;
+    }
+    if (c->data[0] != CONN_WS_SYNCED) {
+      // New or caught up: the whole object, later messages are merged into it
+      mg_ws_printf(c, WEBSOCKET_OP_TEXT, "{%m:{%M}}", MG_ESC(name),
+                   print_struct, h->attributes, current, 0);
+      c->data[0] = CONN_WS_SYNCED;
+    } else if (changed) {
+      mg_ws_printf(c, WEBSOCKET_OP_TEXT, "{%m:{%M}}", MG_ESC(name),
+                   print_changed, h->attributes, previous, current);
+    }
+  }
+}
+
 #endif  // WIZARD_ENABLE_HTTP || WIZARD_ENABLE_HTTPS
 
 #if WIZARD_ENABLE_SNTP
@@ -0,0 +1,240 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced cluster encoder benchmark
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// Drives BMWFSeriesCluster::updateWithGame() directly with synthetic GameState traces, one call per simulated
+// millisecond, against the simulated MCP2515 which records every frame that reaches the bus. For each trace it prints
+// frames per simulated second per CAN ID, bus payload bytes, the most frames queued by a single tick and the CPU time
+// per tick. The CPU time covers the cluster, the MCP_CAN driver and the SPI shim, so compare runs on the same machine.
+// --replay runs a recorded telemetry log instead, with its records applied at their original timestamps.
+//
+//   carcluster_bench [--seconds N] [--scenario idle|sweep|flapping] [--replay FILE]
+// ####################################################################################################################
+
+#include "../CarCluster/src/Clusters/BMW_F/BMWFSeriesCluster.h"
+#include "../CarCluster/src/Games/TelemetryLog.h"
+#include "../CarCluster/src/Libs/MCP_CAN/mcp_can.h"
+#include "Mcp2515Simulator.h"
+
+#include <chrono>
+#include <map>
+#include <vector>
+
+namespace {
+
+const uint8_t kCsPin = 5;
+const uint8_t kIntPin = 4;
+const uint64_t kTickNanos = 1000000ULL;
+
+typedef void (*TraceFunction)(GameState& game, double seconds);
+
+struct Scenario {
+  const char* name;
+  TraceFunction trace;
+};
+
+void startEngine(GameState& game) {
+  game.setField(game.ignition, true, GameStateGroup_Engine);
+  game.setField(game.engineRunning, true, GameStateGroup_Engine);
+  game.setField(game.mainLights, true, GameStateGroup_Lights);
+  game.setField(game.fuelQuantity, 65.0f, GameStateGroup_Fuel);
+}
+
+// Engine idling in P; nothing changes after the first tick.
+void idleTrace(GameState& game, double) {
+  startEngine(game);
+  game.setField(game.rpm, 750, GameStateGroup_Engine);
+}
+
+// Full throttle in D: RPM sweeps 1000-7000 every two seconds while the gear steps up and the speed climbs.
+void sweepTrace(GameState& game, double seconds) {
+  startEngine(game);
+
+  const int gearIndex = 1 + static_cast<int>(seconds / 2.0) % 8;
+  const double inGear = fmod(seconds, 2.0) / 2.0;
+  const double speed = seconds * 25.0;
+
+  game.setField(game.gear, GearState_Auto_D, GameStateGroup_Gear);
+  game.setField(game.gearLetter, 'D', GameStateGroup_Gear);
+  game.setField(game.gearIndex, gearIndex, GameStateGroup_Gear);
+  game.setField(game.rpm, static_cast<int>(1000.0 + inGear * 6000.0), GameStateGroup_Engine);
+  game.setField(game.speed, static_cast<int>(speed > 260.0 ? 260.0 : speed), GameStateGroup_Speed);
+  game.setField(game.coolantTemperature, 60 + static_cast<int>(seconds * 3.0) % 40, GameStateGroup_Temperature);
+}
+
+// Idle with doors, trunk and tyre pressure warnings toggling every few ticks: the worst case for dirty groups.
+void flappingTrace(GameState& game, double seconds) {
+  idleTrace(game, seconds);
+
+  const long milliseconds = static_cast<long>(seconds * 1000.0);
+  const bool doorPhase = (milliseconds / 50) % 2 != 0;
+  const bool tyrePhase = (milliseconds / 100) % 2 != 0;
+
+  game.setField(game.doorOpen, doorPhase, GameStateGroup_Body);
+  game.setField(game.doorFL, doorPhase, GameStateGroup_Body);
+  game.setField(game.doorRR, !doorPhase, GameStateGroup_Body);
+  game.setField(game.trunkOpen, (milliseconds / 70) % 2 != 0, GameStateGroup_Body);
+  game.setField(game.tireDefFL, tyrePhase, GameStateGroup_Warnings);
+  game.setField(game.tireDefRR, !tyrePhase, GameStateGroup_Warnings);
+}
+
+// Telemetry log loaded by --replay. Applies every record due by the given time; the log ends when no complete record
+// is left.
+std::vector<uint8_t> replayLog;
+size_t replayPosition = TELEMETRY_LOG_HEADER_SIZE;
+uint64_t replayTimeMs = 0;
+
+void replayTrace(GameState& game, double seconds) {
+  const uint64_t elapsedMs = static_cast<uint64_t>(seconds * 1000.0);
+  while (replayPosition < replayLog.size()) {
+    const uint8_t* record = replayLog.data() + replayPosition;
+    const size_t available = replayLog.size() - replayPosition;
+    uint32_t deltaMs = 0;
+    if (!peekTelemetryRecordDelta(record, available, &deltaMs)) break;
+    if (replayTimeMs + deltaMs > elapsedMs) break;
+
+    const size_t used = decodeTelemetryRecord(record, available, &deltaMs, game);
+    if (used == 0) break;
+    replayPosition += used;
+    replayTimeMs += deltaMs;
+  }
+}
+
+bool loadReplayLog(const char* path) {
+  FILE* file = fopen(path, "rb");
+  if (!file) return false;
+  uint8_t chunk[4096];
+  size_t count;
+  while ((count = fread(chunk, 1, sizeof(chunk), file)) > 0) replayLog.insert(replayLog.end(), chunk, chunk + count);
+  fclose(file);
+  return isTelemetryLogHeader(replayLog.data(), replayLog.size());
+}
+
+const Scenario kScenarios[] = {
+  {"idle", idleTrace},
+  {"sweep", sweepTrace},
+  {"flapping", flappingTrace},
+};
+
+void advanceTo(uint64_t nanos) {
+  if (HostClock::nanos() < nanos) HostClock::advanceNanos(nanos - HostClock::nanos());
+}
+
+void runScenario(const Scenario& scenario, double seconds) {
+  HostClock::reset();
+
+  Mcp2515Simulator simulator(kCsPin, kIntPin);
+  simulator.attach();
+  MCP_CAN can(kCsPin);
+  can.begin(MCP_STDEXT, CAN_500KBPS, MCP_8MHZ);
+  can.setMode(MCP_NORMAL);
+  can.enableTxQueue(1);
+
+  BMWFSeriesCluster cluster(can);
+  GameState game(BMWFSeriesCluster::clusterConfig());
+  simulator.clearFrames();
+
+  const uint64_t startNanos = HostClock::nanos();
+  const uint64_t ticks = static_cast<uint64_t>(seconds * 1e9 / kTickNanos);
+  uint64_t cpuNanos = 0;
+  uint64_t worstTickNanos = 0;
+  uint32_t worstBurst = 0;
+
+  for (uint64_t tick = 0; tick < ticks; tick++) {
+    advanceTo(startNanos + tick * kTickNanos);
+    scenario.trace(game, (HostClock::nanos() - startNanos) / 1e9);
+
+    const uint32_t requestsBefore = simulator.txRequestCount();
+    const uint8_t pendingBefore = can.txQueuePending();
+    const uint32_t droppedBefore = can.txQueueDropped();
+
+    const auto tickStart = std::chrono::steady_clock::now();
+    cluster.updateWithGame(game);
+    can.serviceTxQueue();
+    const uint64_t tickNanos = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tickStart).count());
+
+    // Frames handed to the driver this tick: loaded into a TX buffer, left waiting in the queue, or dropped.
+    const uint32_t burst = (simulator.txRequestCount() - requestsBefore) +
+                           (can.txQueuePending() - pendingBefore) +
+                           (can.txQueueDropped() - droppedBefore);
+
+    cpuNanos += tickNanos;
+    if (tickNanos > worstTickNanos) worstTickNanos = tickNanos;
+    if (burst > worstBurst) worstBurst = burst;
+  }
+  advanceTo(startNanos + ticks * kTickNanos);
+
+  const double simulatedSeconds = (HostClock::nanos() - startNanos) / 1e9;
+  const std::vector<CapturedFrame>& frames = simulator.frames();
+  std::map<uint32_t, uint32_t> perId;
+  uint64_t payloadBytes = 0;
+  for (const CapturedFrame& frame : frames) {
+    perId[frame.id]++;
+    payloadBytes += frame.length;
+  }
+
+  printf("scenario %s: %.2f s simulated, %llu ticks\n", scenario.name, simulatedSeconds,
+         static_cast<unsigned long long>(ticks));
+  printf("  cpu     %.0f ns/tick mean, %llu ns worst\n",
+         ticks > 0 ? static_cast<double>(cpuNanos) / ticks : 0.0,
+         static_cast<unsigned long long>(worstTickNanos));
+  printf("  frames  %zu (%.1f/s), payload %llu B (%.1f B/s), bus busy %.1f%%\n",
+         frames.size(),
+         frames.size() / simulatedSeconds,
+         static_cast<unsigned long long>(payloadBytes),
+         payloadBytes / simulatedSeconds,
+         100.0 * simulator.busBusyNanos() / (simulatedSeconds * 1e9));
+  printf("  burst   %u frames worst tick\n", static_cast<unsigned>(worstBurst));
+  printf("  queue   %lu dropped, %lu stale\n",
+         static_cast<unsigned long>(can.txQueueDropped()),
+         static_cast<unsigned long>(can.txQueueStale()));
+  printf("  ID     frames   per s\n");
+  for (const auto& entry : perId) {
+    printf("  0x%03X %7u %7.1f\n", static_cast<unsigned>(entry.first), entry.second,
+           entry.second / simulatedSeconds);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  double seconds = 10.0;
+  const char* only = nullptr;
+  const char* replayPath = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+      only = argv[++i];
+    } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      replayPath = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--seconds N] [--scenario idle|sweep|flapping] [--replay FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (replayPath) {
+    if (!loadReplayLog(replayPath)) {
+      fprintf(stderr, "%s is not a telemetry log\n", replayPath);
+      return 2;
+    }
+    runScenario({replayPath, replayTrace}, seconds);
+    return 0;
+  }
+
+  bool ran = false;
+  for (const Scenario& scenario : kScenarios) {
+    if (only && strcmp(only, scenario.name) != 0) continue;
+    runScenario(scenario, seconds);
+    ran = true;
+  }
+
+  if (!ran) {
+    fprintf(stderr, "unknown scenario %s\n", only);
+    return 2;
+  }
+  return 0;
+}
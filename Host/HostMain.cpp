@@ -0,0 +1,212 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced host runner
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// Runs the sketch's setup()/loop() on Linux against the simulated MCP2515, built with WIFI_ENABLED and
+// RTOS_TASKS_ENABLED set to 0: the cluster encoder, telemetry arbitration, serial input and CAN RX path run in one
+// thread, while everything behind WIFI_ENABLED (the Forza and Better_CAN receivers, TelemetryRecorder, the replay
+// source, WebDashboard and mongoose) is compiled out. In its place this file feeds Better_CAN packets to its own
+// BeamNGGame over the AsyncUDP shim and marks that source fresh the way serviceCan() does.
+//
+// Every frame the cluster puts on the bus is recorded and summarised per CAN ID, or dumped in candump log format with
+// --dump. --record writes the GameState trace with a host-side writer in the TelemetryLog format, which
+// carcluster_bench --replay and the firmware's /api/telemetry replay can play back.
+//
+//   carcluster_host [--seconds N] [--dump] [--serial] [--record FILE]
+// ####################################################################################################################
+
+#define WIFI_ENABLED 0
+#define RTOS_TASKS_ENABLED 0
+#include "../CarCluster/CarCluster.ino"
+
+#include "../CarCluster/src/Games/BeamNGGame.h"
+#include "../CarCluster/src/Games/BetterCANProtocol.h"
+#include "../CarCluster/src/Games/TelemetryLog.h"
+#include "Mcp2515Simulator.h"
+
+#include <chrono>
+#include <map>
+
+namespace {
+
+Mcp2515Simulator simulator(SPI_CS_PIN, CAN_INT);
+BeamNGGame hostBeamNGGame(telemetryArbiter.source(TelemetrySource_BetterCAN), WIFI_BEAM_UDP_PORT);
+
+const uint64_t kBetterCanPeriodNanos = 20000000ULL;
+
+// A simple warm-up and acceleration profile: idle in P, then pull through the gears in D.
+void fillDrivePacket(BetterCANPacket& packet, double seconds) {
+  memset(&packet, 0, sizeof(packet));
+
+  packet.time = static_cast<uint32_t>(seconds * 1000.0);
+  packet.ignition = 1;
+  packet.engineRunning = seconds >= 1.0;
+  packet.fuel = 65.0f;
+  packet.waterTemp = 90.0f;
+  packet.oilTemp = 95.0f;
+  packet.lowBeam = 1;
+  packet.driveMode = 1;
+  packet.hasABS = 1;
+  packet.hasESC = 1;
+  packet.hasTCS = 1;
+
+  if (seconds < 3.0) {
+    packet.gearLetter = 'P';
+    packet.rpm = packet.engineRunning ? 800.0f : 0.0f;
+    return;
+  }
+
+  const double driving = seconds - 3.0;
+  const uint8_t gear = static_cast<uint8_t>(1 + static_cast<int>(driving / 2.0) % 6);
+  const double inGear = fmod(driving, 2.0) / 2.0;
+
+  packet.gearLetter = 'D';
+  packet.gearIndex = gear;
+  packet.rpm = static_cast<float>(1500.0 + inGear * 4500.0);
+  packet.speedKmh = static_cast<float>(driving * 12.0 > 250.0 ? 250.0 : driving * 12.0);
+}
+
+// Appends a record whenever a group differs from what the log holds so far, like TelemetryRecorder on the ESP32.
+class HostTelemetryWriter {
+ public:
+  explicit HostTelemetryWriter(ClusterConfiguration configuration) : recordedState(configuration) {}
+
+  bool open(const char* path) {
+    file = fopen(path, "wb");
+    if (!file) return false;
+    uint8_t header[TELEMETRY_LOG_HEADER_SIZE];
+    fwrite(header, 1, encodeTelemetryLogHeader(header), file);
+    return true;
+  }
+
+  void capture(const GameState& state, uint64_t nanos) {
+    if (!file) return;
+
+    recordedState.copyGroups(state, GameStateGroup_All);
+    uint16_t groups = recordedState.takeDirtyGroups();
+    if (records == 0) groups = GameStateGroup_All;
+    if (groups == 0) return;
+
+    const uint64_t nowMs = nanos / 1000000ULL;
+    uint8_t record[TELEMETRY_LOG_MAX_RECORD_SIZE];
+    const uint32_t deltaMs = records == 0 ? 0 : static_cast<uint32_t>(nowMs - lastRecordMs);
+    fwrite(record, 1, encodeTelemetryRecord(record, deltaMs, recordedState, groups), file);
+    lastRecordMs = nowMs;
+    records++;
+  }
+
+  void close() {
+    if (!file) return;
+    fprintf(stderr, "recorded %lu telemetry records (%ld bytes)\n", static_cast<unsigned long>(records), ftell(file));
+    fclose(file);
+    file = nullptr;
+  }
+
+ private:
+  FILE* file = nullptr;
+  GameState recordedState;
+  uint64_t lastRecordMs = 0;
+  uint32_t records = 0;
+};
+
+void printSummary(const std::vector<CapturedFrame>& frames, double simulatedSeconds, uint64_t loops,
+                  double wallSeconds) {
+  std::map<uint32_t, uint32_t> perId;
+  for (const CapturedFrame& frame : frames) perId[frame.id]++;
+
+  printf("simulated %.2f s, %llu loop() calls in %.3f s wall time (%.0f ticks/s)\n",
+         simulatedSeconds,
+         static_cast<unsigned long long>(loops),
+         wallSeconds,
+         wallSeconds > 0.0 ? static_cast<double>(loops) / wallSeconds : 0.0);
+  printf("%zu frames, bus busy %.1f%%\n",
+         frames.size(),
+         simulatedSeconds > 0.0 ? 100.0 * simulator.busBusyNanos() / (simulatedSeconds * 1e9) : 0.0);
+  printf("TX queue: %lu dropped, %lu stale\n",
+         static_cast<unsigned long>(CAN.txQueueDropped()),
+         static_cast<unsigned long>(CAN.txQueueStale()));
+  printf("  ID     frames   per s\n");
+  for (const auto& entry : perId) {
+    printf("  0x%03X %7u %7.1f\n", static_cast<unsigned>(entry.first), entry.second,
+           entry.second / simulatedSeconds);
+  }
+}
+
+void printDump(const std::vector<CapturedFrame>& frames) {
+  for (const CapturedFrame& frame : frames) {
+    printf("(%.6f) can0 %03X#", frame.timeNanos / 1e9, static_cast<unsigned>(frame.id));
+    for (uint8_t i = 0; i < frame.length; i++) printf("%02X", frame.data[i]);
+    printf("\n");
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  double seconds = 10.0;
+  bool dump = false;
+  bool serialEcho = false;
+  const char* recordPath = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--dump") == 0) {
+      dump = true;
+    } else if (strcmp(argv[i], "--serial") == 0) {
+      serialEcho = true;
+    } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+      recordPath = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--seconds N] [--dump] [--serial] [--record FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  Serial.setEcho(serialEcho);
+  simulator.attach();
+
+  HostTelemetryWriter telemetryWriter(clusterConfig);
+  if (recordPath && !telemetryWriter.open(recordPath)) {
+    fprintf(stderr, "cannot create %s\n", recordPath);
+    return 1;
+  }
+
+  setup();
+  hostBeamNGGame.begin();
+
+  const uint64_t startNanos = HostClock::nanos();
+  const uint64_t endNanos = startNanos + static_cast<uint64_t>(seconds * 1e9);
+  uint64_t nextPacketNanos = startNanos;
+  uint64_t loops = 0;
+  simulator.clearFrames();
+
+  const auto wallStart = std::chrono::steady_clock::now();
+
+  while (HostClock::nanos() < endNanos) {
+    if (HostClock::nanos() >= nextPacketNanos) {
+      BetterCANPacket packet;
+      fillDrivePacket(packet, (HostClock::nanos() - startNanos) / 1e9);
+      AsyncUDP::deliver(WIFI_BEAM_UDP_PORT, reinterpret_cast<const uint8_t*>(&packet), sizeof(packet));
+      nextPacketNanos += kBetterCanPeriodNanos;
+    }
+
+    if (hostBeamNGGame.update()) telemetryArbiter.markFresh(TelemetrySource_BetterCAN, millis());
+    const uint64_t passNanos = HostClock::nanos() - startNanos;
+    loop();
+    telemetryWriter.capture(telemetryArbiter.arbitrated(), passNanos);
+    loops++;
+  }
+
+  telemetryWriter.close();
+
+  const double wallSeconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+  if (dump) {
+    printDump(simulator.frames());
+  } else {
+    printSummary(simulator.frames(), (HostClock::nanos() - startNanos) / 1e9, loops, wallSeconds);
+  }
+  return 0;
+}
@@ -0,0 +1,403 @@
+// ####################################################################################################################
+// Register-level MCP2515 simulator for host builds
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// ####################################################################################################################
+
+#include "Mcp2515Simulator.h"
+
+namespace {
+
+const uint8_t kRegCanStat = 0x0E;
+const uint8_t kRegCanCtrl = 0x0F;
+const uint8_t kRegCanIntE = 0x2B;
+const uint8_t kRegCanIntF = 0x2C;
+const uint8_t kRegEflg = 0x2D;
+const uint8_t kRegRxb0Ctrl = 0x60;
+const uint8_t kRegRxb1Ctrl = 0x70;
+const uint8_t kTxCtrl[3] = {0x30, 0x40, 0x50};
+
+const uint8_t kTxReq = 0x08;
+const uint8_t kTxAbtf = 0x40;
+const uint8_t kModeMask = 0xE0;
+const uint8_t kModeNormal = 0x00;
+const uint8_t kModeLoopback = 0x40;
+const uint8_t kModeConfig = 0x80;
+const uint8_t kAbortTx = 0x10;
+
+const uint8_t kRx0If = 0x01;
+const uint8_t kRx1If = 0x02;
+const uint8_t kRx0Ovr = 0x40;
+const uint8_t kRx1Ovr = 0x80;
+
+uint32_t decodeStandard(uint8_t sidh, uint8_t sidl) {
+  return (static_cast<uint32_t>(sidh) << 3) | (sidl >> 5);
+}
+
+uint32_t decodeExtended(uint8_t sidh, uint8_t sidl, uint8_t eid8, uint8_t eid0) {
+  return (decodeStandard(sidh, sidl) << 18) | (static_cast<uint32_t>(sidl & 0x03) << 16) |
+         (static_cast<uint32_t>(eid8) << 8) | eid0;
+}
+
+}  // namespace
+
+Mcp2515Simulator::Mcp2515Simulator(uint8_t csPin, uint8_t intPin, uint32_t bitRate)
+    : csPin(csPin), intPin(intPin), bitNanos(1000000000ULL / bitRate) {
+  reset();
+}
+
+void Mcp2515Simulator::attach() {
+  hostAttachPin(csPin, this);
+  hostAttachPin(intPin, this);
+}
+
+void Mcp2515Simulator::reset() {
+  memset(registers, 0, sizeof(registers));
+  memset(txRequestedAt, 0, sizeof(txRequestedAt));
+  registers[kRegCanStat] = kModeConfig;
+  registers[kRegCanCtrl] = 0x87;
+  busFreeAt = HostClock::nanos();
+  transmitting = -1;
+}
+
+// ----------------------------- GPIO / SPI front end -----------------------------------------------------------------
+
+void Mcp2515Simulator::pinWritten(uint8_t pin, uint8_t value) {
+  if (pin != csPin) return;
+
+  if (value == LOW && !selected) {
+    SPI.hostSetSelectedDevice(this);
+    spiSelect();
+  } else if (value == HIGH && selected) {
+    spiDeselect();
+    SPI.hostSetSelectedDevice(nullptr);
+  }
+}
+
+int Mcp2515Simulator::pinRead(uint8_t pin) {
+  if (pin != intPin) return selected ? LOW : HIGH;
+  advanceBus();
+  return interruptAsserted() ? LOW : HIGH;
+}
+
+void Mcp2515Simulator::spiSelect() {
+  selected = true;
+  phase = Phase_Command;
+  rxBufferRead = 0;
+  advanceBus();
+}
+
+void Mcp2515Simulator::spiDeselect() {
+  selected = false;
+
+  // READ RX BUFFER clears the matching receive flag when chip-select is raised.
+  if (rxBufferRead == 1) registers[kRegCanIntF] &= ~kRx0If;
+  if (rxBufferRead == 2) registers[kRegCanIntF] &= ~kRx1If;
+  rxBufferRead = 0;
+
+  hostPollInterrupts();
+}
+
+uint8_t Mcp2515Simulator::spiTransfer(uint8_t value) {
+  switch (phase) {
+    case Phase_Command:
+      instruction = value;
+      if (value == 0xC0) {
+        reset();
+        phase = Phase_Done;
+      } else if (value == 0x02 || value == 0x03 || value == 0x05) {
+        phase = Phase_Address;
+      } else if (value == 0xA0 || value == 0xB0) {
+        phase = Phase_Data;
+      } else if ((value & 0xF8) == 0x40 && (value & 0x07) <= 0x05) {
+        // LOAD TX BUFFER: 0x40/0x42/0x44 start at TXBnSIDH, 0x41/0x43/0x45 at TXBnD0.
+        const uint8_t buffer = (value & 0x06) >> 1;
+        address = static_cast<uint8_t>(kTxCtrl[buffer] + ((value & 0x01) ? 6 : 1));
+        phase = Phase_Data;
+      } else if ((value & 0xF8) == 0x80) {
+        for (uint8_t buffer = 0; buffer < 3; buffer++) {
+          if (value & (1 << buffer)) requestTransmit(buffer);
+        }
+        phase = Phase_Done;
+      } else if ((value & 0xF9) == 0x90) {
+        // READ RX BUFFER: 0x90/0x92 read RXB0 from SIDH/D0, 0x94/0x96 read RXB1.
+        const bool second = (value & 0x04) != 0;
+        address = static_cast<uint8_t>((second ? kRegRxb1Ctrl : kRegRxb0Ctrl) + ((value & 0x02) ? 6 : 1));
+        rxBufferRead = second ? 2 : 1;
+        phase = Phase_Data;
+      } else {
+        phase = Phase_Done;
+      }
+      return 0xFF;
+
+    case Phase_Address:
+      address = value & 0x7F;
+      phase = instruction == 0x05 ? Phase_Mask : Phase_Data;
+      return 0xFF;
+
+    case Phase_Mask:
+      bitMask = value;
+      phase = Phase_Data;
+      return 0xFF;
+
+    case Phase_Data:
+      if (instruction == 0xA0) return readStatus();
+      if (instruction == 0xB0) return rxStatus();
+      if (instruction == 0x05) {
+        writeRegister(address, static_cast<uint8_t>((readRegister(address) & ~bitMask) | (value & bitMask)));
+        phase = Phase_Done;
+        return 0xFF;
+      }
+      if (instruction == 0x03 || (instruction & 0xF9) == 0x90) {
+        const uint8_t result = readRegister(address);
+        address = (address + 1) & 0x7F;
+        return result;
+      }
+      writeRegister(address, value);
+      address = (address + 1) & 0x7F;
+      return 0xFF;
+
+    case Phase_Done:
+    default:
+      return 0xFF;
+  }
+}
+
+// ----------------------------- Register file ------------------------------------------------------------------------
+
+uint8_t Mcp2515Simulator::readRegister(uint8_t address) {
+  address &= 0x7F;
+  if ((address & 0x0F) == kRegCanStat) return registers[kRegCanStat];
+  if ((address & 0x0F) == kRegCanCtrl) return registers[kRegCanCtrl];
+  return registers[address];
+}
+
+void Mcp2515Simulator::writeRegister(uint8_t address, uint8_t value) {
+  address &= 0x7F;
+
+  if ((address & 0x0F) == kRegCanCtrl) {
+    registers[kRegCanCtrl] = value;
+    registers[kRegCanStat] = static_cast<uint8_t>((registers[kRegCanStat] & ~kModeMask) | (value & kModeMask));
+    if (value & kAbortTx) {
+      for (uint8_t buffer = 0; buffer < 3; buffer++) {
+        if ((registers[kTxCtrl[buffer]] & kTxReq) && buffer != transmitting) {
+          registers[kTxCtrl[buffer]] = static_cast<uint8_t>((registers[kTxCtrl[buffer]] & ~kTxReq) | kTxAbtf);
+        }
+      }
+    }
+    return;
+  }
+  if ((address & 0x0F) == kRegCanStat) return;
+
+  for (uint8_t buffer = 0; buffer < 3; buffer++) {
+    if (address != kTxCtrl[buffer]) continue;
+
+    const bool wasRequested = (registers[address] & kTxReq) != 0;
+    // Only TXREQ and TXP are writable; ABTF/MLOA/TXERR are status bits.
+    registers[address] = static_cast<uint8_t>((registers[address] & 0x70) | (value & 0x0B));
+    if (!wasRequested && (value & kTxReq)) requestTransmit(buffer);
+    if (wasRequested && !(value & kTxReq)) {
+      // Clearing TXREQ aborts a waiting frame, but one already on the bus finishes and then clears TXREQ itself.
+      registers[address] |= buffer == transmitting ? kTxReq : kTxAbtf;
+    }
+    return;
+  }
+
+  registers[address] = value;
+}
+
+uint8_t Mcp2515Simulator::readStatus() {
+  advanceBus();
+  const uint8_t flags = registers[kRegCanIntF];
+  uint8_t status = flags & (kRx0If | kRx1If);
+  for (uint8_t buffer = 0; buffer < 3; buffer++) {
+    if (registers[kTxCtrl[buffer]] & kTxReq) status |= static_cast<uint8_t>(0x04 << (buffer * 2));
+    if (flags & (0x04 << buffer)) status |= static_cast<uint8_t>(0x08 << (buffer * 2));
+  }
+  return status;
+}
+
+uint8_t Mcp2515Simulator::rxStatus() {
+  const uint8_t flags = registers[kRegCanIntF];
+  uint8_t status = static_cast<uint8_t>((flags & (kRx0If | kRx1If)) << 6);
+  const uint8_t base = (flags & kRx0If) ? kRegRxb0Ctrl : kRegRxb1Ctrl;
+  if (registers[base + 2] & 0x08) status |= 0x10;
+  status |= registers[base] & 0x07;
+  return status;
+}
+
+// ----------------------------- Transmit side ------------------------------------------------------------------------
+
+void Mcp2515Simulator::requestTransmit(uint8_t buffer) {
+  const uint8_t ctrl = kTxCtrl[buffer];
+  registers[ctrl] = static_cast<uint8_t>((registers[ctrl] & 0x03) | kTxReq);
+  txRequestedAt[buffer] = HostClock::nanos();
+  txRequests++;
+}
+
+void Mcp2515Simulator::advanceBus() {
+  const uint8_t mode = registers[kRegCanStat] & kModeMask;
+  if (mode != kModeNormal && mode != kModeLoopback) return;
+
+  const uint64_t now = HostClock::nanos();
+
+  while (true) {
+    uint64_t earliestRequest = UINT64_MAX;
+    for (uint8_t buffer = 0; buffer < 3; buffer++) {
+      if ((registers[kTxCtrl[buffer]] & kTxReq) && txRequestedAt[buffer] < earliestRequest) {
+        earliestRequest = txRequestedAt[buffer];
+      }
+    }
+    if (earliestRequest == UINT64_MAX) {
+      transmitting = -1;
+      return;
+    }
+
+    const uint64_t start = earliestRequest > busFreeAt ? earliestRequest : busFreeAt;
+
+    // Highest TXP wins; on a tie the MCP2515 sends the highest-numbered buffer first.
+    int8_t chosen = -1;
+    for (int8_t buffer = 2; buffer >= 0; buffer--) {
+      const uint8_t ctrl = registers[kTxCtrl[buffer]];
+      if (!(ctrl & kTxReq) || txRequestedAt[buffer] > start) continue;
+      if (chosen < 0 || (ctrl & 0x03) > (registers[kTxCtrl[chosen]] & 0x03)) chosen = buffer;
+    }
+
+    const uint8_t base = kTxCtrl[chosen];
+    const bool extended = (registers[base + 2] & 0x08) != 0;
+    const bool remote = (registers[base + 5] & 0x40) != 0;
+    uint8_t length = registers[base + 5] & 0x0F;
+    if (length > 8) length = 8;
+
+    // Nominal frame length without stuff bits: 47 bits of overhead for an 11-bit frame, 67 for a 29-bit frame.
+    const uint64_t bits = (extended ? 67 : 47) + (remote ? 0 : 8ULL * length);
+    const uint64_t end = start + bits * bitNanos;
+    if (end > now) {
+      transmitting = start <= now ? chosen : -1;
+      return;
+    }
+
+    completeTransmit(static_cast<uint8_t>(chosen), end);
+    busyNanos += bits * bitNanos;
+    busFreeAt = end;
+  }
+}
+
+void Mcp2515Simulator::completeTransmit(uint8_t buffer, uint64_t endNanos) {
+  const uint8_t base = kTxCtrl[buffer];
+
+  CapturedFrame frame = {};
+  frame.timeNanos = endNanos;
+  frame.extended = (registers[base + 2] & 0x08) != 0;
+  frame.id = frame.extended
+                 ? decodeExtended(registers[base + 1], registers[base + 2], registers[base + 3], registers[base + 4])
+                 : decodeStandard(registers[base + 1], registers[base + 2]);
+  frame.length = registers[base + 5] & 0x0F;
+  if (frame.length > 8) frame.length = 8;
+  memcpy(frame.data, &registers[base + 6], frame.length);
+  transmitted.push_back(frame);
+
+  registers[base] &= static_cast<uint8_t>(~kTxReq);
+  registers[kRegCanIntF] |= static_cast<uint8_t>(0x04 << buffer);
+}
+
+// ----------------------------- Receive side -------------------------------------------------------------------------
+
+bool Mcp2515Simulator::filterMatches(uint8_t filterAddress, uint8_t maskAddress, uint32_t id, bool extended) {
+  const uint8_t* filter = &registers[filterAddress];
+  const uint8_t* mask = &registers[maskAddress];
+
+  if (((filter[1] & 0x08) != 0) != extended) return false;
+
+  if (extended) {
+    const uint32_t filterId = decodeExtended(filter[0], filter[1], filter[2], filter[3]);
+    const uint32_t maskId = decodeExtended(mask[0], mask[1], mask[2], mask[3]);
+    return ((id ^ filterId) & maskId) == 0;
+  }
+
+  const uint32_t filterId = decodeStandard(filter[0], filter[1]);
+  const uint32_t maskId = decodeStandard(mask[0], mask[1]);
+  return ((id ^ filterId) & maskId) == 0;
+}
+
+void Mcp2515Simulator::storeRx(uint8_t buffer, uint32_t id, bool extended, uint8_t length, const uint8_t* data,
+                               uint8_t filterHit) {
+  const uint8_t base = buffer == 0 ? kRegRxb0Ctrl : kRegRxb1Ctrl;
+
+  if (extended) {
+    registers[base + 1] = static_cast<uint8_t>(id >> 21);
+    registers[base + 2] = static_cast<uint8_t>((((id >> 18) & 0x07) << 5) | 0x08 | ((id >> 16) & 0x03));
+    registers[base + 3] = static_cast<uint8_t>(id >> 8);
+    registers[base + 4] = static_cast<uint8_t>(id);
+  } else {
+    registers[base + 1] = static_cast<uint8_t>(id >> 3);
+    registers[base + 2] = static_cast<uint8_t>((id & 0x07) << 5);
+    registers[base + 3] = 0;
+    registers[base + 4] = 0;
+  }
+
+  if (length > 8) length = 8;
+  registers[base + 5] = length;
+  memcpy(&registers[base + 6], data, length);
+
+  const uint8_t hitMask = buffer == 0 ? 0x01 : 0x07;
+  registers[base] = static_cast<uint8_t>((registers[base] & ~hitMask) | (filterHit & hitMask));
+  registers[kRegCanIntF] |= buffer == 0 ? kRx0If : kRx1If;
+}
+
+bool Mcp2515Simulator::injectFrame(uint32_t id, bool extended, uint8_t length, const uint8_t* data) {
+  advanceBus();
+
+  const uint8_t mode = registers[kRegCanStat] & kModeMask;
+  if (mode == kModeConfig) return false;
+
+  const bool rxb0Any = (registers[kRegRxb0Ctrl] & 0x60) == 0x60;
+  const bool rxb1Any = (registers[kRegRxb1Ctrl] & 0x60) == 0x60;
+  const uint8_t rxb1Filters[4] = {0x08, 0x10, 0x14, 0x18};
+
+  int8_t rxb0Hit = -1;
+  if (rxb0Any) {
+    rxb0Hit = 0;
+  } else if (filterMatches(0x00, 0x20, id, extended)) {
+    rxb0Hit = 0;
+  } else if (filterMatches(0x04, 0x20, id, extended)) {
+    rxb0Hit = 1;
+  }
+
+  bool stored = false;
+  if (rxb0Hit >= 0) {
+    if (!(registers[kRegCanIntF] & kRx0If)) {
+      storeRx(0, id, extended, length, data, static_cast<uint8_t>(rxb0Hit));
+      stored = true;
+    } else if ((registers[kRegRxb0Ctrl] & 0x04) && !(registers[kRegCanIntF] & kRx1If)) {
+      storeRx(1, id, extended, length, data, static_cast<uint8_t>(rxb0Hit));
+      stored = true;
+    } else {
+      registers[kRegEflg] |= kRx0Ovr;
+    }
+  } else {
+    int8_t rxb1Hit = -1;
+    if (rxb1Any) {
+      rxb1Hit = 2;
+    } else {
+      for (uint8_t i = 0; i < 4 && rxb1Hit < 0; i++) {
+        if (filterMatches(rxb1Filters[i], 0x24, id, extended)) rxb1Hit = static_cast<int8_t>(i + 2);
+      }
+    }
+    if (rxb1Hit < 0) return false;
+
+    if (!(registers[kRegCanIntF] & kRx1If)) {
+      storeRx(1, id, extended, length, data, static_cast<uint8_t>(rxb1Hit));
+      stored = true;
+    } else {
+      registers[kRegEflg] |= kRx1Ovr;
+    }
+  }
+
+  if (!stored) rxOverflows++;
+  hostPollInterrupts();
+  return stored;
+}
+
+bool Mcp2515Simulator::interruptAsserted() {
+  return (registers[kRegCanIntF] & registers[kRegCanIntE]) != 0;
+}
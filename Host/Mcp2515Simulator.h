@@ -0,0 +1,87 @@
+// ####################################################################################################################
+// Register-level MCP2515 simulator for host builds
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// The simulator sits behind the SPI shim and answers the real MCP_CAN driver, so the firmware's CAN path runs
+// unmodified on Linux. Frames requested through TXREQ are serialised onto a simulated 500 kbit/s bus in MCP2515
+// buffer-priority order and recorded with their bus completion timestamp. Frames can also be injected on the RX side,
+// where the chip's mask/filter and rollover rules are applied before they reach RXB0/RXB1.
+// ####################################################################################################################
+
+#ifndef MCP2515_SIMULATOR_H
+#define MCP2515_SIMULATOR_H
+
+#include <vector>
+
+#include "Arduino.h"
+#include "SPI.h"
+
+struct CapturedFrame {
+  uint64_t timeNanos;
+  uint32_t id;
+  bool extended;
+  uint8_t length;
+  uint8_t data[8];
+};
+
+class Mcp2515Simulator : public HostSpiDevice, public HostPinListener {
+ public:
+  Mcp2515Simulator(uint8_t csPin, uint8_t intPin, uint32_t bitRate = 500000);
+
+  // Registers the simulator with the GPIO and SPI shims. Must run before MCP_CAN::begin().
+  void attach();
+
+  // Places a frame on the simulated bus towards the MCP2515. Returns false if it was filtered or overflowed.
+  bool injectFrame(uint32_t id, bool extended, uint8_t length, const uint8_t* data);
+
+  const std::vector<CapturedFrame>& frames() const { return transmitted; }
+  void clearFrames() { transmitted.clear(); }
+  uint32_t rxOverflowCount() const { return rxOverflows; }
+  uint64_t busBusyNanos() const { return busyNanos; }
+  uint32_t txRequestCount() const { return txRequests; }
+
+  void spiSelect() override;
+  void spiDeselect() override;
+  uint8_t spiTransfer(uint8_t value) override;
+
+  void pinWritten(uint8_t pin, uint8_t value) override;
+  int pinRead(uint8_t pin) override;
+
+ private:
+  enum Phase { Phase_Command, Phase_Address, Phase_Mask, Phase_Data, Phase_Done };
+
+  uint8_t csPin;
+  uint8_t intPin;
+  uint64_t bitNanos;
+
+  uint8_t registers[128];
+  uint64_t txRequestedAt[3];
+  uint64_t busFreeAt = 0;
+  int8_t transmitting = -1;  // buffer on the bus as of the last advanceBus()
+  uint64_t busyNanos = 0;
+  uint32_t rxOverflows = 0;
+  uint32_t txRequests = 0;
+  std::vector<CapturedFrame> transmitted;
+
+  bool selected = false;
+  Phase phase = Phase_Command;
+  uint8_t instruction = 0;
+  uint8_t address = 0;
+  uint8_t bitMask = 0;
+  uint8_t rxBufferRead = 0;
+
+  void reset();
+  uint8_t readRegister(uint8_t address);
+  void writeRegister(uint8_t address, uint8_t value);
+  uint8_t readStatus();
+  uint8_t rxStatus();
+
+  void requestTransmit(uint8_t buffer);
+  void advanceBus();
+  void completeTransmit(uint8_t buffer, uint64_t endNanos);
+  bool filterMatches(uint8_t filterAddress, uint8_t maskAddress, uint32_t id, bool extended);
+  void storeRx(uint8_t buffer, uint32_t id, bool extended, uint8_t length, const uint8_t* data, uint8_t filterHit);
+  bool interruptAsserted();
+};
+
+#endif
@@ -0,0 +1,140 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - decodeForzaPacket against hand-built packets of every format
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include <math.h>
+#include <string.h>
+
+#include <vector>
+
+#include "HostTest.h"
+#include "../../CarCluster/src/Games/ForzaDataOut.h"
+
+namespace {
+
+struct PacketLayout {
+  ForzaPacketFormat format;
+  size_t length;
+  size_t dashBase;       // 0 when the format has no dash block
+  size_t extensionBase;  // 0 when the format has no extension block
+};
+
+const PacketLayout kLayouts[] = {
+    {ForzaPacketFormat_Sled, 232, 0, 0},
+    {ForzaPacketFormat_Dash, 311, 232, 0},
+    {ForzaPacketFormat_Horizon, 324, 244, 0},
+    {ForzaPacketFormat_Motorsport2023, 331, 232, 311},
+};
+
+void putFloat(std::vector<uint8_t>& packet, size_t offset, float value) {
+  memcpy(&packet[offset], &value, sizeof(value));
+}
+
+void putS32(std::vector<uint8_t>& packet, size_t offset, int32_t value) {
+  memcpy(&packet[offset], &value, sizeof(value));
+}
+
+std::vector<uint8_t> buildPacket(const PacketLayout& layout) {
+  std::vector<uint8_t> packet(layout.length, 0);
+  putS32(packet, 0, 1);
+  putFloat(packet, 8, 7500.0f);
+  putFloat(packet, 12, 850.0f);
+  putFloat(packet, 16, 4321.5f);
+  putFloat(packet, 32, 0.25f);
+  putFloat(packet, 36, -0.5f);
+  putFloat(packet, 40, 31.0f);
+  for (int wheel = 0; wheel < 4; wheel++) putFloat(packet, 180 + 4 * wheel, 0.5f + wheel);
+  putS32(packet, 224, ForzaDrivetrain_AWD);
+
+  if (layout.dashBase) {
+    putFloat(packet, layout.dashBase + 12, 33.3f);
+    for (int wheel = 0; wheel < 4; wheel++) putFloat(packet, layout.dashBase + 24 + 4 * wheel, 180.0f + wheel);
+    putFloat(packet, layout.dashBase + 40, 14.7f);
+    putFloat(packet, layout.dashBase + 44, 0.625f);
+    packet[layout.dashBase + 71] = 255;
+    packet[layout.dashBase + 72] = 12;
+    packet[layout.dashBase + 74] = 200;
+    packet[layout.dashBase + 75] = 3;
+  }
+  if (layout.extensionBase) {
+    for (int wheel = 0; wheel < 4; wheel++) putFloat(packet, layout.extensionBase + 4 * wheel, 0.1f * (wheel + 1));
+  }
+  return packet;
+}
+
+void testEveryFormat() {
+  for (const PacketLayout& layout : kLayouts) {
+    CHECK(detectForzaPacketFormat(layout.length) == layout.format);
+    CHECK(forzaPacketHasDash(layout.format) == (layout.dashBase != 0));
+
+    const std::vector<uint8_t> packet = buildPacket(layout);
+    ForzaTelemetry telemetry;
+    CHECK(decodeForzaPacket(packet.data(), packet.size(), telemetry));
+    CHECK(telemetry.format == layout.format);
+
+    CHECK(telemetry.isRaceOn == 1);
+    CHECK(telemetry.engineMaxRpm == 7500.0f);
+    CHECK(telemetry.engineIdleRpm == 850.0f);
+    CHECK(telemetry.currentEngineRpm == 4321.5f);
+    CHECK(telemetry.velocity[0] == 0.25f && telemetry.velocity[1] == -0.5f && telemetry.velocity[2] == 31.0f);
+    CHECK(telemetry.tireCombinedSlip[0] == 0.5f && telemetry.tireCombinedSlip[3] == 3.5f);
+    CHECK(telemetry.drivetrainType == ForzaDrivetrain_AWD);
+
+    if (layout.dashBase) {
+      CHECK(telemetry.speed == 33.3f);
+      CHECK(telemetry.tireTemperature[0] == 180.0f && telemetry.tireTemperature[3] == 183.0f);
+      CHECK(telemetry.boost == 14.7f);
+      CHECK(telemetry.fuel == 0.625f);
+      CHECK(telemetry.accelerator == 255);
+      CHECK(telemetry.brake == 12);
+      CHECK(telemetry.handbrake == 200);
+      CHECK(telemetry.gear == 3);
+    } else {
+      CHECK(telemetry.speed == 0.0f && telemetry.fuel == 0.0f && telemetry.gear == 0);
+    }
+
+    if (layout.extensionBase) {
+      CHECK(telemetry.tireWear[0] == 0.1f && telemetry.tireWear[3] == 0.4f);
+    } else {
+      CHECK(telemetry.tireWear[0] == 0.0f && telemetry.tireWear[3] == 0.0f);
+    }
+  }
+}
+
+void testUnknownLengthLeavesTelemetry() {
+  const std::vector<uint8_t> packet(300, 0xAB);
+  ForzaTelemetry telemetry;
+  memset(&telemetry, 0, sizeof(telemetry));
+  telemetry.speed = 12.0f;
+  CHECK(detectForzaPacketFormat(packet.size()) == ForzaPacketFormat_Unknown);
+  CHECK(!decodeForzaPacket(packet.data(), packet.size(), telemetry));
+  CHECK(telemetry.speed == 12.0f);
+}
+
+void testNonFiniteFloatsDecodeAsZero() {
+  std::vector<uint8_t> packet = buildPacket(kLayouts[1]);
+  putFloat(packet, 16, NAN);
+  putFloat(packet, 232 + 12, INFINITY);
+  putFloat(packet, 232 + 44, -INFINITY);
+
+  ForzaTelemetry telemetry;
+  CHECK(decodeForzaPacket(packet.data(), packet.size(), telemetry));
+  CHECK(telemetry.currentEngineRpm == 0.0f);
+  CHECK(telemetry.speed == 0.0f);
+  CHECK(telemetry.fuel == 0.0f);
+  CHECK(telemetry.engineMaxRpm == 7500.0f);
+}
+
+}  // namespace
+
+int main() {
+  testEveryFormat();
+  testUnknownLengthLeavesTelemetry();
+  testNonFiniteFloatsDecodeAsZero();
+  return hostTestResult();
+}
@@ -0,0 +1,76 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - FrameTemplate counter-delta CRC against a full recompute
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include <string.h>
+
+#include "HostTest.h"
+#include "../../CarCluster/src/Clusters/BMW_F/FrameTemplate.h"
+
+namespace {
+
+bool frameIs(FrameTemplate& frameTemplate, const uint8_t* expected) {
+  return memcmp(frameTemplate.frame(), expected, frameTemplate.length()) == 0;
+}
+
+void testGoldenRpmFrame() {
+  // 0x0F3 as it appears in carcluster_host --dump with the engine off.
+  const uint8_t payload[] = {0x00, 0x00, 0xC0, 0xF0, 0x00, 0xFF, 0xFF};
+  FrameTemplate rpm;
+  rpm.begin<8, 0x7A>(0x0F3, payload);
+  CHECK(rpm.id() == 0x0F3);
+  CHECK(rpm.length() == 8);
+
+  const uint8_t counter0[] = {0x78, 0x00, 0x00, 0xC0, 0xF0, 0x00, 0xFF, 0xFF};
+  CHECK(frameIs(rpm, counter0));
+
+  rpm.setCounter(6);
+  const uint8_t counter6[] = {0xAB, 0x06, 0x00, 0xC0, 0xF0, 0x00, 0xFF, 0xFF};
+  CHECK(frameIs(rpm, counter6));
+}
+
+// Steps the counter through a full cycle on every frame length, with an upper nibble in byte 1 and some payload
+// changes in between, and compares each CRC with a recompute over the whole frame.
+template <uint8_t length, uint8_t finalXor>
+void testCounterDeltaMatchesRecompute() {
+  const uint8_t payload[7] = {0xF0, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC};
+  FrameTemplate frameTemplate;
+  frameTemplate.begin<length, finalXor>(0x100 + length, payload);
+
+  for (unsigned step = 0; step < 48; step++) {
+    frameTemplate.setCounter(static_cast<uint8_t>(step));
+    if (step % 11 == 5 && length > 2) frameTemplate.setByte(length - 1, static_cast<uint8_t>(step * 29));
+    if (step % 13 == 7) frameTemplate.setBits(1, 0xF0, static_cast<uint8_t>(step << 4));
+
+    const uint8_t* frame = frameTemplate.frame();
+    CHECK((frame[1] & 0x0F) == (step & 0x0F));
+    CHECK(frame[0] == CRC8::get_crc8(&frame[1], length - 1, finalXor));
+  }
+}
+
+void testByteZeroIsNotPatchable() {
+  const uint8_t payload[] = {0x00, 0x11, 0x22};
+  FrameTemplate frameTemplate;
+  frameTemplate.begin<4, 0x5A>(0x1A1, payload);
+  const uint8_t crcBefore = frameTemplate.frame()[0];
+  frameTemplate.setByte(0, static_cast<uint8_t>(~crcBefore));
+  frameTemplate.setByte(4, 0x55);
+  CHECK(frameTemplate.frame()[0] == crcBefore);
+}
+
+}  // namespace
+
+int main() {
+  testGoldenRpmFrame();
+  testCounterDeltaMatchesRecompute<2, 0x00>();
+  testCounterDeltaMatchesRecompute<4, 0x5A>();
+  testCounterDeltaMatchesRecompute<5, 0x3D>();
+  testCounterDeltaMatchesRecompute<8, 0x7A>();
+  testByteZeroIsNotPatchable();
+  return hostTestResult();
+}
@@ -0,0 +1,36 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - minimal checks for the host unit tests
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+//
+// Each test is a small executable registered with ctest. CHECK() reports a failed condition with its location and
+// keeps going, so one run lists every broken case; hostTestResult() turns the count into the exit code.
+// ####################################################################################################################
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+inline int& hostTestFailures() {
+  static int failures = 0;
+  return failures;
+}
+
+#define CHECK(condition)                                                  \
+  do {                                                                    \
+    if (!(condition)) {                                                   \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+      hostTestFailures()++;                                               \
+    }                                                                     \
+  } while (0)
+
+inline int hostTestResult() {
+  if (hostTestFailures() > 0) fprintf(stderr, "%d check(s) failed\n", hostTestFailures());
+  return hostTestFailures() > 0 ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,125 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - SerialFrameDecoder round trip and golden frames
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include <string.h>
+
+#include <vector>
+
+#include "HostTest.h"
+#include "../../CarCluster/src/Games/SerialFrameProtocol.h"
+
+namespace {
+
+// Same encoder as Tools/carcluster_serial.py.
+std::vector<uint8_t> encodeFrame(uint8_t type, const uint8_t* payload, uint8_t length) {
+  std::vector<uint8_t> body = {length, type};
+  body.insert(body.end(), payload, payload + length);
+  body.push_back(serialFrameCrc8(body.data(), body.size()));
+
+  std::vector<uint8_t> frame = {0x00};
+  size_t codeIndex = frame.size();
+  frame.push_back(0);
+  uint8_t code = 1;
+  for (uint8_t byte : body) {
+    if (byte == 0) {
+      frame[codeIndex] = code;
+      codeIndex = frame.size();
+      frame.push_back(0);
+      code = 1;
+    } else {
+      frame.push_back(byte);
+      if (++code == 0xFF) {
+        frame[codeIndex] = code;
+        codeIndex = frame.size();
+        frame.push_back(0);
+        code = 1;
+      }
+    }
+  }
+  frame[codeIndex] = code;
+  frame.push_back(0x00);
+  return frame;
+}
+
+// Returns the number of frames the decoder completed.
+int feed(SerialFrameDecoder& decoder, const std::vector<uint8_t>& bytes) {
+  int completed = 0;
+  for (uint8_t byte : bytes) {
+    if (decoder.push(byte)) completed++;
+  }
+  return completed;
+}
+
+void testGoldenPassthrough() {
+  // carcluster_serial.can_passthrough(0x1A1, bytes([0x00, 0x11, 0x00, 0x00, 0x22]))
+  const std::vector<uint8_t> golden = {0x00, 0x02, 0x07, 0x03, 0xA1, 0x01, 0x02, 0x11, 0x01, 0x03, 0x22, 0x2A, 0x00};
+
+  SerialFrameDecoder decoder;
+  CHECK(feed(decoder, golden) == 1);
+  CHECK(decoder.type() == SerialFrameType_CanPassthrough);
+  CHECK(decoder.payloadLength() == 7);
+
+  const uint8_t expected[] = {0xA1, 0x01, 0x00, 0x11, 0x00, 0x00, 0x22};
+  CHECK(memcmp(decoder.payload(), expected, sizeof(expected)) == 0);
+
+  const uint8_t payload[] = {0xA1, 0x01, 0x00, 0x11, 0x00, 0x00, 0x22};
+  CHECK(encodeFrame(SerialFrameType_CanPassthrough, payload, sizeof(payload)) == golden);
+}
+
+void testRoundTripLengths() {
+  SerialFrameDecoder decoder;
+  for (unsigned length = 0; length <= SERIAL_FRAME_MAX_PAYLOAD; length++) {
+    uint8_t payload[SERIAL_FRAME_MAX_PAYLOAD];
+    // Zero every seventh byte so COBS code bytes of every size show up.
+    for (unsigned i = 0; i < length; i++) payload[i] = i % 7 == 0 ? 0 : static_cast<uint8_t>(i * 37 + length);
+
+    CHECK(feed(decoder, encodeFrame(SerialFrameType_SimhubTelemetry, payload, length)) == 1);
+    CHECK(decoder.type() == SerialFrameType_SimhubTelemetry);
+    CHECK(decoder.payloadLength() == length);
+    CHECK(memcmp(decoder.payload(), payload, length) == 0);
+  }
+  CHECK(decoder.rejectedFrames() == 0);
+}
+
+void testRejectsCorruptFrames() {
+  const uint8_t payload[] = {0x10, 0x27, 0x50, 0x00, 0x5A, 0x00, 0x03, 0x40, 0x01};
+
+  SerialFrameDecoder decoder;
+  std::vector<uint8_t> frame = encodeFrame(SerialFrameType_SimhubTelemetry, payload, sizeof(payload));
+  frame[frame.size() - 2] ^= 0x80;  // CRC byte
+  CHECK(feed(decoder, frame) == 0);
+  CHECK(decoder.rejectedFrames() == 1);
+
+  // The decoder resynchronises on the next delimiter.
+  CHECK(feed(decoder, encodeFrame(SerialFrameType_SimhubTelemetry, payload, sizeof(payload))) == 1);
+}
+
+void testIgnoresJsonBetweenFrames() {
+  const uint8_t payload[] = {0x01, 0x02};
+  const char* json = "{\"action\":10,\"rpm\":3000}\n";
+
+  std::vector<uint8_t> bytes(json, json + strlen(json));
+  const std::vector<uint8_t> frame = encodeFrame(SerialFrameType_SimhubTelemetry, payload, sizeof(payload));
+  bytes.insert(bytes.end(), frame.begin(), frame.end());
+
+  SerialFrameDecoder decoder;
+  CHECK(feed(decoder, bytes) == 1);
+  CHECK(decoder.type() == SerialFrameType_SimhubTelemetry);
+  CHECK(!decoder.active());
+}
+
+}  // namespace
+
+int main() {
+  testGoldenPassthrough();
+  testRoundTripLengths();
+  testRejectsCorruptFrames();
+  testIgnoresJsonBetweenFrames();
+  return hostTestResult();
+}
@@ -0,0 +1,121 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - TelemetryArbiter keeps recordings free of smoothing
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include <vector>
+
+#include "HostTest.h"
+#include "../../CarCluster/src/Games/TelemetryArbiter.h"
+#include "../../CarCluster/src/Games/TelemetryLog.h"
+
+namespace {
+
+// Appends a record for the given groups the way TelemetryRecorder::capture() does; the first one is a complete state.
+void appendRecord(std::vector<uint8_t>& log, const GameState& state, uint16_t groups, unsigned long delta) {
+  if (log.empty()) groups = GameStateGroup_All;
+  if (groups == 0) return;
+  uint8_t record[TELEMETRY_LOG_MAX_RECORD_SIZE];
+  const size_t length = encodeTelemetryRecord(record, static_cast<uint32_t>(delta), state, groups);
+  log.insert(log.end(), record, record + length);
+}
+
+// A 30 Hz source accelerating through 3 s, arbitrated and recorded every 10 ms like serviceCan().
+void testRecordingHoldsRawSamples() {
+  TelemetryArbiter arbiter(ClusterConfiguration(), TELEMETRY_SOURCE_TIMEOUT_MS);
+  GameState game{ClusterConfiguration()};
+  GameState& source = arbiter.source(TelemetrySource_Forza);
+
+  // What the recording must contain: every change the source made, as it made it.
+  GameState sourceTrace{ClusterConfiguration()};
+  std::vector<uint8_t> expected;
+  std::vector<uint8_t> recorded;
+  std::vector<uint8_t> cluster;
+  unsigned long lastExpected = 0;
+  unsigned long lastRecorded = 0;
+  unsigned long lastCluster = 0;
+  int smoothedPasses = 0;
+
+  source.setField(source.ignition, true, GameStateGroup_Engine);
+  source.setField(source.engineRunning, true, GameStateGroup_Engine);
+  source.setField(source.gearLetter, 'D', GameStateGroup_Gear);
+
+  unsigned long nextSample = 0;
+  int sample = 0;
+  for (unsigned long now = 0; now <= 3000; now += 10) {
+    if (now >= nextSample) {
+      source.setField(source.speed, sample, GameStateGroup_Speed);
+      source.setField(source.rpm, 800 + sample * 40, GameStateGroup_Engine);
+      arbiter.markFresh(TelemetrySource_Forza, now);
+
+      sourceTrace.copyGroups(source, GameStateGroup_All);
+      const uint16_t groups = sourceTrace.takeDirtyGroups();
+      if (expected.empty() || groups != 0) {
+        appendRecord(expected, sourceTrace, groups, now - lastExpected);
+        lastExpected = now;
+      }
+      sample++;
+      nextSample += 33;
+    }
+
+    arbiter.arbitrate(now);
+    const GameState& arbitrated = arbiter.arbitrated();
+    if (recorded.empty() || arbitrated.dirtyGroups != 0) {
+      appendRecord(recorded, arbitrated, arbitrated.dirtyGroups, now - lastRecorded);
+      lastRecorded = now;
+    }
+
+    arbiter.apply(game, now);
+    if (game.speed != arbitrated.speed || game.rpm != arbitrated.rpm) smoothedPasses++;
+    const uint16_t groups = game.takeDirtyGroups();
+    if (cluster.empty() || groups != 0) {
+      appendRecord(cluster, game, groups, now - lastCluster);
+      lastCluster = now;
+    }
+  }
+
+  CHECK(recorded == expected);
+#if TELEMETRY_SMOOTHING
+  // The cluster state itself is smoothed, so recording it instead would store the filter's output.
+  CHECK(smoothedPasses > 0);
+  CHECK(cluster != expected);
+#else
+  CHECK(smoothedPasses == 0);
+#endif
+}
+
+// The filters are reset to the new source on a switch, so the first pass drives the cluster with its raw values.
+void testSourceSwitchAppliesRawValues() {
+  TelemetryArbiter arbiter(ClusterConfiguration(), TELEMETRY_SOURCE_TIMEOUT_MS);
+  GameState game{ClusterConfiguration()};
+  GameState& source = arbiter.source(TelemetrySource_Simhub);
+
+  source.setField(source.speed, 123, GameStateGroup_Speed);
+  source.setField(source.rpm, 4567, GameStateGroup_Engine);
+  arbiter.markFresh(TelemetrySource_Simhub, 100);
+
+  CHECK(arbiter.arbitrate(100) == TelemetrySource_Simhub);
+  CHECK(arbiter.arbitrated().speed == 123);
+  arbiter.apply(game, 100);
+  CHECK(game.speed == 123);
+  CHECK(game.rpm == 4567);
+  CHECK(arbiter.arbitrated().dirtyGroups == 0);
+
+  // Timing out falls back to the parked state.
+  CHECK(arbiter.arbitrate(100 + TELEMETRY_SOURCE_TIMEOUT_MS) == TelemetrySource_None);
+  arbiter.apply(game, 100 + TELEMETRY_SOURCE_TIMEOUT_MS);
+  CHECK(game.speed == 0);
+  CHECK(game.rpm == 0);
+}
+
+}  // namespace
+
+int main() {
+  testRecordingHoldsRawSamples();
+  testSourceSwitchAppliesRawValues();
+  return hostTestResult();
+}
@@ -0,0 +1,100 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - TelemetryFilter extrapolation, settling and resets
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "HostTest.h"
+#include "../../CarCluster/src/Games/TelemetryFilter.h"
+
+namespace {
+
+void testResetHoldsValue() {
+  TelemetryFilter filter(20);
+  filter.reset(88, 1000);
+  CHECK(filter.estimate(1000) == 88);
+  CHECK(filter.estimate(5000) == 88);
+}
+
+void testRampIsSmoothAndSettles() {
+  // 1 km/h every 33 ms, the way a 30 Hz game accelerates.
+  TelemetryFilter filter(20);
+  filter.reset(0, 0);
+  unsigned long now = 0;
+  int value = 0;
+  for (int sample = 0; sample < 60; sample++) {
+    now += 33;
+    value++;
+    filter.measure(value, now);
+  }
+
+  // Between samples the estimate moves forward, never past the next measurement by more than one step.
+  const int atSample = filter.estimate(now);
+  const int between = filter.estimate(now + 20);
+  CHECK(between >= atSample);
+  CHECK(between <= value + 1);
+  CHECK(atSample >= value - 1 && atSample <= value + 1);
+
+  // Extrapolation holds after one interval and settles on the last measured value after two.
+  CHECK(filter.estimate(now + 33) == filter.estimate(now + 50));
+  CHECK(filter.estimate(now + 66) == value);
+  CHECK(filter.estimate(now + 1000) == value);
+}
+
+void testStepBeyondLimitResets() {
+  TelemetryFilter filter(1000);
+  filter.reset(800, 0);
+  for (unsigned long now = 20; now <= 200; now += 20) filter.measure(800, now);
+
+  filter.measure(6500, 220);  // a rev jump well past the step limit
+  CHECK(filter.estimate(220) == 6500);
+  CHECK(filter.estimate(240) == 6500);
+}
+
+void testLongGapResets() {
+  TelemetryFilter filter(20);
+  filter.reset(0, 0);
+  filter.measure(10, 20);
+  filter.measure(20, 40);
+
+  // The next sample arrives after the interval limit: no extrapolation from the old rate.
+  const unsigned long late = 40 + TELEMETRY_FILTER_MAX_INTERVAL_MS + 1;
+  filter.measure(25, late);
+  CHECK(filter.estimate(late) == 25);
+  CHECK(filter.estimate(late + 30) == 25);
+}
+
+void testExtrapolationIsCapped() {
+  // Samples 200 ms apart are inside the interval limit but extrapolate for at most 100 ms.
+  TelemetryFilter filter(50);
+  filter.reset(0, 0);
+  filter.measure(10, 200);
+  filter.measure(20, 400);
+  const int capped = filter.estimate(400 + TELEMETRY_FILTER_MAX_EXTRAPOLATION_MS);
+  CHECK(filter.estimate(400 + TELEMETRY_FILTER_MAX_EXTRAPOLATION_MS + 50) == capped);
+  CHECK(filter.estimate(400 + 2 * TELEMETRY_FILTER_MAX_EXTRAPOLATION_MS) == 20);
+}
+
+void testNegativeValues() {
+  TelemetryFilter filter(20);
+  filter.reset(-5, 0);
+  filter.measure(-6, 20);
+  filter.measure(-7, 40);
+  CHECK(filter.estimate(40) <= -6);
+  CHECK(filter.estimate(200) == -7);
+}
+
+}  // namespace
+
+int main() {
+  testResetHoldsValue();
+  testRampIsSmoothAndSettles();
+  testStepBeyondLimitResets();
+  testLongGapResets();
+  testExtrapolationIsCapped();
+  testNegativeValues();
+  return hostTestResult();
+}
@@ -0,0 +1,163 @@
+// ####################################################################################################################
+// CarCluster-F10-Enhanced - TelemetryLog encode/decode round trip
+// Author / maintainer: JackieZ123430
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// 仅供个人学习、研究及非商业用途。禁止倒卖或付费分发。
+// Personal learning, research and non-commercial use only. Preserve author and project attribution.
+// ####################################################################################################################
+
+#include "HostTest.h"
+#include "../../CarCluster/src/Games/TelemetryLog.h"
+
+namespace {
+
+GameState drivingState() {
+  GameState state{ClusterConfiguration()};
+  state.speed = 143;
+  state.rpm = 5210;
+  state.engineRunning = true;
+  state.ignition = true;
+  state.gear = GearState_Manual_4;
+  state.gearLetter = 'M';
+  state.gearIndex = 4;
+  state.coolantTemperature = 104;
+  state.oilTemperature = 118;
+  state.outdoorTemperature = -7;
+  state.fuelQuantity = 63.25f;
+  state.lowFuelLight = true;
+  state.leftTurningIndicator = true;
+  state.mainLights = true;
+  state.highBeam = true;
+  state.doorFR = true;
+  state.doorOpen = true;
+  state.handbrake = true;
+  state.driveMode = 5;
+  state.absLight = true;
+  state.tcsActive = true;
+  state.tireDefRL = true;
+  state.backlightBrightness = 37;
+  state.time = 1234567;
+  return state;
+}
+
+void checkSameGroups(const GameState& a, const GameState& b) {
+  CHECK(a.speed == b.speed);
+  CHECK(a.rpm == b.rpm);
+  CHECK(a.engineRunning == b.engineRunning);
+  CHECK(a.ignition == b.ignition);
+  CHECK(a.gear == b.gear);
+  CHECK(a.gearLetter == b.gearLetter);
+  CHECK(a.gearIndex == b.gearIndex);
+  CHECK(a.coolantTemperature == b.coolantTemperature);
+  CHECK(a.oilTemperature == b.oilTemperature);
+  CHECK(a.outdoorTemperature == b.outdoorTemperature);
+  CHECK(a.fuelQuantity == b.fuelQuantity);
+  CHECK(a.lowFuelLight == b.lowFuelLight);
+  CHECK(a.leftTurningIndicator == b.leftTurningIndicator);
+  CHECK(a.mainLights == b.mainLights);
+  CHECK(a.highBeam == b.highBeam);
+  CHECK(a.doorFR == b.doorFR);
+  CHECK(a.doorOpen == b.doorOpen);
+  CHECK(a.handbrake == b.handbrake);
+  CHECK(a.driveMode == b.driveMode);
+  CHECK(a.absLight == b.absLight);
+  CHECK(a.tcsActive == b.tcsActive);
+  CHECK(a.tireDefRL == b.tireDefRL);
+  CHECK(a.backlightBrightness == b.backlightBrightness);
+  CHECK(a.time == b.time);
+}
+
+void testHeader() {
+  uint8_t header[TELEMETRY_LOG_HEADER_SIZE];
+  CHECK(encodeTelemetryLogHeader(header) == TELEMETRY_LOG_HEADER_SIZE);
+  CHECK(isTelemetryLogHeader(header, sizeof(header)));
+  CHECK(!isTelemetryLogHeader(header, sizeof(header) - 1));
+  header[3]++;
+  CHECK(!isTelemetryLogHeader(header, sizeof(header)));
+}
+
+void testFullRecordRoundTrip() {
+  const GameState source = drivingState();
+  uint8_t record[TELEMETRY_LOG_MAX_RECORD_SIZE];
+  const size_t length = encodeTelemetryRecord(record, 0xFFFFFFFF, source, GameStateGroup_All);
+  CHECK(length == TELEMETRY_LOG_MAX_RECORD_SIZE);
+
+  GameState decoded{ClusterConfiguration()};
+  decoded.takeDirtyGroups();
+  uint32_t deltaMs = 0;
+  CHECK(decodeTelemetryRecord(record, length, &deltaMs, decoded) == length);
+  CHECK(deltaMs == 0xFFFFFFFF);
+  checkSameGroups(source, decoded);
+
+  uint32_t peeked = 0;
+  CHECK(peekTelemetryRecordDelta(record, length, &peeked));
+  CHECK(peeked == deltaMs);
+}
+
+void testPartialGroups() {
+  GameState source = drivingState();
+  GameState decoded = drivingState();
+  decoded.takeDirtyGroups();
+  source.speed = 12;
+  source.fuelQuantity = 4.5f;
+
+  uint8_t record[TELEMETRY_LOG_MAX_RECORD_SIZE];
+  const size_t length =
+      encodeTelemetryRecord(record, 20, source, GameStateGroup_Speed | GameStateGroup_Fuel);
+  CHECK(length == 1 + 2 + 2 + 5);
+
+  uint32_t deltaMs = 0;
+  CHECK(decodeTelemetryRecord(record, length, &deltaMs, decoded) == length);
+  CHECK(deltaMs == 20);
+  CHECK(decoded.speed == 12);
+  CHECK(decoded.fuelQuantity == 4.5f);
+  CHECK(decoded.takeDirtyGroups() == (GameStateGroup_Speed | GameStateGroup_Fuel));
+}
+
+void testTruncatedRecord() {
+  const GameState source = drivingState();
+  uint8_t record[TELEMETRY_LOG_MAX_RECORD_SIZE];
+  const size_t length = encodeTelemetryRecord(record, 300000, source, GameStateGroup_All);
+
+  for (size_t cut = 0; cut < length; cut++) {
+    GameState decoded{ClusterConfiguration()};
+    uint32_t deltaMs = 0;
+    CHECK(decodeTelemetryRecord(record, cut, &deltaMs, decoded) == 0);
+  }
+}
+
+void testRecordSequence() {
+  // Three records back to back decode in order, the way a replay reads a file buffer.
+  GameState source = drivingState();
+  uint8_t log[3 * TELEMETRY_LOG_MAX_RECORD_SIZE];
+  size_t length = encodeTelemetryRecord(log, 0, source, GameStateGroup_All);
+  source.rpm = 900;
+  length += encodeTelemetryRecord(log + length, 16, source, GameStateGroup_Engine);
+  source.gear = GearState_Auto_N;
+  length += encodeTelemetryRecord(log + length, 140, source, GameStateGroup_Gear);
+
+  GameState decoded{ClusterConfiguration()};
+  const uint32_t expectedDeltas[] = {0, 16, 140};
+  size_t position = 0;
+  for (uint32_t expected : expectedDeltas) {
+    uint32_t deltaMs = 0;
+    const size_t consumed = decodeTelemetryRecord(log + position, length - position, &deltaMs, decoded);
+    CHECK(consumed > 0);
+    CHECK(deltaMs == expected);
+    position += consumed;
+  }
+  CHECK(position == length);
+  checkSameGroups(source, decoded);
+}
+
+}  // namespace
+
+int main() {
+  testHeader();
+  testFullRecordRoundTrip();
+  testPartialGroups();
+  testTruncatedRecord();
+  testRecordSequence();
+  return hostTestResult();
+}
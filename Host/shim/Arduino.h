@@ -0,0 +1,125 @@
+// ####################################################################################################################
+// Host (Linux) stand-in for the Arduino core
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// Only the subset of the Arduino/ESP32 API used by the F10 build is provided. Time is simulated: millis(), micros()
+// and delay() read and advance a nanosecond clock owned by HostClock, so a host run is deterministic and can execute
+// thousands of simulated cluster ticks per wall-clock second.
+// ####################################################################################################################
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define LOW 0x0
+#define HIGH 0x1
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define FALLING 0x02
+#define RISING 0x01
+#define CHANGE 0x03
+
+#define F(string_literal) (string_literal)
+#define IRAM_ATTR
+
+// ----------------------------- Simulated time -----------------------------------------------------------------------
+
+class HostClock {
+ public:
+  static uint64_t nanos() { return nowNanos; }
+  static void advanceNanos(uint64_t delta) { nowNanos += delta; }
+  static void reset() { nowNanos = 0; }
+
+ private:
+  static uint64_t nowNanos;
+};
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// ----------------------------- GPIO ---------------------------------------------------------------------------------
+
+// Pins can be backed by a simulated device. Output writes are forwarded to the device and input reads are answered
+// by it, which is how the MCP2515 simulator sees chip-select edges and drives its INT line.
+class HostPinListener {
+ public:
+  virtual ~HostPinListener() {}
+  virtual void pinWritten(uint8_t pin, uint8_t value) = 0;
+  virtual int pinRead(uint8_t pin) = 0;
+};
+
+void hostAttachPin(uint8_t pin, HostPinListener* listener);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+uint8_t digitalPinToInterrupt(uint8_t pin);
+
+// Delivers any pending edge on an attached interrupt pin. Called by the simulated device after its line changes.
+void hostPollInterrupts();
+
+// ----------------------------- Math helpers -------------------------------------------------------------------------
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// ----------------------------- Serial -------------------------------------------------------------------------------
+
+class HardwareSerial {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  int available();
+  int read();
+  size_t write(uint8_t value);
+  size_t write(const uint8_t* buffer, size_t size);
+
+  size_t print(const char* text);
+  size_t print(char value);
+  size_t print(int value);
+  size_t print(unsigned int value);
+  size_t print(long value);
+  size_t print(unsigned long value);
+  size_t print(double value);
+
+  size_t println();
+  size_t println(const char* text);
+  size_t println(int value);
+  size_t println(unsigned int value);
+  size_t println(long value);
+  size_t println(unsigned long value);
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+  // Host only: queue bytes that the sketch will later receive, and control whether output reaches stdout.
+  void pushInput(const uint8_t* data, size_t size);
+  void pushInput(const char* text);
+  void setEcho(bool enabled) { echo = enabled; }
+
+ private:
+  bool echo = true;
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,49 @@
+// ####################################################################################################################
+// Host (Linux) stand-in for the ESP32 AsyncUDP library
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// No sockets are opened. Listeners register by port and the host harness delivers datagrams synchronously with
+// AsyncUDP::deliver(), which invokes the onPacket handler exactly as the ESP32 async_udp task would.
+// ####################################################################################################################
+
+#ifndef HOST_ASYNC_UDP_H
+#define HOST_ASYNC_UDP_H
+
+#include <functional>
+
+#include "Arduino.h"
+
+class AsyncUDPPacket {
+ public:
+  AsyncUDPPacket(const uint8_t* data, size_t length) : bytes(data), size(length) {}
+
+  uint8_t* data() { return const_cast<uint8_t*>(bytes); }
+  size_t length() const { return size; }
+
+ private:
+  const uint8_t* bytes;
+  size_t size;
+};
+
+typedef std::function<void(AsyncUDPPacket& packet)> AuPacketHandlerFunction;
+
+class AsyncUDP {
+ public:
+  AsyncUDP() {}
+  ~AsyncUDP();
+  AsyncUDP(const AsyncUDP&) = delete;
+  AsyncUDP& operator=(const AsyncUDP&) = delete;
+
+  bool listen(uint16_t port);
+  void onPacket(AuPacketHandlerFunction handler) { this->handler = handler; }
+  void close();
+
+  // Host only: hand a datagram to the listener bound to port. Returns false if nobody is listening.
+  static bool deliver(uint16_t port, const uint8_t* data, size_t length);
+
+ private:
+  uint16_t port = 0;
+  AuPacketHandlerFunction handler;
+};
+
+#endif
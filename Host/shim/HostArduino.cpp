@@ -0,0 +1,294 @@
+// ####################################################################################################################
+// Host (Linux) implementation of the Arduino core subset
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+// ####################################################################################################################
+
+#include "Arduino.h"
+#include "AsyncUDP.h"
+#include "SPI.h"
+
+#include <deque>
+#include <map>
+
+uint64_t HostClock::nowNanos = 0;
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+namespace {
+
+const uint8_t kPinCount = 40;
+
+HostPinListener* pinListeners[kPinCount] = {};
+uint8_t pinLevels[kPinCount] = {};
+
+struct InterruptBinding {
+  void (*isr)(void) = nullptr;
+  int mode = 0;
+  int lastLevel = HIGH;
+};
+
+InterruptBinding interrupts[kPinCount];
+bool interruptsRunning = false;
+
+std::deque<uint8_t> serialInput;
+uint32_t randomState = 0x2545F491u;
+
+// Intentionally never destroyed: game objects holding an AsyncUDP are globals whose destructors run after any
+// function-local static would have been torn down.
+std::map<uint16_t, AsyncUDP*>& udpListeners() {
+  static std::map<uint16_t, AsyncUDP*>* listeners = new std::map<uint16_t, AsyncUDP*>();
+  return *listeners;
+}
+
+}  // namespace
+
+// ----------------------------- Time ---------------------------------------------------------------------------------
+
+unsigned long millis() {
+  return static_cast<unsigned long>(HostClock::nanos() / 1000000ULL);
+}
+
+unsigned long micros() {
+  return static_cast<unsigned long>(HostClock::nanos() / 1000ULL);
+}
+
+void delay(unsigned long ms) {
+  HostClock::advanceNanos(static_cast<uint64_t>(ms) * 1000000ULL);
+  hostPollInterrupts();
+}
+
+void delayMicroseconds(unsigned int us) {
+  HostClock::advanceNanos(static_cast<uint64_t>(us) * 1000ULL);
+  hostPollInterrupts();
+}
+
+void yield() {
+  hostPollInterrupts();
+}
+
+// ----------------------------- GPIO ---------------------------------------------------------------------------------
+
+void hostAttachPin(uint8_t pin, HostPinListener* listener) {
+  if (pin < kPinCount) pinListeners[pin] = listener;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (pin >= kPinCount) return;
+  pinLevels[pin] = value;
+  if (pinListeners[pin]) pinListeners[pin]->pinWritten(pin, value);
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= kPinCount) return LOW;
+  if (pinListeners[pin]) return pinListeners[pin]->pinRead(pin);
+  return pinLevels[pin];
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+  if (pin >= kPinCount) return;
+  interrupts[pin].isr = isr;
+  interrupts[pin].mode = mode;
+  interrupts[pin].lastLevel = digitalRead(pin);
+}
+
+void detachInterrupt(uint8_t pin) {
+  if (pin < kPinCount) interrupts[pin].isr = nullptr;
+}
+
+uint8_t digitalPinToInterrupt(uint8_t pin) {
+  return pin;
+}
+
+void hostPollInterrupts() {
+  if (interruptsRunning) return;
+  interruptsRunning = true;
+
+  for (uint8_t pin = 0; pin < kPinCount; pin++) {
+    InterruptBinding& binding = interrupts[pin];
+    if (!binding.isr) continue;
+
+    const int level = digitalRead(pin);
+    if (level == binding.lastLevel) continue;
+
+    const bool falling = binding.lastLevel == HIGH && level == LOW;
+    binding.lastLevel = level;
+
+    if (binding.mode == CHANGE || (binding.mode == FALLING && falling) || (binding.mode == RISING && !falling)) {
+      binding.isr();
+    }
+  }
+
+  interruptsRunning = false;
+}
+
+// ----------------------------- Math helpers -------------------------------------------------------------------------
+
+long random(long howBig) {
+  if (howBig <= 0) return 0;
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return static_cast<long>(randomState % static_cast<uint32_t>(howBig));
+}
+
+long random(long howSmall, long howBig) {
+  if (howSmall >= howBig) return howSmall;
+  return random(howBig - howSmall) + howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) randomState = static_cast<uint32_t>(seed);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ----------------------------- Serial -------------------------------------------------------------------------------
+
+int HardwareSerial::available() {
+  return static_cast<int>(serialInput.size());
+}
+
+int HardwareSerial::read() {
+  if (serialInput.empty()) return -1;
+  const uint8_t value = serialInput.front();
+  serialInput.pop_front();
+  return value;
+}
+
+size_t HardwareSerial::write(uint8_t value) {
+  if (echo) fputc(value, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  if (echo) fwrite(buffer, 1, size, stdout);
+  return size;
+}
+
+size_t HardwareSerial::print(const char* text) {
+  return write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+}
+
+size_t HardwareSerial::print(char value) {
+  return write(static_cast<uint8_t>(value));
+}
+
+size_t HardwareSerial::print(int value) {
+  return printf("%d", value);
+}
+
+size_t HardwareSerial::print(unsigned int value) {
+  return printf("%u", value);
+}
+
+size_t HardwareSerial::print(long value) {
+  return printf("%ld", value);
+}
+
+size_t HardwareSerial::print(unsigned long value) {
+  return printf("%lu", value);
+}
+
+size_t HardwareSerial::print(double value) {
+  return printf("%.2f", value);
+}
+
+size_t HardwareSerial::println() {
+  return print("\r\n");
+}
+
+size_t HardwareSerial::println(const char* text) {
+  return print(text) + println();
+}
+
+size_t HardwareSerial::println(int value) {
+  return print(value) + println();
+}
+
+size_t HardwareSerial::println(unsigned int value) {
+  return print(value) + println();
+}
+
+size_t HardwareSerial::println(long value) {
+  return print(value) + println();
+}
+
+size_t HardwareSerial::println(unsigned long value) {
+  return print(value) + println();
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+  char buffer[256];
+  va_list arguments;
+  va_start(arguments, format);
+  const int length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+  va_end(arguments);
+  if (length <= 0) return 0;
+  return write(reinterpret_cast<const uint8_t*>(buffer),
+               static_cast<size_t>(length) < sizeof(buffer) ? static_cast<size_t>(length) : sizeof(buffer) - 1);
+}
+
+void HardwareSerial::pushInput(const uint8_t* data, size_t size) {
+  serialInput.insert(serialInput.end(), data, data + size);
+}
+
+void HardwareSerial::pushInput(const char* text) {
+  pushInput(reinterpret_cast<const uint8_t*>(text), strlen(text));
+}
+
+// ----------------------------- SPI ----------------------------------------------------------------------------------
+
+void SPIClass::beginTransaction(SPISettings settings) {
+  clockHz = settings.clock > 0 ? settings.clock : 1000000;
+  transactions++;
+}
+
+void SPIClass::endTransaction() {}
+
+uint8_t SPIClass::transfer(uint8_t value) {
+  // Eight clock edges per byte at the configured SPI clock.
+  HostClock::advanceNanos(8000000000ULL / clockHz);
+  bytes++;
+  return selected ? selected->spiTransfer(value) : 0xFF;
+}
+
+void SPIClass::transfer(void* buffer, size_t size) {
+  uint8_t* data = static_cast<uint8_t*>(buffer);
+  for (size_t i = 0; i < size; i++) data[i] = transfer(data[i]);
+}
+
+// ----------------------------- AsyncUDP -----------------------------------------------------------------------------
+
+AsyncUDP::~AsyncUDP() {
+  close();
+}
+
+bool AsyncUDP::listen(uint16_t port) {
+  close();
+  if (udpListeners().count(port)) return false;
+  this->port = port;
+  udpListeners()[port] = this;
+  return true;
+}
+
+void AsyncUDP::close() {
+  if (port != 0 && udpListeners()[port] == this) udpListeners().erase(port);
+  port = 0;
+}
+
+bool AsyncUDP::deliver(uint16_t port, const uint8_t* data, size_t length) {
+  auto listener = udpListeners().find(port);
+  if (listener == udpListeners().end() || !listener->second->handler) return false;
+
+  AsyncUDPPacket packet(data, length);
+  listener->second->handler(packet);
+  return true;
+}
@@ -0,0 +1,60 @@
+// ####################################################################################################################
+// Host (Linux) stand-in for the Arduino SPI library
+// Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+//
+// Transfers are routed to whichever simulated device currently has its chip-select pin held LOW. Every byte advances
+// the simulated clock by its wire time so that SPI-heavy code paths cost simulated time just like on the ESP32.
+// ####################################################################################################################
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MODE0 0x00
+
+class SPISettings {
+ public:
+  SPISettings() : clock(1000000) {}
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) : clock(clock) {
+    (void)bitOrder;
+    (void)dataMode;
+  }
+
+  uint32_t clock;
+};
+
+class HostSpiDevice {
+ public:
+  virtual ~HostSpiDevice() {}
+  virtual void spiSelect() = 0;
+  virtual void spiDeselect() = 0;
+  virtual uint8_t spiTransfer(uint8_t value) = 0;
+};
+
+class SPIClass {
+ public:
+  void begin() {}
+  void end() {}
+  void beginTransaction(SPISettings settings);
+  void endTransaction();
+  uint8_t transfer(uint8_t value);
+  void transfer(void* buffer, size_t size);
+
+  // Host only: the device that currently owns the bus (set by its chip-select listener) and transaction statistics.
+  void hostSetSelectedDevice(HostSpiDevice* device) { selected = device; }
+  uint32_t hostTransactionCount() const { return transactions; }
+  uint64_t hostByteCount() const { return bytes; }
+
+ private:
+  HostSpiDevice* selected = nullptr;
+  uint32_t clockHz = 1000000;
+  uint32_t transactions = 0;
+  uint64_t bytes = 0;
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+# CarCluster-F10-Enhanced - binary serial frame encoder (PC side)
+# Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+# Personal learning, research and non-commercial use only.
+#
+# Encodes the frames described in CarCluster/src/Games/SerialFrameProtocol.h:
+#
+#   0x00 | COBS(length, type, payload[length], crc8) | 0x00
+#
+# Usage as a module:
+#   import carcluster_serial as cc
+#   port.write(cc.simhub_telemetry(rpm=3000, speed=80, gear=3, running=True))
+#   port.write(cc.can_passthrough(0x5C0, bytes([0x40, 39, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF])))
+#   cc.replay(port, capture)  # capture: [(time_ms, can_id, data), ...]
+#
+# Usage from the command line (requires pyserial):
+#   carcluster_serial.py /dev/ttyUSB0 --rpm 3000 --speed 80 --gear 3 --rate 100
+
+import argparse
+import struct
+import time
+
+TYPE_CAN_PASSTHROUGH = 0
+TYPE_CAN_BATCH = 1
+TYPE_SIMHUB_TELEMETRY = 10
+
+MAX_PAYLOAD = 240
+
+BATCH_FLAG_CONTINUE = 0x01
+
+FLAG_RUNNING = 0x01
+FLAG_PAUSED = 0x02
+FLAG_LEFT_INDICATOR = 0x04
+FLAG_RIGHT_INDICATOR = 0x08
+FLAG_HANDBRAKE = 0x10
+FLAG_ABS = 0x20
+FLAG_TRACTION_CONTROL = 0x40
+
+
+def crc8(data):
+    crc = 0x00
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray()
+    block = bytearray()
+    for byte in data:
+        if byte == 0:
+            out.append(len(block) + 1)
+            out += block
+            block.clear()
+        else:
+            block.append(byte)
+            if len(block) == 254:
+                out.append(0xFF)
+                out += block
+                block.clear()
+    out.append(len(block) + 1)
+    out += block
+    return bytes(out)
+
+
+def frame(frame_type, payload):
+    if len(payload) > MAX_PAYLOAD:
+        raise ValueError("payload longer than %d bytes" % MAX_PAYLOAD)
+    body = bytes([len(payload), frame_type]) + bytes(payload)
+    return b"\x00" + cobs_encode(body + bytes([crc8(body)])) + b"\x00"
+
+
+def can_passthrough(can_id, data):
+    if can_id > 0x7FF or len(data) > 8:
+        raise ValueError("standard CAN ID and at most 8 data bytes expected")
+    return frame(TYPE_CAN_PASSTHROUGH, struct.pack("<H", can_id) + bytes(data))
+
+
+def can_batch(records, continue_previous=False):
+    """records: iterable of (offset_ms, can_id, data) relative to the batch base time."""
+    payload = bytearray([BATCH_FLAG_CONTINUE if continue_previous else 0])
+    for offset_ms, can_id, data in records:
+        if can_id > 0x7FF or len(data) > 8 or not 0 <= offset_ms <= 0xFFFF:
+            raise ValueError("invalid batch record")
+        payload += struct.pack("<HHB", offset_ms, can_id, len(data)) + bytes(data)
+    return frame(TYPE_CAN_BATCH, payload)
+
+
+def can_replay(capture):
+    """Splits a capture of (time_ms, can_id, data) into chained batches that keep the original spacing.
+
+    Returns (start_ms, batch) pairs, start_ms being when the batch's first frame plays relative to the first batch.
+    The first batch starts when it arrives; each following batch continues from the last frame of the previous one.
+    """
+    batches = []
+    records = []
+    size = 1
+    base_ms = None
+    last_ms = None
+    first_ms = None
+    for time_ms, can_id, data in capture:
+        time_ms = int(round(time_ms))
+        if base_ms is None:
+            base_ms = first_ms = time_ms
+        record_size = 5 + len(data)
+        if records and (size + record_size > MAX_PAYLOAD or time_ms - base_ms > 0xFFFF):
+            batches.append((records[0][0] + base_ms - first_ms, can_batch(records, continue_previous=bool(batches))))
+            records, size, base_ms = [], 1, last_ms
+        if time_ms - base_ms > 0xFFFF:
+            raise ValueError("gap longer than 65535 ms")
+        records.append((time_ms - base_ms, can_id, data))
+        size += record_size
+        last_ms = time_ms
+    if records:
+        batches.append((records[0][0] + base_ms - first_ms, can_batch(records, continue_previous=bool(batches))))
+    return batches
+
+
+def replay(port, capture, lead_ms=100):
+    """Streams a capture, writing each batch lead_ms before it plays so the firmware queue (32 frames) never fills."""
+    start = time.monotonic()
+    for start_ms, batch in can_replay(capture):
+        delay = (start_ms - lead_ms) / 1000.0 - (time.monotonic() - start)
+        if delay > 0:
+            time.sleep(delay)
+        port.write(batch)
+
+
+def simhub_telemetry(rpm=0, speed=0, oil_temperature=90, gear=0, fuel=0, running=False, paused=False,
+                     left_indicator=False, right_indicator=False, handbrake=False, abs_active=False,
+                     traction_control=False):
+    flags = ((FLAG_RUNNING if running else 0) |
+             (FLAG_PAUSED if paused else 0) |
+             (FLAG_LEFT_INDICATOR if left_indicator else 0) |
+             (FLAG_RIGHT_INDICATOR if right_indicator else 0) |
+             (FLAG_HANDBRAKE if handbrake else 0) |
+             (FLAG_ABS if abs_active else 0) |
+             (FLAG_TRACTION_CONTROL if traction_control else 0))
+    payload = struct.pack("<HHhbBB",
+                          max(0, min(int(rpm), 0xFFFF)),
+                          max(0, min(int(speed), 0xFFFF)),
+                          int(oil_temperature),
+                          max(-128, min(int(gear), 127)),
+                          max(0, min(int(fuel), 100)),
+                          flags)
+    return frame(TYPE_SIMHUB_TELEMETRY, payload)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Send binary SimHub telemetry frames to CarCluster")
+    parser.add_argument("port")
+    parser.add_argument("--baud", type=int, default=921600)
+    parser.add_argument("--rate", type=float, default=50.0, help="frames per second")
+    parser.add_argument("--rpm", type=int, default=800)
+    parser.add_argument("--speed", type=int, default=0)
+    parser.add_argument("--gear", type=int, default=0)
+    parser.add_argument("--fuel", type=int, default=60)
+    parser.add_argument("--oil", type=int, default=90)
+    args = parser.parse_args()
+
+    import serial
+
+    with serial.Serial(args.port, args.baud) as port:
+        packet = simhub_telemetry(rpm=args.rpm, speed=args.speed, oil_temperature=args.oil, gear=args.gear,
+                                  fuel=args.fuel, running=True)
+        while True:
+            port.write(packet)
+            time.sleep(1.0 / args.rate)
+
+
+if __name__ == "__main__":
+    main()
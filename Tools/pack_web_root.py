@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+# CarCluster-F10-Enhanced - split the packed dashboard UI into content-hashed files
+# Project: https://github.com/JackieZ123430/CarCluster-F10-Enhanced
+# Personal learning, research and non-commercial use only.
+#
+# Mongoose Wizard exports the whole UI as one index.html.gz in mongoose_fs.c, script and styles inline, so every page
+# load downloads all of it again. Run this on mongoose_fs.c after each export. It moves the inline module script and
+# styles of every packed page into /web_root/app.<hash>.js and /web_root/app.<hash>.css. The hash is the first eight
+# hex digits of the SHA-256 of the file's content. mongoose_impl.c serves those names as immutable. Each packed file
+# is also stamped with a hash of its content instead of a date. mongoose derives its ETag from that stamp and the
+# size, so the ETag of the page only changes when its content does.
+#
+# Pages that have nothing inline left are packed unchanged, so running the tool twice is harmless.
+#
+#   pack_web_root.py [CarCluster/src/Other/mongoose/mongoose_fs.c]
+#   pack_web_root.py --extract DIR    # write the packed pages out, uncompressed and with the assets inlined again
+#   pack_web_root.py --source DIR     # pack DIR as /web_root instead, e.g. an edited --extract
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+DEFAULT_FS = os.path.join(os.path.dirname(__file__), "..", "CarCluster", "src", "Other", "mongoose", "mongoose_fs.c")
+
+ROOT = "/web_root/"
+HASH_DIGITS = 8  # ASSET_HASH_LEN in mongoose_impl.c
+
+HEADER = """#include "mongoose.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+const char *mg_unlist(size_t no);
+const char *mg_unpack(const char *, size_t *, time_t *);
+#if defined(__cplusplus)
+}
+#endif
+"""
+
+FOOTER = """
+static int scmp(const char *a, const char *b) {
+  while (*a && (*a == *b)) a++, b++;
+  return *(const unsigned char *) a - *(const unsigned char *) b;
+}
+const char *mg_unlist(size_t no) {
+  return packed_files[no].name;
+}
+const char *mg_unpack(const char *name, size_t *size, time_t *mtime) {
+  const struct packed_file *p;
+  for (p = packed_files; p->name != NULL; p++) {
+    if (scmp(p->name, name) != 0) continue;
+    if (size != NULL) *size = p->size - 1;
+    if (mtime != NULL) *mtime = p->mtime;
+    return (const char *) p->data;
+  }
+  return NULL;
+}
+"""
+
+INLINE_STYLE = re.compile(rb"<style>(.*?)</style>", re.S)
+INLINE_SCRIPT = re.compile(rb"<script type=module>(.*?)</script>", re.S)
+LINKED_STYLE = re.compile(rb"<link rel=stylesheet href=(app\.[0-9a-f]+\.css)>")
+LINKED_SCRIPT = re.compile(rb"<script type=module src=(app\.[0-9a-f]+\.js)></script>")
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:HASH_DIGITS]
+
+
+def stamp(data):
+    # Fits a 32-bit time_t and never changes for the same content.
+    return int(content_hash(data)[:HASH_DIGITS - 1], 16)
+
+
+def read_packed(path):
+    """Returns {name: content} from a mongoose_fs.c, gzipped files decompressed and named without .gz."""
+    with open(path, encoding="latin-1") as source:
+        text = source.read()
+
+    arrays = {}
+    for match in re.finditer(r"static const unsigned char (v\d+)\[\] = \{(.*?)\};", text, re.S):
+        body = re.sub(r"//[^\n]*", "", match.group(2))
+        arrays[match.group(1)] = bytes(int(value) for value in body.replace(",", " ").split())[:-1]
+
+    files = {}
+    for name, array in re.findall(r'\{"([^"]+)", (v\d+), sizeof\(v\d+\), \d+\}', text):
+        data = arrays[array]
+        if name.endswith(".gz"):
+            name, data = name[:-3], gzip.decompress(data)
+        files[name] = data
+    return files
+
+
+def split_inline(files):
+    """Moves the first inline style and module script of every page into hashed files of their own."""
+    result = dict(files)
+    for name, page in files.items():
+        if not name.endswith(".html"):
+            continue
+        for pattern, extension, tag in (
+            (INLINE_STYLE, "css", b"<link rel=stylesheet href=%s>"),
+            (INLINE_SCRIPT, "js", b"<script type=module src=%s></script>"),
+        ):
+            match = pattern.search(page)
+            if not match:
+                continue
+            content = match.group(1)
+            asset = "app.%s.%s" % (content_hash(content), extension)
+            result[ROOT + asset] = content
+            page = page[:match.start()] + tag % asset.encode() + page[match.end():]
+        result[name] = page
+    return result
+
+
+def join_inline(files):
+    """Undoes split_inline(), so an extracted page is edited in one piece and renamed assets never go stale."""
+    result = dict(files)
+    for name, page in files.items():
+        if not name.endswith(".html"):
+            continue
+        for pattern, tag in ((LINKED_STYLE, b"<style>%s</style>"), (LINKED_SCRIPT, b"<script type=module>%s</script>")):
+            match = pattern.search(page)
+            if not match or ROOT + match.group(1).decode() not in files:
+                continue
+            asset = ROOT + match.group(1).decode()
+            page = page[:match.start()] + tag % result.pop(asset) + page[match.end():]
+        result[name] = page
+    return result
+
+
+def write_array(output, index, data):
+    # The layout Mongoose Wizard's packer writes, NUL terminated.
+    output.write("static const unsigned char v%d[] = {\n" % index)
+    ascii = ""
+    for byte in data:
+        if len(ascii) == 12:
+            output.write(" // %s\n" % ascii)
+            ascii = ""
+        ascii += chr(byte) if 32 <= byte < 127 and byte != ord("\\") else "."
+        output.write(" %3u," % byte)
+    output.write(" 0 // %s\n};\n" % ascii)
+
+
+def write_packed(path, files):
+    packed = []
+    with open(path, "w", encoding="latin-1", newline="\n") as output:
+        output.write(HEADER)
+        for index, name in enumerate(sorted(files, key=lambda n: (not n.endswith("index.html"), n)), start=1):
+            data = gzip.compress(files[name], compresslevel=9, mtime=0)
+            output.write("\n")
+            write_array(output, index, data)
+            packed.append((name + ".gz", index, stamp(files[name]), len(data)))
+        output.write("\nstatic const struct packed_file {\n"
+                     "  const char *name;\n"
+                     "  const unsigned char *data;\n"
+                     "  size_t size;\n"
+                     "  time_t mtime;\n"
+                     "} packed_files[] = {\n")
+        for name, index, mtime, _ in packed:
+            output.write('  {"%s", v%d, sizeof(v%d), %d},\n' % (name, index, index, mtime))
+        output.write("  {NULL, NULL, 0, 0}\n};\n")
+        output.write(FOOTER)
+    return packed
+
+
+def read_directory(directory):
+    files = {}
+    for base, _, names in os.walk(directory):
+        for name in names:
+            path = os.path.join(base, name)
+            with open(path, "rb") as source:
+                files[ROOT + os.path.relpath(path, directory).replace(os.sep, "/")] = source.read()
+    return files
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Split the packed dashboard UI into content-hashed files")
+    parser.add_argument("fs", nargs="?", default=DEFAULT_FS, help="mongoose_fs.c to rewrite")
+    parser.add_argument("--extract", metavar="DIR", help="write the packed files to DIR and exit")
+    parser.add_argument("--source", metavar="DIR", help="pack DIR instead of the files already in mongoose_fs.c")
+    args = parser.parse_args()
+
+    if args.extract:
+        for name, data in join_inline(read_packed(args.fs)).items():
+            path = os.path.join(args.extract, name[len(ROOT):])
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            with open(path, "wb") as output:
+                output.write(data)
+        return 0
+
+    files = read_directory(args.source) if args.source else read_packed(args.fs)
+    for name, _, mtime, size in write_packed(args.fs, split_inline(files)):
+        print("%-36s %7d bytes  etag \"%d.%d\"" % (name, size, mtime, size))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())